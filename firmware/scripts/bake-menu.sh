@@ -1,14 +1,18 @@
 #!/bin/bash
-# Bake worker/renderer/menu.png into a C header (src/menu_png.h) so the firmware
+# Bake worker/renderer/menu.png into a C header (src/menu_4bpp.h) so the firmware
 # can render the on-device menu with no network dependency.
 #
 # Regenerate the PNG first: `npm run preview:menu` in worker/renderer.
+#
+# The PNG is pre-quantized to the panel's 4bpp framebuffer layout and
+# run-length coded by pack_4bpp.py (see src/rle4.h), so the device expands it
+# with memcpy/memset runs instead of running the PNG decoder.
 
 set -euo pipefail
 
 SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
 MENU_PNG="${SCRIPT_DIR}/../../worker/renderer/menu.png"
-OUT_HEADER="${SCRIPT_DIR}/../src/menu_png.h"
+OUT_HEADER="${SCRIPT_DIR}/../src/menu_4bpp.h"
 
 if [ ! -f "$MENU_PNG" ]; then
     echo "ERROR: menu PNG not found at $MENU_PNG" >&2
@@ -18,15 +22,23 @@ fi
 
 PNG_SIZE=$(stat -f%z "$MENU_PNG")
 
+RLE_TMP="$(mktemp)"
+trap 'rm -f "$RLE_TMP"' EXIT
+python3 "${SCRIPT_DIR}/pack_4bpp.py" "$MENU_PNG" "$RLE_TMP"
+RLE_SIZE=$(stat -f%z "$RLE_TMP")
+
 {
     echo "// Auto-generated by scripts/bake-menu.sh from worker/renderer/menu.png."
     echo "// Do not edit by hand — re-run the script if the menu changes."
+    echo "// Run-length-coded 4bpp framebuffer (scripts/pack_4bpp.py, src/rle4.h)."
     echo "#pragma once"
     echo "#include <stdint.h>"
     echo
-    xxd -i -n menu_png "$MENU_PNG" \
-        | sed -e 's/unsigned char/const uint8_t/' \
-              -e 's/unsigned int/const uint32_t/'
+    # xxd names the array after its input file, so feed it from stdin.
+    echo "const uint8_t menu_4bpp[] = {"
+    xxd -i < "$RLE_TMP"
+    echo "};"
+    echo "const uint32_t menu_4bpp_len = ${RLE_SIZE};"
 } > "$OUT_HEADER"
 
-echo "Wrote $OUT_HEADER (source PNG: ${PNG_SIZE} bytes)"
+echo "Wrote $OUT_HEADER (source PNG: ${PNG_SIZE} bytes, packed: ${RLE_SIZE} bytes)"
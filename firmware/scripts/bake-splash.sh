@@ -1,15 +1,19 @@
 #!/bin/bash
-# Bake worker/renderer/splash.png into a C header (src/splash_png.h) so the
+# Bake worker/renderer/splash.png into a C header (src/splash_4bpp.h) so the
 # firmware can display the splash screen with no network dependency.
 #
 # Re-run this whenever splash.png changes. The output is committed to git so
 # the build doesn't depend on bake having been run.
+#
+# The PNG is pre-quantized to the panel's 4bpp framebuffer layout and
+# run-length coded by pack_4bpp.py (see src/rle4.h), so the device expands it
+# with memcpy/memset runs instead of running the PNG decoder.
 
 set -euo pipefail
 
 SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
 SPLASH_PNG="${SCRIPT_DIR}/../../worker/renderer/splash.png"
-OUT_HEADER="${SCRIPT_DIR}/../src/splash_png.h"
+OUT_HEADER="${SCRIPT_DIR}/../src/splash_4bpp.h"
 
 if [ ! -f "$SPLASH_PNG" ]; then
     echo "ERROR: splash PNG not found at $SPLASH_PNG"
@@ -19,15 +23,23 @@ fi
 
 PNG_SIZE=$(stat -f%z "$SPLASH_PNG")
 
+RLE_TMP="$(mktemp)"
+trap 'rm -f "$RLE_TMP"' EXIT
+python3 "${SCRIPT_DIR}/pack_4bpp.py" "$SPLASH_PNG" "$RLE_TMP"
+RLE_SIZE=$(stat -f%z "$RLE_TMP")
+
 {
     echo "// Auto-generated by scripts/bake-splash.sh from worker/renderer/splash.png."
     echo "// Do not edit by hand — re-run the script if the splash changes."
+    echo "// Run-length-coded 4bpp framebuffer (scripts/pack_4bpp.py, src/rle4.h)."
     echo "#pragma once"
     echo "#include <stdint.h>"
     echo
-    xxd -i -n splash_png "$SPLASH_PNG" \
-        | sed -e 's/unsigned char/const uint8_t/' \
-              -e 's/unsigned int/const uint32_t/'
+    # xxd names the array after its input file, so feed it from stdin.
+    echo "const uint8_t splash_4bpp[] = {"
+    xxd -i < "$RLE_TMP"
+    echo "};"
+    echo "const uint32_t splash_4bpp_len = ${RLE_SIZE};"
 } > "$OUT_HEADER"
 
-echo "Wrote $OUT_HEADER (source PNG: ${PNG_SIZE} bytes)"
+echo "Wrote $OUT_HEADER (source PNG: ${PNG_SIZE} bytes, packed: ${RLE_SIZE} bytes)"
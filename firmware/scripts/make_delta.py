@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""
+Make a delta OTA patch that rebuilds <new.bin> from <old.bin>, in the format
+src/delta_patch.h applies on the device. Used by ota-publish.sh.
+
+Usage:
+    python3 scripts/make_delta.py <old.bin> <new.bin> <out.patch>
+    python3 scripts/make_delta.py --apply <old.bin> <in.patch> <out.bin>
+
+Every patch is checked before it's written: it's applied back onto <old.bin>
+with the reference applier below (a line-for-line mirror of delta_patch.h) and
+the result must match <new.bin> byte for byte. --apply runs that applier on its
+own, e.g. to check a patch fetched back from the worker.
+
+Matching: the old image is indexed by 8-byte keys at every 4th offset. At each
+position of the new image the longest exact match among the candidates (plus
+"carry on where the last match ended", the common case after an insertion) is
+taken, extended backwards into any pending literal bytes, then forwards past
+small differences while the matched bytes still outnumber the differing ones.
+A run with differences becomes an ADD (only the differing bytes are stored),
+an exact one a COPY, and whatever matches nothing an INSERT.
+
+Standard library only (hashlib + struct).
+"""
+
+import hashlib
+import struct
+import sys
+from pathlib import Path
+
+MAGIC = b"WDP1"
+OP_END, OP_COPY, OP_ADD, OP_INSERT = 0, 1, 2, 3
+
+KEY = 8           # index key length
+STRIDE = 4        # index every STRIDE-th old offset
+MAX_CANDS = 8     # offsets kept per key
+MIN_MATCH = 24    # shortest exact match worth an op
+SLACK = 32        # forward extension gives up this far below its best score
+GAP = 4           # ADD: unchanged runs shorter than this stay inside a diff run
+
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        if v:
+            out.append(b | 0x80)
+        else:
+            out.append(b)
+            return bytes(out)
+
+
+def zigzag(d):
+    return (d << 1) if d >= 0 else ((-d - 1) << 1) | 1
+
+
+def exact_len(a, ai, b, bi, limit):
+    """Length of the common run a[ai:] / b[bi:], at most `limit`."""
+    n = 0
+    while n + 64 <= limit and a[ai + n:ai + n + 64] == b[bi + n:bi + n + 64]:
+        n += 64
+    while n < limit and a[ai + n] == b[bi + n]:
+        n += 1
+    return n
+
+
+def extend(old, s, new, t):
+    """How far a match at (s, t) usefully reaches, allowing sparse differences."""
+    limit = min(len(old) - s, len(new) - t)
+    n = score = best = best_n = 0
+    while n < limit:
+        if old[s + n:s + n + 64] == new[t + n:t + n + 64] and n + 64 <= limit:
+            n += 64
+            score += 64
+        else:
+            score += 1 if old[s + n] == new[t + n] else -1
+            n += 1
+        if score > best:
+            best, best_n = score, n
+        elif score < best - SLACK:
+            break
+    return best_n
+
+
+def add_pairs(old, s, new, t, n):
+    """ADD body: (skip, diff bytes) pairs covering n bytes."""
+    body = bytearray()
+    i = 0
+    while i < n:
+        j = i
+        while j < n and old[s + j] == new[t + j]:
+            j += 1
+        skip = j - i
+        k = j
+        same = 0
+        while k < n:
+            if old[s + k] == new[t + k]:
+                same += 1
+                if same >= GAP:
+                    k -= same - 1
+                    break
+            else:
+                same = 0
+            k += 1
+        else:
+            k -= same
+        diff = bytes((new[t + x] - old[s + x]) & 0xFF for x in range(j, k))
+        body += varint(skip) + varint(len(diff)) + diff
+        i = k
+    return bytes(body)
+
+
+def make_patch(old, new):
+    index = {}
+    for j in range(0, len(old) - KEY + 1, STRIDE):
+        cands = index.setdefault(old[j:j + KEY], [])
+        if len(cands) < MAX_CANDS:
+            cands.append(j)
+
+    ops = bytearray()
+    cursor = 0      # old offset the last COPY/ADD ended at
+    lit_start = 0   # pending INSERT bytes: new[lit_start:t]
+    t = 0
+
+    def flush_literal(end):
+        if end > lit_start:
+            ops.extend(bytes([OP_INSERT]) + varint(end - lit_start) + new[lit_start:end])
+
+    while t < len(new):
+        best_s, best_len = -1, 0
+        cands = list(index.get(new[t:t + KEY], ()))
+        if cursor < len(old):
+            cands.append(cursor)
+        for s in cands:
+            limit = min(len(old) - s, len(new) - t)
+            n = exact_len(old, s, new, t, limit)
+            if n > best_len:
+                best_s, best_len = s, n
+        if best_len < MIN_MATCH:
+            t += 1
+            continue
+
+        # Pull the match back over bytes we were about to insert literally.
+        s = best_s
+        while t > lit_start and s > 0 and old[s - 1] == new[t - 1]:
+            s -= 1
+            t -= 1
+        flush_literal(t)
+
+        n = max(extend(old, s, new, t), best_len + (best_s - s))
+        d = varint(zigzag(s - cursor)) + varint(n)
+        if old[s:s + n] == new[t:t + n]:
+            ops.extend(bytes([OP_COPY]) + d)
+        else:
+            ops.extend(bytes([OP_ADD]) + d + add_pairs(old, s, new, t, n))
+        cursor = s + n
+        t += n
+        lit_start = t
+
+    flush_literal(len(new))
+    ops.append(OP_END)
+    header = (MAGIC + struct.pack("<II", len(old), len(new))
+              + hashlib.sha256(old).digest() + hashlib.sha256(new).digest())
+    return header + bytes(ops)
+
+
+class Reader:
+    def __init__(self, data):
+        self.data, self.pos = data, 0
+
+    def take(self, n):
+        if self.pos + n > len(self.data):
+            raise ValueError("patch truncated")
+        chunk = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return chunk
+
+    def varint(self):
+        v = shift = 0
+        while True:
+            b = self.take(1)[0]
+            v |= (b & 0x7F) << shift
+            if not b & 0x80:
+                return v
+            shift += 7
+
+
+def apply_patch(old, patch):
+    """Reference applier — mirrors delta::apply() in src/delta_patch.h."""
+    r = Reader(patch)
+    if r.take(4) != MAGIC:
+        raise ValueError("bad magic")
+    src_size, dst_size = struct.unpack("<II", r.take(8))
+    src_sha, dst_sha = r.take(32), r.take(32)
+    if src_size != len(old) or hashlib.sha256(old).digest() != src_sha:
+        raise ValueError("patch was made against a different source image")
+    out = bytearray()
+    cursor = 0
+    while True:
+        op = r.take(1)[0]
+        if op == OP_END:
+            break
+        if op == OP_INSERT:
+            out += r.take(r.varint())
+            continue
+        if op not in (OP_COPY, OP_ADD):
+            raise ValueError("bad op %d" % op)
+        d, n = r.varint(), r.varint()
+        s = cursor + ((d >> 1) if not d & 1 else -(d >> 1) - 1)
+        if s < 0 or s + n > src_size:
+            raise ValueError("source run out of bounds")
+        cursor = s + n
+        if op == OP_COPY:
+            out += old[s:s + n]
+            continue
+        pos, left = s, n
+        while left:
+            skip, k = r.varint(), r.varint()
+            if skip > left or k > left - skip or skip + k == 0:
+                raise ValueError("bad ADD pair")
+            out += old[pos:pos + skip]
+            diff = r.take(k)
+            out += bytes((old[pos + skip + i] + diff[i]) & 0xFF for i in range(k))
+            pos += skip + k
+            left -= skip + k
+    if r.pos != len(patch):
+        raise ValueError("trailing bytes after END")
+    if len(out) != dst_size or hashlib.sha256(out).digest() != dst_sha:
+        raise ValueError("result does not match the target hash")
+    return bytes(out)
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 4 and args[0] == "--apply":
+        old, patch = Path(args[1]).read_bytes(), Path(args[2]).read_bytes()
+        Path(args[3]).write_bytes(apply_patch(old, patch))
+        print("applied %s -> %s" % (args[2], args[3]))
+        return
+    if len(args) != 3:
+        print(__doc__.strip().split("\n\n")[1], file=sys.stderr)
+        sys.exit(1)
+
+    old, new = Path(args[0]).read_bytes(), Path(args[1]).read_bytes()
+    patch = make_patch(old, new)
+    if apply_patch(old, patch) != new:
+        sys.exit("ERROR: patch does not reproduce %s" % args[1])
+    Path(args[2]).write_bytes(patch)
+    print("%s: %d bytes (%.1f%% of %d)" % (args[2], len(patch),
+                                            100.0 * len(patch) / len(new), len(new)))
+
+
+if __name__ == "__main__":
+    main()
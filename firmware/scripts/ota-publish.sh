@@ -2,19 +2,32 @@
 # Publish a firmware build as the latest OTA release.
 #
 # Uploads firmware/.pio/build/firmware/firmware.bin to KV under
-# firmware:bin:{version} and points firmware:latest at that version. The worker
+# firmware:bin:{version} (and its SHA-256 under firmware:sha256:{version}, which
+# devices verify the downloaded image against) and points firmware:latest at
+# that version. The worker
 # advertises firmware:latest on every weather response (X-Firmware-Latest), and
 # devices self-update when it exceeds their compiled-in FIRMWARE_VERSION.
 # (Binary stored in KV in the interim; migrate to R2 later — see ROADMAP.md.)
 #
+# It also makes delta patches (scripts/make_delta.py) from older releases to
+# this one, stored as firmware:patch:{from}:{version}; a device running {from}
+# downloads the patch instead of the full image. By default the patch is from
+# the release being replaced (the current firmware:latest).
+#
+# The full image is also packed compressed (scripts/pack_ota.py) and stored as
+# firmware:wfz:{version}; devices without a patch download that and inflate it
+# into flash as it arrives.
+#
 # Usage:
-#   ota-publish.sh [--build] [--version N] [--dry-run]
+#   ota-publish.sh [--build] [--version N] [--delta-from "N ..."] [--no-delta] [--dry-run]
 #
-#   --build    Run `pio run -e firmware` before uploading.
-#   --version  Override the version number (default: grep FIRMWARE_VERSION
-#              from firmware/src/config.h).
-#   --dry-run  Print the resolved version and the exact wrangler commands
-#              without running them.
+#   --build       Run `pio run -e firmware` before uploading.
+#   --version     Override the version number (default: grep FIRMWARE_VERSION
+#                 from firmware/src/config.h).
+#   --delta-from  Versions to make patches from (default: current firmware:latest).
+#   --no-delta    Upload the full image only.
+#   --dry-run     Print the resolved version and the exact wrangler commands
+#                 without running them.
 #
 # A real publish needs `wrangler login` first. See docs/ota.md for the full
 # release workflow.
@@ -30,6 +43,9 @@ FIRMWARE_BIN="${FIRMWARE_DIR}/.pio/build/firmware/firmware.bin"
 DO_BUILD=0
 DRY_RUN=0
 VERSION=""
+DELTA_FROM=""
+NO_DELTA=0
+USAGE="Usage: ota-publish.sh [--build] [--version N] [--delta-from \"N ...\"] [--no-delta] [--dry-run]"
 
 while [ $# -gt 0 ]; do
     case "$1" in
@@ -41,13 +57,21 @@ while [ $# -gt 0 ]; do
             VERSION="${2:-}"
             shift 2
             ;;
+        --delta-from)
+            DELTA_FROM="${2:-}"
+            shift 2
+            ;;
+        --no-delta)
+            NO_DELTA=1
+            shift
+            ;;
         --dry-run)
             DRY_RUN=1
             shift
             ;;
         *)
             echo "ERROR: unknown argument: $1" >&2
-            echo "Usage: ota-publish.sh [--build] [--version N] [--dry-run]" >&2
+            echo "$USAGE" >&2
             exit 1
             ;;
     esac
@@ -76,6 +100,14 @@ fi
 
 BIN_CMD="npx wrangler kv key put --binding=WEATHER_KV \"firmware:bin:${VERSION}\" --path=../firmware/.pio/build/firmware/firmware.bin"
 KV_CMD="npx wrangler kv key put --binding=WEATHER_KV \"firmware:latest\" \"${VERSION}\""
+SHA_CMD='npx wrangler kv key put --binding=WEATHER_KV "firmware:sha256:${VERSION}" "$(shasum -a 256 "$FIRMWARE_BIN" | cut -d" " -f1)"'
+LATEST_CMD="npx wrangler kv key get --binding=WEATHER_KV \"firmware:latest\" --text"
+WFZ_CMD='python3 "${SCRIPT_DIR}/pack_ota.py" "$FIRMWARE_BIN" "${TMP_DIR}/firmware.wfz"'
+WFZ_PUT_CMD='npx wrangler kv key put --binding=WEATHER_KV "firmware:wfz:${VERSION}" --path="${TMP_DIR}/firmware.wfz"'
+# Per source version N (old image fetched to old.bin, patch written to FROM.patch):
+OLD_BIN_CMD='npx wrangler kv key get --binding=WEATHER_KV "firmware:bin:${FROM}" > "${TMP_DIR}/old.bin"'
+PATCH_CMD='python3 "${SCRIPT_DIR}/make_delta.py" "${TMP_DIR}/old.bin" "$FIRMWARE_BIN" "${TMP_DIR}/${FROM}.patch"'
+PATCH_PUT_CMD='npx wrangler kv key put --binding=WEATHER_KV "firmware:patch:${FROM}:${VERSION}" --path="${TMP_DIR}/${FROM}.patch"'
 
 if [ "$DRY_RUN" -eq 1 ]; then
     echo "[dry-run] resolved version: ${VERSION}"
@@ -83,6 +115,20 @@ if [ "$DRY_RUN" -eq 1 ]; then
         echo "[dry-run] would build: export PATH=\"\$HOME/Library/Python/3.9/bin:\$PATH\" && pio run -e firmware"
     fi
     echo "[dry-run] (cd worker) ${BIN_CMD}"
+    echo "[dry-run] (cd worker) npx wrangler kv key put --binding=WEATHER_KV \"firmware:sha256:${VERSION}\" \"\$(shasum -a 256 firmware.bin)\""
+    echo "[dry-run] python3 pack_ota.py firmware.bin firmware.wfz"
+    echo "[dry-run] (cd worker) npx wrangler kv key put --binding=WEATHER_KV \"firmware:wfz:${VERSION}\" --path=firmware.wfz"
+    if [ "$NO_DELTA" -eq 0 ]; then
+        if [ -z "$DELTA_FROM" ]; then
+            echo "[dry-run] (cd worker) ${LATEST_CMD}   # → patch source version(s)"
+        fi
+        for FROM in ${DELTA_FROM:-N}; do
+            echo "[dry-run] patch from v${FROM}:"
+            echo "[dry-run]   (cd worker) npx wrangler kv key get --binding=WEATHER_KV \"firmware:bin:${FROM}\" > old.bin"
+            echo "[dry-run]   python3 make_delta.py old.bin firmware.bin ${FROM}.patch"
+            echo "[dry-run]   (cd worker) npx wrangler kv key put --binding=WEATHER_KV \"firmware:patch:${FROM}:${VERSION}\" --path=${FROM}.patch"
+        done
+    fi
     echo "[dry-run] (cd worker) ${KV_CMD}"
     exit 0
 fi
@@ -99,10 +145,39 @@ if [ ! -f "$FIRMWARE_BIN" ]; then
     exit 1
 fi
 
+TMP_DIR="$(mktemp -d)"
+trap 'rm -rf "$TMP_DIR"' EXIT
+
+# Pack before uploading anything: a stale firmware:wfz:{version} left beside a
+# new .bin would fail every device's hash check.
+echo "Packing compressed image..."
+eval "$WFZ_CMD"
+
 cd "$WORKER_DIR"
 
-echo "Uploading firmware v${VERSION} to KV (firmware:bin:${VERSION})..."
+echo "Uploading firmware v${VERSION} to KV (firmware:bin:${VERSION}, firmware:wfz:${VERSION})..."
 eval "$BIN_CMD"
+eval "$SHA_CMD"
+eval "$WFZ_PUT_CMD"
+
+# Delta patches. Best effort: a device with no patch for its version just
+# downloads the full image, so a failure here only warns.
+if [ "$NO_DELTA" -eq 0 ]; then
+    if [ -z "$DELTA_FROM" ]; then
+        DELTA_FROM="$(eval "$LATEST_CMD" 2>/dev/null | grep -oE '^[0-9]+$' || true)"
+    fi
+    for FROM in $DELTA_FROM; do
+        if [ "$FROM" -ge "$VERSION" ]; then
+            continue
+        fi
+        echo "Making patch v${FROM} → v${VERSION}..."
+        if eval "$OLD_BIN_CMD" && [ -s "${TMP_DIR}/old.bin" ] && eval "$PATCH_CMD"; then
+            eval "$PATCH_PUT_CMD"
+        else
+            echo "WARNING: no patch from v${FROM} (devices on it take the full image)" >&2
+        fi
+    done
+fi
 
 echo "Pointing firmware:latest at version ${VERSION}..."
 eval "$KV_CMD"
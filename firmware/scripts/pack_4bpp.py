@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Pre-pack a full-screen PNG into the firmware's run-length-coded 4bpp
+framebuffer format, so baked screens (splash, setup, menu) can be expanded on
+device with plain memcpy/memset runs instead of a PNG inflate + per-pixel
+conversion. Used by the bake-*.sh scripts.
+
+Usage:
+    python3 scripts/pack_4bpp.py <input.png> <output.rle>
+
+Quantization matches the device's scanline kernels (src/scanline.h): BT.601
+integer luma, alpha composited over white, level = luma >> 4. Packing matches
+the EPD driver's framebuffer: 2 px/byte, even x in the LOW nibble.
+
+Stream format (decoded by src/rle4.h), a sequence of packets:
+    0x00..0x7F  c   → the next c+1 bytes are literal
+    0x80..0xFF  c   → the next byte repeated (c & 0x7F)+1 times
+The expanded stream is exactly width*height/2 bytes of framebuffer.
+
+Standard library only (zlib + struct); handles the non-interlaced 8-bit
+gray / gray+alpha / RGB / RGBA / palette PNGs the renderer emits.
+"""
+
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+EPD_WIDTH = 960
+EPD_HEIGHT = 540
+
+MAX_PACKET = 128  # both literal and run packets cover 1..128 bytes
+MIN_RUN = 3       # shorter repeats are cheaper left inside a literal packet
+
+
+def read_png(data: bytes):
+    """Returns (width, height, rows) with rows as lists of 8-bit luma."""
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+    pos = 8
+    idat = b""
+    palette = trns = None
+    width = height = depth = ctype = interlace = None
+    while pos < len(data):
+        (length,) = struct.unpack(">I", data[pos:pos + 4])
+        kind = data[pos + 4:pos + 8]
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = body
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    if depth != 8 or interlace != 0:
+        raise ValueError(f"unsupported PNG: bit depth {depth}, interlace {interlace}")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[ctype]
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    bpp = channels
+    prev = bytearray(stride)
+    rows = []
+    i = 0
+    for _ in range(height):
+        ftype = raw[i]
+        line = bytearray(raw[i + 1:i + 1 + stride])
+        i += 1 + stride
+        for x in range(stride):
+            a = line[x - bpp] if x >= bpp else 0
+            b = prev[x]
+            c = prev[x - bpp] if x >= bpp else 0
+            if ftype == 1:
+                line[x] = (line[x] + a) & 0xFF
+            elif ftype == 2:
+                line[x] = (line[x] + b) & 0xFF
+            elif ftype == 3:
+                line[x] = (line[x] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if (pa <= pb and pa <= pc) else (b if pb <= pc else c)
+                line[x] = (line[x] + pred) & 0xFF
+        prev = line
+        rows.append([to_luma(line, x, ctype, palette, trns) for x in range(width)])
+    return width, height, rows
+
+
+def luma(r, g, b):
+    return (77 * r + 150 * g + 29 * b) >> 8
+
+
+def over_white(v, a):
+    return (v * a + 255 * (255 - a)) // 255
+
+
+def to_luma(line, x, ctype, palette, trns):
+    if ctype == 0:
+        return line[x]
+    if ctype == 4:
+        return over_white(line[2 * x], line[2 * x + 1])
+    if ctype == 2:
+        return luma(*line[3 * x:3 * x + 3])
+    if ctype == 6:
+        r, g, b, a = line[4 * x:4 * x + 4]
+        return over_white(luma(r, g, b), a)
+    idx = line[x]  # ctype 3
+    v = luma(*palette[3 * idx:3 * idx + 3])
+    return over_white(v, trns[idx]) if trns and idx < len(trns) else v
+
+
+def to_framebuffer(width, rows) -> bytes:
+    fb = bytearray()
+    for row in rows:
+        for x in range(0, width, 2):
+            fb.append((row[x] >> 4) | (row[x + 1] & 0xF0))
+    return bytes(fb)
+
+
+def pack(fb: bytes) -> bytes:
+    out = bytearray()
+    lit = bytearray()
+
+    def flush_literal():
+        while lit:
+            chunk = lit[:MAX_PACKET]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+            del lit[:MAX_PACKET]
+
+    i = 0
+    while i < len(fb):
+        run = 1
+        while i + run < len(fb) and run < MAX_PACKET and fb[i + run] == fb[i]:
+            run += 1
+        if run >= MIN_RUN:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(fb[i])
+            i += run
+        else:
+            lit.append(fb[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def unpack(stream: bytes) -> bytes:
+    out = bytearray()
+    i = 0
+    while i < len(stream):
+        c = stream[i]
+        if c & 0x80:
+            out.extend(stream[i + 1:i + 2] * ((c & 0x7F) + 1))
+            i += 2
+        else:
+            out.extend(stream[i + 1:i + 2 + c])
+            i += 2 + c
+    return bytes(out)
+
+
+def main() -> None:
+    if len(sys.argv) != 3:
+        print("Usage: pack_4bpp.py <input.png> <output.rle>", file=sys.stderr)
+        sys.exit(1)
+    in_path, out_path = Path(sys.argv[1]), Path(sys.argv[2])
+
+    width, height, rows = read_png(in_path.read_bytes())
+    if (width, height) != (EPD_WIDTH, EPD_HEIGHT):
+        print(f"error: {in_path} is {width}x{height}, expected "
+              f"{EPD_WIDTH}x{EPD_HEIGHT}", file=sys.stderr)
+        sys.exit(1)
+
+    fb = to_framebuffer(width, rows)
+    packed = pack(fb)
+    if unpack(packed) != fb:
+        print("error: RLE round trip mismatch", file=sys.stderr)
+        sys.exit(1)
+
+    out_path.write_bytes(packed)
+    print(f"Packed {in_path.name}: {len(fb)} B framebuffer -> {len(packed)} B RLE")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+Pack a firmware image as a compressed OTA image (.wfz), in the format
+src/ota_image.h describes and the device inflates while it writes the slot.
+Used by ota-publish.sh.
+
+Usage:
+    python3 scripts/pack_ota.py <firmware.bin> <out.wfz>
+    python3 scripts/pack_ota.py --unpack <in.wfz> <out.bin>
+
+The image is cut into 64 KB blocks, each deflated on its own (raw deflate,
+level 9, 32 KB window — what the ESP32-S3 ROM's tinfl inflates) and stored as
+is where deflate doesn't shrink it. Every .wfz is checked before it's written:
+it's unpacked again with the reference reader below (the same checks the
+device makes) and must reproduce the image byte for byte. --unpack runs that
+reader on its own, e.g. on a .wfz fetched back from the worker.
+
+Standard library only (hashlib + struct + zlib).
+"""
+
+import hashlib
+import struct
+import sys
+import zlib
+from pathlib import Path
+
+MAGIC = b"WFZ1"
+HEADER = "<4sIII32s"   # magic, image size, block size, block count, SHA-256
+BLOCK = 64 * 1024      # inflated block size; ota_image.h caps it at MAX_BLOCK
+RAW = 0x80000000       # block prefix flag: stored, not deflated
+
+
+def pack(image):
+    blocks = [image[i:i + BLOCK] for i in range(0, len(image), BLOCK)]
+    out = bytearray(struct.pack(HEADER, MAGIC, len(image), BLOCK, len(blocks),
+                                hashlib.sha256(image).digest()))
+    for block in blocks:
+        z = zlib.compressobj(9, zlib.DEFLATED, -15, 9)
+        packed = z.compress(block) + z.flush()
+        if len(packed) < len(block):
+            out += struct.pack("<I", len(packed)) + packed
+        else:
+            out += struct.pack("<I", len(block) | RAW) + block
+    return bytes(out)
+
+
+def unpack(wfz):
+    """Reference reader — the checks parseHeader() / otaDownloadBlocks() make."""
+    size = struct.calcsize(HEADER)
+    if len(wfz) < size:
+        raise ValueError("truncated header")
+    magic, image_size, block, count, sha = struct.unpack(HEADER, wfz[:size])
+    if (magic != MAGIC or block == 0 or block % 4096 or block > 64 * 1024
+            or image_size == 0 or count != (image_size + block - 1) // block):
+        raise ValueError("bad header")
+    out = bytearray()
+    pos = size
+    for i in range(count):
+        length = block if i + 1 < count else image_size - i * block
+        if pos + 4 > len(wfz):
+            raise ValueError("truncated at block %d" % i)
+        prefix, = struct.unpack("<I", wfz[pos:pos + 4])
+        stored, raw = prefix & ~RAW, bool(prefix & RAW)
+        data = wfz[pos + 4:pos + 4 + stored]
+        if stored == 0 or len(data) != stored:
+            raise ValueError("truncated at block %d" % i)
+        if raw:
+            if stored != length:
+                raise ValueError("stored block %d has the wrong length" % i)
+            out += data
+        else:
+            d = zlib.decompressobj(-15)
+            inflated = d.decompress(data, length + 1)
+            if not d.eof or d.unused_data or len(inflated) != length:
+                raise ValueError("block %d doesn't inflate to %d bytes" % (i, length))
+            out += inflated
+        pos += 4 + stored
+    if pos != len(wfz):
+        raise ValueError("trailing bytes after the last block")
+    if hashlib.sha256(out).digest() != sha:
+        raise ValueError("unpacked image does not match its SHA-256")
+    return bytes(out)
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 3 and args[0] == "--unpack":
+        Path(args[2]).write_bytes(unpack(Path(args[1]).read_bytes()))
+        print("unpacked %s -> %s" % (args[1], args[2]))
+        return
+    if len(args) != 2:
+        print(__doc__.strip().split("\n\n")[1], file=sys.stderr)
+        sys.exit(1)
+
+    image = Path(args[0]).read_bytes()
+    wfz = pack(image)
+    if unpack(wfz) != image:
+        sys.exit("ERROR: %s does not unpack to %s" % (args[1], args[0]))
+    Path(args[1]).write_bytes(wfz)
+    print("%s: %d bytes (%.1f%% of %d)" % (args[1], len(wfz),
+                                            100.0 * len(wfz) / len(image), len(image)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,116 @@
+#!/bin/bash
+# Stand-in HTTPS server for measuring TLS session resumption (see
+# docs/tls-resumption.md).
+#
+# Makes a throwaway ECDSA P-256 certificate, serves worker/renderer/preview.png
+# as /weather/{zip}.png with `openssl s_server -WWW`, checks from this machine
+# that the server resumes TLS 1.2 sessions, and times full against resumed
+# handshakes here with `openssl s_time` — the host-side baseline for the
+# device's numbers. Then it keeps serving until Ctrl-C, so a test build pointed
+# at it can run through its wakes against the same session cache.
+#
+# Usage:
+#   tls-bench.sh [--port N] [--zip ZIP] [--seconds N] [--check-only]
+#
+#   --port        Port to serve on (default 8443).
+#   --zip         Location the frame is served for (default 10001).
+#   --seconds     How long s_time runs each of its two timings (default 5).
+#   --check-only  Check and time, then stop the server instead of serving.
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
+PREVIEW_PNG="${SCRIPT_DIR}/../../worker/renderer/preview.png"
+
+PORT=8443
+ZIP=10001
+SECONDS_EACH=5
+CHECK_ONLY=0
+USAGE="Usage: tls-bench.sh [--port N] [--zip ZIP] [--seconds N] [--check-only]"
+
+while [ $# -gt 0 ]; do
+    case "$1" in
+        --port)
+            PORT="${2:-}"
+            shift 2
+            ;;
+        --zip)
+            ZIP="${2:-}"
+            shift 2
+            ;;
+        --seconds)
+            SECONDS_EACH="${2:-}"
+            shift 2
+            ;;
+        --check-only)
+            CHECK_ONLY=1
+            shift
+            ;;
+        *)
+            echo "ERROR: unknown argument: $1" >&2
+            echo "$USAGE" >&2
+            exit 1
+            ;;
+    esac
+done
+
+if [ ! -f "$PREVIEW_PNG" ]; then
+    echo "ERROR: preview PNG not found at $PREVIEW_PNG" >&2
+    echo "Run 'npm run preview' in worker/renderer first." >&2
+    exit 1
+fi
+
+WORK_DIR="$(mktemp -d)"
+SERVER_PID=""
+cleanup() {
+    if [ -n "$SERVER_PID" ]; then
+        kill "$SERVER_PID" 2>/dev/null || true
+    fi
+    rm -rf "$WORK_DIR"
+}
+trap cleanup EXIT
+
+cd "$WORK_DIR"
+openssl req -x509 -newkey ec -pkeyopt ec_paramgen_curve:prime256v1 -nodes \
+    -keyout key.pem -out cert.pem -days 30 -subj /CN=weather-tls-bench 2>/dev/null
+# -WWW serves files relative to its working directory.
+mkdir weather
+cp "$PREVIEW_PNG" "weather/${ZIP}.png"
+
+openssl s_server -accept "$PORT" -cert cert.pem -key key.pem -WWW -quiet &
+SERVER_PID=$!
+for _ in $(seq 50); do
+    if openssl s_client -connect "127.0.0.1:${PORT}" -tls1_2 </dev/null >/dev/null 2>&1; then
+        break
+    fi
+    sleep 0.1
+done
+
+# The device's mbedTLS client speaks TLS 1.2; so do these.
+FIRST="$(openssl s_client -connect "127.0.0.1:${PORT}" -tls1_2 -sess_out sess.pem </dev/null 2>/dev/null \
+    | grep -E '^(New|Reused)' || true)"
+SECOND="$(openssl s_client -connect "127.0.0.1:${PORT}" -tls1_2 -sess_in sess.pem </dev/null 2>/dev/null \
+    | grep -E '^(New|Reused)' || true)"
+echo "First connect:  ${FIRST:-no handshake}"
+echo "Second connect: ${SECOND:-no handshake}"
+case "$SECOND" in
+    Reused*) ;;
+    *)
+        echo "ERROR: the server did not resume the session" >&2
+        exit 1
+        ;;
+esac
+
+echo "Host handshakes over ${SECONDS_EACH} s each (full, then resumed):"
+openssl s_time -connect "127.0.0.1:${PORT}" -tls1_2 -new -time "$SECONDS_EACH" 2>/dev/null \
+    | grep -E 'connections in [0-9.]+s;' || true
+openssl s_time -connect "127.0.0.1:${PORT}" -tls1_2 -reuse -time "$SECONDS_EACH" 2>/dev/null \
+    | grep -E 'connections in [0-9.]+s;' || true
+
+if [ "$CHECK_ONLY" -eq 1 ]; then
+    exit 0
+fi
+
+echo "Serving https://<this machine>:${PORT}/weather/${ZIP}.png — Ctrl-C to stop."
+echo "Keep it running for the whole measurement: restarting it drops every cached session."
+wait "$SERVER_PID"
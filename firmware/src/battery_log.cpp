@@ -0,0 +1,183 @@
+#include "battery_log.h"
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <Preferences.h>
+#include <time.h>
+
+#include "config.h"
+#include "tls_session.h"
+
+#define BATTLOG_BLOCK_BYTES  240   // stream bytes per block: ~110 samples
+#define BATTLOG_NVS_SLOTS    24    // blocks kept in NVS (~6 KB)
+#define BATTLOG_RECORD_MAX   (7 + 6 + 16 + 6 + 16)  // bits, both escapes taken
+
+struct LogBlock {
+    uint32_t epoch;
+    uint16_t mv0;
+    uint16_t nbits;
+    uint8_t  version;
+    uint8_t  count;
+    uint8_t  reserved[2];
+    uint8_t  bits[BATTLOG_BLOCK_BYTES];
+};
+static_assert(sizeof(LogBlock) == 12 + BATTLOG_BLOCK_BYTES, "LogBlock must be unpadded");
+
+static const char *NS = "battlog";
+
+// ─── RTC memory — survives deep sleep ────────────────────────────────────────
+RTC_DATA_ATTR static LogBlock bl_cur;                      // count 0 = empty
+RTC_DATA_ATTR static int16_t  bl_prev_mv         = 0;
+RTC_DATA_ATTR static uint32_t bl_prev_time       = 0;
+RTC_DATA_ATTR static int8_t   bl_nvs_count       = -1;      // blocks in NVS; -1 = not read yet
+RTC_DATA_ATTR static uint32_t bl_next_upload_boot = BATTLOG_UPLOAD_WAKES;
+
+static size_t blockSize(const LogBlock &b) {
+    return 12 + (b.nbits + 7) / 8;
+}
+
+static void putBits(LogBlock &b, uint32_t value, int n) {
+    for (int i = 0; i < n; i++, b.nbits++) {
+        if (value & (1u << i)) b.bits[b.nbits / 8] |=  (uint8_t)(1u << (b.nbits % 8));
+        else                   b.bits[b.nbits / 8] &= (uint8_t)~(1u << (b.nbits % 8));
+    }
+}
+
+// Moves the full RTC block to the next NVS slot (overwriting the oldest).
+static void flushBlock() {
+    Preferences prefs;
+    if (!prefs.begin(NS, /*readOnly=*/false)) {
+        Serial.println("Battery log: NVS open failed — block dropped");
+        bl_cur.count = 0;
+        return;
+    }
+    uint32_t head  = prefs.getUInt("head", 0) % BATTLOG_NVS_SLOTS;
+    uint32_t count = prefs.getUInt("count", 0);
+    char key[8];
+    snprintf(key, sizeof(key), "b%u", (unsigned)head);
+    prefs.putBytes(key, &bl_cur, blockSize(bl_cur));
+    prefs.putUInt("head", (head + 1) % BATTLOG_NVS_SLOTS);
+    if (count < BATTLOG_NVS_SLOTS) count++;
+    prefs.putUInt("count", count);
+    prefs.end();
+    bl_nvs_count = (int8_t)count;
+    Serial.printf("Battery log: block of %u samples flushed to NVS (%u stored)\n",
+                  bl_cur.count, (unsigned)count);
+    bl_cur.count = 0;
+}
+
+void battLogAppend(int mv, int8_t rssi, uint8_t flags) {
+    if (bl_cur.count == 255 || bl_cur.nbits + BATTLOG_RECORD_MAX > BATTLOG_BLOCK_BYTES * 8) {
+        flushBlock();
+    }
+    uint32_t now = (uint32_t)time(nullptr);
+    if (bl_cur.count == 0) {
+        memset(&bl_cur, 0, sizeof(bl_cur));
+        bl_cur.version = 1;
+        bl_cur.epoch   = now;
+        bl_cur.mv0     = (uint16_t)mv;
+        bl_prev_mv     = (int16_t)mv;
+        bl_prev_time   = now;
+    }
+
+    uint32_t rssiCode = 31;
+    if (flags & BL_WIFI) {
+        int r = (-rssi - 30) / 2;
+        rssiCode = r < 0 ? 0 : (r > 30 ? 30 : r);
+    }
+    putBits(bl_cur, flags & (BL_EPD | BL_WIFI), 2);
+    putBits(bl_cur, rssiCode, 5);
+
+    uint32_t dtMin = now > bl_prev_time ? (now - bl_prev_time + 30) / 60 : 0;
+    if (dtMin < 63) {
+        putBits(bl_cur, dtMin, 6);
+    } else {
+        putBits(bl_cur, 63, 6);
+        putBits(bl_cur, dtMin > 0xFFFF ? 0xFFFF : dtMin, 16);
+    }
+
+    int32_t d = mv - bl_prev_mv;
+    uint32_t zz = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+    if (zz < 63) {
+        putBits(bl_cur, zz, 6);
+    } else {
+        putBits(bl_cur, 63, 6);
+        putBits(bl_cur, (uint32_t)mv & 0xFFFF, 16);
+    }
+
+    bl_cur.count++;
+    bl_prev_mv   = (int16_t)mv;
+    bl_prev_time = now;
+}
+
+bool battLogUploadDue(uint32_t bootCount) {
+    if (bootCount < bl_next_upload_boot) return false;
+    if (bl_nvs_count < 0) {
+        Preferences prefs;
+        bl_nvs_count = prefs.begin(NS, /*readOnly=*/true)
+                     ? (int8_t)prefs.getUInt("count", 0) : 0;
+        prefs.end();
+    }
+    return bl_nvs_count > 0 || bl_cur.count > 0;
+}
+
+bool battLogUpload(uint32_t bootCount, const char *deviceId) {
+    // Oldest NVS blocks first, then the partial one in RTC.
+    size_t cap = (size_t)(bl_nvs_count > 0 ? bl_nvs_count : 0) * sizeof(LogBlock)
+               + sizeof(LogBlock);
+    uint8_t *body = (uint8_t *)malloc(cap);
+    if (!body) {
+        Serial.println("Battery log: upload buffer alloc failed");
+        bl_next_upload_boot = bootCount + BATTLOG_RETRY_WAKES;
+        return false;
+    }
+    size_t len = 0;
+    int blocks = 0;
+    if (bl_nvs_count > 0) {
+        Preferences prefs;
+        if (prefs.begin(NS, /*readOnly=*/true)) {
+            uint32_t head = prefs.getUInt("head", 0);
+            for (int i = 0; i < bl_nvs_count; i++) {
+                char key[8];
+                snprintf(key, sizeof(key), "b%u",
+                         (unsigned)((head + BATTLOG_NVS_SLOTS - bl_nvs_count + i) % BATTLOG_NVS_SLOTS));
+                size_t n = prefs.getBytes(key, body + len, sizeof(LogBlock));
+                if (n >= 12) { len += n; blocks++; }
+            }
+            prefs.end();
+        }
+    }
+    if (bl_cur.count > 0) {
+        memcpy(body + len, &bl_cur, blockSize(bl_cur));
+        len += blockSize(bl_cur);
+        blocks++;
+    }
+
+    ResumableTlsClient client;
+    HTTPClient http;
+    http.begin(client, String(SERVER_BASE_URL) + "/telemetry/battery");
+    http.setTimeout(10000);
+    http.addHeader("Content-Type", "application/octet-stream");
+    http.addHeader("X-Device-Id", deviceId);
+    int code = http.POST(body, len);
+    http.end();
+    free(body);
+
+    if (code < 200 || code >= 300) {
+        Serial.printf("Battery log: upload of %d block(s) failed (%d)\n", blocks, code);
+        bl_next_upload_boot = bootCount + BATTLOG_RETRY_WAKES;
+        return false;
+    }
+    Serial.printf("Battery log: uploaded %d block(s), %u bytes\n", blocks, (unsigned)len);
+    if (bl_nvs_count > 0) {
+        Preferences prefs;
+        if (prefs.begin(NS, /*readOnly=*/false)) {
+            prefs.putUInt("count", 0);
+            prefs.end();
+        }
+        bl_nvs_count = 0;
+    }
+    bl_cur.count = 0;
+    bl_next_upload_boot = bootCount + BATTLOG_UPLOAD_WAKES;
+    return true;
+}
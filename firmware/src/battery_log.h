@@ -0,0 +1,42 @@
+// Battery discharge log: the voltage curve, for calibrating the BAT threshold
+// (and the energy model) against this cell.
+//
+// Every fresh battery reading is appended — with the WiFi RSSI and whether the
+// radio was up / the panel had been refreshed (both sag the rail) — to a
+// bit-packed, delta-encoded block in RTC memory: ~17 bits a sample. A full block
+// is flushed to an NVS ring (one small write every few days), and every
+// BATTLOG_UPLOAD_WAKES the whole backlog goes to the worker in one POST. The NVS
+// ring holds a couple of months of samples if uploads keep failing.
+//
+// Block layout (little-endian), as uploaded:
+//   u32 epoch   time() of the first sample (unsynced clock = small value)
+//   u16 mv0     first sample, mV
+//   u16 nbits   bits used in the stream
+//   u8  version (1), u8 count, u8 reserved[2]
+//   stream of `count` records, LSB-first:
+//     epd:1 wifi:1 rssi:5 (-30-2n dBm; 31 = no WiFi)
+//     dt:6  minutes since the previous sample (63 = escape, then 16 bits)
+//     dmv:6 zigzag mV delta from the previous sample (63 = escape, then 16-bit mV)
+// The first record's dt and dmv are 0. worker/src/index.js decodes the same.
+
+#pragma once
+
+#include <stdint.h>
+
+#define BATTLOG_UPLOAD_WAKES  72   // ≈12 h at the 10-min cadence
+#define BATTLOG_RETRY_WAKES   6    // after a failed upload
+
+enum : uint8_t {
+    BL_EPD  = 1 << 0,  // the panel was refreshed earlier this wake
+    BL_WIFI = 1 << 1,  // the radio was up during the reading
+};
+
+// Appends a sample (rssi = 0 when WiFi is down).
+void battLogAppend(int mv, int8_t rssi, uint8_t flags);
+
+// True when an upload is due on this wake and there's something to send.
+bool battLogUploadDue(uint32_t bootCount);
+
+// POSTs every pending block to the worker and, once it has them, drops them.
+// Call with WiFi up. On failure they stay, and the next try is a few wakes out.
+bool battLogUpload(uint32_t bootCount, const char *deviceId);
@@ -0,0 +1,157 @@
+#include "button_input.h"
+
+#include <Arduino.h>
+#include <driver/gpio.h>
+#include <esp_pm.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+
+#include "config.h"
+
+#define BUTTON_QUEUE_LEN    16
+
+struct RawEdge {
+    bool     pressed;  // level after the edge
+    uint32_t atMs;
+};
+
+static QueueHandle_t        edgeQueue = nullptr;
+static esp_pm_lock_handle_t awakeLock = nullptr;  // CPU at max; held except inside buttonWait
+static bool     active       = false;
+static bool     pmEnabled    = false;
+static bool     down         = false;  // debounced state
+static bool     longDone     = false;  // this press has had its LONG (or predates us)
+static uint32_t pressAtMs    = 0;
+
+static uint32_t nowMs() {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Level-triggered on the opposite of the current level, re-armed on each edge:
+// a level interrupt is what wakes the chip from light sleep, and flipping it
+// here makes it behave like an edge interrupt.
+static void onButtonEdge(void *) {
+    bool pressed = gpio_get_level(BUTTON_GPIO) == 0;
+    gpio_wakeup_enable(BUTTON_GPIO, pressed ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    RawEdge e = { pressed, nowMs() };
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(edgeQueue, &e, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Automatic light sleep, only while buttonWait() blocks. Everything else (EPD
+// refresh, rendering, WiFi) runs with the CPU_FREQ_MAX lock held: full clock
+// speed, no light sleep. Released, the chip drops to min_freq_mhz and sleeps.
+static void pmStart() {
+    esp_pm_config_esp32s3_t pm = {};
+    pm.max_freq_mhz       = 240;
+    pm.min_freq_mhz       = 40;
+    pm.light_sleep_enable = true;
+    if (!awakeLock && esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ui", &awakeLock) != ESP_OK) {
+        awakeLock = nullptr;
+    }
+    // Lock first, so nothing runs slowed down between the two calls.
+    if (awakeLock) esp_pm_lock_acquire(awakeLock);
+    pmEnabled = awakeLock && esp_pm_configure(&pm) == ESP_OK;
+    if (!pmEnabled && awakeLock) esp_pm_lock_release(awakeLock);
+    Serial.printf("Button: interrupt input, light sleep %s\n",
+                  pmEnabled ? "on" : "unavailable (idle waits only)");
+}
+
+static void pmStop() {
+    esp_pm_config_esp32s3_t pm = {};
+    pm.max_freq_mhz       = 240;
+    pm.min_freq_mhz       = 240;
+    pm.light_sleep_enable = false;
+    esp_pm_configure(&pm);
+    esp_pm_lock_release(awakeLock);
+    pmEnabled = false;
+}
+
+void buttonBegin(bool lightSleep) {
+    if (active) {
+        if (lightSleep && !pmEnabled) pmStart();
+        else if (!lightSleep && pmEnabled) pmStop();
+        return;
+    }
+    pinMode(BUTTON_GPIO, INPUT_PULLUP);
+    if (!edgeQueue) edgeQueue = xQueueCreate(BUTTON_QUEUE_LEN, sizeof(RawEdge));
+    xQueueReset(edgeQueue);
+
+    down      = gpio_get_level(BUTTON_GPIO) == 0;
+    longDone  = down;  // a hold carried in from before isn't a new press
+    pressAtMs = nowMs();
+
+    gpio_install_isr_service(0);  // already installed by the core: harmless error
+    gpio_isr_handler_add(BUTTON_GPIO, onButtonEdge, nullptr);
+    gpio_wakeup_enable(BUTTON_GPIO, down ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+    gpio_intr_enable(BUTTON_GPIO);
+    esp_sleep_enable_gpio_wakeup();
+    active = true;
+
+    if (lightSleep) pmStart();
+    else Serial.println("Button: interrupt input, no light sleep");
+}
+
+void buttonEnd() {
+    if (!active) return;
+    gpio_isr_handler_remove(BUTTON_GPIO);
+    gpio_wakeup_disable(BUTTON_GPIO);
+    gpio_set_intr_type(BUTTON_GPIO, GPIO_INTR_DISABLE);
+    if (pmEnabled) pmStop();
+    active = false;
+}
+
+// Blocks on the edge queue until `untilMs` (light sleep allowed meanwhile).
+static bool waitEdge(RawEdge &e, uint32_t untilMs) {
+    int32_t left = (int32_t)(untilMs - nowMs());
+    if (left < 0) left = 0;
+    if (pmEnabled) esp_pm_lock_release(awakeLock);
+    bool got = xQueueReceive(edgeQueue, &e, pdMS_TO_TICKS(left)) == pdTRUE;
+    if (pmEnabled) esp_pm_lock_acquire(awakeLock);
+    return got;
+}
+
+bool buttonWait(ButtonEvent &ev, uint32_t timeoutMs) {
+    if (!active) buttonBegin();
+    uint32_t endMs = nowMs() + timeoutMs;
+    for (;;) {
+        // While held, the LONG deadline comes first if it's sooner.
+        uint32_t untilMs = endMs;
+        bool longPending = down && !longDone;
+        if (longPending && (int32_t)(pressAtMs + BUTTON_HOLD_MS - endMs) < 0) {
+            untilMs = pressAtMs + BUTTON_HOLD_MS;
+        }
+
+        RawEdge e;
+        if (!waitEdge(e, untilMs)) {
+            if (longPending && (int32_t)(nowMs() - (pressAtMs + BUTTON_HOLD_MS)) >= 0) {
+                longDone = true;
+                ev = { BE_LONG, pressAtMs + BUTTON_HOLD_MS };
+                return true;
+            }
+            if ((int32_t)(nowMs() - endMs) >= 0) return false;
+            continue;
+        }
+
+        // Debounce: let the contact settle, drop the bounce edges, and go by
+        // the level it settled at.
+        vTaskDelay(pdMS_TO_TICKS(BUTTON_DEBOUNCE_MS));
+        RawEdge bounce;
+        while (xQueueReceive(edgeQueue, &bounce, 0) == pdTRUE) {}
+        bool pressed = gpio_get_level(BUTTON_GPIO) == 0;
+        if (pressed == down) continue;  // a glitch that came back
+
+        down = pressed;
+        if (pressed) {
+            pressAtMs = e.atMs;
+            longDone  = false;
+            ev = { BE_PRESS, e.atMs };
+        } else {
+            ev = { BE_RELEASE, e.atMs };
+        }
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+// Button input for the awake screens: an interrupt-fed event queue.
+//
+// A GPIO interrupt timestamps every edge of BUTTON_GPIO into a FreeRTOS queue;
+// buttonWait() blocks on that queue — with the chip in automatic light sleep
+// between events, where the build supports it — debounces, and turns edges
+// into PRESS / RELEASE, plus LONG the moment a hold crosses BUTTON_HOLD_MS (a
+// queue timeout, not a poll). Nothing spins while a screen waits for input.
+//
+// A button already held when input starts (the long press that opened the menu)
+// is treated as already used: its release arrives as a RELEASE with no PRESS
+// before it, and it never produces a LONG.
+
+#pragma once
+
+#include <stdint.h>
+
+enum ButtonEventKind : uint8_t {
+    BE_PRESS,    // down (debounced)
+    BE_LONG,     // still down BUTTON_HOLD_MS after the press
+    BE_RELEASE,  // up (debounced)
+};
+
+struct ButtonEvent {
+    ButtonEventKind kind;
+    uint32_t        atMs;  // when it happened (millis() timebase)
+};
+
+// Starts interrupt-driven input. With `lightSleep`, buttonWait()'s waits drop
+// into automatic light sleep if the build has power management; outside them
+// the CPU runs at full speed. Called again while started, it only switches
+// light sleep on or off.
+void buttonBegin(bool lightSleep = true);
+
+// Stops it and restores the default power configuration (idempotent).
+void buttonEnd();
+
+// Waits up to timeoutMs for the next event. False on timeout.
+bool buttonWait(ButtonEvent &ev, uint32_t timeoutMs);
@@ -25,10 +25,13 @@ inline constexpr int FIRMWARE_VERSION = 9;
 
 // User button (IO21): wakes the chip from deep sleep via ext0; a long-press
 // (≥ BUTTON_HOLD_MS) enters the menu / setup while a brief tap is ignored.
-// Shared by the wake path (main.cpp) and setup mode (setup_mode.cpp polls it to
-// offer long-press → menu while the captive-portal AP is up).
-#define BUTTON_GPIO     GPIO_NUM_21
-#define BUTTON_HOLD_MS  1500
+// Shared by the wake path (main.cpp, wake_stub.cpp) and setup mode
+// (setup_mode.cpp polls it to offer long-press → menu while the captive-portal
+// AP is up). Contact bounce settles well inside BUTTON_DEBOUNCE_MS: edges within
+// it are one transition, and a release must last that long to end a press.
+#define BUTTON_GPIO         GPIO_NUM_21
+#define BUTTON_HOLD_MS      1500
+#define BUTTON_DEBOUNCE_MS  30
 
 struct DeviceConfig {
     String ssid;
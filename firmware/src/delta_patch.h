@@ -0,0 +1,159 @@
+// Binary delta patches for OTA: rebuild the next firmware image from the
+// running one plus a small patch, instead of downloading all ~1.2 MB.
+//
+// Patches are made at publish time by scripts/make_delta.py. A release changes
+// a few functions, but the linker shifts everything after them, so most of the
+// new image is either identical to the old one or the old bytes with a handful
+// changed (relocated addresses). Three ops cover that: COPY an old run, ADD a
+// sparse difference to an old run, INSERT new bytes.
+//
+// Patch layout (little-endian):
+//   "WDP1"        magic
+//   u32           source size, u32 target size
+//   u8[32]        SHA-256 of the source image, u8[32] SHA-256 of the target
+//   ops, each a tag byte then LEB128 varints; `d` is a zigzag offset from the
+//   source cursor, which every COPY/ADD leaves just past the run it read:
+//     0x00 END
+//     0x01 COPY   d n          n source bytes
+//     0x02 ADD    d n {s k …}  n source bytes; after each s unchanged bytes the
+//                              next k bytes of the patch are added (mod 256) to
+//                              the following k — pairs repeat until n is covered
+//     0x03 INSERT n …          n literal bytes from the patch
+//
+// The applier pulls the patch, reads the source at random and writes the target
+// strictly in order, through callbacks — so on the device it streams from the
+// HTTP response, reads the running slot and writes the inactive one, with about
+// 1 KB of stack. Hashing and the size/SHA checks are the caller's: this only
+// rebuilds the bytes.
+//
+// Header-only and free of Arduino/ESP dependencies, so it also builds on a host.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace delta {
+
+enum : uint8_t { OP_END = 0x00, OP_COPY = 0x01, OP_ADD = 0x02, OP_INSERT = 0x03 };
+
+static const uint32_t HEADER_SIZE = 76;
+static const uint32_t CHUNK       = 512;
+
+struct Header {
+    uint32_t sourceSize;
+    uint32_t targetSize;
+    uint8_t  sourceSha[32];
+    uint8_t  targetSha[32];
+};
+
+struct Io {
+    void *ctx;
+    // Reads exactly n patch bytes; false on a short read.
+    bool (*readPatch)(void *ctx, uint8_t *buf, uint32_t n);
+    // Reads n source bytes at `off` (always within the header's source size).
+    bool (*readSource)(void *ctx, uint32_t off, uint8_t *buf, uint32_t n);
+    // Appends n target bytes.
+    bool (*writeTarget)(void *ctx, const uint8_t *buf, uint32_t n);
+};
+
+static inline uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Reads and checks the magic; fills `h`.
+static inline bool readHeader(const Io &io, Header &h) {
+    uint8_t raw[HEADER_SIZE];
+    if (!io.readPatch(io.ctx, raw, HEADER_SIZE)) return false;
+    if (memcmp(raw, "WDP1", 4) != 0) return false;
+    h.sourceSize = le32(raw + 4);
+    h.targetSize = le32(raw + 8);
+    memcpy(h.sourceSha, raw + 12, 32);
+    memcpy(h.targetSha, raw + 44, 32);
+    return true;
+}
+
+static inline bool readVarint(const Io &io, uint32_t &v) {
+    v = 0;
+    for (int shift = 0; shift < 35; shift += 7) {
+        uint8_t b;
+        if (!io.readPatch(io.ctx, &b, 1)) return false;
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80)) return true;
+    }
+    return false;  // longer than any 32-bit value
+}
+
+static inline bool copySource(const Io &io, uint32_t off, uint32_t n, uint8_t *buf) {
+    while (n) {
+        uint32_t k = n < CHUNK ? n : CHUNK;
+        if (!io.readSource(io.ctx, off, buf, k) || !io.writeTarget(io.ctx, buf, k)) return false;
+        off += k;
+        n   -= k;
+    }
+    return true;
+}
+
+static inline bool addSource(const Io &io, uint32_t off, uint32_t n, uint8_t *buf, uint8_t *diff) {
+    while (n) {
+        uint32_t k = n < CHUNK ? n : CHUNK;
+        if (!io.readSource(io.ctx, off, buf, k) || !io.readPatch(io.ctx, diff, k)) return false;
+        for (uint32_t i = 0; i < k; i++) buf[i] = (uint8_t)(buf[i] + diff[i]);
+        if (!io.writeTarget(io.ctx, buf, k)) return false;
+        off += k;
+        n   -= k;
+    }
+    return true;
+}
+
+// Applies the ops that follow the header. True only if the stream ends with
+// END after exactly targetSize bytes, every op in bounds; on false the target
+// is partially written and must be discarded.
+static inline bool apply(const Io &io, const Header &h) {
+    uint8_t  buf[CHUNK], diff[CHUNK];
+    uint32_t cursor = 0, out = 0;
+    for (;;) {
+        uint8_t op;
+        if (!io.readPatch(io.ctx, &op, 1)) return false;
+        if (op == OP_END) return out == h.targetSize;
+
+        uint32_t d = 0, n;
+        if (op == OP_COPY || op == OP_ADD) {
+            if (!readVarint(io, d)) return false;
+        } else if (op != OP_INSERT) {
+            return false;
+        }
+        if (!readVarint(io, n) || n > h.targetSize - out) return false;
+
+        if (op == OP_INSERT) {
+            for (uint32_t left = n; left; ) {
+                uint32_t k = left < CHUNK ? left : CHUNK;
+                if (!io.readPatch(io.ctx, buf, k) || !io.writeTarget(io.ctx, buf, k)) return false;
+                left -= k;
+            }
+            out += n;
+            continue;
+        }
+
+        int64_t start = (int64_t)cursor + ((d & 1) ? -(int64_t)(d >> 1) - 1 : (int64_t)(d >> 1));
+        if (start < 0 || start + n > h.sourceSize) return false;
+        cursor = (uint32_t)start + n;
+
+        if (op == OP_COPY) {
+            if (!copySource(io, (uint32_t)start, n, buf)) return false;
+        } else {
+            uint32_t pos = (uint32_t)start, left = n;
+            while (left) {
+                uint32_t s, k;
+                if (!readVarint(io, s) || !readVarint(io, k)) return false;
+                if (s > left || k > left - s || s + k == 0) return false;
+                if (!copySource(io, pos, s, buf) || !addSource(io, pos + s, k, buf, diff)) return false;
+                pos  += s + k;
+                left -= s + k;
+            }
+        }
+        out += n;
+    }
+}
+
+}  // namespace delta
@@ -0,0 +1,156 @@
+#include "energy.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+#include <time.h>
+
+#include "wake_trace.h"
+
+// A reading this far above the last one can only be a recharge (the pack never
+// rises by itself; ADC noise after averaging is ~10–20 mV).
+#define ENERGY_RECHARGE_MV     150
+// The voltage trend is only trusted once the pack has measurably dropped over a
+// measurable amount of charge.
+#define ENERGY_TREND_MIN_MV    40
+#define ENERGY_TREND_MIN_UAH   20000
+// Averages move 1/ENERGY_AVG_WEIGHT of the way to each new cycle.
+#define ENERGY_AVG_WEIGHT      8
+
+// Loaded (WiFi on) pack voltage → charge left, in ‰ of capacity. Coarse, from a
+// generic single-cell LiPo curve; only used to place the baseline after a
+// recharge or reset, after which charge is counted.
+static const struct { int16_t mv; int16_t permille; } CURVE[] = {
+    {4150, 1000}, {4000, 850}, {3900, 700}, {3800, 520}, {3750, 400},
+    {3700, 280},  {3600, 120}, {3500, 50},  {3400, 0},
+};
+
+// ─── RTC memory — survives deep sleep ────────────────────────────────────────
+RTC_DATA_ATTR static uint64_t en_used_uas    = 0;  // since the baseline, µA·s
+RTC_DATA_ATTR static int16_t  en_base_mv     = 0;  // baseline voltage (0 = none)
+RTC_DATA_ATTR static int16_t  en_last_mv     = 0;
+RTC_DATA_ATTR static uint32_t en_wake_uas    = 0;  // last wake's awake charge
+RTC_DATA_ATTR static uint32_t en_sleep_s     = 0;  // sleep booked at entry
+RTC_DATA_ATTR static uint32_t en_awake_s     = 0;
+RTC_DATA_ATTR static time_t   en_sleep_at    = 0;  // wall clock at sleep entry (0 = unknown)
+RTC_DATA_ATTR static uint32_t en_avg_uah_x16 = 0;  // per-cycle average, µAh × 16
+RTC_DATA_ATTR static uint32_t en_avg_cycle_s = 0;
+
+static unsigned long radioOnAt = 0;
+static uint32_t      radioMs   = 0;
+
+static bool clockValid(time_t t) {
+    return t > 1700000000;  // set from Date/NTP at some point
+}
+
+void energyBegin() {
+    if (en_wake_uas == 0) return;  // no committed wake before this one
+
+    // The sleep was booked at its planned length; settle the difference when
+    // the wall clock can say how long it really was (a button wake cuts it
+    // short, an untimed sleep booked nothing).
+    uint32_t slept = en_sleep_s;
+    time_t now = time(nullptr);
+    if (clockValid(en_sleep_at) && clockValid(now) && now >= en_sleep_at) {
+        slept = (uint32_t)(now - en_sleep_at);
+        en_used_uas += (int64_t)slept * ENERGY_SLEEP_UA - (int64_t)en_sleep_s * ENERGY_SLEEP_UA;
+    }
+
+    uint32_t cycleUah = (en_wake_uas + (uint64_t)slept * ENERGY_SLEEP_UA) / 3600;
+    uint32_t cycleS   = en_awake_s + slept;
+    if (en_avg_cycle_s == 0) {
+        en_avg_uah_x16 = cycleUah * 16;
+        en_avg_cycle_s = cycleS;
+    } else {
+        en_avg_uah_x16 += ((int32_t)(cycleUah * 16) - (int32_t)en_avg_uah_x16) / ENERGY_AVG_WEIGHT;
+        en_avg_cycle_s += ((int32_t)cycleS - (int32_t)en_avg_cycle_s) / ENERGY_AVG_WEIGHT;
+    }
+    Serial.printf("Energy: last cycle %u µAh over %u s (avg %u µAh / %u s)\n",
+                  (unsigned)cycleUah, (unsigned)cycleS,
+                  (unsigned)(en_avg_uah_x16 / 16), (unsigned)en_avg_cycle_s);
+}
+
+void energyRadio(bool on) {
+    if (on && !radioOnAt) {
+        radioOnAt = millis();
+        if (!radioOnAt) radioOnAt = 1;
+    } else if (!on && radioOnAt) {
+        radioMs += millis() - radioOnAt;
+        radioOnAt = 0;
+    }
+}
+
+void energyNoteVoltage(int mv) {
+    if (en_base_mv == 0 || mv >= en_last_mv + ENERGY_RECHARGE_MV) {
+        if (en_base_mv) Serial.printf("Energy: recharge (%d → %d mV), new baseline\n",
+                                      en_last_mv, mv);
+        en_base_mv  = mv;
+        en_used_uas = 0;
+    }
+    en_last_mv = mv;
+}
+
+void energyCommit(uint32_t sleepS) {
+    energyRadio(false);
+    // Not the trace's TP_AWAKE: that's 16-bit and tops out at 65.5 s, which a
+    // setup-mode or menu wake easily outlasts.
+    uint32_t awakeMs = (uint32_t)(esp_timer_get_time() / 1000);
+    en_wake_uas = awakeMs * ENERGY_CPU_MA
+                + radioMs * ENERGY_RADIO_MA
+                + tracePhaseMs(TP_EPD) * ENERGY_EPD_MA;  // mA·ms = µA·s
+    en_awake_s  = (awakeMs + 500) / 1000;
+    en_sleep_s  = sleepS;
+    time_t now  = time(nullptr);
+    en_sleep_at = clockValid(now) ? now : 0;
+    en_used_uas += en_wake_uas + (uint64_t)sleepS * ENERGY_SLEEP_UA;
+    Serial.printf("Energy: this wake %u µAh (radio %u ms, epd %u ms); %u mAh used since %d mV\n",
+                  (unsigned)(en_wake_uas / 3600), (unsigned)radioMs,
+                  (unsigned)tracePhaseMs(TP_EPD),
+                  (unsigned)(en_used_uas / 3600000), en_base_mv);
+}
+
+// Charge left at `mv` per the curve, in mAh.
+static int32_t curveMah(int mv) {
+    const int n = sizeof(CURVE) / sizeof(CURVE[0]);
+    if (mv >= CURVE[0].mv) return ENERGY_CAPACITY_MAH;
+    for (int i = 1; i < n; i++) {
+        if (mv >= CURVE[i].mv) {
+            int32_t pm = CURVE[i].permille + (int32_t)(mv - CURVE[i].mv)
+                       * (CURVE[i - 1].permille - CURVE[i].permille)
+                       / (CURVE[i - 1].mv - CURVE[i].mv);
+            return pm * ENERGY_CAPACITY_MAH / 1000;
+        }
+    }
+    return 0;
+}
+
+bool energyEstimate(int floorMv, EnergyEstimate &e) {
+    if (en_avg_cycle_s == 0) return false;
+    e.uahPerWake   = en_avg_uah_x16 / 16;
+    e.cycleS       = en_avg_cycle_s;
+    e.remainingMah = -1;
+    e.hoursLeft    = -1;
+    e.fromTrend    = false;
+    if (en_base_mv == 0) return true;
+
+    // Counted: the curve places the baseline, the count says what's gone since.
+    int32_t usedMah = (int32_t)(en_used_uas / 3600000);
+    int32_t left = curveMah(en_base_mv) - curveMah(floorMv) - usedMah;
+
+    // Trend: mV lost per mAh so far, extrapolated down to the floor. On the
+    // curve's flat middle this overshoots, so it only ever lowers the estimate.
+    int32_t dropMv = en_base_mv - en_last_mv;
+    if (dropMv >= ENERGY_TREND_MIN_MV && en_used_uas / 3600 >= ENERGY_TREND_MIN_UAH) {
+        int32_t trend = (int32_t)((int64_t)(en_last_mv - floorMv) * (int64_t)(en_used_uas / 3600)
+                                  / dropMv / 1000);
+        if (trend < left) {
+            left = trend;
+            e.fromTrend = true;
+        }
+    }
+    e.remainingMah = left > 0 ? left : 0;
+    if (e.uahPerWake > 0) {
+        e.hoursLeft = (int32_t)((int64_t)e.remainingMah * 1000 * e.cycleS
+                                / e.uahPerWake / 3600);
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+// Battery energy model: charge per wake and remaining runtime.
+//
+// The BAT code only knows the pack voltage, and a LiPo's voltage barely moves
+// over most of its charge. This model counts charge instead: each wake's
+// measured phase times (CPU awake, radio on, EPD powered — from the wake trace)
+// and the deep sleep that follows are multiplied by per-state currents, giving
+// µAh per wake cycle. Charge used since the last recharge, set against the
+// voltage at that recharge and the voltage trend since, gives mAh and hours left
+// until the BAT threshold.
+//
+// The currents and capacity are first-pass figures for the LilyGo T5 4.7" S3
+// on a 1500 mAh cell; calibrate them against a meter (or a full discharge).
+// Everything lives in RTC memory, so a reset or reflash starts a new baseline.
+
+#pragma once
+
+#include <stdint.h>
+
+#define ENERGY_CAPACITY_MAH  1500   // nominal cell capacity
+#define ENERGY_CPU_MA        45     // awake, CPU at 240 MHz, radio off
+#define ENERGY_RADIO_MA      85     // added while WiFi is on (association, TX/RX)
+#define ENERGY_EPD_MA        60     // added while the panel is powered/refreshing
+#define ENERGY_SLEEP_UA      180    // whole board in deep sleep
+
+struct EnergyEstimate {
+    uint32_t uahPerWake;    // average charge per wake cycle (wake + its sleep)
+    uint32_t cycleS;        // average wake-to-wake interval
+    int32_t  remainingMah;  // until floorMv; -1 = no voltage sample yet
+    int32_t  hoursLeft;     // at the average rate; -1 = unknown
+    bool     fromTrend;     // remaining came from the measured voltage trend
+};
+
+// Settles the sleep that just ended (its real length, when the clock allows).
+// Call once per wake, after the clock is set up.
+void energyBegin();
+
+// Radio on/off edges (WiFi connect start / disconnect).
+void energyRadio(bool on);
+
+// A fresh battery reading. A jump up by more than a few ADC-noise widths is a
+// recharge: the charge count restarts from it.
+void energyNoteVoltage(int mv);
+
+// Closes this wake's charge (awake time from esp_timer, radio from the edges
+// above, EPD from the wake trace) and books the coming sleep at `sleepS`
+// (0 = untimed; booked on the next wake instead). Call at sleep entry, after traceCommit().
+void energyCommit(uint32_t sleepS);
+
+// The current estimate down to `floorMv` (the BAT threshold). False until a
+// full wake cycle has been measured.
+bool energyEstimate(int floorMv, EnergyEstimate &e);
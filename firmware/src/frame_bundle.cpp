@@ -0,0 +1,164 @@
+#include "frame_bundle.h"
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+
+#include "config.h"
+#include "tls_session.h"
+
+#define BUNDLE_SECTOR        4096
+#define BUNDLE_HEADER_BYTES  32   // magic, count, generated, updated[20]
+#define BUNDLE_ENTRY_BYTES   16
+#define BUNDLE_STALL_MS      15000
+
+const esp_partition_t *dataPartition() {
+    static const esp_partition_t *part = nullptr;
+    if (!part) {
+        part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                        ESP_PARTITION_SUBTYPE_DATA_SPIFFS, nullptr);
+        if (!part) Serial.println("No flash data partition");
+    }
+    return part;
+}
+
+static uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Parses a header + frame table (at least one sector's worth); `size` is the
+// container length when known (a download), else 0. Offsets stay relative to
+// the container.
+static bool parseBundle(const uint8_t *raw, uint32_t size, BundleInfo &info) {
+    if (memcmp(raw, "WFB1", 4) != 0) return false;
+    info.count     = le32(raw + 4);
+    info.generated = le32(raw + 8);
+    memcpy(info.updated, raw + 12, 20);
+    info.updated[20] = '\0';
+    if (info.count == 0 || info.count > BUNDLE_MAX_FRAMES) return false;
+    uint32_t tableEnd = BUNDLE_HEADER_BYTES + info.count * BUNDLE_ENTRY_BYTES;
+    for (uint32_t i = 0; i < info.count; i++) {
+        const uint8_t *e = raw + BUNDLE_HEADER_BYTES + i * BUNDLE_ENTRY_BYTES;
+        BundleFrame &f = info.frames[i];
+        f.validFrom  = le32(e);
+        f.validUntil = le32(e + 4);
+        f.offset     = le32(e + 8);
+        f.length     = le32(e + 12);
+        if (f.validUntil <= f.validFrom || f.offset < tableEnd || f.length == 0
+            || f.offset + f.length > BUNDLE_SLOT_BYTES
+            || (size && f.offset + f.length > size)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static uint32_t slotOffset(int slot) {
+    return (uint32_t)slot * BUNDLE_SLOT_BYTES;
+}
+
+// The slot holding the newest valid bundle (and its header), or -1.
+static int newestSlot(const esp_partition_t *part, BundleInfo &info) {
+    int best = -1;
+    for (int slot = 0; slot < 2; slot++) {
+        uint8_t raw[BUNDLE_HEADER_BYTES + BUNDLE_MAX_FRAMES * BUNDLE_ENTRY_BYTES];
+        BundleInfo b;
+        if (esp_partition_read(part, slotOffset(slot), raw, sizeof(raw)) != ESP_OK
+            || !parseBundle(raw, 0, b)) {
+            continue;
+        }
+        if (best < 0 || (int32_t)(b.generated - info.generated) > 0) {
+            best = slot;
+            info = b;
+        }
+    }
+    return best;
+}
+
+bool bundleLoad(BundleInfo &info) {
+    const esp_partition_t *part = dataPartition();
+    if (!part || part->size < BUNDLE_REGION_BYTES) return false;
+    int slot = newestSlot(part, info);
+    if (slot < 0) return false;
+    for (uint32_t i = 0; i < info.count; i++) info.frames[i].offset += slotOffset(slot);
+    return true;
+}
+
+int bundleFrameAt(const BundleInfo &info, uint32_t now) {
+    for (uint32_t i = 0; i < info.count; i++) {
+        if (now >= info.frames[i].validFrom && now < info.frames[i].validUntil) return (int)i;
+    }
+    return -1;
+}
+
+bool bundleRead(uint32_t offset, uint8_t *buf, uint32_t n) {
+    const esp_partition_t *part = dataPartition();
+    return part && offset + n <= BUNDLE_REGION_BYTES
+        && esp_partition_read(part, offset, buf, n) == ESP_OK;
+}
+
+// Fills `buf` with exactly n body bytes; false if the stream ends or stalls.
+static bool readBody(WiFiClient *stream, uint8_t *buf, uint32_t n) {
+    uint32_t have = 0;
+    unsigned long lastByte = millis();
+    while (have < n) {
+        int avail = stream->available();
+        if (avail > 0) {
+            have += stream->readBytes(buf + have, min((uint32_t)avail, n - have));
+            lastByte = millis();
+        } else if (!stream->connected() || millis() - lastByte >= BUNDLE_STALL_MS) {
+            return false;
+        } else {
+            delay(1);
+        }
+    }
+    return true;
+}
+
+bool bundleFetch(const char *zip) {
+    const esp_partition_t *part = dataPartition();
+    if (!part || part->size < BUNDLE_REGION_BYTES) return false;
+
+    ResumableTlsClient client;
+    HTTPClient http;
+    http.begin(client, String(SERVER_BASE_URL) + "/weather/" + zip + ".bundle");
+    http.setTimeout(15000);
+    unsigned long t0 = millis();
+    int code = http.GET();
+    int32_t size = http.getSize();
+    if (code != HTTP_CODE_OK || size <= BUNDLE_SECTOR || size > BUNDLE_SLOT_BYTES) {
+        Serial.printf("Bundle: HTTP %d, %d bytes — not stored\n", code, size);
+        http.end();
+        return false;
+    }
+
+    // Into the slot not in use. Its sector 0 (header + table) is erased first
+    // and written last: until then that slot holds no bundle, and the old one
+    // in the other slot stays the stored bundle.
+    static uint8_t head[BUNDLE_SECTOR], sector[BUNDLE_SECTOR];
+    BundleInfo info;
+    int      old  = newestSlot(part, info);
+    uint32_t base = slotOffset(old == 0 ? 1 : 0);
+    WiFiClient *stream = http.getStreamPtr();
+    bool ok = esp_partition_erase_range(part, base, BUNDLE_SECTOR) == ESP_OK
+           && readBody(stream, head, BUNDLE_SECTOR)
+           && parseBundle(head, (uint32_t)size, info);
+    for (uint32_t off = BUNDLE_SECTOR; ok && off < (uint32_t)size; off += BUNDLE_SECTOR) {
+        uint32_t n = min((uint32_t)BUNDLE_SECTOR, (uint32_t)size - off);
+        ok = readBody(stream, sector, n)
+          && esp_partition_erase_range(part, base + off, BUNDLE_SECTOR) == ESP_OK
+          && esp_partition_write(part, base + off, sector, n) == ESP_OK;
+    }
+    http.end();
+    ok = ok && esp_partition_write(part, base, head, BUNDLE_SECTOR) == ESP_OK;
+    if (!ok) {
+        Serial.printf("Bundle: download or flash write failed — %s\n",
+                      old >= 0 ? "keeping the stored one" : "none stored");
+        return false;
+    }
+    // The new one is complete: retire the old one.
+    if (old >= 0) esp_partition_erase_range(part, slotOffset(old), BUNDLE_SECTOR);
+    Serial.printf("Bundle: %u frame(s), %d bytes in %lu ms (data %s, slot %u)\n",
+                  (unsigned)info.count, size, millis() - t0, info.updated,
+                  (unsigned)(base / BUNDLE_SLOT_BYTES));
+    return true;
+}
@@ -0,0 +1,67 @@
+// Offline frame bundle: the next few hours of weather frames, kept in flash.
+//
+// While a wake is online anyway, the device now and then fetches
+// /weather/{zip}.bundle: the worker renders the location's hourly forecast
+// ahead into one 4bpp frame per hour, each with the window it's valid for. The
+// bundle streams into the flash data partition (the default table's "spiffs";
+// no filesystem is mounted on it). A wake that can't reach the server, or that
+// skips the radio on purpose, shows the bundle frame for the current time
+// instead of freezing on the last one. Nothing here needs WiFi to read back.
+//
+// Container layout (little-endian), as served and as stored:
+//   "WFB1"      magic
+//   u32         frame count (at most BUNDLE_MAX_FRAMES)
+//   u32         generated: epoch seconds the bundle was rendered
+//   char[20]    X-Updated of the data it was rendered from (NUL-padded)
+//   count × { u32 validFrom, u32 validUntil (epoch s, [from, until)),
+//             u32 offset (from the start of the container), u32 length }
+//   frame bodies: 4bpp grayscale PNGs, as /weather/{zip}.png serves them
+// worker/src/index.js encodes the same.
+//
+// The region holds two bundle slots. A download goes into the one not in use,
+// its first sector (header + table) last, and only then is the old bundle
+// retired (its first sector erased): a download cut off by a WiFi drop, a stall
+// or a reset leaves the previous bundle in place for the offline wakes that
+// follow. Should a reset land between the two writes, both slots are valid and
+// the later `generated` wins.
+
+#pragma once
+
+#include <stdint.h>
+#include <esp_partition.h>
+
+#define BUNDLE_MAX_FRAMES     12
+#define BUNDLE_REGION_BYTES   (1024 * 1024)  // from the start of the data partition
+#define BUNDLE_SLOT_BYTES     (BUNDLE_REGION_BYTES / 2)  // largest bundle stored
+
+struct BundleFrame {
+    uint32_t validFrom;   // epoch s
+    uint32_t validUntil;  // epoch s, exclusive
+    uint32_t offset;      // of the PNG, in the data partition (bundleRead's offset)
+    uint32_t length;
+};
+
+struct BundleInfo {
+    uint32_t    generated;   // epoch s
+    char        updated[21]; // X-Updated of the source data
+    uint32_t    count;
+    BundleFrame frames[BUNDLE_MAX_FRAMES];
+};
+
+// The flash data partition the bundle lives in (its tail past
+// BUNDLE_REGION_BYTES holds last_frame.h's slots), or nullptr if the table has
+// none.
+const esp_partition_t *dataPartition();
+
+// Downloads the bundle for `zip` into flash, replacing the stored one once it's
+// complete. Call with WiFi up. False on any failure; the stored one is kept.
+bool bundleFetch(const char *zip);
+
+// Reads the stored bundle's header. False if there is none.
+bool bundleLoad(BundleInfo &info);
+
+// Index of the frame valid at `now`, or -1.
+int bundleFrameAt(const BundleInfo &info, uint32_t now);
+
+// Reads n bytes at `offset` of the stored bundle.
+bool bundleRead(uint32_t offset, uint8_t *buf, uint32_t n);
@@ -0,0 +1,42 @@
+// Button wake: long hold vs accidental tap.
+//
+// Fed one sample of the button every `dtMs`, starting at the wake. A press that
+// lasts `holdMs` is a HOLD (open the menu); a release that stays released for
+// `debounceMs` before then is a TAP (go straight back to sleep). A bounce shorter
+// than the debounce window doesn't cut a hold short.
+//
+// Runs inside the deep-sleep wake stub (wake_stub.cpp), which executes from RTC
+// memory before the flash is even mapped — so everything here is forced inline
+// into the caller and touches nothing but its arguments. It's also the fallback
+// classifier in setup(), and being free of Arduino/ESP dependencies it builds
+// and runs on a host.
+
+#pragma once
+
+#include <stdint.h>
+
+#define HOLD_INLINE inline __attribute__((always_inline))
+
+namespace holdclass {
+
+enum Verdict : uint8_t {
+    PENDING = 0,  // keep sampling
+    TAP,          // released before holdMs — accidental
+    HOLD,         // held for holdMs — deliberate
+};
+
+struct State {
+    uint32_t heldMs;      // time since the wake (the press started it)
+    uint32_t releasedMs;  // how long the button has been continuously released
+};
+
+static HOLD_INLINE Verdict step(State &s, bool pressed, uint32_t dtMs,
+                                uint32_t holdMs, uint32_t debounceMs) {
+    s.heldMs += dtMs;
+    s.releasedMs = pressed ? 0 : s.releasedMs + dtMs;
+    if (s.releasedMs >= debounceMs) return TAP;
+    if (s.heldMs >= holdMs) return pressed ? HOLD : PENDING;
+    return PENDING;
+}
+
+}  // namespace holdclass
@@ -0,0 +1,110 @@
+#include "last_frame.h"
+
+#include <Arduino.h>
+
+#include "frame_bundle.h"
+
+#define LAST_FRAME_SECTOR  4096
+
+struct SlotHeader {
+    char     magic[4];
+    uint32_t seq;
+    uint32_t length;
+    uint32_t hash;
+    uint32_t reserved;
+    char     updated[20];
+    char     etag[24];
+};
+static_assert(sizeof(SlotHeader) == LAST_FRAME_HEADER_BYTES, "slot header layout");
+
+// Slots that fit past the bundle region (0 if the partition is too small).
+static uint32_t slotCount(const esp_partition_t *part) {
+    if (!part || part->size <= BUNDLE_REGION_BYTES) return 0;
+    uint32_t n = (part->size - BUNDLE_REGION_BYTES) / LAST_FRAME_SLOT_BYTES;
+    return n > LAST_FRAME_MAX_SLOTS ? LAST_FRAME_MAX_SLOTS : n;
+}
+
+static uint32_t slotOffset(uint32_t slot) {
+    return BUNDLE_REGION_BYTES + slot * LAST_FRAME_SLOT_BYTES;
+}
+
+// The newest valid slot's index and header, or -1.
+static int newestSlot(const esp_partition_t *part, SlotHeader &newest) {
+    int best = -1;
+    for (uint32_t i = 0; i < slotCount(part); i++) {
+        SlotHeader h;
+        if (esp_partition_read(part, slotOffset(i), &h, sizeof(h)) != ESP_OK
+            || memcmp(h.magic, "WLF1", 4) != 0
+            || h.length == 0 || h.length > LAST_FRAME_MAX_PNG) {
+            continue;
+        }
+        if (best < 0 || (int32_t)(h.seq - newest.seq) > 0) {
+            best   = (int)i;
+            newest = h;
+        }
+    }
+    return best;
+}
+
+bool lastFrameLoad(LastFrame &f) {
+    const esp_partition_t *part = dataPartition();
+    SlotHeader h;
+    int slot = newestSlot(part, h);
+    if (slot < 0) return false;
+    f.seq     = h.seq;
+    f.offset  = slotOffset(slot) + LAST_FRAME_HEADER_BYTES;
+    f.length  = h.length;
+    f.hash    = h.hash;
+    memcpy(f.updated, h.updated, sizeof(h.updated));
+    f.updated[sizeof(h.updated)] = '\0';
+    memcpy(f.etag, h.etag, sizeof(h.etag));
+    f.etag[sizeof(h.etag)] = '\0';
+    return true;
+}
+
+bool lastFrameRead(uint32_t offset, uint8_t *buf, uint32_t n) {
+    const esp_partition_t *part = dataPartition();
+    return part && offset >= BUNDLE_REGION_BYTES && offset + n <= part->size
+        && esp_partition_read(part, offset, buf, n) == ESP_OK;
+}
+
+bool lastFrameSave(const uint8_t *png, uint32_t len, uint32_t hash,
+                   const char *etag, const char *updated) {
+    const esp_partition_t *part = dataPartition();
+    uint32_t slots = slotCount(part);
+    if (slots == 0 || len == 0 || len > LAST_FRAME_MAX_PNG) return false;
+
+    SlotHeader h;
+    int newest = newestSlot(part, h);
+    if (newest >= 0 && h.hash == hash && h.length == len) {
+        Serial.println("Last frame: already stored");
+        return true;
+    }
+    uint32_t slot = newest < 0 ? 0 : ((uint32_t)newest + 1) % slots;
+    uint32_t seq  = newest < 0 ? 1 : h.seq + 1;
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "WLF1", 4);
+    h.seq    = seq;
+    h.length = len;
+    h.hash   = hash;
+    strncpy(h.updated, updated, sizeof(h.updated));
+    strncpy(h.etag, etag, sizeof(h.etag));
+
+    // Erase only the sectors this frame needs; the header goes in last.
+    uint32_t base  = slotOffset(slot);
+    uint32_t erase = (LAST_FRAME_HEADER_BYTES + len + LAST_FRAME_SECTOR - 1)
+                   / LAST_FRAME_SECTOR * LAST_FRAME_SECTOR;
+    unsigned long t0 = millis();
+    bool ok = esp_partition_erase_range(part, base, erase) == ESP_OK
+           && esp_partition_write(part, base + LAST_FRAME_HEADER_BYTES, png, len) == ESP_OK
+           && esp_partition_write(part, base, &h, sizeof(h)) == ESP_OK;
+    if (!ok) {
+        Serial.printf("Last frame: write to slot %u failed\n", (unsigned)slot);
+        return false;
+    }
+    Serial.printf("Last frame: %u bytes to slot %u/%u (seq %u) in %lu ms\n",
+                  (unsigned)len, (unsigned)slot, (unsigned)slots, (unsigned)seq,
+                  millis() - t0);
+    return true;
+}
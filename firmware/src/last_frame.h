@@ -0,0 +1,54 @@
+// Last-good frame: the most recent live weather PNG, kept in flash.
+//
+// RTC memory dies with the power, so after a true power-off the device used to
+// know nothing of what it last showed: no WiFi on that first boot meant the
+// splash, and even with WiFi the panel stayed blank until a fresh frame arrived.
+// Now each newly decoded weather frame (its PNG body exactly as served, plus its
+// hash, ETag and X-Updated) is also written to flash, and a cold boot decodes
+// it back onto the panel before WiFi starts.
+//
+// Storage is the tail of the flash data partition, past the frame bundle's
+// region (frame_bundle.h): LAST_FRAME_SLOT_BYTES slots, as many as fit (up to
+// LAST_FRAME_MAX_SLOTS). Saves rotate through them, so each slot is erased
+// once per full turn, and the newest is found by its sequence number. A slot's
+// header is written after its body: a save cut short leaves the slot invalid
+// and the previous one still newest.
+//
+// Slot layout (native little-endian):
+//   "WLF1"      magic
+//   u32         sequence (newest wins)
+//   u32         PNG length
+//   u32         djb2 hash of the PNG (what prev_png_hash tracks)
+//   u32         reserved (0)
+//   char[20]    X-Updated (NUL-padded)
+//   char[24]    ETag (NUL-padded)
+//   PNG body from byte LAST_FRAME_HEADER_BYTES
+
+#pragma once
+
+#include <stdint.h>
+
+#define LAST_FRAME_SLOT_BYTES    (64 * 1024)
+#define LAST_FRAME_MAX_SLOTS     8
+#define LAST_FRAME_HEADER_BYTES  64
+#define LAST_FRAME_MAX_PNG       (LAST_FRAME_SLOT_BYTES - LAST_FRAME_HEADER_BYTES)
+
+struct LastFrame {
+    uint32_t seq;
+    uint32_t offset;      // of the PNG, in the data partition
+    uint32_t length;
+    uint32_t hash;
+    char     updated[21];
+    char     etag[25];
+};
+
+// Finds the newest stored frame. False if there is none.
+bool lastFrameLoad(LastFrame &f);
+
+// Reads n bytes of the stored PNG at `offset` (as lastFrameLoad gave it).
+bool lastFrameRead(uint32_t offset, uint8_t *buf, uint32_t n);
+
+// Stores a frame in the next slot. A frame whose hash matches the newest
+// stored one is not written again. False if it doesn't fit or the write failed.
+bool lastFrameSave(const uint8_t *png, uint32_t len, uint32_t hash,
+                   const char *etag, const char *updated);
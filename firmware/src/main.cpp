@@ -9,66 +9,161 @@
 // password, and zip into NVS via saveConfig() and esp_restart()s; the next
 // boot lands in the weather flow.
 //
+// The weather PNG is decoded while it downloads: PNGdec pulls the body straight
+// off the HTTP stream (see the streaming PNG source below), so there is no
+// full-body buffer and network wait overlaps with inflate + draw.
+//
 // Change detection: a simple hash of the PNG bytes is persisted in RTC memory
 // across deep sleep cycles. If the hash and the active status code are both
 // unchanged, the e-paper refresh is skipped (saves power and avoids the visible
-// flash of a full refresh).
+// flash of a full refresh). The worker's ETag for the frame on screen is kept
+// alongside it and sent back as If-None-Match, so an unchanged frame costs a
+// bodiless 304 instead of a download + hash + decode.
+//
+// Offline, the device shows the hour's frame from a bundle of forecast frames
+// kept in flash (see frame_bundle.h) instead of freezing on the last one.
+// The last live frame is kept in flash too (last_frame.h): after a power loss
+// it's back on the panel before WiFi is even up.
 
 #include <Arduino.h>
 #include <esp_sleep.h>
 #include <esp_adc_cal.h>
 #include <driver/rtc_io.h>
 #include <time.h>
+#include <sys/time.h>
+#include <esp_sntp.h>
+#include <esp_idf_version.h>
+#include <esp_timer.h>
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 #include <HTTPClient.h>
-#include <HTTPUpdate.h>
+#include <Update.h>
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#include <esp32s3/rom/miniz.h>
 #include <PNGdec.h>
+#include <Preferences.h>
 #include <qrcode.h>
 
 #include "epd_driver.h"
 #include "firasans.h"
 
 #include "config.h"
-#include "splash_png.h"
-#include "setup_png.h"
-#include "menu_png.h"
+#include "splash_4bpp.h"
+#include "setup_4bpp.h"
+#include "menu_4bpp.h"
 #include "render.h"
+#include "rle4.h"
+#include "scanline.h"
 #include "setup_mode.h"
+#include "tls_session.h"
+#include "wake_stub.h"
+#include "wake_trace.h"
+#include "energy.h"
+#include "battery_log.h"
+#include "button_input.h"
+#include "delta_patch.h"
+#include "frame_bundle.h"
+#include "last_frame.h"
+#include "ota_image.h"
 
 // ─── constants ───────────────────────────────────────────────────────────────
 
 #define SLEEP_MINUTES        10
-// Shorter wake interval after a failed fetch — recover faster from transient
-// outages without burning extra battery in the steady-state success case.
+// First retry after a failed WiFi connect or server error — recover faster from
+// transient outages without burning extra battery in the steady-state success
+// case. Further retries back off per failure class (see the retry policy).
 #define RETRY_SLEEP_MINUTES  5
 
-// After this many consecutive failed WiFi connects (~3h at RETRY_SLEEP_MINUTES),
-// a configured device gives up its now-stale weather and falls back to the
-// no-WiFi splash. The streak resets on ANY successful connect, so intermittent
-// WiFi never trips it — only a sustained outage does.
-#define WIFI_FAIL_SPLASH_THRESHOLD  36
-// While on the no-WiFi splash, recheck for WiFi at this slower cadence (vs the
-// 5-min retry) — we've given up for now, so just poll occasionally to save power.
+// After WiFi has been failing continuously for this long, a configured device
+// gives up its now-stale weather and falls back to the no-WiFi splash. Any
+// successful connect resets it, so intermittent WiFi never trips it — only a
+// sustained outage does. (Time, not a wake count: retries back off.)
+#define WIFI_FAIL_SPLASH_SECONDS  (3 * 3600)
+// Offline frame bundle (see frame_bundle.h). Online wakes refetch it once it's
+// this old; the worker caches its render about as long, so refetching sooner
+// would mostly download the same frames again.
+#define BUNDLE_REFRESH_S       3600
+#define BUNDLE_RETRY_WAKES     6      // after a failed bundle fetch
+// A night-time timer wake skips WiFi altogether when the bundle has a frame for
+// now rendered from data at most this old — the overnight forecast rarely moves,
+// and the hourly chart still advances. Daytime wakes always go online.
+#define BUNDLE_SKIP_MAX_AGE_S  (6 * 3600)
+#define BUNDLE_WAKE_SLACK_S    60     // radio-less wakes land this long after a frame starts
+// Last-good frame (see last_frame.h): a new frame is written at most this
+// often. Six 64 KB slots at ≤96 saves a day take each sector through ~16 erase
+// cycles a day — decades of its 100k. A frame skipped here only means a cold
+// boot repaints a slightly older one, stamped OLD until the fetch replaces it.
+#define LAST_FRAME_SAVE_MIN_S  (15 * 60)
+// While on the no-WiFi splash, recheck for WiFi at least this far apart — we've
+// given up for now, so just poll occasionally to save power.
 #define RECOVERY_SLEEP_MINUTES  30
 // Message drawn in the splash's reserved bottom strip when a configured device
 // has lost WiFi past the threshold (splash.jsx leaves this strip clear).
 #define SPLASH_MSG_NO_WIFI  "WiFi network unavailable"
 #define SPLASH_MSG_Y        (EPD_HEIGHT - 40)   // text baseline in the bottom strip
 
+// Adaptive wake schedule (see scheduleSleepSeconds). The worker's X-Next-Update
+// hint says when its next poll can re-render the frame and how often polls find
+// changed data; wakes land just after a poll, spaced from SLEEP_MINUTES (busy
+// weather) out to SCHED_STABLE_MINUTES (settled), and SCHED_NIGHT_MINUTES
+// overnight. Without a hint (older worker) it's a plain SLEEP_MINUTES.
+#define SCHED_STABLE_MINUTES   30
+#define SCHED_NIGHT_MINUTES    60   // also the cap: OLD shows past 60 min stale
+#define SCHED_NIGHT_START      23   // local hour, inclusive
+#define SCHED_NIGHT_END        6    // local hour, exclusive
+#define SCHED_RENDER_SLACK_S   30   // poll start → new frame in KV
+#define SCHED_MIN_S            60
+
 // SERVER_BASE_URL lives in config.h (used by both main + setup_mode).
 
+// Frame formats offered to the worker, best first: the pre-quantized 4bpp
+// grayscale PNG (half the payload, no per-pixel conversion on decode), else the
+// plain 8bpp PNG. Anything the worker sends still decodes — png_draw_callback()
+// handles every PNG pixel format.
+#define FRAME_ACCEPT  "image/png;depth=4, image/png;q=0.5"
+
 // WiFi connect timeout — give up if STA association doesn't complete in this
 // window, count the wake as a failure, and deep sleep.
 #define WIFI_TIMEOUT_MS      20000
+// Fast reconnect (see connectWiFi): a channel-locked association to the cached
+// BSSID with the cached static IP normally completes in well under a second.
+// If it hasn't within this window, fall back to the full scan + DHCP path.
+#define WIFI_FAST_TIMEOUT_MS 3000
+// Re-run DHCP at least this often (in wakes; ~6 h at the default cadence) even
+// when the fast path works, so the cached lease is renewed well inside any
+// router's lease time and the router keeps the address reserved for us.
+#define WIFI_DHCP_REFRESH_WAKES  36
+
+// ── Clock ────────────────────────────────────────────────────────────────────
+// The clock is set from the Date header of every weather response (free, ±1 s)
+// and otherwise runs on the RTC through deep sleep, corrected at each wake by a
+// learned drift rate. A real NTP exchange runs only when due, and in the
+// background alongside the fetch — never as a wait. See the clock section.
+//
+// TODO: This timezone must match the Worker's TIMEZONE var in wrangler.toml.
+// If the Worker is reconfigured for a different timezone, update this POSIX
+// TZ string to match, otherwise the staleness calculation will be wrong.
+// See: https://www.gnu.org/software/libc/manual/html_node/TZ-Variable.html
+#define CLOCK_TZ             "EST5EDT,M3.2.0,M11.1.0"
+// Cross-check against NTP at least this often (in wakes; ~1 day at the default
+// cadence), in case the server's Date is off.
+#define CLOCK_NTP_WAKES      144
+// …or sooner, once the estimated clock error since the last sync exceeds this.
+// Staleness is reported in minutes, so a minute of error is the budget.
+#define CLOCK_MAX_ERROR_S    60
+// How far the drift correction itself is trusted: the residual rate error the
+// error estimate assumes. The RC slow clock drifts by up to a few percent
+// uncorrected; corrected, a residual of ~0.2% is conservative.
+#define CLOCK_DRIFT_UNCERTAINTY_PPM  2000
 
 // BUTTON_GPIO / BUTTON_HOLD_MS now live in config.h (shared with setup_mode.cpp,
 // which polls the button to offer long-press → menu while the AP is up).
 
 // ── On-device menu ───────────────────────────────────────────────────────────
 // Opened by a long-press wake; navigated by short presses (cycle the cursor),
-// items chosen by another long-press. Rendered from the bundled menu PNG
-// (menu_png.h); the cursor arrow is drawn on-device in the reserved left column.
+// items chosen by another long-press. Rendered from the bundled, pre-packed
+// menu image (menu_4bpp.h); the cursor arrow is drawn on-device in the reserved left column.
 // ⚠️ Row geometry MUST match worker/renderer/src/menu.jsx (ROW_Y0/ROW_H/items).
 #define MENU_ITEM_COUNT      4
 #define MENU_ROW_Y0          195    // y-centre (px) of the first menu row
@@ -76,17 +171,17 @@
 #define MENU_CURSOR_X        50     // left x (px) of the cursor arrow
 #define MENU_CURSOR_W        34     // arrow width (px)
 #define MENU_CURSOR_H        40     // arrow height (px)
-// Partial-refresh cursor box: on a cursor move the arrow is erased/redrawn
-// inside this byte-aligned box instead of repainting the whole 960×540 screen.
-// x and width MUST be even so the packed 4bpp sub-buffer (2 px/byte) extracts on
-// clean byte boundaries. Sized to contain the arrow + a small margin.
+// Cursor box: on a cursor move the old arrow is erased within this box in the
+// framebuffer, and present() repaints just what changed. Sized to contain the
+// arrow + a small margin.
 #define MENU_CURSOR_BOX_X    (MENU_CURSOR_X - 4)   // 46 (even)
 #define MENU_CURSOR_BOX_W    (MENU_CURSOR_W + 8)   // 42 (even)
 #define MENU_CURSOR_BOX_H    (MENU_CURSOR_H + 8)   // 48
-// Erase flash for the old cursor box: number of black↔white clear cycles. The
+// Erase flash for a cursor move: number of black↔white clear cycles. The
 // library default is 4 — the main per-move flicker source. Fewer = less flicker
-// but more ghost residue left behind (1 = minimum that still erases). Tunable:
-// raise toward 2–4 if residue is too heavy.
+// but more ghost residue left behind (1 = minimum that still erases), which the
+// per-tile ghost budget eventually clears with a full refresh. Tunable: raise
+// toward 2–4 if residue is too heavy.
 #define MENU_CURSOR_CLEAR_CYCLES  1
 // Shared idle timeout for every awake on-device screen (menu, factory-reset
 // confirm, debug, recent errors). After this much inactivity the screen exits to
@@ -200,18 +295,58 @@ static const char *STATUS_CODES[ST_COUNT] = {
 // first-pass values; tune them once we have real discharge data from this cell.
 #define BATTERY_LOW_MV   3500   // ~3.5 V (loaded) — show BAT at/below this
 #define BATTERY_OK_MV    3700   // ~3.7 V — clears the latch after a recharge
+// Re-sample the battery at least this often (in wakes) even when nothing is
+// repainted — at the default cadence that's about once an hour.
+#define BATTERY_SAMPLE_WAKES  4
+
+// Display compositor (see present()). The panel is split into a grid of tiles;
+// only tiles whose content changed are repainted. TILE_W MUST be even so every
+// tile packs to whole bytes in the 4bpp framebuffer.
+#define TILE_W       96     // 960 / 96 = 10 columns
+#define TILE_H       54     // 540 / 54 = 10 rows
+#define TILE_COLS    (EPD_WIDTH / TILE_W)
+#define TILE_ROWS    (EPD_HEIGHT / TILE_H)
+#define TILE_COUNT   (TILE_COLS * TILE_ROWS)
+// Past this many dirty tiles a partial update saves little and ghosts more than
+// a full refresh — just do the full refresh.
+#define PARTIAL_MAX_DIRTY_TILES  (TILE_COUNT / 2)
+// Ghosting budget, per tile. A partial repaint with N erase cycles adds
+// GHOST_UNITS(N) to every tile it touches (4 cycles is the library's full
+// erase), and a frame that would push any tile past the budget is a full
+// refresh instead. 24 is 12 weather updates (~2h of hourly-ish changes) or 6
+// cursor passes over the same spot. Raise it if the panel stays clean; lower it
+// if the digits smear.
+#define PARTIAL_GHOST_BUDGET     24
+#define GHOST_UNITS(cycles)      ((4 + (cycles) - 1) / (cycles))
+// Erase cycles for a dirty weather region — same trade-off as the status box.
+#define WEATHER_CLEAR_CYCLES     2
+// Erase cycles for the text screens' incremental updates (debug progress, the
+// error list, menu entry from a screen that shares most of its pixels).
+#define SCREEN_CLEAR_CYCLES      2
 
 // ─── RTC memory — survives deep sleep ────────────────────────────────────────
 // RTC_DATA_ATTR places these in RTC slow memory, which is NOT cleared on
 // deep-sleep wake. Regular RAM is wiped on every wake.
 
 RTC_DATA_ATTR static uint32_t prev_png_hash       = 0;
+// ETag of the frame on screen (empty = none / must re-download). Sent as
+// If-None-Match; only set once that frame actually decoded.
+RTC_DATA_ATTR static char     prev_etag[24]       = {0};
 RTC_DATA_ATTR static int      prev_status         = ST_NONE;
 RTC_DATA_ATTR static bool     battery_low_latched = false;
-// No-WiFi splash fallback: consecutive failed connects, and whether the current
-// home screen is the splash (vs weather). See WIFI_FAIL_SPLASH_THRESHOLD.
+// No-WiFi splash fallback: consecutive failed connects, when the run started
+// (time(); only differences matter, so an unsynced clock is fine), and whether
+// the current home screen is the splash (vs weather). See WIFI_FAIL_SPLASH_SECONDS.
 RTC_DATA_ATTR static uint32_t wifi_fail_streak    = 0;
+RTC_DATA_ATTR static uint32_t wifi_fail_since     = 0;
 RTC_DATA_ATTR static bool     home_is_splash      = false;
+// validFrom of the bundle frame on screen (0 = a live frame, or none), and the
+// boot from which a failed bundle fetch may be retried.
+RTC_DATA_ATTR static uint32_t bundle_shown_from   = 0;
+RTC_DATA_ATTR static uint32_t bundle_retry_boot   = 0;
+// When the last-good frame was last written to flash (epoch s; 0 = not since
+// power-on).
+RTC_DATA_ATTR static uint32_t last_frame_saved_at = 0;
 // Recent-errors ring (shown on the debug "Recent Errors" screen), newest first.
 // Consecutive identical failures (same kind+detail, no clean wake between)
 // coalesce into one entry with a count + start time, so a sustained outage is a
@@ -224,11 +359,13 @@ enum ErrKind : uint8_t {
     EK_HTTP,       // server returned non-200 (detail = HTTP status)
     EK_TRANSPORT,  // HTTPClient negative code: DNS / connect / TLS / timeout (detail = code)
     EK_EMPTY,      // no Content-Length / chunked response
-    EK_OOM,        // PSRAM alloc for the PNG failed
-    EK_TRUNCATED,  // short read — connection dropped mid-download
+    EK_OOM,        // (retired) PSRAM alloc for the PNG body — the streaming decode
+                   //   has no body buffer; kept so logged codes stay stable
+    EK_TRUNCATED,  // short read — connection dropped / stalled mid-download
     EK_DECODE,     // PNG decode failed (detail = PNGdec rc)
-    EK_NTP,        // NTP sync timed out (clock / staleness unreliable)
-    EK_OTA,        // OTA flash failed (detail = httpUpdate error)
+    EK_NTP,        // clock not synced and its drift estimate out of bounds
+                   //   (staleness unreliable)
+    EK_OTA,        // OTA failed (detail = HTTP status, or an OTA_ERR_* code)
 };
 struct ErrEntry {
     uint32_t firstEpoch;  // first occurrence of this run (unix time; 0 = clock not synced)
@@ -246,38 +383,122 @@ RTC_DATA_ATTR static uint32_t boot_count          = 0;
 // re-flash the same splash on every wake (visible refresh + power cost).
 // Cleared whenever we successfully render weather.
 RTC_DATA_ATTR static bool     splash_already_drawn = false;
-// OTA failure cooldown. After a failed httpUpdate we record the version and the
+// OTA failure cooldown. After a failed OTA attempt we record the version and the
 // boot_count at which it may be retried (set to boot_count + OTA_FAIL_COOLDOWN_
 // WAKES). This stops a broken build re-downloading every wake, but auto-retries
 // once the window elapses, so a transient error can never permanently block
 // updates. A newer advertised version bypasses it; a power-on reset clears it.
 RTC_DATA_ATTR static int      ota_failed_version   = 0;
 RTC_DATA_ATTR static uint32_t ota_retry_after_boot = 0;
+// Per-tile hashes of whatever is physically on the panel (0 = unknown), and the
+// ghosting each tile has taken since the last full refresh — see present().
+RTC_DATA_ATTR static uint32_t panel_tiles[TILE_COUNT];
+RTC_DATA_ATTR static bool     panel_tiles_valid = false;
+RTC_DATA_ATTR static uint8_t  tile_ghost[TILE_COUNT];
+// Last battery sample and the boot it was taken on. Reading BATT_PIN needs the
+// EPD rail powered (and so epd_init()), which a no-change wake otherwise never
+// touches — so the reading is reused until it's BATTERY_SAMPLE_WAKES old, or
+// refreshed for free whenever the display is up anyway.
+RTC_DATA_ATTR static int      batt_mv_cached   = 0;
+RTC_DATA_ATTR static uint32_t batt_sample_boot = 0;
+
+// Fast-reconnect cache: the AP and IP lease from the last full (scan + DHCP)
+// connect. Keyed by a hash of the SSID + password so a reconfigured network
+// never gets a stale lease. See connectWiFi().
+struct WifiCache {
+    uint32_t credHash;      // 0 = empty
+    uint8_t  bssid[6];
+    int32_t  channel;
+    uint32_t ip, gateway, netmask, dns1, dns2;
+    uint8_t  wakesSinceDhcp;
+};
+RTC_DATA_ATTR static WifiCache wifi_cache = {};
+
+// Clock model (see the clock section). clock_sync_epoch is the UTC time of the
+// last sync (0 = never); clock_drift_ppm how fast the RTC runs slow (+) or fast
+// (−), learned from the error found at each sync.
+RTC_DATA_ATTR static uint32_t clock_sync_epoch = 0;
+RTC_DATA_ATTR static int32_t  clock_drift_ppm  = 0;
+RTC_DATA_ATTR static int64_t  clock_applied_us = 0;   // correction applied since that sync
+RTC_DATA_ATTR static uint32_t clock_ntp_boot   = 0;   // boot_count of the last NTP sync
 
 // ─── globals (re-initialized every wake) ─────────────────────────────────────
 
-static uint8_t *framebuffer = nullptr;
+static uint8_t *framebuffer = nullptr;    // see ensureFramebuffer()
+static bool     epdReady    = false;      // see ensureEpd()
 static PNG png;
 static uint16_t line_rgb565[EPD_WIDTH + 16];
 
 // Filled by fetchPng():
-static uint8_t  *pngBuf     = nullptr;
-static int32_t   pngLen     = 0;
+static uint32_t  pngHash    = 0;        // djb2 of the downloaded PNG bytes
+static bool      pngDecoded = false;    // body decoded into the framebuffer
+static bool      pngNotModified = false;  // 304: the frame on screen is current
+static char      fetchedEtag[24] = {0};  // ETag of the downloaded frame
 static char      updatedStr[32] = {0};  // X-Updated header value
+static uint8_t  *pngBody    = nullptr;  // the whole body, when fetchPng() was asked to keep it
+static int32_t   pngBodyLen = 0;
 static int       lastHttpCode   = 0;    // HTTP status from the last fetchPng()
 static int       latestFirmwareAvail = 0;  // X-Firmware-Latest from the weather fetch
+static int32_t   g_nextPollS   = -1;    // X-Next-Update: s to the worker's next poll (-1 = none)
+static uint32_t  g_pollEveryS  = 0;     // ...its poll period
+static int       g_volatility  = 0;     // ...% of polls that find changed data
+static unsigned long g_hintAtMs = 0;    // when the hint was received
 
 // Failure detail captured by the wake flow, consumed by logError() (see ErrKind).
 static uint8_t   g_fetchFail   = EK_HTTP; // why the last fetch failed (ErrKind)
 static int       g_fetchDetail = 0;       // HTTP / transport code for that failure
-static bool      g_ntpSynced   = true;    // did NTP sync this wake (set by connectWiFi)
+static bool      g_wifiFast    = false;   // connected via the cached AP + lease
 static int       g_decodeRc    = 0;       // PNGdec return code on a decode failure
-static int       g_otaError    = 0;       // httpUpdate error on an OTA failure
+static int       g_otaError    = 0;       // HTTP status / OTA_ERR_* on an OTA failure
+
+// ─── display bring-up (on demand) ────────────────────────────────────────────
+// epd_init() and the 259 KB framebuffer used to be set up at the top of every
+// wake, though most wakes end in a 304 or an unchanged frame and never draw.
+// Now whatever first draws or powers the panel calls ensureDisplay() (or just
+// ensureEpd() for the battery ADC), and a no-change wake skips both. The time
+// spent is tallied for the per-wake summary logged at sleep.
+
+static void enterDeepSleep(bool armTimer, uint32_t timerSeconds);
+static unsigned long g_displayInitMs = 0;  // epd_init + framebuffer, this wake
+
+static void ensureEpd() {
+    if (epdReady) return;
+    unsigned long t0 = millis();
+    epd_init();
+    epdReady = true;
+    g_displayInitMs += millis() - t0;
+    traceAdd(TP_EPD, millis() - t0);
+    Serial.printf("EPD init in %lu ms\n", millis() - t0);
+}
+
+// Allocates the framebuffer (white) on first use. An allocation failure is
+// fatal for the wake, as it always was: nothing can be drawn.
+static void ensureFramebuffer() {
+    if (framebuffer) return;
+    unsigned long t0 = millis();
+    framebuffer = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+    if (!framebuffer) {
+        Serial.println("FATAL: framebuffer alloc failed");
+        enterDeepSleep(/*armTimer=*/true, SLEEP_MINUTES * 60);
+        return;
+    }
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    g_displayInitMs += millis() - t0;
+    traceAdd(TP_EPD, millis() - t0);
+}
+
+static void ensureDisplay() {
+    ensureEpd();
+    ensureFramebuffer();
+}
 
 // ─── simple hash (djb2) ─────────────────────────────────────────────────────
+// Incremental: seed with HASH_SEED and feed the bytes in as many pieces as they
+// arrive — the result matches hashing the whole buffer in one go.
+
+#define HASH_SEED  5381u
 
-static uint32_t hashBytes(const uint8_t *data, int32_t len) {
-    uint32_t h = 5381;
+static uint32_t hashBytes(uint32_t h, const uint8_t *data, int32_t len) {
     for (int32_t i = 0; i < len; i++) {
         h = ((h << 5) + h) ^ data[i];
     }
@@ -285,98 +506,368 @@ static uint32_t hashBytes(const uint8_t *data, int32_t len) {
 }
 
 // ─── PNG decode callback ─────────────────────────────────────────────────────
+// Shared by every PNG the firmware draws (weather, splash, setup, menu). Each
+// row goes through a compile-time specialized kernel for its pixel format (see
+// scanline.h) that packs two pixels per byte straight into the framebuffer row.
+// Formats without a kernel (16-bit channels, 1/2-bit gray) fall back to the
+// generic RGB565 → luma → epd_draw_pixel() path.
 
-static int png_draw_callback(PNGDRAW *pDraw) {
-    png.getLineAsRGB565(pDraw, line_rgb565, PNG_RGB565_LITTLE_ENDIAN, 0xFFFFFFFF);
+// Palette → luma table for indexed PNGs, rebuilt at the top of each image.
+static uint8_t paletteLut[256];
 
+static int png_draw_callback(PNGDRAW *pDraw) {
     const int y = pDraw->y;
-    const int w = pDraw->iWidth;
+    const int w = min(pDraw->iWidth, (int)EPD_WIDTH);
+    if (y >= EPD_HEIGHT) return 1;
+
+    const uint8_t *src = pDraw->pPixels;
+    uint8_t *dst = framebuffer + y * (EPD_WIDTH / 2);
+
+    // iBpp is PNGdec's bits per channel ("color stripe"), not per pixel.
+    switch (pDraw->iPixelType) {
+        case PNG_PIXEL_GRAYSCALE:
+            if (pDraw->iBpp == 8) { scanline::blitRow<scanline::Gray8>(dst, src, w); return 1; }
+            // Native 4bpp frame (negotiated via FRAME_ACCEPT): a nibble swap.
+            if (pDraw->iBpp == 4) { scanline::blitRow<scanline::Gray4>(dst, src, w); return 1; }
+            break;
+        case PNG_PIXEL_GRAY_ALPHA:
+            if (pDraw->iBpp == 8) { scanline::blitRow<scanline::GrayAlpha8>(dst, src, w); return 1; }
+            break;
+        case PNG_PIXEL_TRUECOLOR:
+            if (pDraw->iBpp == 8) { scanline::blitRow<scanline::Rgb8>(dst, src, w); return 1; }
+            break;
+        case PNG_PIXEL_TRUECOLOR_ALPHA:
+            if (pDraw->iBpp == 8) { scanline::blitRow<scanline::Rgba8>(dst, src, w); return 1; }
+            break;
+        case PNG_PIXEL_INDEXED:
+            if (y == 0) {
+                scanline::buildPaletteLut(paletteLut, pDraw->pPalette,
+                                          pDraw->iHasAlpha ? pDraw->pPalette + 768 : nullptr);
+            }
+            switch (pDraw->iBpp) {
+                case 8: scanline::blitRow<scanline::Indexed<8>>(dst, src, w, paletteLut); return 1;
+                case 4: scanline::blitRow<scanline::Indexed<4>>(dst, src, w, paletteLut); return 1;
+                case 2: scanline::blitRow<scanline::Indexed<2>>(dst, src, w, paletteLut); return 1;
+                case 1: scanline::blitRow<scanline::Indexed<1>>(dst, src, w, paletteLut); return 1;
+            }
+            break;
+    }
 
-    for (int x = 0; x < w && x < EPD_WIDTH; x++) {
+    // Generic fallback.
+    png.getLineAsRGB565(pDraw, line_rgb565, PNG_RGB565_LITTLE_ENDIAN, 0xFFFFFFFF);
+    for (int x = 0; x < w; x++) {
         uint16_t rgb = line_rgb565[x];
         uint8_t r = ((rgb >> 11) & 0x1F) << 3;
         uint8_t g = ((rgb >> 5)  & 0x3F) << 2;
         uint8_t b = ( rgb        & 0x1F) << 3;
-        uint8_t luma = (77u * r + 150u * g + 29u * b) >> 8;
-        epd_draw_pixel(x, y, luma, framebuffer);
+        epd_draw_pixel(x, y, scanline::luma(r, g, b), framebuffer);
     }
     return 1;
 }
 
-// ─── WiFi ────────────────────────────────────────────────────────────────────
+// ─── clock ───────────────────────────────────────────────────────────────────
+// The system clock survives deep sleep on the RTC slow clock, which drifts. At
+// wake, clockBegin() applies the learned drift for the time since the last sync.
+// Every sync — the fetch's Date header, or NTP — then measures the error left and
+// moves the drift estimate a fraction (1/CLOCK_DRIFT_GAIN) of the way, so the
+// correction converges over a few syncs without chasing the Date header's 1 s
+// granularity.
+//
+// Nothing waits for time: the Date header arrives with the weather anyway, and
+// NTP — only every CLOCK_NTP_WAKES, or when the estimated error since the last
+// sync passes CLOCK_MAX_ERROR_S — runs alongside the fetch and is collected, if
+// it finished, when WiFi goes down.
+
+#define CLOCK_DRIFT_GAIN          4
+#define CLOCK_DRIFT_MIN_BASELINE  300   // s between syncs before the rate is measured
+
+// esp_sntp_stop() replaced the deprecated sntp_stop() in IDF 5.1; Arduino cores
+// on IDF 4.4 only have the old name.
+#if ESP_IDF_VERSION < ESP_IDF_VERSION_VAL(5, 1, 0)
+#define esp_sntp_stop sntp_stop
+#endif
 
-static bool connectWiFi(const char *ssid, const char *password) {
-    Serial.printf("Connecting to WiFi: %s\n", ssid);
+// Model clock: the clock reading + monotonic timer at wake (after the drift
+// correction), re-based at each sync. It reconstructs what the clock read at
+// any instant of this wake had no sync happened since — needed for NTP, whose
+// callback only runs after the clock has already been set.
+static time_t  modelClock  = 0;
+static int64_t modelMonoUs = 0;
+static bool    ntpRunning  = false;
+static volatile bool    ntpDone   = false;
+static volatile time_t  ntpTime   = 0;    // UTC from SNTP...
+static volatile int64_t ntpMonoUs = 0;    // ...at this monotonic instant
+static int64_t ntpStartUs = 0;             // request sent (for the wake trace)
+
+static time_t modelClockAt(int64_t monoUs) {
+    return modelClock + (time_t)((monoUs - modelMonoUs) / 1000000);
+}
 
-    WiFi.disconnect(true);
-    WiFi.mode(WIFI_OFF);
-    delay(100);
+// Estimated worst-case error of the clock right now, in seconds.
+static uint32_t clockErrorBound() {
+    if (clock_sync_epoch == 0) return UINT32_MAX;
+    time_t now = time(nullptr);
+    uint32_t since = (now > (time_t)clock_sync_epoch) ? (uint32_t)(now - clock_sync_epoch) : 0;
+    return 1 + (uint32_t)((uint64_t)since * CLOCK_DRIFT_UNCERTAINTY_PPM / 1000000);
+}
 
-    WiFi.mode(WIFI_STA);
-    WiFi.begin(ssid, password);
+// Whether the clock can be trusted for staleness and error timestamps.
+static bool clockOk() {
+    return clockErrorBound() <= CLOCK_MAX_ERROR_S;
+}
 
-    unsigned long start = millis();
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_TIMEOUT_MS) {
-        delay(500);
-        Serial.print(".");
-        attempts++;
-        if (attempts % 10 == 0) {
-            Serial.printf("\n  WiFi status: %d\n", WiFi.status());
+// Wake start: timezone, then the drift correction for the time since the last
+// sync (less what earlier wakes already applied).
+static void clockBegin() {
+    setenv("TZ", CLOCK_TZ, 1);
+    tzset();
+
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (clock_sync_epoch != 0 && clock_drift_ppm != 0 && tv.tv_sec > (time_t)clock_sync_epoch) {
+        int64_t sinceUs = (int64_t)(tv.tv_sec - clock_sync_epoch) * 1000000 + tv.tv_usec;
+        int64_t wantUs  = sinceUs * clock_drift_ppm / 1000000;
+        int64_t stepUs  = wantUs - clock_applied_us;
+        int64_t t = (int64_t)tv.tv_sec * 1000000 + tv.tv_usec + stepUs;
+        tv.tv_sec  = (time_t)(t / 1000000);
+        tv.tv_usec = (suseconds_t)(t % 1000000);
+        settimeofday(&tv, nullptr);
+        clock_applied_us = wantUs;
+    }
+    modelClock  = time(nullptr);
+    modelMonoUs = esp_timer_get_time();
+}
+
+// `utc` was the true time at monotonic instant `monoUs`. Learns from the error
+// the model clock had then, sets the clock, and re-bases the model.
+static void clockSync(time_t utc, int64_t monoUs, const char *src) {
+    int64_t nowUs = esp_timer_get_time();
+    time_t  utcNow = utc + (time_t)((nowUs - monoUs) / 1000000);
+
+    // Only learn when the sample post-dates the model's base (an NTP reply that
+    // landed before this wake's Date sync is older news) and the baseline is
+    // long enough for a 1 s sample to mean something.
+    if (clock_sync_epoch != 0 && monoUs >= modelMonoUs) {
+        int32_t err   = (int32_t)(utc - modelClockAt(monoUs));
+        int32_t since = (int32_t)(utc - (time_t)clock_sync_epoch);
+        if (since >= CLOCK_DRIFT_MIN_BASELINE) {
+            int32_t residualPpm = (int32_t)((int64_t)err * 1000000 / since);
+            clock_drift_ppm += residualPpm / CLOCK_DRIFT_GAIN;
         }
+        Serial.printf("Clock: %s sync, error %+d s over %d s (drift now %+d ppm)\n",
+                      src, (int)err, (int)since, (int)clock_drift_ppm);
+    } else {
+        Serial.printf("Clock: %s sync\n", src);
     }
-    Serial.println();
 
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.printf("WiFi failed! Status: %d\n", WiFi.status());
-        return false;
+    struct timeval tv = { utcNow, 0 };
+    settimeofday(&tv, nullptr);
+    clock_sync_epoch = (uint32_t)utcNow;
+    clock_applied_us = 0;
+    modelClock  = utcNow;
+    modelMonoUs = nowUs;
+}
+
+// Days since 1970-01-01 for a proleptic Gregorian date (Howard Hinnant's
+// days_from_civil) — timegm() without touching TZ.
+static int32_t daysFromCivil(int y, int m, int d) {
+    y -= m <= 2;
+    const int era = (y >= 0 ? y : y - 399) / 400;
+    const int yoe = y - era * 400;
+    const int doy = (153 * (m + (m > 2 ? -3 : 9)) + 2) / 5 + d - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+// Sets the clock from an HTTP Date header ("Wed, 21 Oct 2015 07:28:00 GMT"),
+// taken as the time the response headers arrived (i.e. now).
+static void clockSyncFromDate(const char *date) {
+    static const char MONTHS[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+    char mon[4] = {0};
+    int d, y, hh, mm, ss;
+    if (!date || sscanf(date, "%*3s, %d %3s %d %d:%d:%d", &d, mon, &y, &hh, &mm, &ss) != 6) {
+        return;
     }
+    const char *mp = strstr(MONTHS, mon);
+    if (!mp || (mp - MONTHS) % 3 != 0) return;
+    int m = (int)(mp - MONTHS) / 3 + 1;
+    time_t utc = (time_t)daysFromCivil(y, m, d) * 86400 + hh * 3600 + mm * 60 + ss;
+    clockSync(utc, esp_timer_get_time(), "Date");
+}
 
-    Serial.printf("Connected! IP: %s, RSSI: %d dBm\n",
-                  WiFi.localIP().toString().c_str(), WiFi.RSSI());
-
-    IPAddress ip = WiFi.localIP();
-    IPAddress gw = WiFi.gatewayIP();
-    IPAddress sn = WiFi.subnetMask();
-    WiFi.config(ip, gw, sn, IPAddress(8,8,8,8), IPAddress(1,1,1,1));
-
-    // NTP sync — needed for staleness calculation. configTime() is async;
-    // we must wait for it to resolve before disconnecting WiFi, otherwise
-    // time() returns a stale value from the last boot and the staleness
-    // calculation drifts further behind on each deep sleep cycle.
-    configTime(0, 0, "pool.ntp.org", "time.nist.gov");
-    // TODO: This timezone must match the Worker's TIMEZONE var in wrangler.toml.
-    // If the Worker is reconfigured for a different timezone, update this POSIX
-    // TZ string to match, otherwise the staleness calculation will be wrong.
-    // See: https://www.gnu.org/software/libc/manual/html_node/TZ-Variable.html
-    setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
-    tzset();
+// SNTP callback (tcpip task): just record the reply; clockFinishNtp() uses it.
+static void onNtpSync(struct timeval *tv) {
+    ntpTime   = tv->tv_sec;
+    ntpMonoUs = esp_timer_get_time();
+    ntpDone   = true;
+}
 
-    Serial.print("Waiting for NTP sync");
-    unsigned long ntpStart = millis();
-    struct tm ti;
-    while (!getLocalTime(&ti, 0) && millis() - ntpStart < 5000) {
-        delay(100);
-        Serial.print(".");
-    }
-    if (getLocalTime(&ti, 0)) {
-        g_ntpSynced = true;
-        Serial.printf(" OK (%lu ms)  %04d-%02d-%02dT%02d:%02d:%02d\n",
-                      millis() - ntpStart,
-                      ti.tm_year + 1900, ti.tm_mon + 1, ti.tm_mday,
-                      ti.tm_hour, ti.tm_min, ti.tm_sec);
+// Starts a background NTP exchange if one is due. Call with WiFi up.
+static void clockStartNtpIfDue() {
+    bool due = (clock_ntp_boot == 0)
+            || (boot_count - clock_ntp_boot >= CLOCK_NTP_WAKES)
+            || !clockOk();
+    if (!due) return;
+    Serial.println("Clock: NTP due — syncing in the background");
+    ntpDone = false;
+    ntpStartUs = esp_timer_get_time();
+    sntp_set_time_sync_notification_cb(onNtpSync);
+    configTzTime(CLOCK_TZ, "pool.ntp.org", "time.nist.gov");
+    ntpRunning = true;
+}
+
+// Collects the NTP result if it arrived, and stops SNTP. Call before WiFi goes
+// down. If NTP didn't finish in time it's simply tried again next wake.
+static void clockFinishNtp() {
+    if (!ntpRunning) return;
+    esp_sntp_stop();
+    ntpRunning = false;
+    if (ntpDone) {
+        traceAdd(TP_NTP, (uint32_t)((ntpMonoUs - ntpStartUs) / 1000));
+        clockSync(ntpTime, ntpMonoUs, "NTP");
+        clock_ntp_boot = boot_count;
+    } else {
+        Serial.println("Clock: NTP didn't finish this wake");
+    }
+}
+
+// ─── WiFi ────────────────────────────────────────────────────────────────────
+
+static uint32_t wifiCredHash(const char *ssid, const char *password) {
+    uint32_t h = hashBytes(HASH_SEED, (const uint8_t *)ssid, strlen(ssid));
+    h = hashBytes(h, (const uint8_t *)"\n", 1);
+    h = hashBytes(h, (const uint8_t *)password, strlen(password));
+    return h ? h : 1;  // 0 marks an empty cache
+}
+
+// Forget the cached AP + lease: the next connect scans and runs DHCP.
+static void wifiCacheInvalidate() {
+    wifi_cache.credHash = 0;
+}
+
+// When the station associated (WiFi.status() only reports WL_CONNECTED once it
+// also has an IP), so the trace can split association from DHCP.
+static volatile unsigned long g_wifiAssocAt = 0;
+
+static void onWiFiAssociated(arduino_event_id_t) {
+    g_wifiAssocAt = millis();
+}
+
+// Polls for association every 20 ms (not 500 — on the fast path the whole
+// thing takes a few hundred ms) until connected or `timeoutMs` elapses.
+static bool waitForWiFi(unsigned long timeoutMs) {
+    static bool hooked = false;
+    if (!hooked) {
+        WiFi.onEvent(onWiFiAssociated, ARDUINO_EVENT_WIFI_STA_CONNECTED);
+        hooked = true;
+    }
+    unsigned long start = millis();
+    g_wifiAssocAt = 0;
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs) {
+        delay(20);
+    }
+    bool ok = WiFi.status() == WL_CONNECTED;
+    unsigned long now = millis(), assoc = g_wifiAssocAt;
+    if (assoc && assoc - start <= now - start) {
+        traceAdd(TP_ASSOC, assoc - start);
+        traceAdd(TP_DHCP, ok ? now - assoc : 0);
     } else {
-        g_ntpSynced = false;
-        Serial.printf(" TIMEOUT after %lu ms — staleness may be inaccurate\n",
-                      millis() - ntpStart);
+        traceAdd(TP_ASSOC, now - start);  // never associated (or no event seen)
+    }
+    return ok;
+}
+
+// Joins the network. Normally the fast path: straight to the cached BSSID on its
+// channel (no scan) with the cached address configured statically (no DHCP).
+// Falls back to the full path — scan, associate, DHCP — when there's no cache
+// for these credentials, the lease is due a refresh, or the fast association
+// doesn't complete; the full path then refreshes the cache.
+static bool connectWiFi(const char *ssid, const char *password) {
+    Serial.printf("Connecting to WiFi: %s\n", ssid);
+    unsigned long t0 = millis();
+    g_wifiFast = false;
+    energyRadio(true);
+
+    // After deep sleep the radio is already off; only tear down a live session
+    // (e.g. the debug pass reconnecting), and don't let begin() write the
+    // credentials to flash on every wake.
+    if (WiFi.getMode() != WIFI_OFF) {
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+    }
+    WiFi.persistent(false);
+    WiFi.mode(WIFI_STA);
+
+    uint32_t credHash = wifiCredHash(ssid, password);
+    bool haveCache = (wifi_cache.credHash == credHash);
+    if (haveCache && wifi_cache.wakesSinceDhcp < WIFI_DHCP_REFRESH_WAKES) {
+        WiFi.config(IPAddress(wifi_cache.ip), IPAddress(wifi_cache.gateway),
+                    IPAddress(wifi_cache.netmask),
+                    IPAddress(wifi_cache.dns1), IPAddress(wifi_cache.dns2));
+        WiFi.begin(ssid, password, wifi_cache.channel, wifi_cache.bssid, true);
+        if (waitForWiFi(WIFI_FAST_TIMEOUT_MS)) {
+            g_wifiFast = true;
+            traceFlag(TF_WIFI_FAST);
+            wifi_cache.wakesSinceDhcp++;
+        } else {
+            // AP moved channel, was replaced, or is down: forget it and scan.
+            Serial.printf("Fast reconnect failed (status %d) — full scan + DHCP\n",
+                          WiFi.status());
+            wifiCacheInvalidate();
+            WiFi.disconnect(true);
+            WiFi.mode(WIFI_OFF);
+            WiFi.mode(WIFI_STA);
+        }
+    } else if (haveCache) {
+        Serial.println("Lease refresh due — full scan + DHCP");
+    }
+
+    if (!g_wifiFast) {
+        // Full path. Clear any static config left by a failed fast attempt so
+        // DHCP runs.
+        WiFi.config(IPAddress(), IPAddress(), IPAddress());
+        WiFi.begin(ssid, password);
+        if (!waitForWiFi(WIFI_TIMEOUT_MS)) {
+            Serial.printf("WiFi failed! Status: %d\n", WiFi.status());
+            return false;
+        }
+
+        // Pin the resolvers (as before), then remember the AP + lease for the
+        // next wake's fast path.
+        IPAddress ip = WiFi.localIP();
+        IPAddress gw = WiFi.gatewayIP();
+        IPAddress sn = WiFi.subnetMask();
+        IPAddress dns1(8,8,8,8), dns2(1,1,1,1);
+        WiFi.config(ip, gw, sn, dns1, dns2);
+
+        wifi_cache.credHash = credHash;
+        memcpy(wifi_cache.bssid, WiFi.BSSID(), sizeof(wifi_cache.bssid));
+        wifi_cache.channel        = WiFi.channel();
+        wifi_cache.ip             = (uint32_t)ip;
+        wifi_cache.gateway        = (uint32_t)gw;
+        wifi_cache.netmask        = (uint32_t)sn;
+        wifi_cache.dns1           = (uint32_t)dns1;
+        wifi_cache.dns2           = (uint32_t)dns2;
+        wifi_cache.wakesSinceDhcp = 0;
     }
 
+    Serial.printf("Connected (%s) in %lu ms! IP: %s, ch %d, RSSI: %d dBm\n",
+                  g_wifiFast ? "fast: cached AP + lease" : "scan + DHCP",
+                  millis() - t0, WiFi.localIP().toString().c_str(),
+                  (int)WiFi.channel(), WiFi.RSSI());
+
+    // Time sync doesn't hold up the fetch: the response's Date header sets the
+    // clock, and NTP (when due) runs in the background meanwhile.
+    clockStartNtpIfDue();
+
     return true;
 }
 
 static void disconnectWiFi() {
+    clockFinishNtp();
     WiFi.disconnect(true);
     WiFi.mode(WIFI_OFF);
+    energyRadio(false);
 }
 
 // ─── device identity ─────────────────────────────────────────────────────────
@@ -388,46 +879,574 @@ static void deviceId(char *buf, size_t bufSize) {
     snprintf(buf, bufSize, "%012llx", ESP.getEfuseMac());
 }
 
+// ─── delta OTA ───────────────────────────────────────────────────────────────
+// Most releases reach the device as a patch against the firmware it's running
+// (delta_patch.h): the worker serves /firmware/patch/{from}/{to} when
+// ota-publish.sh made one for that pair, typically a fraction of the full image.
+// The patch streams from the response and is applied on the fly — source bytes
+// read from the running slot, the new image written to the inactive one — and
+// the result must hash to the patch's target SHA-256 before otadata flips.
+// Anything short of that (no patch, a running image that isn't byte-for-byte
+// the one the patch was made against, a truncated or corrupt patch) falls back
+// to the full image, downloaded in slices (see "OTA firmware update").
+
+#define DELTA_BUF_BYTES  1024
+#define OTA_STALL_MS     15000   // give up if no bytes (patch or image) arrive for this long
+
+struct DeltaCtx {
+    WiFiClient             *client;
+    const esp_partition_t  *running;
+    mbedtls_sha256_context  sha;       // over the target as it's written
+    uint8_t                 buf[DELTA_BUF_BYTES];  // patch read-ahead
+    uint32_t                bufLen, bufPos;
+    uint32_t                received;  // patch bytes off the wire
+    bool                    flashFailed;
+};
+
+static bool deltaReadPatch(void *ctx, uint8_t *dst, uint32_t n) {
+    DeltaCtx &d = *(DeltaCtx *)ctx;
+    unsigned long lastByte = millis();
+    while (n) {
+        if (d.bufPos < d.bufLen) {
+            uint32_t k = min(n, d.bufLen - d.bufPos);
+            memcpy(dst, d.buf + d.bufPos, k);
+            d.bufPos += k;
+            dst      += k;
+            n        -= k;
+            continue;
+        }
+        int avail = d.client->available();
+        if (avail > 0) {
+            int got = d.client->readBytes(d.buf, min(avail, DELTA_BUF_BYTES));
+            d.bufLen    = got > 0 ? got : 0;
+            d.bufPos    = 0;
+            d.received += d.bufLen;
+            lastByte    = millis();
+        } else if (!d.client->connected() || millis() - lastByte >= OTA_STALL_MS) {
+            return false;
+        } else {
+            delay(1);
+        }
+    }
+    return true;
+}
+
+static bool deltaReadSource(void *ctx, uint32_t off, uint8_t *buf, uint32_t n) {
+    DeltaCtx &d = *(DeltaCtx *)ctx;
+    return esp_partition_read(d.running, off, buf, n) == ESP_OK;
+}
+
+static bool deltaWriteTarget(void *ctx, const uint8_t *buf, uint32_t n) {
+    DeltaCtx &d = *(DeltaCtx *)ctx;
+    mbedtls_sha256_update(&d.sha, buf, n);
+    if (Update.write((uint8_t *)buf, n) != n) {
+        d.flashFailed = true;
+        return false;
+    }
+    return true;
+}
+
+// True if the first `size` bytes of `part` hash to `sha`. (For the running
+// slot this can legitimately fail on a device flashed over USB, which
+// rewrites header bytes.)
+static bool partitionHashIs(const esp_partition_t *part, uint32_t size, const uint8_t *sha) {
+    static uint8_t chunk[DELTA_BUF_BYTES];
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    bool ok = true;
+    for (uint32_t off = 0; off < size && ok; off += DELTA_BUF_BYTES) {
+        uint32_t n = min((uint32_t)DELTA_BUF_BYTES, size - off);
+        ok = esp_partition_read(part, off, chunk, n) == ESP_OK;
+        mbedtls_sha256_update(&ctx, chunk, n);
+    }
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&ctx, digest);
+    mbedtls_sha256_free(&ctx);
+    return ok && memcmp(digest, sha, 32) == 0;
+}
+
+// Updates to `latestVersion` from a patch. False if there's no usable patch
+// (the caller falls back to the sliced full image); on success reboots and
+// never returns.
+static bool applyDeltaUpdate(int latestVersion) {
+    String url = String(SERVER_BASE_URL) + "/firmware/patch/" + FIRMWARE_VERSION
+               + "/" + latestVersion;
+    ResumableTlsClient client;
+    HTTPClient http;
+    http.begin(client, url);
+    http.setTimeout(10000);
+    int code = http.GET();
+    if (code != 200) {
+        Serial.printf("OTA: no patch v%d → v%d (HTTP %d)\n",
+                      FIRMWARE_VERSION, latestVersion, code);
+        http.end();
+        return false;
+    }
+
+    static DeltaCtx d;  // 1 KB of read-ahead — keep it off the stack
+    d.client      = http.getStreamPtr();
+    d.running     = esp_ota_get_running_partition();
+    d.bufLen      = d.bufPos = d.received = 0;
+    d.flashFailed = false;
+    const delta::Io io = { &d, deltaReadPatch, deltaReadSource, deltaWriteTarget };
+
+    delta::Header h;
+    if (!delta::readHeader(io, h) || h.sourceSize > d.running->size) {
+        Serial.println("OTA: patch header invalid");
+        http.end();
+        return false;
+    }
+    if (!partitionHashIs(d.running, h.sourceSize, h.sourceSha)) {
+        Serial.println("OTA: running image isn't the patch's source");
+        http.end();
+        return false;
+    }
+    if (!Update.begin(h.targetSize)) {
+        Serial.printf("OTA: Update.begin(%u) failed: %s\n",
+                      (unsigned)h.targetSize, Update.errorString());
+        http.end();
+        return false;
+    }
+
+    unsigned long t0 = millis();
+    mbedtls_sha256_init(&d.sha);
+    mbedtls_sha256_starts(&d.sha, 0);
+    bool ok = delta::apply(io, h);
+    uint8_t digest[32];
+    mbedtls_sha256_finish(&d.sha, digest);
+    mbedtls_sha256_free(&d.sha);
+    http.end();
+
+    if (!ok || memcmp(digest, h.targetSha, 32) != 0) {
+        Serial.printf("OTA: patch %s after %u bytes\n",
+                      !ok ? (d.flashFailed ? "flash write failed" : "apply failed")
+                          : "result hash mismatch",
+                      (unsigned)d.received);
+        Update.abort();
+        return false;
+    }
+    if (!Update.end(true)) {
+        Serial.printf("OTA: finishing the patched image failed: %s\n", Update.errorString());
+        return false;
+    }
+    Serial.printf("OTA: v%d rebuilt from a %u-byte patch (image %u bytes) in %lu ms "
+                  "— rebooting.\n", latestVersion, (unsigned)d.received,
+                  (unsigned)h.targetSize, millis() - t0);
+    Serial.flush();
+    ESP.restart();
+    return true;  // not reached
+}
+
 // ─── OTA firmware update ─────────────────────────────────────────────────────
-// Downloads firmware version `latestVersion` from the worker and flashes it into
-// the inactive OTA slot. Must be called with WiFi up. On success the chip reboots
-// into the new slot and this never returns; returns false on failure so the
-// caller can record the bad version and avoid re-downloading it every wake.
+// Without a patch, the full image comes down in OTA_SLICE_BYTES slices, one per
+// wake, as HTTP Range requests straight into the inactive slot — so an update
+// adds a bounded couple of seconds to a handful of wakes instead of tens of
+// seconds to one, and a WiFi drop only loses the sector in flight. Progress
+// (version, bytes written, size and SHA-256 of the image) lives in NVS, so it
+// survives resets as well as deep sleep; only whole 4 KB sectors count as
+// written, so a resumed slice always starts on a sector it can erase. When the
+// last slice lands, the slot is read back and must hash to the worker's
+// X-Firmware-Sha256 before otadata flips. A changed SHA mid-download (the
+// version was republished) starts over.
+//
+// The image is fetched compressed when the worker has it that way
+// (/firmware/{v}.wfz, ota_image.h — typically 40-50% fewer bytes over the air):
+// each 64 KB block is inflated in PSRAM with the ROM's tinfl and written out,
+// and a slice ends on a block boundary, so the compressed offset to resume at
+// is just another field of the progress record. A 404 falls back to the plain
+// .bin, which a download then sticks with.
 //
 // Discovery is free: the worker advertises the latest available version on every
 // weather response (X-Firmware-Latest, captured by fetchPng), so there's no
 // separate version-check request or once-a-day throttle.
-static bool applyOtaUpdate(int latestVersion) {
-    String url = String(SERVER_BASE_URL) + "/firmware/" + latestVersion + ".bin";
-    Serial.printf("OTA: v%d > v%d — downloading %s\n",
-                  latestVersion, FIRMWARE_VERSION, url.c_str());
-
-    WiFiClientSecure secureClient;
-    secureClient.setInsecure();
-
-    t_httpUpdate_return ret =
-        httpUpdate.update(secureClient, url, String(FIRMWARE_VERSION));
-
-    switch (ret) {
-        case HTTP_UPDATE_OK:
-            // The image is flashed into the inactive slot and otadata flipped;
-            // the chip normally reboots itself. Force it if it didn't.
-            Serial.println("OTA: update OK — rebooting into new firmware.");
-            Serial.flush();
-            ESP.restart();
-            return true;  // not reached
-        case HTTP_UPDATE_NO_UPDATES:
-            Serial.println("OTA: server reported no update.");
-            g_otaError = 0;
-            return false;
-        case HTTP_UPDATE_FAILED:
-        default:
-            Serial.printf("OTA: update FAILED (%d): %s\n",
-                          httpUpdate.getLastError(),
-                          httpUpdate.getLastErrorString().c_str());
-            g_otaError = httpUpdate.getLastError();
+
+#define OTA_SLICE_BYTES  (256 * 1024)  // image bytes per wake; a multiple of OTA_SECTOR
+#define OTA_SECTOR       4096
+
+enum OtaResult { OTA_FAILED, OTA_IN_PROGRESS };
+
+// g_otaError for failures that aren't an HTTP status.
+enum : int {
+    OTA_ERR_TRANSPORT = -1,  // connection / stall / bad Range reply
+    OTA_ERR_FLASH     = -2,  // erase or write failed
+    OTA_ERR_VERIFY    = -3,  // assembled image doesn't match its SHA-256
+    OTA_ERR_ACTIVATE  = -4,  // esp_ota_set_boot_partition refused the image
+    OTA_ERR_SIZE      = -5,  // image larger than the slot
+    OTA_ERR_FORMAT    = -6,  // compressed image: bad header, or a block that won't inflate
+    OTA_ERR_MEMORY    = -7,  // no PSRAM for the inflate buffers
+};
+
+struct OtaProgress {
+    int32_t  version;
+    uint32_t offset;     // image bytes in the slot so far (a multiple of OTA_SECTOR)
+    uint32_t size;       // whole image
+    uint8_t  sha[32];    // of the whole image, per the worker
+    uint32_t blockSize;  // compressed download: its block size; 0 = plain .bin
+    uint32_t zOffset;    // compressed download: bytes of the .wfz consumed
+    uint32_t zSize;      // compressed download: whole .wfz
+};
+
+static bool otaLoadProgress(OtaProgress &p) {
+    Preferences prefs;
+    if (!prefs.begin("ota", /*readOnly=*/true)) return false;
+    bool ok = prefs.getBytes("prog", &p, sizeof(p)) == sizeof(p);
+    prefs.end();
+    return ok && p.version > FIRMWARE_VERSION;  // older = already installed
+}
+
+static void otaSaveProgress(const OtaProgress &p) {
+    Preferences prefs;
+    if (!prefs.begin("ota", /*readOnly=*/false)) return;
+    prefs.putBytes("prog", &p, sizeof(p));
+    prefs.end();
+}
+
+static void otaClearProgress() {
+    Preferences prefs;
+    if (!prefs.begin("ota", /*readOnly=*/false)) return;
+    prefs.remove("prog");
+    prefs.end();
+}
+
+// Percent of `version` downloaded so far, or -1 if no download is under way.
+static int otaProgressPercent(int version) {
+    OtaProgress p;
+    if (!otaLoadProgress(p) || p.version != version || p.size == 0) return -1;
+    return (int)((uint64_t)p.offset * 100 / p.size);
+}
+
+static bool parseSha256Hex(const String &hex, uint8_t *out) {
+    if (hex.length() != 64) return false;
+    for (int i = 0; i < 32; i++) {
+        char byte[3] = { hex[2 * i], hex[2 * i + 1], '\0' };
+        char *end;
+        out[i] = (uint8_t)strtoul(byte, &end, 16);
+        if (*end) return false;
+    }
+    return true;
+}
+
+// What a Range GET came back with. start/total are from Content-Range (or 0 and
+// the body length for a 200); hasSha if X-Firmware-Sha256 parsed.
+struct OtaReply {
+    int      code;
+    uint32_t start, total;
+    bool     hasSha;
+    uint8_t  sha[32];
+};
+
+static OtaReply otaGet(HTTPClient &http, WiFiClient &client, const String &url, const char *range) {
+    http.begin(client, url);
+    http.setTimeout(10000);
+    http.addHeader("Range", range);
+    const char *headerKeys[] = {"Content-Range", "X-Firmware-Sha256"};
+    http.collectHeaders(headerKeys, 2);
+    OtaReply r = {};
+    r.code = http.GET();
+    if (r.code == 206) {
+        unsigned a, b, t;
+        if (sscanf(http.header("Content-Range").c_str(), "bytes %u-%u/%u", &a, &b, &t) == 3) {
+            r.start = a;
+            r.total = t;
+        }
+    } else if (r.code == 200) {
+        r.total = http.getSize() > 0 ? (uint32_t)http.getSize() : 0;
+    }
+    r.hasSha = parseSha256Hex(http.header("X-Firmware-Sha256"), r.sha);
+    return r;
+}
+
+// Reads exactly n bytes; false if the stream ends or stalls first.
+static bool otaReadFull(WiFiClient *stream, uint8_t *buf, uint32_t n) {
+    uint32_t have = 0;
+    unsigned long lastByte = millis();
+    while (have < n) {
+        int avail = stream->available();
+        if (avail > 0) {
+            have += stream->readBytes(buf + have, min((uint32_t)avail, n - have));
+            lastByte = millis();
+        } else if (!stream->connected() || millis() - lastByte >= OTA_STALL_MS) {
             return false;
+        } else {
+            delay(1);
+        }
+    }
+    return true;
+}
+
+// Erases the sectors under [off, off + n) and writes buf there.
+static bool otaFlash(const esp_partition_t *slot, uint32_t off, const uint8_t *buf, uint32_t n) {
+    uint32_t span = (n + OTA_SECTOR - 1) / OTA_SECTOR * OTA_SECTOR;
+    return esp_partition_erase_range(slot, off, span) == ESP_OK
+        && esp_partition_write(slot, off, buf, n) == ESP_OK;
+}
+
+// After a slice: saves progress, and if the image is complete verifies it and
+// reboots into it. `before` is p.offset when the slice began.
+static OtaResult otaEndSlice(const esp_partition_t *slot, const OtaProgress &p, uint32_t before,
+                             unsigned long t0, bool flashOk) {
+    otaSaveProgress(p);
+    Serial.printf("OTA: +%u bytes in %lu ms — %u / %u (%u%%)\n",
+                  (unsigned)(p.offset - before), millis() - t0, (unsigned)p.offset,
+                  (unsigned)p.size, (unsigned)((uint64_t)p.offset * 100 / p.size));
+
+    if (!flashOk) {
+        g_otaError = OTA_ERR_FLASH;
+        return OTA_FAILED;
+    }
+    if (p.offset < p.size) {
+        if (p.offset > before) return OTA_IN_PROGRESS;
+        g_otaError = OTA_ERR_TRANSPORT;
+        return OTA_FAILED;
+    }
+
+    // Last slice: verify the assembled image, then activate it.
+    otaClearProgress();
+    if (!partitionHashIs(slot, p.size, p.sha)) {
+        Serial.println("OTA: assembled image fails its SHA-256");
+        g_otaError = OTA_ERR_VERIFY;
+        return OTA_FAILED;
+    }
+    if (esp_ota_set_boot_partition(slot) != ESP_OK) {
+        Serial.println("OTA: slot rejected as a boot image");
+        g_otaError = OTA_ERR_ACTIVATE;
+        return OTA_FAILED;
+    }
+    Serial.println("OTA: update OK — rebooting into new firmware.");
+    Serial.flush();
+    ESP.restart();
+    return OTA_IN_PROGRESS;  // not reached
+}
+
+// Downloads the next slice of the compressed image into the slot. False if the
+// worker has no compressed image of this version (fall back to the .bin);
+// otherwise `result` is as for otaDownloadSlice().
+static bool otaDownloadBlocks(OtaProgress &p, OtaResult &result) {
+    const esp_partition_t *slot = esp_ota_get_next_update_partition(nullptr);
+    String url = String(SERVER_BASE_URL) + "/firmware/" + p.version + ".wfz";
+    // How much of it a slice needs depends on how well it compressed, so ask for
+    // the most it can take: every block stored at its worst, plus prefixes (and
+    // the header, first time, when the block size isn't known yet — assume the
+    // smallest). A block the range cuts off is fetched again next wake, as after
+    // a stall.
+    uint32_t blockSize = p.zOffset == 0 ? OTA_SECTOR : p.blockSize;
+    uint32_t blocks    = (OTA_SLICE_BYTES + blockSize - 1) / blockSize;
+    uint32_t zEnd      = p.zOffset + (p.zOffset == 0 ? otaimg::HEADER_SIZE : 0)
+                       + blocks * (4 + blockSize + otaimg::BLOCK_SLACK);
+    char range[48];
+    snprintf(range, sizeof(range), "bytes=%u-%u", (unsigned)p.zOffset, (unsigned)(zEnd - 1));
+    Serial.printf("OTA: v%d > v%d — %s (%s)\n", p.version, FIRMWARE_VERSION, url.c_str(), range);
+
+    ResumableTlsClient client;  // resumes the weather fetch's TLS session
+    HTTPClient http;
+    OtaReply r = otaGet(http, client, url, range);
+    if (r.code == 404) {
+        http.end();
+        if (p.offset > 0) {  // was compressed when the download began: start over
+            Serial.printf("OTA: v%d no longer compressed — starting over\n", p.version);
+            otaClearProgress();
+            int32_t version = p.version;
+            memset(&p, 0, sizeof(p));
+            p.version = version;
+        }
+        return false;
+    }
+    result = OTA_FAILED;
+    if (r.code != 206 && !(r.code == 200 && p.zOffset == 0)) {
+        Serial.printf("OTA: HTTP %d\n", r.code);
+        g_otaError = r.code > 0 ? r.code : OTA_ERR_TRANSPORT;
+        http.end();
+        return true;
+    }
+    if (r.start != p.zOffset || r.total == 0 || !r.hasSha) {
+        Serial.println("OTA: unusable reply (range / size / SHA-256)");
+        g_otaError = OTA_ERR_TRANSPORT;
+        http.end();
+        return true;
+    }
+    if (p.offset > 0 && (r.total != p.zSize || memcmp(r.sha, p.sha, 32) != 0)) {
+        Serial.printf("OTA: v%d changed since the download began — starting over\n", p.version);
+        otaClearProgress();
+        http.end();
+        result = OTA_IN_PROGRESS;
+        return true;
+    }
+
+    WiFiClient *stream = http.getStreamPtr();
+    otaimg::Header h;
+    if (p.zOffset == 0) {
+        uint8_t raw[otaimg::HEADER_SIZE];
+        if (!otaReadFull(stream, raw, sizeof(raw))) {
+            g_otaError = OTA_ERR_TRANSPORT;
+            http.end();
+            return true;
+        }
+        if (!otaimg::parseHeader(raw, h) || memcmp(h.sha, r.sha, 32) != 0) {
+            Serial.println("OTA: compressed image header invalid");
+            g_otaError = OTA_ERR_FORMAT;
+            http.end();
+            return true;
+        }
+        if (h.imageSize > slot->size) {
+            Serial.printf("OTA: image %u bytes > slot %u\n", (unsigned)h.imageSize,
+                          (unsigned)slot->size);
+            g_otaError = OTA_ERR_SIZE;
+            http.end();
+            return true;
+        }
+        p.size      = h.imageSize;
+        p.blockSize = h.blockSize;
+        p.zOffset   = otaimg::HEADER_SIZE;
+        p.zSize     = r.total;
+        memcpy(p.sha, h.sha, 32);
+    } else {
+        h.imageSize  = p.size;
+        h.blockSize  = p.blockSize;
+        h.blockCount = (p.size + p.blockSize - 1) / p.blockSize;
+        memcpy(h.sha, p.sha, 32);
+    }
+
+    // Inflate buffers live in PSRAM for the rest of the wake; the decompressor
+    // state alone is ~11 KB.
+    static tinfl_decompressor *inflater = nullptr;
+    static uint8_t *zbuf = nullptr, *obuf = nullptr;
+    if (!inflater) inflater = (tinfl_decompressor *)ps_malloc(sizeof(tinfl_decompressor));
+    if (!zbuf)     zbuf     = (uint8_t *)ps_malloc(otaimg::MAX_BLOCK + otaimg::BLOCK_SLACK);
+    if (!obuf)     obuf     = (uint8_t *)ps_malloc(otaimg::MAX_BLOCK);
+    if (!inflater || !zbuf || !obuf) {
+        Serial.println("OTA: no PSRAM for the inflate buffers");
+        g_otaError = OTA_ERR_MEMORY;
+        http.end();
+        return true;
+    }
+
+    // Block by block: read it whole, inflate, erase + write its sectors, count.
+    // A block cut off mid-stream is dropped and fetched again next wake.
+    uint32_t sliceEnd = min(p.offset + (uint32_t)OTA_SLICE_BYTES, p.size);
+    uint32_t before   = p.offset;
+    uint32_t zBefore  = p.zOffset;
+    unsigned long t0  = millis();
+    bool flashOk = true, formatOk = true;
+    while (p.offset < sliceEnd) {
+        uint32_t index = p.offset / h.blockSize;
+        uint32_t len   = otaimg::blockLength(h, index);
+        uint8_t  prefix[4];
+        uint32_t stored;
+        bool     isRaw;
+        if (!otaReadFull(stream, prefix, 4)) break;
+        if (!otaimg::parseBlockPrefix(h, index, otaimg::le32(prefix), stored, isRaw)) {
+            formatOk = false;
+            break;
+        }
+        if (!otaReadFull(stream, isRaw ? obuf : zbuf, stored)) break;
+        if (!isRaw) {
+            tinfl_init(inflater);
+            size_t inLen = stored, outLen = len;
+            tinfl_status st = tinfl_decompress(inflater, zbuf, &inLen, obuf, obuf, &outLen,
+                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+            if (st != TINFL_STATUS_DONE || outLen != len) {
+                formatOk = false;
+                break;
+            }
+        }
+        if (!(flashOk = otaFlash(slot, p.offset, obuf, len))) break;
+        p.offset  += len;
+        p.zOffset += 4 + stored;
     }
+    http.end();
+    Serial.printf("OTA: %u compressed bytes → %u\n", (unsigned)(p.zOffset - zBefore),
+                  (unsigned)(p.offset - before));
+    if (!formatOk) {
+        // The same bytes would fail again next wake: start over after the cooldown.
+        Serial.printf("OTA: block %u of v%d is corrupt\n", (unsigned)(p.offset / h.blockSize),
+                      p.version);
+        otaClearProgress();
+        g_otaError = OTA_ERR_FORMAT;
+        return true;
+    }
+    result = otaEndSlice(slot, p, before, t0, flashOk);
+    return true;
+}
+
+// Downloads the next slice of the plain image into the slot, activating it if
+// it was the last. Reboots on activation; otherwise OTA_IN_PROGRESS if this
+// wake added to the slot, OTA_FAILED (with g_otaError) if it couldn't.
+static OtaResult otaDownloadSlice(OtaProgress &p) {
+    const esp_partition_t *slot = esp_ota_get_next_update_partition(nullptr);
+    String url = String(SERVER_BASE_URL) + "/firmware/" + p.version + ".bin";
+    char range[48];
+    snprintf(range, sizeof(range), "bytes=%u-%u",
+             (unsigned)p.offset, (unsigned)(p.offset + OTA_SLICE_BYTES - 1));
+    Serial.printf("OTA: v%d > v%d — %s (%s)\n", p.version, FIRMWARE_VERSION, url.c_str(), range);
+
+    ResumableTlsClient client;  // resumes the weather fetch's TLS session
+    HTTPClient http;
+    OtaReply r = otaGet(http, client, url, range);
+
+    // 206 for our range; a server ignoring Range sends the whole image with
+    // 200, which is only usable from the start.
+    if (r.code != 206 && !(r.code == 200 && p.offset == 0)) {
+        Serial.printf("OTA: HTTP %d\n", r.code);
+        g_otaError = r.code > 0 ? r.code : OTA_ERR_TRANSPORT;
+        http.end();
+        return OTA_FAILED;
+    }
+    if (r.start != p.offset || r.total == 0 || !r.hasSha) {
+        Serial.println("OTA: unusable reply (range / size / SHA-256)");
+        g_otaError = OTA_ERR_TRANSPORT;
+        http.end();
+        return OTA_FAILED;
+    }
+    if (r.total > slot->size) {
+        Serial.printf("OTA: image %u bytes > slot %u\n", (unsigned)r.total, (unsigned)slot->size);
+        g_otaError = OTA_ERR_SIZE;
+        http.end();
+        return OTA_FAILED;
+    }
+    if (p.offset > 0 && (r.total != p.size || memcmp(r.sha, p.sha, 32) != 0)) {
+        Serial.printf("OTA: v%d changed since the download began — starting over\n", p.version);
+        otaClearProgress();
+        http.end();
+        return OTA_IN_PROGRESS;
+    }
+    p.size = r.total;
+    memcpy(p.sha, r.sha, 32);
+
+    // Sector by sector: erase, fill from the stream, write, count.
+    static uint8_t sector[OTA_SECTOR];
+    WiFiClient *stream = http.getStreamPtr();
+    uint32_t sliceEnd = min(p.offset + (uint32_t)OTA_SLICE_BYTES, p.size);
+    uint32_t before   = p.offset;
+    unsigned long t0  = millis();
+    bool flashOk = true;
+    while (p.offset < sliceEnd && flashOk) {
+        uint32_t want = min((uint32_t)OTA_SECTOR, p.size - p.offset);
+        if (!otaReadFull(stream, sector, want)) break;  // interrupted: keep the sectors already written
+        flashOk = otaFlash(slot, p.offset, sector, want);
+        if (flashOk) p.offset += want;
+    }
+    http.end();
+    return otaEndSlice(slot, p, before, t0, flashOk);
+}
+
+// Moves the update to `latestVersion` on by one wake's worth. Tries a patch
+// first (see "delta OTA") unless a sliced download of this version is already
+// under way, then the compressed image unless a plain one is. Must be called
+// with WiFi up. Reboots into the new slot once the image is complete;
+// OTA_FAILED tells the caller to record the version and cool down rather than
+// retry every wake.
+static OtaResult applyOtaUpdate(int latestVersion) {
+    TraceScope trace(TP_OTA);
+    OtaProgress p;
+    if (!otaLoadProgress(p) || p.version != latestVersion) {
+        memset(&p, 0, sizeof(p));
+        p.version = latestVersion;
+    }
+    if (p.offset == 0 && applyDeltaUpdate(latestVersion)) return OTA_IN_PROGRESS;  // not reached: it reboots
+    OtaResult result;
+    if ((p.offset == 0 || p.blockSize != 0) && otaDownloadBlocks(p, result)) return result;
+    return otaDownloadSlice(p);
 }
 
 // ─── battery ─────────────────────────────────────────────────────────────────
@@ -448,6 +1467,7 @@ static void calibrateADC() {
 // rail by tens of mV (≈1% of a cell's usable range per 12 mV).
 static int readBatteryMillivolts() {
     // EPD must be powered on for BATT_PIN ADC to read correctly.
+    ensureEpd();
     epd_poweron();
     delay(10);
     const int N = 16;
@@ -461,6 +1481,28 @@ static int readBatteryMillivolts() {
     return (int)(voltage * 1000.0f);
 }
 
+// The battery reading for this wake: a fresh sample if the display is already
+// up (the EPD power-on is then nearly free) or the cached one has aged out,
+// else the cached sample — so a wake that doesn't repaint never brings the EPD
+// up just to read the ADC. The pack sags by a few mV an hour; a reading a few
+// wakes old is well inside the ADC noise the averaging fights anyway.
+// Fresh samples also feed the energy model and the discharge log.
+static int batteryMillivolts() {
+    bool stale = (batt_sample_boot == 0)
+              || (boot_count - batt_sample_boot >= BATTERY_SAMPLE_WAKES);
+    if (stale || epdReady) {
+        batt_mv_cached   = readBatteryMillivolts();
+        batt_sample_boot = boot_count;
+        energyNoteVoltage(batt_mv_cached);
+        bool wifiUp = WiFi.status() == WL_CONNECTED;
+        battLogAppend(batt_mv_cached, wifiUp ? WiFi.RSSI() : 0,
+                      (wifiUp ? BL_WIFI : 0) | ((traceFlags() & TF_DISPLAY) ? BL_EPD : 0));
+    } else {
+        Serial.printf("Battery: cached sample from boot #%u\n", (unsigned)batt_sample_boot);
+    }
+    return batt_mv_cached;
+}
+
 // Hysteretic low-battery state: trips at BATTERY_LOW_MV, clears at BATTERY_OK_MV.
 // Latched in RTC so it survives deep sleep and only flips on a genuine
 // charge/discharge crossing, not on per-wake measurement jitter.
@@ -548,6 +1590,73 @@ static void logError(uint8_t kind, int16_t detail) {
     wakeHadError = true;
 }
 
+// ─── retry policy ────────────────────────────────────────────────────────────
+// How soon to try again after a failed wake depends on why it failed. Each
+// class backs off exponentially from its base to its cap while it keeps
+// failing, with "equal jitter" (half the delay fixed, half random) so a fleet
+// knocked offline by the same worker outage doesn't come back in lockstep.
+// A success, or a different class of failure, starts over.
+
+enum RetryClass : uint8_t {
+    RC_NONE = 0,
+    RC_WIFI,       // no WiFi: the local network, nothing the server can fix
+    RC_TRANSIENT,  // DNS / TCP / TLS / timeout / truncated download
+    RC_SERVER,     // HTTP 5xx or 429: the worker is down or shedding load
+    RC_CLIENT,     // other HTTP 4xx (e.g. zip removed): won't fix itself soon
+    RC_CONTENT,    // empty response or a frame that won't decode
+    RC_COUNT
+};
+
+static const struct {
+    const char *name;
+    uint16_t    baseS;
+    uint16_t    capS;
+} RETRY_POLICY[RC_COUNT] = {
+    { "",                0,                        0 },
+    { "WiFi",            RETRY_SLEEP_MINUTES * 60, 60 * 60 },
+    { "network",         3 * 60,                   30 * 60 },
+    { "server error",    RETRY_SLEEP_MINUTES * 60, 60 * 60 },
+    { "request refused", 60 * 60,                  6 * 60 * 60 },
+    { "bad frame",       SLEEP_MINUTES * 60,       60 * 60 },
+};
+
+RTC_DATA_ATTR static uint8_t  retry_class   = RC_NONE;
+RTC_DATA_ATTR static uint8_t  retry_attempt = 0;  // consecutive failures of retry_class
+RTC_DATA_ATTR static uint32_t retry_delay_s = 0;  // the backoff last slept
+
+static RetryClass retryClassOf(uint8_t kind, int detail) {
+    switch (kind) {
+        case EK_NET:       return RC_WIFI;
+        case EK_TRANSPORT:
+        case EK_TRUNCATED: return RC_TRANSIENT;
+        case EK_HTTP:      return (detail >= 500 || detail == 429) ? RC_SERVER : RC_CLIENT;
+        default:           return RC_CONTENT;  // EK_EMPTY, EK_DECODE
+    }
+}
+
+// Records this wake's failure and returns the (jittered) delay before the next
+// attempt.
+static uint32_t retryBackoff(RetryClass rc) {
+    if (rc != retry_class) {
+        retry_class   = rc;
+        retry_attempt = 0;
+    }
+    uint32_t d = RETRY_POLICY[rc].baseS;
+    for (int i = 0; i < retry_attempt && d < RETRY_POLICY[rc].capS; i++) d *= 2;
+    if (d > RETRY_POLICY[rc].capS) d = RETRY_POLICY[rc].capS;
+    if (retry_attempt < 255) retry_attempt++;
+    retry_delay_s = d / 2 + esp_random() % (d / 2 + 1);
+    Serial.printf("Retry: %s failure #%u — backing off %u s (of up to %u)\n",
+                  RETRY_POLICY[rc].name, retry_attempt, (unsigned)retry_delay_s, (unsigned)d);
+    return retry_delay_s;
+}
+
+static void retryReset() {
+    retry_class   = RC_NONE;
+    retry_attempt = 0;
+    retry_delay_s = 0;
+}
+
 // Stamps the status code in the reserved corner, or nothing if ST_NONE. The
 // server keeps this region empty, so on a full refresh it is already blank.
 static void drawStatus(int status) {
@@ -557,57 +1666,221 @@ static void drawStatus(int status) {
     writeln((GFXfont *)&FiraSans, (char *)STATUS_CODES[status], &x, &y, framebuffer);
 }
 
+static void presentRect(Rect_t r, int clearCycles);  // see the display compositor
+
 // Repaints ONLY the status box, leaving the rest of the panel physically intact.
 // Used when there's no fresh image (failed fetch) but the status code changed:
 // the last good weather is still held on the e-paper, so a full push would wipe
-// it. The framebuffer is white at this point (cleared at wake), so the box ends
-// up white + the code — or white alone when the code clears (ST_NONE).
-static uint8_t statusSubBuf[(STATUS_BOX_W / 2) * STATUS_BOX_H];
-
+// it. presentRect() pushes the framebuffer inside the box and nothing else, so
+// only the box has to be right. Outside it the framebuffer may hold anything —
+// white (allocated white on first use), a frame restoreLastFrame() or
+// showBundleFrame() just presented, or part of a download that failed — and none
+// of it reaches the panel. The box is filled white first, which is what every
+// frame has there (the server keeps the corner empty), so it ends up as the
+// frame + the code — or as the bare frame when the code clears (ST_NONE).
 static void partialRefreshStatus(int status) {
+    ensureDisplay();
     Rect_t box = { STATUS_BOX_X, STATUS_BOX_Y, STATUS_BOX_W, STATUS_BOX_H };
-
-    // Build the box in the framebuffer, then pack it tightly (2 px/byte, stride =
-    // width/2) — STATUS_BOX_X/W are even, so each row is a clean memcpy.
     epd_fill_rect(box.x, box.y, box.width, box.height, 0xFF, framebuffer);
     drawStatus(status);  // no-op if ST_NONE → box stays white (code cleared)
+    presentRect(box, STATUS_CLEAR_CYCLES);
+    Serial.printf("Status corner repainted (partial): %s\n",
+                  status == ST_NONE ? "(cleared)" : STATUS_CODES[status]);
+}
+
+// ─── streaming PNG source ────────────────────────────────────────────────────
+// fetchPng() hands PNGdec these callbacks instead of a RAM buffer, so the
+// inflater pulls the body straight off the HTTP stream and draws rows into the
+// framebuffer while later bytes are still in flight.
+//
+// PNGdec mostly reads forward, but it re-seeks to offsets it has already seen
+// (e.g. back to the start after sniffing the header), so the most recent
+// PNG_STREAM_WINDOW bytes are kept in a small ring that serves short backward
+// seeks. A forward seek just pulls (and discards) bytes until it's reached. The
+// djb2 hash is folded in as bytes come off the wire, so change detection needs
+// no copy of the body either.
+#define PNG_STREAM_WINDOW    8192    // bytes of look-back kept for re-seeks
+#define PNG_STREAM_STALL_MS  15000   // give up if no body bytes arrive for this long
+
+struct PngStream {
+    WiFiClient *client;
+    int32_t  contentLen;   // Content-Length of the body
+    int32_t  received;     // bytes pulled off the network so far
+    uint32_t hash;         // djb2 over bytes [0, received)
+    uint32_t netMs;        // time spent in streamPull() (network + hash)
+    uint8_t *copy;         // contentLen bytes to keep the whole body in, or null
+    uint8_t  window[PNG_STREAM_WINDOW];  // ring: byte i lives at i % WINDOW
+};
+static PngStream pngStream;
 
-    const int32_t stride = box.width / 2;
-    for (int32_t row = 0; row < box.height; row++) {
-        const uint8_t *src =
-            framebuffer + (box.y + row) * (EPD_WIDTH / 2) + box.x / 2;
-        memcpy(statusSubBuf + row * stride, src, stride);
+// Pulls body bytes off the network until `upTo` have been received (capped at
+// Content-Length). Returns false if the connection dropped or stalled first.
+static bool streamPull(int32_t upTo) {
+    PngStream &s = pngStream;
+    if (upTo > s.contentLen) upTo = s.contentLen;
+    unsigned long t0 = millis();
+    unsigned long lastByte = t0;
+    bool ok = true;
+    while (s.received < upTo) {
+        int avail = s.client->available();
+        if (avail > 0) {
+            // Read straight into the ring, never past its end in one go.
+            int32_t slot = s.received % PNG_STREAM_WINDOW;
+            int32_t want = min((int32_t)avail, upTo - s.received);
+            want = min(want, (int32_t)PNG_STREAM_WINDOW - slot);
+            int got = s.client->readBytes(s.window + slot, want);
+            s.hash = hashBytes(s.hash, s.window + slot, got);
+            if (s.copy && got > 0) memcpy(s.copy + s.received, s.window + slot, got);
+            s.received += got;
+            if (got > 0) lastByte = millis();
+        } else if (!s.client->connected() || millis() - lastByte >= PNG_STREAM_STALL_MS) {
+            ok = false;
+            break;
+        } else {
+            delay(1);
+        }
     }
+    s.netMs += millis() - t0;
+    return ok;
+}
 
-    epd_poweron();
-    epd_clear_area_cycles(box, STATUS_CLEAR_CYCLES, 50);
-    epd_draw_grayscale_image(box, statusSubBuf);
-    epd_poweroff();
-    Serial.printf("Status corner repainted (partial): %s\n",
-                  status == ST_NONE ? "(cleared)" : STATUS_CODES[status]);
+static void *pngStreamOpen(const char *, int32_t *size) {
+    *size = pngStream.contentLen;
+    return &pngStream;  // any non-null handle
+}
+
+static void pngStreamClose(void *) {}
+
+static int32_t pngStreamRead(PNGFILE *f, uint8_t *buf, int32_t len) {
+    PngStream &s = pngStream;
+    if (len > s.contentLen - f->iPos) len = s.contentLen - f->iPos;
+    int32_t done = 0;
+    while (done < len) {
+        int32_t pos = f->iPos + done;
+        if (pos < s.received - PNG_STREAM_WINDOW) {
+            Serial.printf("PNG stream: seek to %d fell out of the window\n", pos);
+            break;
+        }
+        // Pull at most half a window ahead of the read position, so the bytes
+        // being copied can't be overwritten by the pull that fetched them.
+        int32_t step = min(len - done, (int32_t)PNG_STREAM_WINDOW / 2);
+        streamPull(pos + step);
+        int32_t have = min(step, s.received - pos);
+        if (have <= 0) break;  // body ended early
+        for (int32_t i = 0; i < have; i++) {
+            buf[done + i] = s.window[(pos + i) % PNG_STREAM_WINDOW];
+        }
+        done += have;
+    }
+    f->iPos += done;
+    return done;
+}
+
+static int32_t pngStreamSeek(PNGFILE *f, int32_t pos) {
+    if (pos < 0) pos = 0;
+    if (pos > pngStream.contentLen) pos = pngStream.contentLen;
+    f->iPos = pos;  // validated lazily: the next read pulls forward or hits the window
+    return pos;
+}
+
+// Decodes the body as it streams in. Leaves the image in the framebuffer and
+// sets g_decodeRc on a decode failure; truncation is the caller's call (it
+// checks pngStream.received after draining).
+static bool decodePngStream() {
+    ensureDisplay();
+    unsigned long t0 = millis();
+    int rc = png.open("weather", pngStreamOpen, pngStreamClose,
+                      pngStreamRead, pngStreamSeek, png_draw_callback);
+    if (rc != PNG_SUCCESS) {
+        Serial.printf("PNG open failed: %d\n", rc);
+        g_decodeRc = rc;
+        return false;
+    }
+    Serial.printf("PNG: %dx%d, bpp=%d, type=%d\n",
+                  png.getWidth(), png.getHeight(),
+                  png.getBpp(), png.getPixelType());
+
+    rc = png.decode(nullptr, 0);
+    png.close();
+    if (rc != PNG_SUCCESS) {
+        Serial.printf("PNG decode failed: %d\n", rc);
+        g_decodeRc = rc;
+        return false;
+    }
+    Serial.printf("Decoded while downloading in %lu ms\n", millis() - t0);
+    return true;
 }
 
 // ─── HTTP fetch ──────────────────────────────────────────────────────────────
-// Downloads the PNG into PSRAM and captures the X-Updated header.
-// Returns true on success; pngBuf / pngLen / updatedStr are populated.
+// Streams the PNG body through the decoder (decode=true) or just drains it
+// (decode=false — the debug live test only needs to know the fetch works), and
+// captures the X-Updated / X-Firmware-Latest headers. Returns true when the
+// whole body arrived; pngHash / updatedStr / fetchedEtag are then populated, and
+// pngDecoded says whether the image landed in the framebuffer.
+//
+// With ifNoneMatch set (the ETag of the frame already on screen), an unchanged
+// frame comes back as a 304: that also returns true, with pngNotModified set and
+// no body, hash or decode — only the headers are captured.
+//
+// keepBody also copies the body into PSRAM (pngBody / pngBodyLen, freed by
+// the next call) for the last-frame store; bodies too big to store aren't kept.
+
+static void freePngBody() {
+    free(pngBody);
+    pngBody    = nullptr;
+    pngBodyLen = 0;
+}
 
-static bool fetchPng(const char *url) {
-    WiFiClientSecure client;
-    client.setInsecure();
+static bool fetchPng(const char *url, bool decode = true,
+                     const char *ifNoneMatch = nullptr, bool keepBody = false) {
+    pngHash        = 0;
+    pngDecoded     = false;
+    pngNotModified = false;
+    fetchedEtag[0] = '\0';
+    freePngBody();
+
+    // Resumes the previous wake's TLS session when the server still has it
+    // (abbreviated handshake); see tls_session.h.
+    ResumableTlsClient client;
 
     HTTPClient http;
     http.begin(client, url);
     http.setTimeout(15000);
     http.setConnectTimeout(10000);
 
-    const char *headerKeys[] = {"X-Updated", "X-Firmware-Latest"};
-    http.collectHeaders(headerKeys, 2);
+    // Phase timings of the previous wakes (see wake_trace.h).
+    static char traceBuf[768];
+    char id[13];
+    deviceId(id, sizeof(id));
+    bool sentTrace = traceHeader(traceBuf, sizeof(traceBuf), id) > 0;
+    if (sentTrace) http.addHeader("X-Wake-Trace", traceBuf);
+
+    // Battery + energy estimate as of the last sample (see energy.h).
+    EnergyEstimate en;
+    if (batt_mv_cached > 0 && energyEstimate(BATTERY_LOW_MV, en)) {
+        char batt[96];
+        snprintf(batt, sizeof(batt), "%s mv=%d uah=%u cycle=%u mah=%d h=%d%s", id,
+                 batt_mv_cached, (unsigned)en.uahPerWake, (unsigned)en.cycleS,
+                 (int)en.remainingMah, (int)en.hoursLeft, en.fromTrend ? " trend" : "");
+        http.addHeader("X-Battery", batt);
+    }
+
+    const char *headerKeys[] = {"X-Updated", "X-Firmware-Latest", "ETag", "Date",
+                                "X-Next-Update"};
+    http.collectHeaders(headerKeys, 5);
+    http.addHeader("Accept", FRAME_ACCEPT);
+    if (ifNoneMatch && ifNoneMatch[0]) http.addHeader("If-None-Match", ifNoneMatch);
 
-    Serial.printf("GET %s\n", url);
+    Serial.printf("GET %s%s\n", url, (ifNoneMatch && ifNoneMatch[0]) ? " (conditional)" : "");
+    unsigned long tGet = millis();
     int httpCode = http.GET();
     lastHttpCode = httpCode;
+    traceAdd(TP_TTFB, millis() - tGet);
+    traceAdd(TP_TLS, client.handshakeMs());
+    if (client.resumed()) traceFlag(TF_TLS_RESUMED);
+    if (sentTrace && httpCode > 0) traceMarkSent();  // the server has it
 
-    if (httpCode != HTTP_CODE_OK) {
+    if (httpCode != HTTP_CODE_OK && httpCode != HTTP_CODE_NOT_MODIFIED) {
         Serial.printf("HTTP error: %d\n", httpCode);
         g_fetchFail = (httpCode > 0) ? EK_HTTP : EK_TRANSPORT;  // real HTTP vs transport error
         g_fetchDetail = httpCode;
@@ -615,6 +1888,9 @@ static bool fetchPng(const char *url) {
         return false;
     }
 
+    // The response's Date sets the clock (see the clock section) — on a 304 too.
+    clockSyncFromDate(http.header("Date").c_str());
+
     // Capture X-Updated header.
     String hdr = http.header("X-Updated");
     strncpy(updatedStr, hdr.c_str(), sizeof(updatedStr) - 1);
@@ -627,7 +1903,35 @@ static bool fetchPng(const char *url) {
     Serial.printf("X-Firmware-Latest: %d (running v%d)\n",
                   latestFirmwareAvail, FIRMWARE_VERSION);
 
-    // Read body into PSRAM.
+    // Capture X-Next-Update ("<s>;every=<s>;vol=<pct>") for the wake scheduler.
+    g_nextPollS = -1;
+    String next = http.header("X-Next-Update");
+    long nextS = 0, every = 0;
+    int vol = 0;
+    if (sscanf(next.c_str(), "%ld;every=%ld;vol=%d", &nextS, &every, &vol) == 3
+        && nextS >= 0 && every > 0) {
+        g_nextPollS  = nextS;
+        g_pollEveryS = every;
+        g_volatility = constrain(vol, 0, 100);
+        g_hintAtMs   = millis();
+        Serial.printf("X-Next-Update: poll in %ld s, every %ld s, volatility %d%%\n",
+                      nextS, every, g_volatility);
+    }
+
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        Serial.println("304 Not Modified — frame on screen is current");
+        pngNotModified = true;
+        traceFlag(TF_NOT_MODIFIED);
+        http.end();
+        return true;
+    }
+
+    String etag = http.header("ETag");
+    strncpy(fetchedEtag, etag.c_str(), sizeof(fetchedEtag) - 1);
+    fetchedEtag[sizeof(fetchedEtag) - 1] = '\0';
+
+    // The streaming source needs the length up front (PNGdec asks for the file
+    // size on open, and it's how truncation is detected).
     int32_t contentLen = http.getSize();
     Serial.printf("Content-Length: %d bytes\n", contentLen);
     if (contentLen <= 0) {
@@ -637,76 +1941,395 @@ static bool fetchPng(const char *url) {
         return false;
     }
 
-    pngBuf = (uint8_t *)ps_malloc(contentLen);
-    if (!pngBuf) {
-        Serial.println("PSRAM alloc failed");
-        g_fetchFail = EK_OOM; g_fetchDetail = 0;
-        http.end();
-        return false;
-    }
+    pngStream.client     = http.getStreamPtr();
+    pngStream.contentLen = contentLen;
+    pngStream.received   = 0;
+    pngStream.hash       = HASH_SEED;
+    pngStream.netMs      = 0;
+    pngStream.copy       = (keepBody && contentLen <= LAST_FRAME_MAX_PNG)
+                         ? (uint8_t *)ps_malloc(contentLen) : nullptr;
 
-    WiFiClient *stream = http.getStreamPtr();
-    int32_t bytesRead = 0;
     unsigned long t0 = millis();
-    while (bytesRead < contentLen) {
-        int avail = stream->available();
-        if (avail > 0) {
-            int got = stream->readBytes(pngBuf + bytesRead,
-                                        min(avail, (int)(contentLen - bytesRead)));
-            bytesRead += got;
-        } else if (!stream->connected()) {
-            break;
-        } else {
-            delay(1);
-        }
-    }
+    bool decoded = decode && decodePngStream();
+    // Drain whatever the decoder didn't need (trailing chunks, or the whole body
+    // when not decoding / after a decode failure) so the hash covers every byte
+    // and a short body is caught.
+    streamPull(contentLen);
     http.end();
-    pngLen = bytesRead;
-    Serial.printf("Fetched %d bytes in %lu ms\n", pngLen, millis() - t0);
+    unsigned long dlMs = millis() - t0;
+    traceAdd(TP_DOWNLOAD, dlMs);
+    if (decode) traceAdd(TP_DECODE, dlMs > pngStream.netMs ? dlMs - pngStream.netMs : 0);
+    Serial.printf("Fetched %d bytes in %lu ms\n", pngStream.received, dlMs);
 
-    if (pngLen != contentLen) {
-        Serial.printf("Short read: %d of %d\n", pngLen, contentLen);
+    if (pngStream.received != contentLen) {
+        Serial.printf("Short read: %d of %d\n", pngStream.received, contentLen);
         g_fetchFail = EK_TRUNCATED; g_fetchDetail = 0;
-        free(pngBuf); pngBuf = nullptr; pngLen = 0;
+        free(pngStream.copy);
+        pngStream.copy = nullptr;
         return false;
     }
+    pngHash    = pngStream.hash;
+    pngDecoded = decoded;
+    pngBody    = pngStream.copy;
+    pngBodyLen = pngBody ? contentLen : 0;
+    pngStream.copy = nullptr;
     return true;
 }
 
-// ─── decode + display ────────────────────────────────────────────────────────
-
-static bool decodePng() {
-    unsigned long t0 = millis();
-    int rc = png.openRAM(pngBuf, pngLen, png_draw_callback);
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("PNG openRAM failed: %d\n", rc);
-        g_decodeRc = rc;
-        return false;
+// ─── display compositor ─────────────────────────────────────────────────────
+// Every screen — weather, splash, menu, the debug and error screens — draws
+// into the framebuffer and calls present(); none of them decides between a full
+// and a partial refresh itself. RTC keeps a hash per tile of what is physically
+// on the panel, so present() finds the dirty regions by hashing the framebuffer
+// the same way, whoever drew it and however long ago the panel was painted.
+// Dirty tiles are merged per tile row into one span (first..last dirty column),
+// and consecutive rows with the same span into one rectangle. Within a wake a
+// PSRAM shadow of the panel also exists, and each rectangle is tightened to the
+// bytes that actually changed: a cursor move repaints the arrow, not two tiles.
+//
+// Partial updates leave faint ghosting, the more so with fewer erase cycles, so
+// each tile counts what it has taken since the last full refresh. A frame that
+// would push a tile past PARTIAL_GHOST_BUDGET — or that changed most of the
+// panel anyway — is a full refresh instead.
+
+static uint8_t *panelShadow      = nullptr;  // the panel's pixels, this wake
+static bool     panelShadowValid = false;
+
+static uint32_t tileHash(int col, int row) {
+    uint32_t h = HASH_SEED;
+    for (int y = row * TILE_H; y < (row + 1) * TILE_H; y++) {
+        h = hashBytes(h, framebuffer + y * (EPD_WIDTH / 2) + col * (TILE_W / 2), TILE_W / 2);
     }
-    Serial.printf("PNG: %dx%d, bpp=%d, type=%d\n",
-                  png.getWidth(), png.getHeight(),
-                  png.getBpp(), png.getPixelType());
+    return h ? h : 1;  // 0 is reserved for "unknown"
+}
 
-    rc = png.decode(nullptr, 0);
-    png.close();
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("PNG decode failed: %d\n", rc);
-        g_decodeRc = rc;
-        return false;
+// The panel now shows the whole framebuffer.
+static void shadowSync() {
+    if (!panelShadow) panelShadow = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+    if (!panelShadow) return;  // no shadow: rectangles just stay tile-sized
+    memcpy(panelShadow, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2);
+    panelShadowValid = true;
+}
+
+// Shrinks r to the byte-aligned bounding box of what differs from the panel.
+// False if nothing in r changed after all.
+static bool tightenRect(Rect_t &r) {
+    const int32_t stride = EPD_WIDTH / 2;
+    int32_t bx0 = r.x / 2 + r.width / 2, bx1 = -1, y0 = -1, y1 = -1;
+    for (int32_t y = r.y; y < r.y + r.height; y++) {
+        const uint8_t *fb = framebuffer + y * stride;
+        const uint8_t *sh = panelShadow + y * stride;
+        int32_t lo = r.x / 2, hi = (r.x + r.width) / 2 - 1;
+        while (lo <= hi && fb[lo] == sh[lo]) lo++;
+        if (lo > hi) continue;
+        while (fb[hi] == sh[hi]) hi--;
+        if (y0 < 0) y0 = y;
+        y1 = y;
+        if (lo < bx0) bx0 = lo;
+        if (hi > bx1) bx1 = hi;
     }
-    Serial.printf("Decoded in %lu ms\n", millis() - t0);
+    if (y0 < 0) return false;
+    r = { bx0 * 2, y0, (bx1 - bx0 + 1) * 2, y1 - y0 + 1 };
     return true;
 }
 
-static void pushDisplay() {
+// Charges every tile r touches for a repaint with `clearCycles` erase cycles.
+static void addGhost(Rect_t r, int clearCycles) {
+    for (int row = r.y / TILE_H; row <= (r.y + r.height - 1) / TILE_H; row++) {
+        for (int col = r.x / TILE_W; col <= (r.x + r.width - 1) / TILE_W; col++) {
+            int g = tile_ghost[row * TILE_COLS + col] + GHOST_UNITS(clearCycles);
+            tile_ghost[row * TILE_COLS + col] = g > 255 ? 255 : g;
+        }
+    }
+}
+
+// Repaints one byte-aligned rectangle of the framebuffer: erase it on the panel,
+// then blit it from a tightly packed copy (the driver wants stride = width/2).
+static void pushRect(Rect_t r, int clearCycles) {
+    const int32_t stride = r.width / 2;
+    uint8_t *sub = (uint8_t *)ps_malloc(stride * r.height);
+    if (!sub) {
+        Serial.println("pushRect: sub-buffer alloc failed");
+        return;
+    }
+    for (int32_t row = 0; row < r.height; row++) {
+        memcpy(sub + row * stride,
+               framebuffer + (r.y + row) * (EPD_WIDTH / 2) + r.x / 2, stride);
+    }
+    epd_clear_area_cycles(r, clearCycles, 50);
+    epd_draw_grayscale_image(r, sub);
+    free(sub);
+}
+
+// Full-screen refresh of the framebuffer; clears all accrued ghosting.
+static void presentFull(const uint32_t *tiles) {
+    TraceScope trace(TP_EPD);
+    traceFlag(TF_DISPLAY);
     unsigned long t0 = millis();
     epd_poweron();
     epd_clear();
     epd_draw_grayscale_image(epd_full_screen(), framebuffer);
     epd_poweroff();
+    memcpy(panel_tiles, tiles, sizeof(panel_tiles));
+    panel_tiles_valid = true;
+    memset(tile_ghost, 0, sizeof(tile_ghost));
+    shadowSync();
     Serial.printf("Display pushed in %lu ms\n", millis() - t0);
 }
 
+// Puts the framebuffer on the panel, repainting only what changed when the
+// tile table is valid and the ghosting budget allows, else as a full refresh.
+// `what` names the screen in the log; clearCycles is the erase strength for
+// the partial regions.
+static void present(const char *what, int clearCycles) {
+    uint32_t tiles[TILE_COUNT];
+    int dirty = 0, worstGhost = 0;
+    for (int i = 0; i < TILE_COUNT; i++) {
+        tiles[i] = tileHash(i % TILE_COLS, i / TILE_COLS);
+        if (tiles[i] == panel_tiles[i]) continue;
+        dirty++;
+        if (tile_ghost[i] > worstGhost) worstGhost = tile_ghost[i];
+    }
+
+    if (panel_tiles_valid && dirty == 0) {
+        Serial.printf("%s: already on the panel\n", what);
+        return;
+    }
+    if (!panel_tiles_valid || dirty > PARTIAL_MAX_DIRTY_TILES
+        || worstGhost + GHOST_UNITS(clearCycles) > PARTIAL_GHOST_BUDGET) {
+        Serial.printf("%s: full refresh (tiles_valid=%d, dirty=%d/%d, ghost=%d/%d)\n",
+                      what, panel_tiles_valid, dirty, TILE_COUNT, worstGhost,
+                      PARTIAL_GHOST_BUDGET);
+        presentFull(tiles);
+        return;
+    }
+
+    TraceScope trace(TP_EPD);
+    traceFlag(TF_DISPLAY);
+    unsigned long t0 = millis();
+    int rects = 0;
+    int32_t pixels = 0;
+    epd_poweron();
+    int row = 0;
+    while (row < TILE_ROWS) {
+        // Span of dirty columns in this tile row.
+        int first = -1, last = -1;
+        for (int col = 0; col < TILE_COLS; col++) {
+            int i = row * TILE_COLS + col;
+            if (tiles[i] != panel_tiles[i]) { if (first < 0) first = col; last = col; }
+        }
+        if (first < 0) { row++; continue; }
+        // Extend down over following rows with exactly the same span.
+        int rowEnd = row + 1;
+        while (rowEnd < TILE_ROWS) {
+            int f = -1, l = -1;
+            for (int col = 0; col < TILE_COLS; col++) {
+                int i = rowEnd * TILE_COLS + col;
+                if (tiles[i] != panel_tiles[i]) { if (f < 0) f = col; l = col; }
+            }
+            if (f != first || l != last) break;
+            rowEnd++;
+        }
+        Rect_t r = { first * TILE_W, row * TILE_H,
+                     (last - first + 1) * TILE_W, (rowEnd - row) * TILE_H };
+        row = rowEnd;
+        if (panelShadowValid && !tightenRect(r)) continue;
+        pushRect(r, clearCycles);
+        addGhost(r, clearCycles);
+        rects++;
+        pixels += r.width * r.height;
+    }
+    epd_poweroff();
+    memcpy(panel_tiles, tiles, sizeof(panel_tiles));
+    shadowSync();
+    Serial.printf("%s: partial refresh of %d/%d tiles in %d rect(s) (%ld px), %lu ms "
+                  "(ghost %d/%d)\n",
+                  what, dirty, TILE_COUNT, rects, (long)pixels, millis() - t0,
+                  worstGhost + GHOST_UNITS(clearCycles), PARTIAL_GHOST_BUDGET);
+}
+
+// Repaints exactly r, for a change drawn over a panel the framebuffer doesn't
+// necessarily hold (the status corner on a wake with no fresh weather: around
+// it the framebuffer may be white or a half-decoded download). Only the
+// framebuffer inside r is read. Tiles r covers whole take their new hash;
+// tiles it only clips become unknown, so the next present() repaints them. It
+// can't escalate to a full refresh — there's no full frame to refresh with —
+// but the ghosting it adds counts against the next present().
+static void presentRect(Rect_t r, int clearCycles) {
+    TraceScope trace(TP_EPD);
+    traceFlag(TF_DISPLAY);
+    epd_poweron();
+    pushRect(r, clearCycles);
+    epd_poweroff();
+    addGhost(r, clearCycles);
+    for (int row = r.y / TILE_H; row <= (r.y + r.height - 1) / TILE_H; row++) {
+        for (int col = r.x / TILE_W; col <= (r.x + r.width - 1) / TILE_W; col++) {
+            bool whole = r.x <= col * TILE_W && (col + 1) * TILE_W <= r.x + r.width
+                      && r.y <= row * TILE_H && (row + 1) * TILE_H <= r.y + r.height;
+            panel_tiles[row * TILE_COLS + col] = whole ? tileHash(col, row) : 0;
+        }
+    }
+    if (panelShadowValid) {
+        for (int32_t y = r.y; y < r.y + r.height; y++) {
+            memcpy(panelShadow + y * (EPD_WIDTH / 2) + r.x / 2,
+                   framebuffer + y * (EPD_WIDTH / 2) + r.x / 2, r.width / 2);
+        }
+    }
+}
+
+// ─── PNG from flash ──────────────────────────────────────────────────────────
+// PNGdec callbacks reading a PNG stored in flash (a bundle frame, or the
+// last-good frame) through its module's read function — no RAM copy.
+
+struct FlashPng {
+    bool   (*read)(uint32_t offset, uint8_t *buf, uint32_t n);
+    uint32_t offset, length;
+};
+static FlashPng flashPng;
+
+static void *flashPngOpen(const char *, int32_t *size) {
+    *size = (int32_t)flashPng.length;
+    return &flashPng;
+}
+
+static void flashPngClose(void *) {}
+
+static int32_t flashPngRead(PNGFILE *f, uint8_t *buf, int32_t len) {
+    if (len > (int32_t)flashPng.length - f->iPos) len = (int32_t)flashPng.length - f->iPos;
+    if (len <= 0 || !flashPng.read(flashPng.offset + f->iPos, buf, len)) return 0;
+    f->iPos += len;
+    return len;
+}
+
+static int32_t flashPngSeek(PNGFILE *f, int32_t pos) {
+    if (pos < 0) pos = 0;
+    if (pos > (int32_t)flashPng.length) pos = (int32_t)flashPng.length;
+    f->iPos = pos;
+    return pos;
+}
+
+// Decodes a stored PNG into the framebuffer; the PNGdec code (PNG_SUCCESS = 0).
+static int decodeFlashPng(const char *name,
+                          bool (*read)(uint32_t, uint8_t *, uint32_t),
+                          uint32_t offset, uint32_t length) {
+    ensureDisplay();
+    flashPng = { read, offset, length };
+    int rc = png.open(name, flashPngOpen, flashPngClose, flashPngRead, flashPngSeek,
+                      png_draw_callback);
+    if (rc == PNG_SUCCESS) {
+        rc = png.decode(nullptr, 0);
+        png.close();
+    }
+    return rc;
+}
+
+// ─── offline frame bundle ────────────────────────────────────────────────────
+// A wake without fresh weather shows the stored bundle frame for the current
+// time (frame_bundle.h) rather than keeping the last frame: the forecast the
+// worker rendered ahead, hour by hour. PNGdec reads it straight from flash.
+// Only with a trustworthy clock — a frame picked by a wrong time is worse than
+// the frozen one.
+
+// Index of the stored frame for the current time, or -1 (no bundle, nothing
+// for now, or the clock can't be trusted).
+static int bundleFrameNow(BundleInfo &b) {
+    if (!clockOk() || !bundleLoad(b)) return -1;
+    return bundleFrameAt(b, (uint32_t)time(nullptr));
+}
+
+// Puts frame i of the bundle on the panel with `status` stamped. If it's
+// already there, only a changed status is repainted. False if it wouldn't
+// decode (the panel is then untouched).
+static bool showBundleFrame(const BundleInfo &b, int i, int status) {
+    const BundleFrame &f = b.frames[i];
+    if (f.validFrom == bundle_shown_from && !home_is_splash) {
+        if (status != prev_status) partialRefreshStatus(status);
+        else Serial.println("Bundle: frame for now already on screen");
+        prev_status = status;
+        return true;
+    }
+    int rc = decodeFlashPng("bundle", bundleRead, f.offset, f.length);
+    if (rc != PNG_SUCCESS) {
+        Serial.printf("Bundle: frame %d failed to decode (%d)\n", i, rc);
+        return false;
+    }
+    Serial.printf("Bundle: frame %d of %u (data %s, %ld min into its hour)\n", i,
+                  (unsigned)b.count, b.updated,
+                  (long)(((uint32_t)time(nullptr) - f.validFrom) / 60));
+    drawStatus(status);
+    present("Bundle frame", WEATHER_CLEAR_CYCLES);
+    // The panel no longer shows the live frame: the next fetch needs the body.
+    bundle_shown_from = f.validFrom;
+    prev_png_hash     = 0;
+    prev_etag[0]      = '\0';
+    prev_status       = status;
+    home_is_splash    = false;
+    return true;
+}
+
+// Sleep after a radio-less wake: just past the start of the next frame, or
+// the night cadence if that's sooner.
+static uint32_t bundleSleepSeconds(const BundleFrame &f) {
+    uint32_t now  = (uint32_t)time(nullptr);
+    uint32_t wake = f.validUntil > now ? f.validUntil - now + BUNDLE_WAKE_SLACK_S : SCHED_MIN_S;
+    if (wake > SCHED_NIGHT_MINUTES * 60) wake = SCHED_NIGHT_MINUTES * 60;
+    if (wake < SCHED_MIN_S) wake = SCHED_MIN_S;
+    return wake;
+}
+
+// ─── last-good frame ─────────────────────────────────────────────────────────
+// The newest live frame is also kept in flash (last_frame.h), so a cold boot —
+// RTC memory, and the clock, lost with the power — has weather to show before
+// WiFi is up, and a conditional request to make once it is.
+
+// Whether this wake's frame, if new, should be written (LAST_FRAME_SAVE_MIN_S
+// since the last write). Decided before the fetch: only then is the body kept.
+static bool lastFrameSaveDue() {
+    uint32_t now = (uint32_t)time(nullptr);
+    return last_frame_saved_at == 0 || !clockOk()
+        || now - last_frame_saved_at >= LAST_FRAME_SAVE_MIN_S;
+}
+
+// After a live frame is on the panel: stores the body fetchPng() kept.
+static void saveLastFrame(uint32_t hash) {
+    if (!pngBody) return;
+    if (lastFrameSave(pngBody, pngBodyLen, hash, fetchedEtag, updatedStr)) {
+        last_frame_saved_at = (uint32_t)time(nullptr);
+    }
+    freePngBody();
+}
+
+// Cold boot: puts the stored frame back on the panel and takes it as the frame
+// on screen (hash, ETag, X-Updated), as if this wake had fetched it. Its age
+// needs the clock, which died with the power, so it's stamped OLD until a
+// fetch sets the clock or replaces it. False if there's none or it won't decode.
+static bool restoreLastFrame(bool battLow) {
+    LastFrame lf;
+    if (!lastFrameLoad(lf)) {
+        Serial.println("Last frame: none stored");
+        return false;
+    }
+    int rc = decodeFlashPng("last", lastFrameRead, lf.offset, lf.length);
+    if (rc != PNG_SUCCESS) {
+        Serial.printf("Last frame: failed to decode (%d)\n", rc);
+        return false;
+    }
+    int status = clockOk() ? computeStatus(false, false, getAgeMinutes(lf.updated), battLow)
+                           : ST_OLD;
+    Serial.printf("Last frame: restored seq %u (data %s)\n", (unsigned)lf.seq, lf.updated);
+    drawStatus(status);
+    present("Last frame", WEATHER_CLEAR_CYCLES);
+    strncpy(updatedStr, lf.updated, sizeof(updatedStr) - 1);
+    updatedStr[sizeof(updatedStr) - 1] = '\0';
+    strncpy(prev_etag, lf.etag, sizeof(prev_etag) - 1);
+    prev_etag[sizeof(prev_etag) - 1] = '\0';
+    prev_png_hash     = lf.hash;
+    prev_status       = status;
+    home_is_splash    = false;
+    bundle_shown_from = 0;
+    return true;
+}
+
 // ─── splash render (bundled PNG, optional QR overlay) ───────────────────────
 
 // Draws a WiFi-join QR code over the splash's QR placeholder area. Erases
@@ -738,26 +2361,28 @@ static void drawQrOverPlaceholder(const char *text) {
     }
 }
 
-// Decode a baked full-screen PNG into the framebuffer, optionally draw the
+// Expands a baked, pre-packed full-screen image (see rle4.h) into the
+// framebuffer. Returns false (and logs) if the stream doesn't match the frame.
+static bool unpackBakedScreen(const uint8_t *data, uint32_t dataLen, const char *label) {
+    ensureDisplay();
+    unsigned long t0 = millis();
+    if (!rle4::unpack(data, dataLen, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2)) {
+        Serial.printf("%s: corrupt baked image (%u bytes)\n", label, (unsigned)dataLen);
+        return false;
+    }
+    Serial.printf("%s: unpacked %u bytes in %lu ms\n",
+                  label, (unsigned)dataLen, millis() - t0);
+    return true;
+}
+
+// Expand a baked full-screen image into the framebuffer, optionally draw the
 // WiFi-join QR over the QR area, and push to the panel. Shared by
 // renderSplash() (onboarding / offline fallback) and renderSetupScreen()
 // (shown while the AP is active).
-static void renderBakedScreen(const uint8_t *pngData, uint32_t pngDataLen,
+static void renderBakedScreen(const uint8_t *data, uint32_t dataLen,
                               const char *label, const char *wifiJoinStr,
                               const char *bottomMsg) {
-    int rc = png.openRAM((uint8_t *)pngData, pngDataLen, png_draw_callback);
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("%s openRAM failed: %d\n", label, rc);
-        return;
-    }
-    Serial.printf("%s: %dx%d, bpp=%d\n",
-                  label, png.getWidth(), png.getHeight(), png.getBpp());
-    rc = png.decode(nullptr, 0);
-    png.close();
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("%s decode failed: %d\n", label, rc);
-        return;
-    }
+    if (!unpackBakedScreen(data, dataLen, label)) return;
 
     if (wifiJoinStr) {
         Serial.printf("%s: drawing QR for '%s'\n", label, wifiJoinStr);
@@ -774,19 +2399,19 @@ static void renderBakedScreen(const uint8_t *pngData, uint32_t pngDataLen,
         Serial.printf("%s: bottom message '%s'\n", label, bottomMsg);
     }
 
-    pushDisplay();
+    present(label, SCREEN_CLEAR_CYCLES);
 }
 
 // Onboarding / offline-fallback splash (no AP active). Optionally draws a
 // bottom-strip message (e.g. the no-WiFi reason); never draws a QR.
 void renderSplash(const char *bottomMsg) {
-    renderBakedScreen(splash_png, splash_png_len, "Splash", nullptr, bottomMsg);
+    renderBakedScreen(splash_4bpp, splash_4bpp_len, "Splash", nullptr, bottomMsg);
 }
 
 // Device-setup screen, shown while the captive-portal AP is up. Draws the
 // WiFi-join QR over the reserved QR area (the PNG has no placeholder box).
 void renderSetupScreen(const char *wifiJoinStr) {
-    renderBakedScreen(setup_png, setup_png_len, "Setup", wifiJoinStr, nullptr);
+    renderBakedScreen(setup_4bpp, setup_4bpp_len, "Setup", wifiJoinStr, nullptr);
 }
 
 // ─── on-device menu ─────────────────────────────────────────────────────────
@@ -802,7 +2427,7 @@ static void drawCursorIntoFb(int i) {
                       0x00, framebuffer);
 }
 
-// Byte-aligned box around the cursor arrow for row `i` (used for partial refresh).
+// Box around the cursor arrow for row `i`.
 static Rect_t cursorBox(int i) {
     int32_t cy = MENU_ROW_Y0 + i * MENU_ROW_DY;
     Rect_t r = { MENU_CURSOR_BOX_X, cy - MENU_CURSOR_BOX_H / 2,
@@ -810,96 +2435,20 @@ static Rect_t cursorBox(int i) {
     return r;
 }
 
-// Renders the bundled menu PNG with the cursor arrow at `selectedIndex` via a
-// full-screen refresh. Used on menu entry and as the periodic ghosting-clearing
-// refresh; cursor *moves* use moveCursorPartial() instead.
+// Renders the bundled menu image with the cursor arrow at `selectedIndex`. Used
+// on menu entry; cursor moves edit the framebuffer in place (menuOnShort).
 static void renderMenu(int selectedIndex) {
-    int rc = png.openRAM((uint8_t *)menu_png, menu_png_len, png_draw_callback);
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("Menu openRAM failed: %d\n", rc);
-        return;
-    }
-    rc = png.decode(nullptr, 0);
-    png.close();
-    if (rc != PNG_SUCCESS) {
-        Serial.printf("Menu decode failed: %d\n", rc);
-        return;
-    }
+    if (!unpackBakedScreen(menu_4bpp, menu_4bpp_len, "Menu")) return;
 
     drawCursorIntoFb(selectedIndex);
-    pushDisplay();
-}
-
-// Moves the cursor from oldIndex to newIndex with a PARTIAL refresh: erase the
-// old arrow's box (a localized white flash) and blit the new arrow's box, rather
-// than repainting all 960×540. The framebuffer is kept authoritative so the
-// periodic full renderMenu() (which clears accrued ghosting) stays correct.
-//
-// epd_draw_grayscale_image() wants a tightly-packed 4bpp buffer (row stride =
-// width/2, no framebuffer stride), so we extract the new box from the full
-// framebuffer first; MENU_CURSOR_BOX_X/W are even, so each row is a clean
-// byte-aligned memcpy. The new box is white background before drawing (the only
-// dark pixels there were the old arrow, which lives in a different row), so the
-// blit needs no clear of its own.
-static uint8_t cursorSubBuf[(MENU_CURSOR_BOX_W / 2) * MENU_CURSOR_BOX_H];
-
-static void moveCursorPartial(int oldIndex, int newIndex) {
-    Rect_t oldBox = cursorBox(oldIndex);
-    Rect_t newBox = cursorBox(newIndex);
-
-    // Keep the framebuffer in sync: clear the old arrow, draw the new one.
-    epd_fill_rect(oldBox.x, oldBox.y, oldBox.width, oldBox.height, 0xFF, framebuffer);
-    drawCursorIntoFb(newIndex);
-
-    // Extract the new box as a packed sub-buffer (two pixels per byte).
-    const int32_t stride = newBox.width / 2;
-    for (int32_t row = 0; row < newBox.height; row++) {
-        const uint8_t *src =
-            framebuffer + (newBox.y + row) * (EPD_WIDTH / 2) + newBox.x / 2;
-        memcpy(cursorSubBuf + row * stride, src, stride);
-    }
-
-    epd_poweron();
-    // Low-cycle erase of the old arrow — fewer black↔white flashes than the
-    // default epd_clear_area (4 cycles); the leftover residue is wiped by the
-    // periodic full refresh.
-    epd_clear_area_cycles(oldBox, MENU_CURSOR_CLEAR_CYCLES, 50);
-    epd_draw_grayscale_image(newBox, cursorSubBuf);  // blit new arrow
-    epd_poweroff();
-}
-
-enum MenuButton { BTN_NONE, BTN_SHORT, BTN_LONG };
-
-// Polls the button once. Returns BTN_NONE if not pressed; otherwise blocks for
-// the press duration and classifies SHORT (< BUTTON_HOLD_MS) vs LONG. For a
-// LONG press it waits for release so the hold isn't re-read as another event.
-//
-// TODO (see ROADMAP.md "Long-press fires on threshold"): a long press should
-// take effect the instant the hold crosses BUTTON_HOLD_MS — not on release —
-// so there's feedback while holding. That means returning BTN_LONG immediately
-// (drop the wait-for-release here) and relying on the shared waitForButtonRelease()
-// gate to swallow the still-held button so it isn't re-read AND can't bleed into
-// the next screen (e.g. auto-confirm the factory reset).
-static MenuButton readButtonEvent() {
-    if (digitalRead(BUTTON_GPIO) == HIGH) return BTN_NONE;  // not pressed
-    delay(20);                                              // debounce
-    if (digitalRead(BUTTON_GPIO) == HIGH) return BTN_NONE;  // bounce / noise
-
-    unsigned long pressStart = millis();
-    while (digitalRead(BUTTON_GPIO) == LOW) {
-        if (millis() - pressStart >= BUTTON_HOLD_MS) {
-            while (digitalRead(BUTTON_GPIO) == LOW) delay(10);  // wait for release
-            return BTN_LONG;
-        }
-        delay(10);
-    }
-    return BTN_SHORT;  // released before the long threshold
+    present("Menu", SCREEN_CLEAR_CYCLES);
 }
 
 // ─── screen framework ────────────────────────────────────────────────────────
 // Every awake, interactive screen is described by a Screen: how to paint it and
-// what each button gesture does. One driver (runScreen) owns the poll loop —
-// debounce, idle timeout, dispatch — so screens never hand-roll their own loop.
+// what each button gesture does. One driver (runScreen) owns the input loop —
+// idle timeout, gesture decoding, dispatch — so screens never hand-roll their
+// own loop. Input comes from the interrupt-fed queue in button_input.h.
 // A handler returns a Nav telling the navigator (runUi) where to go next.
 //
 // To add a screen: write a render() (+ optional onShort/onLong returning a Nav),
@@ -933,37 +2482,38 @@ struct Screen {
 static const DeviceConfig *g_uiCfg       = nullptr;
 static bool                g_uiHasConfig = false;
 
-// The wake long-press (confirmed at the hold threshold, not on release) may still
-// be held when we open the first screen — wait it out so it isn't re-read as an
-// in-screen press, then debounce the release.
-static void waitForButtonRelease() {
-    pinMode(BUTTON_GPIO, INPUT_PULLUP);
-    while (digitalRead(BUTTON_GPIO) == LOW) delay(10);
-    delay(50);
-}
-
-// Runs one screen: render once, then poll until a handler returns a non-STAY Nav
-// or the idle timeout fires. Handlers own any repaint they need (e.g. the menu's
-// partial cursor move), so STAY just keeps looping without a re-render.
+// Runs one screen: render once, then wait for input until a handler returns a
+// non-STAY Nav or the idle timeout fires. Handlers own any repaint they need
+// (e.g. the menu's partial cursor move), so STAY just keeps waiting without a
+// re-render.
+//
+// A long press acts the instant the hold crosses BUTTON_HOLD_MS; a short press
+// on release. Only a press that started on this screen counts: the tail of a
+// hold from the previous screen (or the wake) releases without effect, so it
+// can't bleed into e.g. the factory-reset confirm.
 static Nav runScreen(const Screen *s) {
     if (s->run) return s->run();          // self-contained (Device Setup)
 
     s->render();
     unsigned long start = millis();
+    bool pressed = false;  // a press began on this screen and hasn't gone LONG
     for (;;) {
-        MenuButton ev = readButtonEvent();
-        if (ev == BTN_SHORT) {
-            start = millis();
-            Nav n = s->onShort ? s->onShort() : navStay();
-            if (n.kind != NAV_STAY) return n;
-        } else if (ev == BTN_LONG) {
-            start = millis();
+        uint32_t idle = millis() - start;
+        ButtonEvent ev;
+        if (idle >= s->idleMs || !buttonWait(ev, s->idleMs - idle)) return s->onIdle;
+        start = millis();
+        if (ev.kind == BE_PRESS) {
+            pressed = true;
+        } else if (ev.kind == BE_LONG && pressed) {
+            pressed = false;
+            Serial.printf("Button: long press (%s)\n", s->name);
             Nav n = s->onLong ? s->onLong() : navHome();
             if (n.kind != NAV_STAY) return n;
-        } else if (millis() - start >= s->idleMs) {
-            return s->onIdle;
-        } else {
-            delay(20);
+        } else if (ev.kind == BE_RELEASE && pressed) {
+            pressed = false;
+            Serial.printf("Button: short press (%s)\n", s->name);
+            Nav n = s->onShort ? s->onShort() : navStay();
+            if (n.kind != NAV_STAY) return n;
         }
     }
 }
@@ -1000,7 +2550,7 @@ static void drawConfirmResetScreen() {
     x = 60; y = 386;
     writeln((GFXfont *)&FiraSans, "Short-press = cancel", &x, &y, framebuffer);
 
-    pushDisplay();
+    present("Confirm", SCREEN_CLEAR_CYCLES);
 }
 
 // ─── debug live-test screen ─────────────────────────────────────────────────
@@ -1023,10 +2573,30 @@ struct DebugInfo {
     int         latestFw;    // X-Firmware-Latest this pass (valid iff server==SS_OK)
     char        dataTime[24];
     char        ageStr[16];
+    char        battStr[48];
 };
 
-// Draws the full debug screen from the current DebugInfo (full refresh). Called
-// repeatedly as the live test progresses; not-yet-known fields show placeholders.
+// "3.91 V, 0.21 mAh/wake, ~43 days left" — the energy model's estimate (see
+// energy.h), or just the voltage until it has measured a full wake cycle.
+static void batteryInfoStr(char *buf, size_t bufSize) {
+    int mv = batteryMillivolts();
+    EnergyEstimate en;
+    if (!energyEstimate(BATTERY_LOW_MV, en) || en.hoursLeft < 0) {
+        snprintf(buf, bufSize, "%d.%02d V (estimating...)", mv / 1000, (mv % 1000) / 10);
+    } else if (en.hoursLeft < 48) {
+        snprintf(buf, bufSize, "%d.%02d V, %u.%02u mAh/wake, ~%d h left", mv / 1000,
+                 (mv % 1000) / 10, (unsigned)(en.uahPerWake / 1000),
+                 (unsigned)(en.uahPerWake % 1000 / 10), (int)en.hoursLeft);
+    } else {
+        snprintf(buf, bufSize, "%d.%02d V, %u.%02u mAh/wake, ~%d days left", mv / 1000,
+                 (mv % 1000) / 10, (unsigned)(en.uahPerWake / 1000),
+                 (unsigned)(en.uahPerWake % 1000 / 10), (int)(en.hoursLeft / 24));
+    }
+}
+
+// Draws the debug screen from the current DebugInfo. Called repeatedly as the
+// live test progresses (only the changed lines repaint); not-yet-known fields
+// show placeholders.
 static void drawDebugScreen(const DebugInfo &d) {
     memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
     char line[80];
@@ -1048,13 +2618,18 @@ static void drawDebugScreen(const DebugInfo &d) {
     // thinks it's current — a persistent "(update available)" across debug runs
     // means it's discovering updates but not applying them.
     // TODO: OTA diagnostics + manual control (see ROADMAP.md). Surface *why* an
-    // update failed — persist + show the httpUpdate error (getLastError /
-    // getLastErrorString) and ota_failed_version — and add a way to force-retry
+    // update failed — persist + show g_otaError and ota_failed_version — and
+    // add a way to force-retry
     // past the cooldown. Likely wants a second debug page or a dedicated
     // "Software update" menu item rather than crowding this screen.
     if (d.server == SS_OK) {
-        snprintf(line, sizeof(line), "Software version: v%d (%s)", FIRMWARE_VERSION,
-                 d.latestFw > FIRMWARE_VERSION ? "update available" : "up to date");
+        int pct = d.latestFw > FIRMWARE_VERSION ? otaProgressPercent(d.latestFw) : -1;
+        if (pct >= 0)
+            snprintf(line, sizeof(line), "Software version: v%d (downloading v%d: %d%%)",
+                     FIRMWARE_VERSION, d.latestFw, pct);
+        else
+            snprintf(line, sizeof(line), "Software version: v%d (%s)", FIRMWARE_VERSION,
+                     d.latestFw > FIRMWARE_VERSION ? "update available" : "up to date");
     } else {
         snprintf(line, sizeof(line), "Software version: v%d", FIRMWARE_VERSION);
     }
@@ -1105,7 +2680,11 @@ static void drawDebugScreen(const DebugInfo &d) {
         snprintf(line, sizeof(line), "Weather data: -");
     writeln((GFXfont *)&FiraSans, line, &x, &y, framebuffer);
 
-    pushDisplay();
+    x = 60; y = 512;
+    snprintf(line, sizeof(line), "Battery: %s", d.battStr);
+    writeln((GFXfont *)&FiraSans, line, &x, &y, framebuffer);
+
+    present("Device info", SCREEN_CLEAR_CYCLES);
 }
 
 // Captures the device's current local time into buf ("(no time)" if unsynced).
@@ -1120,9 +2699,9 @@ static void currentTimeStr(char *buf, size_t bufSize) {
 // Runs one live-test pass: draw the static screen immediately (WiFi/server show
 // "connecting..."/"checking..." so the user sees the test started), then run
 // the WiFi connect AND the weather fetch, and redraw ONCE when both results are
-// ready. Leaves WiFi disconnected. The fetched PNG is freed here (not
-// displayed) — the post-menu fall-through re-fetches + repaints fresh weather
-// on menu exit.
+// ready. Leaves WiFi disconnected. The fetched PNG is only drained (not
+// decoded or displayed) — the post-menu fall-through re-fetches + repaints
+// fresh weather on menu exit.
 static void runDebugPass(const DeviceConfig &cfg, bool hasConfig) {
     DebugInfo d;
     memset(&d, 0, sizeof(d));
@@ -1130,6 +2709,7 @@ static void runDebugPass(const DeviceConfig &cfg, bool hasConfig) {
     d.ssid = cfg.ssid.c_str();
     d.zip  = cfg.zip.c_str();
     snprintf(d.timeStr, sizeof(d.timeStr), "...");
+    batteryInfoStr(d.battStr, sizeof(d.battStr));
 
     if (!hasConfig) {
         // Nothing to test — show identity + "not configured" and bail.
@@ -1154,7 +2734,8 @@ static void runDebugPass(const DeviceConfig &cfg, bool hasConfig) {
         d.wifi = WS_OK;
 
         String url = String(SERVER_BASE_URL) + "/weather/" + cfg.zip + ".png";
-        bool fetchOk = fetchPng(url.c_str());
+        // Drain-only fetch: the framebuffer holds this screen, not the weather.
+        bool fetchOk = fetchPng(url.c_str(), /*decode=*/false);
         if (fetchOk) {
             d.server = SS_OK;
             d.latestFw = latestFirmwareAvail;
@@ -1164,9 +2745,6 @@ static void runDebugPass(const DeviceConfig &cfg, bool hasConfig) {
             else if (ageMin < 60)  snprintf(d.ageStr, sizeof(d.ageStr), "%dm ago", ageMin);
             else                   snprintf(d.ageStr, sizeof(d.ageStr), "%dh %dm ago",
                                             ageMin / 60, ageMin % 60);
-            // Diagnostic only: free the buffer rather than display it. The
-            // post-menu fall-through re-fetches + repaints fresh weather on exit.
-            if (pngBuf) { free(pngBuf); pngBuf = nullptr; pngLen = 0; }
         } else {
             d.server   = SS_HTTPFAIL;
             d.httpCode = lastHttpCode;
@@ -1194,11 +2772,14 @@ static void errorText(uint8_t code, int16_t detail, char *buf, size_t n) {
             else                   snprintf(buf, n, "Server net error (%d)", detail);
             break;
         case EK_EMPTY:     snprintf(buf, n, "Empty/chunked response"); break;
-        case EK_OOM:       snprintf(buf, n, "Out of memory (PNG)"); break;
+        case EK_OOM:       snprintf(buf, n, "Out of memory (PNG)"); break;  // retired
         case EK_TRUNCATED: snprintf(buf, n, "Download truncated"); break;
         case EK_DECODE:    snprintf(buf, n, "Image decode failed (%d)", detail); break;
-        case EK_NTP:       snprintf(buf, n, "Clock not synced (NTP)"); break;
-        case EK_OTA:       snprintf(buf, n, "Update failed (E%d)", detail); break;
+        case EK_NTP:       snprintf(buf, n, "Clock not synced"); break;
+        case EK_OTA:
+            if (detail > 0) snprintf(buf, n, "Update failed (HTTP %d)", detail);
+            else            snprintf(buf, n, "Update failed (E%d)", detail);
+            break;
         default:           snprintf(buf, n, "Error %u", code); break;
     }
 }
@@ -1224,16 +2805,28 @@ static void drawRecentErrors() {
     writeln((GFXfont *)&FiraSans, "Recent Errors", &x, &y, framebuffer);
     epd_fill_rect(60, 92, EPD_WIDTH - 120, 3, OVERLAY_COLOR_MUTED, framebuffer);
 
+    // The retry policy's current backoff, while a failure run is ongoing.
+    int32_t top = 150;
+    if (retry_class != RC_NONE) {
+        char backoff[80];
+        snprintf(backoff, sizeof(backoff), "Backing off: %s, try %u, ~%u min",
+                 RETRY_POLICY[retry_class].name, retry_attempt,
+                 (unsigned)((retry_delay_s + 30) / 60));
+        x = 60; y = top;
+        writeln((GFXfont *)&FiraSans, backoff, &x, &y, framebuffer);
+        top += 66;
+    }
+
     if (err_count == 0) {
-        x = 60; y = 150;
+        x = 60; y = top;
         writeln((GFXfont *)&FiraSans, "No recent errors.", &x, &y, framebuffer);
-        pushDisplay();
+        present("Recent errors", SCREEN_CLEAR_CYCLES);
         return;
     }
 
     char line[80], when[16], what[48];
     const int32_t STEP = 46, BOTTOM = 524;  // ~9 lines fit before the panel edge
-    y = 150;
+    y = top;
     for (int i = 0; i < err_count && y <= BOTTOM; i++) {  // newest first
         int idx = (err_head + ERR_RING_SIZE - 1 - i) % ERR_RING_SIZE;
         ErrEntry &e = err_ring[idx];
@@ -1245,7 +2838,7 @@ static void drawRecentErrors() {
         writeln((GFXfont *)&FiraSans, line, &x, &y, framebuffer);
         y += STEP;
     }
-    pushDisplay();
+    present("Recent errors", SCREEN_CLEAR_CYCLES);
 }
 
 // ─── screen instances ─────────────────────────────────────────────────────────
@@ -1298,18 +2891,20 @@ static const Screen SCREEN_SETUP = {
     "setup", setupRun, nullptr, nullptr, nullptr, navHome(), 0
 };
 
-// — Menu (hub) — short cycles the cursor (partial refresh; full on wrap-to-top),
-// long selects, idle → Home.
+// — Menu (hub) — short cycles the cursor (a partial refresh of the arrows, via
+// the compositor), long selects, idle → Home.
 static int  g_menuCursor = 0;
 static void menuRender() { renderMenu(g_menuCursor); }
 static Nav  menuOnShort() {
     int prev = g_menuCursor;
     g_menuCursor = (g_menuCursor + 1) % MENU_ITEM_COUNT;
     Serial.printf("Menu: cursor -> item %d\n", g_menuCursor);
-    // Full refresh on wrap back to the top (once per cycle for a 4-item menu — a
-    // natural moment for the flash); partial refresh for the snappy moves between.
-    if (g_menuCursor == 0) renderMenu(g_menuCursor);
-    else                   moveCursorPartial(prev, g_menuCursor);
+    // Erase the old arrow, draw the new one; the compositor repaints just those
+    // two spots, and a full refresh once the ghost budget there runs out.
+    Rect_t old = cursorBox(prev);
+    epd_fill_rect(old.x, old.y, old.width, old.height, 0xFF, framebuffer);
+    drawCursorIntoFb(g_menuCursor);
+    present("Menu", MENU_CURSOR_CLEAR_CYCLES);
     return navStay();
 }
 static Nav menuOnLong() {
@@ -1330,26 +2925,74 @@ static const Screen SCREEN_MENU = {
 // Opens the on-device menu (the single UI hub) and runs the screen graph until it
 // — or a sub-screen — returns Home; the caller then performs the Home transition.
 // cfg/hasConfig are exposed to the screens (the debug live test needs them). The
-// wake long-press may still be held, so wait it out first. A confirmed factory
-// reset reboots inside runUi() and never returns.
+// wake long-press may still be held; the input queue treats it as spent. A
+// confirmed factory reset reboots inside runUi() and never returns.
 static void enterMenu(const DeviceConfig &cfg, bool hasConfig) {
     Serial.println("=== Entering menu ===");
     g_uiCfg       = &cfg;
     g_uiHasConfig = hasConfig;
     g_menuCursor  = 0;
-    waitForButtonRelease();
+    ensureDisplay();
+    buttonBegin();
     runUi(&SCREEN_MENU);
+    buttonEnd();
     Serial.println("Menu closed — returning home.");
 }
 
+// ─── wake scheduler ──────────────────────────────────────────────────────────
+// The next sleep, in seconds. A failed wake backs off per the retry policy;
+// after a good fetch the worker's hint picks the wake: the frame only changes
+// when a poll finds new data, so waking between polls just refetches the same
+// frame. The target interval grows as volatility falls (and overnight), then
+// snaps to the last poll (plus render slack) that fits inside it.
+
+// True between SCHED_NIGHT_START and SCHED_NIGHT_END, local time (false if the
+// clock can't say).
+static bool nightNow() {
+    struct tm ti;
+    if (!clockOk() || !getLocalTime(&ti, 0)) return false;
+    return ti.tm_hour >= SCHED_NIGHT_START || ti.tm_hour < SCHED_NIGHT_END;
+}
+
+static uint32_t scheduleSleepSeconds(RetryClass failure) {
+    if (failure != RC_NONE) {
+        uint32_t d = retryBackoff(failure);
+        // Once we've fallen back to the no-WiFi splash, recheck slowly to save
+        // battery (we've given up for now).
+        if (home_is_splash && d < RECOVERY_SLEEP_MINUTES * 60) d = RECOVERY_SLEEP_MINUTES * 60;
+        return d;
+    }
+    retryReset();
+    if (g_nextPollS < 0) return SLEEP_MINUTES * 60;
+
+    uint32_t target = SLEEP_MINUTES * 60
+                    + (SCHED_STABLE_MINUTES - SLEEP_MINUTES) * 60 * (100 - g_volatility) / 100;
+    bool night = nightNow();
+    if (night) target = SCHED_NIGHT_MINUTES * 60;
+
+    // Polls still ahead, measured from now rather than the response.
+    int32_t elapsed = (int32_t)((millis() - g_hintAtMs) / 1000);
+    int32_t first = g_nextPollS + SCHED_RENDER_SLACK_S - elapsed;
+    while (first < SCHED_MIN_S) first += g_pollEveryS;
+    uint32_t wake = first;
+    if (wake < target) wake += (target - wake) / g_pollEveryS * g_pollEveryS;
+    if (wake > SCHED_NIGHT_MINUTES * 60) wake = SCHED_NIGHT_MINUTES * 60;
+
+    Serial.printf("Schedule: wake in %u s (volatility %d%%%s, target %u s, polls every %u s)\n",
+                  (unsigned)wake, g_volatility, night ? ", night" : "",
+                  (unsigned)target, (unsigned)g_pollEveryS);
+    return wake;
+}
+
 // ─── deep sleep ──────────────────────────────────────────────────────────────
 
 // armTimer=false: only the button wakes the chip (used in the no-config state
 // where there's nothing useful to retry on a periodic timer). armTimer=true:
 // both timer + button (normal weather operation). The caller picks the timer
-// interval — typically SLEEP_MINUTES on success, RETRY_SLEEP_MINUTES on a
-// failed fetch so we recover from transient WiFi/server blips faster.
-static void enterDeepSleep(bool armTimer = true, uint32_t timerMinutes = SLEEP_MINUTES) {
+// interval in seconds — normally scheduleSleepSeconds().
+static void enterDeepSleep(bool armTimer = true, uint32_t timerSeconds = SLEEP_MINUTES * 60) {
+    traceCommit();
+    energyCommit(armTimer ? timerSeconds : 0);
 #ifdef KEEP_AWAKE
     // Debug build: skip real deep sleep so USB CDC stays alive across "wakes".
     // Soft-restart after a short delay to simulate the wake cycle quickly.
@@ -1362,12 +3005,16 @@ static void enterDeepSleep(bool armTimer = true, uint32_t timerMinutes = SLEEP_M
 #endif
 
     if (armTimer) {
-        Serial.printf("Sleeping for %u min (or button on IO%d)...\n",
-                      (unsigned)timerMinutes, (int)BUTTON_GPIO);
+        Serial.printf("Sleeping for %u s (or button on IO%d)...\n",
+                      (unsigned)timerSeconds, (int)BUTTON_GPIO);
     } else {
         Serial.printf("Sleeping until button on IO%d (no timer wake)...\n",
                       (int)BUTTON_GPIO);
     }
+    // Per-wake summary: how long we were up, and what the display side cost
+    // (zero on a wake that had nothing to repaint).
+    Serial.printf("Wake: awake %lu ms, display %s (%lu ms bring-up)\n",
+                  millis(), epdReady ? "used" : "skipped", g_displayInitMs);
     Serial.flush();
 
     // Configure the button GPIO as an RTC input with internal pull-up so ext0
@@ -1376,8 +3023,9 @@ static void enterDeepSleep(bool armTimer = true, uint32_t timerMinutes = SLEEP_M
     rtc_gpio_pulldown_dis(BUTTON_GPIO);
 
     esp_sleep_enable_ext0_wakeup(BUTTON_GPIO, 0);  // wake when button pulled LOW
+    wakeStubArm(BUTTON_GPIO);                      // taps are rejected in the stub
     if (armTimer) {
-        uint64_t us = (uint64_t)timerMinutes * 60ULL * 1000000ULL;
+        uint64_t us = (uint64_t)timerSeconds * 1000000ULL;
         esp_sleep_enable_timer_wakeup(us);
     }
     esp_deep_sleep_start();
@@ -1391,7 +3039,10 @@ void setup() {
     delay(200);
 
     boot_count++;
+    traceBegin(boot_count);
     bool firstBoot = (boot_count == 1);
+    clockBegin();
+    energyBegin();
     esp_sleep_wakeup_cause_t wakeup = esp_sleep_get_wakeup_cause();
 
     Serial.printf("\n=== firmware  boot #%u  wakeup=%d ===\n",
@@ -1406,37 +3057,47 @@ void setup() {
     }
 
     // ── Button wake handling ─────────────────────────────────────────────
-    // If the button woke us, require a long hold before doing anything — a
-    // brief tap is treated as accidental and we go straight back to sleep
-    // (no EPD spin-up, no WiFi). A confirmed long press flips wantMenu so the
-    // post-config branch opens the on-device menu instead of fetching weather.
+    // A button wake needs a long hold before doing anything — a brief tap is
+    // treated as accidental and goes straight back to sleep (no EPD spin-up, no
+    // WiFi). Normally the deep-sleep wake stub has already decided: taps never
+    // get this far, so a button wake here is a confirmed hold. Only when the
+    // stub didn't classify the wake (not armed yet, e.g. first sleep after
+    // flashing) is the press timed here, with the same classifier. A confirmed
+    // long press flips wantMenu so the post-config branch opens the on-device
+    // menu instead of fetching weather.
+    if (uint32_t taps = wakeStubTakeRejectedTaps()) {
+        Serial.printf("Wake stub rejected %u accidental tap(s) since last boot\n",
+                      (unsigned)taps);
+    }
     bool wantMenu = false;
     if (wakeup == ESP_SLEEP_WAKEUP_EXT0) {
         Serial.println("Wakeup: button on IO21");
-        pinMode(BUTTON_GPIO, INPUT_PULLUP);
-        unsigned long pressStart = millis();
-        while (millis() - pressStart < BUTTON_HOLD_MS) {
-            if (digitalRead(BUTTON_GPIO) == HIGH) {
-                Serial.printf("Button released after %lu ms — too brief, ignoring.\n",
-                              millis() - pressStart);
+        holdclass::Verdict v = wakeStubVerdict();
+        if (v == holdclass::PENDING) {
+            pinMode(BUTTON_GPIO, INPUT_PULLUP);
+            holdclass::State st = {};
+            unsigned long last = millis();
+            while (v == holdclass::PENDING) {
+                delay(10);
+                unsigned long now = millis();
+                v = holdclass::step(st, digitalRead(BUTTON_GPIO) == LOW, now - last,
+                                    BUTTON_HOLD_MS, BUTTON_DEBOUNCE_MS);
+                last = now;
+            }
+            if (v == holdclass::TAP) {
+                Serial.printf("Button released after %u ms — too brief, ignoring.\n",
+                              (unsigned)st.heldMs);
                 enterDeepSleep();
                 return;
             }
-            delay(20);
         }
         Serial.println("Long press confirmed (>1.5s) — opening menu.");
         wantMenu = true;
     }
 
-    // Init display + framebuffer.
-    epd_init();
-    framebuffer = (uint8_t *)ps_calloc(1, EPD_WIDTH * EPD_HEIGHT / 2);
-    if (!framebuffer) {
-        Serial.println("FATAL: framebuffer alloc failed");
-        enterDeepSleep();
-        return;
-    }
-    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    // The display (epd_init + framebuffer) is brought up lazily by whatever
+    // first draws — see ensureDisplay(). A wake that finds nothing to repaint
+    // never touches it.
 
 #ifdef SPLASH_TEST_MODE
     Serial.println("SPLASH_TEST_MODE: rendering bundled splash, no network.");
@@ -1447,7 +3108,11 @@ void setup() {
 
     // ── Load config from NVS ─────────────────────────────────────────────
     DeviceConfig cfg;
-    bool hasConfig = loadConfig(cfg);
+    bool hasConfig;
+    {
+        TraceScope trace(TP_NVS);
+        hasConfig = loadConfig(cfg);
+    }
     if (hasConfig) {
         Serial.printf("Config: SSID='%s' zip='%s'\n",
                       cfg.ssid.c_str(), cfg.zip.c_str());
@@ -1466,7 +3131,9 @@ void setup() {
         // weather replaces it when ready. Just force a repaint (the fetched PNG may
         // match the hash of the weather shown before the menu).
         prev_png_hash  = 0;
+        prev_etag[0]   = '\0';      // ...and fetch the body, not a 304
         home_is_splash = false;     // re-decided by the weather flow / splash branch
+        bundle_shown_from = 0;
     }
 
     // ── No config: onboarding splash, button-only wake ───────────────────
@@ -1493,22 +3160,60 @@ void setup() {
     // Calibrate ADC (for battery reading).
     calibrateADC();
 
+    // ── Cold boot: last-good frame from flash ────────────────────────────
+    // After a power loss, repaint the last weather right away — the panel's
+    // only wait is the EPD push, not WiFi + download. The fetch below then
+    // treats it as the frame on screen.
+    bool restored = firstBoot && restoreLastFrame(batteryIsLow(batteryMillivolts()));
+
+    // ── Radio-less night wake (offline frame bundle) ─────────────────────
+    // Overnight, a timer wake whose frame is already in the bundle just shows
+    // it: no WiFi, no fetch, no OTA, and it sleeps until the next frame starts.
+    // Only after a clean wake, so a failure still gets its retries online.
+    BundleInfo bundle;
+    int  bundleNow = bundleFrameNow(bundle);
+    bool skipRadio = bundleNow >= 0 && wakeup == ESP_SLEEP_WAKEUP_TIMER && !firstBoot
+                  && !home_is_splash && retry_class == RC_NONE && nightNow()
+                  && (uint32_t)time(nullptr) - bundle.generated < BUNDLE_SKIP_MAX_AGE_S;
+    if (skipRadio) {
+        Serial.println("Night wake with a bundle frame for now — skipping WiFi.");
+        int battMv = batteryMillivolts();
+        // A planned skip isn't staleness: no OLD, just BAT if it applies.
+        int status = computeStatus(false, false, -1, batteryIsLow(battMv));
+        if (showBundleFrame(bundle, bundleNow, status)) {
+            last_wake_failed = wakeHadError;
+            enterDeepSleep(/*armTimer=*/true, bundleSleepSeconds(bundle.frames[bundleNow]));
+            return;
+        }
+        // Undecodable frame: fall through to a normal online wake.
+    }
+
     // ── Fetch PNG ────────────────────────────────────────────────────────
     String pngUrl = String(SERVER_BASE_URL) + "/weather/" + cfg.zip + ".png";
 
+    // The PNG decodes into the framebuffer as it downloads, so by the time
+    // fetchPng() returns the image is already drawn (pngDecoded).
+    //
+    // The request is conditional on the ETag of the frame on screen, unless the
+    // panel doesn't hold that frame (first boot with nothing restored, or the
+    // splash is home) and we need the full image regardless. A new frame's body
+    // is kept for the last-frame store when a write is due.
     bool wifiOk  = connectWiFi(cfg.ssid.c_str(), cfg.password.c_str());
     bool fetchOk = false;
     if (wifiOk) {
-        fetchOk = fetchPng(pngUrl.c_str());
+        const char *ifNoneMatch = ((firstBoot && !restored) || home_is_splash)
+                                ? nullptr : prev_etag;
+        fetchOk = fetchPng(pngUrl.c_str(), /*decode=*/true, ifNoneMatch, lastFrameSaveDue());
         // Leave WiFi up: the OTA step runs after the weather is on screen
         // (further down) so the device shows fresh weather before any firmware
         // download/reboot.
     } else {
         Serial.println("WiFi failed");
     }
+    if (!fetchOk) traceFlag(TF_FETCH_FAILED);
 
     // ── Read battery + compute status ────────────────────────────────────
-    int  battMv   = readBatteryMillivolts();
+    int  battMv   = batteryMillivolts();
     bool battLow  = batteryIsLow(battMv);
     int  ageMin   = getAgeMinutes(updatedStr);
     int  status   = computeStatus(!wifiOk, wifiOk && !fetchOk, ageMin, battLow);
@@ -1516,59 +3221,93 @@ void setup() {
     Serial.printf("Battery: %d mV (low=%d)  Age: %d min  WiFi: %s  Status: %s\n",
                   battMv, battLow, ageMin, wifiOk ? "ok" : "FAIL",
                   status == ST_NONE ? "OK" : STATUS_CODES[status]);
+    EnergyEstimate en;
+    if (energyEstimate(BATTERY_LOW_MV, en) && en.hoursLeft >= 0) {
+        Serial.printf("Energy: %u µAh per %u s cycle, %d mAh to BAT ≈ %d days%s\n",
+                      (unsigned)en.uahPerWake, (unsigned)en.cycleS, (int)en.remainingMah,
+                      (int)(en.hoursLeft / 24), en.fromTrend ? " (voltage trend)" : "");
+    }
 
     // ── WiFi-failure streak (drives the no-WiFi splash fallback) ─────────
     // Count consecutive failed connects; reset on any successful connect, so
     // intermittent WiFi never trips the fallback — only a sustained outage.
     wifi_fail_streak = wifiOk ? 0 : (wifi_fail_streak + 1);
+    if (wifi_fail_streak == 1) wifi_fail_since = (uint32_t)time(nullptr);
 
     // Record this wake's failure (if any) for the "Recent Errors" debug screen.
     // These are mutually exclusive per wake: no WiFi → NET; WiFi but the fetch
-    // failed → the specific fetch reason; otherwise a synced-clock miss → NTP.
+    // failed → the specific fetch reason; otherwise an untrustworthy clock → NTP.
     // (Decode and OTA failures are logged at their own points further down.)
     if (!wifiOk) {
         logError(EK_NET, 0);
     } else if (!fetchOk) {
         logError(g_fetchFail, (int16_t)g_fetchDetail);
-    } else if (!g_ntpSynced) {
+        // A transport failure right after a fast reconnect may mean the cached
+        // lease is no longer ours (router rebooted, address reassigned) — run
+        // DHCP next wake rather than keep reusing it.
+        if (g_wifiFast && g_fetchFail == EK_TRANSPORT) wifiCacheInvalidate();
+    } else if (!clockOk()) {
         logError(EK_NTP, 0);
     }
 
     // ── Change detection ─────────────────────────────────────────────────
-    uint32_t newHash = fetchOk ? hashBytes(pngBuf, pngLen) : prev_png_hash;
+    // A 304 means the frame on screen is still current: same hash, no body.
+    bool notModified   = fetchOk && pngNotModified;
+    uint32_t newHash   = (fetchOk && !notModified) ? pngHash : prev_png_hash;
     bool pngChanged    = (newHash != prev_png_hash);
     bool statusChanged = (status != prev_status);
 
     Serial.printf("Hash: 0x%08X (prev 0x%08X)  png_changed=%d  status_changed=%d  "
-                  "wifi_fail_streak=%u  home=%s\n",
-                  newHash, prev_png_hash, pngChanged, statusChanged,
+                  "not_modified=%d  wifi_fail_streak=%u  home=%s\n",
+                  newHash, prev_png_hash, pngChanged, statusChanged, notModified,
                   (unsigned)wifi_fail_streak, home_is_splash ? "splash" : "weather");
 
-    bool decoded = fetchOk && decodePng();
-    if (fetchOk && !decoded) {
+    bool decoded = fetchOk && !notModified && pngDecoded;
+    if (fetchOk && !notModified && !decoded) {
         // Got PNG bytes but couldn't render them (corrupt image) — log IMG and
         // fall through to the no-fresh-weather handling below.
         logError(EK_DECODE, (int16_t)g_decodeRc);
     }
-    if (decoded) {
+    if (notModified) {
+        // The weather on the panel is current, but there's no fresh image in the
+        // framebuffer to redraw it from — so a status change (e.g. OLD or BAT
+        // appearing/clearing) only repaints the corner box.
+        if (statusChanged) {
+            partialRefreshStatus(status);
+        } else {
+            Serial.println("No changes — skipping display refresh.");
+        }
+        prev_status = status;
+    } else if (decoded) {
         // Fresh weather. Repaint if anything changed, on first boot, or when
         // coming back from the splash (which is currently the home screen).
+        // present() repaints only the dirty tiles when the panel still holds
+        // most of the previous frame, else does a full refresh.
         if (firstBoot || pngChanged || statusChanged || home_is_splash) {
             drawStatus(status);
-            pushDisplay();
+            present("Weather", WEATHER_CLEAR_CYCLES);
         } else {
             Serial.println("No changes — skipping display refresh.");
         }
         prev_status    = status;
         prev_png_hash  = newHash;
         home_is_splash = false;
+        bundle_shown_from = 0;
+        strncpy(prev_etag, fetchedEtag, sizeof(prev_etag) - 1);
+        prev_etag[sizeof(prev_etag) - 1] = '\0';
+        saveLastFrame(newHash);
     } else {
         // No fresh weather this wake (WiFi down, fetch failed, or decode failed).
-        bool giveUpWeather = (wifi_fail_streak >= WIFI_FAIL_SPLASH_THRESHOLD);
-        if (home_is_splash) {
+        bool giveUpWeather = wifi_fail_streak > 0
+            && (uint32_t)time(nullptr) - wifi_fail_since >= WIFI_FAIL_SPLASH_SECONDS;
+        if (bundleNow >= 0 && showBundleFrame(bundle, bundleNow, status)) {
+            // The forecast rendered ahead for this hour stands in for the live
+            // frame, status code and all — and holds off the splash while the
+            // bundle lasts.
+        } else if (home_is_splash) {
             // Already on the no-WiFi splash — recheck mode, leave it as-is.
             Serial.println("Still offline — staying on the no-WiFi splash.");
-        } else if (firstBoot || giveUpWeather) {
+        } else if ((firstBoot && !restored) || giveUpWeather) {
             // Nothing worth preserving (fresh boot, or a sustained outage) and the
             // fetch failed — show the informative no-WiFi splash.
             Serial.printf("No weather to show (firstBoot=%d, fail_streak=%u) — splash.\n",
@@ -1576,6 +3315,7 @@ void setup() {
             renderSplash(SPLASH_MSG_NO_WIFI);
             home_is_splash = true;
             prev_status    = ST_NONE;
+            bundle_shown_from = 0;
         } else if (statusChanged) {
             // Still have recent weather on screen — keep it, stamp the status code
             // (NET/SRV) in the corner via partial refresh. A failed fetch is
@@ -1589,15 +3329,32 @@ void setup() {
         }
     }
 
-    // Free PNG buffer before sleep.
-    if (pngBuf) { free(pngBuf); pngBuf = nullptr; pngLen = 0; }
+    // ── Battery log upload (batched, every BATTLOG_UPLOAD_WAKES) ─────────
+    if (fetchOk && battLogUploadDue(boot_count)) {
+        char id[13];
+        deviceId(id, sizeof(id));
+        battLogUpload(boot_count, id);
+    }
+
+    // ── Offline frame bundle refresh ─────────────────────────────────────
+    // While online anyway, keep the next hours of frames in flash for the
+    // wakes that won't be (see frame_bundle.h).
+    if (fetchOk && boot_count >= bundle_retry_boot) {
+        BundleInfo stored;
+        bool fresh = bundleLoad(stored)
+                  && (uint32_t)time(nullptr) - stored.generated < BUNDLE_REFRESH_S;
+        if (!fresh && !bundleFetch(cfg.zip.c_str())) {
+            bundle_retry_boot = boot_count + BUNDLE_RETRY_WAKES;
+        }
+    }
 
     // ── OTA update (piggybacked on the weather fetch) ────────────────────
     // The worker advertises the latest firmware version on every weather
     // response (X-Firmware-Latest → latestFirmwareAvail). If it's newer than
-    // what we're running, flash it now — after the weather is on screen, while
-    // WiFi is still up. applyOtaUpdate() reboots into the new slot on success
-    // (never returns).
+    // what we're running, move the update on now — after the weather is on
+    // screen, while WiFi is still up. Each wake adds one slice of the image
+    // (or applies a patch in one go); applyOtaUpdate() reboots into the new
+    // slot once the image is complete and verified.
     //
     // A version that just failed to flash is skipped only until its cooldown
     // elapses (boot_count reaches ota_retry_after_boot) — a transient error
@@ -1608,7 +3365,7 @@ void setup() {
     bool inFailCooldown = (latestFirmwareAvail == ota_failed_version
                            && boot_count < ota_retry_after_boot);
     if (fetchOk && latestFirmwareAvail > FIRMWARE_VERSION && !inFailCooldown) {
-        if (!applyOtaUpdate(latestFirmwareAvail)) {
+        if (applyOtaUpdate(latestFirmwareAvail) == OTA_FAILED) {
             ota_failed_version   = latestFirmwareAvail;
             ota_retry_after_boot = boot_count + OTA_FAIL_COOLDOWN_WAKES;
             logError(EK_OTA, (int16_t)g_otaError);
@@ -1619,15 +3376,15 @@ void setup() {
     }
     disconnectWiFi();
 
-    // Sleep cadence: normal on success; a faster retry on a transient failure;
-    // but once we've fallen back to the no-WiFi splash, recheck slowly to save
-    // battery (we've given up for now — no point retrying every 5 min).
-    uint32_t sleepMin = home_is_splash ? RECOVERY_SLEEP_MINUTES
-                      : (fetchOk ? SLEEP_MINUTES : RETRY_SLEEP_MINUTES);
+    RetryClass failure = !wifiOk  ? RC_WIFI
+                       : !fetchOk ? retryClassOf(g_fetchFail, g_fetchDetail)
+                       : (!notModified && !decoded) ? RC_CONTENT
+                       : RC_NONE;
+    uint32_t sleepS = scheduleSleepSeconds(failure);
     // Remember whether this wake logged any error, so the next wake's logError()
     // can coalesce a continuing failure (vs starting a new incident after a clean wake).
     last_wake_failed = wakeHadError;
-    enterDeepSleep(/*armTimer=*/true, sleepMin);
+    enterDeepSleep(/*armTimer=*/true, sleepS);
 }
 
 void loop() {
@@ -0,0 +1,1392 @@
+// Auto-generated by scripts/bake-menu.sh from worker/renderer/menu.png.
+// Do not edit by hand — re-run the script if the menu changes.
+// Run-length-coded 4bpp framebuffer (scripts/pack_4bpp.py, src/rle4.h).
+#pragma once
+#include <stdint.h>
+
+const uint8_t menu_4bpp[] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x00, 0xbf, 0x85, 0x88, 0x00, 0xf9,
+  0x84, 0xff, 0x00, 0xbf, 0x85, 0x88, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xca, 0xff, 0x00, 0x3f, 0x85, 0x00, 0x00, 0xf2, 0x84, 0xff,
+  0x00, 0x6f, 0x85, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xca, 0xff, 0x00, 0x3f, 0x85, 0x00, 0x00, 0xd0, 0x84, 0xff, 0x00, 0x3f,
+  0x85, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff,
+  0x00, 0x3f, 0x85, 0x00, 0x00, 0xa0, 0x84, 0xff, 0x00, 0x0f, 0x85, 0x00,
+  0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x00, 0x1f,
+  0x85, 0x00, 0x00, 0x60, 0x84, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x00, 0x0f, 0x85, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x08, 0x85, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x84, 0xff,
+  0x00, 0x05, 0x85, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xca, 0xff, 0x00, 0x0d, 0x86, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x00, 0x02,
+  0x85, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff,
+  0x00, 0x0b, 0x86, 0x00, 0x00, 0xf8, 0x82, 0xff, 0x00, 0xef, 0x86, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x00, 0x0b,
+  0x86, 0x00, 0x00, 0xf5, 0x82, 0xff, 0x00, 0xbf, 0x86, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x00, 0x0b, 0x82, 0x00,
+  0x00, 0x10, 0x82, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x00, 0x7f, 0x82, 0x00,
+  0x00, 0x03, 0x82, 0x00, 0x00, 0x50, 0x87, 0xff, 0x06, 0x9e, 0x46, 0x02,
+  0x00, 0x40, 0xb7, 0xfe, 0x8d, 0xff, 0x04, 0xae, 0x24, 0x00, 0x41, 0xa7,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff, 0x00, 0x07, 0x82, 0x00,
+  0x00, 0x50, 0x82, 0x00, 0x00, 0xe0, 0x82, 0xff, 0x00, 0x4f, 0x82, 0x00,
+  0x00, 0x06, 0x82, 0x00, 0x00, 0x30, 0x86, 0xff, 0x01, 0x6d, 0x01, 0x84,
+  0x00, 0x01, 0x70, 0xfe, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x02, 0xf7,
+  0xff, 0x7e, 0x84, 0x00, 0x00, 0xe5, 0x84, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x00, 0x07, 0x82, 0x00, 0x00, 0x90,
+  0x82, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x00, 0x2f, 0x82, 0x00, 0x00, 0x07,
+  0x82, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0x7f, 0x87, 0x00, 0x00, 0x91,
+  0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x02, 0xf4, 0xbf, 0x02, 0x84, 0x00,
+  0x01, 0x10, 0xfb, 0x83, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x93, 0xff, 0x00, 0x07, 0x82, 0x00, 0x00, 0xb0, 0x82, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x0d, 0x82, 0x00, 0x00, 0x09, 0x82, 0x00, 0x00,
+  0x30, 0x85, 0xff, 0x00, 0x06, 0x88, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00,
+  0x7f, 0x83, 0x00, 0x01, 0xf3, 0x09, 0x86, 0x00, 0x00, 0xe2, 0x83, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x00, 0x04,
+  0x82, 0x00, 0x00, 0xb0, 0x82, 0x00, 0x00, 0x30, 0x82, 0xff, 0x04, 0x0a,
+  0x00, 0x00, 0x10, 0x0b, 0x83, 0x00, 0x84, 0xff, 0x00, 0x3e, 0x89, 0x00,
+  0x00, 0x60, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x90, 0x87, 0x00,
+  0x00, 0x70, 0x83, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x93, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01, 0xb0, 0x04, 0x82, 0x00, 0x82,
+  0xff, 0x04, 0x07, 0x00, 0x00, 0x50, 0x0b, 0x83, 0x00, 0x84, 0xff, 0x00,
+  0x04, 0x8a, 0x00, 0x00, 0xf8, 0x82, 0xff, 0x00, 0x7f, 0x8c, 0x00, 0x01,
+  0x10, 0xfd, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x93, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01, 0xb0, 0x08, 0x82, 0x00, 0x07,
+  0xfc, 0xff, 0xff, 0x03, 0x00, 0x00, 0x80, 0x0b, 0x83, 0x00, 0x83, 0xff,
+  0x00, 0xaf, 0x84, 0x00, 0x01, 0x20, 0x25, 0x84, 0x00, 0x00, 0xc0, 0x82,
+  0xff, 0x00, 0x7f, 0x8d, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01,
+  0xb0, 0x0c, 0x82, 0x00, 0x07, 0xf9, 0xff, 0xff, 0x01, 0x00, 0x00, 0xc0,
+  0x0b, 0x83, 0x00, 0x00, 0xfc, 0x82, 0xff, 0x00, 0x2e, 0x83, 0x00, 0x03,
+  0x50, 0xfe, 0xff, 0x5f, 0x83, 0x00, 0x00, 0x40, 0x82, 0xff, 0x00, 0x7f,
+  0x86, 0x00, 0x01, 0x76, 0x07, 0x84, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x83, 0x00, 0x01,
+  0xb0, 0x0f, 0x82, 0x00, 0x02, 0xf5, 0xff, 0xcf, 0x82, 0x00, 0x01, 0xf0,
+  0x0b, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x06, 0x83, 0x00, 0x00,
+  0xf5, 0x82, 0xff, 0x00, 0x05, 0x83, 0x00, 0x03, 0xfc, 0xff, 0xff, 0x7f,
+  0x85, 0x00, 0x03, 0xe5, 0xff, 0xef, 0x01, 0x83, 0x00, 0x00, 0xf4, 0x82,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x83,
+  0x00, 0x01, 0xb0, 0x3f, 0x82, 0x00, 0x02, 0xf3, 0xff, 0x9f, 0x82, 0x00,
+  0x01, 0xf3, 0x0b, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x01, 0x83,
+  0x00, 0x00, 0xfe, 0x82, 0xff, 0x00, 0x0e, 0x83, 0x00, 0x03, 0xf5, 0xff,
+  0xff, 0x7f, 0x84, 0x00, 0x00, 0x60, 0x82, 0xff, 0x00, 0x06, 0x83, 0x00,
+  0x00, 0xf3, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x93, 0xff, 0x83, 0x00, 0x01, 0xb0, 0x7f, 0x82, 0x00, 0x02, 0xe0, 0xff,
+  0x6f, 0x82, 0x00, 0x01, 0xf7, 0x0b, 0x83, 0x00, 0x03, 0xf9, 0xff, 0xff,
+  0xaf, 0x83, 0x00, 0x00, 0x60, 0x83, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x03,
+  0xf0, 0xff, 0xff, 0x7f, 0x84, 0x00, 0x00, 0xf4, 0x82, 0xff, 0x00, 0x0b,
+  0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb,
+  0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x92, 0xff, 0x00, 0xbf, 0x83, 0x00, 0x01, 0xb0, 0xbf, 0x82,
+  0x00, 0x02, 0xb0, 0xff, 0x3f, 0x82, 0x00, 0x01, 0xfa, 0x0b, 0x83, 0x00,
+  0x03, 0xf7, 0xff, 0xff, 0x5f, 0x83, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x00,
+  0xbf, 0x83, 0x00, 0x03, 0xc0, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x01, 0x10,
+  0xfe, 0x82, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0xbf, 0x83,
+  0x00, 0x01, 0xb0, 0xff, 0x82, 0x00, 0x02, 0x70, 0xff, 0x0f, 0x82, 0x00,
+  0x01, 0xfe, 0x0f, 0x83, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x1f, 0x83, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x00, 0xbf, 0x83, 0x00, 0x03, 0x80, 0xff, 0xff,
+  0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00,
+  0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00,
+  0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92,
+  0xff, 0x00, 0xbf, 0x83, 0x00, 0x0c, 0xb0, 0xff, 0x03, 0x00, 0x00, 0x30,
+  0xff, 0x0c, 0x00, 0x00, 0x10, 0xff, 0x0f, 0x83, 0x00, 0x03, 0xf6, 0xff,
+  0xff, 0x0c, 0x83, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0xdf, 0x83, 0x00,
+  0x03, 0x50, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x9f, 0x83, 0x00, 0x0c, 0xb0, 0xff,
+  0x06, 0x00, 0x00, 0x10, 0xff, 0x08, 0x00, 0x00, 0x50, 0xff, 0x0f, 0x83,
+  0x00, 0x03, 0xf3, 0xff, 0xff, 0x0b, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff,
+  0x83, 0x00, 0x03, 0x30, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x02,
+  0xb0, 0xff, 0x0a, 0x82, 0x00, 0x06, 0xfc, 0x05, 0x00, 0x00, 0x80, 0xff,
+  0x0f, 0x83, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x0a, 0x8d, 0x00, 0x03, 0x30,
+  0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x92, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x02, 0xb0, 0xff, 0x0e, 0x82,
+  0x00, 0x06, 0xf9, 0x03, 0x00, 0x00, 0xc0, 0xff, 0x0f, 0x83, 0x00, 0x03,
+  0xf3, 0xff, 0xff, 0x07, 0x8d, 0x00, 0x03, 0x30, 0xff, 0xff, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00,
+  0x6f, 0x83, 0x00, 0x02, 0xf0, 0xff, 0x2f, 0x82, 0x00, 0x00, 0xf6, 0x82,
+  0x00, 0x02, 0xf0, 0xff, 0x0f, 0x83, 0x00, 0x03, 0xf1, 0xff, 0xff, 0x07,
+  0x8e, 0x00, 0x02, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x02, 0xf0,
+  0xff, 0x5f, 0x82, 0x00, 0x00, 0xb3, 0x82, 0x00, 0x02, 0xf3, 0xff, 0x2f,
+  0x83, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x07, 0x8d, 0x00, 0x03, 0x20, 0xff,
+  0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x92, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x02, 0xf0, 0xff, 0x9f, 0x82, 0x00,
+  0x00, 0x70, 0x82, 0x00, 0x02, 0xf7, 0xff, 0x3f, 0x83, 0x00, 0x03, 0xf0,
+  0xff, 0xff, 0x07, 0x8d, 0x00, 0x03, 0x30, 0xff, 0xff, 0x7f, 0x83, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x3f,
+  0x83, 0x00, 0x02, 0xf0, 0xff, 0xdf, 0x82, 0x00, 0x00, 0x10, 0x82, 0x00,
+  0x02, 0xfb, 0xff, 0x3f, 0x83, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x07, 0x8d,
+  0x00, 0x03, 0x30, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x1f, 0x83, 0x00, 0x03, 0xf0,
+  0xff, 0xff, 0x01, 0x85, 0x00, 0x02, 0xfe, 0xff, 0x3f, 0x83, 0x00, 0x03,
+  0xb0, 0xff, 0xff, 0x09, 0x83, 0x00, 0x00, 0xf3, 0x8b, 0xff, 0x00, 0x7f,
+  0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f,
+  0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x05, 0x84, 0x00, 0x03,
+  0x20, 0xff, 0xff, 0x3f, 0x83, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x0b, 0x83,
+  0x00, 0x00, 0xe0, 0x8b, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x03,
+  0xf2, 0xff, 0xff, 0x08, 0x84, 0x00, 0x03, 0x50, 0xff, 0xff, 0x4f, 0x83,
+  0x00, 0x03, 0xb0, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0x8b, 0xff,
+  0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x92, 0xff, 0x00, 0x0d, 0x83, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x0c, 0x84,
+  0x00, 0x03, 0x90, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff,
+  0x3f, 0x83, 0x00, 0x00, 0x60, 0x8b, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x0b, 0x83,
+  0x00, 0x03, 0xf3, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x03, 0xc0, 0xff, 0xff,
+  0x7f, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff, 0x8f, 0x83, 0x00, 0x01, 0x10,
+  0xfd, 0x85, 0xff, 0x00, 0xfd, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x0b, 0x83,
+  0x00, 0x03, 0xf3, 0xff, 0xff, 0x4f, 0x84, 0x00, 0x03, 0xf0, 0xff, 0xff,
+  0x7f, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff, 0xdf, 0x84, 0x00, 0x00, 0xf4,
+  0x84, 0xff, 0x01, 0x5e, 0xd1, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00,
+  0x04, 0x83, 0x00, 0x03, 0xf5, 0xff, 0xff, 0x9f, 0x84, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x0b, 0x83, 0x00,
+  0x03, 0xf3, 0xff, 0xff, 0x7f, 0x84, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x7f,
+  0x83, 0x00, 0x00, 0x40, 0x82, 0xff, 0x00, 0x05, 0x83, 0x00, 0x01, 0x40,
+  0xfb, 0x82, 0xff, 0x02, 0x8e, 0x01, 0x30, 0x83, 0xff, 0x00, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x03, 0xc0, 0xff, 0xff, 0x09, 0x84, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x07,
+  0x83, 0x00, 0x03, 0xf3, 0xff, 0xff, 0xbf, 0x84, 0x00, 0x03, 0xf7, 0xff,
+  0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0d, 0x84, 0x00,
+  0x03, 0x40, 0x98, 0x9c, 0x48, 0x82, 0x00, 0x00, 0xf6, 0x82, 0xff, 0x00,
+  0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00,
+  0xf0, 0x82, 0xff, 0x00, 0x08, 0x83, 0x00, 0x02, 0x10, 0x87, 0x28, 0x85,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf5, 0x82, 0xff, 0x84, 0x00, 0x03, 0xfb, 0xff,
+  0xff, 0xbf, 0x83, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x8f, 0x8b, 0x00,
+  0x00, 0xa0, 0x82, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0b, 0x8c, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x07,
+  0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0xbc, 0x83, 0xbb, 0x03, 0xfe,
+  0xff, 0xff, 0xbf, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x03, 0x8a,
+  0x00, 0x04, 0x10, 0xfd, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x1f, 0x8c,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00,
+  0x04, 0x83, 0x00, 0x00, 0xf7, 0x8a, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x83,
+  0xff, 0x00, 0x2e, 0x8b, 0x00, 0x03, 0xf9, 0xff, 0xff, 0x7f, 0x83, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x00, 0x9f, 0x87, 0x00, 0x00, 0x90, 0x83, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf7,
+  0x8a, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x83, 0xff, 0x01, 0xef, 0x05, 0x89,
+  0x00, 0x00, 0xc2, 0x82, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0x01, 0x86,
+  0x00, 0x01, 0xf9, 0x03, 0x82, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x92, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf7, 0x8a, 0xff,
+  0x00, 0xbf, 0x84, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x88, 0x00, 0x00, 0x70,
+  0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0b,
+  0x83, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0x0c, 0x85, 0x00, 0x02, 0x90,
+  0xff, 0x03, 0x82, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x92, 0xff, 0x00, 0x02, 0x83, 0x00, 0x00, 0xf7, 0x8a, 0xff, 0x00, 0xdf,
+  0x84, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7e, 0x86, 0x00, 0x01, 0x91,
+  0xfe, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x0b, 0x83, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x01, 0xcf, 0x02, 0x83, 0x00,
+  0x03, 0x30, 0xfd, 0xff, 0x04, 0x82, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xb0, 0xff, 0x06, 0xbf, 0x37, 0x01, 0x00, 0x00, 0x43,
+  0xd9, 0x9a, 0xff, 0x05, 0x9f, 0x05, 0x00, 0x00, 0x73, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0xff, 0x33,
+  0xff, 0x33, 0xff, 0x33, 0xa3, 0x33, 0xbb, 0xff, 0xff, 0x33, 0xff, 0x33,
+  0xff, 0x33, 0xa3, 0x33, 0xbb, 0xff, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33,
+  0xa3, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0x02, 0xdf,
+  0x58, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x03, 0x1a,
+  0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0xff, 0x04,
+  0xef, 0x01, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xda, 0xff, 0x00, 0xaf, 0x82, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xb5, 0xff, 0x00, 0x8f, 0x83, 0x88, 0x01, 0xa8, 0xcc,
+  0x9d, 0xff, 0x00, 0xcf, 0x82, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb5, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x01, 0x40, 0xd9, 0x9c,
+  0xff, 0x03, 0x04, 0x00, 0x00, 0xe0, 0xb7, 0xff, 0x00, 0xdf, 0xff, 0xff,
+  0xff, 0xff, 0xfc, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xd5, 0x9b, 0xff,
+  0x03, 0x6e, 0x00, 0x20, 0xfc, 0xb4, 0xff, 0x03, 0x8b, 0x46, 0x03, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0xf8,
+  0x9b, 0xff, 0x01, 0xcf, 0xfe, 0xb5, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0x60,
+  0xd3, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x01, 0x33, 0x33, 0x84, 0x00, 0x00, 0xf6,
+  0xd2, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xfc,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x03, 0xff, 0xff, 0xaf, 0x03, 0x82, 0x00,
+  0x00, 0xb0, 0xd2, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff,
+  0xff, 0xfc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x82, 0xff, 0x00, 0x5f, 0x82,
+  0x00, 0x00, 0x40, 0x84, 0xff, 0x04, 0x6d, 0x14, 0x00, 0x20, 0xb7, 0x82,
+  0xff, 0x00, 0x8d, 0x82, 0x88, 0x00, 0xfd, 0x82, 0xff, 0x08, 0x8d, 0x88,
+  0x88, 0x98, 0xff, 0x89, 0x88, 0x88, 0xd8, 0x84, 0xff, 0x04, 0x5b, 0x04,
+  0x00, 0x30, 0xb7, 0x84, 0xff, 0x05, 0xae, 0x24, 0x00, 0x10, 0xa5, 0xfe,
+  0x89, 0xff, 0x05, 0xdf, 0x49, 0x00, 0x00, 0x30, 0xa6, 0x85, 0xff, 0x04,
+  0x9e, 0x24, 0x00, 0x10, 0xa5, 0x82, 0xff, 0x10, 0x9f, 0x88, 0x04, 0x00,
+  0x00, 0x40, 0x88, 0x88, 0xf8, 0xff, 0x8d, 0x88, 0x88, 0x98, 0xff, 0xff,
+  0xdf, 0x82, 0x88, 0x02, 0xf9, 0xff, 0xff, 0x82, 0x88, 0x05, 0xfd, 0xdf,
+  0x27, 0x00, 0x20, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x83, 0xff, 0x00, 0x02, 0x82, 0x00, 0x00, 0xfc, 0x82, 0xff,
+  0x00, 0x5e, 0x84, 0x00, 0x03, 0xc4, 0xff, 0xff, 0x0e, 0x82, 0x00, 0x00,
+  0xf8, 0x82, 0xff, 0x08, 0x07, 0x00, 0x00, 0x60, 0xff, 0x03, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x00, 0x2a, 0x84, 0x00, 0x00, 0xc4, 0x82, 0xff, 0x01,
+  0x8f, 0x01, 0x83, 0x00, 0x00, 0xa2, 0x88, 0xff, 0x01, 0xef, 0x08, 0x84,
+  0x00, 0x00, 0xa2, 0x83, 0xff, 0x01, 0x8f, 0x01, 0x83, 0x00, 0x03, 0xa2,
+  0xff, 0xff, 0x3f, 0x86, 0x00, 0x08, 0xf2, 0xff, 0x0b, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00, 0x01,
+  0xfa, 0x07, 0x82, 0x00, 0x01, 0x10, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xe1,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x0b, 0x82, 0x00, 0x04,
+  0xf8, 0xff, 0xff, 0xcf, 0x02, 0x84, 0x00, 0x03, 0x10, 0xfb, 0xff, 0x4f,
+  0x82, 0x00, 0x00, 0xf5, 0x82, 0xff, 0x08, 0x03, 0x00, 0x00, 0xc0, 0xff,
+  0x03, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x8f, 0x86, 0x00, 0x03, 0xf8,
+  0xff, 0xff, 0x06, 0x85, 0x00, 0x00, 0xf7, 0x87, 0xff, 0x00, 0x3e, 0x86,
+  0x00, 0x04, 0xf4, 0xff, 0xff, 0xef, 0x06, 0x85, 0x00, 0x02, 0xf7, 0xff,
+  0x3f, 0x86, 0x00, 0x08, 0xf4, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0x67, 0x84,
+  0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x83, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x03, 0xf5, 0xff, 0xff, 0x1d,
+  0x86, 0x00, 0x02, 0xc0, 0xff, 0x9f, 0x82, 0x00, 0x00, 0xf2, 0x82, 0xff,
+  0x82, 0x00, 0x05, 0xf1, 0xff, 0x03, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00,
+  0x06, 0x86, 0x00, 0x02, 0xfb, 0xff, 0x4f, 0x86, 0x00, 0x00, 0x70, 0x87,
+  0xff, 0x00, 0x04, 0x86, 0x00, 0x03, 0xf4, 0xff, 0xff, 0x3f, 0x86, 0x00,
+  0x02, 0x70, 0xff, 0x3f, 0x86, 0x00, 0x08, 0xf7, 0xff, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00,
+  0x00, 0x01, 0x85, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x4f, 0x82, 0x00, 0x0d, 0xf2,
+  0xff, 0xff, 0x04, 0x00, 0x00, 0x10, 0x65, 0x02, 0x00, 0x00, 0x20, 0xfe,
+  0xef, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x08, 0xf6,
+  0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xaf, 0x86, 0x00, 0x03, 0x70,
+  0xff, 0xff, 0x09, 0x82, 0x00, 0x01, 0x73, 0x03, 0x82, 0x00, 0x00, 0xfb,
+  0x85, 0xff, 0x00, 0xbf, 0x87, 0x00, 0x03, 0xfd, 0xff, 0xff, 0x07, 0x82,
+  0x00, 0x01, 0x74, 0x03, 0x82, 0x00, 0x01, 0xfb, 0x3f, 0x86, 0x00, 0x08,
+  0xf9, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0xff, 0x89, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xe0,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x02,
+  0xf0, 0xff, 0x8f, 0x82, 0x00, 0x02, 0xf5, 0xff, 0x7f, 0x82, 0x00, 0x08,
+  0xf9, 0xff, 0x04, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x08,
+  0xfb, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x1e, 0x82, 0x00, 0x0c,
+  0x60, 0xb9, 0x58, 0x00, 0xf2, 0xff, 0xef, 0x01, 0x00, 0x00, 0xc0, 0xff,
+  0xcf, 0x82, 0x00, 0x00, 0xf4, 0x85, 0xff, 0x00, 0x4f, 0x82, 0x00, 0x0d,
+  0xe5, 0xff, 0xac, 0x05, 0x80, 0xff, 0xff, 0xdf, 0x01, 0x00, 0x00, 0xc0,
+  0xff, 0xcf, 0x82, 0x00, 0x11, 0xf4, 0x9f, 0x77, 0x03, 0x00, 0x00, 0x30,
+  0x77, 0x77, 0xfd, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82,
+  0x00, 0x02, 0xf3, 0xff, 0xff, 0x83, 0x00, 0x02, 0x90, 0xde, 0x0a, 0x82,
+  0x00, 0x00, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x83, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x02, 0xf0, 0xff, 0x2f, 0x82,
+  0x00, 0x0e, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0xf2, 0xff, 0x09, 0x00,
+  0x00, 0x60, 0xff, 0xff, 0x4f, 0x82, 0x00, 0x08, 0xff, 0xff, 0x03, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0x08, 0x82, 0x00, 0x06, 0xfa, 0xff, 0xff, 0x4d,
+  0xfd, 0xff, 0x8f, 0x82, 0x00, 0x06, 0xf9, 0xff, 0xff, 0x09, 0x00, 0x00,
+  0xb0, 0x85, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x07, 0xfc, 0xff, 0xff, 0xdf,
+  0xf6, 0xff, 0xff, 0x6f, 0x82, 0x00, 0x0c, 0xf9, 0xff, 0xff, 0x07, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x0b,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff,
+  0x83, 0x00, 0x02, 0xfc, 0xff, 0xcf, 0x82, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x9f,
+  0x82, 0x00, 0x05, 0xd0, 0xff, 0x0d, 0x00, 0x00, 0x60, 0x82, 0xff, 0x1a,
+  0x09, 0x00, 0x00, 0xd0, 0xff, 0x0d, 0x00, 0x00, 0x30, 0xff, 0xff, 0x1f,
+  0x00, 0x00, 0x50, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0x60, 0x85, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x82, 0xff, 0x03,
+  0x0e, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x2f, 0x82, 0x00, 0x00, 0xf9,
+  0x85, 0xff, 0x03, 0x2f, 0x00, 0x00, 0x10, 0x82, 0xff, 0x09, 0x0d, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x0b,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x03, 0x02, 0x00, 0x00, 0x70, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x05, 0xb0, 0xff, 0x08, 0x00, 0x00, 0x90, 0x82, 0xff,
+  0x05, 0x0b, 0x00, 0x00, 0x90, 0xff, 0x2f, 0x82, 0x00, 0x0d, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xcf,
+  0x82, 0x00, 0x00, 0xd0, 0x85, 0xff, 0x03, 0x0d, 0x00, 0x00, 0x30, 0x82,
+  0xff, 0x03, 0x1f, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0x4f, 0x82, 0x00,
+  0x01, 0x70, 0xfd, 0x84, 0xff, 0x03, 0x0d, 0x00, 0x00, 0x30, 0x82, 0xff,
+  0x09, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83,
+  0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x03, 0x06, 0x00,
+  0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x83, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x05, 0xc0, 0xff, 0x04, 0x00, 0x00,
+  0xb0, 0x82, 0xff, 0x05, 0x0c, 0x00, 0x00, 0x70, 0xff, 0x8f, 0x82, 0x00,
+  0x0d, 0xfb, 0xff, 0x08, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0x8f, 0x82, 0x00, 0x00, 0xf2, 0x85, 0xff, 0x03, 0x0b, 0x00,
+  0x00, 0x60, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x85, 0xff, 0x00, 0x8f,
+  0x83, 0x00, 0x01, 0x30, 0xd7, 0x83, 0xff, 0x03, 0x0a, 0x00, 0x00, 0x70,
+  0x82, 0xff, 0x00, 0x2f, 0x82, 0x00, 0x05, 0xff, 0xff, 0x07, 0x00, 0x00,
+  0x70, 0x83, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82,
+  0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x03,
+  0x08, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x83, 0xff, 0x00, 0x8f, 0x82, 0x00, 0x05, 0xf0, 0xff, 0x03,
+  0x00, 0x00, 0x40, 0x82, 0x44, 0x05, 0x04, 0x00, 0x00, 0x60, 0xff, 0xdf,
+  0x82, 0x00, 0x0d, 0xf7, 0xff, 0x05, 0x00, 0x00, 0xf5, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x03,
+  0x07, 0x00, 0x00, 0x20, 0x82, 0x44, 0x00, 0x14, 0x82, 0x00, 0x86, 0xff,
+  0x00, 0x02, 0x84, 0x00, 0x07, 0xa3, 0xfe, 0xff, 0xff, 0x07, 0x00, 0x00,
+  0x20, 0x82, 0x44, 0x00, 0x14, 0x82, 0x00, 0x05, 0xff, 0xff, 0x07, 0x00,
+  0x00, 0x70, 0x83, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf,
+  0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x03, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x02, 0xf0, 0xff,
+  0x03, 0x88, 0x00, 0x13, 0x30, 0xff, 0xff, 0x02, 0x00, 0x00, 0xf3, 0xff,
+  0x02, 0x00, 0x00, 0xf9, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0x6f,
+  0x82, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x07, 0x89, 0x00, 0x86, 0xff,
+  0x00, 0x0c, 0x85, 0x00, 0x03, 0xc3, 0xff, 0xff, 0x07, 0x89, 0x00, 0x05,
+  0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x00, 0x0b, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff,
+  0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x5f, 0x82, 0x00,
+  0x01, 0xf0, 0xff, 0x89, 0x00, 0x07, 0x30, 0xff, 0xff, 0x08, 0x00, 0x00,
+  0xf1, 0xdf, 0x82, 0x00, 0x08, 0xfe, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0,
+  0xff, 0x3f, 0x82, 0x00, 0x00, 0xf5, 0x85, 0xff, 0x00, 0x07, 0x89, 0x00,
+  0x86, 0xff, 0x01, 0xef, 0x03, 0x85, 0x00, 0x02, 0xfa, 0xff, 0x07, 0x89,
+  0x00, 0x05, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x0b,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0b, 0x82, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x3f,
+  0x82, 0x00, 0x02, 0xf4, 0xff, 0x03, 0x88, 0x00, 0x0a, 0x30, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0xc0, 0x9f, 0x00, 0x00, 0x40, 0x82, 0xff, 0x05, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0x6f, 0x82, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00,
+  0x07, 0x89, 0x00, 0x87, 0xff, 0x01, 0xaf, 0x04, 0x84, 0x00, 0x02, 0xe1,
+  0xff, 0x07, 0x89, 0x00, 0x05, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83,
+  0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0b, 0x82,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83,
+  0xff, 0x00, 0x0d, 0x82, 0x00, 0x05, 0xf8, 0xff, 0x03, 0x00, 0x00, 0x50,
+  0x85, 0x77, 0x0a, 0xb7, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x80, 0x5f, 0x00,
+  0x00, 0x90, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x82,
+  0x00, 0x00, 0xf3, 0x85, 0xff, 0x03, 0x07, 0x00, 0x00, 0x30, 0x86, 0x77,
+  0x88, 0xff, 0x01, 0xdf, 0x38, 0x83, 0x00, 0x05, 0x40, 0xff, 0x07, 0x00,
+  0x00, 0x30, 0x86, 0x77, 0x05, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0x83,
+  0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x03, 0x08, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x83, 0xff, 0x00, 0x07, 0x82, 0x00, 0x05, 0xfc, 0xff, 0x05, 0x00, 0x00,
+  0x90, 0x88, 0xff, 0x07, 0x6f, 0x00, 0x00, 0x50, 0x3f, 0x00, 0x00, 0xe0,
+  0x82, 0xff, 0x05, 0x03, 0x00, 0x00, 0xb0, 0xff, 0x8f, 0x82, 0x00, 0x00,
+  0xf2, 0x85, 0xff, 0x03, 0x0a, 0x00, 0x00, 0x30, 0x91, 0xff, 0x00, 0x7d,
+  0x82, 0x00, 0x05, 0x30, 0xff, 0x0a, 0x00, 0x00, 0x40, 0x88, 0xff, 0x03,
+  0x07, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x03, 0x07, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xe0,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x82, 0xff, 0x00, 0xcf, 0x82, 0x00, 0x06,
+  0x20, 0xff, 0xff, 0x09, 0x00, 0x00, 0x50, 0x88, 0xff, 0x07, 0xcf, 0x00,
+  0x00, 0x20, 0x0e, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xcf, 0x82, 0x00, 0x00, 0xb0, 0x85, 0xff, 0x00, 0x0e, 0x82,
+  0x00, 0x92, 0xff, 0x00, 0x0a, 0x82, 0x00, 0x04, 0xff, 0x0e, 0x00, 0x00,
+  0x10, 0x88, 0xff, 0x03, 0x09, 0x00, 0x00, 0x50, 0x83, 0xff, 0x06, 0x0b,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x03, 0x03, 0x00, 0x00, 0x70, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x82, 0xff, 0x00,
+  0x09, 0x82, 0x00, 0x03, 0x90, 0xff, 0xff, 0x0d, 0x82, 0x00, 0x00, 0xfc,
+  0x82, 0xff, 0x01, 0xdf, 0xfe, 0x83, 0xff, 0x06, 0x01, 0x00, 0x00, 0x08,
+  0x00, 0x00, 0xf8, 0x82, 0xff, 0x09, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0x02, 0x00, 0x00, 0x40, 0x82, 0xff, 0x03, 0xef, 0xff, 0xff, 0x1f, 0x82,
+  0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0xfc, 0x87, 0xff, 0x00, 0xbf, 0x83,
+  0xff, 0x00, 0x0c, 0x82, 0x00, 0x01, 0xff, 0x1f, 0x82, 0x00, 0x00, 0xf8,
+  0x83, 0xff, 0x00, 0xfc, 0x82, 0xff, 0x03, 0x0b, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x06, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3e, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0xff, 0x82, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xdf, 0x82, 0x00,
+  0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x02, 0xcc, 0xac, 0x37, 0x83, 0x00, 0x03, 0xf2, 0xff, 0xff, 0x4f, 0x82,
+  0x00, 0x05, 0xd3, 0xff, 0xff, 0xef, 0x19, 0xf5, 0x83, 0xff, 0x06, 0x06,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0xfd, 0x82, 0xff, 0x06, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x08, 0x82, 0x00, 0x06, 0xd4, 0xff, 0xdf, 0x06, 0xfb,
+  0xff, 0x9f, 0x82, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x01, 0x3b, 0xd1, 0x87,
+  0xff, 0x01, 0x07, 0xb2, 0x82, 0xff, 0x05, 0x08, 0x00, 0x00, 0x10, 0xff,
+  0x9f, 0x82, 0x00, 0x00, 0xb1, 0x82, 0xff, 0x01, 0x3b, 0xd1, 0x82, 0xff,
+  0x00, 0x0d, 0x82, 0x00, 0x04, 0xfc, 0xdf, 0xfc, 0xff, 0x0c, 0x82, 0x00,
+  0x02, 0xfe, 0xff, 0x06, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x82, 0x00,
+  0x03, 0x10, 0xfc, 0xff, 0x3e, 0x82, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x04, 0x20, 0xfe, 0xff, 0xff,
+  0xbf, 0x83, 0x00, 0x04, 0x87, 0x9c, 0x16, 0x00, 0x80, 0x83, 0xff, 0x00,
+  0x0c, 0x83, 0x00, 0x00, 0x20, 0x83, 0xff, 0x06, 0x03, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x1e, 0x83, 0x00, 0x05, 0x41, 0x01, 0x00, 0xe1, 0xff, 0xef,
+  0x83, 0x00, 0x04, 0x84, 0xab, 0x38, 0x00, 0x30, 0x86, 0xff, 0x05, 0x9f,
+  0x00, 0x00, 0x73, 0xc9, 0x6c, 0x82, 0x00, 0x02, 0x50, 0xff, 0xef, 0x83,
+  0x00, 0x04, 0x84, 0xab, 0x38, 0x00, 0x40, 0x82, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x04, 0x30, 0x01, 0xf3, 0xff, 0x0f, 0x82, 0x00, 0x01, 0x83, 0x16,
+  0x83, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x83, 0x00, 0x02, 0x51, 0x68, 0x02,
+  0x82, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f,
+  0x88, 0x00, 0x00, 0xe2, 0x83, 0xff, 0x00, 0x06, 0x87, 0x00, 0x00, 0xfc,
+  0x82, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x70, 0x83, 0xff, 0x06, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xbf, 0x86, 0x00, 0x03, 0x50, 0xff, 0xff,
+  0x0b, 0x87, 0x00, 0x00, 0xf6, 0x85, 0xff, 0x00, 0x0a, 0x87, 0x00, 0x03,
+  0xd0, 0xff, 0xff, 0x0b, 0x87, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x5f, 0x84,
+  0x00, 0x02, 0x90, 0xff, 0x1f, 0x88, 0x00, 0x02, 0xf3, 0xff, 0xff, 0x88,
+  0x00, 0x01, 0x10, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0x00, 0x0f,
+  0x87, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x3f, 0x87, 0x00, 0x00, 0xf6,
+  0x82, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x03, 0x03,
+  0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x09, 0x86, 0x00, 0x02, 0xf8, 0xff,
+  0x9f, 0x87, 0x00, 0x00, 0xe1, 0x85, 0xff, 0x00, 0x05, 0x87, 0x00, 0x03,
+  0xf9, 0xff, 0xff, 0x9f, 0x87, 0x00, 0x03, 0xf1, 0xff, 0xff, 0xdf, 0x84,
+  0x00, 0x02, 0x20, 0xff, 0xaf, 0x84, 0x00, 0x06, 0x20, 0x02, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0x88, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xe1,
+  0xff, 0x00, 0x0f, 0x86, 0x00, 0x01, 0x60, 0xfd, 0x85, 0xff, 0x00, 0x05,
+  0x85, 0x00, 0x00, 0xb2, 0x83, 0xff, 0x00, 0xaf, 0x83, 0x00, 0x00, 0xf1,
+  0x83, 0xff, 0x03, 0x03, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0xbf, 0x85,
+  0x00, 0x04, 0x30, 0xfd, 0xff, 0xff, 0x09, 0x85, 0x00, 0x01, 0x70, 0xfe,
+  0x85, 0xff, 0x00, 0x8f, 0x86, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x09,
+  0x85, 0x00, 0x00, 0x80, 0x83, 0xff, 0x00, 0x08, 0x84, 0x00, 0x02, 0xf9,
+  0xff, 0x03, 0x83, 0x00, 0x06, 0xc1, 0x07, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0x60, 0x84, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0xff,
+  0xe1, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x33, 0xb7, 0x87, 0xff, 0x01,
+  0xbf, 0x03, 0x83, 0x00, 0x00, 0x91, 0x85, 0xff, 0x83, 0x00, 0x00, 0xf6,
+  0x83, 0xff, 0x03, 0x03, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x01, 0x7d, 0x01,
+  0x82, 0x00, 0x01, 0x30, 0xfb, 0x82, 0xff, 0x01, 0xef, 0x07, 0x83, 0x00,
+  0x01, 0x50, 0xfe, 0x87, 0xff, 0x01, 0x8e, 0x01, 0x83, 0x00, 0x01, 0x70,
+  0xfe, 0x83, 0xff, 0x01, 0xdf, 0x05, 0x83, 0x00, 0x01, 0x70, 0xfe, 0x83,
+  0xff, 0x01, 0xbf, 0x01, 0x82, 0x00, 0x03, 0x70, 0xfe, 0xff, 0x6e, 0x82,
+  0x00, 0x07, 0x50, 0xfe, 0x07, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x82, 0x00,
+  0x01, 0xf0, 0x0a, 0x82, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xf3,
+  0xff, 0x04, 0xef, 0x7a, 0x36, 0x86, 0xeb, 0x98, 0xff, 0x04, 0xbf, 0x77,
+  0x64, 0xb7, 0xfd, 0x85, 0xff, 0x03, 0x7b, 0x47, 0x75, 0xdb, 0x8a, 0xff,
+  0x04, 0xdf, 0x79, 0x36, 0x75, 0xc8, 0x87, 0xff, 0x03, 0x7b, 0x47, 0x75,
+  0xdb, 0x86, 0xff, 0x04, 0xbe, 0x68, 0x53, 0xa7, 0xfe, 0x82, 0xff, 0x03,
+  0x8c, 0x36, 0x87, 0xfe, 0x86, 0xff, 0x82, 0x00, 0x04, 0xf0, 0xef, 0x7b,
+  0x65, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x02, 0x53,
+  0x87, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0x01, 0xcc, 0xfc, 0xcc, 0xff, 0x01,
+  0xcc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0xff, 0x04, 0xdf,
+  0x44, 0x00, 0x00, 0xf7, 0xcc, 0xff, 0x03, 0x07, 0x00, 0x30, 0x94, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00,
+  0xf7, 0xcc, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0xff, 0x00, 0x8f, 0x83, 0x88, 0x01, 0xa8, 0xcc, 0x92, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x00, 0xf7, 0xcc, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x01, 0x40,
+  0xd9, 0x90, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0xcc, 0xff, 0x03,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x00, 0x0f,
+  0x87, 0x00, 0x00, 0xd5, 0x8f, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7,
+  0xcc, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0xf8, 0x8e, 0xff, 0x00, 0xbf, 0x82,
+  0x00, 0x00, 0xf7, 0xcc, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff,
+  0xff, 0xff, 0xef, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0x60, 0x8e, 0xff,
+  0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x9d, 0xff, 0x01, 0xaf, 0xc2, 0xac,
+  0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x01, 0x33, 0x33, 0x84, 0x00, 0x00, 0xf6, 0x8d,
+  0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x9c, 0xff, 0x02, 0xae, 0x02,
+  0x70, 0xac, 0xff, 0x03, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff,
+  0xef, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x03, 0xff, 0xff, 0xaf, 0x03, 0x82,
+  0x00, 0x00, 0xb0, 0x8d, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x99,
+  0xff, 0x05, 0xcf, 0xcc, 0x48, 0x00, 0x00, 0x30, 0xac, 0xff, 0x03, 0x07,
+  0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x82, 0xff, 0x00, 0x5f, 0x82, 0x00, 0x00, 0x40, 0x84, 0xff, 0x04,
+  0x6d, 0x14, 0x00, 0x20, 0xb7, 0x83, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x05,
+  0xf7, 0xaf, 0x05, 0x00, 0x50, 0xfb, 0x82, 0xff, 0x00, 0xdf, 0x82, 0x88,
+  0x06, 0xf9, 0xff, 0xff, 0x8d, 0x88, 0x88, 0xb8, 0x83, 0xff, 0x02, 0xaf,
+  0x46, 0x01, 0x85, 0x00, 0x00, 0xfd, 0x84, 0xff, 0x0f, 0xdf, 0x88, 0x88,
+  0x98, 0xff, 0xaf, 0x05, 0x00, 0x61, 0xfd, 0xff, 0xdf, 0x28, 0x00, 0x41,
+  0xfa, 0x85, 0xff, 0x05, 0x6c, 0x04, 0x00, 0x10, 0xa6, 0xfe, 0x85, 0xff,
+  0x08, 0xbf, 0x25, 0x00, 0x53, 0xfa, 0x07, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x04, 0x5b, 0x03, 0x00, 0x40, 0xd8, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x02, 0x82, 0x00, 0x00, 0xfc,
+  0x82, 0xff, 0x00, 0x5e, 0x84, 0x00, 0x00, 0xc4, 0x82, 0xff, 0x00, 0xbf,
+  0x82, 0x00, 0x01, 0xe7, 0x04, 0x82, 0x00, 0x04, 0x50, 0xfe, 0xff, 0xff,
+  0xbf, 0x82, 0x00, 0x06, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x01, 0xaf, 0x02, 0x87, 0x00, 0x00, 0xf8, 0x84, 0xff, 0x00, 0xbf,
+  0x82, 0x00, 0x01, 0xef, 0x04, 0x82, 0x00, 0x02, 0xc1, 0xff, 0x1a, 0x82,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x3c, 0x84, 0x00, 0x00, 0xa2, 0x84,
+  0xff, 0x01, 0xef, 0x04, 0x82, 0x00, 0x04, 0x50, 0x06, 0x00, 0x00, 0x70,
+  0x83, 0xff, 0x00, 0x2a, 0x84, 0x00, 0x00, 0xe6, 0xff, 0xff, 0xff, 0xff,
+  0xe4, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x0b, 0x82, 0x00,
+  0x04, 0xf8, 0xff, 0xff, 0xcf, 0x02, 0x84, 0x00, 0x04, 0x10, 0xfb, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x00, 0x36, 0x84, 0x00, 0x03, 0xf5, 0xff, 0xff,
+  0xbf, 0x82, 0x00, 0x06, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x00, 0x05, 0x85, 0x00, 0x02, 0x32, 0x33, 0xb7, 0x85, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x00, 0x3c, 0x83, 0x00, 0x01, 0x10, 0x9e, 0x84, 0x00,
+  0x00, 0xf8, 0x82, 0xff, 0x00, 0x9f, 0x86, 0x00, 0x00, 0xf6, 0x83, 0xff,
+  0x00, 0x3e, 0x87, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x9f, 0x85, 0x00,
+  0x01, 0x30, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x83, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x03, 0xf5, 0xff, 0xff, 0x1d,
+  0x86, 0x00, 0x03, 0xc0, 0xff, 0xff, 0xbf, 0x88, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x09, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0x7f, 0x86, 0x00, 0x00, 0xb4, 0x87, 0xff, 0x00, 0xbf, 0x82,
+  0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x04, 0x84, 0x00, 0x00, 0xe1, 0x82,
+  0xff, 0x00, 0x09, 0x86, 0x00, 0x00, 0x40, 0x82, 0xff, 0x01, 0xef, 0x03,
+  0x87, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x09, 0x86, 0x00, 0x00, 0xe3,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff,
+  0x00, 0x4f, 0x82, 0x00, 0x0e, 0xf2, 0xff, 0xff, 0x04, 0x00, 0x00, 0x10,
+  0x65, 0x02, 0x00, 0x00, 0x20, 0xfe, 0xff, 0xbf, 0x88, 0x00, 0x03, 0x10,
+  0xfe, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x0a, 0x82, 0x00, 0x01, 0x51, 0x37, 0x82, 0x00, 0x00,
+  0xf9, 0x86, 0xff, 0x00, 0xbf, 0x8e, 0x00, 0x04, 0xa0, 0xff, 0xff, 0xdf,
+  0x01, 0x87, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x7f, 0x88, 0x00, 0x0c, 0x70,
+  0xff, 0xff, 0xdf, 0x01, 0x00, 0x00, 0x20, 0x56, 0x01, 0x00, 0x00, 0x60,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff,
+  0x00, 0x7f, 0x82, 0x00, 0x02, 0xf0, 0xff, 0x8f, 0x82, 0x00, 0x02, 0xf5,
+  0xff, 0x7f, 0x82, 0x00, 0x02, 0xf9, 0xff, 0xbf, 0x83, 0x00, 0x02, 0xa4,
+  0xbe, 0x04, 0x82, 0x00, 0x02, 0xf8, 0xff, 0xbf, 0x82, 0x00, 0x12, 0xf3,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xff, 0x03, 0x00, 0x00, 0x50,
+  0xfe, 0xff, 0x0b, 0x00, 0x00, 0xb0, 0x86, 0xff, 0x00, 0xbf, 0x83, 0x00,
+  0x01, 0xc3, 0x6e, 0x83, 0x00, 0x08, 0x90, 0xbf, 0x01, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0x3f, 0x82, 0x00, 0x02, 0x90, 0xdd, 0x0a, 0x82, 0x00, 0x03,
+  0xe0, 0xff, 0xff, 0x1d, 0x82, 0x00, 0x02, 0xa0, 0xfe, 0x2b, 0x82, 0x00,
+  0x03, 0x70, 0xff, 0xff, 0x5f, 0x82, 0x00, 0x02, 0xf9, 0xff, 0x2e, 0x82,
+  0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x83, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x02, 0xf0, 0xff, 0x2f, 0x82,
+  0x00, 0x08, 0xfe, 0xff, 0xff, 0x01, 0x00, 0x00, 0xf2, 0xff, 0xbf, 0x82,
+  0x00, 0x03, 0x50, 0xff, 0xff, 0x4f, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xbf,
+  0x82, 0x00, 0x12, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xff,
+  0x01, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x40, 0x86, 0xff,
+  0x00, 0xbf, 0x82, 0x00, 0x03, 0x40, 0xff, 0xff, 0x01, 0x82, 0x00, 0x08,
+  0xfc, 0xff, 0x09, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0b, 0x82, 0x00, 0x02,
+  0xfc, 0xff, 0xcf, 0x82, 0x00, 0x03, 0x70, 0xff, 0xff, 0x08, 0x82, 0x00,
+  0x0f, 0xfc, 0xff, 0xef, 0x02, 0x00, 0x00, 0x70, 0xff, 0xff, 0x0d, 0x00,
+  0x00, 0x50, 0xff, 0xff, 0xdf, 0x82, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff,
+  0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x9f, 0x82,
+  0x00, 0x05, 0xd0, 0xff, 0x0d, 0x00, 0x00, 0x60, 0x82, 0xff, 0x05, 0x09,
+  0x00, 0x00, 0xd0, 0xff, 0xbf, 0x82, 0x00, 0x03, 0xf2, 0xff, 0xff, 0xaf,
+  0x82, 0x00, 0x02, 0xe0, 0xff, 0xbf, 0x82, 0x00, 0x08, 0xf3, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x70, 0xff, 0xdf, 0x82, 0x00, 0x03, 0xf3, 0xff, 0xff,
+  0x8f, 0x82, 0x00, 0x00, 0xfe, 0x85, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x12,
+  0xe0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x70, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0x05, 0x00, 0x00, 0x50, 0x82, 0xff, 0x09, 0x08, 0x00,
+  0x00, 0x20, 0xff, 0xff, 0x03, 0x00, 0x00, 0x50, 0x82, 0xff, 0x09, 0x07,
+  0x00, 0x00, 0x70, 0xff, 0xff, 0x08, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x03,
+  0x03, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x83, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x05, 0xb0, 0xff, 0x08,
+  0x00, 0x00, 0x90, 0x82, 0xff, 0x05, 0x0b, 0x00, 0x00, 0x90, 0xff, 0xbf,
+  0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x82, 0x00, 0x02, 0xb0, 0xff, 0xbf,
+  0x82, 0x00, 0x08, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xbf,
+  0x82, 0x00, 0x03, 0xf5, 0xff, 0xff, 0xaf, 0x82, 0x00, 0x00, 0xfb, 0x85,
+  0xff, 0x00, 0xbf, 0x82, 0x00, 0x12, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x01, 0x00, 0x00,
+  0xa0, 0x82, 0xff, 0x00, 0x0d, 0x82, 0x00, 0x01, 0xfe, 0xef, 0x82, 0x00,
+  0x00, 0xa0, 0x82, 0xff, 0x09, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x03, 0x07, 0x00, 0x00, 0xe0, 0xff, 0xff,
+  0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0xbf,
+  0x82, 0x00, 0x05, 0xc0, 0xff, 0x04, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x05,
+  0x0c, 0x00, 0x00, 0x70, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x05, 0x03, 0x00, 0x00, 0x70, 0xff, 0xbf, 0x82, 0x00, 0x08, 0xf3, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xbf, 0x82, 0x00, 0x03, 0xf3, 0xff,
+  0xff, 0x7f, 0x82, 0x00, 0x00, 0xfb, 0x85, 0xff, 0x00, 0xbf, 0x82, 0x00,
+  0x0e, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00,
+  0x00, 0x30, 0xff, 0xdf, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x01, 0xfb, 0xbf, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x05,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x03, 0x07, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x8f, 0x82, 0x00, 0x05, 0xf0, 0xff,
+  0x03, 0x00, 0x00, 0x40, 0x82, 0x44, 0x05, 0x04, 0x00, 0x00, 0x60, 0xff,
+  0xbf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00, 0x70,
+  0xff, 0xbf, 0x82, 0x00, 0x08, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x4f, 0x82, 0x00, 0x00,
+  0xfe, 0x85, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0e, 0xf3, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xbf, 0x82,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x01, 0xf9, 0xaf,
+  0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x05, 0x07, 0x00, 0x00, 0x70, 0xff,
+  0xdf, 0x82, 0x00, 0x00, 0x41, 0x82, 0x44, 0x03, 0x02, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff,
+  0x00, 0x7f, 0x82, 0x00, 0x02, 0xf0, 0xff, 0x03, 0x88, 0x00, 0x02, 0x30,
+  0xff, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00,
+  0x70, 0xff, 0xbf, 0x82, 0x00, 0x12, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x05, 0x00, 0x00, 0x30, 0xfd, 0xff, 0x08, 0x00, 0x00,
+  0x20, 0x86, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0e, 0xf3, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xbf, 0x82,
+  0x00, 0x00, 0xf2, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x01, 0xf7, 0x7f,
+  0x82, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x05, 0x07, 0x00, 0x00, 0x70, 0xff,
+  0xbf, 0x89, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x5f, 0x82, 0x00, 0x01, 0xf0, 0xff,
+  0x89, 0x00, 0x02, 0x30, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x05, 0x05, 0x00, 0x00, 0x70, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf3, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xff, 0x0c, 0x82, 0x00, 0x01, 0x30,
+  0x14, 0x82, 0x00, 0x00, 0x90, 0x86, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0e,
+  0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0x8f, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x00, 0x3f, 0x82,
+  0x00, 0x01, 0xf7, 0x7f, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x05, 0x07,
+  0x00, 0x00, 0x70, 0xff, 0xbf, 0x89, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff,
+  0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x3f, 0x82,
+  0x00, 0x02, 0xf4, 0xff, 0x03, 0x88, 0x00, 0x02, 0x30, 0xff, 0xbf, 0x82,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00, 0x70, 0xff, 0xbf,
+  0x82, 0x00, 0x09, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0xff, 0xff,
+  0xbf, 0x87, 0x00, 0x00, 0xf5, 0x86, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0e,
+  0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf1, 0x82, 0xff, 0x00, 0x3f, 0x82,
+  0x00, 0x01, 0xf9, 0x9f, 0x82, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x05, 0x07,
+  0x00, 0x00, 0x70, 0xff, 0xbf, 0x89, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xff, 0xe2, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x0d, 0x82,
+  0x00, 0x05, 0xf8, 0xff, 0x03, 0x00, 0x00, 0x50, 0x85, 0x77, 0x02, 0xb7,
+  0xff, 0xbf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x05, 0x03, 0x00, 0x00,
+  0x70, 0xff, 0xbf, 0x82, 0x00, 0x06, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x2c, 0x85, 0x00, 0x00, 0x50, 0x87, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x0e, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x00, 0x1f, 0x82, 0x00, 0x01, 0xfb, 0xbf, 0x82, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x05, 0x07, 0x00, 0x00, 0x70, 0xff, 0xbf, 0x82, 0x00, 0x00,
+  0x71, 0x85, 0x77, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x83, 0xff, 0x00, 0x07, 0x82, 0x00, 0x05, 0xfc, 0xff,
+  0x05, 0x00, 0x00, 0x90, 0x87, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf7,
+  0x82, 0xff, 0x05, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x82, 0x00, 0x06,
+  0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x6f, 0x84,
+  0x00, 0x01, 0x10, 0xfa, 0x87, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0e, 0xf3,
+  0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30,
+  0xff, 0xdf, 0x82, 0x00, 0x00, 0xe0, 0x82, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x01, 0xfb, 0xcf, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x05, 0x07, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0x82, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff,
+  0xe9, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x82, 0xff, 0x00, 0xcf, 0x82, 0x00,
+  0x06, 0x20, 0xff, 0xff, 0x09, 0x00, 0x00, 0x50, 0x87, 0xff, 0x00, 0xbf,
+  0x82, 0x00, 0x03, 0xf7, 0xff, 0xff, 0xcf, 0x82, 0x00, 0x02, 0xd0, 0xff,
+  0xbf, 0x82, 0x00, 0x06, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x06, 0x06, 0x00, 0x40, 0x35, 0x33, 0x85, 0xfc, 0x88, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x12, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x01, 0x00, 0x00, 0x90, 0x82,
+  0xff, 0x00, 0x0a, 0x82, 0x00, 0x01, 0xff, 0xff, 0x82, 0x00, 0x00, 0xc0,
+  0x82, 0xff, 0x09, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0xa0, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x82,
+  0xff, 0x00, 0x09, 0x82, 0x00, 0x03, 0x90, 0xff, 0xff, 0x0d, 0x82, 0x00,
+  0x00, 0xfc, 0x82, 0xff, 0x04, 0xdf, 0xfe, 0xff, 0xff, 0xbf, 0x82, 0x00,
+  0x03, 0xf5, 0xff, 0xff, 0x6f, 0x82, 0x00, 0x02, 0xf1, 0xff, 0xbf, 0x82,
+  0x00, 0x0c, 0xf3, 0xff, 0xef, 0x03, 0x00, 0x00, 0x70, 0xff, 0xff, 0xbf,
+  0x00, 0x00, 0xe0, 0x8c, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x12, 0xf3, 0xff,
+  0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x05, 0x00, 0x00, 0x40, 0x82, 0xff, 0x16, 0x05, 0x00, 0x00, 0x60,
+  0xff, 0xff, 0x01, 0x00, 0x00, 0x60, 0xff, 0xff, 0xef, 0x03, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x08, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0xcf, 0xff,
+  0xff, 0xff, 0xff, 0xe4, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x02, 0xcc, 0xac,
+  0x37, 0x83, 0x00, 0x03, 0xf2, 0xff, 0xff, 0x4f, 0x82, 0x00, 0x08, 0xd3,
+  0xff, 0xff, 0xef, 0x19, 0xf5, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x03, 0x70,
+  0xff, 0xff, 0x0c, 0x82, 0x00, 0x02, 0xf6, 0xff, 0xcf, 0x82, 0x00, 0x02,
+  0xe0, 0xff, 0x6f, 0x82, 0x00, 0x06, 0x70, 0xff, 0xff, 0x4f, 0x00, 0x00,
+  0xc0, 0x8c, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0f, 0xf3, 0xff, 0xff, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0c,
+  0x82, 0x00, 0x02, 0xf6, 0xff, 0x9f, 0x82, 0x00, 0x09, 0xc0, 0xff, 0xff,
+  0x07, 0x00, 0x00, 0x10, 0xfc, 0xff, 0x3e, 0x82, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0x0e, 0x82, 0x00, 0x05, 0xe6, 0xff, 0xff, 0xdf, 0x06, 0xf9, 0xff,
+  0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x04, 0x20, 0xfe,
+  0xff, 0xff, 0xbf, 0x83, 0x00, 0x07, 0x87, 0x9c, 0x16, 0x00, 0x80, 0xff,
+  0xff, 0xbf, 0x83, 0x00, 0x02, 0x94, 0x6a, 0x01, 0x82, 0x00, 0x02, 0xfd,
+  0xff, 0xff, 0x82, 0x00, 0x02, 0x30, 0x68, 0x01, 0x82, 0x00, 0x03, 0x70,
+  0xff, 0xff, 0x2f, 0x82, 0x00, 0x04, 0x43, 0x44, 0x44, 0x84, 0xfb, 0x87,
+  0xff, 0x00, 0xbf, 0x82, 0x00, 0x0f, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00,
+  0x02, 0x30, 0x88, 0x04, 0x82, 0x00, 0x03, 0xf4, 0xff, 0xff, 0x0e, 0x82,
+  0x00, 0x02, 0x51, 0x58, 0x01, 0x82, 0x00, 0x03, 0x70, 0xff, 0xff, 0x6f,
+  0x82, 0x00, 0x05, 0x20, 0xa8, 0x8c, 0x05, 0x00, 0xc1, 0xff, 0xff, 0xff,
+  0xff, 0xe3, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0xe2, 0x83, 0xff, 0x00,
+  0x06, 0x87, 0x00, 0x02, 0xfc, 0xff, 0xbf, 0x88, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x00, 0x01, 0x87, 0x00, 0x03, 0x70, 0xff, 0xff, 0x4f, 0x86, 0x00,
+  0x01, 0x10, 0xf8, 0x86, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0f, 0xf3, 0xff,
+  0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0xdf, 0x88, 0x00, 0x03, 0xfe, 0xff, 0xff, 0x5f, 0x88, 0x00, 0x04,
+  0x70, 0xff, 0xff, 0xef, 0x02, 0x86, 0x00, 0x01, 0x30, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xe2, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0x3f, 0x87, 0x00, 0x02, 0xf6, 0xff, 0xbf, 0x88, 0x00, 0x00, 0xe2,
+  0x82, 0xff, 0x00, 0x0a, 0x84, 0x00, 0x06, 0x22, 0x00, 0x00, 0x70, 0xff,
+  0xff, 0xaf, 0x87, 0x00, 0x01, 0x30, 0xfe, 0x85, 0xff, 0x00, 0xbf, 0x82,
+  0x00, 0x0c, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0a, 0x86, 0x00, 0x00, 0xb0, 0x82,
+  0xff, 0x00, 0xdf, 0x85, 0x00, 0x03, 0x12, 0x00, 0x00, 0x70, 0x82, 0xff,
+  0x00, 0x0c, 0x87, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe2, 0xff,
+  0x00, 0x0f, 0x86, 0x00, 0x01, 0x60, 0xfd, 0x85, 0xff, 0x00, 0x05, 0x85,
+  0x00, 0x03, 0xb2, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0x0b, 0x83, 0x00,
+  0x01, 0x20, 0xfe, 0x82, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x04, 0x10, 0x7c,
+  0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x08, 0x87, 0x00, 0x00, 0xf3, 0x85,
+  0xff, 0x00, 0xbf, 0x82, 0x00, 0x0c, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0xcf, 0x85,
+  0x00, 0x01, 0x10, 0xfc, 0x83, 0xff, 0x00, 0x0c, 0x83, 0x00, 0x04, 0x10,
+  0x3e, 0x00, 0x00, 0x70, 0x82, 0xff, 0x01, 0xef, 0x02, 0x85, 0x00, 0x00,
+  0xd5, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01,
+  0x33, 0xb7, 0x87, 0xff, 0x01, 0xbf, 0x03, 0x83, 0x00, 0x00, 0x91, 0x82,
+  0xff, 0x05, 0xbf, 0x00, 0x00, 0x10, 0xdf, 0x02, 0x82, 0x00, 0x00, 0xe7,
+  0x83, 0xff, 0x01, 0xef, 0x06, 0x82, 0x00, 0x04, 0xe5, 0x7f, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x01, 0xdf, 0x05, 0x86, 0x00, 0x00, 0x90, 0x85, 0xff,
+  0x00, 0xbf, 0x82, 0x00, 0x0c, 0xf3, 0xff, 0xff, 0x03, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x7e, 0x83, 0x00,
+  0x01, 0x10, 0xe7, 0x84, 0xff, 0x01, 0xcf, 0x02, 0x82, 0x00, 0x04, 0xe6,
+  0x4f, 0x00, 0x00, 0x70, 0x83, 0xff, 0x01, 0x9f, 0x01, 0x83, 0x00, 0x00,
+  0xb3, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xff, 0x04, 0xef, 0x7a, 0x36, 0x86,
+  0xeb, 0x88, 0xff, 0x03, 0xcf, 0x57, 0x74, 0xe9, 0x85, 0xff, 0x03, 0xcf,
+  0x68, 0x73, 0xe8, 0x89, 0xff, 0x03, 0xdf, 0xbb, 0xbb, 0x7b, 0x82, 0x00,
+  0x00, 0x30, 0x9b, 0xff, 0x04, 0xcf, 0x77, 0x44, 0x77, 0xfc, 0x86, 0xff,
+  0x03, 0xcf, 0x67, 0x73, 0xd8, 0x89, 0xff, 0x04, 0xdf, 0x78, 0x35, 0x97,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0x03, 0x0a, 0x00,
+  0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0x03, 0x4b,
+  0x44, 0x44, 0xf4, 0x83, 0xff, 0x00, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xd3, 0xff, 0x03, 0x0b, 0x00, 0x00, 0xd0, 0x83, 0xff,
+  0x03, 0x0a, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3,
+  0xff, 0x0b, 0x0d, 0x00, 0x00, 0x30, 0xeb, 0xff, 0xff, 0xad, 0x01, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0x00, 0x3f,
+  0x89, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff,
+  0x00, 0xcf, 0x89, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd4, 0xff, 0x00, 0x09, 0x87, 0x00, 0x00, 0xc1, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd5, 0xff, 0x01, 0xdf, 0x05, 0x85, 0x00, 0x00, 0x92, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0x05, 0x8b, 0x37, 0x33, 0x33,
+  0x74, 0xda, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x00, 0x8f, 0x87, 0x88, 0x00, 0xf8,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5, 0xff, 0x00, 0x0f, 0x87, 0x00,
+  0x00, 0xf1, 0x9a, 0xff, 0x00, 0xfc, 0xd8, 0xff, 0x00, 0xcf, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xf3, 0x97, 0xff,
+  0x03, 0x88, 0x44, 0x01, 0xf0, 0xd5, 0xff, 0x03, 0x8f, 0x48, 0x14, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xf6,
+  0x97, 0xff, 0x82, 0x00, 0x00, 0xf0, 0xd5, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xf7,
+  0x97, 0xff, 0x82, 0x00, 0x00, 0xf0, 0xd5, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x84, 0x33,
+  0x00, 0xfc, 0x97, 0xff, 0x82, 0x00, 0x00, 0xf0, 0xd5, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x9d, 0xff, 0x82, 0x00, 0x00, 0xf0, 0xd5, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x87, 0xff,
+  0x06, 0xad, 0x46, 0x00, 0x00, 0x10, 0x74, 0xfd, 0x85, 0xff, 0x08, 0xef,
+  0x4a, 0x02, 0x00, 0x50, 0xe9, 0xff, 0x8d, 0x88, 0x82, 0x00, 0x03, 0x80,
+  0x88, 0x88, 0xfd, 0x82, 0xff, 0x05, 0xef, 0x49, 0x02, 0x00, 0x40, 0xd9,
+  0x84, 0xff, 0x82, 0x88, 0x04, 0xfe, 0xff, 0x48, 0x00, 0x83, 0x82, 0x88,
+  0x00, 0xfe, 0x82, 0xff, 0x00, 0x8d, 0x82, 0x88, 0x85, 0xff, 0x07, 0x8f,
+  0x88, 0x88, 0xf8, 0xff, 0x7e, 0x04, 0x50, 0x82, 0xff, 0x05, 0xdf, 0x48,
+  0x01, 0x00, 0x62, 0xfb, 0x84, 0xff, 0x06, 0xef, 0x6a, 0x01, 0x00, 0x10,
+  0x95, 0xfd, 0x84, 0xff, 0x0a, 0xbf, 0x35, 0x00, 0x00, 0x83, 0xfd, 0xff,
+  0xff, 0xdf, 0x88, 0x08, 0x82, 0x00, 0x02, 0x88, 0x88, 0xd8, 0xff, 0xff,
+  0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86, 0xff, 0x00, 0x39,
+  0x85, 0x00, 0x01, 0x60, 0xfe, 0x84, 0xff, 0x00, 0x18, 0x83, 0x00, 0x02,
+  0x10, 0xe7, 0x0b, 0x86, 0x00, 0x04, 0xfc, 0xff, 0xff, 0xef, 0x06, 0x84,
+  0x00, 0x00, 0xe6, 0x83, 0xff, 0x82, 0x00, 0x04, 0xfb, 0x3e, 0x00, 0x00,
+  0x02, 0x82, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x03, 0x08, 0x00, 0x00, 0x40,
+  0x85, 0xff, 0x0b, 0x0f, 0x00, 0x00, 0xe0, 0xcf, 0x01, 0x00, 0x30, 0xff,
+  0xff, 0xef, 0x06, 0x83, 0x00, 0x01, 0x30, 0xfb, 0x83, 0xff, 0x00, 0x2a,
+  0x84, 0x00, 0x01, 0x60, 0xfe, 0x82, 0xff, 0x01, 0xcf, 0x03, 0x83, 0x00,
+  0x03, 0x60, 0xfe, 0xff, 0xbf, 0x86, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xff,
+  0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86, 0xff, 0x00, 0x08, 0x86,
+  0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x4e, 0x85, 0x00, 0x01, 0x20, 0x09,
+  0x86, 0x00, 0x82, 0xff, 0x00, 0x3d, 0x85, 0x00, 0x01, 0x10, 0xfc, 0x82,
+  0xff, 0x82, 0x00, 0x04, 0xea, 0x03, 0x00, 0x00, 0x45, 0x82, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x03, 0x04, 0x00, 0x00, 0x90, 0x85, 0xff, 0x0a, 0x0f,
+  0x00, 0x00, 0xb0, 0x1c, 0x00, 0x00, 0x70, 0xff, 0xff, 0x3e, 0x85, 0x00,
+  0x00, 0x90, 0x82, 0xff, 0x00, 0x9f, 0x86, 0x00, 0x00, 0xb1, 0x82, 0xff,
+  0x00, 0x09, 0x85, 0x00, 0x02, 0xe3, 0xff, 0xbf, 0x86, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86, 0xff,
+  0x00, 0x0d, 0x86, 0x00, 0x00, 0x80, 0x82, 0xff, 0x01, 0xef, 0x03, 0x85,
+  0x00, 0x01, 0x20, 0x0b, 0x85, 0x00, 0x04, 0x10, 0xff, 0xff, 0xdf, 0x01,
+  0x86, 0x00, 0x00, 0xc1, 0x82, 0xff, 0x82, 0x00, 0x00, 0x77, 0x82, 0x00,
+  0x00, 0x87, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x03, 0x01, 0x00, 0x00,
+  0xe0, 0x85, 0xff, 0x0a, 0x0f, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x90,
+  0xff, 0xef, 0x03, 0x86, 0x00, 0x03, 0xfa, 0xff, 0xff, 0x0a, 0x86, 0x00,
+  0x03, 0xd0, 0xff, 0xff, 0x9f, 0x86, 0x00, 0x02, 0x30, 0xfe, 0xbf, 0x86,
+  0x00, 0x00, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x86, 0xff, 0x00, 0x2f, 0x86, 0x00, 0x04, 0x10, 0xfd, 0xff, 0xff,
+  0x6f, 0x86, 0x00, 0x01, 0xc0, 0x0b, 0x85, 0x00, 0x03, 0x30, 0xff, 0xff,
+  0x4f, 0x87, 0x00, 0x03, 0x30, 0xfe, 0xff, 0xff, 0x82, 0x00, 0x00, 0x15,
+  0x82, 0x00, 0x00, 0xdb, 0x82, 0x00, 0x03, 0xf1, 0xff, 0xff, 0xdf, 0x82,
+  0x00, 0x00, 0xf2, 0x85, 0xff, 0x03, 0x0f, 0x00, 0x00, 0x40, 0x82, 0x00,
+  0x02, 0xb0, 0xff, 0x6f, 0x82, 0x00, 0x01, 0x40, 0x37, 0x82, 0x00, 0x03,
+  0xd1, 0xff, 0xff, 0x02, 0x86, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x1d, 0x82,
+  0x00, 0x01, 0x62, 0x15, 0x82, 0x00, 0x01, 0xf6, 0xbf, 0x86, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86,
+  0xff, 0x05, 0x8f, 0x40, 0xb8, 0xff, 0xef, 0x07, 0x82, 0x00, 0x03, 0xfb,
+  0xff, 0xff, 0x0b, 0x82, 0x00, 0x06, 0x71, 0xbb, 0x37, 0x00, 0xf8, 0x7d,
+  0x77, 0x82, 0x00, 0x05, 0x70, 0x77, 0xa7, 0xff, 0xff, 0x08, 0x82, 0x00,
+  0x02, 0xb5, 0xbf, 0x04, 0x82, 0x00, 0x02, 0xf8, 0xff, 0xff, 0x86, 0x00,
+  0x07, 0xfd, 0x02, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x9f, 0x82, 0x00, 0x00,
+  0xf8, 0x85, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x0d, 0xf0, 0xff, 0x0c, 0x00,
+  0x00, 0x20, 0xfe, 0xff, 0x09, 0x00, 0x00, 0x50, 0xff, 0xbf, 0x82, 0x00,
+  0x04, 0xb0, 0xff, 0xbe, 0x07, 0x20, 0x82, 0xff, 0x0c, 0x05, 0x00, 0x00,
+  0x90, 0xff, 0xef, 0x02, 0x00, 0x00, 0xd0, 0xdf, 0x77, 0x07, 0x82, 0x00,
+  0x02, 0x77, 0x77, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x83, 0xcc, 0x03, 0xfc, 0xff, 0xff, 0xef, 0x83, 0xff, 0x00,
+  0x7f, 0x82, 0x00, 0x0a, 0xf8, 0xff, 0xff, 0x03, 0x00, 0x00, 0x20, 0xfe,
+  0xff, 0xff, 0x59, 0x82, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x06,
+  0x02, 0x00, 0x00, 0x50, 0xff, 0xff, 0x5f, 0x82, 0x00, 0x02, 0xf2, 0xff,
+  0xff, 0x84, 0x00, 0x09, 0x30, 0x03, 0xff, 0x07, 0x00, 0x00, 0x90, 0xff,
+  0xff, 0x5f, 0x82, 0x00, 0x00, 0xfd, 0x85, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x0e, 0x33, 0xf2, 0xff, 0x05, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x5f, 0x00,
+  0x00, 0x10, 0xfe, 0x8f, 0x82, 0x00, 0x07, 0xf7, 0xff, 0xff, 0xef, 0xb9,
+  0xff, 0xff, 0xdf, 0x82, 0x00, 0x09, 0xf4, 0xff, 0xff, 0x0d, 0x00, 0x00,
+  0x60, 0xff, 0xff, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+  0x00, 0x0f, 0x86, 0x00, 0x00, 0xf0, 0x86, 0xff, 0x00, 0xbf, 0x82, 0x00,
+  0x02, 0xf6, 0xff, 0xdf, 0x82, 0x00, 0x00, 0xc0, 0x86, 0xff, 0x82, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x00, 0xcf, 0x82, 0x00, 0x03, 0xe0, 0xff, 0xff,
+  0xdf, 0x82, 0x00, 0x02, 0xb0, 0xff, 0xff, 0x83, 0x00, 0x00, 0x80, 0x82,
+  0xff, 0x09, 0x0c, 0x00, 0x00, 0x60, 0xff, 0xff, 0x2f, 0x00, 0x00, 0x20,
+  0x86, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xfa, 0x82, 0xff, 0x06, 0x01,
+  0x00, 0x00, 0xf2, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x01, 0xfa, 0x8f, 0x82,
+  0x00, 0x00, 0xf4, 0x85, 0xff, 0x00, 0x8f, 0x82, 0x00, 0x09, 0xfa, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x82, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0xf0, 0x86, 0xff,
+  0x00, 0xdf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0x6f, 0x82, 0x00, 0x00, 0xf2,
+  0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x6f, 0x82, 0x00,
+  0x00, 0xf4, 0x82, 0xff, 0x05, 0x02, 0x00, 0x00, 0x70, 0xff, 0xff, 0x83,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x09, 0x1f, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0x70, 0x86, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xb0,
+  0x82, 0xff, 0x00, 0xaf, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x82, 0x00,
+  0x01, 0xf6, 0xbf, 0x82, 0x00, 0x01, 0x40, 0xfb, 0x84, 0xff, 0x00, 0x3f,
+  0x82, 0x00, 0x03, 0xfe, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x02, 0xfe, 0xff,
+  0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x86,
+  0x00, 0x00, 0xf0, 0x84, 0xff, 0x02, 0xcf, 0x9c, 0x88, 0x82, 0x00, 0x02,
+  0xf3, 0xff, 0x3f, 0x82, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x82, 0x00, 0x00,
+  0xf0, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x05,
+  0x07, 0x00, 0x00, 0x40, 0xff, 0xff, 0x83, 0x00, 0x00, 0xfe, 0x82, 0xff,
+  0x00, 0x5f, 0x82, 0x00, 0x05, 0xff, 0xff, 0x09, 0x00, 0x00, 0xc0, 0x86,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x00, 0x7f, 0x82,
+  0x00, 0x00, 0xf8, 0x82, 0xff, 0x82, 0x00, 0x01, 0xf3, 0xef, 0x83, 0x00,
+  0x01, 0x10, 0xb6, 0x83, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x82, 0xff, 0x00,
+  0x7f, 0x82, 0x00, 0x02, 0xfb, 0xff, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff,
+  0xff, 0xdf, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x01,
+  0xaf, 0x04, 0x85, 0x00, 0x02, 0xf3, 0xff, 0x2f, 0x82, 0x00, 0x00, 0xf7,
+  0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00,
+  0x00, 0xfa, 0x82, 0xff, 0x05, 0x07, 0x00, 0x00, 0x30, 0xff, 0xff, 0x82,
+  0x00, 0x00, 0x60, 0x83, 0xff, 0x00, 0xaf, 0x82, 0x00, 0x05, 0xfb, 0xff,
+  0x05, 0x00, 0x00, 0xf1, 0x86, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xf9,
+  0x82, 0xff, 0x00, 0x5f, 0x82, 0x00, 0x00, 0x43, 0x82, 0x44, 0x82, 0x00,
+  0x02, 0xf3, 0xff, 0x08, 0x84, 0x00, 0x07, 0x72, 0xfd, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0x10, 0x82, 0x44, 0x00, 0x24, 0x82, 0x00, 0x02, 0xfb, 0xff,
+  0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x86,
+  0x00, 0x04, 0xf0, 0xff, 0xff, 0x9f, 0x02, 0x86, 0x00, 0x02, 0xf3, 0xff,
+  0x0f, 0x82, 0x00, 0x00, 0xf9, 0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x05, 0x09, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x82, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x82, 0x00,
+  0x05, 0xf8, 0xff, 0x03, 0x00, 0x00, 0xf6, 0x86, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x00, 0xfe, 0x82, 0xff, 0x00, 0x3f, 0x89, 0x00, 0x02, 0xf2, 0xff,
+  0x3f, 0x85, 0x00, 0x03, 0x91, 0xff, 0xff, 0x0d, 0x89, 0x00, 0x02, 0xf9,
+  0xff, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x86, 0xff, 0x00, 0x09, 0x87, 0x00, 0x02, 0xf3, 0xff, 0x0f,
+  0x82, 0x00, 0x00, 0xfb, 0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x05, 0x0b, 0x00, 0x00,
+  0x10, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x04, 0x04, 0x00,
+  0x00, 0xf4, 0xef, 0x82, 0x00, 0x00, 0xfc, 0x86, 0xff, 0x03, 0x0f, 0x00,
+  0x00, 0x20, 0x83, 0xff, 0x00, 0x3f, 0x89, 0x00, 0x03, 0xf0, 0xff, 0xff,
+  0x08, 0x85, 0x00, 0x02, 0xf5, 0xff, 0x0b, 0x89, 0x00, 0x02, 0xf7, 0xff,
+  0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x85, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x02, 0x10, 0x77, 0x77, 0x82,
+  0x00, 0x02, 0xf3, 0xff, 0x0f, 0x82, 0x00, 0x00, 0xf9, 0x86, 0xff, 0x82,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x05, 0x08, 0x00, 0x00, 0x30, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x04, 0x09, 0x00, 0x00, 0xf2, 0xaf, 0x82, 0x00, 0x87, 0xff,
+  0x03, 0x0f, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x3f, 0x89, 0x00, 0x04,
+  0xf3, 0xff, 0xff, 0xdf, 0x06, 0x84, 0x00, 0x02, 0x80, 0xff, 0x0d, 0x89,
+  0x00, 0x02, 0xfb, 0xff, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x02,
+  0xf9, 0xff, 0xff, 0x82, 0x00, 0x02, 0xf3, 0xff, 0x1f, 0x82, 0x00, 0x00,
+  0xf7, 0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x2f, 0x82,
+  0x00, 0x00, 0xf9, 0x82, 0xff, 0x05, 0x07, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0x82, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x07, 0x0e, 0x00, 0x00, 0xe0, 0x6f,
+  0x00, 0x00, 0x50, 0x87, 0xff, 0x03, 0x0f, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x3f, 0x82, 0x00, 0x00, 0x74, 0x85, 0x77, 0x00, 0xf9, 0x83, 0xff,
+  0x00, 0x5a, 0x83, 0x00, 0x05, 0x10, 0xfe, 0x0f, 0x00, 0x00, 0x10, 0x86,
+  0x77, 0x02, 0xfd, 0xff, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf,
+  0xff, 0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x03, 0x0f, 0x00, 0x00, 0x20,
+  0x82, 0xff, 0x82, 0x00, 0x02, 0xf3, 0xff, 0x3f, 0x82, 0x00, 0x00, 0xf6,
+  0x86, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x4f, 0x82, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x05, 0x06, 0x00, 0x00, 0x70, 0xff, 0xff, 0x82,
+  0x00, 0x00, 0xf0, 0x84, 0xff, 0x07, 0x2f, 0x00, 0x00, 0xa0, 0x3f, 0x00,
+  0x00, 0xa0, 0x87, 0xff, 0x03, 0x0f, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x7f, 0x82, 0x00, 0x00, 0xf6, 0x8b, 0xff, 0x01, 0x9f, 0x01, 0x82, 0x00,
+  0x01, 0xfb, 0x0f, 0x82, 0x00, 0x00, 0xfe, 0x87, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x85,
+  0xff, 0x03, 0x0b, 0x00, 0x00, 0x70, 0x82, 0xff, 0x82, 0x00, 0x02, 0xf3,
+  0xff, 0x6f, 0x82, 0x00, 0x00, 0xf2, 0x86, 0xff, 0x82, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x05, 0x02,
+  0x00, 0x00, 0xa0, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x07,
+  0x8f, 0x00, 0x00, 0x70, 0x0e, 0x00, 0x00, 0xf0, 0x87, 0xff, 0x03, 0x0f,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0x8c,
+  0xff, 0x00, 0x1e, 0x82, 0x00, 0x01, 0xf8, 0x4f, 0x82, 0x00, 0x00, 0xfa,
+  0x87, 0xff, 0x00, 0x0f, 0x82, 0x00, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x06, 0x0a, 0x00, 0x00, 0x60, 0xff,
+  0xff, 0xcf, 0x82, 0x00, 0x02, 0xf3, 0xff, 0xdf, 0x82, 0x00, 0x00, 0x90,
+  0x82, 0xff, 0x00, 0xdf, 0x82, 0xff, 0x03, 0x02, 0x00, 0x00, 0xd0, 0x82,
+  0xff, 0x00, 0xcf, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0xaf, 0x82, 0x00,
+  0x02, 0xf0, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x07, 0xcf,
+  0x00, 0x00, 0x30, 0x0a, 0x00, 0x00, 0xf5, 0x87, 0xff, 0x03, 0x0f, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0xef, 0x82, 0x00, 0x00, 0xa0, 0x83, 0xff,
+  0x00, 0xde, 0x82, 0xff, 0x01, 0xaf, 0xfe, 0x82, 0xff, 0x00, 0x3f, 0x82,
+  0x00, 0x01, 0xf8, 0x8f, 0x82, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xfc,
+  0x82, 0xff, 0x00, 0x2f, 0x82, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff,
+  0xde, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x06, 0x0b, 0x00, 0x00,
+  0x20, 0xfe, 0xff, 0x1d, 0x82, 0x00, 0x03, 0xf2, 0xff, 0xff, 0x02, 0x82,
+  0x00, 0x15, 0xe9, 0xff, 0xaf, 0x23, 0xfe, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0x60, 0xff, 0xbe, 0xff, 0xff, 0x03, 0x00, 0x00, 0x30, 0xfe, 0xff, 0x1c,
+  0x82, 0x00, 0x02, 0xf5, 0xff, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x85, 0xff,
+  0x06, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0xfa, 0x87, 0xff, 0x03, 0x0f,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x11, 0x05, 0x00, 0x00, 0x10, 0xfb, 0xff,
+  0xff, 0xaf, 0x32, 0xfe, 0xff, 0xff, 0x1c, 0x81, 0xfe, 0xff, 0xff, 0x1e,
+  0x82, 0x00, 0x01, 0xfb, 0xef, 0x82, 0x00, 0x05, 0x60, 0xfe, 0xff, 0xff,
+  0x6d, 0x90, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x00, 0x02, 0xf6, 0xef, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x85, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x02, 0xb3, 0x7b, 0x02, 0x82, 0x00, 0x03, 0x90,
+  0xff, 0xff, 0x0b, 0x83, 0x00, 0x06, 0x42, 0x00, 0x00, 0xf5, 0xff, 0xff,
+  0x06, 0x82, 0x00, 0x04, 0x31, 0x00, 0xfb, 0xff, 0x0a, 0x82, 0x00, 0x02,
+  0x62, 0x68, 0x01, 0x82, 0x00, 0x02, 0xfd, 0xff, 0xff, 0x82, 0x00, 0x00,
+  0xf0, 0x85, 0xff, 0x06, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xfe, 0x87,
+  0xff, 0x03, 0x0f, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0d, 0x82, 0x00,
+  0x0d, 0x60, 0xc8, 0x7a, 0x02, 0x00, 0xf6, 0xff, 0xdf, 0x01, 0x00, 0x62,
+  0xc8, 0x9c, 0x02, 0x82, 0x00, 0x02, 0xfe, 0xff, 0x07, 0x82, 0x00, 0x08,
+  0x82, 0xc9, 0x58, 0x00, 0x10, 0xfc, 0xff, 0xff, 0x6f, 0x82, 0x00, 0x02,
+  0x10, 0x03, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x85, 0xff, 0x00, 0x2f, 0x89, 0x00, 0x02, 0xfc, 0xff, 0x6f, 0x86,
+  0x00, 0x03, 0xa0, 0xff, 0xff, 0x0b, 0x84, 0x00, 0x02, 0xf4, 0xff, 0x5f,
+  0x87, 0x00, 0x00, 0x80, 0x82, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x85, 0xff,
+  0x00, 0x0a, 0x83, 0x00, 0x00, 0x40, 0x88, 0xff, 0x03, 0x0f, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x8f, 0x87, 0x00, 0x02, 0x90, 0xff, 0x3e, 0x87,
+  0x00, 0x03, 0x70, 0xff, 0xff, 0x2e, 0x87, 0x00, 0x03, 0xe3, 0xff, 0xff,
+  0xbf, 0x84, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x85, 0xff, 0x00, 0xcf, 0x85, 0x00, 0x03, 0x42, 0x00,
+  0x00, 0x10, 0x82, 0xff, 0x00, 0x04, 0x85, 0x00, 0x03, 0x10, 0xfd, 0xff,
+  0x4f, 0x84, 0x00, 0x03, 0xb0, 0xff, 0xef, 0x02, 0x86, 0x00, 0x00, 0xf5,
+  0x82, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x85, 0xff, 0x00, 0x0f, 0x83, 0x00,
+  0x00, 0x90, 0x88, 0xff, 0x03, 0x0f, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00,
+  0x05, 0x86, 0x00, 0x02, 0x30, 0xff, 0x0a, 0x87, 0x00, 0x03, 0xe2, 0xff,
+  0xff, 0xcf, 0x87, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x04, 0x84, 0x00,
+  0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x86, 0xff, 0x00, 0x08, 0x84, 0x00, 0x03, 0xec, 0x00, 0x00, 0x60, 0x82,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x03, 0x70, 0xfe, 0xff, 0xdf, 0x84, 0x00,
+  0x03, 0x40, 0xff, 0xff, 0x4e, 0x85, 0x00, 0x00, 0x90, 0x83, 0xff, 0x82,
+  0x00, 0x00, 0xf0, 0x85, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x00, 0xe0, 0x88,
+  0xff, 0x03, 0x0f, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x04, 0x10, 0xf9, 0xff, 0xcf, 0x02, 0x85, 0x00, 0x00, 0x50, 0x83, 0xff,
+  0x00, 0x2e, 0x85, 0x00, 0x01, 0x50, 0xfd, 0x82, 0xff, 0x00, 0x0d, 0x84,
+  0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x86, 0xff, 0x01, 0xbf, 0x01, 0x82, 0x00, 0x04, 0xe4, 0xff, 0x3e,
+  0x00, 0xc0, 0x83, 0xff, 0x00, 0x5b, 0x83, 0x00, 0x01, 0x60, 0xfe, 0x82,
+  0xff, 0x00, 0x4e, 0x83, 0x00, 0x00, 0xc4, 0x82, 0xff, 0x00, 0x3b, 0x83,
+  0x00, 0x01, 0x50, 0xfd, 0x83, 0xff, 0x82, 0x00, 0x00, 0xf0, 0x85, 0xff,
+  0x00, 0x9f, 0x83, 0x00, 0x00, 0xf3, 0x88, 0xff, 0x03, 0x0f, 0x00, 0x00,
+  0x30, 0x86, 0xff, 0x00, 0x5d, 0x84, 0x00, 0x00, 0xe7, 0x82, 0xff, 0x01,
+  0xbf, 0x04, 0x83, 0x00, 0x01, 0x40, 0xfb, 0x84, 0xff, 0x00, 0x19, 0x83,
+  0x00, 0x01, 0x30, 0xfb, 0x83, 0xff, 0x01, 0xef, 0x04, 0x82, 0x00, 0x01,
+  0x40, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0x03, 0xbf, 0x68, 0x73,
+  0xd8, 0x82, 0xff, 0x01, 0x9d, 0xf7, 0x84, 0xff, 0x03, 0xae, 0x67, 0x73,
+  0xb9, 0x85, 0xff, 0x03, 0xac, 0x47, 0x73, 0xd9, 0x84, 0xff, 0x04, 0x9d,
+  0x57, 0x73, 0xa7, 0xfe, 0x8f, 0xff, 0x04, 0xdf, 0x01, 0x00, 0x00, 0xf9,
+  0x94, 0xff, 0x04, 0xaf, 0x77, 0x53, 0xb7, 0xfd, 0x85, 0xff, 0x04, 0x7b,
+  0x47, 0x73, 0xa7, 0xfe, 0x86, 0xff, 0x03, 0x8d, 0x57, 0x73, 0xb9, 0x86,
+  0xff, 0x04, 0xcf, 0x7a, 0x34, 0x97, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x9e, 0xff, 0x03, 0x5f, 0x00, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xdb, 0xff, 0x03, 0x09, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xda, 0xff, 0x00, 0x6d, 0x82, 0x00, 0x00, 0xe0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0x01, 0xce, 0x48, 0x83, 0x00,
+  0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0x00, 0x0b,
+  0x83, 0x00, 0x00, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff,
+  0x00, 0x0e, 0x83, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x00, 0xb3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xda, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xb2, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xdb, 0xff, 0x02, 0x6f, 0x85, 0xeb, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0xff, 0x02,
+  0xef, 0x58, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x03,
+  0x1c, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff,
+  0x03, 0x03, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0xff, 0x00, 0xcf, 0x82, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xda, 0xff, 0x00, 0xbf, 0x83, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xc4, 0xff, 0x00, 0x8f, 0x87, 0x88, 0x00, 0xb8, 0x8b, 0xff, 0x00,
+  0xef, 0x82, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc4,
+  0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0x70, 0x8c, 0xff, 0x03, 0x07, 0x00,
+  0x00, 0xb0, 0x84, 0xff, 0x01, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xbd, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xb0, 0x8c, 0xff, 0x0a,
+  0x7f, 0x00, 0x10, 0xfb, 0xff, 0xff, 0xbf, 0x68, 0x24, 0x00, 0xf7, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00,
+  0xd0, 0x8d, 0xff, 0x01, 0xcf, 0xfe, 0x82, 0xff, 0x00, 0x7f, 0x82, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x00, 0x0f,
+  0x87, 0x00, 0x00, 0xf0, 0x92, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x84, 0x33, 0x00, 0xf5, 0x92, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x98, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x00, 0xbf,
+  0x82, 0x88, 0x03, 0xd8, 0xff, 0xff, 0xbf, 0x82, 0x88, 0x08, 0xf8, 0xff,
+  0x8b, 0x88, 0x88, 0xb8, 0xff, 0x89, 0x48, 0x82, 0x00, 0x02, 0x84, 0x88,
+  0x98, 0x86, 0xff, 0x0e, 0x89, 0x88, 0x88, 0xfd, 0xdf, 0x27, 0x00, 0x30,
+  0xfa, 0xff, 0xff, 0x5b, 0x00, 0x30, 0xe7, 0x85, 0xff, 0x04, 0x7d, 0x14,
+  0x00, 0x20, 0xb6, 0x83, 0xff, 0x09, 0xdf, 0x88, 0x88, 0x98, 0xff, 0xcf,
+  0x17, 0x00, 0x41, 0xfa, 0x82, 0xff, 0x06, 0x8f, 0x88, 0x88, 0x98, 0xff,
+  0xff, 0xdf, 0x82, 0x88, 0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0x00, 0x0f, 0x82, 0x00, 0x85, 0xff, 0x00, 0xdf, 0x82, 0x00, 0x03, 0x50,
+  0xff, 0xff, 0x4f, 0x82, 0x00, 0x07, 0xf7, 0xff, 0x07, 0x00, 0x00, 0x70,
+  0xff, 0x03, 0x85, 0x00, 0x00, 0x40, 0x86, 0xff, 0x04, 0x03, 0x00, 0x00,
+  0xf7, 0x19, 0x82, 0x00, 0x02, 0x60, 0xff, 0x5e, 0x82, 0x00, 0x01, 0x20,
+  0xfc, 0x83, 0xff, 0x00, 0x6e, 0x84, 0x00, 0x00, 0xc4, 0x82, 0xff, 0x05,
+  0xbf, 0x00, 0x00, 0x10, 0xef, 0x07, 0x82, 0x00, 0x0a, 0x50, 0xfe, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86, 0xff,
+  0x11, 0x08, 0x00, 0x00, 0x10, 0xfe, 0xff, 0x0c, 0x00, 0x00, 0x10, 0xff,
+  0xff, 0x07, 0x00, 0x00, 0x70, 0xff, 0x03, 0x85, 0x00, 0x00, 0x70, 0x86,
+  0xff, 0x03, 0x03, 0x00, 0x00, 0x95, 0x84, 0x00, 0x01, 0xe7, 0x03, 0x83,
+  0x00, 0x00, 0xe2, 0x82, 0xff, 0x01, 0xcf, 0x03, 0x84, 0x00, 0x04, 0x10,
+  0xfb, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0x3e, 0x84, 0x00, 0x09, 0xf7,
+  0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86,
+  0xff, 0x00, 0x2f, 0x82, 0x00, 0x0d, 0xf7, 0xff, 0x05, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0xff, 0x03, 0x85, 0x00, 0x00, 0xa0,
+  0x86, 0xff, 0x03, 0x03, 0x00, 0x00, 0x01, 0x84, 0x00, 0x00, 0x31, 0x84,
+  0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x1d, 0x86, 0x00, 0x03, 0xc0, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x00, 0x01, 0x84, 0x00, 0x09, 0xd0, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x86, 0xff, 0x00,
+  0xbf, 0x82, 0x00, 0x0d, 0xf2, 0xef, 0x01, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0x03, 0x85, 0x00, 0x00, 0xc0, 0x86, 0xff,
+  0x00, 0x03, 0x8d, 0x00, 0x00, 0x30, 0x82, 0xff, 0x0b, 0x05, 0x00, 0x00,
+  0x10, 0x65, 0x02, 0x00, 0x00, 0x20, 0xfe, 0xff, 0xbf, 0x88, 0x00, 0x09,
+  0x70, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x87, 0xff, 0x04, 0x06, 0x00, 0x00, 0x90, 0x8f, 0x82, 0x00, 0x09, 0xfd,
+  0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0xff, 0x79, 0x37, 0x82, 0x00, 0x02,
+  0x73, 0x77, 0xf7, 0x86, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01, 0x90, 0xbf,
+  0x83, 0x00, 0x02, 0x50, 0xed, 0x05, 0x82, 0x00, 0x02, 0xff, 0xff, 0xaf,
+  0x82, 0x00, 0x02, 0xe4, 0xff, 0x9f, 0x82, 0x00, 0x02, 0xf7, 0xff, 0xbf,
+  0x83, 0x00, 0x0e, 0x81, 0xde, 0x02, 0x00, 0x00, 0x60, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0x70, 0x82, 0xff,
+  0x07, 0x0e, 0x00, 0x00, 0x30, 0x2f, 0x00, 0x00, 0x70, 0x82, 0xff, 0x06,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88,
+  0xff, 0x00, 0x03, 0x82, 0x00, 0x02, 0xfc, 0xff, 0x06, 0x82, 0x00, 0x02,
+  0xf5, 0xff, 0x0e, 0x82, 0x00, 0x02, 0xfd, 0xff, 0x3f, 0x82, 0x00, 0x08,
+  0xfd, 0xff, 0xff, 0x03, 0x00, 0x00, 0xf2, 0xff, 0xbf, 0x82, 0x00, 0x0f,
+  0x20, 0xfe, 0xff, 0x09, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x9f,
+  0x82, 0x00, 0x03, 0x07, 0x00, 0x00, 0xe1, 0x82, 0xff, 0x06, 0x07, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x06,
+  0x03, 0x00, 0x00, 0x70, 0xff, 0xff, 0x0a, 0x82, 0x00, 0x02, 0xfe, 0xff,
+  0x2f, 0x82, 0x00, 0x05, 0xfb, 0xff, 0x0d, 0x00, 0x00, 0x50, 0x82, 0xff,
+  0x05, 0x0a, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x82, 0x00, 0x0f, 0xc0, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
+  0x00, 0x0f, 0x86, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x03, 0x84, 0x00,
+  0x00, 0xf9, 0x82, 0xff, 0x06, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f,
+  0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x05, 0xfb,
+  0xff, 0x09, 0x00, 0x00, 0x70, 0x82, 0xff, 0x05, 0x0c, 0x00, 0x00, 0x80,
+  0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00,
+  0x70, 0x83, 0xff, 0x00, 0x0c, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x06,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88,
+  0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0x3f, 0x82, 0x00, 0x05, 0xfb, 0xff, 0x05, 0x00, 0x00, 0xb0,
+  0x82, 0xff, 0x05, 0x0f, 0x00, 0x00, 0x50, 0xff, 0xbf, 0x82, 0x00, 0x0f,
+  0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x7f,
+  0x83, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x06, 0x07, 0x00, 0x00, 0x70, 0xff,
+  0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x0c, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00,
+  0x05, 0xfb, 0xff, 0x03, 0x00, 0x00, 0x30, 0x82, 0x44, 0x05, 0x04, 0x00,
+  0x00, 0x30, 0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x88, 0xff, 0x01, 0xef, 0x01, 0x82, 0x00, 0x00, 0xf3, 0x83, 0xff,
+  0x06, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7,
+  0x88, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x02, 0xfb, 0xff, 0x03, 0x88, 0x00,
+  0x02, 0x30, 0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82,
+  0x00, 0x88, 0xff, 0x00, 0xbf, 0x83, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x06,
+  0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88,
+  0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0x3f, 0x82, 0x00, 0x01, 0xfb, 0xff, 0x89, 0x00, 0x02, 0x30,
+  0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x88,
+  0xff, 0x00, 0x2e, 0x83, 0x00, 0x00, 0x40, 0x83, 0xff, 0x06, 0x07, 0x00,
+  0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x0c,
+  0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0x3f, 0x82, 0x00, 0x02, 0xfb, 0xff, 0x03, 0x88, 0x00, 0x02, 0x30, 0xff,
+  0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x88, 0xff,
+  0x00, 0x07, 0x84, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x06, 0x07, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x0c, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f,
+  0x82, 0x00, 0x05, 0xfb, 0xff, 0x03, 0x00, 0x00, 0x50, 0x85, 0x77, 0x02,
+  0xa7, 0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x82, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x87, 0xff, 0x00, 0xdf, 0x82, 0x00, 0x03, 0x04, 0x00, 0x00, 0xe1, 0x82,
+  0xff, 0x06, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x00,
+  0xf7, 0x88, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x05, 0xfb, 0xff, 0x05, 0x00,
+  0x00, 0x80, 0x87, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00,
+  0x0f, 0x82, 0x00, 0x87, 0xff, 0x07, 0x4f, 0x00, 0x00, 0x50, 0x0b, 0x00,
+  0x00, 0x60, 0x82, 0xff, 0x06, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff, 0x7f,
+  0x82, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x05, 0xfb,
+  0xff, 0x09, 0x00, 0x00, 0x40, 0x87, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x0f,
+  0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x87, 0xff, 0x04, 0x0a, 0x00, 0x00,
+  0xd0, 0x3f, 0x82, 0x00, 0x09, 0xfc, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xaf, 0x82, 0x00, 0x00, 0xf6, 0x88, 0xff, 0x0c, 0x03, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82,
+  0x00, 0x02, 0xfb, 0xff, 0x0d, 0x82, 0x00, 0x00, 0xfc, 0x82, 0xff, 0x04,
+  0xef, 0xfe, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x0f, 0xf7, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x10, 0xff, 0xff, 0x5f,
+  0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f,
+  0x82, 0x00, 0x84, 0xcc, 0x07, 0xdc, 0xff, 0xef, 0x02, 0x00, 0x00, 0xf4,
+  0xaf, 0x82, 0x00, 0x09, 0xf4, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0xff,
+  0xff, 0xbf, 0x82, 0x00, 0x02, 0xd2, 0xff, 0xdb, 0x86, 0xff, 0x0c, 0x03,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f,
+  0x82, 0x00, 0x02, 0xfb, 0xff, 0x4f, 0x82, 0x00, 0x00, 0xd3, 0x82, 0xff,
+  0x04, 0x19, 0xf4, 0xff, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf7, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x82, 0x00, 0x02, 0xfb, 0xff,
+  0x06, 0x82, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00,
+  0x0f, 0x87, 0x00, 0x02, 0x70, 0xff, 0x6f, 0x82, 0x00, 0x0e, 0xfb, 0xff,
+  0x01, 0x00, 0x00, 0x90, 0xff, 0xff, 0x07, 0x00, 0x00, 0x70, 0xff, 0xff,
+  0xef, 0x83, 0x00, 0x01, 0x03, 0x50, 0x86, 0xff, 0x0c, 0x03, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00,
+  0x02, 0xfb, 0xff, 0xbf, 0x83, 0x00, 0x07, 0x86, 0x9c, 0x16, 0x00, 0x80,
+  0xff, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0x30, 0xff, 0xff, 0x2f, 0x82, 0x00, 0x01, 0x81, 0x27, 0x83, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x11,
+  0x70, 0xff, 0x0c, 0x00, 0x00, 0x30, 0xff, 0xff, 0x09, 0x00, 0x00, 0x10,
+  0xfe, 0xff, 0x07, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x03, 0x84, 0x00,
+  0x00, 0xfc, 0x85, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x03, 0xfb, 0xff, 0xff,
+  0x06, 0x87, 0x00, 0x02, 0xfc, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf7, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x4f, 0x88, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x08, 0x70,
+  0xff, 0x04, 0x00, 0x00, 0x90, 0xff, 0xff, 0x0f, 0x82, 0x00, 0x05, 0xf6,
+  0xff, 0x07, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0xf4, 0x85, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x03, 0xfb, 0xff, 0xff, 0x3f,
+  0x87, 0x00, 0x02, 0xf5, 0xff, 0xbf, 0x82, 0x00, 0x09, 0xf7, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x30, 0xff, 0xff, 0xcf, 0x85, 0x00, 0x03, 0x04, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x00, 0x0f, 0x87, 0x00,
+  0x01, 0x70, 0x9f, 0x82, 0x00, 0x03, 0xf1, 0xff, 0xff, 0x7f, 0x82, 0x00,
+  0x05, 0xc0, 0xff, 0x07, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x6f, 0x84,
+  0x00, 0x00, 0xb0, 0x85, 0xff, 0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x00, 0x05, 0x85, 0x00, 0x03, 0xb2, 0xff, 0xff, 0xbf, 0x82, 0x00,
+  0x06, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x05,
+  0x83, 0x00, 0x04, 0xc0, 0x0a, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xfe, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x01, 0x70, 0x1e, 0x82, 0x00, 0x03,
+  0xf9, 0xff, 0xff, 0xef, 0x82, 0x00, 0x05, 0x40, 0xff, 0x07, 0x00, 0x00,
+  0x70, 0x83, 0xff, 0x00, 0x0a, 0x82, 0x00, 0x01, 0x10, 0xf7, 0x85, 0xff,
+  0x0c, 0x03, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x3f, 0x82, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x01, 0xbf, 0x03, 0x83,
+  0x00, 0x00, 0x91, 0x82, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x06, 0xf7, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x05,
+  0x30, 0xfd, 0x0b, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x9d, 0xff, 0x04, 0xef, 0x7b, 0x36, 0x76, 0xfb, 0x9b, 0xff, 0x04, 0xef,
+  0x7a, 0x36, 0x86, 0xeb, 0x92, 0xff, 0x03, 0x9d, 0x37, 0x87, 0xfd, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xeb, 0xff
+};
+const uint32_t menu_4bpp_len = 16587;
@@ -1,745 +0,0 @@
-// Auto-generated by scripts/bake-menu.sh from worker/renderer/menu.png.
-// Do not edit by hand — re-run the script if the menu changes.
-#pragma once
-#include <stdint.h>
-
-const uint8_t menu_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x1c,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x98, 0xa7, 0x00, 0x00, 0x22,
-  0x50, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0xdd, 0xeb, 0x75, 0xb2,
-  0xdc, 0xba, 0x80, 0x61, 0x3a, 0x90, 0x0e, 0xb4, 0x03, 0x1d, 0x63, 0x17,
-  0x80, 0x1d, 0x68, 0x07, 0xd8, 0x81, 0xe9, 0x00, 0x3b, 0x30, 0x1d, 0x98,
-  0x0e, 0xfc, 0x3a, 0x20, 0x1d, 0x50, 0x02, 0x25, 0x50, 0x02, 0x7b, 0xc9,
-  0x3c, 0x4f, 0xd0, 0xd7, 0x44, 0x0d, 0x3c, 0xc9, 0x7d, 0xfd, 0x58, 0x2b,
-  0x72, 0x92, 0xf7, 0x1b, 0xb9, 0xe5, 0x6c, 0x92, 0x16, 0x80, 0x58, 0xc9,
-  0xd8, 0x2b, 0x00, 0xe0, 0xfb, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0xec, 0xf1,
-  0x80, 0xcb, 0x83, 0xe7, 0x74, 0x75, 0xcc, 0xe1, 0xe1, 0x37, 0x02, 0x10,
-  0x7b, 0x3c, 0xe0, 0x2c, 0xf1, 0x2c, 0xfc, 0x31, 0x7b, 0x7f, 0x0c, 0x9b,
-  0x7a, 0xe0, 0xf9, 0x9e, 0x1c, 0x70, 0x52, 0x7b, 0x63, 0x56, 0x04, 0x0c,
-  0xbc, 0xd6, 0xb3, 0x03, 0x3e, 0xfb, 0xcb, 0x0e, 0x34, 0x0f, 0xbf, 0x13,
-  0x80, 0xc8, 0xe3, 0x01, 0xa7, 0x41, 0xa6, 0x7b, 0x37, 0xa2, 0x0c, 0x03,
-  0x2e, 0x1f, 0x7e, 0x27, 0x00, 0x91, 0xc7, 0x03, 0x0e, 0x33, 0xcd, 0xdc,
-  0x88, 0x23, 0x01, 0x03, 0x2f, 0xf6, 0xec, 0x80, 0xbd, 0xe5, 0xe5, 0x04,
-  0x0c, 0xbc, 0xd8, 0xc3, 0x01, 0xd7, 0xc9, 0xb5, 0x4e, 0x17, 0xe1, 0x88,
-  0xe2, 0xd1, 0x77, 0x02, 0x10, 0x7b, 0x38, 0xe0, 0xe8, 0x48, 0x37, 0x39,
-  0x9a, 0x11, 0x4d, 0x42, 0xc0, 0xc0, 0x8b, 0x3d, 0x3d, 0xe0, 0xfc, 0xda,
-  0x08, 0x02, 0x06, 0x9e, 0xee, 0x79, 0x01, 0xcf, 0xd5, 0xff, 0xd9, 0x5b,
-  0x39, 0x0a, 0x7d, 0x56, 0xab, 0x57, 0xb6, 0xd1, 0xbc, 0xef, 0xd6, 0xdd,
-  0x6e, 0xf6, 0xfa, 0xed, 0xbf, 0xdb, 0xd7, 0x98, 0x9a, 0x8f, 0xcb, 0x84,
-  0xe9, 0xfa, 0xed, 0x7c, 0x73, 0x32, 0xe0, 0xcf, 0x79, 0x38, 0xe0, 0xc2,
-  0x06, 0xaa, 0xff, 0xdf, 0xb4, 0xb8, 0x51, 0x2f, 0xed, 0xed, 0x58, 0x59,
-  0x38, 0x5f, 0xbd, 0x0b, 0xae, 0x3f, 0xbd, 0x35, 0x83, 0x0b, 0xbd, 0x6c,
-  0xb6, 0x9b, 0x37, 0x37, 0xd9, 0xd6, 0x9b, 0xcc, 0x5d, 0x80, 0xb6, 0xc7,
-  0xdd, 0x43, 0x87, 0xe2, 0xc0, 0x2f, 0xf6, 0xbc, 0x80, 0x4f, 0xfa, 0xff,
-  0xcd, 0x56, 0x52, 0x9f, 0xc3, 0xb2, 0xe3, 0xc3, 0x80, 0xbd, 0x28, 0x95,
-  0xf4, 0x7d, 0x68, 0xa1, 0x9b, 0xb6, 0x2d, 0x83, 0x93, 0x61, 0xa9, 0x2b,
-  0x93, 0x80, 0x81, 0xe7, 0x05, 0x6c, 0xf6, 0xa5, 0xf5, 0xb1, 0xae, 0x39,
-  0x3b, 0x6d, 0xba, 0x4e, 0x56, 0xfe, 0x5c, 0xbb, 0xb8, 0xdf, 0x24, 0x49,
-  0x76, 0x03, 0x0b, 0x5d, 0xb5, 0xa7, 0x68, 0xaa, 0x85, 0xdd, 0x06, 0x13,
-  0x30, 0xf0, 0x70, 0xc0, 0x1b, 0x9b, 0xcc, 0x2c, 0xd8, 0xd2, 0x9e, 0xd5,
-  0xab, 0xb9, 0x3b, 0x97, 0xe5, 0xe6, 0x69, 0xc2, 0xbb, 0xa4, 0xfb, 0x05,
-  0xdb, 0x80, 0x93, 0xb8, 0x5f, 0xef, 0x64, 0x18, 0x01, 0x03, 0x0f, 0x07,
-  0x6c, 0x33, 0x2a, 0x4d, 0xca, 0x6a, 0xb8, 0x6e, 0x30, 0x1f, 0x0a, 0x78,
-  0x3d, 0xd8, 0xaf, 0x77, 0x09, 0xaa, 0xb8, 0x32, 0xc1, 0x45, 0x5a, 0xc7,
-  0xef, 0x4c, 0xc0, 0xf8, 0xb3, 0x9e, 0x18, 0xb0, 0xb9, 0x75, 0xb2, 0xf2,
-  0x87, 0x1f, 0x07, 0x02, 0x3e, 0x7b, 0x39, 0x2e, 0xf3, 0xa5, 0xf7, 0xaa,
-  0xd2, 0x53, 0xdc, 0x0a, 0x38, 0x39, 0xc5, 0xef, 0x4c, 0xc0, 0xf8, 0xb3,
-  0x1e, 0x0e, 0xd8, 0xee, 0x0d, 0x97, 0x55, 0x10, 0x98, 0x3e, 0xc7, 0x5c,
-  0xb9, 0x80, 0x4d, 0x9d, 0x8d, 0x3b, 0x2b, 0x95, 0x77, 0x07, 0xb4, 0xee,
-  0x9e, 0xcb, 0xb5, 0x9e, 0x24, 0x0c, 0x78, 0xb6, 0x2f, 0x8a, 0x99, 0x7b,
-  0x69, 0xf6, 0xa1, 0x09, 0x18, 0x78, 0x38, 0x60, 0x2f, 0x19, 0x53, 0xe5,
-  0x65, 0xb0, 0xa9, 0xd9, 0xbb, 0x9f, 0xc3, 0x34, 0xe5, 0x9e, 0xf3, 0x37,
-  0x97, 0x86, 0x5d, 0xc1, 0x3a, 0xf2, 0x20, 0xe0, 0xae, 0xf2, 0x66, 0x6e,
-  0x5f, 0x6f, 0xf4, 0x5c, 0x04, 0x0c, 0x3c, 0x33, 0x60, 0x5d, 0x54, 0x77,
-  0xba, 0x59, 0x9f, 0x7c, 0xca, 0x06, 0x02, 0xb6, 0xd7, 0x7f, 0x67, 0xe6,
-  0x84, 0xb2, 0xbb, 0xeb, 0x52, 0x27, 0xed, 0x07, 0xac, 0x1f, 0x50, 0x74,
-  0xd9, 0x9b, 0xeb, 0x51, 0x04, 0x0c, 0x3c, 0x33, 0x60, 0x93, 0x5d, 0xe3,
-  0x7a, 0x2b, 0xbc, 0x80, 0xf5, 0xb1, 0xab, 0x3b, 0x02, 0x76, 0xcf, 0x0e,
-  0xbb, 0x4d, 0xb0, 0x7a, 0xed, 0x05, 0x6c, 0xb6, 0xb7, 0xde, 0x9d, 0x99,
-  0x7a, 0x08, 0x01, 0x03, 0x8f, 0x06, 0xec, 0x6f, 0x60, 0x4b, 0x2f, 0x1e,
-  0x5d, 0xd7, 0xd9, 0x9b, 0x40, 0x1f, 0xbb, 0xe6, 0x03, 0x91, 0xc5, 0x07,
-  0xca, 0x2e, 0xe0, 0x79, 0xd3, 0x9b, 0x84, 0x80, 0x01, 0xe3, 0x99, 0x01,
-  0x9b, 0x7e, 0x0a, 0x97, 0x52, 0xe3, 0x45, 0xa5, 0x03, 0x76, 0x77, 0x50,
-  0x0e, 0x2d, 0x45, 0x5d, 0x49, 0x72, 0x01, 0x67, 0xfd, 0x49, 0x08, 0x18,
-  0x30, 0x9e, 0x1a, 0x70, 0x66, 0xa3, 0xd3, 0xe7, 0xb0, 0xe6, 0x7e, 0x54,
-  0x6a, 0x8f, 0xb9, 0xb2, 0xaf, 0x67, 0x6e, 0x29, 0xee, 0xa1, 0x62, 0x75,
-  0x10, 0x4c, 0xc0, 0xc0, 0x5d, 0x1e, 0x0d, 0xf8, 0xe4, 0x27, 0xa3, 0x0f,
-  0x7c, 0x53, 0xfb, 0x75, 0x3a, 0xb9, 0x1f, 0x95, 0x6a, 0xb1, 0x8c, 0x5e,
-  0xeb, 0xd5, 0x08, 0x07, 0x12, 0x30, 0x70, 0x97, 0x47, 0x03, 0x2e, 0xfc,
-  0x64, 0xcc, 0xf9, 0xa9, 0xca, 0x1c, 0xe8, 0x1e, 0xfb, 0x6d, 0xfa, 0x77,
-  0x71, 0x0c, 0x20, 0x60, 0xe0, 0x0b, 0x9e, 0x1a, 0xb0, 0xb9, 0x1c, 0x74,
-  0x32, 0xb7, 0x77, 0x54, 0xb7, 0x36, 0xae, 0x04, 0x0c, 0x3c, 0xea, 0xd1,
-  0x80, 0xf7, 0x41, 0x56, 0xfa, 0xb6, 0xc8, 0x7d, 0xeb, 0x0d, 0xb3, 0x13,
-  0xa4, 0xdd, 0x0c, 0xff, 0x08, 0x38, 0x89, 0x26, 0x22, 0x60, 0xe0, 0x86,
-  0x47, 0x03, 0xce, 0x82, 0xac, 0xf4, 0x9e, 0xf3, 0xaa, 0xf4, 0xea, 0x5b,
-  0x86, 0xe1, 0xfd, 0x23, 0xe0, 0x65, 0x34, 0x11, 0x01, 0x03, 0x37, 0x3c,
-  0x37, 0x60, 0x73, 0x4a, 0x4b, 0x07, 0x58, 0xf4, 0xa7, 0x60, 0x17, 0x1a,
-  0x78, 0xa2, 0xe7, 0x06, 0x6c, 0x2e, 0x07, 0xa5, 0x5e, 0x45, 0x6e, 0x8a,
-  0xee, 0x39, 0x40, 0x02, 0x06, 0x9e, 0xe7, 0xd1, 0x80, 0xa3, 0xdb, 0x32,
-  0xdc, 0x23, 0x07, 0x89, 0xf9, 0x7a, 0xac, 0xa8, 0x33, 0x77, 0xdd, 0x69,
-  0x75, 0x7d, 0xa9, 0x04, 0x0c, 0xdc, 0xe5, 0xd1, 0x80, 0xa3, 0xac, 0x82,
-  0xbf, 0xc6, 0xa0, 0x8e, 0x67, 0xa3, 0xce, 0xbc, 0x10, 0xaf, 0x7f, 0x15,
-  0x25, 0x01, 0x03, 0x77, 0x79, 0x5a, 0xc0, 0xaa, 0xd6, 0xe0, 0xef, 0x21,
-  0xa9, 0xbb, 0xaa, 0x36, 0x51, 0x54, 0xf7, 0x44, 0x46, 0xc0, 0xc0, 0x5d,
-  0x1e, 0x0c, 0xb8, 0x8e, 0x4a, 0x73, 0x37, 0x4a, 0xda, 0xc7, 0x8f, 0x5c,
-  0x8c, 0xea, 0x66, 0x68, 0xd7, 0xdd, 0xfe, 0xea, 0x62, 0x09, 0x18, 0xb8,
-  0xcb, 0x83, 0x01, 0xf7, 0x6e, 0x8c, 0xf4, 0xbe, 0x39, 0xa3, 0xf7, 0x64,
-  0x91, 0x0a, 0xd8, 0x6d, 0xa4, 0xd3, 0x3a, 0x58, 0x96, 0xf7, 0xea, 0x8b,
-  0x01, 0x17, 0xbd, 0xd9, 0x08, 0x18, 0x7f, 0xc3, 0xb3, 0x03, 0x76, 0x3b,
-  0xcc, 0xe6, 0x61, 0x85, 0x38, 0x60, 0xef, 0xaf, 0xa1, 0xad, 0xbd, 0x25,
-  0x35, 0x5b, 0xaf, 0xe7, 0xbb, 0x02, 0x76, 0x6f, 0xa5, 0xbf, 0x06, 0xc0,
-  0xff, 0x06, 0x4b, 0x02, 0xc6, 0x9f, 0xf0, 0xec, 0x80, 0xbd, 0x8d, 0x60,
-  0x6f, 0x88, 0x7e, 0x36, 0xdf, 0x3b, 0xd1, 0xb5, 0x36, 0x9d, 0x35, 0x87,
-  0xd4, 0x3f, 0x2d, 0x7d, 0x57, 0xc0, 0xde, 0x5b, 0x75, 0xdb, 0xfa, 0x77,
-  0xaf, 0x5f, 0x02, 0xc6, 0xdf, 0xf0, 0x60, 0xc0, 0xbd, 0xd2, 0xbc, 0xce,
-  0x8a, 0x2b, 0x93, 0x04, 0x7f, 0x90, 0x74, 0x7d, 0x78, 0xff, 0x7c, 0x3f,
-  0xe8, 0xef, 0x99, 0xdd, 0x5f, 0x5d, 0xec, 0x50, 0xc0, 0xde, 0x09, 0xb3,
-  0xf4, 0xed, 0x70, 0x08, 0xff, 0x9a, 0x29, 0x01, 0xe3, 0x4f, 0x78, 0x5a,
-  0xc0, 0xe6, 0x0b, 0xea, 0x7a, 0x0d, 0xf5, 0x9f, 0x1f, 0x0c, 0x4e, 0x55,
-  0x07, 0xce, 0xbd, 0xc5, 0xde, 0x08, 0x38, 0xfe, 0xf3, 0x87, 0x04, 0x8c,
-  0xbf, 0xe7, 0x69, 0x01, 0x9b, 0x13, 0x49, 0x55, 0x69, 0xe8, 0xcb, 0xbc,
-  0xae, 0x33, 0xbb, 0x8b, 0x9c, 0x5d, 0xa9, 0xce, 0x9e, 0xd6, 0xba, 0x2b,
-  0xe0, 0xe8, 0xae, 0x91, 0x0b, 0x77, 0x0a, 0x8d, 0x80, 0xf1, 0x27, 0x3c,
-  0x18, 0xb0, 0x3b, 0x91, 0x74, 0xf5, 0xcf, 0xff, 0x0e, 0x94, 0xd7, 0x2c,
-  0xe3, 0xf2, 0x0c, 0xfd, 0xc5, 0x77, 0xf7, 0x05, 0xdc, 0xff, 0xb3, 0x2b,
-  0xc1, 0xd7, 0x0b, 0x00, 0xbf, 0xdf, 0x83, 0x01, 0xf7, 0x2f, 0xe5, 0xf4,
-  0x0c, 0x94, 0xd7, 0x36, 0x79, 0x9c, 0x5e, 0x67, 0xd9, 0xff, 0xcb, 0x0c,
-  0xb7, 0x02, 0xee, 0x6d, 0x82, 0x4f, 0xde, 0xdf, 0x89, 0x78, 0xec, 0xdf,
-  0x05, 0xc8, 0x30, 0x4e, 0xc0, 0x6d, 0xeb, 0xff, 0xa9, 0x05, 0x6d, 0xe6,
-  0x16, 0x71, 0x67, 0xc0, 0x55, 0xb0, 0x90, 0xd9, 0xa9, 0x25, 0x60, 0xfc,
-  0x31, 0x0f, 0x06, 0xec, 0x4e, 0xfd, 0x5e, 0x0d, 0xd8, 0x3b, 0xe9, 0xec,
-  0x57, 0xd5, 0x44, 0x09, 0xcf, 0x4f, 0xde, 0xad, 0xd1, 0x77, 0x06, 0xdc,
-  0x56, 0xde, 0xbe, 0x78, 0x56, 0x07, 0x7f, 0x2b, 0xf1, 0xb1, 0x7f, 0x17,
-  0x20, 0xc3, 0xc3, 0x5f, 0xec, 0xfe, 0x80, 0xb2, 0xc8, 0xd4, 0x4e, 0x70,
-  0xb6, 0x39, 0xd5, 0x77, 0x4c, 0x3f, 0xe4, 0x94, 0x5f, 0x3e, 0x07, 0x66,
-  0x59, 0xf1, 0xdd, 0x05, 0x00, 0x92, 0x8d, 0x19, 0x30, 0x80, 0x07, 0x11,
-  0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03,
-  0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18,
-  0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30,
-  0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82,
-  0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01,
-  0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20,
-  0x18, 0x01, 0x03, 0x82, 0x3d, 0x14, 0xf0, 0xff, 0x01, 0x78, 0x18, 0x01,
-  0x03, 0x82, 0x11, 0x30, 0x20, 0xd8, 0x68, 0x01, 0x03, 0x18, 0x17, 0x01,
-  0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20,
-  0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11,
-  0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03,
-  0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18,
-  0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30,
-  0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82,
-  0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01,
-  0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20,
-  0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11,
-  0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03,
-  0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18,
-  0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30,
-  0x20, 0x18, 0x01, 0x03, 0x82, 0x11, 0x30, 0x20, 0x18, 0x01, 0x03, 0x82,
-  0x11, 0x30, 0x20, 0x98, 0xec, 0x80, 0xeb, 0xc3, 0xf6, 0xed, 0x3c, 0xf6,
-  0x4a, 0x00, 0xe3, 0x11, 0x1d, 0xf0, 0x39, 0x4d, 0x92, 0x24, 0xd9, 0x8d,
-  0xbd, 0x1a, 0xc0, 0x68, 0x24, 0x07, 0xdc, 0x74, 0xfd, 0x26, 0x09, 0xdb,
-  0x60, 0xfc, 0x59, 0x92, 0x03, 0x2e, 0x55, 0xbf, 0x49, 0x3e, 0xf6, 0x8a,
-  0x00, 0x63, 0x91, 0x1c, 0xf0, 0x59, 0x07, 0x9c, 0x8d, 0xbd, 0x22, 0xc0,
-  0x58, 0x7e, 0x3e, 0xe0, 0x83, 0xf5, 0xf1, 0x59, 0x3d, 0xb4, 0xa4, 0x4a,
-  0x07, 0xbc, 0x7f, 0xda, 0xba, 0x01, 0xc2, 0xfc, 0x7c, 0xc0, 0x49, 0x60,
-  0xfd, 0x5e, 0x7f, 0x7f, 0x51, 0x9b, 0x6e, 0x11, 0xb3, 0xe6, 0x99, 0xab,
-  0x77, 0x97, 0x07, 0xd6, 0x19, 0x78, 0xa6, 0xb1, 0x03, 0x4e, 0x92, 0x64,
-  0xfb, 0xed, 0x1c, 0x9a, 0x7d, 0x92, 0x24, 0xcb, 0xc7, 0x36, 0xe3, 0x5f,
-  0x53, 0x1e, 0x76, 0xeb, 0x55, 0x92, 0x14, 0x3f, 0xf8, 0x96, 0xc0, 0x0d,
-  0x13, 0x08, 0x38, 0x49, 0x0e, 0xdf, 0x5f, 0x5a, 0xf5, 0xb3, 0x9b, 0xdf,
-  0x42, 0xad, 0x30, 0x01, 0x63, 0x22, 0x26, 0x11, 0xb0, 0x9c, 0x4b, 0xb9,
-  0x04, 0x8c, 0x69, 0x19, 0x2d, 0xe0, 0x2c, 0xcb, 0x32, 0x79, 0x05, 0x13,
-  0x30, 0xa6, 0x65, 0xb4, 0x80, 0xbb, 0x9f, 0xcf, 0xb6, 0xe1, 0xf2, 0xc7,
-  0xd7, 0xe3, 0x5b, 0x08, 0x18, 0xd3, 0x32, 0x6e, 0xc0, 0x6d, 0x9b, 0x9b,
-  0xb3, 0xd1, 0x6e, 0x82, 0x7a, 0xb7, 0xbe, 0xdc, 0x62, 0xb5, 0x78, 0xd3,
-  0x51, 0xd7, 0xfa, 0xaa, 0x93, 0x39, 0xd7, 0xa5, 0x5f, 0x9f, 0xda, 0xf6,
-  0x14, 0x8e, 0xb8, 0x9c, 0x64, 0xda, 0xae, 0x2f, 0x4b, 0x5b, 0xbd, 0x79,
-  0x1f, 0x08, 0xcd, 0xc7, 0x7a, 0x91, 0x24, 0x49, 0xba, 0xfd, 0xb8, 0x72,
-  0xbc, 0x5c, 0xbf, 0x77, 0x33, 0x25, 0xab, 0xdd, 0x87, 0x3f, 0xb8, 0x79,
-  0x37, 0xf3, 0xe9, 0x01, 0xa7, 0xc3, 0x61, 0xad, 0xd7, 0xb6, 0x7b, 0xdf,
-  0x60, 0x5d, 0xe2, 0x17, 0x76, 0xd5, 0xea, 0xb7, 0x45, 0xf7, 0xaf, 0xe1,
-  0xcc, 0x35, 0x5e, 0x60, 0xec, 0x80, 0xdb, 0xa5, 0x7e, 0x6d, 0xce, 0x25,
-  0x37, 0x5b, 0xef, 0x1a, 0x53, 0x37, 0xb0, 0xd1, 0xaf, 0x8e, 0x7a, 0x0a,
-  0xbd, 0x15, 0xdc, 0xb7, 0x6d, 0x16, 0x6d, 0xbd, 0xcf, 0x8b, 0x78, 0xde,
-  0x4b, 0x49, 0xa9, 0x1d, 0xb6, 0x18, 0xba, 0xe9, 0xb2, 0x39, 0x78, 0x07,
-  0xe3, 0x0b, 0x97, 0x70, 0x7f, 0x3e, 0x6f, 0x97, 0xff, 0x62, 0xe9, 0x6e,
-  0x06, 0x53, 0xb7, 0x92, 0x04, 0x2f, 0xd4, 0xcf, 0xe7, 0xf6, 0xcd, 0x4c,
-  0x9e, 0x9e, 0x9e, 0xfc, 0x1f, 0x12, 0x98, 0x40, 0xc0, 0xe6, 0x7e, 0x48,
-  0x9d, 0x67, 0xb5, 0xf0, 0x1b, 0x49, 0xbb, 0x36, 0xd5, 0xe5, 0x5e, 0x7b,
-  0xc7, 0x64, 0x66, 0x8b, 0x8f, 0x02, 0xf6, 0x4b, 0xb4, 0x4b, 0xdc, 0x05,
-  0xc3, 0xde, 0x7a, 0xab, 0xd3, 0xac, 0xc2, 0xb9, 0xf4, 0xae, 0x40, 0x33,
-  0x30, 0x5f, 0x14, 0xf0, 0xe6, 0x8e, 0x80, 0x0b, 0x7f, 0x31, 0x14, 0x8c,
-  0xa7, 0x1b, 0x3d, 0xe0, 0x76, 0xe6, 0xe7, 0x59, 0xa7, 0x49, 0xe8, 0xb2,
-  0x1d, 0x3d, 0xa9, 0x1f, 0x17, 0xc1, 0x02, 0xe6, 0x6d, 0x1c, 0xf0, 0x2e,
-  0x9a, 0xb5, 0x1b, 0xbc, 0x8e, 0x06, 0xf6, 0x8e, 0x5e, 0xe3, 0x09, 0x36,
-  0x6a, 0xf0, 0x6a, 0x60, 0xbe, 0xac, 0x3f, 0xe8, 0x5f, 0x01, 0x87, 0xff,
-  0x9c, 0x9f, 0xbf, 0xe3, 0x04, 0xbf, 0xdd, 0xf8, 0x01, 0x6f, 0xfc, 0x3c,
-  0x75, 0x4e, 0xf3, 0x7c, 0xaf, 0x77, 0xad, 0x17, 0x8d, 0xdb, 0x87, 0x56,
-  0x47, 0x91, 0x3a, 0x93, 0x7d, 0x1c, 0xf0, 0x39, 0x09, 0x75, 0xa9, 0xea,
-  0xf6, 0x67, 0x59, 0x91, 0xcd, 0x82, 0xda, 0x8d, 0x32, 0x9a, 0x6b, 0xa6,
-  0xde, 0x44, 0xef, 0xa6, 0xcf, 0x36, 0x85, 0xa9, 0xb6, 0xec, 0x05, 0x7c,
-  0xba, 0x23, 0xe0, 0xd0, 0xb1, 0x05, 0x9e, 0x6b, 0xfc, 0x80, 0x0b, 0x6f,
-  0xc0, 0x51, 0xfd, 0x98, 0x7b, 0xc3, 0x4f, 0xae, 0xf1, 0xb3, 0x3f, 0x7d,
-  0x19, 0x05, 0x6c, 0x9e, 0x2d, 0x4c, 0xf6, 0xa7, 0xf2, 0x98, 0xab, 0x23,
-  0x54, 0x33, 0x70, 0x76, 0xd9, 0x8e, 0x57, 0xaa, 0xe0, 0x75, 0xb8, 0x36,
-  0x66, 0xf7, 0xbc, 0x69, 0xdb, 0xea, 0x9c, 0x9b, 0xc6, 0xea, 0xc1, 0xf9,
-  0x4e, 0x85, 0xc9, 0x39, 0x2b, 0x8a, 0xa2, 0xa8, 0xef, 0x0a, 0x78, 0x76,
-  0x6a, 0xea, 0xb3, 0xfe, 0xf0, 0x58, 0xb4, 0xc0, 0x73, 0x4d, 0x2b, 0x60,
-  0x75, 0x00, 0xac, 0x6f, 0x6e, 0x9e, 0xdb, 0x5f, 0x7a, 0xbd, 0x1d, 0x55,
-  0x0f, 0x2d, 0xe8, 0x1b, 0xa0, 0xdb, 0x28, 0x60, 0xdd, 0xfe, 0x4c, 0x55,
-  0x5e, 0x6f, 0x6a, 0x6f, 0xa0, 0x3a, 0xf8, 0x3c, 0x79, 0x53, 0x5b, 0x7a,
-  0x57, 0x59, 0x9f, 0xf1, 0xaa, 0xf5, 0x73, 0x11, 0x7b, 0x7f, 0x3e, 0xef,
-  0x13, 0xa3, 0x77, 0x19, 0xe9, 0x9f, 0x01, 0x77, 0x9f, 0x01, 0xf6, 0xb1,
-  0x0b, 0x21, 0x17, 0xcb, 0x20, 0xc7, 0xf8, 0x01, 0xeb, 0xae, 0x2e, 0x3b,
-  0xc8, 0xb5, 0x1f, 0xaa, 0x19, 0xe1, 0x86, 0xaf, 0xba, 0xc1, 0xa9, 0xdb,
-  0x48, 0xfb, 0x01, 0xaf, 0x82, 0x79, 0xb5, 0x95, 0x8b, 0xdd, 0xee, 0x89,
-  0x87, 0x47, 0xc1, 0x4b, 0x3f, 0x55, 0x4b, 0x7d, 0x90, 0xcc, 0xd5, 0x8b,
-  0xda, 0x9b, 0xef, 0xcb, 0x01, 0x97, 0xc1, 0xdb, 0x70, 0xfd, 0x18, 0x4f,
-  0x36, 0x7e, 0xc0, 0xa5, 0xfb, 0x55, 0x0f, 0x36, 0x98, 0x66, 0xc4, 0xc9,
-  0xfd, 0xfe, 0xb7, 0x6e, 0x63, 0xd6, 0x6d, 0x68, 0xbd, 0x80, 0xcd, 0x36,
-  0x2e, 0xb8, 0xda, 0x5a, 0xfb, 0x45, 0x99, 0x4d, 0x7a, 0xf8, 0xf4, 0xb0,
-  0xde, 0x85, 0x4e, 0x82, 0xcb, 0xb4, 0xd1, 0x7c, 0xde, 0xab, 0x2f, 0x07,
-  0xac, 0xa7, 0xd3, 0x9b, 0x74, 0xbe, 0x7a, 0x00, 0x4f, 0x36, 0x9d, 0x80,
-  0x2b, 0x5b, 0x93, 0xde, 0x6a, 0x55, 0x2e, 0x96, 0xa3, 0x1b, 0x71, 0xf4,
-  0x36, 0xaa, 0x59, 0x3c, 0x58, 0x1d, 0xf9, 0xc6, 0x8b, 0x36, 0x5b, 0xe5,
-  0x2c, 0x7a, 0xe7, 0xd6, 0xcd, 0xd7, 0xdd, 0xfc, 0x61, 0x1b, 0x3e, 0x87,
-  0x99, 0x7a, 0x1f, 0x1f, 0xdf, 0x0d, 0xf8, 0x18, 0x7e, 0x24, 0x00, 0x4f,
-  0x32, 0x7e, 0xc0, 0x47, 0x37, 0x40, 0x17, 0xb6, 0xd6, 0x5c, 0x7e, 0xde,
-  0x5e, 0x6c, 0xee, 0x6d, 0xca, 0xbc, 0x80, 0x8b, 0xa1, 0x42, 0xf4, 0xc0,
-  0x85, 0x5e, 0x5e, 0x3a, 0x10, 0xb0, 0xbd, 0x91, 0xa4, 0x6b, 0x58, 0xdf,
-  0xab, 0x75, 0x7d, 0xbe, 0xef, 0x06, 0x1c, 0x8c, 0x02, 0x9e, 0x66, 0xfc,
-  0x80, 0xbd, 0x93, 0x58, 0xd1, 0x75, 0x1a, 0xef, 0x97, 0x7e, 0x69, 0x7f,
-  0x54, 0x87, 0xa7, 0x6a, 0x2f, 0xdb, 0x0b, 0x78, 0x7f, 0x23, 0xe0, 0x48,
-  0xb8, 0x3a, 0xfa, 0x24, 0xb3, 0x49, 0xb8, 0xba, 0x3d, 0xdf, 0x83, 0x01,
-  0x4b, 0xfe, 0x02, 0x23, 0x4c, 0xd2, 0xf8, 0x01, 0xeb, 0xbb, 0xa1, 0x67,
-  0xee, 0x9e, 0x8e, 0x81, 0x80, 0xd5, 0x66, 0x3a, 0xb5, 0xdb, 0x62, 0xb5,
-  0xa5, 0xf4, 0x02, 0xd6, 0x3f, 0x86, 0x07, 0x99, 0xf7, 0x04, 0xdc, 0x36,
-  0xe1, 0xc7, 0xc6, 0xf9, 0xe6, 0x7c, 0x04, 0x8c, 0x69, 0x19, 0x3f, 0x60,
-  0x7d, 0xfa, 0x78, 0x73, 0x73, 0x0b, 0xac, 0x8f, 0x87, 0x2b, 0x7d, 0x6a,
-  0x5a, 0xdf, 0x2e, 0xf5, 0x8c, 0x2d, 0xf0, 0xe5, 0x90, 0x77, 0xe3, 0x8d,
-  0x4d, 0x9b, 0x17, 0x06, 0x3c, 0x7b, 0xfa, 0x7f, 0x4d, 0xfc, 0x71, 0xa3,
-  0x07, 0xac, 0x37, 0xa9, 0xdd, 0x1d, 0x14, 0x66, 0x33, 0x5a, 0xf8, 0xd4,
-  0x29, 0xad, 0xb9, 0x9e, 0x48, 0x6d, 0xaf, 0xf5, 0x79, 0xea, 0x3b, 0x8f,
-  0x81, 0xb3, 0x60, 0x79, 0x43, 0x97, 0x72, 0xea, 0xa3, 0xfb, 0xec, 0xd8,
-  0xdc, 0x9a, 0x8f, 0x93, 0x58, 0x98, 0x96, 0xd1, 0x03, 0x36, 0x5b, 0xbb,
-  0xca, 0xed, 0x4d, 0x0f, 0xdd, 0xf4, 0xaf, 0xb6, 0xb0, 0xb9, 0xde, 0x5e,
-  0xeb, 0x9b, 0x8a, 0xfb, 0x67, 0xa1, 0xc3, 0x7b, 0x9d, 0xce, 0x5f, 0xc8,
-  0xa6, 0x36, 0x2b, 0xb2, 0xb2, 0xf3, 0x6d, 0xfa, 0x53, 0x7d, 0x37, 0xe0,
-  0xc1, 0xcf, 0x17, 0xe0, 0x61, 0x63, 0x07, 0x6c, 0xae, 0xdf, 0x76, 0xd7,
-  0x7f, 0xf4, 0xad, 0x1b, 0x43, 0x57, 0x4b, 0xd5, 0x74, 0x8b, 0xc6, 0x4d,
-  0x3c, 0x7c, 0x1d, 0x38, 0xb8, 0xd7, 0xa9, 0x09, 0xdf, 0xeb, 0x1f, 0xce,
-  0x76, 0x6a, 0x3d, 0x5f, 0xda, 0x9f, 0x26, 0x5e, 0xc3, 0x7b, 0x03, 0x5e,
-  0x45, 0xe1, 0x03, 0xcf, 0x31, 0x72, 0xc0, 0xef, 0x66, 0xc7, 0xb5, 0xdb,
-  0xea, 0x9a, 0xdd, 0x69, 0xfb, 0x3d, 0x93, 0xb5, 0x7b, 0x7e, 0x47, 0xef,
-  0x43, 0xab, 0xff, 0xd5, 0xc3, 0xfc, 0x3b, 0xb1, 0xf4, 0xe5, 0x20, 0x73,
-  0xab, 0xb3, 0x7f, 0x37, 0xa6, 0xd7, 0xcd, 0xc0, 0x37, 0x58, 0xfe, 0x67,
-  0xc7, 0xb9, 0x35, 0xd3, 0xf3, 0x1d, 0x7b, 0xf3, 0xc5, 0x97, 0x83, 0xfc,
-  0xd7, 0xe6, 0xc1, 0xc4, 0x20, 0x60, 0x35, 0x63, 0xef, 0x1f, 0x06, 0x3c,
-  0xc7, 0x68, 0x01, 0x7f, 0x7e, 0x7e, 0x7e, 0xbc, 0xd9, 0x87, 0xf6, 0xf4,
-  0x36, 0x55, 0x9f, 0x4d, 0x5a, 0xa9, 0x5b, 0x2a, 0x9a, 0xf7, 0x74, 0x6b,
-  0x67, 0x53, 0xfb, 0xd0, 0xea, 0x22, 0x92, 0xb9, 0xe3, 0x62, 0xe0, 0x5e,
-  0xe8, 0x64, 0x5d, 0x77, 0x5f, 0xea, 0xa1, 0x06, 0x9a, 0xdb, 0x34, 0xf5,
-  0x83, 0xfc, 0xe5, 0x2a, 0xed, 0x7d, 0x2f, 0x46, 0x91, 0x2c, 0xf4, 0x56,
-  0x5b, 0x2f, 0x61, 0xee, 0xe6, 0x4b, 0xcb, 0x78, 0x3e, 0xaf, 0xc4, 0xba,
-  0xf2, 0xa2, 0x6f, 0xbc, 0xc7, 0x19, 0x83, 0x80, 0xd3, 0xca, 0x4b, 0x9b,
-  0x73, 0x58, 0x78, 0xb6, 0x69, 0x7c, 0x2b, 0xe5, 0x52, 0x6f, 0x69, 0xed,
-  0xc3, 0x7d, 0x6f, 0x87, 0xcf, 0xf7, 0x5d, 0xea, 0x6f, 0x04, 0x2b, 0x6f,
-  0x6a, 0x33, 0x2c, 0x78, 0x1a, 0x69, 0x6e, 0x46, 0xa7, 0xdd, 0x9d, 0x17,
-  0x97, 0xb3, 0xc9, 0x6d, 0x63, 0x2e, 0x4c, 0xad, 0x0f, 0xff, 0x7d, 0x1c,
-  0x56, 0xf6, 0x7e, 0x6a, 0xa7, 0x4b, 0x75, 0xf5, 0xf6, 0xfe, 0xf9, 0x69,
-  0xfa, 0xcb, 0x07, 0xe7, 0x5b, 0x47, 0x6b, 0xbf, 0x4a, 0xd5, 0xa2, 0xcc,
-  0xcb, 0xc3, 0xce, 0x3e, 0xfa, 0x1b, 0x3e, 0x8d, 0x94, 0x6e, 0x0f, 0x3b,
-  0xf3, 0x25, 0x05, 0xec, 0x41, 0xe3, 0xd9, 0x26, 0x11, 0xf0, 0xd2, 0xee,
-  0x29, 0xef, 0x7b, 0xe3, 0xec, 0x5e, 0xa7, 0xbb, 0x48, 0x6c, 0x3b, 0x08,
-  0x9e, 0x07, 0x8e, 0x9f, 0xec, 0xdd, 0x0e, 0x0d, 0x8c, 0x9f, 0x76, 0x88,
-  0x1f, 0x22, 0x36, 0x9b, 0xf7, 0xfe, 0x7c, 0xfa, 0x4d, 0x73, 0x6f, 0xd0,
-  0xc9, 0xed, 0x6c, 0xfb, 0xae, 0x3e, 0x0f, 0x3c, 0xe7, 0x81, 0x7e, 0x3c,
-  0xdb, 0x14, 0x02, 0xf6, 0x37, 0x4c, 0xbd, 0x4b, 0xc1, 0x36, 0x38, 0x97,
-  0x4e, 0x15, 0x4d, 0xac, 0x77, 0x74, 0x4f, 0xd1, 0x9c, 0xc7, 0xa1, 0x81,
-  0x51, 0x45, 0x79, 0x3c, 0xda, 0x9c, 0x02, 0xef, 0xcf, 0xa7, 0x86, 0xd7,
-  0xde, 0xa0, 0x45, 0xf4, 0x09, 0xb0, 0x74, 0xf7, 0x8b, 0x0d, 0x06, 0xcc,
-  0x9f, 0x41, 0xc5, 0xd3, 0x8d, 0x1e, 0xf0, 0x6c, 0x1f, 0x1e, 0x96, 0x86,
-  0x49, 0x2d, 0xdd, 0x59, 0x65, 0x9b, 0xca, 0xdc, 0x0e, 0x8a, 0xbe, 0x13,
-  0xab, 0x0c, 0xee, 0xe4, 0xca, 0xd4, 0x72, 0x4f, 0xc1, 0xc0, 0x59, 0x11,
-  0x6d, 0x05, 0x8f, 0xe1, 0xdd, 0x5f, 0x33, 0x7b, 0x09, 0x2b, 0x9a, 0xcf,
-  0xee, 0xca, 0x1f, 0xbd, 0xa1, 0xa7, 0xe0, 0x13, 0x67, 0x5e, 0x15, 0xfd,
-  0x80, 0xf7, 0xe1, 0xd4, 0xc0, 0x73, 0x8d, 0x19, 0xf0, 0x2c, 0xcb, 0x8a,
-  0xfe, 0x23, 0xee, 0xa5, 0x97, 0x44, 0xf0, 0x3b, 0x6f, 0x8a, 0x72, 0x3b,
-  0xc1, 0xf1, 0xb7, 0x52, 0xd6, 0x85, 0xdd, 0xa3, 0xcd, 0xec, 0xc0, 0xa6,
-  0x70, 0x29, 0xe6, 0xfd, 0x9d, 0xd8, 0xe6, 0xe8, 0xf6, 0x82, 0x83, 0xbc,
-  0x6b, 0xef, 0xa3, 0xc4, 0x1f, 0x5e, 0xce, 0x83, 0xa9, 0x9b, 0xbd, 0x5b,
-  0xf6, 0x40, 0xc0, 0xad, 0xf9, 0x36, 0x8e, 0x8c, 0x87, 0xf9, 0xf1, 0x02,
-  0x53, 0xbc, 0x3b, 0xb7, 0x39, 0x17, 0xfb, 0x6c, 0x7f, 0x2c, 0xbf, 0x73,
-  0xc8, 0x58, 0x16, 0xc5, 0x66, 0x5f, 0x94, 0x75, 0x6f, 0x60, 0x1e, 0x0f,
-  0x74, 0xea, 0x53, 0xb1, 0xcf, 0xf2, 0xe2, 0xd8, 0xbb, 0xc8, 0x33, 0x3c,
-  0x5f, 0x53, 0x1e, 0x2f, 0x93, 0x9f, 0xcd, 0xea, 0x55, 0xc7, 0x7d, 0x56,
-  0x1c, 0xe3, 0x95, 0x35, 0x01, 0xb7, 0x4d, 0x59, 0xe4, 0xfb, 0x82, 0x0b,
-  0x48, 0x78, 0x89, 0x29, 0x06, 0xfc, 0x2b, 0xd8, 0x80, 0x81, 0x17, 0xe2,
-  0x37, 0xec, 0x45, 0x08, 0x18, 0x3f, 0x81, 0xdf, 0xb0, 0x17, 0x21, 0x60,
-  0xfc, 0x04, 0x7e, 0xc3, 0x5e, 0x84, 0x80, 0xf1, 0x13, 0xf8, 0x0d, 0x7b,
-  0x11, 0x02, 0xc6, 0x4f, 0xe0, 0x37, 0xec, 0x45, 0x08, 0x18, 0x3f, 0x81,
-  0xdf, 0xb0, 0x17, 0x21, 0x60, 0xfc, 0x04, 0x7e, 0xc3, 0x5e, 0x84, 0x80,
-  0xf1, 0x13, 0xf8, 0x0d, 0x7b, 0x91, 0xcb, 0x9d, 0x21, 0x25, 0x77, 0x5f,
-  0xe1, 0xc5, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x04, 0x05, 0x5c, 0x7d, 0x56,
-  0x63, 0xaf, 0xc2, 0x0d, 0xd5, 0xe7, 0xe7, 0xd8, 0xab, 0x80, 0x3f, 0x48,
-  0x46, 0xc0, 0xf5, 0x7a, 0x9d, 0x24, 0x49, 0x52, 0x8c, 0xbd, 0x1e, 0x37,
-  0x14, 0x97, 0x15, 0x5c, 0xad, 0x4f, 0x63, 0xaf, 0x07, 0xfe, 0x16, 0x19,
-  0x01, 0x97, 0x49, 0x22, 0x22, 0xe0, 0x69, 0xaf, 0x22, 0x7e, 0xa1, 0x9f,
-  0x0f, 0xf8, 0x60, 0x7d, 0xdc, 0xbd, 0x4f, 0x4c, 0xc0, 0xc0, 0xa0, 0x9f,
-  0x0f, 0x38, 0x09, 0xac, 0xdf, 0xeb, 0x3b, 0xe6, 0x21, 0x60, 0x60, 0xd0,
-  0xd8, 0x01, 0x27, 0x49, 0xb2, 0xfd, 0x77, 0xc2, 0x04, 0x0c, 0x0c, 0x9a,
-  0x40, 0xc0, 0x49, 0x72, 0xf8, 0xd7, 0x3c, 0x04, 0x0c, 0x0c, 0x9a, 0x44,
-  0xc0, 0xc9, 0xee, 0x1f, 0xf3, 0x3c, 0x27, 0xe0, 0x8f, 0xc5, 0x0b, 0xaf,
-  0x43, 0x11, 0x30, 0xc6, 0x30, 0x5a, 0xc0, 0x59, 0x96, 0x65, 0x77, 0x17,
-  0xfc, 0x84, 0x80, 0x9b, 0x8f, 0xc5, 0x4b, 0xf3, 0x22, 0x60, 0x8c, 0x61,
-  0xb4, 0x80, 0xbb, 0x9f, 0xcf, 0xb6, 0xe1, 0xf2, 0xe6, 0x3c, 0x8f, 0x05,
-  0x5c, 0x7d, 0x7e, 0x1e, 0xba, 0xeb, 0xc8, 0xc9, 0xea, 0x7b, 0x0b, 0xb8,
-  0x07, 0x01, 0x63, 0x0c, 0xe3, 0x06, 0xdc, 0xb6, 0xb9, 0x39, 0x1b, 0xed,
-  0x26, 0xa8, 0x77, 0xeb, 0x34, 0x49, 0x92, 0xc5, 0x9b, 0x8b, 0xda, 0x05,
-  0xfc, 0xb1, 0xed, 0xce, 0x7b, 0xd9, 0x51, 0xb5, 0xba, 0x22, 0x75, 0xf2,
-  0x5f, 0xb8, 0xf9, 0x3e, 0xd4, 0xa2, 0x9c, 0xe0, 0x7c, 0x59, 0x6d, 0x67,
-  0xed, 0x96, 0x9a, 0xee, 0x6a, 0x35, 0x74, 0x91, 0x24, 0xe9, 0xfa, 0x1c,
-  0xac, 0x74, 0xb5, 0xeb, 0x3e, 0x01, 0xd2, 0xdd, 0x47, 0x13, 0xfe, 0x6b,
-  0xca, 0xed, 0x22, 0x49, 0x56, 0xdb, 0xf3, 0x40, 0xc0, 0xff, 0x6d, 0x57,
-  0xdd, 0xbf, 0xec, 0x70, 0xcf, 0x79, 0x76, 0xe0, 0x5b, 0xc6, 0x0e, 0xb8,
-  0x5d, 0xea, 0xd7, 0xe6, 0xf0, 0xb4, 0xd9, 0xba, 0xdc, 0xd6, 0x66, 0xa0,
-  0x09, 0xb8, 0x59, 0x9b, 0x51, 0xdb, 0x26, 0x18, 0x93, 0x05, 0x93, 0xe9,
-  0xb9, 0x2e, 0x3b, 0xcd, 0x91, 0xa3, 0xbf, 0x26, 0x7a, 0xf2, 0xd6, 0x2e,
-  0x35, 0xad, 0xda, 0xf6, 0x6c, 0x8a, 0x7f, 0x73, 0x13, 0x56, 0x2b, 0xb7,
-  0x84, 0xc5, 0x87, 0xb7, 0x04, 0x6f, 0x7d, 0xf6, 0x51, 0xc0, 0x67, 0xef,
-  0xcd, 0x77, 0x51, 0xf5, 0xc0, 0xb3, 0x8c, 0x1e, 0x70, 0x19, 0xa6, 0x55,
-  0x05, 0xd1, 0xa5, 0x65, 0x30, 0xd1, 0xde, 0x0b, 0x69, 0x1b, 0x8c, 0x19,
-  0x0a, 0x78, 0xeb, 0x2f, 0x29, 0x59, 0x66, 0x59, 0x56, 0x84, 0x3b, 0xea,
-  0x7a, 0x72, 0x2f, 0xcf, 0xb4, 0x39, 0x0d, 0xc4, 0x7e, 0x0a, 0x16, 0xe4,
-  0x1d, 0xaf, 0x37, 0xab, 0x24, 0x56, 0x0c, 0xce, 0xb3, 0xa2, 0x60, 0xbc,
-  0xc6, 0xe8, 0x01, 0xb7, 0x33, 0xf5, 0x3a, 0xef, 0x5e, 0xd4, 0x69, 0x14,
-  0x84, 0xda, 0x06, 0x97, 0x49, 0x5f, 0xe1, 0x8f, 0x19, 0x08, 0xb8, 0x08,
-  0x27, 0x5f, 0xf7, 0x8f, 0xb2, 0xf5, 0xe4, 0xfe, 0x5b, 0xae, 0xbd, 0x9f,
-  0x53, 0x5d, 0x5d, 0xd4, 0xaf, 0xdb, 0xdd, 0x1f, 0xe8, 0xd7, 0x04, 0x1c,
-  0xcf, 0x43, 0xc1, 0x78, 0x8d, 0xf1, 0x03, 0xde, 0xa8, 0xd7, 0x8b, 0xee,
-  0x85, 0x0e, 0x68, 0x9e, 0xef, 0xf5, 0xae, 0xf5, 0xa2, 0xfb, 0xcd, 0x1f,
-  0x0a, 0x38, 0xf5, 0xc7, 0xf4, 0x03, 0x3e, 0x27, 0x66, 0x51, 0x85, 0x3e,
-  0x53, 0xd6, 0x7b, 0xce, 0x60, 0x68, 0xa9, 0x3e, 0x75, 0x18, 0xdc, 0xfb,
-  0x4c, 0xb1, 0xdb, 0xe6, 0x62, 0x60, 0x9e, 0x22, 0x98, 0x67, 0xb9, 0xcf,
-  0xe7, 0xea, 0xa7, 0xfd, 0xcb, 0xff, 0xbb, 0xe2, 0x4f, 0x1a, 0x3f, 0xe0,
-  0xc2, 0x1b, 0x70, 0x54, 0x3f, 0xe6, 0xde, 0xf0, 0x2e, 0x3b, 0x9b, 0xda,
-  0xe6, 0xdc, 0x94, 0x1b, 0x3f, 0xa3, 0xab, 0x01, 0xeb, 0x6a, 0xf3, 0xc6,
-  0x0d, 0x8f, 0xb7, 0xc1, 0x76, 0xa9, 0x59, 0xd5, 0xec, 0xcd, 0xcf, 0xb3,
-  0x53, 0x5b, 0xce, 0xfd, 0x18, 0x57, 0x66, 0x78, 0x5d, 0x9f, 0xf5, 0xde,
-  0x42, 0xd2, 0x7d, 0x76, 0x98, 0x4a, 0x67, 0xe7, 0xa6, 0x2d, 0xcd, 0xa1,
-  0xbc, 0x9a, 0x67, 0xeb, 0xd6, 0xbd, 0xd1, 0x63, 0x38, 0x93, 0x85, 0x57,
-  0x98, 0x56, 0xc0, 0xea, 0x00, 0x78, 0xa6, 0xf6, 0x37, 0x55, 0x46, 0xdd,
-  0x96, 0xd9, 0xa4, 0xa6, 0xf6, 0xb3, 0x75, 0xc1, 0xab, 0xf6, 0x56, 0xc0,
-  0xa9, 0xbf, 0x28, 0x75, 0xae, 0x7b, 0x1d, 0xad, 0x89, 0x59, 0xea, 0xc6,
-  0xbd, 0x5b, 0x32, 0xab, 0xdc, 0x0e, 0x70, 0xee, 0x4d, 0xd4, 0x0d, 0x6f,
-  0xab, 0x99, 0xf7, 0x0e, 0x47, 0x7f, 0x8c, 0xe9, 0xb4, 0x1b, 0x53, 0xfb,
-  0x6b, 0x5b, 0xb3, 0x09, 0xc6, 0xeb, 0x8c, 0x1f, 0xb0, 0x39, 0x5c, 0xac,
-  0xe3, 0xdf, 0xf5, 0x93, 0xdb, 0x74, 0xe9, 0x8a, 0x96, 0x6a, 0x84, 0xd9,
-  0x3b, 0x6e, 0x6e, 0x04, 0x5c, 0xfb, 0xc3, 0x4d, 0x6b, 0xf1, 0x25, 0xa0,
-  0xc4, 0x8b, 0x3c, 0xf3, 0x02, 0xf4, 0x17, 0x9a, 0xfb, 0x31, 0x9a, 0x05,
-  0x75, 0x9f, 0x2a, 0xab, 0x60, 0x8c, 0x7f, 0x19, 0x49, 0x4f, 0xa5, 0xaf,
-  0x44, 0x65, 0xee, 0xe3, 0x06, 0x78, 0xb2, 0xf1, 0x03, 0x36, 0xdb, 0xc1,
-  0xd2, 0xfe, 0xe2, 0x9f, 0x82, 0x11, 0xa7, 0xfe, 0xf5, 0xa1, 0x99, 0x9d,
-  0xe3, 0x6a, 0xc0, 0x65, 0x50, 0xd7, 0xd9, 0xcd, 0xe0, 0x09, 0xe6, 0xcd,
-  0xbc, 0x49, 0xfc, 0x11, 0x69, 0x10, 0x63, 0xed, 0x3e, 0x3b, 0x9a, 0x24,
-  0x18, 0xe3, 0x07, 0xbc, 0x0a, 0xfe, 0x89, 0xc5, 0xe0, 0xa7, 0x07, 0xf0,
-  0x0c, 0xd3, 0x09, 0xb8, 0xb2, 0xfb, 0xc6, 0xba, 0xb3, 0xaa, 0x97, 0xa3,
-  0x09, 0x38, 0xeb, 0x8d, 0xb9, 0x16, 0xb0, 0xde, 0x02, 0x17, 0xdf, 0x0e,
-  0xd8, 0x14, 0x1b, 0xad, 0x7d, 0xe9, 0xd6, 0xbb, 0x0d, 0xde, 0xa2, 0x70,
-  0x13, 0xcd, 0xda, 0x5b, 0x6f, 0x0e, 0x3c, 0xc3, 0xf8, 0x01, 0x1f, 0xdd,
-  0x00, 0x1d, 0xd1, 0x5a, 0x53, 0xaf, 0xf6, 0xdf, 0x0a, 0xd8, 0xbc, 0x8d,
-  0x3a, 0x77, 0xb4, 0x1e, 0xdc, 0x08, 0xde, 0x13, 0x70, 0x94, 0x69, 0xeb,
-  0xce, 0x68, 0x9f, 0xc3, 0x31, 0x5e, 0xc0, 0x3a, 0xfa, 0x54, 0xff, 0x33,
-  0x16, 0x04, 0x8c, 0x97, 0x19, 0x3f, 0x60, 0xef, 0x24, 0x96, 0xf7, 0x74,
-  0x83, 0x93, 0x7d, 0x2f, 0x60, 0x7d, 0xec, 0xba, 0xba, 0x14, 0x7c, 0x50,
-  0x3f, 0x2f, 0xa3, 0x35, 0xf9, 0x42, 0xc0, 0x76, 0x56, 0xf7, 0xd6, 0x45,
-  0x38, 0xc6, 0x0b, 0x78, 0xf8, 0xf2, 0x14, 0xdf, 0x96, 0x85, 0x17, 0x18,
-  0x3f, 0x60, 0x5d, 0xda, 0xcc, 0x1d, 0xdb, 0xfe, 0x33, 0xe0, 0xfc, 0x8e,
-  0x80, 0xcd, 0x09, 0xe3, 0x64, 0x65, 0x6f, 0x87, 0x8e, 0x13, 0xba, 0x27,
-  0xe0, 0xa3, 0x3f, 0xcd, 0x50, 0xc0, 0x66, 0xcc, 0x3f, 0x03, 0xe6, 0x31,
-  0x07, 0xbc, 0xc0, 0xf8, 0x01, 0xeb, 0x33, 0x3e, 0x9b, 0x27, 0x6f, 0x81,
-  0xfb, 0x19, 0xe5, 0xf1, 0x9a, 0x7c, 0x61, 0x0b, 0x9c, 0xb6, 0xe1, 0x5b,
-  0x9f, 0xec, 0x49, 0xf2, 0x85, 0x1e, 0xf1, 0xcf, 0x80, 0xd9, 0x85, 0xc6,
-  0x0b, 0x8c, 0x1e, 0xb0, 0x39, 0x4b, 0x74, 0xf4, 0x6e, 0xbe, 0x28, 0x7c,
-  0xe5, 0x37, 0x03, 0x6e, 0xab, 0xa5, 0xdf, 0x4f, 0xbf, 0xdf, 0x6f, 0x1d,
-  0x03, 0xa7, 0x76, 0xb2, 0xeb, 0x27, 0xb1, 0x4c, 0xf4, 0xc1, 0x3f, 0xa3,
-  0xe0, 0x4e, 0x0e, 0xbc, 0xc0, 0xe8, 0x01, 0x9b, 0x43, 0xe0, 0xca, 0xed,
-  0x1a, 0xf7, 0x8f, 0x16, 0xa3, 0x80, 0xbd, 0xd3, 0x42, 0xb7, 0x9e, 0x46,
-  0xda, 0x79, 0xf9, 0xce, 0xcf, 0xbd, 0x85, 0x7e, 0xe9, 0x2c, 0xb4, 0x39,
-  0xff, 0xe5, 0x36, 0xa7, 0xd5, 0xd5, 0x80, 0xdb, 0x68, 0x1e, 0xe0, 0x65,
-  0xc6, 0x0e, 0xd8, 0x64, 0xd0, 0x9d, 0x0b, 0xf2, 0xef, 0x80, 0x0a, 0x44,
-  0x9b, 0x56, 0x3d, 0x4f, 0x7d, 0x3b, 0xe0, 0xae, 0xdf, 0x4d, 0x9e, 0x65,
-  0x59, 0x7e, 0x1c, 0xfc, 0x2e, 0x9d, 0xbb, 0xae, 0x03, 0xcf, 0x83, 0x0f,
-  0x15, 0x7d, 0xea, 0x79, 0xe6, 0xfd, 0x43, 0xf4, 0xa2, 0xfd, 0x80, 0xf5,
-  0xb2, 0x06, 0x3e, 0x33, 0x80, 0xe7, 0x1a, 0x39, 0xe0, 0x77, 0xb3, 0x85,
-  0xec, 0x02, 0xa9, 0xc3, 0x26, 0xda, 0xb6, 0x0e, 0x9f, 0xfa, 0xd5, 0x8f,
-  0x10, 0xea, 0xfb, 0x96, 0xe7, 0x6d, 0xd4, 0x9a, 0x79, 0x3a, 0xc8, 0x3f,
-  0x06, 0xbe, 0xb5, 0x15, 0xbc, 0x2b, 0x60, 0xbd, 0x57, 0xa0, 0x6f, 0xc3,
-  0xd4, 0xaf, 0xba, 0x7b, 0xc5, 0x82, 0xc7, 0x14, 0x82, 0xf7, 0xd6, 0x67,
-  0xbe, 0xdc, 0xcd, 0x57, 0x53, 0xfe, 0x9b, 0x30, 0x10, 0x6d, 0xb4, 0x80,
-  0x3f, 0x3f, 0x3f, 0x3f, 0xde, 0xec, 0xf3, 0x78, 0xfa, 0x62, 0x8c, 0xb9,
-  0xcb, 0x59, 0x1d, 0x2f, 0x36, 0xef, 0x69, 0xf8, 0xd4, 0xaf, 0x7a, 0xc8,
-  0xde, 0x6c, 0x80, 0xf7, 0xfe, 0x8b, 0xc6, 0xdb, 0x65, 0x2e, 0xbc, 0x65,
-  0xdd, 0x4a, 0xe7, 0xae, 0x80, 0xcd, 0x1b, 0x74, 0x4f, 0x01, 0x9b, 0xdb,
-  0x3e, 0xbb, 0xa5, 0xea, 0x6d, 0xee, 0xe5, 0x5b, 0x00, 0xdc, 0x93, 0x85,
-  0xdd, 0x7b, 0x9b, 0x9b, 0xb4, 0xf4, 0x83, 0xfc, 0xf5, 0x8e, 0x6b, 0x48,
-  0x78, 0x91, 0x69, 0x7c, 0x2b, 0xe5, 0x32, 0xdc, 0xd2, 0x26, 0xc9, 0xdb,
-  0xe1, 0xf3, 0x7d, 0x97, 0xda, 0x27, 0xf7, 0xec, 0xf0, 0xf5, 0xfb, 0xc7,
-  0xce, 0x5c, 0x15, 0xaa, 0xfd, 0xc5, 0xad, 0x0e, 0x76, 0xb8, 0x0e, 0x58,
-  0x9f, 0xc2, 0x5a, 0xa9, 0xbb, 0x29, 0x0e, 0xff, 0xf5, 0xd7, 0xe4, 0xae,
-  0x80, 0xed, 0xa9, 0xf1, 0xd5, 0xe1, 0x60, 0x9e, 0x16, 0xee, 0x9e, 0x7e,
-  0x68, 0x1b, 0x7d, 0xa1, 0x2a, 0xdd, 0x1e, 0xb6, 0xd1, 0x7b, 0x9b, 0x67,
-  0x9b, 0x16, 0x87, 0x8f, 0xcf, 0xc3, 0xd6, 0x54, 0x0e, 0x3c, 0xdd, 0x24,
-  0x02, 0x5e, 0xda, 0x1d, 0xdd, 0x7d, 0x6f, 0x5c, 0xf7, 0x9b, 0x7f, 0xfd,
-  0x81, 0x7e, 0xb3, 0x23, 0xdb, 0x1f, 0xb3, 0x89, 0x86, 0xa6, 0xbd, 0x6f,
-  0x9f, 0xbe, 0x2f, 0xe0, 0xba, 0x77, 0x75, 0x5a, 0x3f, 0xe2, 0x64, 0xbf,
-  0xcf, 0xab, 0xff, 0xde, 0xcd, 0x32, 0x1e, 0xce, 0x13, 0xfd, 0x78, 0x89,
-  0x29, 0x04, 0xec, 0xdf, 0xe2, 0xd0, 0xbb, 0x14, 0xdc, 0xed, 0x28, 0x0f,
-  0x04, 0x6c, 0xa2, 0x3f, 0xfb, 0xc3, 0x96, 0xde, 0xf2, 0xce, 0xbd, 0x59,
-  0xe2, 0x88, 0xee, 0x0b, 0xb8, 0x3d, 0x47, 0x05, 0xcf, 0xcc, 0x15, 0xdd,
-  0x20, 0xed, 0xe5, 0xdc, 0xff, 0xb7, 0x54, 0xbd, 0xea, 0xb9, 0x0c, 0x8c,
-  0x57, 0x18, 0x3d, 0xe0, 0xd9, 0x3e, 0xbc, 0x40, 0x1a, 0x6e, 0xd6, 0x96,
-  0xea, 0xf7, 0xde, 0x3c, 0x91, 0xef, 0xb2, 0x70, 0x1b, 0x6d, 0x97, 0xfc,
-  0xbc, 0x2a, 0xfc, 0x88, 0x8e, 0x49, 0x2c, 0x7a, 0xa4, 0xef, 0xce, 0x80,
-  0xa3, 0x1a, 0xe7, 0x6e, 0x6f, 0xb8, 0xf2, 0x86, 0x36, 0x99, 0xff, 0xde,
-  0xf1, 0x36, 0x38, 0xe7, 0x2a, 0x30, 0x5e, 0x62, 0xcc, 0x80, 0x67, 0xbd,
-  0xaf, 0x99, 0xbb, 0x28, 0xbd, 0x22, 0xcd, 0xb9, 0x1f, 0x55, 0xd4, 0xbc,
-  0xad, 0x75, 0x16, 0xb3, 0xc2, 0x6d, 0x4c, 0xed, 0x97, 0x69, 0xe4, 0x4d,
-  0x1b, 0x04, 0xdc, 0xd6, 0x79, 0xbc, 0x1d, 0x0c, 0xcf, 0x25, 0xdd, 0x1b,
-  0x70, 0xdb, 0x14, 0x76, 0x41, 0xf3, 0xc2, 0xdf, 0x8c, 0xdb, 0x7b, 0x45,
-  0xf6, 0x8d, 0xde, 0x65, 0x77, 0x7b, 0x13, 0x27, 0xb7, 0x73, 0x9f, 0xb1,
-  0xf9, 0xc5, 0x8b, 0x4c, 0xf1, 0xef, 0x03, 0x37, 0xe7, 0x62, 0x9f, 0xed,
-  0x8f, 0xe5, 0xd0, 0x61, 0x63, 0x55, 0xe4, 0x9b, 0xe2, 0x14, 0x8e, 0xa9,
-  0x8e, 0xfb, 0xac, 0x38, 0x0e, 0x1f, 0x64, 0xd6, 0xe5, 0x85, 0x09, 0x30,
-  0x1b, 0x9c, 0xe6, 0x1e, 0x55, 0x51, 0x6c, 0x36, 0x45, 0xd1, 0x3b, 0x17,
-  0x55, 0x15, 0x97, 0xf7, 0x1e, 0xde, 0xbe, 0xd6, 0xc7, 0x22, 0xcf, 0x8a,
-  0x13, 0xf5, 0xe2, 0x75, 0xa6, 0x18, 0xf0, 0x0b, 0xe8, 0x03, 0xe2, 0xf4,
-  0x8e, 0x49, 0x01, 0x41, 0x7e, 0x69, 0xc0, 0xa5, 0xba, 0x78, 0xe4, 0x06,
-  0xe8, 0x9d, 0xd9, 0x31, 0xd7, 0x09, 0x78, 0xbe, 0x5f, 0xfa, 0x2b, 0xad,
-  0x8f, 0x62, 0xed, 0xae, 0xed, 0xf9, 0xd1, 0x5d, 0x68, 0x60, 0x92, 0x7e,
-  0x69, 0xc0, 0xfa, 0xa6, 0xcc, 0xd5, 0x7f, 0xea, 0x0b, 0x60, 0x3f, 0xf4,
-  0x8d, 0x16, 0x3c, 0x93, 0x8b, 0x5f, 0xe6, 0x97, 0x06, 0x3c, 0xfc, 0x68,
-  0xf1, 0x8c, 0x8b, 0x39, 0xf8, 0x65, 0x7e, 0x6b, 0xc0, 0xfd, 0x3b, 0x29,
-  0x78, 0x3c, 0x08, 0xbf, 0xd0, 0x6f, 0x0d, 0xb8, 0xff, 0x17, 0x8d, 0xfc,
-  0x3b, 0x30, 0x80, 0x5f, 0xe2, 0xd7, 0x06, 0xdc, 0xd6, 0xd1, 0x3d, 0x5d,
-  0x3c, 0x10, 0x84, 0x5f, 0xe8, 0xf7, 0x06, 0x7c, 0x39, 0x17, 0x7d, 0x2c,
-  0xb2, 0x8b, 0x4d, 0x71, 0xe6, 0xe8, 0x17, 0xbf, 0xd2, 0xaf, 0x0e, 0x18,
-  0xf8, 0xed, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x7e, 0x3e, 0xe0, 0x43, 0xcf, 0x8f, 0xaf, 0x02, 0xf0, 0x5b,
-  0xfc, 0x7c, 0xc0, 0x49, 0x6c, 0xfe, 0xcd, 0x05, 0x55, 0x4f, 0x5e, 0xb1,
-  0x1f, 0x21, 0x72, 0xa5, 0x31, 0x5d, 0x13, 0x08, 0x38, 0xfb, 0xf2, 0x22,
-  0x0e, 0x87, 0xf5, 0x3a, 0x4d, 0x84, 0xed, 0xfd, 0x8b, 0x5c, 0x69, 0x4c,
-  0xdd, 0x04, 0x02, 0xde, 0x7f, 0x77, 0x11, 0x2f, 0x59, 0xbd, 0x97, 0x11,
-  0xb9, 0xd2, 0x98, 0xba, 0x09, 0x04, 0x5c, 0x7c, 0x77, 0x11, 0x2f, 0x59,
-  0xbd, 0x97, 0x11, 0xb9, 0xd2, 0x98, 0xba, 0xd1, 0x02, 0xce, 0xac, 0xaf,
-  0x1f, 0x16, 0x8a, 0x6c, 0x41, 0xe4, 0x4a, 0x63, 0xea, 0x46, 0x0b, 0x78,
-  0xe4, 0x45, 0xfc, 0x3c, 0x91, 0x2b, 0x8d, 0xa9, 0x9b, 0x4c, 0xc0, 0xf5,
-  0xc7, 0x6e, 0xdd, 0x8d, 0x48, 0xd7, 0x6f, 0x75, 0x38, 0xaa, 0xf9, 0x58,
-  0x2f, 0x2e, 0x63, 0xb6, 0xef, 0x4d, 0xdb, 0xd6, 0x87, 0xc3, 0x41, 0x2f,
-  0xa2, 0xbb, 0x06, 0x65, 0xa7, 0x6d, 0xde, 0xd5, 0x54, 0xeb, 0x77, 0x6f,
-  0x76, 0x75, 0x9d, 0xaa, 0xb9, 0xfc, 0xb4, 0x4e, 0x92, 0xd5, 0xc1, 0xbd,
-  0xee, 0xde, 0x73, 0xe8, 0x3a, 0x96, 0x1d, 0xd4, 0xbc, 0xad, 0x93, 0x24,
-  0xb7, 0x93, 0x5e, 0xce, 0x40, 0x25, 0x8b, 0xdd, 0x7f, 0xe1, 0x9a, 0xed,
-  0xd2, 0x6e, 0x9d, 0xb7, 0xef, 0xc1, 0x3a, 0x97, 0xdb, 0xd5, 0x65, 0xf0,
-  0xca, 0xac, 0xdd, 0xd5, 0x95, 0x06, 0x1e, 0x33, 0x91, 0x80, 0x4f, 0xab,
-  0xe0, 0xb0, 0x78, 0xd7, 0x78, 0xe3, 0x0e, 0xa9, 0x1d, 0x9e, 0xbe, 0x35,
-  0x65, 0x74, 0x04, 0xad, 0x77, 0xc0, 0x9b, 0xdd, 0xe0, 0xec, 0xea, 0x75,
-  0xd9, 0x36, 0xdd, 0xf2, 0x97, 0x89, 0x79, 0xad, 0x1c, 0xd5, 0xcb, 0xcd,
-  0xc0, 0xfa, 0x35, 0x6d, 0xd5, 0xbd, 0x6d, 0xd6, 0x5b, 0xfa, 0xaa, 0xb4,
-  0x93, 0x9e, 0x17, 0x83, 0x6f, 0x5a, 0xad, 0xe2, 0xa1, 0x57, 0x56, 0x1a,
-  0x78, 0xd4, 0x44, 0x02, 0x3e, 0x46, 0xbf, 0xe1, 0x6b, 0x3b, 0xa6, 0x59,
-  0x07, 0x23, 0x16, 0xa7, 0x68, 0x4a, 0x35, 0x55, 0x1d, 0x7e, 0x00, 0xa4,
-  0x55, 0xf0, 0x66, 0x67, 0xd5, 0x6f, 0x92, 0x6f, 0xd4, 0x6b, 0x73, 0xda,
-  0x4c, 0xbf, 0x3c, 0x0d, 0xac, 0x5f, 0xa9, 0xfa, 0x55, 0x93, 0x36, 0xe1,
-  0xd2, 0xcd, 0xf4, 0xd1, 0xaa, 0xa4, 0xe5, 0xd0, 0xe0, 0x55, 0x33, 0x10,
-  0xf0, 0x4b, 0xfe, 0xc3, 0xe2, 0x2f, 0x9a, 0x48, 0xc0, 0x75, 0xf4, 0x1b,
-  0x9e, 0x1c, 0xf5, 0x88, 0xa8, 0x9d, 0x64, 0x19, 0xb5, 0xa0, 0xee, 0x02,
-  0xa9, 0xd3, 0x70, 0xa8, 0x2d, 0x58, 0x07, 0x5b, 0xe8, 0xff, 0xd7, 0x9f,
-  0x13, 0xe6, 0xca, 0xb3, 0x9e, 0xab, 0x09, 0x56, 0x45, 0x07, 0xbc, 0x76,
-  0xb1, 0xc6, 0xeb, 0x90, 0x9c, 0xbb, 0x09, 0xcf, 0xd1, 0xd0, 0x99, 0xda,
-  0x31, 0x8e, 0x3f, 0x61, 0x2e, 0x05, 0x0f, 0xae, 0x34, 0xf0, 0xb8, 0x89,
-  0x04, 0xdc, 0x2e, 0xa3, 0x5f, 0xfb, 0x54, 0x1f, 0x26, 0xee, 0xa3, 0x48,
-  0xaa, 0xa8, 0x05, 0xd5, 0x62, 0xb8, 0x95, 0x36, 0xd9, 0xd8, 0x37, 0xcb,
-  0x75, 0xa9, 0xa5, 0xfe, 0x9c, 0x48, 0xd5, 0xb2, 0xf5, 0xab, 0xe5, 0xd0,
-  0xfa, 0xe9, 0x8d, 0x73, 0xb7, 0xb7, 0xad, 0xd7, 0x61, 0xb6, 0x29, 0x32,
-  0x7f, 0xe5, 0xfc, 0xfd, 0xe7, 0xc4, 0x6e, 0xd7, 0xcd, 0x67, 0xc9, 0x72,
-  0x9f, 0xcf, 0xd5, 0x4f, 0xfb, 0x5e, 0xc0, 0x5f, 0xbf, 0x75, 0x05, 0x18,
-  0x36, 0x95, 0x80, 0x8f, 0xb3, 0xcd, 0xf1, 0x12, 0x4b, 0x53, 0x78, 0xe5,
-  0xb8, 0xdf, 0xfc, 0x79, 0x51, 0x96, 0x97, 0x7c, 0x8e, 0x6d, 0x5d, 0x98,
-  0xed, 0x69, 0x52, 0x14, 0x45, 0xd1, 0x6d, 0x0c, 0xcd, 0x0e, 0x78, 0x5e,
-  0xb6, 0xa5, 0x29, 0xef, 0xe8, 0xbf, 0x99, 0x56, 0x9b, 0xcf, 0x09, 0xb5,
-  0x7d, 0x3e, 0xf9, 0x53, 0xc6, 0xeb, 0xe7, 0x56, 0xb3, 0xd2, 0x45, 0x36,
-  0x6e, 0x96, 0xdc, 0xad, 0xda, 0xac, 0x6c, 0xdb, 0xa6, 0x2c, 0x66, 0xe6,
-  0x73, 0x60, 0xab, 0x06, 0x77, 0x5b, 0xee, 0xa5, 0x79, 0xdb, 0xa1, 0x95,
-  0x06, 0x9e, 0x60, 0xb4, 0x80, 0x3f, 0x0d, 0x35, 0xd4, 0xed, 0xc6, 0x16,
-  0x7e, 0x56, 0x2b, 0x2f, 0x9e, 0xb6, 0x3d, 0xe5, 0xc1, 0x22, 0xec, 0x2c,
-  0x0b, 0x97, 0x55, 0xdb, 0xe6, 0xea, 0xc5, 0xc2, 0x9f, 0xf2, 0x12, 0x5a,
-  0x96, 0xcd, 0xec, 0xc2, 0x4f, 0xfe, 0x94, 0xd1, 0x29, 0xe1, 0x60, 0x96,
-  0x65, 0x3c, 0x99, 0x7a, 0x91, 0x36, 0xf6, 0x53, 0x43, 0x1f, 0x4f, 0x37,
-  0x27, 0xf5, 0x89, 0xa3, 0xb7, 0xea, 0x1b, 0xff, 0xc5, 0x7e, 0x70, 0xa5,
-  0x81, 0x27, 0x18, 0xff, 0x4e, 0xac, 0x78, 0x7c, 0xe9, 0xfd, 0xd6, 0x9b,
-  0x43, 0xe3, 0x6a, 0x70, 0x11, 0xe6, 0xa5, 0xde, 0x44, 0xea, 0x63, 0x59,
-  0x33, 0x4f, 0x19, 0xbc, 0xd9, 0x31, 0x98, 0x54, 0x25, 0xa5, 0xba, 0x8f,
-  0xf6, 0xa0, 0xed, 0x2c, 0x33, 0xb3, 0x9d, 0x4c, 0xfd, 0xc9, 0xf4, 0xda,
-  0x9d, 0x6d, 0xc0, 0xeb, 0x70, 0xee, 0xa3, 0x1d, 0x7f, 0xa1, 0x76, 0xb9,
-  0x57, 0x43, 0x2b, 0x0d, 0x3c, 0xc3, 0xf4, 0x02, 0xd6, 0x01, 0x76, 0xc7,
-  0x89, 0xfa, 0xe8, 0xf3, 0x4a, 0x63, 0xe6, 0xe5, 0xde, 0xdf, 0xea, 0xd9,
-  0xc3, 0xe9, 0xc2, 0x7f, 0x33, 0x7b, 0xbb, 0xe6, 0xdc, 0x25, 0x55, 0x47,
-  0xa3, 0xa2, 0xf5, 0x33, 0x57, 0x8b, 0xce, 0xe1, 0x64, 0xf6, 0x13, 0xc0,
-  0xec, 0xdd, 0xaf, 0x83, 0x2b, 0xc3, 0x99, 0xff, 0x59, 0x62, 0x36, 0xf8,
-  0xcd, 0xc0, 0x4a, 0x03, 0xcf, 0x30, 0xad, 0x80, 0x3f, 0x3f, 0xdf, 0xcd,
-  0x1d, 0x0f, 0x5d, 0xc0, 0xd9, 0xcd, 0xc6, 0xcc, 0xcb, 0x68, 0xaa, 0xc2,
-  0xeb, 0xd9, 0x6c, 0x4d, 0xed, 0x1e, 0x7a, 0xee, 0x66, 0xd5, 0xc7, 0xb3,
-  0xf1, 0x35, 0xd9, 0xc4, 0x7b, 0x7f, 0x6f, 0x71, 0xc7, 0x60, 0x74, 0xd6,
-  0xb6, 0xcd, 0xcc, 0xfc, 0x0b, 0x52, 0xef, 0xee, 0x0e, 0xfd, 0x7e, 0xe1,
-  0xbc, 0xfe, 0xce, 0xc0, 0xf7, 0xff, 0xc3, 0x01, 0x7d, 0xd3, 0x09, 0xf8,
-  0x23, 0x3c, 0x95, 0xdc, 0x05, 0xb4, 0xf8, 0x4a, 0xc0, 0x66, 0x97, 0xb7,
-  0xf0, 0x16, 0x90, 0xd8, 0x0d, 0xa6, 0x76, 0x76, 0x49, 0xa9, 0x96, 0x7b,
-  0x97, 0x74, 0xf4, 0x2c, 0xf6, 0xe2, 0xb0, 0x4e, 0x7e, 0xb5, 0x56, 0xdc,
-  0xc2, 0xfd, 0x6b, 0xd7, 0x0b, 0x73, 0xf7, 0x98, 0x4e, 0x5a, 0x4f, 0xbc,
-  0x20, 0x60, 0xbc, 0xd6, 0x54, 0x02, 0x3e, 0xc5, 0x17, 0x65, 0xfc, 0xfe,
-  0x4e, 0xc3, 0x8b, 0x88, 0x5e, 0x9a, 0x7d, 0xde, 0x53, 0x7f, 0x01, 0x65,
-  0x3c, 0xef, 0xd1, 0x9e, 0x20, 0xeb, 0x3d, 0xcc, 0xa8, 0x67, 0xb1, 0xdb,
-  0xec, 0x2c, 0x5e, 0xe1, 0xc4, 0x9c, 0x22, 0x0b, 0xc6, 0xa4, 0xef, 0xed,
-  0xd0, 0xf5, 0x6c, 0xb7, 0xfe, 0x04, 0x8c, 0x17, 0x98, 0xc8, 0x65, 0xa4,
-  0xf8, 0xee, 0x87, 0xab, 0xfd, 0x0d, 0x2d, 0x22, 0x9a, 0x4a, 0x1f, 0x9c,
-  0xce, 0x87, 0xdf, 0x4c, 0x5d, 0x66, 0xda, 0xb4, 0x6d, 0xa3, 0x46, 0xf5,
-  0xee, 0x6a, 0x54, 0x83, 0xdd, 0x61, 0xf7, 0x60, 0xc0, 0x6a, 0x89, 0xe1,
-  0xfd, 0x63, 0xdb, 0x81, 0x5b, 0xae, 0x94, 0x62, 0x78, 0x55, 0x80, 0x87,
-  0x4d, 0x23, 0x60, 0x77, 0xb9, 0xd7, 0x5e, 0x30, 0xfd, 0xfe, 0x16, 0xf8,
-  0xd8, 0x5f, 0x80, 0x37, 0xaf, 0xfa, 0xa8, 0x58, 0x98, 0x9d, 0xe9, 0x59,
-  0x1b, 0xf3, 0xe6, 0xee, 0x0c, 0x06, 0xac, 0x47, 0xd7, 0xfb, 0x99, 0x37,
-  0xf0, 0x78, 0x6d, 0x0b, 0xcc, 0x2e, 0x34, 0x5e, 0x65, 0x1a, 0x01, 0xaf,
-  0xfc, 0x50, 0xbd, 0x44, 0xe6, 0xde, 0x16, 0xec, 0xfa, 0x22, 0x96, 0x61,
-  0xe6, 0x03, 0x9f, 0x00, 0xde, 0xbc, 0x7a, 0xc3, 0xdb, 0xe8, 0x73, 0xd7,
-  0x79, 0x1b, 0xbb, 0x12, 0xf0, 0xa6, 0xf0, 0xb9, 0x8f, 0x94, 0x73, 0xee,
-  0x4e, 0x66, 0x35, 0xf6, 0x18, 0x38, 0x98, 0xb8, 0xa8, 0xaf, 0xfd, 0xbb,
-  0x81, 0x07, 0x4d, 0x23, 0x60, 0x35, 0x68, 0xe9, 0xbf, 0xf0, 0xcf, 0x42,
-  0xc7, 0xc7, 0xa9, 0xd1, 0x22, 0xa2, 0x47, 0x14, 0xf6, 0xde, 0xcb, 0x81,
-  0x37, 0x53, 0xb9, 0x9f, 0xf5, 0x87, 0x46, 0xff, 0xa6, 0xa8, 0x38, 0xe0,
-  0x62, 0x78, 0x1d, 0x3c, 0xa7, 0xb9, 0xdb, 0xd2, 0xce, 0xcc, 0xe7, 0xc3,
-  0x5d, 0xff, 0x6e, 0xe0, 0x41, 0x93, 0x08, 0xb8, 0x0c, 0x0a, 0xf4, 0x0a,
-  0xd2, 0x2d, 0x2e, 0x6e, 0x2f, 0x42, 0x27, 0xb6, 0xd2, 0x2f, 0xf5, 0xe9,
-  0xb0, 0xf3, 0x95, 0x37, 0x53, 0x7b, 0xd8, 0x85, 0xda, 0x12, 0xf7, 0xf7,
-  0xa0, 0x7b, 0x01, 0x97, 0xf1, 0x80, 0xbe, 0x46, 0x17, 0x7c, 0xb4, 0x1f,
-  0x26, 0x03, 0x37, 0x4b, 0x12, 0x30, 0x5e, 0x60, 0x12, 0x01, 0x9f, 0xfd,
-  0x8d, 0x5c, 0xe5, 0x05, 0x63, 0x0e, 0x29, 0xcd, 0x1e, 0xab, 0xbe, 0x56,
-  0x63, 0xef, 0x31, 0x6e, 0xfd, 0x39, 0xf4, 0x6b, 0xbd, 0xb0, 0xd9, 0xb5,
-  0x37, 0x53, 0x53, 0x67, 0x6a, 0xb2, 0xfe, 0x1e, 0x74, 0x2f, 0x60, 0xbd,
-  0xcf, 0xed, 0x9a, 0x6c, 0xcc, 0xfb, 0x9e, 0xe3, 0x33, 0xd5, 0x47, 0x7b,
-  0x00, 0xbe, 0xb2, 0xb3, 0xdb, 0x93, 0x64, 0xd1, 0x4a, 0x03, 0xcf, 0x30,
-  0x89, 0x80, 0xf5, 0x46, 0x6e, 0xd1, 0x78, 0x4f, 0xf3, 0xa8, 0xad, 0xae,
-  0x79, 0x48, 0xe9, 0xf2, 0x5d, 0x1c, 0xed, 0xc7, 0x6a, 0xa1, 0x92, 0xd1,
-  0xbd, 0xec, 0xda, 0xb6, 0xf9, 0xcf, 0x7b, 0xdd, 0x3d, 0x81, 0xa4, 0x9f,
-  0xe3, 0xd5, 0x69, 0x0e, 0x6d, 0xf6, 0xd4, 0xe6, 0x72, 0x7f, 0x7b, 0x4b,
-  0xe9, 0x6d, 0x70, 0xf5, 0x85, 0x60, 0xf3, 0xb8, 0xef, 0xc7, 0x42, 0x3f,
-  0xe9, 0x54, 0xa5, 0xa9, 0xfe, 0x6e, 0x8f, 0xc6, 0x3c, 0xed, 0xe4, 0x6e,
-  0xef, 0xd0, 0x8f, 0xf7, 0xd7, 0x3b, 0xfb, 0xe1, 0x13, 0xaf, 0x34, 0xf0,
-  0x04, 0x93, 0x08, 0xd8, 0x0c, 0x5b, 0xfd, 0xf7, 0xdf, 0x9b, 0xbd, 0x1e,
-  0xdc, 0x5d, 0x57, 0x75, 0x97, 0x65, 0x16, 0xdd, 0x2d, 0x14, 0xdb, 0x6e,
-  0x72, 0xf3, 0x8c, 0x61, 0xba, 0x52, 0x67, 0x78, 0xcd, 0x93, 0xb9, 0x8b,
-  0xdd, 0x61, 0xa7, 0x5b, 0xd2, 0x0f, 0xe7, 0x0e, 0xbd, 0x99, 0x9a, 0x5b,
-  0x4d, 0x77, 0xf5, 0x58, 0xd5, 0x0b, 0xd8, 0x9e, 0x59, 0xde, 0x1d, 0x3e,
-  0x3f, 0xba, 0xf5, 0xdb, 0xb5, 0xe6, 0x93, 0x66, 0xb1, 0x3b, 0x7c, 0x7e,
-  0xbe, 0xeb, 0x75, 0xee, 0xee, 0xf7, 0x32, 0x4f, 0x1d, 0x2d, 0x0e, 0xef,
-  0x9f, 0x87, 0xad, 0xf7, 0x68, 0x72, 0xbc, 0xd2, 0xc0, 0x13, 0x4c, 0x23,
-  0xe0, 0xf8, 0x69, 0xe0, 0x4e, 0xf7, 0x8b, 0x1f, 0x3d, 0x0f, 0xac, 0x36,
-  0x99, 0xfe, 0xd5, 0xd6, 0xee, 0x61, 0x82, 0xbc, 0x37, 0xf3, 0xf1, 0xfa,
-  0x9b, 0x79, 0x0f, 0xe2, 0x87, 0x5f, 0xa6, 0xe3, 0xcf, 0xe2, 0x1f, 0xf2,
-  0xc6, 0x5f, 0x17, 0xd2, 0xed, 0xd2, 0xf7, 0x9e, 0xf2, 0x37, 0xdf, 0xde,
-  0xd1, 0xfb, 0xb7, 0xe8, 0x0d, 0x76, 0x6f, 0xa5, 0x81, 0xc7, 0x4d, 0x23,
-  0xe0, 0xca, 0xff, 0x85, 0x5f, 0xaa, 0x13, 0x41, 0xfa, 0x1e, 0xc7, 0x4d,
-  0x12, 0x50, 0xcf, 0xd2, 0xfb, 0x03, 0xcb, 0xa1, 0x6a, 0xf2, 0x1b, 0x6f,
-  0xd6, 0xba, 0x6b, 0xb7, 0xf1, 0x05, 0xe6, 0x76, 0x30, 0xe0, 0xfe, 0xe7,
-  0x43, 0xd6, 0xb6, 0xe7, 0x59, 0x3c, 0x50, 0x3f, 0xf3, 0x58, 0xf5, 0x46,
-  0x94, 0xfd, 0x7f, 0x09, 0x9b, 0x60, 0x3c, 0xc7, 0x34, 0x02, 0xf6, 0x37,
-  0x72, 0xb3, 0x4a, 0x1d, 0x47, 0x9a, 0xeb, 0x36, 0x85, 0xdf, 0xc2, 0xac,
-  0xe8, 0x2a, 0xa9, 0xbd, 0x48, 0xba, 0xad, 0x59, 0x13, 0x76, 0x7e, 0xba,
-  0xf9, 0x66, 0xae, 0xc7, 0x81, 0x3d, 0xe8, 0xa1, 0x80, 0xc3, 0x75, 0x48,
-  0xe6, 0xdd, 0xe2, 0xab, 0xe8, 0x43, 0xc3, 0x9e, 0x0f, 0x8b, 0x3e, 0x4d,
-  0x72, 0x73, 0xda, 0xaa, 0xb7, 0xd2, 0xc0, 0xc3, 0x26, 0x12, 0x70, 0x5b,
-  0x9a, 0x6b, 0xa9, 0x9b, 0xa6, 0x6d, 0x9b, 0xcc, 0xbf, 0xc7, 0xb1, 0x74,
-  0xc1, 0xed, 0x4d, 0x71, 0x2e, 0xd8, 0x8d, 0x9e, 0xae, 0xb4, 0x77, 0x4c,
-  0xcd, 0xf2, 0xfa, 0xf6, 0x9b, 0xd9, 0xfb, 0x36, 0x07, 0x2f, 0x0d, 0x0d,
-  0x8e, 0xaa, 0xdd, 0x3a, 0xe8, 0xcf, 0x90, 0xcb, 0x5b, 0x7a, 0x9f, 0x1a,
-  0x1b, 0x7f, 0x9b, 0x6a, 0x2f, 0x0c, 0x27, 0x49, 0xe6, 0x0d, 0xef, 0xaf,
-  0x34, 0xf0, 0xa0, 0xe9, 0x5c, 0x97, 0x2c, 0x8f, 0xfb, 0xac, 0x38, 0x9a,
-  0x2f, 0x52, 0x3e, 0xf9, 0x77, 0x5f, 0x35, 0xe7, 0x62, 0x9f, 0x15, 0xa7,
-  0x60, 0xbf, 0xb3, 0x3a, 0x17, 0x9b, 0xac, 0x38, 0x79, 0x57, 0x65, 0xea,
-  0x53, 0x91, 0x67, 0x45, 0x71, 0x1e, 0xda, 0xac, 0x46, 0xf4, 0xa9, 0xee,
-  0xa1, 0x3d, 0xe8, 0xab, 0xce, 0x45, 0x91, 0xe5, 0x45, 0x19, 0x5e, 0x06,
-  0x2a, 0x8b, 0xcb, 0x5a, 0xf4, 0xdf, 0xb3, 0x3e, 0x5e, 0xd6, 0xe5, 0x14,
-  0xef, 0x29, 0xf7, 0x57, 0x1a, 0x78, 0xc8, 0x74, 0x02, 0xfe, 0x49, 0xea,
-  0x8b, 0xab, 0xf8, 0x72, 0x48, 0x88, 0xf7, 0x27, 0x03, 0x1e, 0xfe, 0x36,
-  0x3b, 0x40, 0x9e, 0x3f, 0x18, 0x70, 0xad, 0xff, 0xcc, 0xc2, 0xec, 0x8e,
-  0x7d, 0x6d, 0x60, 0xda, 0xfe, 0x58, 0xc0, 0xcd, 0xe7, 0xc1, 0x7e, 0xf1,
-  0xc7, 0x97, 0x8e, 0x80, 0x81, 0x49, 0xfa, 0x63, 0x01, 0x7b, 0x77, 0x53,
-  0xd0, 0x2f, 0x7e, 0x81, 0x3f, 0x16, 0x70, 0x43, 0xbf, 0xf8, 0x55, 0xfe,
-  0x58, 0xc0, 0xf6, 0x3b, 0x27, 0xb9, 0x15, 0x0a, 0xbf, 0xc2, 0x5f, 0x0b,
-  0xb8, 0xbb, 0xdd, 0x63, 0x49, 0xbe, 0xf8, 0x25, 0xfe, 0x5a, 0xc0, 0xfb,
-  0xfc, 0x58, 0x72, 0xf6, 0x19, 0xbf, 0xc6, 0x5f, 0x0b, 0x18, 0xf8, 0x55,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18,
-  0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1,
-  0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80,
-  0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10,
-  0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08,
-  0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01,
-  0xc1, 0x08, 0x18, 0x10, 0x8c, 0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x8c,
-  0x80, 0x01, 0xc1, 0x08, 0x18, 0x10, 0x6c, 0xea, 0x01, 0x37, 0x87, 0xed,
-  0xdb, 0xc7, 0xd8, 0x2b, 0x01, 0x4c, 0xd5, 0xc4, 0x03, 0xae, 0xd2, 0x24,
-  0x49, 0x92, 0xf5, 0xd8, 0xab, 0x01, 0x4c, 0xd4, 0xc4, 0x03, 0x5e, 0x25,
-  0x9d, 0xfd, 0xd8, 0xeb, 0x01, 0x4c, 0xd3, 0xb4, 0x03, 0xae, 0x54, 0xbf,
-  0xc9, 0x6a, 0xec, 0x15, 0x01, 0xa6, 0x69, 0xda, 0x01, 0x97, 0x3a, 0xe0,
-  0x69, 0xaf, 0x25, 0x30, 0x9a, 0x9f, 0x4f, 0xe3, 0xd0, 0x53, 0x5e, 0x9d,
-  0xb6, 0xd1, 0xfd, 0x66, 0x3f, 0xba, 0x86, 0x80, 0x18, 0x3f, 0x1f, 0x70,
-  0xd2, 0x53, 0x5c, 0x9f, 0xb8, 0x50, 0x53, 0xf8, 0x89, 0x37, 0xf5, 0x0f,
-  0xac, 0x24, 0x20, 0xc3, 0x14, 0x02, 0xbe, 0xbe, 0x05, 0x56, 0x05, 0xcf,
-  0xf5, 0x04, 0xe5, 0x61, 0xb7, 0x5e, 0xdc, 0xec, 0x1d, 0xf8, 0x63, 0xa6,
-  0x10, 0xf0, 0xed, 0x4d, 0x6a, 0xd5, 0x98, 0x9f, 0x8a, 0x7f, 0x6e, 0xb0,
-  0x81, 0x3f, 0x66, 0x0a, 0x01, 0xdf, 0x3b, 0x27, 0x01, 0x03, 0x91, 0xd1,
-  0x02, 0xce, 0xac, 0xfc, 0xde, 0x39, 0x09, 0x18, 0x88, 0x8c, 0x16, 0xf0,
-  0x37, 0xe6, 0x24, 0x60, 0x20, 0x32, 0x8d, 0x80, 0x4b, 0x7d, 0x41, 0xa9,
-  0xf6, 0x5f, 0x1d, 0xdd, 0x8f, 0x65, 0xdb, 0x9e, 0x0e, 0x87, 0xb5, 0x9a,
-  0x73, 0x7d, 0x19, 0x72, 0x0a, 0x17, 0x7a, 0x32, 0xb3, 0xd7, 0x6f, 0x8b,
-  0xcb, 0x8d, 0x1f, 0xea, 0xf6, 0xe9, 0xff, 0xb6, 0x97, 0x9f, 0xdf, 0x1a,
-  0x7f, 0xca, 0xfa, 0x6d, 0x7d, 0xb9, 0x3d, 0x73, 0xb1, 0x73, 0xa7, 0xce,
-  0xea, 0x83, 0x59, 0x62, 0xf5, 0x96, 0x26, 0x49, 0xba, 0x3e, 0x9b, 0x31,
-  0x87, 0x83, 0x7b, 0xaf, 0xda, 0x7f, 0x01, 0x4c, 0xc3, 0x34, 0x02, 0xae,
-  0x67, 0x6a, 0xa0, 0xda, 0x9b, 0x5e, 0xbb, 0x2d, 0xad, 0xdb, 0xe8, 0x66,
-  0xe1, 0x71, 0xf3, 0x26, 0x5c, 0x68, 0xa6, 0x27, 0x3b, 0xa5, 0x7a, 0xfc,
-  0xae, 0x6d, 0x9b, 0xad, 0xfe, 0x79, 0x51, 0xd9, 0xe9, 0x9a, 0x9d, 0x5b,
-  0xc4, 0xda, 0x0c, 0x56, 0xb7, 0x8b, 0xa4, 0x6d, 0xf3, 0x66, 0x46, 0x6d,
-  0x1b, 0x7f, 0x5d, 0x33, 0x6f, 0x2a, 0x2e, 0x49, 0x63, 0x52, 0xa6, 0x11,
-  0x70, 0x7b, 0x54, 0x03, 0xd3, 0xc6, 0xdd, 0x3f, 0x39, 0xbf, 0x0c, 0xbf,
-  0x1a, 0x70, 0xb4, 0x1f, 0xad, 0xc6, 0xe6, 0x27, 0x6f, 0x82, 0x66, 0x65,
-  0x7f, 0x5e, 0x98, 0x6d, 0x70, 0xb5, 0xf2, 0x97, 0x91, 0x9a, 0xcb, 0x53,
-  0xea, 0xa5, 0x37, 0x83, 0x59, 0x3c, 0x01, 0x63, 0xe2, 0x26, 0x12, 0x70,
-  0xbb, 0x74, 0xe1, 0xe4, 0xea, 0xc7, 0xae, 0xae, 0xab, 0x01, 0x9f, 0xc3,
-  0xd9, 0xd5, 0xd8, 0xd4, 0x9b, 0x20, 0xf5, 0x5b, 0xd5, 0x3d, 0xd6, 0x69,
-  0xb8, 0x90, 0x44, 0x6d, 0x83, 0x75, 0x9a, 0xc1, 0xc8, 0xda, 0x5b, 0x57,
-  0x02, 0xc6, 0x64, 0x4d, 0x25, 0x60, 0x9d, 0xc7, 0xa2, 0x6d, 0x9b, 0xd4,
-  0x0b, 0xe5, 0x6a, 0xc0, 0x55, 0x38, 0x7b, 0x34, 0x36, 0xa6, 0x1f, 0x86,
-  0xd0, 0xfb, 0xd4, 0xf3, 0x7c, 0xaf, 0x3f, 0x2f, 0xd4, 0xa6, 0xb9, 0x1c,
-  0x98, 0xa3, 0xf0, 0xd6, 0x95, 0x80, 0x31, 0x59, 0x53, 0x09, 0xb8, 0xdd,
-  0xab, 0xc1, 0x27, 0xb3, 0x37, 0xad, 0x36, 0x81, 0x2e, 0xe0, 0x53, 0x51,
-  0xe8, 0x4a, 0xb3, 0xe2, 0x7f, 0xa2, 0xb9, 0x4d, 0xc0, 0xb3, 0x53, 0x5b,
-  0xce, 0x4c, 0x84, 0x79, 0xdd, 0xe4, 0xfe, 0xbb, 0x9d, 0xd5, 0xcf, 0x9b,
-  0x4b, 0xb5, 0x27, 0xaf, 0x53, 0x1b, 0xf0, 0xfc, 0xd8, 0xd4, 0x3a, 0xed,
-  0xbd, 0xb7, 0xae, 0x04, 0x8c, 0xc9, 0x1a, 0xff, 0x46, 0x0e, 0xdd, 0x62,
-  0x33, 0xd3, 0xdb, 0xca, 0x85, 0x3f, 0x34, 0xb8, 0x72, 0x74, 0xe3, 0x32,
-  0x92, 0x09, 0xb8, 0x72, 0x1f, 0x05, 0xdd, 0x19, 0x31, 0xf3, 0x34, 0x44,
-  0xf7, 0x71, 0xb0, 0xf2, 0x3f, 0x1a, 0xd4, 0x1c, 0x8b, 0xd6, 0x0b, 0x78,
-  0xe9, 0x95, 0x9d, 0x79, 0xeb, 0x4a, 0xc0, 0x98, 0xac, 0xc9, 0x04, 0x6c,
-  0xb7, 0x89, 0x6a, 0x5b, 0xa8, 0x4f, 0x3b, 0x7d, 0x31, 0xe0, 0x6e, 0x94,
-  0xde, 0xd0, 0xce, 0xba, 0x45, 0xe8, 0x0d, 0xea, 0xe5, 0x80, 0xba, 0x76,
-  0x5d, 0xbb, 0xa9, 0x4a, 0x97, 0xe6, 0xac, 0xdb, 0x2d, 0x0f, 0x3a, 0x25,
-  0x60, 0x4c, 0xdc, 0x74, 0x02, 0x0e, 0x8e, 0x63, 0xcd, 0xd5, 0xd6, 0x2f,
-  0x06, 0xdc, 0x9d, 0xf8, 0x0a, 0x4a, 0xf3, 0x46, 0x9c, 0x82, 0xd9, 0xf5,
-  0xb9, 0xee, 0xa3, 0x9b, 0x61, 0xe0, 0xcc, 0x33, 0x01, 0x63, 0xe2, 0x26,
-  0x14, 0x70, 0xe5, 0x86, 0xd9, 0x4a, 0x9e, 0x19, 0xb0, 0x7f, 0x76, 0xdb,
-  0xae, 0x47, 0x4e, 0xc0, 0x90, 0x6c, 0x42, 0x01, 0x9b, 0x40, 0xfd, 0x73,
-  0xcc, 0xcf, 0x0c, 0x58, 0xff, 0xb8, 0x5a, 0x2b, 0x6e, 0x2a, 0x02, 0x86,
-  0x58, 0x93, 0x39, 0x0b, 0xdd, 0xda, 0x0b, 0x48, 0x7e, 0x24, 0x2f, 0x08,
-  0x38, 0x44, 0xc0, 0x10, 0x6d, 0x4a, 0x01, 0xbb, 0xeb, 0xb1, 0x2f, 0xd9,
-  0x02, 0xdb, 0xcb, 0x4b, 0x04, 0x8c, 0x5f, 0x63, 0x42, 0x01, 0x37, 0x0b,
-  0x9b, 0x95, 0xfd, 0x22, 0x68, 0xb6, 0xc0, 0xc0, 0x2d, 0x13, 0x0a, 0xb8,
-  0xf0, 0xba, 0x7a, 0xc5, 0x59, 0x68, 0xfd, 0x63, 0x5e, 0xf8, 0xce, 0x04,
-  0x0c, 0xc9, 0xa6, 0x13, 0xb0, 0xbe, 0x4c, 0xbb, 0xe9, 0xfe, 0x37, 0xfd,
-  0xde, 0x75, 0xe0, 0x7b, 0xce, 0x42, 0x1f, 0x7b, 0x33, 0x13, 0x30, 0xc4,
-  0x9a, 0x4e, 0xc0, 0xea, 0xb4, 0x70, 0xae, 0x3b, 0xd1, 0x7f, 0x8b, 0xe1,
-  0x05, 0xd7, 0x81, 0x37, 0xbd, 0x99, 0x09, 0x18, 0x62, 0x4d, 0x26, 0x60,
-  0x7d, 0x67, 0x54, 0x6d, 0x92, 0x53, 0xe7, 0xb1, 0x82, 0x66, 0xcf, 0x41,
-  0xdb, 0x81, 0x7b, 0x02, 0xd6, 0x9b, 0x78, 0x77, 0x86, 0xac, 0xd1, 0x9b,
-  0xf9, 0x7f, 0x05, 0x9c, 0x76, 0x3f, 0x6f, 0x09, 0x18, 0xd3, 0x33, 0x5a,
-  0xc0, 0x9f, 0x4e, 0xed, 0xce, 0x60, 0x6d, 0x6c, 0xa6, 0xea, 0x3c, 0x56,
-  0x10, 0xb0, 0x79, 0x62, 0xa9, 0x6e, 0xdb, 0x32, 0xfa, 0x26, 0xcb, 0x7b,
-  0x02, 0x6e, 0xd5, 0xde, 0x79, 0xb2, 0xd2, 0xf3, 0xbe, 0xa7, 0xfa, 0x5c,
-  0xd9, 0xbf, 0x02, 0xee, 0xe6, 0x36, 0x77, 0x58, 0x13, 0x30, 0xa6, 0x64,
-  0xfc, 0x1b, 0x39, 0x54, 0x39, 0x7b, 0x97, 0xca, 0x5c, 0xfd, 0xd8, 0x9d,
-  0xc7, 0x0a, 0x02, 0x36, 0x4f, 0x26, 0x24, 0x2b, 0x7b, 0x47, 0xb3, 0x71,
-  0x57, 0xc0, 0xf6, 0x32, 0xd5, 0xee, 0xf0, 0xf9, 0xbe, 0x4b, 0xed, 0xf1,
-  0xf0, 0xf5, 0x80, 0xf5, 0x9d, 0xd4, 0xe9, 0xe1, 0xcd, 0x9e, 0x21, 0x27,
-  0x60, 0x4c, 0xc9, 0x44, 0x02, 0xae, 0xbc, 0x3a, 0xf4, 0xb1, 0x6a, 0x77,
-  0x1e, 0x2b, 0x3c, 0xec, 0xf5, 0x2f, 0x04, 0x85, 0x0f, 0x04, 0xdf, 0x15,
-  0xb0, 0xdd, 0x8a, 0x46, 0x4b, 0xb9, 0x1e, 0xf0, 0xa6, 0xbf, 0xb2, 0x04,
-  0x8c, 0x29, 0x99, 0x48, 0xc0, 0xfa, 0xc6, 0x46, 0x75, 0xf5, 0x48, 0xdf,
-  0x71, 0x71, 0x39, 0xd6, 0x0d, 0x03, 0xf6, 0x9f, 0xbc, 0x0f, 0xff, 0x66,
-  0xf0, 0x7d, 0x01, 0xf7, 0x2f, 0x05, 0xe7, 0xed, 0xcd, 0x80, 0xbd, 0xdb,
-  0xb3, 0x93, 0xd9, 0x86, 0x80, 0x31, 0x39, 0xd3, 0x08, 0x58, 0x6f, 0x74,
-  0xe7, 0x6a, 0x0a, 0x73, 0x41, 0xb8, 0xea, 0x9d, 0x78, 0xf6, 0x37, 0xa1,
-  0xc1, 0x1f, 0x64, 0xb9, 0x33, 0x60, 0x73, 0x29, 0x49, 0x5b, 0xaa, 0xc1,
-  0xd7, 0x03, 0xf6, 0xa6, 0x9f, 0x55, 0x67, 0x02, 0xc6, 0xe4, 0x4c, 0x22,
-  0x60, 0x73, 0x13, 0xb4, 0xbe, 0x7d, 0x43, 0x3f, 0xdb, 0x7f, 0xd9, 0xc8,
-  0xc6, 0x57, 0x8e, 0xce, 0xe6, 0x7e, 0xc8, 0x79, 0x78, 0x31, 0xe9, 0xde,
-  0x80, 0xdb, 0xd2, 0x6d, 0x84, 0xe7, 0xe6, 0x6e, 0x91, 0x1b, 0x01, 0xdb,
-  0x0f, 0x93, 0xac, 0xd6, 0x93, 0x11, 0x30, 0xa6, 0x44, 0xda, 0x5f, 0xde,
-  0x6d, 0xca, 0x62, 0x9f, 0xed, 0x8b, 0x5b, 0x7f, 0x0f, 0xed, 0x5f, 0x4b,
-  0x38, 0x5f, 0x96, 0x70, 0x2c, 0x9b, 0x3b, 0xa6, 0xbd, 0x5c, 0x7c, 0x3a,
-  0x15, 0x59, 0x71, 0xe4, 0x2f, 0x22, 0x62, 0x9a, 0xa4, 0x05, 0x0c, 0xc0,
-  0x43, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04,
-  0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80,
-  0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46,
-  0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c,
-  0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60,
-  0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0,
-  0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08,
-  0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04,
-  0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80,
-  0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46,
-  0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c,
-  0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60,
-  0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0,
-  0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08,
-  0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04,
-  0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80,
-  0x60, 0x04, 0x0c, 0x08, 0x46, 0xc0, 0x80, 0x60, 0x04, 0x0c, 0x08, 0xf6,
-  0xff, 0x6c, 0xb1, 0x25, 0xaf, 0x25, 0x6c, 0xaa, 0x32, 0x00, 0x00, 0x00,
-  0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-const uint32_t menu_png_len = 8841;
@@ -0,0 +1,70 @@
+// Compressed OTA images: the firmware as independently deflated blocks.
+//
+// Made at publish time by scripts/pack_ota.py, served as /firmware/{v}.wfz.
+// Each block inflates on its own (raw deflate, fresh window), so the device's
+// sliced download can stop after any block and resume at the next one on a
+// later wake — no decompressor state to carry across deep sleep — and inflating
+// needs only one block of input and output in memory. Block boundaries are
+// multiples of the 4 KB flash sector, so every block lands on sectors of its own.
+//
+// Layout (little-endian):
+//   "WFZ1"      magic
+//   u32         image size (inflated)
+//   u32         block size (inflated; a multiple of 4096, at most MAX_BLOCK)
+//   u32         block count
+//   u8[32]      SHA-256 of the inflated image
+//   blocks, each a u32 prefix then its bytes: bits 0-30 the stored length,
+//   bit 31 set if the block is stored as is (deflate didn't shrink it). Every
+//   block inflates to `block size` bytes except the last, which is the rest.
+//
+// Header-only and free of Arduino/ESP dependencies, so it also builds on a host.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace otaimg {
+
+static const uint32_t HEADER_SIZE = 48;
+static const uint32_t MAX_BLOCK   = 64 * 1024;
+static const uint32_t BLOCK_RAW   = 0x80000000u;
+static const uint32_t BLOCK_SLACK = 64;  // a deflated block stores in under its length + this
+
+struct Header {
+    uint32_t imageSize;
+    uint32_t blockSize;
+    uint32_t blockCount;
+    uint8_t  sha[32];
+};
+
+static inline uint32_t le32(const uint8_t *p) {
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+// Parses and sanity-checks the header.
+static inline bool parseHeader(const uint8_t *raw, Header &h) {
+    if (memcmp(raw, "WFZ1", 4) != 0) return false;
+    h.imageSize  = le32(raw + 4);
+    h.blockSize  = le32(raw + 8);
+    h.blockCount = le32(raw + 12);
+    memcpy(h.sha, raw + 16, 32);
+    return h.blockSize > 0 && h.blockSize % 4096 == 0 && h.blockSize <= MAX_BLOCK
+        && h.imageSize > 0
+        && h.blockCount == (h.imageSize + h.blockSize - 1) / h.blockSize;
+}
+
+// Inflated size of block `i`.
+static inline uint32_t blockLength(const Header &h, uint32_t i) {
+    return i + 1 < h.blockCount ? h.blockSize : h.imageSize - i * h.blockSize;
+}
+
+// Splits a block prefix; false if the stored length can't be right for block `i`.
+static inline bool parseBlockPrefix(const Header &h, uint32_t i, uint32_t prefix,
+                                    uint32_t &stored, bool &raw) {
+    stored = prefix & ~BLOCK_RAW;
+    raw    = (prefix & BLOCK_RAW) != 0;
+    return stored > 0 && (raw ? stored == blockLength(h, i) : stored < blockLength(h, i) + BLOCK_SLACK);
+}
+
+}  // namespace otaimg
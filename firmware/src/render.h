@@ -6,12 +6,12 @@
 
 #pragma once
 
-// Renders the bundled splash PNG to the e-paper (onboarding / offline
+// Renders the bundled splash image to the e-paper (onboarding / offline
 // fallback). If bottomMsg is non-null, draws it centered in the reserved
 // bottom strip (e.g. "WiFi network unavailable"). Never draws a QR — the
 // device-setup screen (renderSetupScreen) owns the QR now.
 void renderSplash(const char *bottomMsg = nullptr);
 
-// Renders the dedicated device-setup PNG with the WiFi-join QR over the QR
+// Renders the dedicated device-setup image with the WiFi-join QR over the QR
 // area. Shown while the captive-portal AP is active (enterSetupMode()).
 void renderSetupScreen(const char *wifiJoinStr);
@@ -0,0 +1,44 @@
+// Run-length-coded 4bpp framebuffer images.
+//
+// The baked screens (splash, setup, menu) are pre-quantized and packed at build
+// time by scripts/pack_4bpp.py into exactly the bytes the framebuffer holds, then
+// run-length coded. Expanding one is a loop of memset/memcpy — no inflate, no
+// per-pixel conversion — so showing the menu no longer involves the PNG decoder.
+//
+// Stream format, a sequence of packets:
+//   0x00..0x7F  c   → the next c+1 bytes are literal
+//   0x80..0xFF  c   → the next byte repeated (c & 0x7F)+1 times
+//
+// Header-only and free of Arduino/ESP dependencies, so it also builds on a host.
+
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+namespace rle4 {
+
+// Expands `src` into `dst`. Returns true only if the stream fills exactly
+// `dstLen` bytes and is consumed exactly; a malformed or mismatched stream
+// returns false (dst may then be partially written).
+static inline bool unpack(const uint8_t *src, uint32_t srcLen,
+                          uint8_t *dst, uint32_t dstLen) {
+    uint32_t in = 0, out = 0;
+    while (in < srcLen) {
+        const uint8_t c = src[in++];
+        const uint32_t n = (uint32_t)(c & 0x7F) + 1;
+        if (out + n > dstLen) return false;
+        if (c & 0x80) {
+            if (in >= srcLen) return false;
+            memset(dst + out, src[in++], n);
+        } else {
+            if (in + n > srcLen) return false;
+            memcpy(dst + out, src + in, n);
+            in += n;
+        }
+        out += n;
+    }
+    return out == dstLen;
+}
+
+}  // namespace rle4
@@ -0,0 +1,117 @@
+// Row kernels: decoded PNG scanline → packed 4bpp framebuffer row.
+//
+// PNGdec hands png_draw_callback() one row at a time in the PNG's own pixel
+// format. Rather than expanding every row to RGB565 and pushing each pixel
+// through epd_draw_pixel() (bounds check + read-modify-write per pixel), each
+// supported source format gets a kernel specialized at compile time that emits
+// two pixels per byte straight into the framebuffer row.
+//
+// Framebuffer packing (matches the LilyGo EPD driver): 4 bits per pixel, even x
+// in the LOW nibble, odd x in the HIGH nibble, level = luma >> 4 (0 = black,
+// 15 = white). Transparent pixels composite onto white, like the server does.
+//
+// Header-only and free of Arduino/ESP dependencies, so it also builds on a host.
+
+#pragma once
+
+#include <stdint.h>
+
+namespace scanline {
+
+// BT.601 luma, same integer formula as the worker's PNG encoder.
+static inline uint8_t luma(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint8_t)((77u * r + 150u * g + 29u * b) >> 8);
+}
+
+// Composite `v` over white with alpha `a` (0 = transparent → white).
+static inline uint8_t overWhite(uint8_t v, uint8_t a) {
+    return (uint8_t)((v * a + 255u * (255u - a)) / 255u);
+}
+
+// ── source formats ───────────────────────────────────────────────────────────
+// Each exposes `level(row, x, lut)` → the 8-bit luma of pixel x. `lut` is only
+// used by the indexed formats (palette index → luma, see buildPaletteLut()).
+
+struct Gray8 {
+    static inline uint8_t level(const uint8_t *row, int x, const uint8_t *) {
+        return row[x];
+    }
+};
+
+struct GrayAlpha8 {
+    static inline uint8_t level(const uint8_t *row, int x, const uint8_t *) {
+        return overWhite(row[2 * x], row[2 * x + 1]);
+    }
+};
+
+struct Rgb8 {
+    static inline uint8_t level(const uint8_t *row, int x, const uint8_t *) {
+        const uint8_t *p = row + 3 * x;
+        return luma(p[0], p[1], p[2]);
+    }
+};
+
+struct Rgba8 {
+    static inline uint8_t level(const uint8_t *row, int x, const uint8_t *) {
+        const uint8_t *p = row + 4 * x;
+        return overWhite(luma(p[0], p[1], p[2]), p[3]);
+    }
+};
+
+// Palette indices of `Bits` bits each, packed MSB-first as PNG stores them.
+template <int Bits>
+struct Indexed {
+    static inline uint8_t level(const uint8_t *row, int x, const uint8_t *lut) {
+        const int perByte = 8 / Bits;
+        const int shift   = (perByte - 1 - (x % perByte)) * Bits;
+        return lut[(row[x / perByte] >> shift) & ((1 << Bits) - 1)];
+    }
+};
+
+// 4bpp grayscale: already at panel depth. Has its own whole-row kernel below.
+struct Gray4 {};
+
+// ── kernels ─────────────────────────────────────────────────────────────────
+
+// Writes `width` pixels of `src` into the packed framebuffer row `dst`.
+template <typename Src>
+static inline void blitRow(uint8_t *dst, const uint8_t *src, int width,
+                           const uint8_t *lut = nullptr) {
+    const int pairs = width / 2;
+    for (int i = 0; i < pairs; i++) {
+        const uint8_t even = Src::level(src, 2 * i, lut);
+        const uint8_t odd  = Src::level(src, 2 * i + 1, lut);
+        dst[i] = (uint8_t)((even >> 4) | (odd & 0xF0));
+    }
+    if (width & 1) {
+        const uint8_t last = Src::level(src, width - 1, lut);
+        dst[pairs] = (uint8_t)((dst[pairs] & 0xF0) | (last >> 4));
+    }
+}
+
+// 4bpp grayscale rows are the framebuffer row with each byte's nibbles swapped
+// (PNG puts the left pixel in the high nibble).
+template <>
+inline void blitRow<Gray4>(uint8_t *dst, const uint8_t *src, int width,
+                           const uint8_t *) {
+    const int pairs = width / 2;
+    for (int i = 0; i < pairs; i++) {
+        dst[i] = (uint8_t)((src[i] >> 4) | (src[i] << 4));
+    }
+    if (width & 1) {
+        dst[pairs] = (uint8_t)((dst[pairs] & 0xF0) | (src[pairs] >> 4));
+    }
+}
+
+// Fills `lut` (256 entries) with the over-white luma of each palette entry.
+// `rgb` is the PNG palette as RGB triplets; `alpha` (may be null) its tRNS
+// alpha per entry, as PNGdec lays them out (alpha at rgb + 768).
+static inline void buildPaletteLut(uint8_t *lut, const uint8_t *rgb,
+                                   const uint8_t *alpha) {
+    for (int i = 0; i < 256; i++) {
+        const uint8_t v = luma(rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]);
+        lut[i] = alpha ? overWhite(v, alpha[i]) : v;
+    }
+}
+
+}  // namespace scanline
@@ -0,0 +1,1827 @@
+// Auto-generated by scripts/bake-setup.sh from worker/renderer/setup.png.
+// Do not edit by hand — re-run the script if the setup screen changes.
+// Run-length-coded 4bpp framebuffer (scripts/pack_4bpp.py, src/rle4.h).
+#pragma once
+#include <stdint.h>
+
+const uint8_t setup_4bpp[] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd6, 0xff, 0x03, 0xef, 0x59, 0x43, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xdb, 0xff, 0x00, 0x2b, 0x82, 0x00, 0x00, 0xe5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xd9, 0xff, 0x01, 0xdf, 0x01, 0x82, 0x00, 0x00, 0x50,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x4f, 0x84, 0x00,
+  0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0xff,
+  0x00, 0x0d, 0x84, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd8, 0xff, 0x00, 0x0e, 0x84, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xa2, 0xff, 0x00, 0x89, 0x84, 0x88, 0x02, 0xc8, 0xcc, 0xfc,
+  0xac, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xa2, 0xff, 0x00, 0x03, 0x87, 0x00, 0x01, 0x52, 0xc8, 0xaa,
+  0xff, 0x00, 0x6f, 0x84, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xa2, 0xff, 0x00, 0x03, 0x89, 0x00, 0x01, 0x61, 0xfc, 0xa9, 0xff,
+  0x00, 0x02, 0x82, 0x00, 0x00, 0x80, 0xd0, 0xff, 0x02, 0xcf, 0x9c, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x03, 0x8a, 0x00, 0x01, 0x30,
+  0xfb, 0xa8, 0xff, 0x00, 0x5e, 0x82, 0x00, 0x00, 0xf9, 0xcd, 0xff, 0x05,
+  0x8b, 0x48, 0x04, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff,
+  0x00, 0x03, 0x8b, 0x00, 0x01, 0x50, 0xfe, 0xa8, 0xff, 0x02, 0x9c, 0x77,
+  0xeb, 0xce, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xcf, 0xff, 0x00, 0x03, 0x8c, 0x00, 0x00, 0x91, 0xfa, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00,
+  0x03, 0x8d, 0x00, 0x00, 0xf9, 0xf9, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x03, 0x8d, 0x00, 0x00,
+  0x90, 0xf9, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xcf, 0xff, 0x00, 0x03, 0x83, 0x00, 0x03, 0xb2, 0xbb, 0x7b, 0x47,
+  0x86, 0x00, 0x00, 0xfd, 0xf8, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3,
+  0x82, 0xff, 0x00, 0x9e, 0x85, 0x00, 0x00, 0xf5, 0xf8, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x2c, 0x84, 0x00, 0x00, 0xc0,
+  0x87, 0xff, 0x05, 0x8b, 0x34, 0x00, 0x00, 0x53, 0xda, 0xa4, 0xff, 0x06,
+  0xaf, 0x47, 0x03, 0x00, 0x30, 0xa5, 0xfd, 0x87, 0xff, 0x06, 0xaf, 0x47,
+  0x03, 0x00, 0x30, 0xa6, 0xfd, 0x90, 0xff, 0x06, 0xbf, 0x46, 0x02, 0x00,
+  0x00, 0x74, 0xeb, 0x89, 0xff, 0x05, 0x8d, 0x45, 0x01, 0x00, 0x41, 0xc8,
+  0x87, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x9e, 0xff, 0x05, 0xbf,
+  0x36, 0x00, 0x00, 0x74, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xef, 0x84, 0x00, 0x00,
+  0x40, 0x86, 0xff, 0x00, 0x2a, 0x85, 0x00, 0x00, 0xb4, 0x83, 0xff, 0x00,
+  0x0c, 0x83, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x01,
+  0xfe, 0xbf, 0x84, 0x00, 0x86, 0xff, 0x01, 0x9e, 0x02, 0x84, 0x00, 0x01,
+  0x40, 0xfb, 0x85, 0xff, 0x01, 0x9e, 0x02, 0x84, 0x00, 0x01, 0x50, 0xfd,
+  0x8e, 0xff, 0x01, 0x6d, 0x01, 0x85, 0x00, 0x00, 0xb5, 0x87, 0xff, 0x00,
+  0x4b, 0x85, 0x00, 0x00, 0xa2, 0x83, 0xff, 0x00, 0x7f, 0x8a, 0x00, 0x02,
+  0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x82, 0x00, 0x03, 0x70, 0xff,
+  0xbf, 0x02, 0x83, 0x00, 0x01, 0x40, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xa9,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0x07, 0x84,
+  0x00, 0x00, 0xfd, 0x84, 0xff, 0x00, 0x1b, 0x87, 0x00, 0x00, 0xe5, 0x82,
+  0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x10, 0x84, 0xff, 0x00, 0x8f, 0x83,
+  0x00, 0x02, 0x40, 0xff, 0xbf, 0x84, 0x00, 0x85, 0xff, 0x01, 0x9f, 0x01,
+  0x86, 0x00, 0x01, 0x40, 0xfd, 0x83, 0xff, 0x01, 0x9f, 0x01, 0x86, 0x00,
+  0x01, 0x70, 0xfe, 0x8c, 0xff, 0x01, 0x8f, 0x01, 0x87, 0x00, 0x00, 0xc3,
+  0x85, 0xff, 0x00, 0x4e, 0x87, 0x00, 0x00, 0xc2, 0x82, 0xff, 0x00, 0x7f,
+  0x89, 0x00, 0x03, 0x10, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x82,
+  0x00, 0x02, 0x50, 0xef, 0x05, 0x85, 0x00, 0x00, 0x91, 0xff, 0xff, 0xff,
+  0xff, 0xa9, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00,
+  0x1f, 0x84, 0x00, 0x00, 0xf9, 0x83, 0xff, 0x00, 0x9f, 0x88, 0x00, 0x04,
+  0x30, 0xfd, 0xff, 0xff, 0x5f, 0x84, 0x00, 0x00, 0xfc, 0x83, 0xff, 0x00,
+  0x4f, 0x83, 0x00, 0x02, 0x90, 0xff, 0xbf, 0x84, 0x00, 0x85, 0xff, 0x00,
+  0x06, 0x88, 0x00, 0x00, 0x91, 0x83, 0xff, 0x00, 0x09, 0x88, 0x00, 0x00,
+  0xe3, 0x8c, 0xff, 0x00, 0x06, 0x89, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x01,
+  0xcf, 0x01, 0x87, 0x00, 0x04, 0x10, 0xfa, 0xff, 0xff, 0x7f, 0x89, 0x00,
+  0x03, 0x30, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x82, 0x00, 0x01,
+  0x30, 0x3f, 0x87, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0x7f, 0x84, 0x00,
+  0x00, 0xf5, 0x83, 0xff, 0x00, 0x09, 0x89, 0x00, 0x03, 0xd1, 0xff, 0xff,
+  0xaf, 0x84, 0x00, 0x00, 0xf9, 0x83, 0xff, 0x00, 0x1f, 0x83, 0x00, 0x02,
+  0xd0, 0xff, 0xbf, 0x84, 0x00, 0x84, 0xff, 0x00, 0x3e, 0x89, 0x00, 0x04,
+  0x10, 0xfe, 0xff, 0xff, 0x6f, 0x89, 0x00, 0x01, 0x30, 0xfe, 0x8a, 0xff,
+  0x00, 0x6f, 0x8a, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x00, 0x1c, 0x89, 0x00,
+  0x03, 0x90, 0xff, 0xff, 0x7f, 0x89, 0x00, 0x03, 0x70, 0xff, 0xff, 0x7f,
+  0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7,
+  0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0x06, 0x87, 0x00, 0x00, 0xc1,
+  0xff, 0xff, 0xff, 0xff, 0xa8, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3,
+  0x84, 0xff, 0x00, 0xcf, 0x84, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x00, 0x9f,
+  0x8a, 0x00, 0x00, 0x30, 0x82, 0xff, 0x84, 0x00, 0x00, 0xf5, 0x83, 0xff,
+  0x00, 0x0c, 0x83, 0x00, 0x02, 0xf2, 0xff, 0xbf, 0x84, 0x00, 0x84, 0xff,
+  0x00, 0x03, 0x89, 0x00, 0x00, 0xc0, 0x82, 0xff, 0x00, 0x07, 0x8a, 0x00,
+  0x00, 0xf5, 0x8a, 0xff, 0x00, 0x07, 0x8a, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x01, 0xdf, 0x01, 0x89, 0x00, 0x03, 0x10, 0xfd, 0xff, 0x7f, 0x89, 0x00,
+  0x03, 0x80, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x8c, 0x00, 0x00,
+  0x40, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xf3, 0x85, 0xff, 0x84, 0x00, 0x00, 0xd0, 0x82, 0xff, 0x00, 0x1e, 0x84,
+  0x00, 0x01, 0x41, 0x03, 0x84, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x05, 0x83,
+  0x00, 0x00, 0xf2, 0x83, 0xff, 0x00, 0x08, 0x83, 0x00, 0x02, 0xf8, 0xff,
+  0xbf, 0x84, 0x00, 0x83, 0xff, 0x00, 0x7f, 0x8a, 0x00, 0x03, 0xf7, 0xff,
+  0xff, 0xdf, 0x84, 0x00, 0x01, 0x10, 0x34, 0x84, 0x00, 0x00, 0x80, 0x89,
+  0xff, 0x01, 0xef, 0x01, 0x89, 0x00, 0x00, 0x20, 0x83, 0xff, 0x00, 0x4f,
+  0x84, 0x00, 0x01, 0x30, 0x14, 0x84, 0x00, 0x02, 0xf3, 0xff, 0x7f, 0x89,
+  0x00, 0x03, 0xb0, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x8d, 0x00,
+  0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xf3, 0x85, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xb0, 0x82, 0xff,
+  0x00, 0x06, 0x83, 0x00, 0x03, 0xc1, 0xff, 0xff, 0x09, 0x83, 0x00, 0x03,
+  0xd0, 0xff, 0xff, 0x0a, 0x83, 0x00, 0x00, 0xe0, 0x83, 0xff, 0x00, 0x04,
+  0x83, 0x00, 0x02, 0xfd, 0xff, 0xbf, 0x84, 0x00, 0x83, 0xff, 0x00, 0x0c,
+  0x85, 0x00, 0x00, 0x31, 0x82, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x4f,
+  0x83, 0x00, 0x03, 0x20, 0xfe, 0xff, 0x8f, 0x83, 0x00, 0x01, 0x10, 0xfe,
+  0x88, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x06, 0x93, 0xbb, 0x79, 0x13, 0x00,
+  0x00, 0xc0, 0x83, 0xff, 0x00, 0x0a, 0x83, 0x00, 0x03, 0x90, 0xff, 0xff,
+  0x0c, 0x83, 0x00, 0x02, 0x90, 0xff, 0x7f, 0x89, 0x00, 0x03, 0xe0, 0xff,
+  0xff, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x85, 0x00, 0x02, 0x71, 0x57, 0x01,
+  0x84, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x07, 0x83, 0x00, 0x03, 0xb0,
+  0xff, 0xff, 0xcf, 0x83, 0x00, 0x04, 0x10, 0xfe, 0xff, 0xff, 0xbf, 0x83,
+  0x00, 0x03, 0x50, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x00, 0xa0, 0x83, 0xff,
+  0x00, 0x02, 0x82, 0x00, 0x03, 0x20, 0xff, 0xff, 0xbf, 0x84, 0x00, 0x83,
+  0xff, 0x00, 0x03, 0x84, 0x00, 0x05, 0xea, 0xff, 0xef, 0x3a, 0x00, 0xd0,
+  0x82, 0xff, 0x00, 0x0a, 0x83, 0x00, 0x00, 0xe4, 0x82, 0xff, 0x00, 0x09,
+  0x83, 0x00, 0x00, 0xf9, 0x88, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x00, 0x40,
+  0x83, 0xff, 0x02, 0x3b, 0x00, 0xf7, 0x82, 0xff, 0x01, 0xef, 0x01, 0x83,
+  0x00, 0x04, 0xfc, 0xff, 0xff, 0xef, 0x01, 0x82, 0x00, 0x00, 0x20, 0x83,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x07, 0x84, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x5f, 0x84, 0x00,
+  0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xf3, 0x85, 0xff, 0x00, 0x07, 0x83, 0x00, 0x03, 0x90, 0xff, 0xff,
+  0x5f, 0x83, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x03, 0x82, 0x00, 0x03,
+  0x10, 0xfe, 0xff, 0x5f, 0x83, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0xdf,
+  0x83, 0x00, 0x03, 0x60, 0xff, 0xff, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x00,
+  0xbf, 0x84, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x01, 0x1a, 0xfa, 0x82, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xfc, 0x82, 0xff, 0x00, 0x1f, 0x83, 0x00,
+  0x00, 0xf2, 0x88, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x00, 0xb0, 0x84, 0xff,
+  0x01, 0x5b, 0xfe, 0x82, 0xff, 0x00, 0x9f, 0x83, 0x00, 0x00, 0x50, 0x83,
+  0xff, 0x00, 0x08, 0x83, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x84,
+  0x00, 0x00, 0xfc, 0x82, 0xff, 0x00, 0x05, 0x83, 0x00, 0x00, 0x90, 0xff,
+  0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff, 0x1f, 0x83, 0x00,
+  0x00, 0xf1, 0x83, 0xff, 0x00, 0x0a, 0x83, 0x00, 0x02, 0xf9, 0xff, 0xaf,
+  0x83, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x9f, 0x83, 0x00, 0x03, 0xc0,
+  0xff, 0xff, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x00, 0x5f, 0x84, 0x00, 0x00,
+  0xfc, 0x87, 0xff, 0x00, 0xdf, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x9f, 0x83, 0x00, 0x00, 0xc0, 0x88, 0xff, 0x00, 0x1f, 0x83, 0x00, 0x00,
+  0xa0, 0x89, 0xff, 0x00, 0x4f, 0x83, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x00,
+  0x0e, 0x83, 0x00, 0x00, 0xf6, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x00, 0x0d, 0x83, 0x00, 0x00, 0x40, 0xff, 0xff, 0xff,
+  0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00,
+  0x09, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff, 0x0b, 0x83, 0x00, 0x00, 0xf7,
+  0x83, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x02, 0xf6, 0xff, 0xef, 0x84, 0x00,
+  0x82, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x03, 0xf1, 0xff, 0xff, 0xbf, 0x84,
+  0x00, 0x82, 0xff, 0x00, 0x1f, 0x83, 0x00, 0x00, 0x50, 0x88, 0xff, 0x00,
+  0x9f, 0x83, 0x00, 0x00, 0x80, 0x83, 0xff, 0x00, 0xdf, 0x83, 0x00, 0x00,
+  0x80, 0x88, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x01, 0x30, 0xfd, 0x88, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x3f, 0x83, 0x00,
+  0x00, 0xf3, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff,
+  0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff,
+  0x00, 0x3f, 0x83, 0x00, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x0b, 0x83, 0x00,
+  0x03, 0x70, 0xff, 0xff, 0x06, 0x83, 0x00, 0x00, 0xf9, 0x83, 0xff, 0x00,
+  0x0f, 0x83, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x04, 0x83, 0x00, 0x03, 0xfb,
+  0xff, 0xff, 0x2f, 0x83, 0x00, 0x03, 0xf6, 0xff, 0xff, 0xbf, 0x84, 0x00,
+  0x82, 0xff, 0x00, 0x0a, 0x83, 0x00, 0x00, 0xb0, 0x88, 0xff, 0x00, 0x4f,
+  0x83, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x83, 0x00, 0x00, 0x50, 0x88, 0xff,
+  0x00, 0x7f, 0x84, 0x00, 0x01, 0x60, 0xfc, 0x87, 0xff, 0x00, 0x0a, 0x83,
+  0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x5f, 0x83, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x7f, 0x84,
+  0x00, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xf3, 0x85, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x03, 0x70, 0xff, 0xff, 0x03,
+  0x83, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x03, 0xf0,
+  0xff, 0xff, 0x09, 0x83, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x0d, 0x83, 0x00,
+  0x03, 0xfa, 0xff, 0xff, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x00, 0x06, 0x83,
+  0x00, 0x00, 0xf0, 0x88, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xd0, 0x84,
+  0xff, 0x83, 0x00, 0x00, 0x30, 0x88, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x01,
+  0x30, 0xd9, 0x86, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x83, 0xff,
+  0x00, 0x7f, 0x83, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf3, 0x83, 0xff, 0x00, 0x9f, 0x84, 0x00, 0x00, 0xfd, 0xff, 0xff,
+  0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85, 0xff,
+  0x00, 0x08, 0x83, 0x00, 0x02, 0x70, 0xff, 0xff, 0x84, 0x00, 0x84, 0xff,
+  0x00, 0x3f, 0x83, 0x00, 0x03, 0xe0, 0xff, 0xff, 0x0e, 0x83, 0x00, 0x03,
+  0xf4, 0xff, 0xff, 0x0a, 0x83, 0x00, 0x82, 0xff, 0x00, 0xbf, 0x84, 0x00,
+  0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x88, 0xff, 0x00, 0x0f,
+  0x83, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x00, 0x03, 0x83, 0x00, 0x89, 0xff,
+  0x00, 0x01, 0x86, 0x00, 0x01, 0xa3, 0xfe, 0x84, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xfa, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0xb0, 0x82,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xbf, 0x84,
+  0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x07, 0x83, 0x00, 0x02, 0x80, 0xff,
+  0xff, 0x8e, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x4f, 0x83, 0x00, 0x03, 0xf1,
+  0xff, 0xff, 0x06, 0x82, 0x00, 0x00, 0x50, 0x82, 0xff, 0x00, 0xbf, 0x84,
+  0x00, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf5, 0x88, 0xff, 0x00,
+  0x0c, 0x8e, 0x00, 0x89, 0xff, 0x00, 0x0b, 0x87, 0x00, 0x01, 0x60, 0xfb,
+  0x83, 0xff, 0x00, 0x03, 0x8d, 0x00, 0x00, 0x90, 0x82, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30,
+  0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07,
+  0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x00, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3,
+  0x85, 0xff, 0x00, 0x07, 0x83, 0x00, 0x02, 0xb0, 0xff, 0xcf, 0x8e, 0x00,
+  0x03, 0xb0, 0xff, 0xff, 0x9f, 0x83, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x03,
+  0x82, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82, 0xff,
+  0x84, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x00, 0x0b, 0x8e, 0x00, 0x89, 0xff,
+  0x00, 0x6f, 0x88, 0x00, 0x01, 0x50, 0xfe, 0x82, 0xff, 0x00, 0x03, 0x8d,
+  0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84,
+  0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83,
+  0xff, 0x00, 0xbf, 0x84, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa6,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x05, 0x83,
+  0x00, 0x02, 0xb0, 0xff, 0xbf, 0x8e, 0x00, 0x03, 0xb0, 0xff, 0xff, 0xef,
+  0x83, 0x00, 0x02, 0x90, 0xff, 0xef, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x00, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x84, 0x00, 0x00, 0xf7, 0x88, 0xff,
+  0x00, 0x0a, 0x8e, 0x00, 0x8a, 0xff, 0x00, 0x07, 0x88, 0x00, 0x00, 0xa1,
+  0x82, 0xff, 0x8e, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff,
+  0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf3, 0x83, 0xff, 0x00, 0xef, 0x84, 0x00, 0x00, 0xf9, 0xff, 0xff,
+  0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x85, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x02, 0xc0, 0xff, 0xbf, 0x8e, 0x00, 0x00, 0xb0,
+  0x82, 0xff, 0x00, 0x04, 0x82, 0x00, 0x02, 0x60, 0xff, 0xaf, 0x83, 0x00,
+  0x00, 0xf4, 0x82, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x84, 0x00,
+  0x00, 0xf7, 0x88, 0xff, 0x00, 0x09, 0x8e, 0x00, 0x8a, 0xff, 0x01, 0xcf,
+  0x01, 0x88, 0x00, 0x02, 0xfa, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xcf, 0x84,
+  0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xf3, 0x85, 0xff, 0x84, 0x00, 0x02, 0xf0, 0xff, 0xbf, 0x8e,
+  0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x08, 0x82, 0x00, 0x02, 0x30, 0xff,
+  0x6f, 0x83, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82,
+  0xff, 0x84, 0x00, 0x00, 0xf7, 0x88, 0xff, 0x00, 0x0b, 0x8e, 0x00, 0x8b,
+  0xff, 0x01, 0x8e, 0x01, 0x87, 0x00, 0x02, 0xe1, 0xff, 0xff, 0x8e, 0x00,
+  0x00, 0x70, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff,
+  0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff,
+  0x00, 0xbf, 0x84, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0xaf, 0x84, 0x00,
+  0x02, 0xf4, 0xff, 0xcf, 0x8e, 0x00, 0x00, 0xc0, 0x82, 0xff, 0x00, 0x0d,
+  0x83, 0x00, 0x01, 0xfe, 0x3f, 0x83, 0x00, 0x00, 0xfe, 0x82, 0xff, 0x00,
+  0xbf, 0x84, 0x00, 0x82, 0xff, 0x00, 0x01, 0x83, 0x00, 0x00, 0xf6, 0x88,
+  0xff, 0x00, 0x0b, 0x8e, 0x00, 0x8c, 0xff, 0x01, 0xbf, 0x05, 0x86, 0x00,
+  0x03, 0x40, 0xff, 0xff, 0x03, 0x8d, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00,
+  0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x00,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xf3, 0x84, 0xff, 0x00, 0x6f, 0x84, 0x00, 0x02, 0xf8, 0xff, 0xff, 0x84,
+  0x00, 0x00, 0xfd, 0x8c, 0xff, 0x00, 0x2f, 0x83, 0x00, 0x01, 0xfb, 0x0f,
+  0x82, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82, 0xff,
+  0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x88, 0xff, 0x00, 0x0b, 0x83, 0x00,
+  0x00, 0xf0, 0x97, 0xff, 0x01, 0xef, 0x5a, 0x86, 0x00, 0x02, 0xfd, 0xff,
+  0x03, 0x83, 0x00, 0x00, 0xf8, 0x8c, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xf3, 0x83, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xff,
+  0xff, 0xa6, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00,
+  0x1e, 0x84, 0x00, 0x02, 0xfc, 0xff, 0xff, 0x84, 0x00, 0x00, 0xf9, 0x8c,
+  0xff, 0x00, 0x8f, 0x83, 0x00, 0x01, 0xf7, 0x0b, 0x82, 0x00, 0x00, 0x80,
+  0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x00, 0xf1, 0x88, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0xb0, 0x99, 0xff,
+  0x01, 0xaf, 0x03, 0x84, 0x00, 0x02, 0xfb, 0xff, 0x05, 0x83, 0x00, 0x00,
+  0xf5, 0x8c, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00,
+  0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00,
+  0x7f, 0x84, 0x00, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0x06, 0x83, 0x00, 0x00, 0x10, 0x82,
+  0xff, 0x00, 0x04, 0x83, 0x00, 0x00, 0xf6, 0x8c, 0xff, 0x00, 0xdf, 0x83,
+  0x00, 0x01, 0xf3, 0x07, 0x82, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x00, 0xbf,
+  0x84, 0x00, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xc0, 0x88, 0xff,
+  0x00, 0x2f, 0x83, 0x00, 0x00, 0x70, 0x9a, 0xff, 0x00, 0x8f, 0x84, 0x00,
+  0x02, 0xf7, 0xff, 0x09, 0x83, 0x00, 0x00, 0xf2, 0x8c, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30,
+  0x83, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07,
+  0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x00, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3,
+  0x83, 0xff, 0x00, 0x9f, 0x84, 0x00, 0x00, 0x90, 0x82, 0xff, 0x00, 0x08,
+  0x83, 0x00, 0x00, 0xf3, 0x8d, 0xff, 0x00, 0x02, 0x82, 0x00, 0x01, 0xf1,
+  0x03, 0x82, 0x00, 0x00, 0xf2, 0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82,
+  0xff, 0x00, 0x0d, 0x83, 0x00, 0x00, 0x60, 0x88, 0xff, 0x00, 0x6f, 0x83,
+  0x00, 0x00, 0x40, 0x9b, 0xff, 0x00, 0x01, 0x83, 0x00, 0x02, 0xf5, 0xff,
+  0x0d, 0x83, 0x00, 0x00, 0xd0, 0x8c, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xf9, 0x84, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x06, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xf3, 0x83, 0xff, 0x00, 0x0d, 0x83, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff,
+  0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00,
+  0x09, 0x84, 0x00, 0x00, 0xf1, 0x82, 0xff, 0x00, 0x0c, 0x83, 0x00, 0x00,
+  0x80, 0x85, 0xff, 0x00, 0xdf, 0x86, 0xff, 0x00, 0x08, 0x82, 0x00, 0x00,
+  0xc0, 0x83, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x82,
+  0xff, 0x00, 0x2f, 0x84, 0x00, 0x00, 0xfc, 0x87, 0xff, 0x00, 0xaf, 0x84,
+  0x00, 0x00, 0xfa, 0x85, 0xff, 0x00, 0xfd, 0x8c, 0xff, 0x00, 0xfb, 0x85,
+  0xff, 0x00, 0x03, 0x83, 0x00, 0x02, 0xf6, 0xff, 0x1f, 0x83, 0x00, 0x00,
+  0x50, 0x86, 0xff, 0x00, 0xfe, 0x84, 0xff, 0x00, 0x03, 0x83, 0x00, 0x00,
+  0xf7, 0x84, 0xff, 0x00, 0x9f, 0x83, 0x00, 0x00, 0x30, 0x82, 0xff, 0x01,
+  0xcf, 0x01, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00,
+  0x00, 0xf3, 0x83, 0xff, 0x00, 0x08, 0x83, 0x00, 0x00, 0xa0, 0xff, 0xff,
+  0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x04, 0xf3, 0xff, 0xff,
+  0xef, 0x2a, 0x85, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0x3f, 0x83, 0x00,
+  0x01, 0x10, 0xfd, 0x84, 0xff, 0x01, 0x19, 0xf7, 0x85, 0xff, 0x00, 0x0d,
+  0x82, 0x00, 0x00, 0x50, 0x83, 0x00, 0x00, 0xfc, 0x83, 0xff, 0x00, 0xbf,
+  0x84, 0x00, 0x82, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x00, 0xc1, 0x82, 0xff,
+  0x02, 0xef, 0x18, 0xfb, 0x82, 0xff, 0x00, 0x01, 0x83, 0x00, 0x00, 0xe1,
+  0x84, 0xff, 0x01, 0x8f, 0x90, 0x8b, 0xff, 0x02, 0x6f, 0x30, 0xfb, 0x84,
+  0xff, 0x00, 0x02, 0x83, 0x00, 0x02, 0xf7, 0xff, 0x7f, 0x84, 0x00, 0x00,
+  0xfa, 0x84, 0xff, 0x01, 0x2b, 0xf4, 0x84, 0xff, 0x00, 0x04, 0x83, 0x00,
+  0x00, 0xf2, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x03, 0xfe, 0xff, 0xff,
+  0x3e, 0x84, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0x60, 0x82, 0xff, 0x01, 0xcf, 0x01, 0x83, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x83, 0x00, 0x03, 0x82, 0x88, 0x46,
+  0x03, 0x85, 0x00, 0x00, 0x50, 0x83, 0xff, 0x00, 0x9f, 0x84, 0x00, 0x00,
+  0xa1, 0x83, 0xff, 0x02, 0x2a, 0x00, 0xc0, 0x85, 0xff, 0x00, 0x2f, 0x82,
+  0x00, 0x00, 0x10, 0x82, 0x00, 0x00, 0x10, 0x84, 0xff, 0x00, 0xbf, 0x84,
+  0x00, 0x82, 0xff, 0x00, 0xef, 0x85, 0x00, 0x05, 0xc7, 0xfe, 0xcf, 0x17,
+  0x00, 0xe1, 0x82, 0xff, 0x00, 0x09, 0x83, 0x00, 0x01, 0x20, 0xfa, 0x82,
+  0xff, 0x03, 0xae, 0x02, 0x10, 0xfd, 0x8a, 0xff, 0x03, 0x08, 0x00, 0x60,
+  0xfd, 0x82, 0xff, 0x00, 0x6f, 0x84, 0x00, 0x02, 0xfb, 0xff, 0xef, 0x84,
+  0x00, 0x01, 0x80, 0xfe, 0x82, 0xff, 0x02, 0x5b, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0x07, 0x83, 0x00, 0x06, 0x60, 0xfe, 0xbf, 0x75, 0xff, 0xff, 0xdf,
+  0x84, 0x00, 0x03, 0xf7, 0xff, 0xdf, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x07, 0x84, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x1c, 0x84, 0x00,
+  0x00, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x8d, 0x00,
+  0x00, 0xf2, 0x84, 0xff, 0x00, 0x02, 0x84, 0x00, 0x07, 0x62, 0xb8, 0x8b,
+  0x15, 0x00, 0x00, 0x20, 0xfe, 0x84, 0xff, 0x00, 0x6f, 0x86, 0x00, 0x00,
+  0x60, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x83, 0xff, 0x00, 0x08, 0x89,
+  0x00, 0x00, 0x50, 0x82, 0xff, 0x00, 0x0e, 0x84, 0x00, 0x07, 0x30, 0x87,
+  0xac, 0x58, 0x01, 0x00, 0x00, 0xf3, 0x89, 0xff, 0x00, 0x9f, 0x82, 0x00,
+  0x04, 0x30, 0x86, 0xcc, 0xac, 0x04, 0x84, 0x00, 0x03, 0xfe, 0xff, 0xff,
+  0x07, 0x84, 0x00, 0x03, 0x51, 0xa8, 0x8b, 0x26, 0x82, 0x00, 0x00, 0xfc,
+  0x83, 0xff, 0x00, 0x0b, 0x86, 0x00, 0x03, 0x10, 0xfe, 0xff, 0xff, 0x84,
+  0x00, 0x02, 0x40, 0x88, 0x05, 0x85, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00,
+  0x07, 0x84, 0x00, 0x02, 0x10, 0xa6, 0x48, 0x85, 0x00, 0x00, 0xfd, 0xff,
+  0xff, 0xff, 0xff, 0xa7, 0xff, 0x00, 0x03, 0x8c, 0x00, 0x01, 0x20, 0xfe,
+  0x84, 0xff, 0x00, 0x0c, 0x8b, 0x00, 0x00, 0xf6, 0x84, 0xff, 0x00, 0xcf,
+  0x86, 0x00, 0x00, 0xc0, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x83, 0xff,
+  0x00, 0x3f, 0x8a, 0x00, 0x03, 0xf9, 0xff, 0xff, 0xbf, 0x8b, 0x00, 0x00,
+  0x70, 0x89, 0xff, 0x00, 0x0a, 0x8b, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00,
+  0x2e, 0x8b, 0x00, 0x00, 0xe2, 0x83, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x03,
+  0xf7, 0xff, 0xff, 0x01, 0x8c, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x07,
+  0x8c, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff, 0x00, 0x03,
+  0x8c, 0x00, 0x00, 0xe6, 0x85, 0xff, 0x00, 0x8f, 0x8b, 0x00, 0x00, 0xa0,
+  0x85, 0xff, 0x00, 0x01, 0x85, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x00, 0xbf,
+  0x84, 0x00, 0x83, 0xff, 0x00, 0xdf, 0x8a, 0x00, 0x00, 0xd1, 0x82, 0xff,
+  0x00, 0x07, 0x8b, 0x00, 0x00, 0xfb, 0x87, 0xff, 0x01, 0xcf, 0x01, 0x8b,
+  0x00, 0x00, 0xf1, 0x82, 0xff, 0x00, 0xcf, 0x8b, 0x00, 0x00, 0x50, 0x83,
+  0xff, 0x00, 0x6f, 0x87, 0x00, 0x03, 0xe1, 0xff, 0xff, 0x07, 0x8c, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x8c, 0x00, 0x00, 0xd0, 0xff, 0xff,
+  0xff, 0xff, 0xa8, 0xff, 0x00, 0x03, 0x8b, 0x00, 0x00, 0xb1, 0x87, 0xff,
+  0x00, 0x05, 0x8a, 0x00, 0x00, 0x40, 0x85, 0xff, 0x00, 0x06, 0x85, 0x00,
+  0x00, 0xf5, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x84, 0xff, 0x00, 0x0a,
+  0x89, 0x00, 0x00, 0x40, 0x82, 0xff, 0x00, 0x5f, 0x8b, 0x00, 0x00, 0xf5,
+  0x87, 0xff, 0x01, 0xdf, 0x02, 0x8b, 0x00, 0x00, 0xfc, 0x83, 0xff, 0x00,
+  0x0a, 0x8a, 0x00, 0x01, 0x10, 0xfe, 0x82, 0xff, 0x00, 0xdf, 0x87, 0x00,
+  0x03, 0x70, 0xff, 0xff, 0x0e, 0x87, 0x00, 0x00, 0x74, 0x83, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x00, 0x07, 0x8c, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0xff, 0xa8, 0xff, 0x00, 0x03, 0x8a, 0x00, 0x01, 0x81, 0xfe, 0x87, 0xff,
+  0x00, 0x9f, 0x8a, 0x00, 0x00, 0xf8, 0x85, 0xff, 0x00, 0x0c, 0x85, 0x00,
+  0x00, 0xfa, 0x84, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x84, 0xff, 0x01, 0xcf,
+  0x02, 0x88, 0x00, 0x01, 0x60, 0xfe, 0x82, 0xff, 0x00, 0x06, 0x89, 0x00,
+  0x00, 0xa0, 0x89, 0xff, 0x00, 0x6f, 0x8a, 0x00, 0x00, 0xc0, 0x84, 0xff,
+  0x00, 0xcf, 0x8a, 0x00, 0x00, 0xe6, 0x84, 0xff, 0x00, 0x0a, 0x86, 0x00,
+  0x03, 0x10, 0xfe, 0xff, 0x8f, 0x86, 0x00, 0x01, 0x20, 0x7e, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x8b, 0x00, 0x00, 0x90, 0xff, 0xff,
+  0xff, 0xff, 0xa9, 0xff, 0x00, 0x03, 0x89, 0x00, 0x00, 0xb4, 0x8a, 0xff,
+  0x00, 0x1a, 0x88, 0x00, 0x00, 0xd5, 0x86, 0xff, 0x00, 0x1f, 0x85, 0x00,
+  0x85, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x85, 0xff, 0x00, 0x5e, 0x87, 0x00,
+  0x01, 0x10, 0xfb, 0x83, 0xff, 0x01, 0xaf, 0x01, 0x87, 0x00, 0x01, 0x50,
+  0xfe, 0x8a, 0xff, 0x00, 0x3b, 0x88, 0x00, 0x01, 0x70, 0xfe, 0x85, 0xff,
+  0x00, 0x4d, 0x88, 0x00, 0x00, 0xb2, 0x85, 0xff, 0x00, 0x9f, 0x87, 0x00,
+  0x03, 0xfc, 0xff, 0xff, 0x03, 0x85, 0x00, 0x01, 0xe4, 0xaf, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0x93, 0x86, 0x00,
+  0x00, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xa9, 0xff, 0x00, 0x03, 0x85, 0x00,
+  0x03, 0x20, 0x33, 0x95, 0xfc, 0x8c, 0xff, 0x00, 0x19, 0x86, 0x00, 0x00,
+  0xd5, 0x87, 0xff, 0x00, 0x6f, 0x84, 0x00, 0x00, 0x50, 0x85, 0xff, 0x00,
+  0xbf, 0x84, 0x00, 0x86, 0xff, 0x00, 0x5c, 0x85, 0x00, 0x01, 0x20, 0xf9,
+  0x85, 0xff, 0x01, 0x9f, 0x01, 0x85, 0x00, 0x01, 0x70, 0xfd, 0x8c, 0xff,
+  0x00, 0x5d, 0x86, 0x00, 0x01, 0x50, 0xfd, 0x87, 0xff, 0x00, 0x3b, 0x86,
+  0x00, 0x00, 0xb3, 0x87, 0xff, 0x00, 0x2b, 0x85, 0x00, 0x00, 0xe7, 0x82,
+  0xff, 0x00, 0x6f, 0x84, 0x00, 0x02, 0x91, 0xff, 0xbf, 0x83, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x00, 0x07, 0x83, 0x00, 0x01, 0xf3, 0x3b, 0x84, 0x00,
+  0x00, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0x06, 0x8d, 0x34, 0x00,
+  0x00, 0x10, 0x73, 0xfb, 0xa3, 0xff, 0x06, 0x9f, 0x36, 0x02, 0x00, 0x10,
+  0x84, 0xfc, 0x87, 0xff, 0x06, 0xcf, 0x48, 0x03, 0x00, 0x00, 0x32, 0xc7,
+  0x8f, 0xff, 0x06, 0xcf, 0x37, 0x03, 0x00, 0x00, 0x32, 0xc7, 0x8a, 0xff,
+  0x01, 0xae, 0x35, 0x82, 0x00, 0x01, 0x63, 0xea, 0x89, 0xff, 0x05, 0x6a,
+  0x02, 0x00, 0x00, 0x63, 0xfa, 0x84, 0xff, 0x04, 0x6d, 0x02, 0x00, 0x20,
+  0xa5, 0x8a, 0xff, 0x00, 0x07, 0x83, 0x00, 0x06, 0xf3, 0xff, 0x6a, 0x01,
+  0x00, 0x31, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00,
+  0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9,
+  0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x00, 0x07, 0x83,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0x05,
+  0x07, 0x10, 0x43, 0x77, 0xba, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xd9, 0xff, 0x00, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x94, 0xff, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33,
+  0xa3, 0x33, 0xbb, 0xff, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xa3, 0x33,
+  0xbb, 0xff, 0xff, 0x33, 0xff, 0x33, 0xff, 0x33, 0xa3, 0x33, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x01, 0xce,
+  0xfe, 0x93, 0xff, 0x00, 0xcd, 0xb9, 0xff, 0x01, 0xce, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x8a, 0xff, 0x03, 0x4f, 0x02, 0x00, 0xfb, 0x91,
+  0xff, 0x02, 0x4c, 0x01, 0x00, 0xb7, 0xff, 0x03, 0x4f, 0x02, 0x00, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xe6, 0xff, 0x03, 0x9f, 0x88, 0x88, 0xfd, 0x8b,
+  0xff, 0x09, 0xef, 0xcc, 0xcc, 0xfc, 0xff, 0xff, 0xef, 0xcc, 0xcc, 0xfc,
+  0x89, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02, 0x0b, 0x00,
+  0x00, 0xb7, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff,
+  0xe5, 0xff, 0x04, 0xbf, 0x02, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x09, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x89, 0xff, 0x03,
+  0x0f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02, 0x0b, 0x00, 0x00, 0xb7, 0xff,
+  0x03, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x01,
+  0xdf, 0x05, 0x82, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x09, 0xbf, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x89, 0xff, 0x03, 0x0f, 0x00,
+  0x00, 0xfb, 0x91, 0xff, 0x02, 0x0b, 0x00, 0x00, 0xb7, 0xff, 0x03, 0x0f,
+  0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0x00, 0x18, 0x83,
+  0x00, 0x00, 0xfb, 0x8b, 0xff, 0x09, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0xbf, 0x00, 0x00, 0xf0, 0x89, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0x91,
+  0xff, 0x02, 0x0b, 0x00, 0x00, 0xb7, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0x00, 0x2c, 0x84, 0x00, 0x00, 0xfb,
+  0x8b, 0xff, 0x09, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00,
+  0xf0, 0x89, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02, 0x0b,
+  0x00, 0x00, 0xb7, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xe3, 0xff, 0x06, 0x0c, 0x00, 0x00, 0x13, 0x00, 0x00, 0xfb, 0x8b,
+  0xff, 0x09, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x08, 0xad, 0xa8, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb,
+  0x82, 0xff, 0x03, 0xdf, 0x8c, 0xc9, 0xfd, 0x85, 0xff, 0x07, 0xbc, 0x88,
+  0xda, 0xff, 0xff, 0x0b, 0x00, 0x00, 0x93, 0xff, 0x03, 0xcf, 0x8c, 0xc9,
+  0xfe, 0x8f, 0xff, 0x02, 0xcf, 0x88, 0xfd, 0x86, 0xff, 0x02, 0xef, 0x8a,
+  0xdb, 0x82, 0xff, 0x06, 0x0f, 0x00, 0x00, 0xfb, 0xcf, 0x98, 0xfc, 0x84,
+  0xff, 0x02, 0xcc, 0x98, 0xec, 0x87, 0xff, 0x02, 0x8c, 0xc8, 0xfe, 0x83,
+  0xff, 0x02, 0xcf, 0x8b, 0xca, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x06,
+  0x7f, 0x00, 0x90, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x1f, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0xb0,
+  0x5e, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff,
+  0xbf, 0x04, 0x00, 0x00, 0x10, 0xfa, 0x83, 0xff, 0x00, 0x29, 0x82, 0x00,
+  0x0a, 0xb4, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x00, 0x00, 0xfd,
+  0x82, 0xff, 0x21, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf5,
+  0xff, 0xaf, 0x04, 0x00, 0x00, 0x20, 0xfb, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xef, 0x05, 0x00,
+  0xf9, 0x83, 0xff, 0x10, 0x00, 0x00, 0xe7, 0x06, 0x00, 0x00, 0xe3, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0xab, 0x01, 0x00, 0x30, 0xfc, 0x82, 0xff, 0x00,
+  0x3a, 0x82, 0x00, 0x00, 0xb2, 0x82, 0xff, 0x06, 0x03, 0x00, 0xf3, 0x1a,
+  0x00, 0x00, 0xa1, 0x82, 0xff, 0x05, 0xaf, 0x03, 0x00, 0x00, 0x70, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xc5, 0xff, 0x05, 0x62, 0xfe, 0x3f, 0x00, 0x00,
+  0xfb, 0x8b, 0xff, 0x0e, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0x0b, 0x00, 0x60, 0x03, 0x82, 0x00, 0x08, 0xf5, 0xff,
+  0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x09, 0x83, 0x00, 0x04, 0x40, 0xfe,
+  0xff, 0xff, 0x6f, 0x84, 0x00, 0x08, 0xf8, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x03, 0x00, 0xa0, 0x83, 0xff, 0x0a, 0x05, 0x00, 0x70, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xfa, 0xff, 0x07, 0x83, 0x00, 0x12, 0x70, 0xfe, 0xff, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0x6b,
+  0x00, 0x00, 0xfb, 0x83, 0xff, 0x02, 0x00, 0x00, 0x33, 0x82, 0x00, 0x06,
+  0x20, 0xfc, 0xff, 0x0f, 0x00, 0x00, 0x05, 0x82, 0x00, 0x03, 0xe2, 0xff,
+  0xff, 0x6f, 0x84, 0x00, 0x05, 0xe7, 0xff, 0xff, 0x03, 0x00, 0x90, 0x82,
+  0x00, 0x04, 0x10, 0xfd, 0xff, 0xff, 0x08, 0x83, 0x00, 0x00, 0xc2, 0xff,
+  0xff, 0xff, 0xff, 0xc7, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff,
+  0x0b, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff,
+  0x0b, 0x85, 0x00, 0x07, 0xc0, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x9f,
+  0x85, 0x00, 0x03, 0xf4, 0xff, 0xff, 0x06, 0x84, 0x00, 0x08, 0xfe, 0x0b,
+  0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x09, 0x09, 0x00,
+  0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x7f, 0x85, 0x00, 0x10, 0xf7,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00,
+  0x00, 0x07, 0x00, 0x00, 0x84, 0xff, 0x86, 0x00, 0x02, 0xf4, 0xff, 0x0f,
+  0x85, 0x00, 0x03, 0x80, 0xff, 0xff, 0x06, 0x84, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0x03, 0x85, 0x00, 0x08, 0xf6, 0xff, 0x8f, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x20, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xff, 0x03, 0x3f, 0x00, 0x00,
+  0xfb, 0x8b, 0xff, 0x31, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00, 0x30, 0x9a, 0x00, 0x00, 0xa0, 0xff,
+  0x0f, 0x00, 0x00, 0xfb, 0xff, 0x1d, 0x00, 0x00, 0x92, 0x4a, 0x00, 0x00,
+  0xb0, 0xff, 0xbf, 0x00, 0x00, 0x20, 0x98, 0x07, 0xb0, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0x0c, 0x00, 0x00, 0xfe, 0x83, 0xff, 0x20, 0x0e, 0x00, 0x00,
+  0xff, 0xff, 0x0b, 0x00, 0x40, 0xff, 0x0d, 0x00, 0x00, 0xa4, 0x4a, 0x00,
+  0x00, 0xd1, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0x01, 0x00, 0x10, 0x84, 0xff, 0x82, 0x00, 0x29, 0xb4,
+  0x2a, 0x00, 0x00, 0xd0, 0xff, 0x0f, 0x00, 0x00, 0x10, 0xa9, 0x02, 0x00,
+  0x50, 0xff, 0xbf, 0x00, 0x00, 0x40, 0xaa, 0x04, 0x00, 0x10, 0xfd, 0xff,
+  0x03, 0x00, 0x00, 0x70, 0x3b, 0x00, 0x00, 0xf3, 0xff, 0x1d, 0x00, 0x00,
+  0xfc, 0x9f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x30, 0xbf, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00, 0xf5, 0xff, 0x03,
+  0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x08, 0x00, 0x10, 0xfe,
+  0xff, 0x04, 0x00, 0x20, 0xff, 0x4f, 0x00, 0x00, 0xe2, 0xff, 0xef, 0xfa,
+  0xff, 0x0b, 0x00, 0x00, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x1b, 0x4f,
+  0x00, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x90, 0xff, 0x06, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x00, 0x50, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x7f, 0x82, 0x00, 0x01, 0x70, 0x97, 0x84, 0xff, 0x2c, 0x00,
+  0x00, 0x50, 0xff, 0xef, 0x00, 0x00, 0x80, 0xff, 0x0f, 0x00, 0x00, 0xe1,
+  0xff, 0x08, 0x00, 0x30, 0xff, 0x4f, 0x00, 0x00, 0xf3, 0xff, 0x3f, 0x00,
+  0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0xfc, 0xbf, 0x00, 0x00, 0xf2, 0xff,
+  0x08, 0x00, 0x70, 0xff, 0xff, 0x02, 0x00, 0xf1, 0xff, 0xff, 0xff, 0xff,
+  0xc6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x25, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00,
+  0xfe, 0xff, 0x06, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x03,
+  0x00, 0x80, 0xff, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x0e, 0x00, 0x00, 0xfa,
+  0x83, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x7f, 0x00, 0x00, 0xf6, 0x84, 0xff,
+  0x1f, 0x8f, 0x00, 0x00, 0xf8, 0xff, 0x03, 0x00, 0xe0, 0xff, 0x02, 0x00,
+  0x90, 0xff, 0xff, 0x09, 0x00, 0x20, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0x10, 0xfe, 0x85, 0xff, 0x2c,
+  0x00, 0x00, 0xe0, 0xff, 0xff, 0x05, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00,
+  0xfa, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0e, 0x00, 0x00, 0xf9, 0xff, 0x9f,
+  0x00, 0x00, 0xf2, 0xff, 0x03, 0x00, 0xa0, 0xff, 0xef, 0x00, 0x00, 0xf0,
+  0xff, 0x03, 0x00, 0xd0, 0xff, 0xff, 0x07, 0x00, 0xb0, 0xff, 0xff, 0xff,
+  0xff, 0xc6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x24, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x0b, 0x00, 0x00,
+  0x84, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x0c, 0x00, 0x10, 0xfe, 0x84, 0xff,
+  0x1e, 0xdf, 0x00, 0x00, 0xf4, 0xff, 0x01, 0x00, 0xf4, 0xef, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0x90, 0x86, 0xff, 0x2c, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xfb,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x00,
+  0x00, 0xf0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff,
+  0xc6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x24, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xef, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xfa, 0x08, 0x00, 0x00, 0x84,
+  0xff, 0x05, 0x0b, 0x00, 0x00, 0x03, 0x00, 0x90, 0x86, 0xff, 0x1d, 0x02,
+  0x00, 0xf2, 0xcf, 0x00, 0x00, 0xf9, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0x7f, 0x00, 0x00, 0xf0, 0x86, 0xff, 0x14, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x09, 0x00, 0x10, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0x0b, 0x00, 0x00, 0x82, 0xff, 0x0c, 0x00, 0x00, 0xc0, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xef, 0x86, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb,
+  0x8b, 0xff, 0x24, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x00, 0x00,
+  0xf0, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x0f,
+  0x00, 0x00, 0xfb, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0x07, 0x00, 0x30, 0x84, 0xff, 0x05, 0x0b, 0x00, 0x00, 0x06, 0x00,
+  0x40, 0x86, 0xff, 0x1d, 0x07, 0x00, 0xd0, 0x8f, 0x00, 0x00, 0xfd, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00,
+  0xfb, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff,
+  0x14, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00,
+  0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x09, 0x00, 0x00, 0x82, 0xff,
+  0x0c, 0x00, 0x00, 0xb0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0xbf, 0x86, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x24, 0xbf, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x1f, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x20, 0x84, 0xff, 0x06,
+  0x0b, 0x00, 0x00, 0x0e, 0x00, 0x00, 0xf9, 0x85, 0xff, 0x1d, 0x0c, 0x00,
+  0xa0, 0x4f, 0x00, 0x20, 0xff, 0xcf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff, 0x14, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0x09, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0x0b, 0x00, 0x00, 0x82, 0xff, 0x0c, 0x00, 0x00, 0xb0, 0xff, 0x03,
+  0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x86, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x06, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0xec, 0x89, 0xff, 0x23, 0x00, 0x00, 0xd0, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0x0f, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0f, 0x00,
+  0x00, 0xfb, 0x0b, 0x00, 0x00, 0x84, 0xff, 0x06, 0x0b, 0x00, 0x00, 0x7f,
+  0x00, 0x00, 0xe1, 0x85, 0xff, 0x1d, 0x1f, 0x00, 0x60, 0x1f, 0x00, 0x80,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3,
+  0x86, 0xff, 0x27, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff,
+  0x0f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0e, 0x00, 0x00,
+  0xff, 0xff, 0xcf, 0x00, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xcb,
+  0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x1b, 0x00, 0xf8, 0x88, 0xff,
+  0x24, 0x01, 0x00, 0xa0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf1, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb,
+  0xff, 0x03, 0x00, 0x80, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xfd, 0x0d, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x06, 0x0b, 0x00, 0x00, 0xff, 0x01, 0x00, 0x60,
+  0x85, 0xff, 0x1d, 0x5f, 0x00, 0x30, 0x0d, 0x00, 0xd0, 0xff, 0xff, 0x01,
+  0x00, 0xa0, 0xff, 0xff, 0x09, 0x00, 0x10, 0xff, 0x3f, 0x00, 0x00, 0xfb,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff, 0x27,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0x04, 0x00, 0x50, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x9f,
+  0x00, 0x00, 0xf1, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x03, 0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0x07, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xa0, 0x88, 0xff, 0x30, 0x03, 0x00,
+  0x40, 0xfe, 0xff, 0x1d, 0x00, 0x00, 0xf6, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00,
+  0x30, 0xff, 0xff, 0x05, 0x00, 0x20, 0xff, 0x2f, 0x00, 0x00, 0xe3, 0xff,
+  0xdf, 0xfa, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x09, 0x00, 0x00, 0xfd, 0x84,
+  0xff, 0x1d, 0xaf, 0x00, 0x00, 0x09, 0x00, 0xf2, 0xff, 0xff, 0x05, 0x00,
+  0x50, 0xff, 0xff, 0x04, 0x00, 0x60, 0xff, 0x3f, 0x00, 0x00, 0xfa, 0xef,
+  0x01, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff, 0x27, 0x00,
+  0x00, 0x90, 0xff, 0xcf, 0x00, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00, 0xfb,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0x4f, 0x00, 0x00, 0xf5, 0xff, 0x4f, 0x00,
+  0x00, 0xf6, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0x07, 0x00, 0x30, 0x82, 0xff, 0x00, 0xea, 0xff, 0xff, 0xff, 0xff, 0xc7,
+  0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xcf, 0x00, 0x00, 0x70, 0x88, 0xff,
+  0x30, 0x0b, 0x00, 0x00, 0x82, 0x78, 0x01, 0x00, 0x00, 0xfd, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x3f, 0x00, 0x00, 0x84,
+  0xff, 0x0e, 0x00, 0x00, 0xb4, 0x5b, 0x00, 0x00, 0xa0, 0xff, 0xaf, 0x00,
+  0x00, 0x10, 0x86, 0x16, 0xc0, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x2f, 0x00,
+  0x00, 0xf4, 0x85, 0xff, 0x1c, 0x00, 0x00, 0x02, 0x00, 0xf6, 0xff, 0xff,
+  0x0d, 0x00, 0x00, 0xb5, 0x5b, 0x00, 0x00, 0xd0, 0xff, 0x5f, 0x00, 0x00,
+  0xc3, 0x29, 0x00, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff,
+  0x82, 0x00, 0x28, 0xc7, 0x1a, 0x00, 0x00, 0xe0, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xdf, 0x00, 0x00, 0x50, 0xbb, 0x05,
+  0x00, 0x00, 0xfd, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x1e, 0x00, 0x00, 0xb3, 0xcc, 0x2a, 0x40, 0xff, 0xff, 0xff, 0xff,
+  0xc7, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0x80, 0x88,
+  0xff, 0x00, 0x6f, 0x85, 0x00, 0x0c, 0x70, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x5f, 0x82, 0x00, 0x01, 0xfc, 0x9f,
+  0x85, 0x00, 0x03, 0xf5, 0xff, 0xff, 0x05, 0x83, 0x00, 0x09, 0x20, 0xfe,
+  0x0b, 0x00, 0x00, 0xff, 0xbf, 0x00, 0x00, 0xa0, 0x85, 0xff, 0x00, 0x04,
+  0x82, 0x00, 0x03, 0xfc, 0xff, 0xff, 0x7f, 0x85, 0x00, 0x02, 0xf7, 0xff,
+  0x8f, 0x85, 0x00, 0x05, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff,
+  0x86, 0x00, 0x0c, 0xf9, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x07, 0x84, 0x00, 0x0c, 0x70, 0xff, 0xff, 0x03, 0x00,
+  0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x9f, 0x85, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x08, 0x00, 0xf2, 0x88, 0xff, 0x01, 0xef, 0x04, 0x84, 0x00, 0x0c, 0xf6,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xdf,
+  0x82, 0x00, 0x02, 0xf7, 0xff, 0x07, 0x83, 0x00, 0x04, 0x50, 0xfe, 0xff,
+  0xff, 0x5e, 0x84, 0x00, 0x09, 0xf9, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03,
+  0x00, 0x20, 0xfe, 0x84, 0xff, 0x03, 0x09, 0x00, 0x00, 0x10, 0x82, 0xff,
+  0x01, 0xef, 0x06, 0x83, 0x00, 0x04, 0x70, 0xff, 0xff, 0xef, 0x01, 0x82,
+  0x00, 0x07, 0x09, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff,
+  0x85, 0x00, 0x0d, 0x50, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x6e, 0x84, 0x00, 0x0d, 0xf7, 0xff, 0xff, 0x03,
+  0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x08, 0x84, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xff, 0x01, 0xcf, 0xa7, 0x8a,
+  0xff, 0x01, 0xbf, 0x01, 0x82, 0x00, 0x00, 0xb4, 0x82, 0xff, 0x14, 0x0b,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x0a, 0x00, 0x00,
+  0xf3, 0xff, 0xcf, 0x02, 0x00, 0x00, 0x10, 0xf9, 0x83, 0xff, 0x00, 0x18,
+  0x82, 0x00, 0x0a, 0xd3, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x0c, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x03, 0x0e, 0x00, 0x00, 0x60, 0x83, 0xff, 0x05,
+  0xbf, 0x01, 0x00, 0x00, 0x30, 0xfa, 0x82, 0xff, 0x0b, 0x2c, 0x00, 0x00,
+  0xb0, 0x3f, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x86, 0xff, 0x10,
+  0x00, 0x00, 0xd0, 0x03, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0xff, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x00, 0x1b, 0x82, 0x00, 0x00,
+  0xa3, 0x82, 0xff, 0x0b, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xdf, 0x03, 0x82, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xff, 0xff,
+  0xda, 0xff, 0x03, 0xef, 0x9b, 0x87, 0xeb, 0x8d, 0xff, 0x03, 0xef, 0x7b,
+  0x97, 0xfd, 0x82, 0xff, 0x02, 0x8b, 0xa7, 0xfc, 0x85, 0xff, 0x02, 0xac,
+  0x87, 0xeb, 0x90, 0xff, 0x02, 0x07, 0x00, 0xd0, 0x84, 0xff, 0x03, 0xef,
+  0x8b, 0xb7, 0xfd, 0x83, 0xff, 0x02, 0xef, 0x8b, 0xd9, 0x8f, 0xff, 0x05,
+  0x00, 0x00, 0xf0, 0xcf, 0x79, 0xeb, 0x8e, 0xff, 0x02, 0xbe, 0x78, 0xdb,
+  0x8f, 0xff, 0x02, 0x9b, 0xb7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x90, 0xff, 0x03, 0xcf, 0x01, 0x00, 0xf3, 0x9f, 0xff, 0x02, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xff, 0x03, 0x1a, 0x00,
+  0x00, 0xfb, 0x9f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xb6, 0xff, 0x04, 0x9f, 0x25, 0x00, 0x00, 0x50, 0xa0, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff,
+  0x00, 0x7f, 0x82, 0x00, 0x00, 0xf5, 0xa0, 0xff, 0x02, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xff, 0x03, 0x9f, 0x00, 0x00,
+  0x91, 0xa1, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xb6, 0xff, 0x02, 0xbf, 0x20, 0x84, 0xa2, 0xff, 0x02, 0x00, 0x32,
+  0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x02, 0x3b, 0x30, 0xfc, 0x8a,
+  0xff, 0x02, 0x29, 0x61, 0xfe, 0xb7, 0xff, 0x02, 0x5c, 0x30, 0xfb, 0x88,
+  0xff, 0x02, 0x9f, 0x12, 0xe6, 0xff, 0xff, 0xff, 0xff, 0x93, 0xff, 0x01,
+  0xcf, 0xfd, 0xc0, 0xff, 0x01, 0xcf, 0xfc, 0xa5, 0xff, 0x01, 0xcf, 0xfc,
+  0x85, 0xff, 0x03, 0xdf, 0x01, 0x00, 0xd1, 0x89, 0xff, 0x03, 0x9f, 0x00,
+  0x00, 0xf4, 0x95, 0xff, 0x01, 0xcf, 0xfd, 0x9e, 0xff, 0x03, 0xef, 0x01,
+  0x00, 0xc1, 0x88, 0xff, 0x02, 0x09, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff,
+  0x91, 0xff, 0x03, 0x6f, 0x03, 0x00, 0xf7, 0xc0, 0xff, 0x03, 0x3f, 0x00,
+  0x41, 0xfc, 0xa3, 0xff, 0x03, 0x3f, 0x00, 0x41, 0xfc, 0x83, 0xff, 0x03,
+  0x8f, 0x00, 0x00, 0x80, 0x89, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xd0, 0x93,
+  0xff, 0x03, 0x6f, 0x03, 0x00, 0xf7, 0x9e, 0xff, 0x03, 0xaf, 0x00, 0x00,
+  0x70, 0x88, 0xff, 0x03, 0x03, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xd1, 0xff,
+  0x04, 0xdf, 0x27, 0x00, 0x10, 0xb6, 0x8e, 0xff, 0x04, 0xef, 0x8a, 0x45,
+  0x87, 0xfb, 0xa5, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x94, 0xff, 0x03,
+  0x9d, 0x58, 0x84, 0xc9, 0x83, 0xff, 0x00, 0xcf, 0x82, 0xcc, 0x00, 0xec,
+  0x9e, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xa3, 0xff, 0x03, 0x3f, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x03, 0x8f, 0x00, 0x00, 0x90, 0x89, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xe0, 0x93, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x90,
+  0xff, 0x13, 0xcf, 0xcc, 0xcc, 0xfd, 0xff, 0xef, 0xcc, 0xcc, 0xec, 0xff,
+  0xff, 0xce, 0xcc, 0xcc, 0xbf, 0x00, 0x00, 0x70, 0xff, 0xcf, 0x85, 0xcc,
+  0x04, 0xfd, 0x03, 0x00, 0x00, 0xfe, 0xff, 0xff, 0xd1, 0xff, 0x00, 0x08,
+  0x83, 0x00, 0x00, 0xe6, 0x8c, 0xff, 0x01, 0xef, 0x07, 0x82, 0x00, 0x01,
+  0x10, 0xe8, 0xa0, 0xff, 0x07, 0xef, 0xfd, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0x93, 0xff, 0x00, 0x6c, 0x83, 0x00, 0x00, 0xb3, 0x82, 0xff, 0x00,
+  0x3f, 0x83, 0x00, 0x01, 0x20, 0xb5, 0x9c, 0xff, 0x03, 0x3f, 0x00, 0x00,
+  0xfb, 0xa3, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x03, 0xef,
+  0x00, 0x00, 0xe1, 0x89, 0xff, 0x03, 0xaf, 0x00, 0x00, 0xf4, 0x8f, 0xff,
+  0x07, 0xef, 0xfd, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x90, 0xff, 0x13,
+  0x6f, 0x00, 0x00, 0xf6, 0xff, 0xaf, 0x00, 0x00, 0x80, 0xff, 0xff, 0x0b,
+  0x00, 0x40, 0xef, 0x01, 0x00, 0xd0, 0xff, 0x3f, 0x85, 0x00, 0x03, 0xfb,
+  0x0a, 0x00, 0x30, 0xff, 0xff, 0xd1, 0xff, 0x00, 0x5f, 0x84, 0x00, 0x00,
+  0x40, 0x8c, 0xff, 0x00, 0x1c, 0x84, 0x00, 0x01, 0x10, 0xfc, 0x9d, 0xff,
+  0x09, 0x9f, 0x14, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x92,
+  0xff, 0x01, 0xbf, 0x01, 0x84, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x3f, 0x85,
+  0x00, 0x00, 0xb2, 0x9b, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xa3, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x02, 0x5d, 0x53, 0xfd, 0x8a,
+  0xff, 0x01, 0x3a, 0x73, 0x8e, 0xff, 0x09, 0x9f, 0x14, 0x00, 0xf7, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0x90, 0xff, 0x13, 0x8f, 0x00, 0x00, 0xf3,
+  0xff, 0x7f, 0x00, 0x00, 0x60, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x5d,
+  0x53, 0xfd, 0xff, 0x3f, 0x85, 0x00, 0x03, 0xfc, 0xaf, 0x34, 0xe7, 0xff,
+  0xff, 0xd1, 0xff, 0x03, 0x07, 0x00, 0x00, 0x11, 0x82, 0x00, 0x00, 0xf9,
+  0x8b, 0xff, 0x00, 0x02, 0x85, 0x00, 0x00, 0xf5, 0x9d, 0xff, 0x09, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x92, 0xff, 0x00,
+  0x0a, 0x85, 0x00, 0x03, 0x70, 0xff, 0xff, 0x3f, 0x85, 0x00, 0x01, 0x10,
+  0xfd, 0x9a, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xa3, 0xff, 0x03, 0x3f,
+  0x00, 0x00, 0xfb, 0xa3, 0xff, 0x09, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0x90, 0xff, 0x0d, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0x4f, 0x00, 0x00, 0x30, 0xff, 0xff, 0x06, 0x00, 0xa0, 0x84, 0xff, 0x00,
+  0x3f, 0x85, 0x00, 0xff, 0xff, 0xd5, 0xff, 0x07, 0x4e, 0x00, 0xd3, 0xff,
+  0x1d, 0x00, 0x00, 0xf2, 0x8a, 0xff, 0x07, 0x9f, 0x00, 0x00, 0x40, 0xdb,
+  0x7b, 0x03, 0x30, 0x9e, 0xff, 0x09, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0x91, 0xff, 0x05, 0xef, 0x02, 0x00, 0x00, 0xb8,
+  0x8b, 0x82, 0x00, 0x0a, 0xfb, 0xff, 0x3f, 0x00, 0x00, 0x73, 0x57, 0x01,
+  0x00, 0x00, 0xf3, 0x9a, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xa3, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xfb, 0xa3, 0xff, 0x09, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x90, 0xff, 0x0d, 0xef, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x00, 0x00, 0x20, 0xff, 0xff, 0x03, 0x00, 0xc0, 0x84,
+  0xff, 0x03, 0x3f, 0x00, 0x00, 0x73, 0x82, 0x77, 0xff, 0xff, 0xd6, 0xff,
+  0x06, 0x58, 0xff, 0xff, 0xaf, 0x00, 0x00, 0xf0, 0x8a, 0xff, 0x07, 0x5f,
+  0x00, 0x00, 0xf2, 0xff, 0xff, 0x8f, 0xe3, 0x83, 0xff, 0x03, 0xcf, 0x8a,
+  0xb8, 0xfe, 0x82, 0xff, 0x03, 0xce, 0x89, 0xb8, 0xec, 0x86, 0xff, 0x02,
+  0xbf, 0x98, 0xec, 0x85, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0xcf, 0x88, 0xec, 0x84, 0xff, 0x02, 0xbc, 0xa8,
+  0xfc, 0x86, 0xff, 0x13, 0x6f, 0x00, 0x00, 0xc0, 0xff, 0xff, 0x0c, 0x00,
+  0x00, 0xf3, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x5f, 0x00, 0x00, 0xd0,
+  0x86, 0xff, 0x03, 0xef, 0x9c, 0x88, 0xfc, 0x83, 0xff, 0x02, 0xcf, 0x8a,
+  0xca, 0x85, 0xff, 0x06, 0xcf, 0x99, 0xec, 0x3f, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x02, 0xce, 0x89, 0xec, 0x88, 0xff, 0x03, 0xac, 0x88, 0xca, 0xfd,
+  0x86, 0xff, 0x02, 0x9c, 0xb8, 0xfd, 0x83, 0xff, 0x06, 0xcf, 0x99, 0xec,
+  0x3f, 0x00, 0x00, 0xfb, 0x8a, 0xff, 0x03, 0xef, 0x9c, 0xc8, 0xfd, 0x8b,
+  0xff, 0x02, 0x9d, 0xb8, 0xfc, 0x85, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xcf, 0x88, 0xec, 0x84, 0xff, 0x02,
+  0xbc, 0xa8, 0xfc, 0x86, 0xff, 0x04, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x82,
+  0x00, 0x04, 0xff, 0xff, 0x02, 0x00, 0xf0, 0x84, 0xff, 0x03, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0xdc, 0xff, 0x03, 0xcf, 0x00, 0x00, 0xf0, 0x8a,
+  0xff, 0x03, 0x3f, 0x00, 0x00, 0xf4, 0x86, 0xff, 0x07, 0x8f, 0x02, 0x00,
+  0x00, 0x60, 0xfc, 0xef, 0x27, 0x82, 0x00, 0x0b, 0x10, 0xe8, 0xff, 0xff,
+  0x3f, 0x00, 0x40, 0x9f, 0x01, 0x00, 0x20, 0xfb, 0x83, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x08, 0xfa, 0x3f, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x10, 0xfa,
+  0x82, 0xff, 0x00, 0x4b, 0x82, 0x00, 0x00, 0xe6, 0x85, 0xff, 0x13, 0x1f,
+  0x00, 0x00, 0xf6, 0xff, 0xff, 0x9f, 0x00, 0x00, 0xc0, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xef, 0x00, 0x00, 0xb0, 0x85, 0xff, 0x0d, 0xef, 0x16,
+  0x00, 0x00, 0x10, 0xe8, 0xff, 0xff, 0x8e, 0x02, 0x00, 0x00, 0x40, 0xfd,
+  0x82, 0xff, 0x0e, 0xaf, 0x02, 0x00, 0x10, 0x3a, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0x6e, 0x01, 0x00, 0x00, 0xc2, 0x85, 0xff, 0x01, 0x9f, 0x03, 0x82,
+  0x00, 0x0a, 0x60, 0xfd, 0xff, 0xff, 0x07, 0x00, 0xf0, 0x3c, 0x00, 0x00,
+  0x80, 0x82, 0xff, 0x07, 0xaf, 0x02, 0x00, 0x10, 0x3a, 0x00, 0x00, 0xfb,
+  0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xcf, 0x06, 0x00, 0x00,
+  0x10, 0xf9, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0xc0,
+  0x4d, 0x00, 0x00, 0x70, 0xfe, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x08,
+  0xfa, 0x3f, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x10, 0xfa, 0x82, 0xff, 0x00,
+  0x4b, 0x82, 0x00, 0x00, 0xe6, 0x85, 0xff, 0x15, 0x03, 0x00, 0xb0, 0xff,
+  0x0c, 0x00, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xf2, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0xd5, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf0, 0x8a, 0xff, 0x03,
+  0x4f, 0x00, 0x00, 0xe1, 0x85, 0xff, 0x01, 0xef, 0x05, 0x83, 0x00, 0x01,
+  0xb0, 0xef, 0x84, 0x00, 0x06, 0x40, 0xff, 0xff, 0x3f, 0x00, 0x30, 0x06,
+  0x82, 0x00, 0x00, 0xe1, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x04, 0xfb,
+  0x3f, 0x00, 0x00, 0x03, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x9f, 0x83,
+  0x00, 0x01, 0x20, 0xfc, 0x84, 0xff, 0x13, 0x0a, 0x00, 0x00, 0xfc, 0xff,
+  0xff, 0xef, 0x00, 0x00, 0x70, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x1c, 0x83, 0x00, 0x03, 0x10, 0xff,
+  0xef, 0x03, 0x83, 0x00, 0x00, 0x91, 0x82, 0xff, 0x00, 0x09, 0x85, 0x00,
+  0x03, 0xfb, 0xff, 0xcf, 0x03, 0x83, 0x00, 0x00, 0xf8, 0x84, 0xff, 0x00,
+  0x4f, 0x84, 0x00, 0x06, 0xc0, 0xff, 0xff, 0x07, 0x00, 0x90, 0x01, 0x82,
+  0x00, 0x03, 0xfa, 0xff, 0xff, 0x09, 0x85, 0x00, 0x00, 0xfb, 0x84, 0xff,
+  0x05, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x1a, 0x83, 0x00, 0x0b, 0x40, 0xfc,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x60, 0x01, 0x82, 0x00,
+  0x00, 0xf7, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x04, 0xfb, 0x3f, 0x00,
+  0x00, 0x03, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x9f, 0x83, 0x00, 0x01,
+  0x20, 0xfc, 0x84, 0xff, 0x15, 0x05, 0x00, 0xb0, 0xff, 0x0a, 0x00, 0x07,
+  0x00, 0xf9, 0xcf, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd5,
+  0xff, 0x03, 0x7f, 0x00, 0x00, 0xf4, 0x8a, 0xff, 0x04, 0x7f, 0x00, 0x00,
+  0x10, 0xd8, 0x84, 0xff, 0x00, 0x5f, 0x84, 0x00, 0x02, 0xf2, 0xff, 0x04,
+  0x84, 0x00, 0x02, 0xf8, 0xff, 0x3f, 0x85, 0x00, 0x00, 0x80, 0x83, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x01, 0xff, 0x3f, 0x85, 0x00, 0x09, 0x40, 0xff,
+  0xff, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x02, 0x06,
+  0x00, 0x20, 0x83, 0xff, 0x0c, 0x03, 0x00, 0x30, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x00, 0x00, 0x90, 0x84, 0xff, 0x01, 0xef, 0x01, 0x83,
+  0x00, 0x02, 0x70, 0xff, 0x3f, 0x85, 0x00, 0x02, 0xfb, 0xff, 0xcf, 0x86,
+  0x00, 0x08, 0xfb, 0xff, 0x2e, 0x00, 0x00, 0x20, 0x00, 0x00, 0xb0, 0x84,
+  0xff, 0x00, 0x9f, 0x84, 0x00, 0x03, 0x30, 0xff, 0xff, 0x07, 0x85, 0x00,
+  0x02, 0xf2, 0xff, 0xbf, 0x86, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x04, 0x00,
+  0x00, 0xf0, 0xff, 0xcf, 0x85, 0x00, 0x07, 0xf3, 0xff, 0xbf, 0x00, 0x00,
+  0xf3, 0xff, 0x0b, 0x85, 0x00, 0x00, 0xf1, 0x83, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x01, 0xff, 0x3f, 0x85, 0x00, 0x09, 0x40, 0xff, 0xff, 0x0a, 0x00,
+  0x00, 0x01, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x15, 0x07, 0x00, 0x70, 0xff,
+  0x07, 0x00, 0x0d, 0x00, 0xf7, 0xbf, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0xd5, 0xff, 0x03, 0x2e, 0x00, 0x00, 0xfa, 0x8a, 0xff, 0x00,
+  0xdf, 0x83, 0x00, 0x00, 0xa5, 0x83, 0xff, 0x17, 0x0a, 0x00, 0x00, 0x84,
+  0x69, 0x00, 0xfd, 0xff, 0x29, 0x96, 0xdb, 0x2b, 0x00, 0x00, 0xf3, 0xff,
+  0x3f, 0x00, 0x00, 0x10, 0xb8, 0x02, 0x00, 0x50, 0x83, 0xff, 0x07, 0x7f,
+  0x37, 0x00, 0x00, 0x73, 0x77, 0xff, 0x3f, 0x82, 0x00, 0x0c, 0xb7, 0x03,
+  0x00, 0x30, 0xff, 0xef, 0x01, 0x00, 0xb0, 0xff, 0x09, 0x00, 0x70, 0x84,
+  0xff, 0x02, 0x03, 0x00, 0x30, 0x83, 0xff, 0x0c, 0x06, 0x00, 0x00, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0x9f, 0x00, 0x00, 0xc0, 0x84, 0xff, 0x21,
+  0x4f, 0x00, 0x00, 0x60, 0x89, 0x04, 0xf3, 0xff, 0x07, 0x00, 0x00, 0xb6,
+  0x29, 0x00, 0x00, 0xf4, 0xff, 0x4f, 0x00, 0x00, 0x90, 0xac, 0x01, 0x00,
+  0x00, 0xfb, 0xff, 0x06, 0x00, 0x50, 0xff, 0x2d, 0x00, 0x20, 0x85, 0xff,
+  0x19, 0x51, 0xb8, 0xbd, 0x07, 0x00, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x00,
+  0x60, 0x5b, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0x90, 0xac, 0x01,
+  0x00, 0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00,
+  0x00, 0x92, 0x6b, 0x00, 0x00, 0x80, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0x0b, 0x00, 0x00, 0x50, 0x8a, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x07, 0x7f,
+  0x37, 0x00, 0x00, 0x73, 0x77, 0xff, 0x3f, 0x82, 0x00, 0x0c, 0xb7, 0x03,
+  0x00, 0x30, 0xff, 0xef, 0x01, 0x00, 0xb0, 0xff, 0x09, 0x00, 0x70, 0x84,
+  0xff, 0x15, 0x0b, 0x00, 0x70, 0xff, 0x04, 0x00, 0x0f, 0x00, 0xf4, 0x7f,
+  0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7,
+  0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd5, 0xff, 0x02, 0x05,
+  0x00, 0x30, 0x8c, 0xff, 0x00, 0x09, 0x83, 0x00, 0x09, 0x71, 0xfe, 0xff,
+  0xff, 0x03, 0x00, 0x40, 0xff, 0xff, 0xad, 0x84, 0xff, 0x0c, 0xef, 0x00,
+  0x00, 0xf1, 0xff, 0x3f, 0x00, 0x00, 0xe0, 0xff, 0x0a, 0x00, 0x30, 0x84,
+  0xff, 0x16, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0,
+  0xff, 0x0b, 0x00, 0x00, 0xff, 0x9f, 0x00, 0x00, 0xf5, 0xff, 0x3f, 0x00,
+  0x10, 0x84, 0xff, 0x02, 0x03, 0x00, 0x30, 0x83, 0xff, 0x0c, 0x07, 0x00,
+  0x00, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xce, 0x18, 0x00, 0x00, 0xf3, 0x84,
+  0xff, 0x22, 0x0c, 0x00, 0x00, 0xf9, 0xff, 0xbf, 0xfd, 0xff, 0x02, 0x00,
+  0x80, 0xff, 0xef, 0x00, 0x00, 0x90, 0xff, 0x0d, 0x00, 0x00, 0xf8, 0xff,
+  0x1e, 0x00, 0x00, 0xfb, 0xef, 0x00, 0x00, 0xe0, 0xff, 0x9f, 0x00, 0x00,
+  0xf9, 0x87, 0xff, 0x16, 0x4f, 0x00, 0x00, 0xfa, 0xff, 0x07, 0x00, 0x00,
+  0xf9, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x0c, 0x00, 0x00, 0xf8, 0xff, 0x1e,
+  0x00, 0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x0a, 0x00,
+  0x00, 0xfe, 0xff, 0x08, 0x00, 0x10, 0xfe, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0x0b, 0x00, 0x00, 0xf6, 0xff, 0x02, 0x00, 0xb0, 0x84, 0xff, 0x16, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0x9f, 0x00, 0x00, 0xf5, 0xff, 0x3f, 0x00, 0x10, 0x84, 0xff,
+  0x1c, 0x0d, 0x00, 0x30, 0xff, 0x02, 0x30, 0x3f, 0x00, 0xf3, 0x6f, 0x00,
+  0x00, 0xfc, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0x84, 0x88,
+  0x88, 0xf8, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd4, 0xff, 0x03, 0x9f,
+  0x00, 0x00, 0xc0, 0x8c, 0xff, 0x00, 0xaf, 0x84, 0x00, 0x05, 0xb2, 0xff,
+  0xcf, 0x00, 0x00, 0xd0, 0x88, 0xff, 0x0b, 0x02, 0x00, 0xf0, 0xff, 0x3f,
+  0x00, 0x00, 0xfa, 0xff, 0x0b, 0x00, 0x30, 0x84, 0xff, 0x17, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf6, 0xff, 0x0e, 0x00, 0x00,
+  0xff, 0x4f, 0x00, 0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x02, 0x02, 0x00, 0x50, 0x83, 0xff, 0x04, 0x07, 0x00, 0x00, 0xff, 0x3f,
+  0x86, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x02, 0x06, 0x00, 0x20, 0x83, 0xff,
+  0x1b, 0xcf, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x04, 0x00, 0x70, 0xff, 0x08,
+  0x00, 0x10, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9f, 0x00, 0x00, 0xf5,
+  0xff, 0xff, 0x00, 0x00, 0xf6, 0x87, 0xff, 0x16, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x07, 0x00, 0x60, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x08, 0x00,
+  0x10, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00,
+  0xf0, 0xff, 0x05, 0x00, 0x40, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x20, 0xff, 0xff, 0x03, 0x00, 0xb0,
+  0x84, 0xff, 0x17, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf6, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x4f, 0x00, 0x00, 0xfb, 0xff, 0x7f,
+  0x00, 0x00, 0xfb, 0x83, 0xff, 0x12, 0x0f, 0x00, 0x30, 0xff, 0x00, 0x60,
+  0x5f, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0x3f, 0x84, 0x00, 0x04, 0xf0, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd4,
+  0xff, 0x03, 0x0c, 0x00, 0x00, 0xfa, 0x8d, 0xff, 0x00, 0x6d, 0x84, 0x00,
+  0x04, 0xfb, 0x7f, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x0e, 0xcf, 0x9c, 0x88,
+  0x02, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30,
+  0x84, 0xff, 0x17, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0xbf,
+  0x00, 0x00, 0xfa, 0x83, 0xff, 0x02, 0x02, 0x00, 0x40, 0x83, 0xff, 0x04,
+  0x07, 0x00, 0x00, 0xff, 0x3f, 0x85, 0x00, 0x00, 0xc1, 0x85, 0xff, 0x02,
+  0x03, 0x00, 0x70, 0x83, 0xff, 0x1b, 0x8f, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x07, 0x00, 0x30, 0xff, 0x05, 0x00, 0x60, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x00, 0x00, 0xf3, 0x85, 0xff,
+  0x18, 0xcc, 0x8b, 0x48, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0xff, 0x00, 0x00, 0xb0, 0xff, 0x04, 0x00, 0x60, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x03, 0x00, 0x70,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf9, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x17, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0xbf, 0x00, 0x00, 0xfa, 0x83, 0xff,
+  0x12, 0x3f, 0x00, 0x10, 0xbf, 0x00, 0x80, 0x7f, 0x00, 0xc0, 0x2f, 0x00,
+  0x20, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x84, 0x00, 0x04, 0xf0,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd3, 0xff, 0x03, 0xcf, 0x01, 0x00,
+  0x90, 0x8f, 0xff, 0x01, 0x9e, 0x02, 0x82, 0x00, 0x04, 0xf3, 0x6f, 0x00,
+  0x00, 0xf3, 0x84, 0xff, 0x01, 0x9e, 0x02, 0x83, 0x00, 0x09, 0xf0, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0x84, 0xff, 0x0f, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x0e, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x03, 0x00,
+  0x30, 0x83, 0xff, 0x04, 0x07, 0x00, 0x00, 0xff, 0x3f, 0x84, 0x00, 0x00,
+  0x50, 0x86, 0xff, 0x02, 0x01, 0x00, 0x80, 0x83, 0xff, 0x13, 0x7f, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff, 0x03, 0x00, 0x70, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0x3f, 0x86, 0x00, 0x00, 0xf1, 0x84, 0xff,
+  0x00, 0x4b, 0x84, 0x00, 0x13, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x01, 0x00, 0x90, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0x0e, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x12, 0x5f, 0x00, 0x00, 0x9f,
+  0x00, 0xb0, 0xbf, 0x00, 0xa0, 0x0f, 0x00, 0x40, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x84, 0x00, 0x04, 0xf0, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0xd3, 0xff, 0x03, 0x1c, 0x00, 0x00, 0xf9, 0x90, 0xff, 0x08, 0xdf,
+  0x07, 0x00, 0x00, 0xb0, 0x3f, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x01, 0xef,
+  0x03, 0x84, 0x00, 0x09, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x30, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0b, 0x86, 0x00, 0x00,
+  0xf7, 0x83, 0xff, 0x02, 0x03, 0x00, 0x30, 0x83, 0xff, 0x0a, 0x05, 0x00,
+  0x30, 0xff, 0x3f, 0x00, 0x00, 0x73, 0x04, 0x00, 0x30, 0x86, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0x83, 0xff, 0x13, 0x7f, 0x00, 0x00, 0xf5, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0x3f, 0x86, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0x6f, 0x85, 0x00,
+  0x13, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff,
+  0x03, 0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x19,
+  0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x5f, 0x00, 0x00,
+  0xf3, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x03,
+  0x00, 0xb0, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0b, 0x86, 0x00, 0x00,
+  0xf7, 0x83, 0xff, 0x1c, 0x7f, 0x00, 0x00, 0x7c, 0x00, 0xf0, 0xdf, 0x00,
+  0x70, 0x0c, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00,
+  0x00, 0xb5, 0xbb, 0xbb, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd2,
+  0xff, 0x03, 0xcf, 0x01, 0x00, 0x90, 0x92, 0xff, 0x07, 0x8f, 0x00, 0x00,
+  0xa0, 0x6f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x10, 0x3f, 0x00, 0x00, 0x72,
+  0xbb, 0x02, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x30, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0x86, 0x00, 0x00, 0xf7,
+  0x83, 0xff, 0x02, 0x06, 0x00, 0x20, 0x83, 0xff, 0x0b, 0x03, 0x00, 0x50,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0x0e, 0x00, 0x00, 0xf8, 0x85, 0xff, 0x02,
+  0x00, 0x00, 0x90, 0x83, 0xff, 0x13, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x09, 0x00, 0x00, 0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0x4f, 0x86, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x1a, 0x09, 0x00, 0x00,
+  0x96, 0x5b, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00,
+  0x00, 0xb0, 0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb,
+  0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x01, 0x00, 0x90, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf6, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f,
+  0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x15, 0xaf, 0x00, 0x00, 0x3b, 0x00,
+  0xf1, 0xff, 0x00, 0x50, 0x0b, 0x00, 0xa0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0xd2, 0xff, 0x03, 0x1c, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x00, 0xfc,
+  0x8d, 0xff, 0x06, 0x00, 0x00, 0x70, 0x7f, 0x00, 0x00, 0xf3, 0x83, 0xff,
+  0x10, 0x0c, 0x00, 0x10, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xff, 0x3f, 0x00,
+  0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0x84, 0xff, 0x12, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0x00, 0xfd, 0x88, 0xff, 0x12, 0x0a, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0xdf, 0x00, 0x00, 0xc0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x7f, 0x00,
+  0x00, 0xe1, 0x85, 0xff, 0x02, 0x03, 0x00, 0x70, 0x83, 0xff, 0x16, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x06, 0x00, 0x70,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x7f, 0x00, 0x00, 0xf7, 0x88, 0xff,
+  0x1a, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x06, 0x00, 0x70, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x03,
+  0x00, 0x70, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x12,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xfd, 0x88, 0xff, 0x15, 0xcf, 0x00,
+  0x00, 0x28, 0x00, 0xf3, 0xff, 0x03, 0x30, 0x07, 0x00, 0xc0, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0xd1, 0xff, 0x03, 0xcf, 0x01, 0x00, 0x90, 0x84,
+  0xff, 0x02, 0x08, 0x10, 0xfb, 0x87, 0xff, 0x00, 0xdc, 0x83, 0xff, 0x06,
+  0x00, 0x00, 0x90, 0xaf, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x10, 0x09, 0x00,
+  0x70, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x0b, 0x00, 0x30, 0x84, 0xff, 0x12, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00,
+  0xfa, 0x88, 0xff, 0x12, 0x0f, 0x00, 0x00, 0xf5, 0xff, 0xff, 0x8f, 0x00,
+  0x00, 0xf1, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x01, 0x00, 0x50, 0x85,
+  0xff, 0x02, 0x05, 0x00, 0x40, 0x83, 0xff, 0x16, 0xcf, 0x00, 0x00, 0xe1,
+  0xff, 0xff, 0x04, 0x00, 0x50, 0xff, 0x07, 0x00, 0x30, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xfb, 0x9f, 0x00, 0x00, 0xf3, 0x87, 0xff, 0x1b, 0xef, 0x00,
+  0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0xff, 0x00, 0x00, 0xb0, 0xff, 0x07, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xfb, 0x84, 0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x06, 0x00, 0x50,
+  0xff, 0xff, 0x0e, 0x00, 0x00, 0xfb, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x12, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0x3f, 0x00, 0x00, 0xfa, 0x89, 0xff, 0x14, 0x00, 0x00, 0x07, 0x00,
+  0xf7, 0xff, 0x05, 0x00, 0x06, 0x00, 0xf0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0xd1, 0xff, 0x00, 0x1f, 0x85, 0x00, 0x04, 0x70, 0xcf, 0x00, 0x00,
+  0xe1, 0x86, 0xff, 0x21, 0xef, 0x11, 0xfa, 0xff, 0xff, 0x6f, 0x00, 0x00,
+  0xc0, 0xff, 0x01, 0x00, 0x60, 0xff, 0xff, 0xad, 0xff, 0x07, 0x00, 0x60,
+  0xff, 0xef, 0x01, 0x00, 0xd0, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x30, 0x84, 0xff, 0x16, 0x9f, 0x00, 0x00, 0xf5, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xaf, 0xfe, 0x84, 0xff, 0x13, 0x6f, 0x00, 0x00, 0x90, 0xff,
+  0xff, 0x1c, 0x00, 0x00, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x09,
+  0x00, 0x00, 0xfb, 0x84, 0xff, 0x21, 0x0a, 0x00, 0x00, 0xf9, 0xff, 0xaf,
+  0xfd, 0xff, 0x00, 0x00, 0x80, 0xff, 0xcf, 0x00, 0x00, 0xa0, 0xff, 0x0a,
+  0x00, 0x00, 0xfc, 0xff, 0x09, 0x00, 0x00, 0xfb, 0xdf, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0xdf, 0xfa, 0x83, 0xff, 0x1b, 0xcf, 0x00, 0x00, 0xf0, 0xff,
+  0x5f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xb0, 0xff, 0x0a, 0x00, 0x00, 0xfc, 0xff, 0x09, 0x00, 0x00, 0xfb, 0x84,
+  0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x09, 0x00, 0x10, 0xfe, 0xff, 0x08,
+  0x00, 0x10, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x16, 0x9f, 0x00, 0x00, 0xf5, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x7f, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xaf, 0xfe, 0x85, 0xff, 0x14, 0x02, 0x00, 0x01,
+  0x00, 0xf9, 0xff, 0x07, 0x00, 0x01, 0x00, 0xf2, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0xd1, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x04, 0xb0, 0x7f, 0x00,
+  0x00, 0xb0, 0x86, 0xff, 0x21, 0x3e, 0x00, 0x10, 0x86, 0x88, 0x02, 0x00,
+  0x00, 0xf3, 0xff, 0x07, 0x00, 0x00, 0x72, 0x58, 0x10, 0xfd, 0x0b, 0x00,
+  0x10, 0xca, 0x3a, 0x00, 0x00, 0x80, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x0b, 0x00, 0x30, 0x84, 0xff, 0x16, 0xbf, 0x00, 0x00, 0x60, 0x28, 0xfd,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xef, 0x01, 0x00,
+  0x30, 0xcb, 0xac, 0x02, 0xf4, 0x84, 0xff, 0x13, 0xef, 0x01, 0x00, 0x00,
+  0x95, 0x69, 0x00, 0x00, 0x80, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0x1f, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x15, 0x2f, 0x00, 0x00, 0x30, 0x88,
+  0x03, 0xf4, 0xff, 0x09, 0x00, 0x00, 0xc7, 0x1a, 0x00, 0x00, 0xf2, 0xff,
+  0x1f, 0x00, 0x00, 0xa1, 0x7b, 0x82, 0x00, 0x08, 0xfb, 0xff, 0x07, 0x00,
+  0x10, 0xc8, 0xbc, 0x06, 0xc1, 0x84, 0xff, 0x16, 0x00, 0x00, 0x60, 0xbc,
+  0x05, 0x00, 0x00, 0xf2, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xb0, 0xff, 0x1f, 0x00, 0x00, 0xa1, 0x7b, 0x82, 0x00, 0x00, 0xfb, 0x84,
+  0xff, 0x19, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xa3, 0x7c, 0x00,
+  0x00, 0x80, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x16, 0xbf, 0x00, 0x00, 0x60, 0x28,
+  0xfd, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xef, 0x01,
+  0x00, 0x30, 0xcb, 0xac, 0x02, 0xf4, 0x85, 0xff, 0x00, 0x04, 0x82, 0x00,
+  0x02, 0xfb, 0xff, 0x0b, 0x82, 0x00, 0x0a, 0xf4, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0xd1, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x04, 0xb0, 0xaf, 0x00,
+  0x00, 0xd0, 0x86, 0xff, 0x00, 0x08, 0x86, 0x00, 0x02, 0xfc, 0xff, 0x3f,
+  0x84, 0x00, 0x01, 0xf3, 0x0e, 0x86, 0x00, 0x08, 0xfc, 0x3f, 0x00, 0x00,
+  0xfb, 0xff, 0x0b, 0x00, 0x30, 0x85, 0xff, 0x00, 0x01, 0x82, 0x00, 0x0b,
+  0xf5, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x09,
+  0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x0c, 0x85, 0x00, 0x0b, 0xf9,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x9f, 0x00, 0x00, 0x80, 0x84,
+  0xff, 0x00, 0xcf, 0x84, 0x00, 0x02, 0x70, 0xff, 0x2f, 0x85, 0x00, 0x02,
+  0xfc, 0xff, 0x8f, 0x86, 0x00, 0x02, 0xfb, 0xff, 0x0e, 0x84, 0x00, 0x01,
+  0x30, 0xfe, 0x83, 0xff, 0x00, 0x04, 0x85, 0x00, 0x0b, 0x70, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x8f, 0x86, 0x00, 0x00,
+  0xfb, 0x84, 0xff, 0x04, 0x00, 0x00, 0xf0, 0xff, 0xbf, 0x85, 0x00, 0x0e,
+  0xf3, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x03, 0x00, 0xb0, 0x85, 0xff, 0x00, 0x01, 0x82, 0x00, 0x0b, 0xf5, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x09, 0x84, 0x00,
+  0x00, 0x70, 0x85, 0xff, 0x00, 0x07, 0x82, 0x00, 0x02, 0xff, 0xff, 0x0d,
+  0x82, 0x00, 0x0a, 0xf7, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xd1, 0xff,
+  0x00, 0x0f, 0x85, 0x00, 0x04, 0xf0, 0xff, 0x02, 0x00, 0xf7, 0x86, 0xff,
+  0x00, 0xaf, 0x85, 0x00, 0x04, 0xb0, 0xff, 0xff, 0xef, 0x03, 0x83, 0x00,
+  0x01, 0xb0, 0x8f, 0x83, 0x00, 0x0b, 0x65, 0x00, 0x10, 0xff, 0x3f, 0x00,
+  0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0x85, 0xff, 0x00, 0x09, 0x82, 0x00,
+  0x0b, 0xb0, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x8f, 0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0xcf, 0x84, 0x00, 0x0d,
+  0x90, 0xdc, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03, 0x00,
+  0x10, 0xfe, 0x84, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x03, 0x10, 0xff, 0xcf,
+  0x03, 0x83, 0x00, 0x04, 0xa0, 0xff, 0xff, 0xef, 0x04, 0x82, 0x00, 0x06,
+  0x72, 0x00, 0x00, 0xfb, 0xff, 0xcf, 0x02, 0x83, 0x00, 0x01, 0x40, 0xfe,
+  0x83, 0xff, 0x00, 0x0d, 0x82, 0x00, 0x0f, 0x20, 0x0a, 0x00, 0xc0, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xef, 0x04, 0x82,
+  0x00, 0x03, 0x62, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x05, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x09, 0x83, 0x00, 0x0f, 0x20, 0xfe, 0xff, 0xbf, 0x00, 0x00,
+  0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x85, 0xff,
+  0x00, 0x09, 0x82, 0x00, 0x0b, 0xb0, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x8f, 0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x06,
+  0x0a, 0x00, 0x00, 0x20, 0xff, 0xff, 0x0f, 0x82, 0x00, 0x0a, 0xfa, 0xff,
+  0xff, 0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0xda, 0xff, 0x01, 0xaf, 0xc7, 0x88, 0xff,
+  0x01, 0x7e, 0x01, 0x82, 0x00, 0x01, 0x50, 0xfe, 0x82, 0xff, 0x16, 0x7f,
+  0x01, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x09, 0x00, 0x00, 0x90, 0xff, 0x06,
+  0x60, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x30, 0x85, 0xff,
+  0x00, 0x8f, 0x82, 0x00, 0x08, 0xc3, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f,
+  0x00, 0x00, 0x82, 0xff, 0x00, 0x3d, 0x82, 0x00, 0x01, 0x60, 0xfe, 0x86,
+  0xff, 0x01, 0x7e, 0x01, 0x84, 0x00, 0x0b, 0x82, 0xfe, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xf5, 0x84, 0xff, 0x01, 0xef, 0x05,
+  0x82, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x01, 0x50, 0xfc,
+  0x82, 0xff, 0x0a, 0x5f, 0x00, 0x00, 0x20, 0xbe, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0x7f, 0x82, 0x00, 0x01, 0x30, 0xfb, 0x84, 0xff, 0x1a, 0xbf, 0x02,
+  0x00, 0x00, 0xe3, 0x9f, 0x00, 0xf1, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x30, 0xae, 0x00, 0x00,
+  0xfb, 0x83, 0xff, 0x1a, 0xef, 0x00, 0x00, 0xf1, 0xff, 0xff, 0xef, 0x04,
+  0x00, 0x00, 0x10, 0xe7, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0x85, 0xff, 0x00, 0x8f, 0x82,
+  0x00, 0x08, 0xc3, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82,
+  0xff, 0x00, 0x3d, 0x82, 0x00, 0x01, 0x60, 0xfe, 0x85, 0xff, 0x06, 0x0c,
+  0x00, 0x00, 0x40, 0xff, 0xff, 0x3f, 0x82, 0x00, 0x0a, 0xfc, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x02, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0xe6, 0xff, 0x03, 0xdf, 0x8b, 0x77, 0xca, 0x85,
+  0xff, 0x02, 0xbf, 0x7a, 0xb9, 0x82, 0xff, 0x06, 0xef, 0x8b, 0xc9, 0xff,
+  0xff, 0xdf, 0xdb, 0x8f, 0xff, 0x02, 0xbe, 0x78, 0xc9, 0x8c, 0xff, 0x02,
+  0xbf, 0x7a, 0xca, 0x89, 0xff, 0x03, 0xdf, 0x9b, 0x67, 0x02, 0x82, 0x00,
+  0x00, 0xc1, 0x8f, 0xff, 0x03, 0xef, 0x8b, 0xa7, 0xfc, 0x83, 0xff, 0x03,
+  0xdf, 0x7b, 0xb8, 0xfe, 0x84, 0xff, 0x02, 0xbf, 0xa7, 0xfe, 0x86, 0xff,
+  0x02, 0xdf, 0x7b, 0xb9, 0x87, 0xff, 0x06, 0xbf, 0x79, 0xeb, 0xff, 0xff,
+  0xbf, 0xfc, 0x8b, 0xff, 0x02, 0xbf, 0xa7, 0xfe, 0x87, 0xff, 0x03, 0xaf,
+  0x00, 0x00, 0xf3, 0x83, 0xff, 0x02, 0x9b, 0x97, 0xfb, 0x96, 0xff, 0x02,
+  0xbe, 0x78, 0xc9, 0x8c, 0xff, 0x02, 0xbf, 0x7a, 0xca, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0xff, 0x04, 0xcf, 0x05, 0x00, 0x00, 0xf4, 0xd3, 0xff, 0x03,
+  0x3e, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
+  0x03, 0xaf, 0x00, 0x20, 0xfe, 0xd2, 0xff, 0x04, 0xdf, 0x03, 0x00, 0x00,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff, 0x01, 0x0c, 0xc0,
+  0xd3, 0xff, 0x03, 0x0a, 0x00, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x85, 0xff, 0x01, 0xcf, 0xf9, 0xd3, 0xff, 0x03, 0x0e, 0x00, 0x00,
+  0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x02, 0x7f, 0x00,
+  0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x02, 0xdf, 0x70,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0x01, 0xdf, 0xfc, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x02, 0x24, 0x00, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0x00, 0xde, 0x9e, 0xff, 0x02, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x02, 0x49,
+  0x01, 0x70, 0x9e, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xba, 0xff, 0x02, 0x07, 0x00, 0x70, 0x9e, 0xff, 0x02, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x02, 0x07,
+  0x00, 0x70, 0x9e, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xab, 0xff, 0x02, 0xef, 0x8b, 0xc9, 0x84, 0xff, 0x02, 0xcf,
+  0x8a, 0xdc, 0x83, 0xff, 0x02, 0x07, 0x00, 0x70, 0x90, 0xff, 0x02, 0xcf,
+  0x8b, 0xca, 0x87, 0xff, 0x05, 0xae, 0xa8, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xff, 0x06, 0x00, 0x00, 0xe7, 0x08,
+  0x00, 0x00, 0xc4, 0x82, 0xff, 0x07, 0x8f, 0x01, 0x00, 0x00, 0x91, 0xff,
+  0xff, 0x03, 0x83, 0x00, 0x25, 0x70, 0x0a, 0x00, 0x30, 0xff, 0xff, 0x00,
+  0x00, 0xc0, 0xff, 0x6f, 0x00, 0x00, 0xfc, 0xff, 0x9f, 0x02, 0x00, 0x00,
+  0x40, 0xfd, 0xff, 0xff, 0x0f, 0x00, 0x60, 0xbf, 0x01, 0x10, 0xff, 0x00,
+  0x00, 0xf0, 0xff, 0xef, 0x02, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xa3, 0xff, 0x02, 0x00, 0x00, 0x64, 0x82, 0x00, 0x04, 0x40, 0xff,
+  0xff, 0xef, 0x03, 0x83, 0x00, 0x02, 0xe5, 0xff, 0x03, 0x83, 0x00, 0x0f,
+  0xa0, 0x0e, 0x00, 0x10, 0xff, 0xbf, 0x00, 0x00, 0x90, 0xff, 0x3f, 0x00,
+  0x00, 0xff, 0xef, 0x05, 0x83, 0x00, 0x11, 0x81, 0xff, 0xff, 0x0f, 0x00,
+  0x30, 0x1c, 0x00, 0x30, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x6f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0x86, 0x00, 0x0a,
+  0xfc, 0xff, 0x4f, 0x00, 0x00, 0x20, 0x00, 0x00, 0x50, 0xff, 0x03, 0x83,
+  0x00, 0x0e, 0xc0, 0x1f, 0x00, 0x00, 0xff, 0x9f, 0x00, 0x00, 0x70, 0xff,
+  0x1f, 0x00, 0x30, 0xff, 0x5f, 0x85, 0x00, 0x0f, 0xfb, 0xff, 0x0f, 0x00,
+  0x20, 0x05, 0x00, 0x70, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0a, 0x00, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x82, 0x00, 0x2a, 0x93,
+  0x0a, 0x00, 0x00, 0xf7, 0xff, 0x0a, 0x00, 0x20, 0xfe, 0x3e, 0x00, 0x00,
+  0xfc, 0x79, 0x03, 0x00, 0x30, 0x77, 0xf7, 0x4f, 0x00, 0x00, 0xfc, 0x6f,
+  0x00, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x60, 0xff, 0x0a, 0x00, 0x00, 0xb6,
+  0x29, 0x00, 0x00, 0xf2, 0xff, 0x0f, 0x83, 0x00, 0x08, 0x90, 0xff, 0x00,
+  0x00, 0xf0, 0xef, 0x01, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa4, 0xff, 0x2d, 0x00, 0x00, 0x20, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0x03, 0x00, 0xd0, 0xff, 0xdf, 0x00, 0x00, 0xf4, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x8f, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00, 0x20, 0xff, 0x0b,
+  0x00, 0x90, 0xff, 0x03, 0x00, 0x70, 0xff, 0xef, 0x01, 0x00, 0x90, 0xff,
+  0x0f, 0x82, 0x00, 0x09, 0x74, 0xd7, 0xff, 0x00, 0x00, 0xf0, 0x5f, 0x00,
+  0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x30, 0x00,
+  0x00, 0xe0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xdf, 0x00, 0x00, 0xf2, 0xff,
+  0xff, 0x02, 0x00, 0xf1, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf7, 0x0f, 0x00, 0x04, 0x00, 0xff, 0x09, 0x00, 0xc0, 0xdf, 0x00,
+  0x00, 0xd0, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff, 0x0f, 0x00, 0x00, 0x80,
+  0x82, 0xff, 0x05, 0x00, 0x00, 0xf0, 0x0a, 0x00, 0x30, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xa5, 0xff, 0x14, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xbf, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x03, 0x00, 0xf0, 0xff,
+  0x07, 0x00, 0x70, 0x82, 0xff, 0x18, 0x00, 0x00, 0xf6, 0x0c, 0x00, 0x0b,
+  0x00, 0xfb, 0x07, 0x00, 0xf0, 0xbf, 0x00, 0x00, 0xf1, 0xff, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xf1, 0x82, 0xff, 0x05, 0x00, 0x00,
+  0xe0, 0x01, 0x00, 0xd0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xff,
+  0x08, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x8f, 0x86, 0x00,
+  0x04, 0xb0, 0xff, 0x07, 0x00, 0x70, 0x82, 0xff, 0x18, 0x02, 0x00, 0xf3,
+  0x09, 0x10, 0x0f, 0x00, 0xf8, 0x03, 0x00, 0xf3, 0x8f, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x05, 0x00, 0x00, 0x50, 0x00, 0x00, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xa5, 0xff, 0x08, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0x7f, 0x86, 0x00, 0x04, 0xb0, 0xff, 0x07, 0x00, 0x70, 0x82, 0xff, 0x18,
+  0x05, 0x00, 0xf3, 0x06, 0x30, 0x1f, 0x00, 0xf6, 0x02, 0x00, 0xf7, 0x7f,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0x82, 0xff, 0x05, 0x00, 0x00, 0x90, 0x00, 0x00, 0xe1, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xa5, 0xff, 0x08, 0x00, 0x00, 0xf0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0x9f, 0x86, 0x00, 0x04, 0xb0, 0xff, 0x07, 0x00, 0x70,
+  0x82, 0xff, 0x18, 0x09, 0x00, 0xf0, 0x03, 0x70, 0x4f, 0x00, 0xf3, 0x00,
+  0x00, 0xfa, 0x9f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x05, 0x00, 0x00, 0xf0, 0x01, 0x00,
+  0x60, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0xff, 0x0b, 0x00, 0x00,
+  0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xbf, 0x00, 0x00, 0xf3, 0x85, 0xff,
+  0x02, 0x07, 0x00, 0x70, 0x82, 0xff, 0x18, 0x0c, 0x00, 0xd0, 0x00, 0xa0,
+  0x7f, 0x00, 0xc1, 0x00, 0x00, 0xfd, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x06, 0x00,
+  0x00, 0xf0, 0x0b, 0x00, 0x00, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa4, 0xff, 0x0b, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0x00, 0x00, 0xf0, 0x85, 0xff, 0x02, 0x09, 0x00, 0x50, 0x82, 0xff, 0x18,
+  0x0f, 0x00, 0x80, 0x00, 0xc0, 0xaf, 0x00, 0x90, 0x00, 0x00, 0xff, 0xef,
+  0x00, 0x00, 0xd0, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0x82, 0xff, 0x06, 0x00, 0x00, 0xf0, 0x3f, 0x00, 0x00, 0xf4, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x14, 0x00, 0x00, 0xf0, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x02, 0x00, 0x60, 0xff, 0xff, 0xef, 0xfa,
+  0xff, 0xff, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x18, 0x3f, 0x00, 0x20, 0x00,
+  0xf0, 0xdf, 0x00, 0x30, 0x00, 0x30, 0xff, 0xff, 0x01, 0x00, 0x70, 0xff,
+  0xef, 0x02, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x06,
+  0x00, 0x00, 0xf0, 0xbf, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xa4, 0xff, 0x18, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x0b, 0x00, 0x00, 0xc6, 0xcd, 0x17, 0x80, 0xff, 0xff, 0x0d, 0x00,
+  0x00, 0x85, 0x93, 0xff, 0x7f, 0x82, 0x00, 0x01, 0xf2, 0xff, 0x82, 0x00,
+  0x0f, 0x70, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xc7, 0x3a, 0x00, 0x00, 0xe1,
+  0xff, 0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x06, 0x00, 0x00, 0xf0, 0xff,
+  0x04, 0x00, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa4, 0xff, 0x09,
+  0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x5f, 0x85, 0x00,
+  0x02, 0xfc, 0xff, 0x2f, 0x82, 0x00, 0x02, 0x20, 0xff, 0xaf, 0x82, 0x00,
+  0x08, 0xf5, 0xff, 0x03, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x3f, 0x85, 0x00,
+  0x05, 0xfb, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x07, 0x00, 0x00,
+  0xf0, 0xff, 0x0d, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xa3, 0xff, 0x0a, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0xef, 0x04, 0x83, 0x00, 0x03, 0x10, 0xfa, 0xff, 0xbf, 0x83, 0x00, 0x01,
+  0xf9, 0xdf, 0x82, 0x00, 0x09, 0xf7, 0xff, 0x06, 0x00, 0x00, 0xd0, 0xff,
+  0xff, 0xef, 0x03, 0x83, 0x00, 0x06, 0x90, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0x82, 0xff, 0x07, 0x00, 0x00, 0xf0, 0xff, 0x5f, 0x00, 0x00, 0xe1,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa3, 0xff, 0x0a, 0x00, 0x00, 0xf0,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xaf, 0x82, 0x00, 0x01, 0x10,
+  0xf9, 0x82, 0xff, 0x05, 0x0a, 0x00, 0x00, 0x10, 0xfa, 0xff, 0x82, 0x00,
+  0x05, 0xfb, 0xff, 0x09, 0x00, 0x00, 0xf1, 0x82, 0xff, 0x00, 0x8f, 0x82,
+  0x00, 0x07, 0x40, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x07, 0x00, 0x00, 0xf0, 0xff, 0xdf, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xae, 0xff, 0x03, 0xef, 0x8b, 0xb8, 0xfe, 0x83, 0xff,
+  0x03, 0xef, 0x9b, 0x87, 0xfc, 0x8e, 0xff, 0x03, 0xdf, 0x7b, 0xb7, 0xfd,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xff,
+  0x02, 0x28, 0x71, 0xfe, 0x8d, 0xff, 0x02, 0xdf, 0x05, 0xa3, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xca, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf6, 0x82,
+  0xff, 0x00, 0xdc, 0x82, 0xff, 0x01, 0xdf, 0xfc, 0x84, 0xff, 0x03, 0x2f,
+  0x00, 0x00, 0xfb, 0x95, 0xff, 0x00, 0xcc, 0xc2, 0xff, 0x01, 0xce, 0xdc,
+  0xe7, 0xff, 0x01, 0xef, 0xec, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x0c,
+  0x3f, 0x00, 0x00, 0xf0, 0xff, 0x39, 0x00, 0x70, 0xff, 0xff, 0x14, 0x00,
+  0xf0, 0x84, 0xff, 0x03, 0x0b, 0x00, 0x00, 0xf5, 0x93, 0xff, 0x02, 0x49,
+  0x00, 0x30, 0xc0, 0xff, 0x05, 0xef, 0x08, 0x00, 0x00, 0x61, 0xfc, 0xe4,
+  0xff, 0x02, 0x24, 0x00, 0xb0, 0xff, 0xff, 0xe9, 0xff, 0x04, 0xbf, 0x48,
+  0x01, 0x10, 0xb6, 0x8d, 0xff, 0x85, 0xcc, 0x0d, 0xec, 0x3f, 0x00, 0x00,
+  0xf0, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff,
+  0x03, 0x0b, 0x00, 0x00, 0xf6, 0x93, 0xff, 0x02, 0x07, 0x00, 0x30, 0xc0,
+  0xff, 0x00, 0x2e, 0x83, 0x00, 0x00, 0xfa, 0xe4, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xe8, 0xff, 0x01, 0xef, 0x07, 0x83, 0x00, 0x00, 0xe4,
+  0x8c, 0xff, 0x85, 0x00, 0x0d, 0xb0, 0x8f, 0x00, 0x00, 0xf6, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x03, 0x2f, 0x00,
+  0x00, 0xfc, 0x8f, 0xff, 0x00, 0xcf, 0x82, 0xff, 0x02, 0x07, 0x00, 0x30,
+  0xa5, 0xff, 0x00, 0xfc, 0x99, 0xff, 0x00, 0x05, 0x82, 0x00, 0x00, 0x10,
+  0xe5, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xe8, 0xff, 0x00, 0x2c,
+  0x84, 0x00, 0x00, 0x30, 0x8c, 0xff, 0x85, 0x00, 0x0d, 0xf0, 0xff, 0x39,
+  0x93, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84,
+  0xff, 0x02, 0xef, 0x36, 0xc4, 0x8e, 0xff, 0x02, 0x4c, 0x02, 0x30, 0x82,
+  0xff, 0x02, 0x07, 0x00, 0x30, 0xa3, 0xff, 0x02, 0x34, 0x00, 0xf0, 0x98,
+  0xff, 0x05, 0xcf, 0x00, 0x00, 0x30, 0x67, 0x81, 0xe5, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xe8, 0xff, 0x03, 0x0e, 0x00, 0x00, 0x32, 0x82,
+  0x00, 0x00, 0xf9, 0x8b, 0xff, 0x85, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x07,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x96, 0xff, 0x02, 0x0b,
+  0x00, 0x30, 0x82, 0xff, 0x02, 0x07, 0x00, 0x30, 0xa3, 0xff, 0x02, 0x00,
+  0x00, 0xf0, 0x98, 0xff, 0x03, 0xaf, 0x00, 0x00, 0xf3, 0xe7, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0xe8, 0xff, 0x07, 0xcf, 0x00, 0xf8, 0xff,
+  0x4e, 0x00, 0x00, 0xf4, 0x8b, 0xff, 0x02, 0x00, 0x00, 0x50, 0x82, 0x77,
+  0x00, 0xf9, 0x84, 0xff, 0x07, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x96, 0xff, 0x02, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x02, 0x07, 0x00,
+  0x30, 0xa3, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x98, 0xff, 0x03, 0x7f, 0x00,
+  0x00, 0xf7, 0xe7, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xe9, 0xff,
+  0x06, 0xdb, 0xff, 0xff, 0xdf, 0x00, 0x00, 0xf3, 0x8b, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x88, 0xff, 0x07, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x8d, 0xff, 0x02, 0x8c, 0xc8, 0xfe, 0x85, 0xff, 0x02, 0x0b, 0x00,
+  0x30, 0x82, 0xff, 0x06, 0x07, 0x00, 0x30, 0xff, 0xad, 0xb8, 0xfd, 0x83,
+  0xff, 0x03, 0xdf, 0x8c, 0xc9, 0xfe, 0x87, 0xff, 0x03, 0xef, 0x8b, 0x88,
+  0xec, 0x84, 0xff, 0x02, 0xbc, 0xa8, 0xfc, 0x83, 0xff, 0x02, 0x00, 0x00,
+  0xf0, 0x8e, 0xff, 0x02, 0xef, 0x8a, 0xdb, 0x86, 0xff, 0x03, 0x7f, 0x00,
+  0x00, 0xf7, 0x83, 0xff, 0x02, 0xcf, 0x8a, 0xcb, 0x87, 0xff, 0x01, 0xad,
+  0xb8, 0x83, 0xff, 0x07, 0xcf, 0x89, 0xeb, 0xff, 0xff, 0x9c, 0xb8, 0xfe,
+  0x87, 0xff, 0x02, 0xcf, 0x8a, 0xca, 0x87, 0xff, 0x02, 0xbe, 0x98, 0xfc,
+  0x90, 0xff, 0x02, 0xcc, 0x98, 0xec, 0x90, 0xff, 0x01, 0x8c, 0xd8, 0x87,
+  0xff, 0x02, 0xae, 0xb8, 0xfd, 0x82, 0xff, 0x06, 0x00, 0x00, 0xb0, 0xff,
+  0x8c, 0xc9, 0xfe, 0x83, 0xff, 0x03, 0xcf, 0x8c, 0xc9, 0xfe, 0x86, 0xff,
+  0x02, 0xcf, 0x88, 0xec, 0x84, 0xff, 0x02, 0xbc, 0xa8, 0xfc, 0xff, 0xff,
+  0xce, 0xff, 0x03, 0xef, 0x00, 0x00, 0xf5, 0x8b, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x0b, 0x3f, 0x00, 0x00, 0xfb,
+  0xff, 0x03, 0x00, 0xf4, 0x19, 0x00, 0x00, 0xb2, 0x84, 0xff, 0x00, 0x03,
+  0x83, 0x00, 0x08, 0x50, 0xff, 0x07, 0x00, 0x30, 0x5e, 0x00, 0x00, 0x80,
+  0x82, 0xff, 0x05, 0xdf, 0x06, 0x00, 0x00, 0x40, 0xfd, 0x85, 0xff, 0x01,
+  0xbf, 0x04, 0x82, 0x00, 0x00, 0xd6, 0x82, 0xff, 0x00, 0x4b, 0x82, 0x00,
+  0x02, 0xe7, 0xff, 0x7f, 0x84, 0x00, 0x11, 0xf2, 0x7f, 0x00, 0x00, 0xf3,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xe6, 0x07, 0x00, 0x00,
+  0xc3, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x1b, 0xf8, 0xff, 0x7e, 0x01,
+  0x00, 0x00, 0x70, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0xa0, 0x7f, 0x00, 0x40,
+  0xbf, 0x00, 0x00, 0xdc, 0x04, 0x00, 0x10, 0xfc, 0x3d, 0x00, 0x00, 0xa1,
+  0x86, 0xff, 0x0f, 0x8e, 0x02, 0x00, 0x00, 0x40, 0xfd, 0xff, 0xff, 0x0f,
+  0x00, 0x70, 0x8f, 0x00, 0x00, 0x30, 0xfc, 0x83, 0xff, 0x0b, 0x0f, 0x00,
+  0x00, 0xf9, 0xff, 0xff, 0x07, 0x00, 0x50, 0xff, 0xff, 0x4a, 0x82, 0x00,
+  0x00, 0xb2, 0x82, 0xff, 0x0e, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00,
+  0xf3, 0xff, 0x07, 0x00, 0xe0, 0x5f, 0x00, 0x90, 0x83, 0xff, 0x10, 0x0f,
+  0x00, 0x70, 0x6e, 0x00, 0x00, 0x30, 0xfe, 0xff, 0xff, 0x00, 0x00, 0xb0,
+  0x1a, 0x00, 0x00, 0xb2, 0x82, 0xff, 0x0f, 0xaf, 0x03, 0x00, 0x00, 0x20,
+  0xfb, 0xff, 0xff, 0x3f, 0x00, 0x30, 0xaf, 0x01, 0x00, 0x10, 0xfa, 0x82,
+  0xff, 0x00, 0x3a, 0x82, 0x00, 0x00, 0xe7, 0xff, 0xff, 0xcd, 0xff, 0x03,
+  0x8f, 0x00, 0x00, 0xf9, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff,
+  0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00,
+  0x00, 0xf0, 0x84, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00,
+  0x62, 0x82, 0x00, 0x01, 0x10, 0xfe, 0x83, 0xff, 0x00, 0x03, 0x83, 0x00,
+  0x05, 0x70, 0xff, 0x07, 0x00, 0x20, 0x03, 0x82, 0x00, 0x03, 0xf8, 0xff,
+  0xff, 0x1c, 0x83, 0x00, 0x00, 0x91, 0x85, 0xff, 0x00, 0x09, 0x84, 0x00,
+  0x02, 0xfb, 0xff, 0x9f, 0x83, 0x00, 0x02, 0x20, 0xfc, 0x7f, 0x84, 0x00,
+  0x0d, 0xf5, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x00, 0x32, 0x82, 0x00, 0x01, 0x10, 0xfc, 0x83, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x02, 0xfb, 0xcf, 0x02, 0x83, 0x00, 0x0c, 0xb2, 0xff, 0xff,
+  0x0f, 0x00, 0x70, 0x09, 0x00, 0x70, 0xbf, 0x00, 0x00, 0x16, 0x82, 0x00,
+  0x05, 0xd1, 0x01, 0x00, 0x00, 0x10, 0xfd, 0x84, 0xff, 0x01, 0xef, 0x03,
+  0x83, 0x00, 0x06, 0x91, 0xff, 0xff, 0x0f, 0x00, 0x40, 0x06, 0x82, 0x00,
+  0x00, 0xf3, 0x83, 0xff, 0x0a, 0x5f, 0x00, 0x00, 0xf5, 0xff, 0xff, 0x03,
+  0x00, 0xa0, 0xff, 0x7f, 0x84, 0x00, 0x11, 0xe7, 0xff, 0xff, 0x03, 0x00,
+  0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0xb0, 0x06, 0x00,
+  0xb0, 0x83, 0xff, 0x03, 0x0f, 0x00, 0x30, 0x03, 0x82, 0x00, 0x05, 0xc2,
+  0xff, 0xff, 0x00, 0x00, 0x60, 0x82, 0x00, 0x04, 0x10, 0xfe, 0xff, 0xff,
+  0x06, 0x83, 0x00, 0x06, 0x70, 0xfe, 0xff, 0x3f, 0x00, 0x00, 0x09, 0x82,
+  0x00, 0x03, 0xd0, 0xff, 0xff, 0x9f, 0x83, 0x00, 0x01, 0x20, 0xfc, 0xff,
+  0xff, 0xcb, 0xff, 0x03, 0xdf, 0x19, 0x00, 0x20, 0x8c, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x83, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x05, 0x3f, 0x00, 0x00,
+  0xfb, 0xff, 0x03, 0x85, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x02, 0xa0, 0xff, 0x07, 0x85, 0x00, 0x09, 0xf1, 0xff, 0xdf, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x01, 0xef, 0x01, 0x83,
+  0x00, 0x0a, 0x10, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0xf2,
+  0x7f, 0x84, 0x00, 0x0a, 0xf7, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x86, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x01, 0xfd, 0x1e, 0x84, 0x00, 0x09, 0x10, 0xfe, 0xff, 0x0f, 0x00,
+  0x60, 0x01, 0x00, 0xa0, 0xbf, 0x85, 0x00, 0x00, 0x10, 0x83, 0x00, 0x00,
+  0xf6, 0x84, 0xff, 0x00, 0x3f, 0x85, 0x00, 0x02, 0xfb, 0xff, 0x0f, 0x85,
+  0x00, 0x00, 0x90, 0x83, 0xff, 0x0a, 0x9f, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0x07, 0x84, 0x00, 0x11, 0x70, 0xff, 0xff, 0x03,
+  0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x70, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x02, 0x40, 0xff, 0xff,
+  0x86, 0x00, 0x02, 0xf8, 0xff, 0x7f, 0x85, 0x00, 0x02, 0xf7, 0xff, 0x3f,
+  0x85, 0x00, 0x09, 0x40, 0xff, 0xff, 0x08, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0xf2, 0xff, 0xff, 0xca, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00, 0xe4, 0x8c,
+  0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x0c,
+  0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0x00, 0x81, 0x2b, 0x00, 0x00,
+  0xf3, 0x83, 0xff, 0x17, 0x79, 0x05, 0x00, 0x10, 0x77, 0xd7, 0xff, 0x07,
+  0x00, 0x00, 0x50, 0x7b, 0x00, 0x00, 0xd0, 0xff, 0x4f, 0x00, 0x00, 0xf8,
+  0xcf, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x20, 0x8f, 0x00, 0x00, 0xb2, 0xbd,
+  0x18, 0xb0, 0xff, 0xef, 0x01, 0x00, 0xb0, 0xff, 0x09, 0x00, 0x70, 0xbf,
+  0x77, 0x00, 0x00, 0x70, 0x77, 0xfd, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x82, 0x00, 0x04, 0xa3, 0x4a, 0x00, 0x00, 0xd0,
+  0x83, 0xff, 0x10, 0x7f, 0x37, 0x00, 0x00, 0x73, 0x77, 0xff, 0x05, 0x00,
+  0x00, 0xb8, 0x08, 0x00, 0x00, 0xf5, 0xff, 0x0f, 0x83, 0x00, 0x01, 0xc0,
+  0xbf, 0x82, 0x00, 0x08, 0xa9, 0x02, 0x00, 0x00, 0x80, 0x2a, 0x00, 0x00,
+  0xf3, 0x84, 0xff, 0x10, 0x07, 0x00, 0x00, 0xb6, 0x29, 0x00, 0x00, 0xf4,
+  0xff, 0x0f, 0x00, 0x00, 0x20, 0xa9, 0x00, 0x00, 0x70, 0x83, 0xff, 0x1c,
+  0xef, 0x00, 0x00, 0xe0, 0xff, 0xbf, 0x00, 0x00, 0xf4, 0xdf, 0x00, 0x00,
+  0x40, 0xaa, 0x04, 0x00, 0x10, 0xfd, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf3, 0xff, 0x07, 0x83, 0x00, 0x00, 0xf1, 0x83, 0xff, 0x09,
+  0x0f, 0x00, 0x00, 0x40, 0xab, 0x04, 0x00, 0x00, 0xfd, 0xff, 0x82, 0x00,
+  0x0f, 0x91, 0x2a, 0x00, 0x00, 0xf5, 0xff, 0x0d, 0x00, 0x00, 0xa4, 0x4a,
+  0x00, 0x00, 0xd1, 0xff, 0x3f, 0x82, 0x00, 0x0c, 0xb7, 0x03, 0x00, 0x30,
+  0xff, 0xef, 0x01, 0x00, 0xb0, 0xff, 0x09, 0x00, 0x70, 0xff, 0xff, 0xca,
+  0xff, 0x03, 0x5f, 0x00, 0x00, 0x91, 0x8d, 0xff, 0x13, 0x00, 0x00, 0x60,
+  0x88, 0x88, 0x98, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb,
+  0xff, 0x03, 0x00, 0x00, 0xfc, 0xaf, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x02,
+  0x0b, 0x00, 0x30, 0x82, 0xff, 0x10, 0x07, 0x00, 0x00, 0xf8, 0xff, 0x00,
+  0x00, 0xb0, 0xff, 0x0c, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x90, 0x83,
+  0xff, 0x28, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0x8f, 0x00,
+  0x00, 0xf7, 0xff, 0x3f, 0x00, 0x10, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00,
+  0x00, 0x40, 0xff, 0xff, 0x01, 0x00, 0x60, 0x84, 0xff, 0x0f, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xef, 0x00, 0x00, 0xb0, 0xff, 0xcf, 0x00, 0x00, 0xc0,
+  0xff, 0x0f, 0x82, 0x00, 0x0e, 0x76, 0xf7, 0xbf, 0x00, 0x00, 0xa0, 0xff,
+  0x08, 0x00, 0x00, 0xf9, 0xaf, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x10, 0x02,
+  0x00, 0x80, 0xff, 0xef, 0x00, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00, 0xe2,
+  0xff, 0x07, 0x00, 0x30, 0x84, 0xff, 0x1b, 0x04, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf9, 0x6f, 0x00, 0x00, 0xf3, 0xff, 0x3f, 0x00, 0x00, 0xf5,
+  0xff, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x82,
+  0x00, 0x01, 0x77, 0xf9, 0x83, 0xff, 0x2c, 0x0f, 0x00, 0x00, 0xf5, 0xff,
+  0x1f, 0x00, 0x00, 0xf8, 0xff, 0x00, 0x00, 0x10, 0xfe, 0x8f, 0x00, 0x00,
+  0xf3, 0xff, 0x05, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0x50, 0xff, 0x3f,
+  0x00, 0x00, 0xc0, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x8f, 0x00, 0x00, 0xf7,
+  0xff, 0x3f, 0x00, 0x10, 0xff, 0xff, 0xca, 0xff, 0x00, 0x3f, 0x82, 0x00,
+  0x00, 0xa1, 0x8c, 0xff, 0x84, 0x00, 0x0e, 0x30, 0xff, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff,
+  0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xa0, 0xff, 0xbf, 0x00,
+  0x00, 0xf0, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x10, 0x07,
+  0x00, 0x20, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0xff, 0x0b, 0x00, 0x70, 0x83, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xa1, 0x83,
+  0xff, 0x20, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x06, 0x00, 0x30, 0x84,
+  0xff, 0x21, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x9f, 0x00, 0x00, 0xf1, 0xff,
+  0xff, 0x02, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xbf,
+  0x00, 0x00, 0xf2, 0xff, 0x0b, 0x00, 0x20, 0xff, 0xef, 0x00, 0x00, 0xf0,
+  0x83, 0xff, 0x11, 0xcf, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x05, 0x00, 0x70,
+  0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x30, 0x84, 0xff, 0x1e,
+  0x08, 0x00, 0x70, 0xff, 0x3f, 0x00, 0x00, 0xfe, 0x2f, 0x00, 0x00, 0xf9,
+  0xff, 0x9f, 0x00, 0x00, 0xf2, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00,
+  0x00, 0xf3, 0xff, 0x07, 0x00, 0x00, 0xe1, 0x85, 0xff, 0x2d, 0x0f, 0x00,
+  0x00, 0xfe, 0xff, 0x6f, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00, 0xa0, 0xff,
+  0xbf, 0x00, 0x00, 0xf3, 0xff, 0x01, 0x00, 0x90, 0xff, 0xff, 0x09, 0x00,
+  0x20, 0xff, 0x3f, 0x00, 0x00, 0xf6, 0xff, 0x0e, 0x00, 0x00, 0xff, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xc9, 0xff,
+  0x05, 0x8f, 0x77, 0x02, 0x00, 0x00, 0xf8, 0x8b, 0xff, 0x84, 0x00, 0x0e,
+  0x30, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03,
+  0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x02, 0x0b, 0x00,
+  0x30, 0x82, 0xff, 0x10, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0x03, 0x00, 0x90, 0xff, 0xff, 0x0d, 0x00, 0x40, 0x83, 0xff, 0x00,
+  0xcf, 0x82, 0x00, 0x24, 0x62, 0xfb, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xfa, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f,
+  0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x0b, 0x00, 0x30, 0x84, 0xff, 0x21, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x6f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x07, 0x00, 0x60, 0xff, 0x0f,
+  0x00, 0x00, 0xf5, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x11, 0x8f, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x30, 0x84, 0xff, 0x0a, 0x0d, 0x00, 0x40, 0xff, 0x1f, 0x00,
+  0x40, 0xff, 0x0e, 0x00, 0x00, 0x82, 0xff, 0x10, 0x00, 0x00, 0xf0, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x00,
+  0xf9, 0x85, 0xff, 0x2d, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00,
+  0xf3, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xbf, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00,
+  0x00, 0xfa, 0xff, 0xff, 0xcb, 0xff, 0x03, 0x9f, 0x00, 0x00, 0xd1, 0x8b,
+  0xff, 0x84, 0x00, 0x0e, 0x30, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00,
+  0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84,
+  0xff, 0x02, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x09, 0x07, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x00, 0xb0, 0xff, 0x03, 0x85, 0x00, 0x00, 0x30, 0x84, 0xff,
+  0x00, 0x04, 0x82, 0x00, 0x03, 0x20, 0xf9, 0xff, 0x0e, 0x86, 0x00, 0x18,
+  0xf7, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00,
+  0x10, 0x84, 0xff, 0x21, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xfc, 0xff,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x84,
+  0xff, 0x0a, 0x2f, 0x00, 0x10, 0xff, 0x0c, 0x00, 0x90, 0xff, 0x0b, 0x00,
+  0x00, 0x82, 0xff, 0x0f, 0x00, 0x00, 0xc0, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x00, 0x86, 0xff, 0x25, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0xaf, 0x00, 0x00, 0xf1, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0x0e, 0x86, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xcc, 0xff, 0x02, 0x03, 0x00,
+  0x90, 0x8b, 0xff, 0x13, 0x00, 0x00, 0x80, 0xbb, 0xbb, 0xcb, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0x82, 0xff,
+  0x09, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x01, 0x86,
+  0x00, 0x84, 0xff, 0x00, 0x6f, 0x83, 0x00, 0x02, 0x40, 0xfe, 0x0b, 0x86,
+  0x00, 0x18, 0xf7, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f, 0x00, 0x00,
+  0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0x84, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x10, 0xff, 0x0f, 0x00, 0x00,
+  0x82, 0xff, 0x0c, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf5, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x30, 0x84, 0xff, 0x0a, 0x7f, 0x00, 0x00, 0xfd, 0x08, 0x00, 0xd0, 0xff,
+  0x0b, 0x00, 0x00, 0x82, 0xff, 0x0f, 0x00, 0x00, 0xb0, 0xff, 0x03, 0x00,
+  0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x30, 0x86, 0xff,
+  0x25, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x00,
+  0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0x9f, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x0f, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x0b, 0x86, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xcc, 0xff, 0x02,
+  0x04, 0x00, 0x70, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0c,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0x82,
+  0xff, 0x09, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x03,
+  0x85, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0x5c, 0x83, 0x00, 0x01, 0xf6,
+  0x0f, 0x86, 0x00, 0x18, 0xf7, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f,
+  0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0x84, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x4f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f,
+  0x00, 0x00, 0x82, 0xff, 0x0c, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x11, 0x7f, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x30, 0x84, 0xff, 0x0a, 0xcf, 0x00, 0x00, 0xf9, 0x04, 0x00,
+  0xf2, 0xff, 0x0c, 0x00, 0x00, 0x82, 0xff, 0x0f, 0x00, 0x00, 0xb0, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x30,
+  0x86, 0xff, 0x25, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x9f, 0x00, 0x00, 0xf0,
+  0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xbf, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0x0f, 0x86, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xc8,
+  0xff, 0x00, 0xfb, 0x82, 0xff, 0x05, 0x03, 0x00, 0x70, 0xff, 0xff, 0xfc,
+  0x88, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0c, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff,
+  0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00,
+  0x00, 0xf0, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x0b, 0x07,
+  0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x05, 0x00, 0x80, 0x8b,
+  0xff, 0x08, 0xae, 0x05, 0x00, 0x00, 0xf0, 0x0f, 0x00, 0x00, 0xfd, 0x85,
+  0xff, 0x16, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x09, 0x00,
+  0x30, 0x84, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x7f, 0x00, 0x00,
+  0xf4, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff,
+  0x0c, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x11, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x09,
+  0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x85,
+  0xff, 0x09, 0x01, 0x00, 0xf6, 0x01, 0x00, 0xf8, 0xff, 0x0f, 0x00, 0x00,
+  0x82, 0xff, 0x0f, 0x00, 0x00, 0xe0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x30, 0x86, 0xff, 0x28, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00, 0xb0, 0xff,
+  0xbf, 0x00, 0x00, 0xf3, 0xef, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0c, 0x00,
+  0x00, 0xfe, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f,
+  0x00, 0x00, 0xfd, 0xff, 0xff, 0xcc, 0xff, 0x0b, 0x9f, 0x60, 0xfe, 0xff,
+  0xaf, 0x00, 0x00, 0x90, 0xff, 0x19, 0x10, 0xf9, 0x87, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x83, 0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00,
+  0xfb, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff,
+  0x02, 0x0b, 0x00, 0x30, 0x82, 0xff, 0x0b, 0x07, 0x00, 0x30, 0xff, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0x07, 0x00, 0x50, 0x8c, 0xff, 0x07, 0xbf, 0x00,
+  0x00, 0xd0, 0x3f, 0x00, 0x00, 0xfa, 0x85, 0xff, 0x16, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x05, 0x00, 0x50, 0x84, 0xff, 0x11, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x9f, 0x00, 0x00, 0xf2, 0xff, 0xff, 0x02, 0x00,
+  0x80, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x0c, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x11,
+  0xcf, 0x00, 0x00, 0xe1, 0xff, 0xff, 0x05, 0x00, 0x50, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x85, 0xff, 0x1c, 0x05, 0x00, 0xd3,
+  0x00, 0x00, 0xfd, 0xff, 0x1f, 0x00, 0x00, 0xfa, 0xff, 0x9f, 0x00, 0x00,
+  0xf1, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x07,
+  0x00, 0x30, 0x86, 0xff, 0x28, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x4f, 0x00,
+  0x00, 0xf5, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x09, 0x00, 0x10, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xfa, 0xff, 0xff,
+  0xcc, 0xff, 0x0b, 0x09, 0x00, 0x72, 0xab, 0x06, 0x00, 0x00, 0xf1, 0xdf,
+  0x00, 0x00, 0xd0, 0x87, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0c,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x84, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x15, 0x0c, 0x00, 0x10, 0xfe,
+  0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x0b,
+  0x00, 0x00, 0xfc, 0xff, 0xff, 0xcb, 0x85, 0xff, 0x27, 0x9c, 0xff, 0xff,
+  0xef, 0x00, 0x00, 0xd0, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xaf, 0xfe,
+  0xff, 0xff, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x9f, 0x00, 0x00, 0xf3, 0xff,
+  0x07, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x80, 0xff, 0xcf, 0x01, 0x00,
+  0x90, 0x84, 0xff, 0x11, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xdf, 0x00, 0x00,
+  0xb0, 0xff, 0xbf, 0x00, 0x00, 0xd0, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff,
+  0x0c, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00,
+  0x00, 0xf0, 0x84, 0xff, 0x10, 0x00, 0x00, 0x80, 0xff, 0xcf, 0x01, 0x00,
+  0xa0, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x85, 0xff,
+  0x1c, 0x0a, 0x00, 0x90, 0x00, 0x20, 0xff, 0xff, 0x5f, 0x00, 0x00, 0xf5,
+  0xff, 0x4f, 0x00, 0x00, 0xf6, 0xff, 0x03, 0x00, 0xa0, 0xff, 0x1e, 0x00,
+  0x00, 0xf3, 0xff, 0x07, 0x00, 0x30, 0x86, 0xff, 0x2c, 0x0f, 0x00, 0x00,
+  0xf9, 0xff, 0x0c, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0x04, 0x00, 0x50, 0xff, 0xff, 0x04, 0x00, 0x60,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x7f, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xaf, 0xfe, 0xff, 0xff, 0xc8, 0xff, 0x00, 0x02,
+  0x85, 0x00, 0x04, 0xf9, 0xaf, 0x00, 0x00, 0xa0, 0x87, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x83, 0xff, 0x0d, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x00,
+  0x10, 0xd8, 0xff, 0x00, 0x00, 0x50, 0xf9, 0x83, 0xff, 0x0c, 0x3f, 0x00,
+  0x00, 0xfb, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84,
+  0xff, 0x16, 0x0f, 0x00, 0x00, 0x84, 0x75, 0xff, 0x07, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x00, 0xb0, 0xff, 0x5f, 0x00, 0x00, 0xa1, 0xcc, 0x5b, 0x10,
+  0xfe, 0x83, 0xff, 0x1b, 0xcf, 0x01, 0x82, 0xdc, 0x5c, 0x00, 0x00, 0xf0,
+  0xef, 0x01, 0x00, 0x30, 0xcb, 0xac, 0x02, 0xf4, 0xff, 0xff, 0x02, 0x00,
+  0x30, 0x68, 0xf5, 0xbf, 0x00, 0x00, 0x90, 0x6b, 0x82, 0x00, 0x01, 0xff,
+  0xff, 0x82, 0x00, 0x04, 0xc7, 0x3a, 0x00, 0x00, 0xe0, 0x84, 0xff, 0x11,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x06, 0x00, 0x10, 0xc9, 0x19, 0x00,
+  0x00, 0xf5, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x0c, 0xbf, 0x00, 0x00,
+  0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff,
+  0x10, 0x09, 0x00, 0x00, 0xc7, 0x1a, 0x00, 0x00, 0xf2, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x85, 0xff, 0x1c, 0x0f, 0x00, 0x20,
+  0x00, 0x60, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x50, 0xbb, 0x05, 0x00, 0x00,
+  0xfd, 0xff, 0x05, 0x00, 0x30, 0x9c, 0x02, 0x00, 0x00, 0xf3, 0xff, 0x07,
+  0x00, 0x30, 0x86, 0xff, 0x2c, 0x0f, 0x00, 0x00, 0x70, 0xac, 0x01, 0x00,
+  0x00, 0xfe, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0x0d, 0x00, 0x00, 0xb5, 0x5b, 0x00, 0x00, 0xd0, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xef, 0x01, 0x00, 0x30, 0xcb, 0xac,
+  0x02, 0xf4, 0xff, 0xff, 0xc8, 0xff, 0x00, 0x3e, 0x84, 0x00, 0x05, 0x90,
+  0xff, 0xcf, 0x00, 0x00, 0xc0, 0x87, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83,
+  0xff, 0x0d, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0a, 0x00, 0x00, 0x70, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x00, 0x3f,
+  0x82, 0x00, 0x0b, 0x10, 0xfe, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00,
+  0xb0, 0xff, 0xdf, 0x85, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x1c, 0x85,
+  0x00, 0x02, 0xf9, 0xff, 0x09, 0x84, 0x00, 0x03, 0x70, 0xff, 0xff, 0x07,
+  0x82, 0x00, 0x01, 0xc0, 0xef, 0x86, 0x00, 0x01, 0xff, 0xff, 0x86, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x06, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x0e,
+  0x85, 0x00, 0x04, 0xfe, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x0c, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x00, 0x2f, 0x85, 0x00, 0x09, 0xfc, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x30, 0x85, 0xff, 0x00, 0x4f, 0x82, 0x00, 0x00,
+  0xc0, 0x82, 0xff, 0x00, 0x07, 0x84, 0x00, 0x03, 0x70, 0xff, 0xff, 0x08,
+  0x85, 0x00, 0x04, 0xf3, 0xff, 0x07, 0x00, 0x30, 0x86, 0xff, 0x00, 0x0f,
+  0x85, 0x00, 0x0c, 0x90, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00,
+  0x00, 0xf3, 0xff, 0x7f, 0x85, 0x00, 0x0c, 0xf7, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x09, 0x84, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0xc9, 0xff, 0x00, 0x29, 0x82, 0x00, 0x06, 0x40, 0xfc, 0xff,
+  0xff, 0x04, 0x00, 0xf5, 0x87, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff,
+  0x0d, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x2f, 0x00, 0x00, 0x30, 0xff, 0x0a,
+  0x00, 0x00, 0xa0, 0x83, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03,
+  0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x00, 0xdf, 0x83,
+  0x00, 0x0b, 0xf7, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0xff, 0x1b, 0x84, 0x00, 0x00, 0xe5, 0x83, 0xff, 0x00, 0x3e, 0x84, 0x00,
+  0x03, 0x50, 0xff, 0xff, 0x8f, 0x84, 0x00, 0x03, 0x70, 0xff, 0xff, 0x0e,
+  0x82, 0x00, 0x02, 0x40, 0xff, 0x07, 0x82, 0x00, 0x04, 0x62, 0x00, 0x00,
+  0xff, 0xff, 0x85, 0x00, 0x00, 0x40, 0x85, 0xff, 0x07, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0xbf, 0x01, 0x83, 0x00, 0x05, 0xc0, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0x82, 0xff, 0x0c, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x01, 0xcf, 0x03, 0x83,
+  0x00, 0x0a, 0xa0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x30, 0x85, 0xff, 0x00, 0x9f, 0x82, 0x00, 0x00, 0xf1, 0x82, 0xff, 0x00,
+  0x6e, 0x84, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x1e, 0x82, 0x00, 0x07, 0x90,
+  0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x30, 0x86, 0xff, 0x00, 0x0f, 0x85,
+  0x00, 0x0d, 0xf5, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00,
+  0xf3, 0xff, 0xef, 0x06, 0x83, 0x00, 0x0d, 0x70, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x8f, 0x84, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0xca, 0xff, 0x03, 0xbd, 0x77, 0xb8, 0xfe, 0x82, 0xff,
+  0x01, 0xaf, 0xb7, 0x88, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0d,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0xcf, 0x03, 0x00, 0x00, 0xfe, 0x7f, 0x00,
+  0x00, 0x60, 0x83, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00,
+  0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0x85, 0xff, 0x10, 0x1b, 0x00, 0x00,
+  0x10, 0xf9, 0x07, 0x00, 0x30, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xff,
+  0xef, 0x06, 0x82, 0x00, 0x00, 0xc3, 0x85, 0xff, 0x00, 0x19, 0x82, 0x00,
+  0x01, 0x10, 0xf9, 0x82, 0xff, 0x00, 0x3d, 0x82, 0x00, 0x19, 0x60, 0xfe,
+  0xff, 0xff, 0xdf, 0x03, 0x00, 0x00, 0x70, 0xff, 0x6e, 0x00, 0x00, 0x50,
+  0xae, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0xe5,
+  0x85, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x6e, 0x82,
+  0x00, 0x06, 0x50, 0xfe, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x0c,
+  0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x85, 0xff, 0x00, 0x8f, 0x82, 0x00, 0x0b, 0x50, 0xfc, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x30, 0x85, 0xff, 0x00, 0xef,
+  0x82, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00, 0x1b, 0x82, 0x00, 0x00, 0xa3,
+  0x82, 0xff, 0x0b, 0xcf, 0x02, 0x00, 0x00, 0xfb, 0x03, 0x00, 0xf3, 0xff,
+  0x07, 0x00, 0x30, 0x86, 0xff, 0x06, 0x0f, 0x00, 0x00, 0x3d, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x19, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xbf, 0x01, 0x00, 0x00, 0x30, 0xfa, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x00, 0x3d, 0x82, 0x00,
+  0x01, 0x70, 0xfe, 0xff, 0xff, 0xe9, 0xff, 0x07, 0xbf, 0x78, 0xc8, 0xff,
+  0xff, 0xad, 0x77, 0xea, 0x97, 0xff, 0x02, 0x9b, 0x87, 0xfb, 0x8c, 0xff,
+  0x02, 0xbd, 0x97, 0xfb, 0x87, 0xff, 0x03, 0xbd, 0x77, 0xa7, 0xfd, 0x84,
+  0xff, 0x02, 0xbf, 0x7a, 0xca, 0x84, 0xff, 0x02, 0xbf, 0x7a, 0xb7, 0x82,
+  0xff, 0x01, 0xac, 0xb7, 0x85, 0xff, 0x05, 0x00, 0x00, 0xb0, 0xcf, 0x79,
+  0xda, 0x8e, 0xff, 0x03, 0xcf, 0x7a, 0xb9, 0xfe, 0x9c, 0xff, 0x03, 0xdf,
+  0x7b, 0xb8, 0xfe, 0x91, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xfd, 0x84, 0xff,
+  0x02, 0xbe, 0x78, 0xcb, 0x84, 0xff, 0x02, 0xbe, 0x98, 0xfd, 0x8e, 0xff,
+  0x06, 0x0f, 0x00, 0x00, 0xff, 0x9c, 0xb7, 0xfe, 0x8d, 0xff, 0x03, 0xef,
+  0x8b, 0xb7, 0xfd, 0x8e, 0xff, 0x02, 0xbf, 0x79, 0xdb, 0xff, 0xff, 0xff,
+  0xff, 0xc5, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xc8, 0xff, 0x02, 0x1c, 0x00,
+  0x30, 0x9f, 0xff, 0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xed,
+  0xff, 0x02, 0x00, 0x00, 0xb0, 0xc7, 0xff, 0x03, 0xaf, 0x01, 0x00, 0xb0,
+  0x9f, 0xff, 0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0xc6, 0xff, 0x04, 0x59, 0x02, 0x00, 0x00, 0xf5,
+  0x9f, 0xff, 0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0xc6, 0xff, 0x03, 0x07, 0x00, 0x00, 0x50, 0xa0,
+  0xff, 0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0xc6, 0xff, 0x03, 0x09, 0x00, 0x10, 0xf9, 0xa0, 0xff,
+  0x02, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0x02, 0x00,
+  0x32, 0xd3, 0xc6, 0xff, 0x02, 0x0b, 0x42, 0xf8, 0xa1, 0xff, 0x02, 0x0f,
+  0x20, 0x43, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf4, 0xff
+};
+const uint32_t setup_4bpp_len = 21808;
@@ -1,20 +1,32 @@
 #include "setup_mode.h"
 #include "config.h"
 #include "render.h"
+#include "tls_session.h"
+#include "button_input.h"
 
 #include <Arduino.h>
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 #include <HTTPClient.h>
 #include <DNSServer.h>
 #include <WebServer.h>
 #include <esp_mac.h>
 #include <esp_system.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
 
 // ─── tunables ────────────────────────────────────────────────────────────────
 
 #define IDLE_TIMEOUT_MS  (3UL * 60UL * 1000UL)  // 3 min of no HTTP activity
-#define WIFI_CONNECT_MS  20000                  // STA connect timeout in /save
+#define WIFI_CONNECT_MS  20000                  // STA connect timeout in a connect/save job
+#define JOB_STACK_BYTES  12288                  // HTTPS (mbedTLS) needs the headroom
+// A saved config restarts the chip once the page has polled the result, or
+// after this long if it never does (the phone dropped off the AP).
+#define SAVE_RESTART_MS  1000
+#define SAVE_UNSEEN_MS   15000
+#define SCAN_REFRESH_MS  60000                  // background rescan period
+#define SCAN_RETRY_MS    5000                   // rescan after a failed scan
+#define SCAN_MAX_NETS    30                     // dropdown entries kept
 #define DNS_PORT         53
 #define HTTP_PORT        80
 
@@ -32,6 +44,8 @@ static unsigned long lastActivityMs = 0;
 //           the registered location list from the worker.
 //   Step 2: pick location from dropdown → POST /save → verifies + writes NVS
 //           + restarts the chip.
+// Both run in the background (see "background connect / save"): the POST
+// answers 202 and the page polls GET /status for the result.
 // Kept as a raw string literal so we don't need a build step to bundle it.
 
 static const char FORM_HTML[] PROGMEM = R"HTML(<!DOCTYPE html>
@@ -120,19 +134,24 @@ static const char FORM_HTML[] PROGMEM = R"HTML(<!DOCTYPE html>
   }
 
   // ── Populate SSID dropdown from /scan on page load ──
-  const scanP = fetch('/scan').then(r => r.json()).then(networks => {
+  // Served from the device's scan cache: one entry per SSID, strongest first.
+  // 202 only in the first seconds after the AP comes up, before the first scan
+  // has finished (or failed: that answers an empty list).
+  async function fetchScan() {
+    for (;;) {
+      const res = await fetch('/scan');
+      if (res.status !== 202) return res.json();
+      await new Promise(r => setTimeout(r, 500));
+    }
+  }
+  const scanP = fetchScan().then(networks => {
     const sel = document.getElementById('ssid');
     sel.innerHTML = '';
     if (!networks.length) {
       sel.innerHTML = '<option value="">No networks found — refresh page</option>';
       return;
     }
-    const seen = new Map();
     networks.forEach(n => {
-      const prev = seen.get(n.ssid);
-      if (!prev || n.rssi > prev.rssi) seen.set(n.ssid, n);
-    });
-    Array.from(seen.values()).sort((a,b) => b.rssi - a.rssi).forEach(n => {
       const opt = document.createElement('option');
       opt.value = n.ssid;
       opt.textContent = n.ssid + (n.locked ? ' \u{1F512}' : '');
@@ -197,6 +216,29 @@ static const char FORM_HTML[] PROGMEM = R"HTML(<!DOCTYPE html>
     status.textContent = '';
   }
 
+  // /connect and /save answer 202 straight away and carry on in the
+  // background; /status answers 202 (with the current stage) until the job
+  // is done, then with the job's final response.
+  const STAGES = {
+    wifi:   'Connecting to WiFi…',
+    server: 'Reaching the weather server…',
+    saving: 'Saving…',
+  };
+  async function runJob(url, body, btn) {
+    let res = await fetch(url, { method: 'POST', body });
+    let misses = 0;
+    while (res.status === 202) {
+      const st = await res.json();
+      if (STAGES[st.stage]) btn.textContent = STAGES[st.stage];
+      for (;;) {
+        await new Promise(r => setTimeout(r, 500));
+        try { res = await fetch('/status'); break; }
+        catch (e) { if (++misses > 10) throw e; }  // a dropped poll isn't fatal
+      }
+    }
+    return res;
+  }
+
   // ── Step 1: connect to WiFi, fetch location list ──
   document.getElementById('step1').addEventListener('submit', async e => {
     e.preventDefault();
@@ -207,7 +249,7 @@ static const char FORM_HTML[] PROGMEM = R"HTML(<!DOCTYPE html>
 
     const formData = new FormData(e.target);
     try {
-      const res = await fetch('/connect', { method: 'POST', body: formData });
+      const res = await runJob('/connect', formData, btn);
       const json = await res.json();
       if (!json.ok) {
         showError(json.error || 'Connection failed.');
@@ -254,7 +296,7 @@ static const char FORM_HTML[] PROGMEM = R"HTML(<!DOCTYPE html>
     fd.set('password', creds.password);
 
     try {
-      const res = await fetch('/save', { method: 'POST', body: fd });
+      const res = await runJob('/save', fd, btn);
       const txt = await res.text();
       if (res.ok) {
         const status = document.getElementById('status');
@@ -314,24 +356,109 @@ static void handleRoot() {
     http.send_P(200, "text/html", FORM_HTML);
 }
 
-static void handleScan() {
-    touchActivity();
-    Serial.println("Setup: scanning WiFi");
-    int n = WiFi.scanNetworks(/*async=*/false, /*show_hidden=*/false);
-    String json = "[";
+// ─── background scan cache ───────────────────────────────────────────────────
+// A synchronous scan takes seconds, and /scan is the form's first request — the
+// captive-portal browser sat on a blank dropdown while the web server stalled.
+// Instead an async scan starts as soon as the AP is up, the loop collects it
+// into a cached JSON list (one entry per SSID at its strongest RSSI, strongest
+// first) and rescans every SCAN_REFRESH_MS; /scan just serves the cache. No
+// scan starts while a connect/save job has the STA side.
+//
+// A failed scan keeps the list it had, or caches an empty one if there was
+// none — the form then shows "No networks found" instead of polling for a list
+// that never comes — and is retried after SCAN_RETRY_MS.
+
+static String        scanJson;              // cached /scan body; empty until the first scan
+static bool          scanRunning = false;
+static bool          scanFailed  = false;   // the last scan failed
+static unsigned long scanAtMs    = 0;       // when the last scan finished (or failed)
+
+static bool jobRunning();
+
+static void failScan(const char *what) {
+    Serial.printf("Setup: %s\n", what);
+    scanFailed = true;
+    scanAtMs   = millis();
+    if (scanJson.length() == 0) scanJson = "[]";
+}
+
+static void startScan() {
+    if (WiFi.scanNetworks(/*async=*/true, /*show_hidden=*/false) == WIFI_SCAN_FAILED) {
+        failScan("scan start failed");
+        return;
+    }
+    scanRunning = true;
+}
+
+// Turns the finished scan into the cached JSON list.
+static void collectScan(int n) {
+    struct Net { int idx; int32_t rssi; };
+    Net nets[SCAN_MAX_NETS];
+    int count = 0;
     for (int i = 0; i < n; i++) {
-        if (i > 0) json += ",";
+        String ssid = WiFi.SSID(i);
+        if (ssid.length() == 0) continue;
+        int32_t rssi = WiFi.RSSI(i);
+        int j = 0;
+        while (j < count && WiFi.SSID(nets[j].idx) != ssid) j++;
+        if (j < count) {
+            if (rssi > nets[j].rssi) nets[j] = { i, rssi };
+        } else if (count < SCAN_MAX_NETS) {
+            nets[count++] = { i, rssi };
+        }
+    }
+    // Strongest first (insertion sort — a few dozen entries at most).
+    for (int i = 1; i < count; i++) {
+        Net t = nets[i];
+        int j = i;
+        while (j > 0 && nets[j - 1].rssi < t.rssi) { nets[j] = nets[j - 1]; j--; }
+        nets[j] = t;
+    }
+
+    String json = "[";
+    for (int k = 0; k < count; k++) {
+        int i = nets[k].idx;
+        if (k > 0) json += ",";
         json += "{\"ssid\":";
         appendJsonString(json, WiFi.SSID(i));
-        json += ",\"rssi\":" + String(WiFi.RSSI(i));
+        json += ",\"rssi\":" + String(nets[k].rssi);
         json += ",\"locked\":";
         json += (WiFi.encryptionType(i) != WIFI_AUTH_OPEN) ? "true" : "false";
         json += "}";
     }
     json += "]";
-    Serial.printf("Setup: scan found %d networks\n", n);
-    WiFi.scanDelete();
-    http.send(200, "application/json", json);
+    scanJson = json;
+    Serial.printf("Setup: scan found %d networks (%d SSIDs)\n", n, count);
+}
+
+// Called from the setup loop: collects a finished scan, starts the next one.
+static void serviceScan() {
+    if (scanRunning) {
+        int16_t n = WiFi.scanComplete();
+        if (n == WIFI_SCAN_RUNNING) return;
+        scanRunning = false;
+        if (n >= 0) {
+            scanFailed = false;
+            scanAtMs   = millis();
+            collectScan(n);
+        } else {
+            failScan("scan failed");
+        }
+        WiFi.scanDelete();
+        return;
+    }
+    bool due = scanJson.length() == 0
+            || millis() - scanAtMs >= (scanFailed ? SCAN_RETRY_MS : SCAN_REFRESH_MS);
+    if (due && !jobRunning()) startScan();
+}
+
+static void handleScan() {
+    touchActivity();
+    if (scanJson.length() == 0) {
+        http.send(202, "application/json", "{\"pending\":true}");
+        return;
+    }
+    http.send(200, "application/json", scanJson);
 }
 
 // Try connecting STA to the given network. AP stays up (we're in AP_STA mode).
@@ -361,8 +488,7 @@ static bool tryConnectIfNeeded(const char *ssid, const char *password) {
 // Fetch JSON from a URL into the given String. Returns the HTTP status code,
 // or -1 on transport error.
 static int httpsGetString(const String &url, String &out) {
-    WiFiClientSecure client;
-    client.setInsecure();
+    ResumableTlsClient client;
     HTTPClient h;
     h.begin(client, url);
     h.setTimeout(10000);
@@ -415,29 +541,78 @@ static void handleReset() {
     esp_restart();
 }
 
-// Step 1 endpoint. Connects STA to the user's WiFi, then fetches the slim
-// location list from the worker so the form can populate its zip dropdown.
-// Errors distinguish between bad WiFi creds and an unreachable/empty server
-// so the user can diagnose what's actually wrong.
-static void handleConnect() {
-    touchActivity();
-    String ssid     = http.arg("ssid");
-    String password = http.arg("password");
+// ─── background connect / save ───────────────────────────────────────────────
+// /connect and /save each take seconds — a STA association of up to
+// WIFI_CONNECT_MS, then an HTTPS request to the worker. Inside the request
+// handler that starved the DNS server, every other request and the button, so
+// captive-portal probes went unanswered and phones dropped the AP mid-setup.
+// Now the handler only validates the form and starts a job on its own task,
+// answering 202; the page polls GET /status, which answers 202 with the job's
+// stage until it's done and then replays its final response (as often as
+// asked, until the next job). One job at a time.
+
+enum JobKind  { JOB_CONNECT, JOB_SAVE };
+enum JobState { JOB_IDLE, JOB_RUNNING, JOB_DONE };
+
+struct SetupJob {
+    JobKind       kind;
+    JobState      state;
+    String        ssid, password, zip;  // the form; fixed while the job runs
+    const char   *stage;                // "wifi" / "server" / "saving"
+    int           code;                 // final response, once done
+    const char   *type;
+    String        body;
+    bool          saved;                // config written — restart pending
+    unsigned long doneMs;
+};
+
+// Everything but the form fields is shared with the job task: under jobLock.
+static SetupJob          job;
+static SemaphoreHandle_t jobLock        = nullptr;
+static bool              restartPending = false;  // result delivered, restart at restartAtMs
+static unsigned long     restartAtMs    = 0;
+
+static void lockJob()   { xSemaphoreTake(jobLock, portMAX_DELAY); }
+static void unlockJob() { xSemaphoreGive(jobLock); }
+
+static void setStage(const char *stage) {
+    lockJob();
+    job.stage = stage;
+    unlockJob();
+}
 
-    if (ssid.length() == 0) {
-        http.send(400, "application/json",
-                  "{\"ok\":false,\"error\":\"Pick a WiFi network.\"}");
-        return;
-    }
+static void finishJob(int code, const char *type, const String &body, bool saved = false) {
+    lockJob();
+    job.code   = code;
+    job.type   = type;
+    job.body   = body;
+    job.saved  = saved;
+    job.doneMs = millis();
+    job.state  = JOB_DONE;
+    unlockJob();
+}
 
-    if (!tryConnectIfNeeded(ssid.c_str(), password.c_str())) {
+static bool jobRunning() {
+    lockJob();
+    bool running = job.state == JOB_RUNNING;
+    unlockJob();
+    return running;
+}
+
+// Step 1. Connects STA to the user's WiFi, then fetches the slim location list
+// from the worker so the form can populate its zip dropdown. Errors distinguish
+// between bad WiFi creds and an unreachable/empty server so the user can
+// diagnose what's actually wrong.
+static void runConnect() {
+    if (!tryConnectIfNeeded(job.ssid.c_str(), job.password.c_str())) {
         WiFi.disconnect(false);  // keep AP up
-        http.send(400, "application/json",
+        finishJob(400, "application/json",
                   "{\"ok\":false,\"error\":\"Couldn't connect to that WiFi. "
                   "Check the network name and password.\"}");
         return;
     }
 
+    setStage("server");
     String url = String(SERVER_BASE_URL) + "/locations";
     String body;
     int code = httpsGetString(url, body);
@@ -451,12 +626,12 @@ static void handleConnect() {
                  "{\"ok\":false,\"error\":\"Connected to WiFi, but couldn't reach "
                  "the weather server (HTTP %d). The server may be down — try again "
                  "in a minute.\"}", code);
-        http.send(502, "application/json", msg);
+        finishJob(502, "application/json", msg);
         return;
     }
 
     if (body == "[]") {
-        http.send(502, "application/json",
+        finishJob(502, "application/json",
                   "{\"ok\":false,\"error\":\"Reached the weather server, but it has "
                   "no locations registered. Ask the device's owner to add one on "
                   "the admin page.\"}");
@@ -464,51 +639,136 @@ static void handleConnect() {
     }
 
     // Forward the location list verbatim — already JSON.
-    String resp = "{\"ok\":true,\"locations\":" + body + "}";
-    http.send(200, "application/json", resp);
+    finishJob(200, "application/json", "{\"ok\":true,\"locations\":" + body + "}");
 }
 
-static void handleSave() {
-    touchActivity();
-    String ssid     = http.arg("ssid");
-    String password = http.arg("password");
-    String zip      = http.arg("zip");
-
-    if (ssid.length() == 0) {
-        http.send(400, "text/plain", "Pick a WiFi network.");
-        return;
-    }
-    if (zip.length() != 5) {
-        http.send(400, "text/plain", "Pick a location.");
-        return;
-    }
-
-    if (!tryConnectIfNeeded(ssid.c_str(), password.c_str())) {
+// Step 2. Verifies the zip end to end, then writes the config. The restart
+// happens on the main loop once the page has the result.
+static void runSave() {
+    if (!tryConnectIfNeeded(job.ssid.c_str(), job.password.c_str())) {
         WiFi.disconnect(false);
-        http.send(400, "text/plain",
+        finishJob(400, "text/plain",
                   "Couldn't connect to that WiFi. Check SSID & password.");
         return;
     }
 
-    if (!tryFetchTest(zip)) {
+    setStage("server");
+    if (!tryFetchTest(job.zip)) {
         WiFi.disconnect(false);
-        http.send(400, "text/plain",
+        finishJob(400, "text/plain",
                   "Connected to WiFi, but couldn't fetch weather for that zip. "
                   "The server may be down or the location was just removed.");
         return;
     }
 
+    setStage("saving");
     DeviceConfig cfg;
-    cfg.ssid     = ssid;
-    cfg.password = password;
-    cfg.zip      = zip;
+    cfg.ssid     = job.ssid;
+    cfg.password = job.password;
+    cfg.zip      = job.zip;
     saveConfig(cfg);
+    Serial.println("Setup: config saved");
+    finishJob(200, "text/plain",
+              "Saved! The device will restart and start showing weather.", /*saved=*/true);
+}
 
-    http.send(200, "text/plain",
-              "Saved! The device will restart and start showing weather.");
-    Serial.println("Setup: config saved, restarting in 1s");
-    delay(1000);  // give the response time to flush over WiFi
-    esp_restart();
+static void jobTask(void *) {
+    // An in-flight background scan would make the STA connect fail.
+    while (WiFi.scanComplete() == WIFI_SCAN_RUNNING) delay(50);
+    if (job.kind == JOB_CONNECT) runConnect();
+    else                         runSave();
+    vTaskDelete(nullptr);
+}
+
+// Starts a job and answers 202. Answers 409 + `busyBody` if one is already
+// running, or 500 + `failBody` if its task can't be created; both as `type`.
+static void startJob(JobKind kind, const char *busyBody, const char *failBody,
+                     const char *type) {
+    if (jobRunning()) {
+        http.send(409, type, busyBody);
+        return;
+    }
+    lockJob();
+    job.kind     = kind;
+    job.ssid     = http.arg("ssid");
+    job.password = http.arg("password");
+    job.zip      = http.arg("zip");
+    job.stage    = "wifi";
+    job.body     = "";
+    job.saved    = false;
+    job.state    = JOB_RUNNING;
+    unlockJob();
+    if (xTaskCreate(jobTask, "setup-job", JOB_STACK_BYTES, nullptr, 1, nullptr) != pdPASS) {
+        Serial.println("Setup: job task create failed");
+        lockJob();
+        job.state = JOB_IDLE;
+        unlockJob();
+        http.send(500, type, failBody);
+        return;
+    }
+    http.send(202, "application/json", "{\"pending\":true,\"stage\":\"wifi\"}");
+}
+
+static void handleConnect() {
+    touchActivity();
+    if (http.arg("ssid").length() == 0) {
+        http.send(400, "application/json",
+                  "{\"ok\":false,\"error\":\"Pick a WiFi network.\"}");
+        return;
+    }
+    startJob(JOB_CONNECT, "{\"ok\":false,\"error\":\"Still busy — try again.\"}",
+             "{\"ok\":false,\"error\":\"Out of memory — restart the device.\"}",
+             "application/json");
+}
+
+static void handleSave() {
+    touchActivity();
+    if (http.arg("ssid").length() == 0) {
+        http.send(400, "text/plain", "Pick a WiFi network.");
+        return;
+    }
+    if (http.arg("zip").length() != 5) {
+        http.send(400, "text/plain", "Pick a location.");
+        return;
+    }
+    startJob(JOB_SAVE, "Still busy — try again.", "Out of memory — restart the device.",
+             "text/plain");
+}
+
+// Progress of the current job: 202 + stage while it runs, then its response.
+static void handleStatus() {
+    touchActivity();
+    lockJob();
+    JobState state = job.state;
+    String stage = job.stage ? job.stage : "";
+    int code = job.code;
+    const char *type = job.type;
+    String body = job.body;
+    bool saved = job.saved;
+    unlockJob();
+
+    if (state == JOB_IDLE) {
+        http.send(404, "application/json",
+                  "{\"ok\":false,\"error\":\"Nothing in progress.\"}");
+    } else if (state == JOB_RUNNING) {
+        http.send(202, "application/json", "{\"pending\":true,\"stage\":\"" + stage + "\"}");
+    } else {
+        http.send(code, type, body);
+        if (saved && !restartPending) {
+            restartPending = true;
+            restartAtMs    = millis() + SAVE_RESTART_MS;  // let the response flush
+        }
+    }
+}
+
+// A saved config restarts the chip: shortly after the page has seen the
+// result, or SAVE_UNSEEN_MS after the save if it never polls.
+static bool restartDue() {
+    if (restartPending) return (long)(millis() - restartAtMs) >= 0;
+    lockJob();
+    bool due = job.state == JOB_DONE && job.saved && millis() - job.doneMs >= SAVE_UNSEEN_MS;
+    unlockJob();
+    return due;
 }
 
 // Captive-portal fallback: redirect anything else to the form. iOS/Android
@@ -544,11 +804,19 @@ void enterSetupMode() {
     // captive-portal probe from us, which triggers the auto-popup behavior.
     dns.start(DNS_PORT, "*", apIp);
 
+    if (!jobLock) jobLock = xSemaphoreCreateMutex();
+    job.state      = JOB_IDLE;
+    restartPending = false;
+    scanJson       = "";
+    scanFailed     = false;
+    startScan();  // results are ready by the time the phone has joined the AP
+
     http.on("/", handleRoot);
     http.on("/scan", handleScan);
     http.on("/current", handleCurrent);
     http.on("/connect", HTTP_POST, handleConnect);
     http.on("/save", HTTP_POST, handleSave);
+    http.on("/status", handleStatus);
     http.on("/reset", HTTP_POST, handleReset);
     http.onNotFound(handleNotFound);
     http.begin();
@@ -556,30 +824,48 @@ void enterSetupMode() {
     lastActivityMs = millis();
     Serial.printf("Setup: idle timeout = %lu ms\n", IDLE_TIMEOUT_MS);
 
-    // Run until idle timeout, a successful save (handleSave() esp_restart()s and
+    // Run until idle timeout, a successful save (the loop esp_restart()s and
     // never returns), or a long-press of the button to exit. On any exit the
     // caller performs the Home transition (weather / splash).
-    pinMode(BUTTON_GPIO, INPUT_PULLUP);
-    // The press that opened setup may still be held — wait for release so it
-    // isn't immediately read as an exit press.
-    while (digitalRead(BUTTON_GPIO) == LOW) delay(10);
+    // The press that opened setup may still be held; the input queue treats it
+    // as spent, so only a new press counts. No light sleep: the loop below
+    // wakes every 10 ms for the web server and the AP keeps the radio up, so
+    // it would only slow the server down.
+    buttonBegin(/*lightSleep=*/false);
 
     // Any button press (short or long) exits setup → Home, matching every other
     // screen. The phone/web form is the real interaction here; the button is just
-    // an escape hatch, so a tap and a hold both simply back out.
+    // an escape hatch, so a tap and a hold both simply back out. The web server
+    // has to be serviced, so this wakes every 10 ms anyway (and the AP keeps the
+    // radio up) — the 10 ms wait is on the button queue rather than a delay().
     while (millis() - lastActivityMs < IDLE_TIMEOUT_MS) {
         dns.processNextRequest();
         http.handleClient();
+        serviceScan();
+
+        if (restartDue()) {
+            Serial.println("Setup: config saved, restarting");
+            esp_restart();
+        }
+        if (jobRunning()) touchActivity();  // a slow job isn't idleness
 
-        if (digitalRead(BUTTON_GPIO) == LOW) {
-            delay(20);  // debounce
-            if (digitalRead(BUTTON_GPIO) == LOW) {
-                Serial.println("Setup: button press — exiting.");
-                while (digitalRead(BUTTON_GPIO) == LOW) delay(10);  // wait for release
-                break;
-            }
+        ButtonEvent ev;
+        if (buttonWait(ev, 10) && ev.kind == BE_PRESS) {
+            Serial.println("Setup: button press — exiting.");
+            break;
         }
-        delay(10);
+    }
+
+    // A job still running owns the STA side; let it finish (it's bounded by
+    // the connect and HTTP timeouts) before the radio goes. If it saved a new
+    // config, restart into it rather than returning with the old one.
+    while (jobRunning()) delay(50);
+    lockJob();
+    bool saved = job.state == JOB_DONE && job.saved;
+    unlockJob();
+    if (saved) {
+        Serial.println("Setup: config saved, restarting");
+        esp_restart();
     }
 
     // Tear down the AP on any exit path. The caller repaints Home (weather /
@@ -1,990 +0,0 @@
-// Auto-generated by scripts/bake-setup.sh from worker/renderer/setup.png.
-// Do not edit by hand — re-run the script if the setup screen changes.
-#pragma once
-#include <stdint.h>
-
-const uint8_t setup_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x1c,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x98, 0xa7, 0x00, 0x00, 0x2d,
-  0xce, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0xeb, 0x99, 0xaa,
-  0x3c, 0x17, 0x86, 0xd3, 0x01, 0x74, 0xa0, 0x1d, 0xe8, 0x75, 0x7d, 0x05,
-  0x60, 0x07, 0x4e, 0x07, 0xda, 0x81, 0xd3, 0x01, 0x74, 0xe0, 0x74, 0x80,
-  0x1d, 0x30, 0x1d, 0x60, 0x07, 0x94, 0x40, 0x09, 0x94, 0xc0, 0xf7, 0x92,
-  0xe3, 0x0a, 0x04, 0x4f, 0xe0, 0x61, 0xcd, 0x7e, 0xee, 0x1f, 0x7b, 0x3b,
-  0x18, 0x92, 0x10, 0x73, 0x93, 0x03, 0x01, 0x44, 0x0b, 0x00, 0x60, 0x8b,
-  0x78, 0x77, 0x06, 0x00, 0x00, 0x8f, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04,
-  0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03,
-  0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6,
-  0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80,
-  0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01,
-  0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60,
-  0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x10,
-  0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c,
-  0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18,
-  0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00,
-  0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06,
-  0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81,
-  0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40,
-  0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31,
-  0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60,
-  0x0c, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00,
-  0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0xdc, 0x04,
-  0x6e, 0x7e, 0xbe, 0xd6, 0x9b, 0x7d, 0xf1, 0xee, 0x6c, 0x00, 0xf0, 0x19,
-  0x30, 0x13, 0xb8, 0x5c, 0x0a, 0xc9, 0x57, 0xf3, 0xee, 0x9c, 0x00, 0xf0,
-  0x09, 0xf0, 0x12, 0xb8, 0x8e, 0x85, 0xe6, 0xeb, 0xdd, 0x59, 0x01, 0xe0,
-  0x13, 0xe0, 0x25, 0xf0, 0x56, 0x58, 0xd0, 0x8b, 0x06, 0x80, 0x9b, 0xc0,
-  0xce, 0x5f, 0x91, 0xbe, 0x3b, 0x2f, 0x00, 0x7c, 0x00, 0xac, 0x04, 0xae,
-  0x89, 0xc0, 0xc9, 0xbb, 0x33, 0x03, 0xc0, 0x07, 0xc0, 0x4a, 0xe0, 0x86,
-  0x08, 0xbc, 0x7d, 0x77, 0x66, 0x00, 0xf8, 0x00, 0x26, 0x0b, 0x9c, 0x67,
-  0x84, 0xf3, 0xf9, 0x7c, 0x9e, 0x27, 0x5f, 0x61, 0x22, 0x74, 0xa1, 0x01,
-  0xa0, 0x4c, 0x16, 0x38, 0x11, 0x7d, 0x96, 0x5f, 0xd9, 0xb3, 0x2c, 0x3e,
-  0xb8, 0x54, 0xaa, 0x27, 0x25, 0x01, 0x00, 0x27, 0x9e, 0x20, 0x70, 0x47,
-  0xbc, 0x7f, 0x8e, 0x60, 0x2b, 0x93, 0xc0, 0xf1, 0x29, 0xd1, 0xcf, 0x4b,
-  0x75, 0xfe, 0xa9, 0xdf, 0x9d, 0x07, 0xf0, 0xc7, 0x79, 0x92, 0xc0, 0x42,
-  0x88, 0x75, 0x39, 0x4f, 0x0e, 0x3d, 0x9a, 0x9d, 0x8c, 0x3b, 0xca, 0x9f,
-  0x10, 0xf7, 0x7c, 0x94, 0x59, 0xb6, 0xd9, 0xc8, 0x8c, 0x3e, 0xa3, 0x0c,
-  0x00, 0x70, 0x3c, 0x4f, 0xe0, 0x27, 0x2d, 0x97, 0xaa, 0xf2, 0x34, 0x2d,
-  0x3f, 0x7c, 0x1d, 0x96, 0x2b, 0x13, 0x08, 0x0c, 0x9e, 0xcb, 0x33, 0x05,
-  0x16, 0xf1, 0x67, 0x37, 0x94, 0x4f, 0x03, 0x02, 0x83, 0x57, 0xf1, 0x54,
-  0x81, 0x85, 0xf8, 0x37, 0x0d, 0x86, 0xc0, 0xe0, 0x55, 0x3c, 0x59, 0xe0,
-  0x7f, 0xd3, 0x60, 0x08, 0x0c, 0x5e, 0xc5, 0x8c, 0x02, 0xaf, 0xca, 0xb2,
-  0x2c, 0xd3, 0x74, 0xeb, 0x1b, 0xfc, 0x2f, 0xce, 0xc3, 0x42, 0x60, 0xf0,
-  0x2a, 0x66, 0x14, 0xd8, 0x2c, 0x6e, 0x6c, 0x72, 0xb2, 0xde, 0x42, 0xec,
-  0xa6, 0xe7, 0x91, 0x1d, 0x10, 0x18, 0xbc, 0x8a, 0x27, 0x08, 0xdc, 0xb6,
-  0xd5, 0x8a, 0x18, 0x3c, 0xb8, 0x20, 0xfc, 0x9b, 0x6d, 0xd6, 0xdd, 0x17,
-  0xeb, 0xaf, 0xd3, 0x9c, 0xcd, 0xf3, 0xe9, 0xfb, 0x52, 0xb4, 0xf6, 0xdb,
-  0xfd, 0x6d, 0x89, 0xfe, 0xee, 0x37, 0xea, 0xd6, 0xe3, 0xcd, 0xf7, 0x6f,
-  0x70, 0xce, 0xbb, 0xce, 0xbe, 0x36, 0xdd, 0xcd, 0x8d, 0xf1, 0x26, 0x1b,
-  0x1c, 0xe1, 0x8c, 0x02, 0x97, 0xfb, 0xb5, 0xca, 0x05, 0x16, 0xae, 0x80,
-  0x10, 0x4f, 0x11, 0xb8, 0x6d, 0x48, 0x1b, 0xbc, 0xf1, 0xc3, 0x9f, 0x96,
-  0xb4, 0x83, 0xbd, 0xb1, 0x35, 0xbc, 0x12, 0xa1, 0x88, 0xda, 0xd2, 0x6d,
-  0x6e, 0xbc, 0xbf, 0xfc, 0x58, 0x9b, 0x9f, 0x91, 0x68, 0x43, 0xdf, 0x7e,
-  0x5d, 0x53, 0xb8, 0xde, 0xc7, 0xc2, 0xdb, 0x61, 0xe0, 0x61, 0xb9, 0xa1,
-  0xdf, 0x2f, 0x4f, 0xf6, 0x8b, 0x54, 0x04, 0xe9, 0x7d, 0x97, 0x0c, 0x83,
-  0xa7, 0xfd, 0x2d, 0x29, 0x79, 0x7e, 0x81, 0x3c, 0xa6, 0x7f, 0x71, 0x30,
-  0x02, 0xae, 0xf1, 0x1c, 0x81, 0xbd, 0x7a, 0x4c, 0x2b, 0x5e, 0xe9, 0x9b,
-  0x41, 0x2f, 0x16, 0x3b, 0xe7, 0x63, 0xb2, 0xc3, 0xd1, 0x6e, 0xdd, 0xb6,
-  0xe3, 0x02, 0xff, 0x0c, 0xa2, 0xa5, 0xd5, 0x3d, 0x1f, 0x7c, 0xfb, 0x7d,
-  0xf1, 0x42, 0x72, 0x36, 0x08, 0x2f, 0xd6, 0x5e, 0x03, 0xd8, 0x6c, 0xfa,
-  0xdf, 0x2f, 0xcd, 0xf7, 0x61, 0x81, 0x17, 0xbd, 0xef, 0x6e, 0x11, 0x78,
-  0xd7, 0x36, 0x5f, 0x5e, 0x24, 0xff, 0xea, 0x45, 0x39, 0x70, 0x89, 0x27,
-  0x09, 0xdc, 0x2e, 0x5c, 0xc5, 0x23, 0xf5, 0x2e, 0x0f, 0x54, 0xee, 0xb5,
-  0x56, 0x6d, 0xe7, 0x36, 0x11, 0x5b, 0xb6, 0x5e, 0x34, 0x23, 0x02, 0xef,
-  0x03, 0xd1, 0xc6, 0x3f, 0x17, 0x13, 0xbd, 0x60, 0x70, 0x28, 0x36, 0x21,
-  0x32, 0x17, 0xa0, 0x1a, 0x0a, 0x2e, 0x62, 0xfd, 0x80, 0x81, 0xb0, 0xc0,
-  0x49, 0xef, 0xbb, 0x5b, 0x04, 0x4e, 0xda, 0x75, 0x3f, 0x1a, 0x8c, 0xa8,
-  0x41, 0x9f, 0x67, 0x09, 0x4c, 0x2a, 0xb2, 0x9b, 0xc6, 0x0a, 0xa9, 0x24,
-  0x44, 0xac, 0x0c, 0x2e, 0xdc, 0x16, 0xa2, 0xbc, 0x73, 0xa5, 0x1e, 0x13,
-  0xb8, 0x19, 0x54, 0x74, 0xc9, 0x42, 0x3b, 0x1a, 0xf6, 0x71, 0xdc, 0xe0,
-  0x70, 0x78, 0x72, 0x56, 0x09, 0xf9, 0x6b, 0x33, 0x1d, 0x16, 0x38, 0xed,
-  0x7d, 0x77, 0x8b, 0xc0, 0x62, 0x98, 0x91, 0x18, 0x03, 0x61, 0xd0, 0xe3,
-  0x59, 0x02, 0x93, 0x21, 0xed, 0xd2, 0x6c, 0x0b, 0xfb, 0x2b, 0xc4, 0x5a,
-  0x7d, 0xed, 0xfa, 0xd0, 0xbb, 0x40, 0x34, 0xab, 0x76, 0x4c, 0xe0, 0xb0,
-  0xbf, 0x46, 0xb8, 0x91, 0x41, 0xe9, 0xe8, 0x43, 0xb5, 0xc6, 0xc2, 0xdb,
-  0xdb, 0x17, 0xeb, 0xb0, 0xbf, 0xfa, 0x3c, 0x14, 0xde, 0xfd, 0xd8, 0x8b,
-  0xfa, 0x26, 0x81, 0x03, 0xf4, 0xe6, 0x13, 0x00, 0x78, 0x96, 0xc0, 0xf4,
-  0xd6, 0x5d, 0xdd, 0x47, 0x6e, 0x48, 0xcd, 0x5f, 0x6c, 0x13, 0x12, 0xe0,
-  0x20, 0xbf, 0x77, 0x7d, 0x68, 0xab, 0x3c, 0x19, 0x02, 0x4b, 0x07, 0x42,
-  0x02, 0x8f, 0xd4, 0x78, 0x2d, 0x04, 0x7d, 0x88, 0xc7, 0x62, 0x4b, 0x57,
-  0x9d, 0x84, 0xef, 0x67, 0x6a, 0x46, 0xf4, 0x5c, 0xd9, 0x10, 0x64, 0xfc,
-  0x1b, 0x25, 0x5b, 0x32, 0x54, 0x58, 0x8f, 0xe7, 0xa6, 0xec, 0xe5, 0xf4,
-  0x51, 0x81, 0xd1, 0x89, 0x06, 0x3d, 0x9e, 0x26, 0x70, 0x32, 0xa8, 0x75,
-  0xee, 0x66, 0xde, 0x85, 0x6c, 0x1d, 0x49, 0x83, 0x2c, 0x15, 0x27, 0x7d,
-  0x68, 0xdb, 0xbf, 0xdd, 0xfa, 0x41, 0x02, 0x02, 0x93, 0xa6, 0xbe, 0x8b,
-  0xd9, 0x9c, 0x17, 0x4c, 0x66, 0x9c, 0x6e, 0x2b, 0x19, 0xa9, 0x3b, 0x23,
-  0xc4, 0xc1, 0x4e, 0xb4, 0xfb, 0x5e, 0x24, 0x79, 0x59, 0xe6, 0x69, 0xa2,
-  0x14, 0xb5, 0x9d, 0x57, 0x97, 0x4b, 0x75, 0x4b, 0x54, 0xe5, 0x4e, 0x44,
-  0xdd, 0xdf, 0x61, 0xff, 0x54, 0x52, 0x0f, 0x08, 0xbc, 0x48, 0xd3, 0x1d,
-  0x39, 0x47, 0xe0, 0x39, 0x24, 0xa0, 0xc7, 0xd3, 0x04, 0x26, 0x15, 0x51,
-  0x09, 0xec, 0x4c, 0x33, 0xa3, 0x53, 0xa7, 0xa3, 0xea, 0x33, 0x3b, 0x15,
-  0xec, 0x23, 0x27, 0xed, 0x65, 0x94, 0x55, 0x6f, 0x0f, 0x9b, 0x6f, 0xd2,
-  0x81, 0x8e, 0x8a, 0x2e, 0xe2, 0xa6, 0x48, 0x84, 0x88, 0x74, 0xab, 0xef,
-  0x74, 0xdb, 0xea, 0x44, 0xdd, 0x69, 0x23, 0x38, 0xa9, 0xeb, 0xba, 0x01,
-  0xd6, 0x95, 0x32, 0x21, 0x1d, 0x68, 0xd7, 0x42, 0x47, 0xda, 0xe9, 0xc6,
-  0x0a, 0x66, 0x3b, 0x0e, 0x23, 0xd7, 0x81, 0xef, 0x16, 0x38, 0x2a, 0x7b,
-  0x79, 0x22, 0xa7, 0x36, 0x00, 0xda, 0x17, 0x09, 0xac, 0x4c, 0xd9, 0xf5,
-  0xfe, 0xa6, 0xfb, 0xaa, 0xd6, 0xd0, 0x85, 0x30, 0xb5, 0xd9, 0x75, 0x80,
-  0x55, 0x2f, 0x7b, 0x28, 0x30, 0xd9, 0x12, 0xb9, 0x56, 0x72, 0x61, 0xce,
-  0x00, 0x4e, 0x6f, 0xfb, 0xe5, 0xd0, 0xb7, 0xf0, 0xe1, 0x10, 0xf7, 0xca,
-  0x9d, 0xf5, 0xc6, 0xf9, 0x6f, 0x07, 0xea, 0xc7, 0xc1, 0x2e, 0x33, 0x09,
-  0x6c, 0x0f, 0x88, 0x18, 0x8c, 0x4b, 0x49, 0xc0, 0xe3, 0x15, 0x02, 0xab,
-  0xba, 0x69, 0x9b, 0xae, 0x85, 0x0d, 0x53, 0xf8, 0xf5, 0xb2, 0x18, 0x44,
-  0xe5, 0x74, 0x51, 0x75, 0x79, 0x28, 0x70, 0xf8, 0xe2, 0x93, 0xa1, 0x1e,
-  0xc4, 0x38, 0x8c, 0xd3, 0xc7, 0xf5, 0x57, 0xc3, 0x0f, 0x9e, 0xee, 0xf5,
-  0xe9, 0x5b, 0x6f, 0xd5, 0xca, 0x61, 0x50, 0x26, 0x93, 0x04, 0xb6, 0x3b,
-  0x93, 0x81, 0x3c, 0xfa, 0xd0, 0xc0, 0xe3, 0x69, 0x02, 0x93, 0x11, 0xae,
-  0xac, 0x9b, 0xa5, 0xff, 0xa7, 0x4e, 0xdd, 0xab, 0xfa, 0xe4, 0xa1, 0x93,
-  0xfa, 0x7b, 0xab, 0xa7, 0x96, 0x7e, 0x28, 0xb0, 0x9b, 0x73, 0x0a, 0x2d,
-  0xba, 0x76, 0x99, 0x70, 0x53, 0x56, 0x75, 0x60, 0x5b, 0xe8, 0x70, 0xd6,
-  0xc1, 0x95, 0x4f, 0xa1, 0xa3, 0xb5, 0xfb, 0xac, 0x07, 0x91, 0x4c, 0x11,
-  0x38, 0x94, 0x02, 0x9e, 0xa6, 0x0b, 0x7c, 0x9e, 0x26, 0x30, 0x71, 0x4d,
-  0xd6, 0x4d, 0x37, 0x85, 0x45, 0x7a, 0x81, 0xce, 0x16, 0xf9, 0xa7, 0x6b,
-  0xde, 0x74, 0xc5, 0xb7, 0x43, 0xe0, 0xc3, 0x20, 0x52, 0xb5, 0x81, 0x4c,
-  0x7c, 0x85, 0x26, 0x68, 0x07, 0x11, 0x7a, 0x89, 0x86, 0x94, 0xa7, 0x43,
-  0xd0, 0xc0, 0x73, 0xbd, 0xc8, 0x98, 0xda, 0x6d, 0x74, 0xbd, 0x80, 0x41,
-  0x99, 0xcc, 0x24, 0x30, 0xc9, 0x55, 0x20, 0xcf, 0xe0, 0x1f, 0xe6, 0x65,
-  0x02, 0xbb, 0xd1, 0x68, 0x19, 0xda, 0x59, 0xfe, 0xd9, 0x6f, 0x30, 0x5d,
-  0x63, 0x59, 0x0c, 0x22, 0x55, 0x1b, 0x0e, 0xfd, 0x0d, 0xbd, 0xa3, 0xb3,
-  0x90, 0xe6, 0xd4, 0xf6, 0x78, 0x43, 0xad, 0x19, 0x39, 0x23, 0x74, 0xe7,
-  0x95, 0xfe, 0x53, 0xe9, 0x86, 0xc2, 0x79, 0x1b, 0xcb, 0xfe, 0x61, 0xcd,
-  0x24, 0x70, 0x7f, 0xc2, 0x1e, 0x00, 0xcd, 0xd3, 0x04, 0x26, 0xd7, 0x63,
-  0x64, 0xdd, 0x0c, 0x9a, 0xe6, 0x76, 0x96, 0xb3, 0x44, 0xae, 0x0f, 0xad,
-  0xda, 0x37, 0x6b, 0x53, 0xa4, 0xc3, 0x0f, 0x04, 0xbe, 0xd2, 0xb7, 0xbc,
-  0x92, 0x68, 0x68, 0x17, 0x7a, 0xd1, 0x46, 0x3a, 0x7c, 0x6a, 0x82, 0xfb,
-  0x92, 0x21, 0xf2, 0xf3, 0x05, 0x26, 0xc7, 0x8d, 0x2b, 0xc1, 0x80, 0xf2,
-  0x8a, 0x49, 0x2c, 0xd9, 0x9c, 0x8a, 0xcb, 0xa8, 0x7a, 0x69, 0xbb, 0xbc,
-  0xea, 0x7e, 0x06, 0xdb, 0xbe, 0x9a, 0xce, 0xee, 0x05, 0x81, 0x43, 0xfd,
-  0x61, 0xff, 0x1a, 0xf1, 0x90, 0xd0, 0xf1, 0x94, 0xc3, 0x60, 0x7b, 0x27,
-  0xcd, 0x6d, 0xcf, 0x1f, 0x81, 0xc0, 0xe0, 0x55, 0xbc, 0xea, 0x3a, 0xf0,
-  0x35, 0x97, 0x54, 0xbd, 0x74, 0x5d, 0x45, 0xd9, 0x53, 0xb4, 0xdd, 0x6e,
-  0xd3, 0xdc, 0x0d, 0x04, 0x76, 0x7f, 0x87, 0xde, 0xd4, 0x10, 0x90, 0xd1,
-  0x23, 0x78, 0x40, 0x87, 0x40, 0x40, 0x7b, 0xcb, 0xd4, 0xc8, 0xb2, 0xcd,
-  0x5e, 0x26, 0x20, 0x30, 0x78, 0x15, 0x4f, 0x13, 0x78, 0xe7, 0xd7, 0xb9,
-  0x6b, 0x2e, 0xa9, 0x7a, 0xe9, 0xfa, 0xd0, 0xb9, 0xf7, 0x97, 0x89, 0xf4,
-  0x4e, 0x81, 0xfd, 0x01, 0xed, 0x90, 0xf0, 0x11, 0x85, 0x16, 0x53, 0x99,
-  0x9b, 0x8d, 0xae, 0x44, 0xf8, 0x2c, 0x81, 0xc9, 0xfc, 0x3c, 0x2e, 0x04,
-  0x03, 0xca, 0x2b, 0x96, 0x52, 0x56, 0x37, 0x0b, 0xec, 0xfa, 0xd0, 0x07,
-  0xea, 0x9f, 0x5b, 0x14, 0xe5, 0x76, 0xd0, 0xd9, 0x1f, 0x08, 0x40, 0x19,
-  0xbb, 0x7b, 0xc2, 0x8f, 0x63, 0x40, 0xd5, 0x1f, 0x07, 0x0b, 0xdb, 0x09,
-  0xb8, 0x12, 0xe1, 0xb3, 0x04, 0x26, 0xfd, 0x17, 0xbc, 0x17, 0x19, 0x50,
-  0x9e, 0x26, 0xb0, 0xab, 0x72, 0x72, 0x06, 0xea, 0x46, 0x81, 0xed, 0xd4,
-  0xd7, 0x9a, 0x76, 0x66, 0x6d, 0xab, 0xf3, 0x8a, 0x2e, 0x74, 0xd7, 0xe0,
-  0x1d, 0x87, 0x0a, 0xab, 0xc5, 0x62, 0x57, 0x22, 0x44, 0x17, 0x1a, 0xbc,
-  0x98, 0x67, 0x09, 0x4c, 0x7a, 0xaf, 0xb2, 0xfd, 0xbc, 0x36, 0x06, 0xd6,
-  0x97, 0x5c, 0xdd, 0x85, 0xa3, 0x86, 0x44, 0x6d, 0xe7, 0x81, 0x07, 0x02,
-  0x3b, 0xd1, 0x0e, 0xed, 0x90, 0x47, 0x05, 0x96, 0xab, 0x27, 0xfb, 0x81,
-  0x37, 0xed, 0xf5, 0x49, 0x2c, 0xcc, 0x42, 0x83, 0x17, 0xf3, 0x2c, 0x81,
-  0xc9, 0x54, 0x90, 0xba, 0xa6, 0xeb, 0xfe, 0xbe, 0x78, 0x25, 0x73, 0x45,
-  0x2a, 0xea, 0x30, 0xe2, 0x3b, 0x2f, 0x23, 0x8d, 0x3e, 0x42, 0xeb, 0x16,
-  0x9a, 0x62, 0x47, 0x9f, 0xae, 0xa9, 0xf2, 0xed, 0xd2, 0xbb, 0xf4, 0x76,
-  0xb5, 0xd9, 0x05, 0x26, 0xd7, 0xe4, 0x70, 0x37, 0x03, 0xa0, 0x3c, 0x49,
-  0x60, 0x7a, 0x5b, 0xad, 0x6a, 0x5c, 0xfd, 0xbb, 0xee, 0x46, 0xb1, 0x55,
-  0x35, 0x75, 0xfa, 0x39, 0x57, 0x2e, 0x08, 0x1c, 0x87, 0x62, 0x73, 0xc1,
-  0x1f, 0x6b, 0xb8, 0x0a, 0xda, 0xe2, 0x96, 0xde, 0xd4, 0xdc, 0xa5, 0xc7,
-  0xe5, 0x62, 0x25, 0x16, 0x78, 0x15, 0x4f, 0x12, 0x98, 0x34, 0xc0, 0x7a,
-  0x19, 0xb3, 0x5b, 0xd5, 0x18, 0xea, 0xec, 0x5a, 0x6a, 0x17, 0x9b, 0xad,
-  0xb5, 0xae, 0xc9, 0x1e, 0x08, 0x4c, 0x6a, 0x76, 0xe8, 0xd6, 0x04, 0xf7,
-  0x78, 0xdb, 0x47, 0xdf, 0x07, 0xde, 0x5b, 0x8f, 0xe2, 0xa6, 0xc5, 0x82,
-  0xf7, 0x32, 0x69, 0x66, 0x17, 0xd8, 0x5d, 0xbd, 0x5a, 0xb5, 0x00, 0x10,
-  0x9e, 0x23, 0x30, 0x9d, 0xfe, 0xd5, 0x0d, 0xae, 0x33, 0x61, 0x3d, 0x1a,
-  0x57, 0x4b, 0x9c, 0x8b, 0x6d, 0xcc, 0xa4, 0xce, 0x0e, 0x04, 0x26, 0xf7,
-  0xe9, 0x84, 0xce, 0x0b, 0xee, 0x3c, 0xf2, 0xf0, 0xc3, 0x68, 0xdc, 0x28,
-  0x7b, 0xe7, 0xa7, 0x77, 0x61, 0x24, 0xe0, 0xca, 0xc4, 0xeb, 0x6d, 0x04,
-  0xdc, 0x74, 0x19, 0xbc, 0x24, 0xf0, 0x95, 0xa3, 0x04, 0xff, 0x30, 0x4f,
-  0x11, 0xf8, 0x87, 0xf8, 0x6b, 0x6e, 0x1e, 0x24, 0xb3, 0x58, 0xfe, 0xf0,
-  0xb1, 0x27, 0x82, 0x15, 0xbd, 0x0a, 0x04, 0x1f, 0x0e, 0x6a, 0xc9, 0x23,
-  0xe4, 0x03, 0x4d, 0x30, 0x99, 0x4a, 0xf3, 0x2f, 0xbf, 0x5c, 0x1a, 0x87,
-  0xff, 0x8e, 0x1c, 0x9f, 0x74, 0xc7, 0xf9, 0xdc, 0x7b, 0xa8, 0x56, 0x78,
-  0xc1, 0xa5, 0xd7, 0xf0, 0xbb, 0xd3, 0x9a, 0x29, 0x2a, 0xf2, 0x7c, 0xbc,
-  0xa1, 0xc0, 0xee, 0x44, 0x47, 0xba, 0x01, 0xb8, 0x8a, 0x04, 0x3c, 0xe6,
-  0x17, 0xb8, 0xf1, 0x1f, 0xdd, 0x3e, 0xbc, 0x7b, 0xdf, 0x3c, 0x86, 0x52,
-  0xf1, 0x13, 0xfb, 0xbd, 0x5b, 0xdb, 0xda, 0xd8, 0xe1, 0x26, 0x11, 0x73,
-  0x28, 0x30, 0xa9, 0xdb, 0xf6, 0x99, 0x8d, 0x4d, 0x16, 0x9b, 0xae, 0xab,
-  0xf3, 0xcd, 0x7b, 0x82, 0x4e, 0x76, 0x61, 0x20, 0xbe, 0xf7, 0x5f, 0x4d,
-  0xee, 0x0e, 0x46, 0xe6, 0x93, 0xf4, 0xd9, 0xa9, 0x4b, 0xe5, 0x92, 0x36,
-  0xf1, 0x6e, 0xb8, 0xe0, 0x75, 0xb4, 0xfd, 0x87, 0xd4, 0xf7, 0x9e, 0xa7,
-  0x19, 0xb8, 0x1f, 0x78, 0xaf, 0x37, 0xd1, 0xc7, 0x60, 0x8e, 0x66, 0x1b,
-  0xfc, 0x9b, 0xcc, 0x28, 0xf0, 0x32, 0xcb, 0xb2, 0xfd, 0xa6, 0xb7, 0xd8,
-  0x30, 0xf8, 0x4c, 0xd9, 0xd8, 0xbe, 0xc9, 0x40, 0xca, 0xee, 0x37, 0x9d,
-  0xb6, 0x0f, 0xad, 0xff, 0x5f, 0x90, 0xef, 0x86, 0x02, 0x37, 0x34, 0xb1,
-  0xef, 0x73, 0xd3, 0xb6, 0xd5, 0x77, 0xec, 0x74, 0x25, 0x89, 0x2e, 0x8d,
-  0x70, 0xf2, 0x0c, 0x13, 0x8f, 0xb5, 0xc1, 0xf2, 0x8c, 0xb0, 0xb7, 0xdf,
-  0x92, 0x67, 0xbb, 0x4a, 0xad, 0xe9, 0x3b, 0x27, 0x32, 0x73, 0x4e, 0x28,
-  0xbf, 0xc6, 0x6e, 0x4f, 0x12, 0xfb, 0xa6, 0x6d, 0x7f, 0xbf, 0xd4, 0x77,
-  0xa4, 0x27, 0xfc, 0x2d, 0xff, 0xa6, 0x65, 0x15, 0x7a, 0xa4, 0x8e, 0x32,
-  0x98, 0xfa, 0xfb, 0x2f, 0xbe, 0x69, 0x0a, 0x5c, 0xe2, 0xc9, 0xaf, 0x17,
-  0xa5, 0x73, 0x2e, 0xf4, 0x85, 0x49, 0xcb, 0x7d, 0xf6, 0xfb, 0x9b, 0x7d,
-  0xa9, 0xaa, 0xb9, 0xf4, 0x2e, 0x8d, 0xf4, 0xd7, 0x22, 0xd3, 0x51, 0x5f,
-  0xe0, 0xba, 0xd0, 0x51, 0x04, 0xd1, 0x1d, 0x5c, 0xea, 0x9b, 0x58, 0x7f,
-  0x67, 0xe7, 0x93, 0x49, 0x74, 0x64, 0x24, 0x6e, 0x8c, 0x5f, 0xef, 0xb3,
-  0x73, 0x75, 0x3e, 0xd1, 0x47, 0x50, 0xf6, 0x9f, 0x4c, 0x27, 0x44, 0xfc,
-  0x95, 0x9d, 0x7e, 0xb3, 0xbd, 0x6e, 0xa4, 0xdd, 0x79, 0x68, 0x70, 0xfd,
-  0x59, 0x9f, 0x4f, 0xc8, 0x96, 0x4d, 0x96, 0xf9, 0xef, 0x5d, 0x08, 0x3e,
-  0xd4, 0x2e, 0xde, 0x9f, 0x32, 0xef, 0x2d, 0x10, 0xb8, 0x99, 0x10, 0xf8,
-  0x3c, 0x57, 0xe0, 0x15, 0x55, 0x73, 0x7c, 0x2d, 0xc7, 0xbe, 0xbd, 0x10,
-  0x8c, 0xb6, 0xcf, 0xa1, 0x0b, 0xbb, 0x23, 0x19, 0xc8, 0x07, 0x7b, 0xf4,
-  0x08, 0xce, 0x4b, 0x5f, 0x58, 0x3d, 0xad, 0xc3, 0x37, 0xab, 0xb1, 0x00,
-  0xe4, 0x3c, 0x14, 0xf5, 0xbf, 0x53, 0x3b, 0x87, 0x96, 0x68, 0xf6, 0xb3,
-  0x73, 0xf1, 0xb1, 0xb2, 0x68, 0x80, 0x41, 0x8f, 0xa7, 0x0a, 0x7c, 0xf0,
-  0x57, 0x1d, 0x8c, 0x34, 0x96, 0xfd, 0xa9, 0x19, 0xbf, 0x9a, 0xd3, 0x1e,
-  0x74, 0x50, 0xe0, 0x7a, 0x60, 0x8b, 0xc4, 0xf4, 0x91, 0xc7, 0x85, 0x08,
-  0x5c, 0x1a, 0x1e, 0x79, 0xe9, 0x82, 0x97, 0x8f, 0x2a, 0x9c, 0x9e, 0x37,
-  0xad, 0x35, 0xb8, 0xa3, 0x49, 0x35, 0xc1, 0x81, 0xbc, 0xd8, 0xc8, 0x6e,
-  0x11, 0x38, 0x42, 0x03, 0x0c, 0x7a, 0x3c, 0x51, 0xe0, 0xc5, 0xc0, 0x90,
-  0xc1, 0xf2, 0x44, 0x83, 0xf7, 0xa8, 0x36, 0xbf, 0xf6, 0x7b, 0x8d, 0x4e,
-  0x70, 0x69, 0x55, 0x11, 0x36, 0x6a, 0x73, 0x2d, 0xd1, 0x40, 0x73, 0x56,
-  0x8f, 0x36, 0xaf, 0xee, 0x91, 0x97, 0x63, 0xe9, 0xb9, 0xc7, 0xe5, 0x86,
-  0x4e, 0x2a, 0xd2, 0xcf, 0x66, 0xb0, 0x79, 0xeb, 0xbd, 0x8c, 0xb0, 0xe3,
-  0x92, 0xc0, 0xb8, 0x13, 0x09, 0xf4, 0x79, 0x9a, 0xc0, 0x8b, 0x63, 0x60,
-  0xd1, 0x5f, 0xf8, 0xf6, 0xa0, 0xc8, 0xbf, 0xae, 0xe4, 0xf7, 0xa1, 0xbd,
-  0xc6, 0x39, 0xbc, 0x36, 0xb2, 0x0a, 0x6a, 0x67, 0x9b, 0xff, 0xd0, 0x0d,
-  0xbe, 0xdd, 0x43, 0xa4, 0x83, 0x87, 0x13, 0x0e, 0x4c, 0xfd, 0x1d, 0x6d,
-  0x83, 0x69, 0x7f, 0x63, 0xd0, 0x15, 0x8f, 0x7b, 0x8f, 0x95, 0x57, 0xac,
-  0x9a, 0x0b, 0x02, 0x0f, 0x52, 0x81, 0xbf, 0x60, 0xc0, 0x73, 0x04, 0x8e,
-  0xb6, 0x23, 0x4b, 0x17, 0x8b, 0xc0, 0x30, 0x70, 0xd7, 0xef, 0x18, 0xd2,
-  0x30, 0x91, 0xf7, 0xcd, 0xc8, 0xe2, 0xe6, 0x66, 0xd8, 0xca, 0xd2, 0xe6,
-  0x3f, 0x98, 0xe8, 0xd8, 0x9a, 0xe2, 0x32, 0x74, 0x40, 0xa9, 0x1f, 0xba,
-  0xde, 0x0e, 0x83, 0xac, 0xfc, 0x23, 0xee, 0x9f, 0xaa, 0xf4, 0x19, 0xc0,
-  0x8f, 0x7c, 0xdb, 0x38, 0xd3, 0x03, 0x0b, 0x39, 0x7a, 0x71, 0xc0, 0x5f,
-  0x30, 0x64, 0x6e, 0x81, 0x57, 0x49, 0xb2, 0xcb, 0x2f, 0xbd, 0x44, 0x2f,
-  0xf7, 0x6d, 0x8a, 0x06, 0xfa, 0xfa, 0xad, 0xa0, 0xdf, 0xcf, 0x1d, 0xbd,
-  0x3b, 0xa1, 0xf2, 0x6f, 0x3c, 0x58, 0xf5, 0x2a, 0x7b, 0x3f, 0xd1, 0xf4,
-  0xd2, 0x60, 0xb2, 0xee, 0xdd, 0xc4, 0x10, 0xca, 0x62, 0x5f, 0xf3, 0x64,
-  0xf8, 0x0a, 0xf0, 0x95, 0x97, 0x60, 0xa0, 0x3b, 0xb0, 0xf0, 0x5e, 0x98,
-  0x1a, 0x5a, 0x89, 0x45, 0x53, 0x09, 0x64, 0x02, 0x80, 0xe9, 0x02, 0xdf,
-  0x4f, 0x7d, 0xd4, 0x2f, 0x19, 0x5b, 0x24, 0xe9, 0x8c, 0x37, 0xc7, 0xe5,
-  0x87, 0x44, 0x3a, 0xb3, 0xd8, 0x1e, 0x03, 0x27, 0x90, 0xca, 0x24, 0xba,
-  0x4a, 0xd2, 0xeb, 0x2f, 0xe9, 0xac, 0xd2, 0xe4, 0x5a, 0xe8, 0xa6, 0xd8,
-  0xa9, 0xf7, 0x30, 0x45, 0xc9, 0xa1, 0x08, 0x36, 0xe7, 0xc5, 0x41, 0x39,
-  0x9c, 0x1c, 0x68, 0x6f, 0xbd, 0x56, 0x5b, 0x57, 0xbb, 0x91, 0x35, 0x55,
-  0xfe, 0x52, 0xca, 0xe2, 0xb0, 0x50, 0x05, 0x05, 0x7d, 0x41, 0x10, 0x2c,
-  0xed, 0xf9, 0x30, 0x82, 0x37, 0x33, 0x00, 0x30, 0x02, 0x04, 0xfe, 0x30,
-  0x20, 0x30, 0xb8, 0x07, 0x08, 0xfc, 0x61, 0x40, 0x60, 0x70, 0x0f, 0x10,
-  0xf8, 0xc3, 0x80, 0xc0, 0xe0, 0x1e, 0x20, 0xf0, 0x87, 0x01, 0x81, 0xc1,
-  0x3d, 0x40, 0xe0, 0x0f, 0x03, 0x02, 0x83, 0x7b, 0x80, 0xc0, 0x1f, 0x06,
-  0x04, 0x06, 0xf7, 0x00, 0x81, 0x3f, 0x0c, 0x08, 0x0c, 0xee, 0x01, 0x02,
-  0x7f, 0x18, 0x10, 0x18, 0xdc, 0x03, 0x04, 0xfe, 0x30, 0x20, 0x30, 0xb8,
-  0x07, 0x08, 0xfc, 0x61, 0x40, 0x60, 0x70, 0x0f, 0x10, 0xf8, 0xc3, 0x80,
-  0xc0, 0xe0, 0x1e, 0x20, 0xf0, 0x87, 0x91, 0x76, 0xf7, 0x2e, 0x6c, 0xd3,
-  0xb4, 0x28, 0x71, 0xff, 0x02, 0xb8, 0x0e, 0x04, 0xfe, 0x30, 0x6a, 0xbc,
-  0xfc, 0x08, 0xdc, 0x01, 0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6,
-  0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c, 0x04, 0x06, 0x80,
-  0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01,
-  0x60, 0x0c, 0x04, 0x06, 0x80, 0x31, 0x93, 0x04, 0xfe, 0x1f, 0x00, 0x60,
-  0x32, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0xf3, 0x36, 0x81,
-  0x01, 0x00, 0xef, 0x05, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03,
-  0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0,
-  0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20,
-  0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18,
-  0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30,
-  0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00,
-  0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c,
-  0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x98, 0x0f, 0x13, 0xb8, 0x39, 0x37, 0x37, 0x87, 0xad, 0xcf, 0x4f, 0xcd,
-  0xca, 0x08, 0xf7, 0xe4, 0x10, 0x80, 0x67, 0xf3, 0x49, 0x02, 0x6f, 0x96,
-  0x42, 0x88, 0xf2, 0xa6, 0xa0, 0xd5, 0x26, 0x16, 0xe2, 0xf5, 0x79, 0xbf,
-  0x23, 0x87, 0x00, 0xbc, 0x82, 0x39, 0x24, 0xf8, 0xc9, 0xb2, 0x2c, 0xab,
-  0xc7, 0xbf, 0x6f, 0xce, 0x1d, 0xc3, 0xcf, 0x83, 0xbc, 0x88, 0x9b, 0xf5,
-  0x28, 0x65, 0xd8, 0x47, 0x32, 0x3b, 0x89, 0x3b, 0x72, 0x08, 0xc0, 0x2b,
-  0x98, 0x2e, 0x41, 0xb9, 0xbc, 0x56, 0xad, 0xa9, 0x6d, 0x97, 0xcc, 0x83,
-  0xc0, 0x00, 0xdc, 0xc9, 0x54, 0x09, 0xea, 0x2f, 0x21, 0x20, 0x30, 0x00,
-  0x6f, 0x62, 0xa2, 0x04, 0x59, 0x2c, 0x20, 0x30, 0x00, 0x6f, 0x63, 0x92,
-  0x04, 0xd5, 0x52, 0x08, 0x08, 0x0c, 0xc0, 0xfb, 0x98, 0x26, 0xb0, 0xac,
-  0xd0, 0xc9, 0x62, 0x8a, 0xc0, 0xf5, 0x29, 0x3b, 0x55, 0x3a, 0x2f, 0x5e,
-  0x3c, 0xf5, 0x39, 0xfb, 0x39, 0xfb, 0x53, 0x63, 0xd5, 0x6f, 0x96, 0x9d,
-  0xea, 0x60, 0x34, 0x57, 0x32, 0xda, 0xc5, 0x75, 0xc3, 0xe5, 0x9f, 0x2a,
-  0x30, 0x19, 0xd7, 0x9c, 0xb2, 0x5f, 0xb3, 0xd1, 0xe4, 0xb0, 0x8b, 0xee,
-  0x6a, 0xf4, 0xe7, 0x2c, 0xa3, 0x1b, 0xab, 0x5f, 0x7b, 0xa0, 0x00, 0xcc,
-  0xc5, 0xb4, 0x56, 0x2c, 0x15, 0x22, 0xca, 0xdb, 0xe4, 0x11, 0x81, 0xe5,
-  0x87, 0xb2, 0x51, 0x43, 0xe8, 0x2f, 0x59, 0xd1, 0xa9, 0xc0, 0xe5, 0x46,
-  0x35, 0xec, 0x71, 0x61, 0xa3, 0xf9, 0xd1, 0xed, 0xfd, 0xa6, 0xa4, 0x51,
-  0xca, 0x93, 0x48, 0x64, 0x0c, 0x8b, 0xba, 0xbf, 0x0a, 0x93, 0x37, 0x21,
-  0x76, 0xdd, 0xa7, 0x42, 0xc7, 0xb5, 0xd4, 0x71, 0xdb, 0xfc, 0xca, 0x20,
-  0xa9, 0xf9, 0xd0, 0xca, 0xcc, 0xe4, 0xae, 0x68, 0xba, 0x2f, 0x9b, 0xbd,
-  0xdc, 0x75, 0xdd, 0xb4, 0x2e, 0x87, 0x85, 0x1c, 0x37, 0xac, 0x8d, 0x8d,
-  0xc5, 0x7a, 0x18, 0x7d, 0xd2, 0xaa, 0x40, 0x36, 0xfb, 0x26, 0xd0, 0x37,
-  0xae, 0x22, 0x83, 0x39, 0x99, 0xd8, 0x0d, 0x5d, 0x1d, 0x9a, 0x76, 0x82,
-  0xc0, 0x07, 0x5d, 0xad, 0x95, 0x68, 0x44, 0xe0, 0x1f, 0xd7, 0x37, 0xdf,
-  0xe8, 0x2a, 0xbf, 0x77, 0x9b, 0x8e, 0x24, 0xca, 0xb5, 0x53, 0xf6, 0xbf,
-  0x66, 0x7b, 0x67, 0x94, 0xd4, 0xb9, 0xea, 0xbe, 0xf8, 0x76, 0x3b, 0x2a,
-  0x7d, 0x46, 0x04, 0x2e, 0xf7, 0xfe, 0x71, 0xc8, 0xde, 0x85, 0xc9, 0xe0,
-  0xb2, 0xb2, 0x39, 0x34, 0xd3, 0x76, 0xcb, 0xa6, 0x9f, 0x2f, 0x12, 0x7d,
-  0xae, 0x37, 0xc5, 0xea, 0xd4, 0x92, 0xd9, 0x30, 0x4b, 0xb4, 0xc2, 0x60,
-  0x46, 0xe6, 0x18, 0x47, 0x3e, 0x2e, 0xb0, 0xa3, 0xf2, 0x04, 0xce, 0xe9,
-  0x57, 0x1b, 0xb9, 0xe3, 0xc1, 0x6d, 0x88, 0x1a, 0x17, 0x8d, 0x54, 0x6f,
-  0x6b, 0x93, 0x92, 0x3b, 0x26, 0xea, 0xc8, 0x68, 0x08, 0x43, 0xda, 0x8e,
-  0x0b, 0x9c, 0x92, 0x6c, 0xda, 0x08, 0x2c, 0xdb, 0xe1, 0xa6, 0x63, 0x2f,
-  0x5f, 0x34, 0x7a, 0xcb, 0xa1, 0xdb, 0x74, 0x94, 0x1f, 0x17, 0xb2, 0x7f,
-  0xb0, 0x9c, 0xa1, 0xc4, 0x01, 0xd0, 0xbc, 0x5b, 0xe0, 0xa4, 0x50, 0xb2,
-  0x16, 0x54, 0xe0, 0x5a, 0x76, 0x3f, 0x57, 0x79, 0xb1, 0xb5, 0x9b, 0x54,
-  0xf0, 0xd5, 0x31, 0x4f, 0x23, 0x41, 0xba, 0xd0, 0x95, 0x16, 0xda, 0xd0,
-  0xd8, 0xa4, 0x4a, 0x6d, 0x5d, 0xad, 0xf4, 0x2b, 0x54, 0x5c, 0xb2, 0x41,
-  0x1c, 0x11, 0x58, 0x26, 0xba, 0x20, 0x45, 0xa3, 0xf6, 0x2c, 0x8b, 0x95,
-  0xfc, 0x50, 0xdb, 0x4d, 0x8b, 0x5c, 0x6d, 0xda, 0xd9, 0x7c, 0x0d, 0xa3,
-  0x17, 0x51, 0x5a, 0x26, 0xe6, 0x6c, 0x22, 0x8f, 0x27, 0xaa, 0xf4, 0xf9,
-  0x25, 0x9d, 0xa1, 0xc8, 0x01, 0x50, 0xbc, 0x59, 0xe0, 0x9d, 0xd9, 0x3d,
-  0xa5, 0x02, 0xcb, 0x06, 0x6b, 0xd1, 0x69, 0xb9, 0x35, 0x6d, 0x96, 0xfc,
-  0xb0, 0xea, 0x36, 0x35, 0x05, 0x89, 0x66, 0xdd, 0x4f, 0x5a, 0x86, 0xeb,
-  0x9a, 0x73, 0xe9, 0x64, 0xae, 0x5b, 0xc8, 0xc4, 0x66, 0x73, 0x37, 0x2e,
-  0x70, 0x27, 0x5d, 0xea, 0x86, 0xc0, 0xad, 0xcd, 0x60, 0x13, 0x99, 0xf6,
-  0x56, 0x98, 0x8c, 0x1d, 0x4d, 0xac, 0xdb, 0x91, 0xe8, 0x3b, 0x5d, 0x4b,
-  0x93, 0xf9, 0xa3, 0xf5, 0xb6, 0x13, 0x3f, 0x9e, 0xa1, 0xc8, 0x01, 0x50,
-  0xbc, 0x59, 0xe0, 0xc6, 0x74, 0x42, 0x3d, 0x81, 0xd7, 0xb6, 0x83, 0x5a,
-  0xe9, 0xe0, 0x8d, 0x6d, 0xa6, 0xbd, 0x68, 0x52, 0xdb, 0x49, 0x35, 0x1c,
-  0xcd, 0xae, 0x89, 0x8e, 0x7e, 0x29, 0xcc, 0xcc, 0x54, 0x6e, 0x7c, 0x1a,
-  0x13, 0x78, 0xe1, 0x4f, 0x30, 0xd9, 0x0c, 0xaa, 0x91, 0x75, 0x62, 0x36,
-  0xd9, 0x13, 0x48, 0x62, 0xf2, 0x15, 0x88, 0xbe, 0xa0, 0xdd, 0x81, 0xb5,
-  0x69, 0xc1, 0xf5, 0x60, 0x7b, 0x86, 0x32, 0x07, 0x40, 0xf2, 0x66, 0x81,
-  0xbb, 0x4d, 0x56, 0x23, 0x2b, 0xb0, 0x70, 0x11, 0xea, 0x8f, 0xfd, 0xcb,
-  0x46, 0xea, 0xef, 0x6a, 0xa8, 0x5d, 0xad, 0x7b, 0xce, 0x6d, 0xac, 0xfe,
-  0x6f, 0xc8, 0x8e, 0xe6, 0xe3, 0x98, 0xc0, 0x79, 0xeb, 0xe1, 0xf6, 0x4c,
-  0x3d, 0x81, 0x4b, 0x22, 0x30, 0xc9, 0x57, 0x35, 0x88, 0xde, 0xc6, 0xd0,
-  0x8b, 0xa9, 0x68, 0x01, 0x98, 0x89, 0x4f, 0x14, 0xb8, 0x21, 0x02, 0x2f,
-  0x54, 0x8d, 0x97, 0x0d, 0x6b, 0xd4, 0x8f, 0x72, 0x1d, 0xd0, 0x6e, 0xa5,
-  0xda, 0xc1, 0x4a, 0x7f, 0x45, 0xd3, 0x16, 0xba, 0x7b, 0x3d, 0x26, 0x70,
-  0x2f, 0xdb, 0x6e, 0x9b, 0x6c, 0x5c, 0xe3, 0x2b, 0x02, 0x0f, 0xa3, 0x37,
-  0x31, 0xa8, 0xe3, 0x71, 0x60, 0x10, 0x0c, 0x66, 0xe3, 0x13, 0x05, 0xa6,
-  0xe1, 0xf5, 0x00, 0xd9, 0xb6, 0x81, 0x5e, 0x94, 0xb2, 0xf3, 0xbd, 0xf1,
-  0x13, 0x4b, 0x55, 0x77, 0xf5, 0xa8, 0x7b, 0xad, 0x03, 0xc3, 0xca, 0x51,
-  0x81, 0x13, 0x3f, 0x22, 0x22, 0xb0, 0x8d, 0x64, 0x20, 0x70, 0x7e, 0x29,
-  0x7a, 0x13, 0x43, 0x6f, 0xc2, 0x1d, 0x02, 0x83, 0xf9, 0xf8, 0x44, 0x81,
-  0x69, 0x17, 0x5a, 0x4e, 0x0d, 0x1f, 0x55, 0x98, 0x65, 0x3f, 0x4a, 0x35,
-  0xbb, 0xe4, 0x37, 0xc1, 0x95, 0x6a, 0xb2, 0xbb, 0xc9, 0xa5, 0x15, 0xed,
-  0xd8, 0x4e, 0x11, 0xd8, 0x6a, 0x7a, 0xbd, 0x05, 0x0e, 0x09, 0xdc, 0xbb,
-  0xfa, 0x04, 0x81, 0xc1, 0x7c, 0xcc, 0x2c, 0x70, 0x15, 0x5c, 0x68, 0x24,
-  0x84, 0x99, 0xc4, 0xb9, 0x4d, 0xe0, 0xc8, 0x45, 0xa8, 0xb7, 0x85, 0xc7,
-  0xc0, 0xfa, 0xf2, 0x8f, 0x9f, 0xe6, 0x42, 0xce, 0x6b, 0xc5, 0x66, 0x1a,
-  0xac, 0x6f, 0x58, 0xf3, 0x80, 0xc0, 0xe3, 0x63, 0x60, 0x32, 0xc4, 0xae,
-  0x06, 0xd1, 0xdb, 0x18, 0x22, 0x61, 0xa6, 0xc3, 0x00, 0x98, 0x97, 0x59,
-  0x05, 0x2e, 0xff, 0xd3, 0x26, 0x0b, 0x04, 0xd0, 0x03, 0xd9, 0xd6, 0x4c,
-  0x39, 0x2f, 0xae, 0x08, 0x9c, 0x08, 0xa3, 0x5f, 0xa9, 0xdd, 0xaf, 0x49,
-  0xa3, 0xdc, 0x92, 0xbd, 0x65, 0xcc, 0xde, 0x34, 0xb4, 0x9c, 0x32, 0x4e,
-  0x6a, 0x7b, 0xca, 0x70, 0x69, 0xe7, 0x26, 0xe9, 0xbb, 0x05, 0x96, 0xd7,
-  0x8a, 0x76, 0x21, 0x81, 0xfb, 0x8b, 0x4f, 0xbc, 0xe8, 0xfd, 0x59, 0x33,
-  0x4c, 0x5d, 0x81, 0x27, 0x30, 0xab, 0xc0, 0xf1, 0x48, 0x45, 0x95, 0x01,
-  0xe4, 0x92, 0x48, 0xb5, 0x44, 0xe3, 0x10, 0x16, 0x38, 0xf2, 0xc4, 0x5a,
-  0x77, 0xdf, 0xc9, 0x65, 0x8b, 0x2b, 0x3d, 0x37, 0xa5, 0x56, 0x24, 0xd7,
-  0xf4, 0x3a, 0x70, 0x4e, 0x1a, 0x77, 0x4d, 0x21, 0xf4, 0x4a, 0xc6, 0x95,
-  0xfc, 0x53, 0x5e, 0x02, 0xfa, 0xea, 0x3e, 0x6d, 0x4c, 0xd2, 0xc6, 0xa7,
-  0x26, 0xbe, 0x2e, 0x70, 0x6e, 0xdb, 0xd6, 0x3c, 0x28, 0xf0, 0x76, 0x24,
-  0x7a, 0x4f, 0x60, 0x77, 0x3c, 0x6d, 0x7b, 0x42, 0x4b, 0x0c, 0x66, 0x64,
-  0x4e, 0x81, 0xab, 0xb1, 0x11, 0x9e, 0xd2, 0x6d, 0x99, 0x65, 0xdf, 0xb1,
-  0x15, 0x2e, 0x20, 0xb0, 0xf2, 0x3c, 0x33, 0x2b, 0x27, 0x36, 0xbf, 0xbf,
-  0x6a, 0xd9, 0x71, 0x61, 0xb4, 0x14, 0xf1, 0x3e, 0xdb, 0xc7, 0xa2, 0x22,
-  0x7b, 0x4b, 0xb1, 0xfd, 0x79, 0xac, 0x6e, 0xe7, 0xa5, 0x6d, 0x98, 0x6b,
-  0x19, 0xd7, 0x97, 0x89, 0xab, 0x36, 0x4e, 0xaf, 0xcf, 0xfa, 0xe6, 0x88,
-  0xcb, 0x02, 0x8b, 0xef, 0xf3, 0x49, 0x66, 0x5a, 0x2e, 0xf7, 0x1a, 0x0a,
-  0xac, 0xba, 0x06, 0x5e, 0xf4, 0x43, 0x81, 0x1b, 0xd9, 0x0d, 0x58, 0xff,
-  0x56, 0xe7, 0xd3, 0xb2, 0x3f, 0xe9, 0x06, 0xc0, 0x14, 0x66, 0x6d, 0x81,
-  0x85, 0xed, 0xfa, 0xf6, 0xf0, 0x16, 0x0c, 0x2b, 0xc5, 0x03, 0x02, 0xef,
-  0xd4, 0xd7, 0x55, 0x6f, 0x2d, 0xb4, 0xbc, 0xd1, 0xc1, 0x7c, 0x29, 0xd4,
-  0x5d, 0x04, 0xbd, 0xa1, 0xb4, 0xd7, 0xea, 0x6f, 0x85, 0x8d, 0xc7, 0x46,
-  0xef, 0x25, 0x7d, 0x1c, 0xe4, 0xe6, 0x82, 0xc0, 0x86, 0xbc, 0x0d, 0x0a,
-  0x7c, 0x69, 0xa9, 0xb5, 0xeb, 0x84, 0xe7, 0x83, 0x40, 0x00, 0xcc, 0xc2,
-  0xac, 0x02, 0x1f, 0x6d, 0xc7, 0xb5, 0x47, 0xb3, 0x25, 0x15, 0x58, 0xb5,
-  0x8c, 0x01, 0x81, 0x55, 0x63, 0x49, 0xd7, 0x36, 0x4a, 0x7f, 0x55, 0x9f,
-  0xb3, 0x21, 0x06, 0xe7, 0x64, 0xef, 0x44, 0xb8, 0x1b, 0x83, 0x14, 0xda,
-  0x16, 0xb3, 0xaa, 0xb9, 0x21, 0x67, 0x0f, 0xe5, 0x8e, 0x6a, 0x10, 0xbb,
-  0x78, 0xa2, 0xab, 0x02, 0x47, 0xde, 0x59, 0x24, 0x20, 0xf0, 0x30, 0xfa,
-  0x80, 0xc0, 0xed, 0x31, 0xb2, 0x81, 0x22, 0x08, 0x0c, 0xe6, 0x63, 0xde,
-  0xa7, 0x5a, 0x54, 0xe9, 0xd8, 0x54, 0x4d, 0x69, 0xa4, 0xd9, 0x9a, 0x1b,
-  0x7e, 0x87, 0x02, 0xb7, 0x45, 0x64, 0xbd, 0xa8, 0x56, 0x5a, 0x43, 0x77,
-  0x91, 0xe8, 0xa8, 0xa3, 0x48, 0xbc, 0xcb, 0xbb, 0xc3, 0x7e, 0x7b, 0x43,
-  0xcf, 0x13, 0x34, 0xed, 0xc4, 0x64, 0x4e, 0x45, 0x1e, 0x95, 0xd2, 0xb5,
-  0xcb, 0x02, 0xd7, 0x09, 0x95, 0x2e, 0x20, 0xf0, 0x30, 0xfa, 0x90, 0xc0,
-  0x6d, 0x6d, 0xee, 0x51, 0x4a, 0x31, 0x06, 0x06, 0x33, 0xf2, 0xba, 0xc7,
-  0xd2, 0x34, 0x65, 0x9e, 0x1e, 0xcb, 0xcb, 0xd5, 0xb7, 0x29, 0xd3, 0x34,
-  0x37, 0x53, 0x52, 0xe5, 0x31, 0x2d, 0xfc, 0x9b, 0x67, 0xab, 0xe2, 0x6a,
-  0x0c, 0x12, 0xbd, 0x98, 0x83, 0xc6, 0x7b, 0x4c, 0xcb, 0xda, 0xfb, 0x3b,
-  0xbf, 0xf0, 0x1c, 0x5c, 0x85, 0xd6, 0xaf, 0xca, 0xd3, 0x6b, 0x69, 0xf6,
-  0xa3, 0x0f, 0x53, 0xe6, 0x37, 0x04, 0x02, 0xe0, 0x2e, 0x3e, 0xe9, 0xc1,
-  0xee, 0x73, 0x51, 0xc5, 0x81, 0xf6, 0xf4, 0x7e, 0x48, 0xfb, 0x09, 0xc0,
-  0x87, 0xf2, 0x07, 0x6b, 0xa8, 0x9a, 0x35, 0x9e, 0x7e, 0xcb, 0x0f, 0x04,
-  0x06, 0x9f, 0xcf, 0x5f, 0xab, 0xa1, 0xf9, 0xd7, 0x92, 0x4c, 0x3a, 0x4d,
-  0x02, 0x02, 0x83, 0xcf, 0xe7, 0xaf, 0xd5, 0xd0, 0x54, 0xcc, 0xe5, 0x2f,
-  0x04, 0x06, 0x0c, 0xf8, 0x6b, 0x35, 0x34, 0xef, 0x4d, 0x5d, 0x4f, 0x00,
-  0x02, 0x83, 0xcf, 0xe7, 0xaf, 0xd5, 0xd0, 0x52, 0xac, 0xb6, 0xa1, 0xa5,
-  0x24, 0x0f, 0x20, 0xc4, 0x2a, 0xd9, 0xde, 0x10, 0x0e, 0x80, 0xf7, 0xf1,
-  0xd7, 0x04, 0x06, 0xe0, 0x9f, 0x02, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c,
-  0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x33,
-  0xa1, 0x5c, 0x8b, 0x75, 0x35, 0xf2, 0xdd, 0xcf, 0x32, 0xde, 0x37, 0x2f,
-  0xce, 0x4f, 0xdb, 0x56, 0x5f, 0x62, 0x5d, 0x7e, 0x4e, 0x76, 0xfe, 0x51,
-  0xf8, 0x0b, 0x7c, 0xae, 0xdf, 0x9d, 0x83, 0x8e, 0x6a, 0x4c, 0xae, 0x99,
-  0xe2, 0xab, 0x63, 0x21, 0x44, 0x1c, 0x3e, 0xd4, 0x5c, 0x08, 0x21, 0x36,
-  0xf7, 0xc5, 0x3f, 0xbd, 0xd4, 0x1a, 0x99, 0xa3, 0xc0, 0x61, 0xcb, 0xec,
-  0xac, 0xa7, 0x46, 0x0f, 0x6e, 0x83, 0xb7, 0xc0, 0x87, 0xb5, 0x10, 0x22,
-  0x7d, 0x77, 0x2e, 0x3a, 0x12, 0x21, 0xe2, 0xcd, 0x8c, 0x12, 0xf7, 0xe3,
-  0x3b, 0x76, 0x56, 0x88, 0xe3, 0x58, 0x58, 0x21, 0xc4, 0xed, 0x46, 0xce,
-  0x53, 0x6a, 0x85, 0x4c, 0x35, 0x10, 0xcd, 0xbd, 0xd9, 0x01, 0x53, 0x98,
-  0x2a, 0x70, 0xfd, 0xbd, 0xec, 0x4e, 0xc4, 0xfb, 0x60, 0x5f, 0x8a, 0xd0,
-  0x9c, 0xb2, 0xaf, 0xcd, 0x77, 0xf6, 0x3b, 0x31, 0xb9, 0x1e, 0xc9, 0x48,
-  0x1d, 0x1a, 0xa5, 0xfe, 0xc9, 0xbe, 0x36, 0xd9, 0x8f, 0x33, 0xa3, 0x3a,
-  0x2b, 0xa6, 0x76, 0xf9, 0x64, 0x4e, 0xae, 0x15, 0xc2, 0x84, 0xf8, 0x94,
-  0xc0, 0xf9, 0x78, 0x58, 0x71, 0xfb, 0x11, 0xdc, 0x5e, 0x6a, 0xb2, 0x74,
-  0xa4, 0x8a, 0x8d, 0x2b, 0x25, 0xf9, 0xb1, 0x6a, 0x4b, 0x2b, 0xb0, 0x29,
-  0xc3, 0xb3, 0x0a, 0x7d, 0x6f, 0x76, 0xc0, 0x14, 0x26, 0x0a, 0x9c, 0x09,
-  0xc3, 0xc5, 0x51, 0x4f, 0xf3, 0x6d, 0x82, 0xc5, 0xd9, 0x1c, 0xbf, 0x6c,
-  0xa3, 0xcf, 0xef, 0x77, 0x0a, 0x5c, 0xed, 0x4d, 0x36, 0xec, 0xe0, 0x2d,
-  0xb1, 0x07, 0xb0, 0xfc, 0x9a, 0x72, 0x76, 0x79, 0xb6, 0xc0, 0x4d, 0xf4,
-  0x9f, 0xbf, 0x8b, 0x70, 0xd9, 0xc9, 0xb6, 0x70, 0x7b, 0x3d, 0xce, 0xfb,
-  0x4b, 0xed, 0xd0, 0x85, 0x3c, 0xd8, 0x34, 0x54, 0x0f, 0xa0, 0x54, 0xc9,
-  0x35, 0x8b, 0xff, 0x36, 0x44, 0xb5, 0x57, 0x86, 0x32, 0xcf, 0x32, 0x68,
-  0x72, 0xd3, 0x51, 0x82, 0xc9, 0x4c, 0x13, 0xf8, 0x8b, 0xfc, 0x72, 0x17,
-  0x06, 0x61, 0x55, 0x4c, 0xc2, 0x85, 0x86, 0x4d, 0xf7, 0x90, 0x6f, 0x62,
-  0x5b, 0xfd, 0xee, 0x13, 0xb8, 0xa4, 0xd9, 0xf8, 0x26, 0x31, 0x58, 0x87,
-  0x1f, 0x37, 0xf0, 0xd9, 0x02, 0xb7, 0xf5, 0x2e, 0xd9, 0x8d, 0x75, 0x4b,
-  0x8b, 0x24, 0xb9, 0x56, 0x08, 0x8f, 0x95, 0xda, 0xd1, 0xba, 0x98, 0x0a,
-  0xeb, 0x72, 0xaa, 0x77, 0xb7, 0x39, 0xf2, 0xca, 0xb0, 0x6a, 0xdb, 0x62,
-  0x9b, 0xa4, 0x68, 0x80, 0x5f, 0xc4, 0x24, 0x81, 0xd5, 0xaf, 0xba, 0x58,
-  0x88, 0x0b, 0xfd, 0xbb, 0x8e, 0x25, 0xfd, 0x85, 0xc5, 0x6e, 0x4a, 0x92,
-  0xae, 0xfe, 0xb4, 0xf7, 0x0a, 0x5c, 0x78, 0xb9, 0xd0, 0xbb, 0x79, 0x95,
-  0x6f, 0x6c, 0x96, 0xe8, 0x06, 0x9e, 0x2e, 0xf0, 0x44, 0x1e, 0x2b, 0xb5,
-  0xd2, 0x0a, 0xbc, 0x15, 0xf6, 0xa3, 0x6c, 0x96, 0x8b, 0x7e, 0x5e, 0x0d,
-  0xf3, 0x65, 0x19, 0xdc, 0xc2, 0xa4, 0x02, 0x6f, 0xb6, 0x42, 0x24, 0x75,
-  0xdb, 0xd6, 0x52, 0xe1, 0xe5, 0x58, 0x30, 0x39, 0x2d, 0x29, 0xb6, 0x65,
-  0x5d, 0xa6, 0xc9, 0xf4, 0xce, 0xd5, 0xa3, 0x02, 0x37, 0xf2, 0x34, 0x12,
-  0x1d, 0xcb, 0xf2, 0x18, 0x09, 0xab, 0x87, 0x8c, 0x21, 0x49, 0xd3, 0x9d,
-  0x3a, 0x0b, 0x3d, 0x3c, 0x79, 0xfa, 0x37, 0x05, 0x6e, 0xac, 0x93, 0x6b,
-  0x61, 0x7f, 0xe2, 0x44, 0x37, 0xb4, 0x7e, 0x5e, 0x93, 0x54, 0x31, 0x5f,
-  0x96, 0xc1, 0x2d, 0x4c, 0x3c, 0x63, 0x1e, 0x55, 0x73, 0x5a, 0x5c, 0x3c,
-  0xf9, 0xee, 0xba, 0x2f, 0x57, 0x7a, 0x87, 0xc4, 0x75, 0xae, 0xce, 0xa7,
-  0x2c, 0xfb, 0x35, 0x7f, 0x36, 0xe7, 0x9f, 0x2c, 0xfb, 0x1d, 0x4c, 0x26,
-  0xfd, 0x66, 0x3f, 0xbd, 0x6d, 0xa1, 0xaa, 0x58, 0x65, 0x19, 0x0d, 0x55,
-  0xfd, 0x66, 0xa7, 0x73, 0x3f, 0x17, 0xb2, 0xe1, 0x88, 0x64, 0xc5, 0xab,
-  0x22, 0x2b, 0xab, 0xab, 0xcc, 0x32, 0x97, 0x83, 0xc9, 0x53, 0x99, 0x2d,
-  0x12, 0xd7, 0xf9, 0xd4, 0x8f, 0xfa, 0xfc, 0xd3, 0xe5, 0xd0, 0x13, 0xae,
-  0xdb, 0x29, 0x34, 0x2d, 0xd6, 0x1d, 0xf0, 0x69, 0x70, 0x01, 0xa7, 0xfa,
-  0xc9, 0x7e, 0xc9, 0xb6, 0x40, 0x7c, 0x03, 0x64, 0x02, 0xe3, 0xbd, 0x85,
-  0xfa, 0x27, 0xfb, 0xed, 0x0d, 0x54, 0x1e, 0x2c, 0x35, 0xfb, 0xbb, 0x92,
-  0xf6, 0x75, 0xd9, 0xff, 0xad, 0xef, 0x9e, 0x4a, 0x04, 0xf3, 0x31, 0x4f,
-  0x97, 0xa7, 0xba, 0x28, 0xb0, 0xfc, 0x81, 0x07, 0x93, 0x2c, 0x99, 0xee,
-  0x58, 0xef, 0xab, 0x6e, 0x92, 0xcb, 0xf4, 0xb2, 0xcd, 0x24, 0x57, 0x22,
-  0x77, 0xf9, 0x89, 0xfb, 0x43, 0x53, 0xd2, 0x59, 0x2b, 0x4c, 0xd5, 0x29,
-  0xe5, 0xce, 0xb1, 0xe9, 0xd5, 0x95, 0x1b, 0x1d, 0xb1, 0xaf, 0x90, 0x8c,
-  0xea, 0xa0, 0x3e, 0xe7, 0x66, 0xb8, 0x46, 0x2a, 0x5f, 0xe3, 0x9a, 0x65,
-  0x4b, 0xb3, 0x8f, 0x69, 0xae, 0x1a, 0x93, 0xe7, 0x8d, 0x95, 0xa7, 0xd0,
-  0x69, 0x13, 0xe1, 0xcc, 0x4e, 0x4b, 0xdf, 0xa1, 0x9f, 0xb5, 0xc9, 0xf8,
-  0x5e, 0xed, 0x2d, 0x9d, 0x6a, 0x2b, 0xb5, 0x39, 0x1b, 0x8f, 0x8f, 0x1c,
-  0xb8, 0x2e, 0x6d, 0x3d, 0x17, 0x17, 0xff, 0xe8, 0x03, 0x36, 0xbd, 0x5b,
-  0xf9, 0xa1, 0xaa, 0xd5, 0xf1, 0x7f, 0x37, 0xbd, 0x9d, 0x1f, 0x29, 0x35,
-  0x93, 0x8d, 0xee, 0x07, 0x5e, 0xe8, 0x1c, 0x99, 0xd3, 0xb1, 0xcd, 0x51,
-  0x4f, 0x60, 0xd7, 0xef, 0x06, 0xcf, 0x67, 0x1e, 0x81, 0xcb, 0x8b, 0x02,
-  0xcb, 0xf1, 0x53, 0xec, 0xeb, 0xd4, 0x90, 0xf9, 0xaf, 0x52, 0xcb, 0xa3,
-  0xe5, 0x90, 0xdf, 0x77, 0x95, 0x62, 0x6d, 0x26, 0x8d, 0xc9, 0xbe, 0x82,
-  0xee, 0xa6, 0xaa, 0x8e, 0x15, 0x43, 0x79, 0x91, 0xdb, 0x00, 0x9e, 0x41,
-  0x85, 0x75, 0xd6, 0xca, 0x9a, 0xfa, 0x95, 0x4f, 0x88, 0x7e, 0x43, 0x42,
-  0x26, 0xdf, 0xe2, 0x6e, 0xaf, 0xb5, 0xfb, 0x53, 0x0f, 0xf8, 0x5d, 0x62,
-  0x56, 0xb8, 0xca, 0x85, 0xca, 0x68, 0x64, 0x5b, 0x12, 0x50, 0x66, 0x43,
-  0x0a, 0x9c, 0x9b, 0x24, 0x8a, 0xb1, 0xf8, 0xe8, 0x81, 0xab, 0x23, 0x71,
-  0xb9, 0x52, 0x57, 0x8a, 0x7d, 0x81, 0x0f, 0xe6, 0xeb, 0xb4, 0xb7, 0xf3,
-  0x23, 0xa5, 0xb6, 0xd3, 0xbb, 0x74, 0xa5, 0x97, 0xaa, 0x79, 0x0e, 0x79,
-  0xb2, 0xde, 0x42, 0xe0, 0x0f, 0x61, 0x1e, 0x81, 0x53, 0x71, 0xe9, 0x42,
-  0x86, 0x9a, 0xeb, 0x8a, 0x33, 0xda, 0xe7, 0x23, 0xfe, 0xae, 0x7a, 0xb5,
-  0x5b, 0x5e, 0xab, 0xf0, 0x27, 0x97, 0xdc, 0x02, 0x06, 0xb2, 0x71, 0x10,
-  0x4a, 0x66, 0x40, 0x89, 0xba, 0x90, 0x9d, 0x64, 0x3a, 0x2a, 0x3f, 0x08,
-  0xd7, 0x8f, 0x37, 0xc3, 0xb6, 0x80, 0xc0, 0x74, 0x26, 0xae, 0x21, 0xb3,
-  0xd6, 0xa9, 0x1d, 0x07, 0x52, 0xb9, 0x2a, 0x2f, 0x7d, 0xb9, 0x4d, 0x0d,
-  0xb5, 0xc5, 0x6a, 0x60, 0x20, 0x75, 0x73, 0xed, 0x8a, 0xc5, 0x7a, 0xd3,
-  0xda, 0x13, 0xa1, 0x9f, 0x06, 0x3d, 0xf0, 0x41, 0x9a, 0xeb, 0x76, 0x20,
-  0xb0, 0x25, 0xee, 0xed, 0xfc, 0x48, 0xa9, 0x99, 0x9e, 0x77, 0xf7, 0x7f,
-  0xad, 0x3e, 0x96, 0xa6, 0x38, 0x6c, 0x8e, 0x20, 0xf0, 0x1b, 0x99, 0x45,
-  0x60, 0x55, 0x69, 0x8b, 0xb1, 0xaf, 0xeb, 0x48, 0xd7, 0x95, 0xaf, 0x93,
-  0xd9, 0xa4, 0x2a, 0xcc, 0xf6, 0x98, 0x1f, 0xd4, 0xa5, 0xc4, 0x7c, 0x75,
-  0xc8, 0xcb, 0xba, 0x5c, 0xd9, 0xdf, 0x5e, 0x55, 0xb2, 0xc5, 0x51, 0x6d,
-  0x72, 0x13, 0xd7, 0x69, 0x6a, 0xa7, 0x4c, 0x6c, 0xa8, 0x28, 0x2d, 0x13,
-  0x53, 0x9b, 0xa5, 0x74, 0x51, 0xa9, 0x7d, 0x21, 0x8d, 0x50, 0xe2, 0x55,
-  0xab, 0x83, 0x57, 0x99, 0x65, 0x30, 0xd7, 0xad, 0x36, 0xa8, 0x4e, 0xe5,
-  0x21, 0x3f, 0x6e, 0xe5, 0x8e, 0xfa, 0x4a, 0x4a, 0x99, 0xcb, 0x2c, 0x6d,
-  0x6c, 0x88, 0x28, 0xaf, 0x8a, 0x85, 0x15, 0xee, 0xa0, 0xf3, 0x5b, 0xaf,
-  0xfa, 0xf3, 0x7a, 0x8b, 0xdd, 0xb1, 0x9b, 0xc7, 0xb3, 0xc9, 0x68, 0x81,
-  0x0f, 0xe5, 0xce, 0xaa, 0xb0, 0x1e, 0xc6, 0x67, 0xf0, 0xc3, 0xac, 0xf2,
-  0x52, 0x1d, 0xc2, 0x31, 0x20, 0xf0, 0xae, 0x50, 0xcb, 0x3e, 0xdc, 0x09,
-  0xf3, 0xe1, 0x52, 0x33, 0xb6, 0x6e, 0xff, 0x0b, 0xdf, 0x2a, 0xdb, 0x53,
-  0xf3, 0x5b, 0x43, 0xe0, 0x4f, 0x60, 0x16, 0x81, 0xbf, 0xae, 0xfc, 0x64,
-  0xae, 0xf1, 0x89, 0xf5, 0xc8, 0x6c, 0x6d, 0xcf, 0xfd, 0x35, 0xf5, 0xbe,
-  0xb1, 0x2d, 0x87, 0xac, 0x14, 0x51, 0xd3, 0x0e, 0x97, 0x05, 0x0c, 0xa6,
-  0x63, 0xba, 0x89, 0x29, 0xdb, 0x87, 0xcf, 0xad, 0xef, 0x89, 0xdf, 0x08,
-  0xf9, 0x02, 0xa7, 0x3d, 0x81, 0x9b, 0x73, 0x16, 0xf7, 0x13, 0x52, 0x4d,
-  0x9d, 0x6c, 0x92, 0xcb, 0xda, 0x4c, 0xde, 0x1c, 0x6d, 0x07, 0x3c, 0x6f,
-  0xdb, 0xda, 0x3a, 0x24, 0x57, 0x35, 0x74, 0xc2, 0x35, 0x26, 0xdf, 0x2a,
-  0x27, 0x81, 0x4b, 0x6b, 0x5b, 0x23, 0x40, 0x6a, 0xe3, 0x37, 0xb6, 0x56,
-  0xc3, 0xf8, 0x2c, 0x26, 0xc3, 0xea, 0xd4, 0xd7, 0x98, 0x8b, 0xb4, 0xdd,
-  0xe8, 0xa2, 0x27, 0x70, 0x37, 0xce, 0x5f, 0xf5, 0x77, 0x7f, 0xb0, 0xd4,
-  0x6a, 0x1d, 0xf5, 0xb2, 0xfb, 0x37, 0x91, 0xb6, 0x1f, 0xcc, 0x09, 0xc8,
-  0x17, 0x78, 0x93, 0x49, 0x20, 0xf0, 0x8b, 0x99, 0x43, 0xe0, 0x5c, 0xd8,
-  0xf9, 0xdd, 0x11, 0x0a, 0xd3, 0x06, 0xeb, 0x19, 0xa9, 0xaa, 0xd7, 0x42,
-  0x58, 0x56, 0x5e, 0xa5, 0x28, 0x42, 0xd5, 0x61, 0x50, 0x15, 0x0f, 0xf4,
-  0x7a, 0xc7, 0xd6, 0xd6, 0xdc, 0xd4, 0xaf, 0xc3, 0x4b, 0x41, 0x5b, 0x72,
-  0x5f, 0x60, 0x8b, 0x77, 0x10, 0x7e, 0xa7, 0x5b, 0xe7, 0x59, 0x9e, 0x7f,
-  0xb6, 0x3a, 0x0b, 0x52, 0xa1, 0x85, 0xcb, 0x49, 0x49, 0x55, 0x68, 0x85,
-  0x9b, 0x34, 0xa3, 0xd8, 0xfc, 0xa7, 0x36, 0x80, 0x11, 0x38, 0x10, 0x9f,
-  0xc5, 0x64, 0x78, 0x67, 0x4f, 0x7d, 0x6d, 0xa4, 0xc3, 0xf8, 0x02, 0xaf,
-  0x82, 0xbb, 0x3f, 0x58, 0x6a, 0xad, 0x8e, 0x5a, 0xee, 0xb0, 0x93, 0x81,
-  0x13, 0xf3, 0x13, 0xf9, 0x02, 0x6b, 0x20, 0xf0, 0x8b, 0x99, 0x41, 0x60,
-  0x55, 0xb3, 0x47, 0x3b, 0xd0, 0x92, 0xfa, 0xe0, 0x14, 0x2e, 0x75, 0x35,
-  0xe9, 0xfd, 0xc6, 0xe7, 0xee, 0x82, 0xcd, 0xd2, 0xab, 0x14, 0xe5, 0x4d,
-  0x02, 0xcb, 0xcf, 0xa6, 0xf6, 0x38, 0xcb, 0x4a, 0x3f, 0x57, 0x2b, 0x41,
-  0x87, 0xe9, 0x61, 0x81, 0x17, 0xde, 0x49, 0xa8, 0xd7, 0x33, 0x74, 0xab,
-  0x92, 0x6c, 0xf6, 0x77, 0xce, 0x51, 0x93, 0xdf, 0x83, 0xdb, 0x69, 0x78,
-  0x8c, 0xd5, 0xf9, 0x37, 0xcb, 0x36, 0x9e, 0xc0, 0x2e, 0xf3, 0xa5, 0xf6,
-  0xc8, 0x8f, 0xcf, 0xe2, 0x65, 0x98, 0x2c, 0x42, 0xc9, 0xfb, 0x02, 0x27,
-  0xc1, 0xdd, 0x1f, 0x2c, 0x35, 0xdd, 0x22, 0x97, 0xb2, 0x63, 0x90, 0xca,
-  0xa6, 0x77, 0x69, 0x4e, 0x12, 0x10, 0xf8, 0x13, 0x98, 0x2e, 0xb0, 0x9a,
-  0xaa, 0x1d, 0x5f, 0x86, 0xa5, 0x69, 0xd4, 0xd0, 0x51, 0xb8, 0x6e, 0x18,
-  0xfd, 0x8d, 0x9b, 0x9f, 0xa5, 0x57, 0x09, 0x1e, 0x15, 0x98, 0x4e, 0x67,
-  0xfb, 0xfe, 0x5d, 0xea, 0x42, 0x6b, 0x7a, 0x4b, 0xc4, 0xe4, 0x71, 0xb9,
-  0xe9, 0x33, 0x72, 0xd2, 0x31, 0x37, 0xcc, 0xf5, 0x65, 0x2a, 0xfb, 0x2d,
-  0x3a, 0xed, 0x8d, 0xda, 0x0b, 0x35, 0xe3, 0x02, 0x07, 0xe2, 0xb3, 0x98,
-  0x0c, 0x93, 0xd2, 0x36, 0xc1, 0x27, 0x0b, 0x3c, 0x5e, 0x6a, 0xea, 0x1c,
-  0x25, 0x0f, 0xb8, 0x94, 0xd1, 0x17, 0x72, 0x9f, 0x6d, 0x0b, 0x81, 0x3f,
-  0x84, 0xc9, 0x02, 0xdf, 0xe8, 0x6f, 0x47, 0xad, 0xa7, 0x6d, 0x4a, 0xd7,
-  0x89, 0xd3, 0x34, 0xde, 0x04, 0x6f, 0xfb, 0xb8, 0xc0, 0xbd, 0x69, 0xdc,
-  0x51, 0x81, 0x77, 0xe6, 0x2f, 0x3d, 0xb9, 0xb3, 0x15, 0xc3, 0x65, 0x58,
-  0x46, 0x2b, 0x9a, 0xae, 0x72, 0xdc, 0x8c, 0x1d, 0xaf, 0x0b, 0x4c, 0x8a,
-  0x77, 0xdf, 0xcf, 0xd7, 0x63, 0x02, 0x93, 0x5c, 0x99, 0x83, 0x98, 0x2c,
-  0xf0, 0x78, 0xa9, 0xa9, 0xfd, 0xaa, 0x54, 0x06, 0x93, 0xd3, 0xd0, 0x55,
-  0x7f, 0x67, 0x1d, 0xdf, 0xae, 0x94, 0x40, 0xe0, 0x17, 0x33, 0x55, 0xe0,
-  0x3b, 0xfc, 0xb5, 0x37, 0xc5, 0x15, 0x83, 0x16, 0x58, 0xcd, 0xac, 0xa6,
-  0x65, 0xe9, 0x8f, 0x81, 0x1f, 0xed, 0x42, 0x87, 0xaa, 0xa2, 0x4c, 0xd2,
-  0xce, 0x0a, 0x27, 0xc6, 0x46, 0x33, 0x89, 0x25, 0x7b, 0xf8, 0xfe, 0xed,
-  0xb6, 0xc2, 0x3f, 0xb2, 0x7e, 0x0b, 0x1c, 0x05, 0x85, 0xdb, 0xf6, 0x32,
-  0x60, 0x77, 0x57, 0xfb, 0x1c, 0x72, 0x35, 0xe7, 0xfc, 0xb8, 0xc0, 0x0b,
-  0xe1, 0xb7, 0xc0, 0x87, 0xd9, 0xba, 0xd0, 0x41, 0x81, 0xe5, 0x9c, 0x59,
-  0x37, 0x5d, 0xbd, 0x50, 0xc1, 0x76, 0xae, 0x8f, 0xed, 0x0b, 0x8c, 0x59,
-  0xe8, 0xf7, 0x30, 0x51, 0xe0, 0xa1, 0xbf, 0x97, 0xef, 0x35, 0xd2, 0xf5,
-  0xa3, 0x37, 0x06, 0x96, 0x67, 0x75, 0x39, 0x79, 0x93, 0x88, 0x89, 0x02,
-  0x4b, 0x11, 0x43, 0x8b, 0x0c, 0x0b, 0xd2, 0x74, 0xe9, 0xe9, 0x63, 0xba,
-  0x12, 0x4b, 0xc6, 0x1a, 0x0f, 0x57, 0x21, 0x05, 0xeb, 0xa5, 0xc9, 0x3e,
-  0x19, 0xf0, 0x9a, 0xfc, 0xa6, 0x3d, 0x01, 0x2c, 0x6b, 0x93, 0xbc, 0x3f,
-  0x89, 0xe5, 0x09, 0x1c, 0x88, 0xcf, 0x2f, 0xb9, 0xc0, 0x18, 0x78, 0x8e,
-  0x2e, 0xf4, 0x78, 0xa9, 0xa9, 0x9f, 0xe6, 0xb8, 0xb4, 0xdd, 0x95, 0x24,
-  0x35, 0x25, 0x07, 0x81, 0x3f, 0x82, 0x69, 0x02, 0x0f, 0xfc, 0xcd, 0x84,
-  0x88, 0x87, 0x2b, 0x78, 0x2b, 0x5b, 0x37, 0x74, 0xab, 0xa6, 0x6c, 0xb2,
-  0x5b, 0xdd, 0xd5, 0xc7, 0xc9, 0x02, 0xdb, 0xd9, 0xeb, 0x01, 0x91, 0x70,
-  0xc3, 0x5c, 0x37, 0xdd, 0x6b, 0x63, 0x58, 0x88, 0xfe, 0x28, 0x58, 0x36,
-  0x95, 0xee, 0x26, 0xc9, 0xca, 0x29, 0xbe, 0xd5, 0x61, 0x65, 0x56, 0xd6,
-  0x2e, 0x27, 0x66, 0x16, 0x3a, 0x50, 0x7b, 0xdd, 0x6d, 0x01, 0x17, 0x04,
-  0x0e, 0xc4, 0x67, 0x31, 0xfb, 0x1f, 0x6c, 0x3e, 0xed, 0xda, 0xcf, 0xe9,
-  0x02, 0x8f, 0x97, 0x9a, 0x0c, 0x92, 0xea, 0xf0, 0x5d, 0x89, 0x1c, 0xcc,
-  0x71, 0x40, 0xe0, 0x8f, 0x60, 0x9a, 0xc0, 0xf4, 0x06, 0xdb, 0xee, 0x37,
-  0x24, 0x95, 0x9c, 0xd0, 0xc4, 0xb1, 0x5e, 0xc1, 0xb1, 0x37, 0x2d, 0x9f,
-  0xd4, 0x65, 0xdf, 0xea, 0xeb, 0xc0, 0xf6, 0x82, 0x8a, 0x5a, 0xfb, 0x54,
-  0x5f, 0x14, 0x98, 0x5c, 0xa8, 0x09, 0x54, 0x45, 0xe2, 0x40, 0x7b, 0xf2,
-  0x32, 0x72, 0x10, 0xf6, 0x64, 0xa3, 0xce, 0x3b, 0x95, 0x17, 0x43, 0x4e,
-  0x5b, 0x68, 0x49, 0xe1, 0x76, 0x28, 0x6a, 0x73, 0x06, 0x38, 0xd2, 0x69,
-  0x77, 0xb7, 0x3c, 0xd3, 0xee, 0x5d, 0x93, 0x68, 0xe8, 0x25, 0x6e, 0xb7,
-  0x5a, 0xfc, 0x6b, 0x5c, 0xe0, 0x40, 0x7c, 0x16, 0xb3, 0x7f, 0x6e, 0x8b,
-  0xd8, 0x9e, 0x85, 0x6e, 0x11, 0xf8, 0xd1, 0x52, 0x93, 0xb3, 0xf7, 0x0b,
-  0x5d, 0x0e, 0xa9, 0xfe, 0xbc, 0xf2, 0x72, 0x04, 0x81, 0xdf, 0xc9, 0x34,
-  0x81, 0x3d, 0x7f, 0xff, 0xab, 0x30, 0xe9, 0xa0, 0xde, 0x99, 0x19, 0xaa,
-  0x78, 0x9f, 0xe9, 0x8b, 0x44, 0x64, 0x55, 0xd3, 0xf2, 0x3b, 0xfb, 0xea,
-  0xee, 0xc1, 0x95, 0x3f, 0x79, 0x7c, 0xaa, 0x4e, 0x6a, 0x2e, 0xeb, 0x78,
-  0x51, 0x60, 0x35, 0xe3, 0xb2, 0xcf, 0x96, 0x75, 0xa8, 0x2a, 0xaa, 0x15,
-  0x10, 0xeb, 0xdf, 0xea, 0x7c, 0x5a, 0xfa, 0xcf, 0x18, 0x50, 0xdf, 0x88,
-  0xaf, 0x9f, 0x9f, 0xbd, 0x4d, 0x85, 0xc6, 0xb0, 0x10, 0xfd, 0x79, 0x2c,
-  0x35, 0x6d, 0xbe, 0xce, 0xb2, 0xb5, 0x8c, 0x49, 0x49, 0xf5, 0x7d, 0x3e,
-  0x49, 0xfd, 0x57, 0x76, 0x9f, 0xf8, 0xf4, 0xfb, 0x2d, 0xec, 0x81, 0xab,
-  0xbe, 0x78, 0x76, 0xae, 0x7e, 0xf7, 0xde, 0xb3, 0x0b, 0x54, 0xae, 0xab,
-  0x5f, 0xb5, 0x86, 0x74, 0xd9, 0x86, 0x04, 0x0e, 0xc5, 0xe7, 0xed, 0x6f,
-  0x73, 0xbc, 0x3e, 0x9d, 0xbf, 0xed, 0x51, 0xdc, 0x22, 0xf0, 0xa3, 0xa5,
-  0x66, 0x07, 0xf5, 0xf6, 0xb7, 0xb0, 0x57, 0xe3, 0x20, 0xf0, 0x27, 0x30,
-  0xaf, 0xc0, 0xbd, 0xae, 0xb1, 0xe2, 0xe8, 0x87, 0x8a, 0x5c, 0xcb, 0xa7,
-  0x58, 0xeb, 0x29, 0x24, 0x47, 0x75, 0x49, 0xe0, 0x56, 0x3f, 0x3f, 0x40,
-  0x7c, 0x85, 0xaa, 0xa2, 0x7f, 0x3b, 0x80, 0x7f, 0x6b, 0x02, 0x4d, 0x25,
-  0xd2, 0xfd, 0xfe, 0xfe, 0x52, 0xca, 0xe3, 0xc8, 0x0e, 0xa9, 0x15, 0xda,
-  0xe5, 0x71, 0x70, 0x68, 0xa5, 0x79, 0xf6, 0x8d, 0x3d, 0x34, 0xd7, 0x9a,
-  0xf5, 0x66, 0xb7, 0xd2, 0xa0, 0xc0, 0x81, 0xf8, 0xbc, 0xa2, 0x6e, 0xdb,
-  0xde, 0x94, 0x71, 0xd2, 0xde, 0x28, 0xf0, 0xc3, 0xa5, 0x66, 0x56, 0x6c,
-  0xb7, 0x76, 0xea, 0xc0, 0x5b, 0x3b, 0xde, 0x42, 0xe0, 0xf7, 0x32, 0xa7,
-  0xc0, 0xba, 0x8e, 0x0f, 0xa6, 0x70, 0x0a, 0xcf, 0x1c, 0x7d, 0xcf, 0x5d,
-  0x42, 0xb7, 0xd8, 0x8a, 0xbb, 0x3b, 0xe8, 0x6e, 0xe1, 0x05, 0x81, 0x6d,
-  0x65, 0x2b, 0x43, 0x55, 0xb1, 0x3d, 0xba, 0xd4, 0x22, 0x3f, 0x2b, 0x54,
-  0xc8, 0x1f, 0x7d, 0x3b, 0x6d, 0x7f, 0x4e, 0xc8, 0xeb, 0xff, 0x97, 0x6e,
-  0x87, 0x2e, 0x4f, 0x15, 0xc9, 0xb3, 0xea, 0x1d, 0x37, 0x46, 0xcb, 0x95,
-  0x5b, 0xc1, 0x54, 0x11, 0xcf, 0xb7, 0x2e, 0x36, 0xbb, 0x20, 0x7c, 0x25,
-  0xcf, 0x72, 0x55, 0x50, 0x60, 0x17, 0xdf, 0xa1, 0x6f, 0xa0, 0x3b, 0xc0,
-  0xdc, 0xe5, 0x6a, 0xe5, 0x16, 0x5f, 0x5c, 0x13, 0xf8, 0xd1, 0x52, 0xd3,
-  0xcf, 0x31, 0x21, 0xbd, 0x66, 0x33, 0x5a, 0x86, 0xc0, 0x9f, 0xc0, 0xdc,
-  0x8f, 0x40, 0x29, 0xd2, 0xc0, 0x34, 0x74, 0x93, 0x9a, 0xf3, 0x7f, 0xb4,
-  0xb3, 0x55, 0xda, 0x6c, 0x93, 0x5b, 0x74, 0xa5, 0xcc, 0xe5, 0x50, 0xf5,
-  0x70, 0x59, 0x60, 0x53, 0xd9, 0x92, 0x2a, 0x58, 0x15, 0xdb, 0xda, 0x78,
-  0x76, 0x18, 0x0c, 0xc6, 0x6d, 0x3e, 0x3a, 0x96, 0xdd, 0x4d, 0xbe, 0xa4,
-  0xf2, 0xa9, 0xa6, 0xcd, 0x9b, 0xc7, 0x6a, 0x76, 0x2a, 0xa9, 0xe8, 0xe8,
-  0xa5, 0x2c, 0x76, 0xf6, 0x20, 0x77, 0x5a, 0xa4, 0x92, 0x18, 0x63, 0x1a,
-  0xad, 0xc4, 0x33, 0x48, 0x5d, 0x22, 0x13, 0x49, 0xd3, 0x1d, 0xec, 0xa2,
-  0x0d, 0x0a, 0x6c, 0xe2, 0x4b, 0x9a, 0xa2, 0x67, 0x60, 0x23, 0xec, 0x2a,
-  0x4b, 0xab, 0xf9, 0x42, 0x3f, 0x79, 0xea, 0x26, 0x81, 0x1f, 0x2d, 0x35,
-  0x7d, 0xf3, 0x93, 0xea, 0x35, 0xeb, 0x30, 0xea, 0xe8, 0x21, 0xf0, 0x27,
-  0xf0, 0xaa, 0x67, 0x18, 0xd5, 0xe5, 0x31, 0x4d, 0x0b, 0x5f, 0xee, 0xb2,
-  0x48, 0x73, 0xfb, 0x10, 0x8b, 0xf2, 0x98, 0x57, 0x3a, 0xe4, 0xd5, 0x07,
-  0x53, 0x35, 0xe5, 0x31, 0xcd, 0x2f, 0x5d, 0xaf, 0x2a, 0x8b, 0x7e, 0x5a,
-  0x2e, 0x1f, 0x79, 0x7a, 0x30, 0x6d, 0xe4, 0x0d, 0xcf, 0xd7, 0xeb, 0x92,
-  0xa2, 0x51, 0xd5, 0x65, 0x7a, 0x2c, 0xbd, 0x2a, 0x5e, 0xa6, 0xc5, 0xe0,
-  0xe1, 0x1b, 0x75, 0xe9, 0x8e, 0x8c, 0x84, 0xcc, 0x53, 0xbd, 0x6b, 0x79,
-  0x21, 0xe1, 0x50, 0x7c, 0x83, 0x7b, 0x3a, 0xca, 0x3c, 0x94, 0xc0, 0x65,
-  0x26, 0x94, 0x1a, 0xf8, 0x58, 0xfe, 0xcd, 0x87, 0x90, 0x55, 0x3b, 0xd2,
-  0xac, 0x70, 0x40, 0x2d, 0x55, 0xc3, 0x63, 0x6b, 0x40, 0x9f, 0x7f, 0x53,
-  0x60, 0x35, 0x2e, 0x5f, 0xb1, 0x79, 0xf6, 0x69, 0xad, 0xa6, 0xe7, 0xf1,
-  0xb6, 0x03, 0xd0, 0xe7, 0x5f, 0x15, 0xb8, 0xad, 0xa2, 0x8b, 0x37, 0x40,
-  0x7e, 0x14, 0x7a, 0x22, 0x09, 0x0d, 0x30, 0x18, 0xf0, 0xcf, 0x0a, 0xdc,
-  0x56, 0xb7, 0x2e, 0xe0, 0x7e, 0x3f, 0x0d, 0x5d, 0x45, 0x06, 0x00, 0xe1,
-  0xdf, 0x15, 0x98, 0x13, 0xa9, 0x9b, 0x08, 0x07, 0x80, 0x02, 0x81, 0x39,
-  0x50, 0x47, 0x29, 0xc6, 0xbf, 0x20, 0x04, 0x04, 0x06, 0x80, 0x31, 0x10,
-  0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18, 0x03, 0x81, 0x01, 0x60, 0x0c,
-  0x04, 0x06, 0x80, 0x31, 0x10, 0x18, 0x00, 0xc6, 0x40, 0x60, 0x00, 0x18,
-  0x03, 0x81, 0x01, 0x60, 0xcc, 0x5f, 0x13, 0xb8, 0x1e, 0xbc, 0xd8, 0x1b,
-  0x80, 0x3f, 0xcc, 0x9f, 0x12, 0x78, 0xb3, 0xf4, 0x1e, 0xa5, 0x0e, 0xc0,
-  0x9f, 0xe7, 0x4f, 0xd5, 0x77, 0xf2, 0x80, 0x09, 0x00, 0xfe, 0x09, 0x3e,
-  0xaa, 0xbe, 0x37, 0x13, 0x17, 0xfc, 0x42, 0x60, 0xf0, 0xaf, 0xf1, 0x31,
-  0xf5, 0x3d, 0xdf, 0xc4, 0x93, 0xef, 0x78, 0x85, 0xc0, 0xe0, 0x5f, 0xe3,
-  0x63, 0xea, 0xfb, 0xe8, 0x3b, 0x49, 0xee, 0x00, 0x02, 0x83, 0x7f, 0x8d,
-  0x8f, 0xa9, 0xef, 0x10, 0x18, 0x80, 0xfb, 0x79, 0x65, 0x7d, 0x6f, 0x7e,
-  0xb3, 0x1f, 0x7a, 0x95, 0xe7, 0x7c, 0xca, 0xce, 0x76, 0xd4, 0x7b, 0xb3,
-  0xc0, 0xd5, 0x6f, 0x76, 0x1a, 0x5c, 0x2b, 0x6a, 0x4e, 0xd9, 0x09, 0x02,
-  0x83, 0x7f, 0x8f, 0x97, 0xd4, 0x77, 0xe9, 0x66, 0x93, 0x49, 0xbf, 0x36,
-  0xe6, 0x49, 0x54, 0x99, 0x7a, 0xb1, 0x52, 0x2c, 0x9f, 0x6c, 0x43, 0x5e,
-  0xd4, 0x90, 0xba, 0x27, 0xa8, 0xda, 0x87, 0x10, 0x1f, 0xec, 0xd3, 0x88,
-  0xcd, 0x8b, 0xc0, 0x37, 0xb5, 0x8b, 0xfa, 0xd0, 0x96, 0xb1, 0x7c, 0x68,
-  0xb2, 0x15, 0xb8, 0x59, 0xba, 0xc7, 0x17, 0x03, 0xf0, 0x87, 0x79, 0x99,
-  0xc0, 0x5b, 0xf3, 0x82, 0x6b, 0xf5, 0xea, 0x1d, 0xf2, 0x4a, 0xef, 0xaf,
-  0xc6, 0x13, 0xb8, 0x90, 0xcf, 0x30, 0x8f, 0xed, 0x93, 0xd6, 0x73, 0xf2,
-  0xd2, 0xc2, 0xe6, 0xcb, 0x06, 0x8b, 0x33, 0x1b, 0x75, 0x22, 0x5f, 0x56,
-  0x96, 0x10, 0x81, 0xc9, 0x7b, 0x3a, 0x01, 0xf8, 0xcb, 0xbc, 0x4c, 0x60,
-  0x87, 0x6c, 0x18, 0x37, 0xf2, 0xa3, 0x7a, 0xc2, 0xfa, 0xce, 0x13, 0xb8,
-  0x52, 0xaf, 0xf1, 0xb1, 0x6f, 0x03, 0x49, 0xf5, 0x5b, 0x10, 0x13, 0xf3,
-  0x66, 0x3f, 0x43, 0x69, 0xa2, 0x5e, 0x9a, 0x77, 0x66, 0x1b, 0x81, 0x65,
-  0x1b, 0xbe, 0x7a, 0xc5, 0x91, 0x01, 0xf0, 0x5e, 0x5e, 0x28, 0x70, 0x92,
-  0xab, 0x97, 0x24, 0xa5, 0x56, 0xb1, 0x46, 0xbf, 0x22, 0xa9, 0x6a, 0xf3,
-  0x54, 0x7e, 0x48, 0xd2, 0x34, 0xd5, 0xef, 0x01, 0xab, 0xcc, 0x0b, 0x41,
-  0x13, 0xdb, 0x51, 0xd6, 0x8f, 0x57, 0x3d, 0x94, 0xb9, 0x14, 0x7f, 0xd9,
-  0x7a, 0xe7, 0x86, 0xdc, 0x0a, 0x2c, 0x5f, 0x52, 0x1a, 0xe1, 0x21, 0x52,
-  0xe0, 0x1f, 0xe0, 0x75, 0x02, 0x77, 0x2d, 0xa2, 0x9d, 0xa9, 0x92, 0x1d,
-  0xe8, 0xda, 0xbc, 0xf0, 0x6e, 0xdb, 0x7a, 0x93, 0x58, 0x47, 0xdd, 0xbe,
-  0x26, 0x42, 0x44, 0xd2, 0xd3, 0x52, 0x0b, 0x6a, 0x5f, 0x4f, 0xa0, 0x5e,
-  0x87, 0x99, 0x3b, 0x81, 0xb7, 0x69, 0xf7, 0xd4, 0x37, 0x2d, 0xb0, 0x6c,
-  0xa7, 0xf1, 0x10, 0x47, 0xf0, 0x2f, 0xf0, 0x3a, 0x81, 0xbb, 0xd7, 0x20,
-  0x18, 0x4b, 0x6b, 0xd7, 0xc7, 0x5d, 0xe9, 0x01, 0x2f, 0x11, 0xb8, 0x74,
-  0x3d, 0xe2, 0xad, 0x34, 0x32, 0x57, 0x4d, 0xb2, 0x7a, 0xbb, 0xa5, 0x6c,
-  0x59, 0x0f, 0xc6, 0x7b, 0xe5, 0xef, 0x91, 0xa4, 0xd3, 0x7f, 0x8d, 0x10,
-  0x00, 0x7f, 0x98, 0xd7, 0x09, 0xdc, 0x7d, 0x30, 0x96, 0x96, 0xc2, 0x7f,
-  0xe1, 0x5d, 0xeb, 0x5f, 0x46, 0x52, 0x3d, 0xe6, 0xee, 0xbd, 0x78, 0xa5,
-  0x7b, 0x6f, 0xb8, 0xde, 0x4b, 0xbd, 0xa1, 0xcf, 0xbe, 0x01, 0x4f, 0xb8,
-  0x6d, 0xe6, 0x44, 0x81, 0x0e, 0x34, 0xf8, 0x77, 0x78, 0x8f, 0xc0, 0xbd,
-  0x17, 0x59, 0x77, 0xfd, 0x65, 0x2a, 0xf0, 0x4a, 0xda, 0x99, 0x77, 0x66,
-  0xca, 0xe6, 0x35, 0x51, 0xb6, 0x1e, 0x5d, 0xd3, 0x5a, 0x9a, 0x28, 0x05,
-  0xd9, 0x4d, 0xfd, 0xb1, 0xd3, 0x03, 0x66, 0x00, 0xfe, 0x01, 0xde, 0x23,
-  0x70, 0x7a, 0x59, 0xe0, 0xce, 0xc1, 0x75, 0xd7, 0x4d, 0x4e, 0xba, 0x19,
-  0xe9, 0x43, 0xbb, 0x24, 0x7b, 0x29, 0x81, 0x6b, 0x4f, 0xe0, 0x92, 0xa6,
-  0x23, 0xfb, 0xdb, 0x31, 0x9b, 0xf7, 0x96, 0x01, 0x30, 0x85, 0xf7, 0x08,
-  0x9c, 0x5f, 0x16, 0x58, 0x7e, 0xdd, 0xb5, 0xbb, 0x69, 0x37, 0x23, 0x9d,
-  0xc8, 0xfd, 0x0b, 0xbd, 0x39, 0xd4, 0x02, 0x7b, 0x02, 0xab, 0xab, 0x50,
-  0x68, 0x82, 0xc1, 0x3f, 0xc1, 0x1b, 0xc7, 0xc0, 0xfe, 0x3c, 0x13, 0x15,
-  0x58, 0xbe, 0x15, 0xbe, 0x96, 0xd6, 0xa6, 0xdd, 0x6b, 0xb8, 0xf5, 0xdc,
-  0x95, 0xdc, 0x6b, 0x2d, 0x43, 0xc8, 0x8f, 0x51, 0x58, 0xe0, 0xd2, 0xcd,
-  0x75, 0x01, 0xf0, 0xc7, 0x79, 0x8f, 0xc0, 0x81, 0x55, 0xcb, 0xb2, 0x79,
-  0xdd, 0x91, 0x1d, 0x8e, 0x72, 0xe6, 0xb9, 0xd0, 0x9d, 0xe2, 0x4e, 0xd6,
-  0x66, 0x6c, 0x16, 0xda, 0x17, 0x58, 0xcd, 0x8b, 0x6d, 0x5e, 0x71, 0x60,
-  0x00, 0xbc, 0x99, 0x37, 0x09, 0xbc, 0x72, 0xdd, 0xdc, 0xe6, 0x24, 0xff,
-  0x23, 0xcd, 0xab, 0x52, 0x70, 0x25, 0xf7, 0xe9, 0xda, 0xe1, 0xc4, 0x34,
-  0xd7, 0x0b, 0xb3, 0xbb, 0x5a, 0xeb, 0x9c, 0x8f, 0x08, 0x5c, 0x7a, 0x1b,
-  0x01, 0xf8, 0xc3, 0xbc, 0x49, 0x60, 0xe5, 0xd8, 0xfe, 0x5c, 0x9f, 0xbf,
-  0x63, 0x75, 0x15, 0x57, 0x4d, 0x4b, 0x7d, 0x65, 0xeb, 0xbc, 0xb5, 0x93,
-  0x5c, 0x2b, 0xb7, 0x52, 0x43, 0x76, 0xae, 0xd5, 0x5e, 0xdf, 0xe7, 0x93,
-  0x5c, 0xd1, 0xb1, 0x68, 0x46, 0x04, 0x56, 0x4b, 0xb9, 0x96, 0xaf, 0x38,
-  0x32, 0x00, 0xde, 0xcb, 0x9b, 0x04, 0x96, 0x13, 0xcd, 0x16, 0xb9, 0x3a,
-  0x7a, 0xa5, 0xff, 0x58, 0xba, 0x57, 0xd2, 0xef, 0xdc, 0x7d, 0x4a, 0x85,
-  0x8c, 0x28, 0xa1, 0x7b, 0xd9, 0xb5, 0xd0, 0x03, 0x81, 0x6b, 0xe7, 0x3c,
-  0x00, 0x7f, 0x9a, 0x77, 0x09, 0xdc, 0x6c, 0x9d, 0x89, 0x0b, 0x69, 0x67,
-  0x69, 0xfe, 0xcc, 0x8d, 0x81, 0x32, 0xa4, 0x5a, 0x10, 0xad, 0xe7, 0xa4,
-  0x1a, 0x67, 0x70, 0x94, 0xbb, 0xa8, 0xfb, 0x02, 0xab, 0xd3, 0x03, 0x2e,
-  0x25, 0x81, 0xbf, 0xcf, 0xbb, 0x04, 0x6e, 0x5b, 0x75, 0x67, 0x83, 0x10,
-  0x8b, 0xbc, 0xf5, 0x36, 0x48, 0x9d, 0x23, 0x2b, 0xa6, 0xba, 0xe2, 0x64,
-  0xd6, 0x5a, 0xb5, 0x47, 0xbd, 0xd7, 0xb6, 0x22, 0x51, 0x0f, 0x04, 0xae,
-  0x23, 0x41, 0xa6, 0xc4, 0x00, 0xf8, 0xb3, 0xbc, 0xf3, 0x01, 0x16, 0x4d,
-  0x79, 0x3c, 0x96, 0x0d, 0xfd, 0x3b, 0x4f, 0x8f, 0x57, 0xef, 0xc2, 0xaf,
-  0xcb, 0x34, 0x2d, 0x71, 0x91, 0x08, 0x80, 0xf6, 0x93, 0x9e, 0x89, 0x05,
-  0x00, 0xb8, 0x1f, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03,
-  0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0,
-  0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20,
-  0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18,
-  0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x79, 0x8b, 0xc0, 0xd9,
-  0x32, 0xfe, 0x6e, 0x2e, 0x07, 0xa9, 0xbf, 0xc4, 0xba, 0x78, 0x55, 0x7e,
-  0x00, 0xe0, 0xca, 0x3b, 0x04, 0x4e, 0x85, 0x10, 0x62, 0xaf, 0xff, 0x38,
-  0xd7, 0xfa, 0x43, 0x7d, 0xa6, 0x61, 0x96, 0x5d, 0x98, 0xf2, 0xae, 0x68,
-  0xab, 0x6a, 0xa6, 0xfc, 0x4d, 0xa4, 0x39, 0xdb, 0x63, 0xfa, 0x3b, 0x34,
-  0xe7, 0x2b, 0x67, 0x5c, 0xf0, 0x1e, 0xde, 0x21, 0xf0, 0xba, 0x93, 0xb3,
-  0x4b, 0x38, 0xef, 0x3e, 0xa5, 0xdd, 0xa6, 0x4d, 0xac, 0xb6, 0x18, 0x4a,
-  0x19, 0x64, 0x77, 0x73, 0x94, 0xf9, 0xe6, 0x3f, 0xdf, 0x93, 0x67, 0x64,
-  0xf6, 0x4e, 0x9a, 0x4c, 0xe6, 0x3c, 0xde, 0x7f, 0xc8, 0xd9, 0x64, 0x16,
-  0x36, 0xcb, 0xbb, 0xcf, 0xa6, 0xe0, 0x45, 0x4c, 0x15, 0xb8, 0xcc, 0x3a,
-  0xf7, 0xe2, 0xfd, 0xc5, 0x9f, 0xf7, 0x4c, 0x69, 0xda, 0xc4, 0x08, 0x2c,
-  0x9b, 0x62, 0x29, 0xb0, 0xd9, 0x62, 0xa3, 0x95, 0x1b, 0x0e, 0x37, 0x67,
-  0x43, 0xc6, 0xf4, 0x01, 0x02, 0x37, 0xb2, 0xe7, 0xd0, 0xf1, 0x97, 0xfa,
-  0xff, 0xe2, 0xfe, 0xee, 0x10, 0x78, 0x11, 0xd3, 0x04, 0x6e, 0xbe, 0x4d,
-  0x7d, 0x15, 0x9b, 0x0b, 0x5d, 0x2c, 0x41, 0x29, 0xdb, 0xa3, 0x91, 0x73,
-  0x5c, 0xe0, 0x76, 0xd5, 0x6d, 0xb8, 0xa1, 0x15, 0xd3, 0x41, 0xe6, 0x17,
-  0xf8, 0xb1, 0x16, 0xf4, 0xcb, 0x1c, 0xe5, 0x62, 0xce, 0xbc, 0xbc, 0x1b,
-  0x08, 0xfc, 0xb9, 0x4c, 0x12, 0xb8, 0x5a, 0x12, 0x31, 0xd7, 0x17, 0x12,
-  0xa1, 0x74, 0x1d, 0xde, 0x24, 0xc9, 0xbb, 0xed, 0x17, 0x04, 0x6e, 0x0e,
-  0xc9, 0xf6, 0x8a, 0x43, 0x55, 0xd7, 0xb3, 0xd3, 0xd2, 0xce, 0x2b, 0xf0,
-  0x66, 0xdd, 0xcb, 0xcd, 0xad, 0x54, 0xf2, 0x38, 0x92, 0xf4, 0xb0, 0x38,
-  0xce, 0x95, 0x97, 0x4f, 0x00, 0x02, 0x7f, 0x2e, 0x93, 0x04, 0x6e, 0xa2,
-  0xee, 0x97, 0x5d, 0x25, 0xf2, 0x3f, 0x91, 0x8f, 0x27, 0xd2, 0x13, 0xd8,
-  0x70, 0x41, 0xe0, 0x1b, 0x28, 0x89, 0xb4, 0xf3, 0x0a, 0xfc, 0x48, 0x6e,
-  0x24, 0xc5, 0x87, 0xf4, 0xe4, 0x67, 0x06, 0x02, 0x7f, 0x2e, 0xd3, 0xba,
-  0xd0, 0x55, 0x14, 0x75, 0x4d, 0x4d, 0xb3, 0xed, 0x7e, 0xe1, 0xed, 0x78,
-  0x22, 0x72, 0x46, 0x2a, 0x95, 0x50, 0xcd, 0xff, 0x9c, 0xc0, 0xee, 0x80,
-  0xfe, 0x14, 0x10, 0xf8, 0x73, 0x99, 0x38, 0x89, 0x55, 0xaa, 0x0b, 0x26,
-  0xf5, 0x65, 0x7f, 0xc6, 0x2a, 0xc0, 0x3d, 0x02, 0x9f, 0xb3, 0xac, 0x77,
-  0x25, 0x23, 0x24, 0x70, 0x7d, 0xca, 0x7e, 0xc9, 0x35, 0x9c, 0xfa, 0x9c,
-  0xfd, 0x84, 0xae, 0x7f, 0x34, 0xbf, 0x99, 0x1f, 0x5d, 0xf5, 0x9b, 0x9d,
-  0xdc, 0x65, 0xac, 0x9b, 0x04, 0x6e, 0xfc, 0xa4, 0x7a, 0x07, 0xa4, 0x33,
-  0x7d, 0xca, 0x7e, 0x07, 0x03, 0x81, 0xfa, 0x94, 0xb9, 0xb2, 0xa8, 0x7e,
-  0xb2, 0xdf, 0xc6, 0xfb, 0xe0, 0x73, 0x3e, 0xd1, 0x8c, 0xb9, 0xec, 0xff,
-  0x0c, 0x36, 0x06, 0xa8, 0x46, 0x0e, 0x7f, 0x10, 0x2e, 0xcb, 0x06, 0x17,
-  0xbe, 0xe8, 0xe1, 0x99, 0xdf, 0xaf, 0x17, 0x5d, 0x38, 0xfa, 0xf3, 0xb0,
-  0x64, 0xff, 0xd2, 0x8c, 0xfc, 0xa7, 0x31, 0xcf, 0x65, 0xa4, 0xe6, 0xf2,
-  0x45, 0x9f, 0x9e, 0xc0, 0xb6, 0x9a, 0x5f, 0x10, 0x38, 0x31, 0xbb, 0x24,
-  0xb2, 0x6d, 0xff, 0xe9, 0x2e, 0x33, 0x89, 0x65, 0xd9, 0x0b, 0xa0, 0xd8,
-  0x19, 0x81, 0x1b, 0x35, 0x87, 0x94, 0xe9, 0x20, 0xf5, 0x5e, 0xcf, 0xaf,
-  0xf5, 0x6a, 0x67, 0xb9, 0xd1, 0x3b, 0xee, 0x6b, 0x7f, 0x83, 0x5c, 0x5d,
-  0x92, 0xba, 0x88, 0x57, 0xb4, 0x69, 0xb7, 0x59, 0x94, 0x53, 0x70, 0x7a,
-  0xfa, 0x6e, 0x4d, 0xeb, 0x26, 0x19, 0x27, 0xc8, 0x7e, 0xc9, 0x77, 0x4c,
-  0xa2, 0xd5, 0xdf, 0x17, 0xed, 0xb7, 0x3c, 0x20, 0x79, 0xf6, 0xa9, 0x6a,
-  0x99, 0x70, 0x5c, 0xb5, 0xb5, 0xbc, 0xb4, 0x16, 0xf7, 0xa6, 0xae, 0x9b,
-  0x6c, 0xe9, 0x1f, 0x81, 0x2a, 0xaf, 0x6c, 0x90, 0x74, 0xe4, 0x86, 0x30,
-  0xa9, 0xfd, 0x29, 0x0a, 0x7d, 0x54, 0xa6, 0xd4, 0x6c, 0x91, 0xda, 0x63,
-  0x92, 0x1f, 0x1a, 0x39, 0xf3, 0xe6, 0x3a, 0x46, 0x32, 0x8d, 0x46, 0x15,
-  0xdd, 0xba, 0x21, 0xbf, 0x5f, 0xe1, 0xff, 0x06, 0xc5, 0x7a, 0x18, 0x7d,
-  0xd2, 0xaa, 0x40, 0xf6, 0x40, 0x4c, 0xa0, 0x6b, 0xeb, 0x76, 0xc0, 0xa3,
-  0xcc, 0x23, 0xf0, 0x51, 0x5c, 0x1f, 0x03, 0x4f, 0x10, 0x78, 0xa9, 0x4d,
-  0x14, 0x71, 0xe3, 0x07, 0x50, 0xa4, 0x3a, 0xa6, 0xe5, 0x9a, 0xe8, 0xf3,
-  0x5f, 0x9b, 0x16, 0x9b, 0x00, 0xb1, 0x97, 0xb5, 0x9c, 0x88, 0x56, 0xfa,
-  0x1b, 0x96, 0x95, 0x27, 0xf0, 0x6e, 0x54, 0xe0, 0x95, 0x49, 0x2a, 0x26,
-  0x1a, 0xf9, 0xf1, 0x92, 0x19, 0x3e, 0x5d, 0xc7, 0x65, 0x5e, 0x73, 0x95,
-  0x63, 0x29, 0xf0, 0x41, 0xe7, 0x30, 0xae, 0xed, 0x07, 0x9a, 0xd1, 0x66,
-  0x6d, 0x63, 0xd0, 0x47, 0xd0, 0x7d, 0xdc, 0x9a, 0xc2, 0x20, 0xb3, 0x86,
-  0x3b, 0x6b, 0xad, 0x2a, 0x97, 0xce, 0x1f, 0x77, 0x81, 0x40, 0xeb, 0x33,
-  0x22, 0x70, 0xb9, 0xf7, 0x7f, 0x1d, 0xf9, 0xa5, 0x49, 0x79, 0x59, 0xd9,
-  0x03, 0xeb, 0xfd, 0x06, 0xfb, 0x60, 0xf4, 0xb6, 0x28, 0xd5, 0x81, 0xfc,
-  0x78, 0x25, 0x0b, 0x9e, 0xc0, 0x1c, 0x02, 0xd7, 0xb2, 0x7d, 0x5c, 0x5d,
-  0x48, 0x44, 0x4c, 0x13, 0xd8, 0x71, 0xf0, 0x03, 0x28, 0x0a, 0xcf, 0xba,
-  0xae, 0x8e, 0xc9, 0x5c, 0x49, 0x29, 0xa2, 0x45, 0x2f, 0xf1, 0xb6, 0x89,
-  0x5d, 0x40, 0x79, 0xb1, 0xa7, 0x50, 0x1f, 0x65, 0x2b, 0xb6, 0xf4, 0xa2,
-  0x4a, 0x47, 0x05, 0x76, 0x10, 0x8d, 0xc8, 0xd6, 0xda, 0x4b, 0x46, 0x57,
-  0x7a, 0x61, 0x9d, 0x2d, 0xf4, 0x85, 0x6e, 0xfb, 0xfd, 0xf0, 0xf8, 0xec,
-  0x82, 0x17, 0x4d, 0x39, 0x4c, 0xda, 0x9d, 0x96, 0x72, 0x97, 0x13, 0x93,
-  0x4d, 0xaf, 0x44, 0xd2, 0x76, 0x5c, 0xe0, 0xd4, 0x1e, 0xd8, 0xe0, 0x28,
-  0xcc, 0xc4, 0x86, 0xbf, 0xe9, 0xd8, 0x8e, 0x47, 0xef, 0xef, 0x27, 0xcf,
-  0xeb, 0xae, 0x64, 0xc1, 0x13, 0x98, 0x2e, 0xb0, 0xfe, 0x29, 0xb7, 0xd7,
-  0xae, 0x03, 0x4f, 0x12, 0x78, 0x71, 0x2c, 0x57, 0xc2, 0x1b, 0x67, 0xe7,
-  0xa9, 0x6c, 0x76, 0x16, 0x69, 0x9a, 0xd6, 0x36, 0x13, 0xbb, 0x32, 0xd5,
-  0xfe, 0xb4, 0xed, 0x46, 0x57, 0xb6, 0xaa, 0xab, 0x3f, 0x1b, 0x17, 0xb3,
-  0xac, 0x55, 0xab, 0xb2, 0x2e, 0x8f, 0x0b, 0x99, 0x80, 0x34, 0x2d, 0x2a,
-  0xb5, 0x05, 0x69, 0x5b, 0xa6, 0x2a, 0x0e, 0x12, 0x71, 0x48, 0xe0, 0xa4,
-  0x28, 0xb6, 0x36, 0x2d, 0x7d, 0x5c, 0xa9, 0xcc, 0x6c, 0x92, 0xa6, 0xa9,
-  0x6e, 0x14, 0xa3, 0x63, 0x79, 0x94, 0xd5, 0x77, 0xd7, 0x7a, 0x1e, 0x54,
-  0x5a, 0xe0, 0x28, 0x2f, 0x56, 0xea, 0xc3, 0xb1, 0xe8, 0x1d, 0x9f, 0x39,
-  0xa6, 0x43, 0x99, 0xcb, 0x6f, 0x36, 0x2e, 0x86, 0x55, 0x5e, 0x44, 0xc2,
-  0x1b, 0x6c, 0xcb, 0x21, 0x8c, 0x68, 0xcc, 0xc4, 0xc0, 0x56, 0xcf, 0x4a,
-  0x88, 0xad, 0xce, 0xa4, 0x6c, 0xd9, 0x47, 0x04, 0x56, 0xe5, 0xdb, 0xfb,
-  0xb1, 0xc4, 0xb6, 0x24, 0x87, 0xa7, 0xc3, 0xe8, 0xcc, 0xee, 0xda, 0xf1,
-  0xe8, 0x45, 0x94, 0x96, 0xf2, 0xc3, 0x3a, 0x50, 0xb2, 0xe0, 0x09, 0x4c,
-  0x17, 0x58, 0xd6, 0xd4, 0x78, 0xbc, 0xff, 0x6c, 0xbb, 0x60, 0x59, 0x47,
-  0x17, 0xee, 0x7e, 0x81, 0xa3, 0x4a, 0x37, 0x94, 0xf4, 0x3c, 0x3e, 0x98,
-  0xc4, 0x92, 0x6d, 0x43, 0xa4, 0x77, 0xac, 0xec, 0xb7, 0xf2, 0x3b, 0x97,
-  0x3f, 0x32, 0xd1, 0x24, 0xbb, 0x75, 0x47, 0xaf, 0x0d, 0x89, 0x7b, 0xb9,
-  0x19, 0x13, 0x58, 0xb6, 0x30, 0xb2, 0x75, 0xa7, 0x8d, 0xa6, 0x8b, 0xbb,
-  0xb1, 0x27, 0xad, 0x4a, 0x2b, 0x6b, 0x05, 0x3e, 0x74, 0x7e, 0x2b, 0x81,
-  0x0b, 0xd3, 0x4a, 0xe5, 0x81, 0xe3, 0x5b, 0x9a, 0x43, 0x6a, 0xec, 0x10,
-  0x57, 0xf9, 0xdb, 0x0c, 0x67, 0xdd, 0xb7, 0x9e, 0x9c, 0x79, 0xdb, 0x1e,
-  0x6c, 0x80, 0xc4, 0x48, 0x37, 0x2a, 0x70, 0xe4, 0x5d, 0x1b, 0x10, 0xf6,
-  0x84, 0xb3, 0x30, 0x19, 0x50, 0xfe, 0x36, 0x3a, 0xb3, 0x89, 0xf9, 0xd1,
-  0x03, 0xd1, 0x77, 0x3f, 0x54, 0x69, 0x4a, 0x2a, 0x50, 0xb2, 0x60, 0x6e,
-  0xa6, 0x0b, 0xac, 0xbb, 0x4e, 0xfd, 0x09, 0x18, 0x2f, 0x11, 0x87, 0xeb,
-  0xb9, 0xb5, 0x77, 0x08, 0x5c, 0xb4, 0xa4, 0x5e, 0x18, 0x06, 0x02, 0xaf,
-  0xe8, 0x8e, 0x2e, 0xee, 0xd2, 0x3f, 0xff, 0xcb, 0x2f, 0xe2, 0x93, 0xfd,
-  0x7b, 0x6d, 0x52, 0xd2, 0x43, 0xc2, 0xdb, 0x04, 0x96, 0x3b, 0x1c, 0x44,
-  0xa8, 0xd1, 0x94, 0x49, 0xe5, 0xae, 0x5d, 0x5b, 0x99, 0x8d, 0xc2, 0xed,
-  0xa9, 0x32, 0xb5, 0xa2, 0x1f, 0x9a, 0xde, 0xf1, 0x29, 0xf1, 0x65, 0xbf,
-  0x66, 0xe7, 0xc5, 0xd0, 0xb4, 0x43, 0x81, 0xad, 0x2b, 0x89, 0x0e, 0xb1,
-  0xb4, 0x67, 0xad, 0xdc, 0x9c, 0x18, 0xc6, 0x04, 0x5e, 0xf8, 0x7d, 0x27,
-  0x97, 0xac, 0x3d, 0x3c, 0x73, 0xb2, 0x71, 0x45, 0x1e, 0x8f, 0x44, 0x7f,
-  0xa0, 0x07, 0x12, 0x28, 0x59, 0x30, 0x37, 0xd3, 0x05, 0x3e, 0xa6, 0xe9,
-  0xca, 0xb6, 0x7f, 0x23, 0x89, 0x4c, 0x15, 0xb8, 0xbc, 0x49, 0xe0, 0x84,
-  0xee, 0x98, 0xd8, 0x2a, 0x26, 0xbb, 0x7b, 0xee, 0x22, 0xb5, 0x12, 0x43,
-  0x2c, 0xf7, 0xbf, 0x24, 0x73, 0x2e, 0x92, 0xe2, 0x0e, 0x81, 0x69, 0x0e,
-  0x5c, 0x68, 0x79, 0x40, 0x07, 0x97, 0x68, 0x6a, 0x6a, 0xb6, 0x6b, 0xdb,
-  0xc8, 0xae, 0xe5, 0x30, 0x01, 0x5d, 0xae, 0x2e, 0xf2, 0xdc, 0x33, 0xc9,
-  0xcf, 0x96, 0xc2, 0x1e, 0x63, 0xac, 0xfe, 0xa7, 0x67, 0x03, 0xf3, 0x71,
-  0x4c, 0xe0, 0x5e, 0xe7, 0xa9, 0x57, 0x1e, 0x09, 0x3d, 0x62, 0x93, 0x59,
-  0xf2, 0x5b, 0x54, 0x5e, 0xf4, 0xde, 0x8f, 0x19, 0x28, 0x59, 0x30, 0x37,
-  0xf3, 0xcc, 0x42, 0xcb, 0x1a, 0x16, 0x8f, 0xde, 0x44, 0xf7, 0x36, 0x81,
-  0xfd, 0x74, 0x35, 0x5b, 0xb3, 0x6d, 0xf9, 0x63, 0xdb, 0x0b, 0x47, 0x7a,
-  0xaf, 0xc0, 0xb4, 0x6b, 0xe8, 0x0e, 0xc8, 0x55, 0xe7, 0x9e, 0x07, 0x55,
-  0x2f, 0xf3, 0xa3, 0x02, 0x13, 0x47, 0x65, 0x98, 0xf5, 0x25, 0x81, 0x65,
-  0x33, 0x1f, 0x6b, 0x9d, 0x72, 0xbf, 0xb0, 0x4c, 0xb2, 0x63, 0x02, 0x87,
-  0x7e, 0x2c, 0xf9, 0xa9, 0x30, 0x87, 0x77, 0x49, 0x60, 0x3f, 0x7a, 0xfa,
-  0x63, 0x86, 0x4a, 0x16, 0xcc, 0xcd, 0x4c, 0xb7, 0x13, 0xba, 0xf6, 0x2e,
-  0x98, 0x48, 0xc7, 0xb1, 0xec, 0xe8, 0xea, 0xef, 0x4b, 0x04, 0x5e, 0xf4,
-  0xaa, 0x0f, 0xd9, 0xf1, 0x60, 0x37, 0x6e, 0x9a, 0xde, 0x74, 0xf0, 0x03,
-  0x02, 0x87, 0xd7, 0x86, 0xf6, 0x05, 0x5e, 0xf4, 0x0e, 0xf2, 0x46, 0x81,
-  0x77, 0xad, 0x97, 0xce, 0xb8, 0xc0, 0x72, 0x43, 0xad, 0x9a, 0xed, 0x3a,
-  0x60, 0x58, 0x39, 0x2a, 0x70, 0x7f, 0xfd, 0x8d, 0xdb, 0xd3, 0x4f, 0x96,
-  0x0a, 0x9c, 0x8f, 0x45, 0x4f, 0x7f, 0xcc, 0x50, 0xc9, 0x82, 0xb9, 0x99,
-  0x49, 0xe0, 0xed, 0xc5, 0x5f, 0xc8, 0x55, 0x79, 0xc9, 0x9b, 0x5b, 0xe0,
-  0xb6, 0xad, 0x76, 0x66, 0xf3, 0xa1, 0x7f, 0x8d, 0x64, 0x2e, 0x81, 0x49,
-  0x81, 0xf8, 0x2d, 0x70, 0x3f, 0xf3, 0x37, 0xb7, 0xc0, 0xd1, 0x45, 0x81,
-  0x75, 0xd3, 0xbb, 0xd5, 0x03, 0xea, 0x8a, 0x44, 0xf6, 0xb0, 0xc0, 0x56,
-  0xd3, 0x81, 0xc0, 0xa3, 0xe7, 0x87, 0x61, 0x17, 0x1a, 0x02, 0x3f, 0x97,
-  0xa9, 0x4b, 0x29, 0xf5, 0xff, 0xee, 0xd7, 0x0b, 0x2d, 0xf1, 0x7b, 0x87,
-  0xc0, 0xd2, 0xd1, 0xd1, 0x61, 0x79, 0x53, 0x68, 0x87, 0xf5, 0xb4, 0xb5,
-  0xdf, 0xfb, 0xbf, 0x55, 0xe0, 0x5c, 0x88, 0x40, 0x3b, 0x98, 0xda, 0x4f,
-  0x5b, 0x3f, 0x8a, 0xfb, 0x04, 0x26, 0x87, 0x77, 0x7d, 0x0c, 0xac, 0x7a,
-  0x1c, 0x07, 0x39, 0x04, 0x3e, 0xf6, 0x22, 0x93, 0x1f, 0x9b, 0x07, 0x04,
-  0x1e, 0x1f, 0x03, 0x93, 0x21, 0x76, 0xe5, 0x45, 0xef, 0xfd, 0x98, 0x81,
-  0x92, 0x05, 0x73, 0x33, 0x4d, 0xe0, 0x5c, 0xec, 0xe5, 0x7c, 0xa5, 0x5a,
-  0x0b, 0x91, 0xb7, 0x6d, 0x1e, 0x87, 0xae, 0x28, 0xbd, 0x43, 0x60, 0xd2,
-  0x03, 0x0d, 0xa3, 0xe2, 0xab, 0xdd, 0x34, 0x77, 0x2f, 0xbf, 0xfd, 0x88,
-  0x03, 0x02, 0xef, 0xfa, 0x69, 0xf4, 0x66, 0xa1, 0xd5, 0x45, 0x21, 0x7b,
-  0x39, 0xe8, 0x3e, 0x81, 0xa5, 0x19, 0x71, 0xe3, 0xa5, 0x73, 0x41, 0xe0,
-  0x2e, 0xcc, 0xba, 0xb6, 0xca, 0x2c, 0xec, 0x51, 0xd9, 0xf9, 0xf0, 0xbb,
-  0x05, 0xde, 0x7a, 0xc9, 0x52, 0x81, 0xfb, 0x27, 0xb1, 0x45, 0x1b, 0x12,
-  0x38, 0x50, 0xb2, 0x60, 0x6e, 0x26, 0x09, 0xdc, 0xfd, 0x78, 0xcb, 0xef,
-  0xdf, 0x93, 0x5a, 0x56, 0xb7, 0x30, 0xd7, 0xf7, 0x07, 0x27, 0xdd, 0xe7,
-  0x08, 0x4c, 0x6a, 0x78, 0x40, 0x60, 0x15, 0x5c, 0x4d, 0x19, 0x95, 0xde,
-  0x3a, 0xbe, 0xea, 0x47, 0xfe, 0xd7, 0xe8, 0xbc, 0xca, 0x5d, 0xf5, 0x7a,
-  0xaa, 0x13, 0x59, 0xfb, 0x5b, 0xdb, 0x43, 0x94, 0xdf, 0xba, 0x09, 0x1f,
-  0x61, 0x84, 0xac, 0xdc, 0xc5, 0x94, 0xfe, 0x91, 0xe9, 0x92, 0x28, 0xc9,
-  0x89, 0xe2, 0x5e, 0x81, 0x55, 0x03, 0xe6, 0xd2, 0x29, 0x2e, 0x0b, 0x2c,
-  0xcf, 0xa1, 0xb9, 0x5d, 0x11, 0x27, 0x9d, 0xff, 0x6a, 0xcd, 0x82, 0x96,
-  0x03, 0xf1, 0x49, 0xad, 0x11, 0xbb, 0x2c, 0x70, 0x6e, 0xdb, 0xd6, 0x3c,
-  0x28, 0xf0, 0x76, 0x24, 0x7a, 0xef, 0xc7, 0x0c, 0x94, 0x2c, 0x98, 0x9b,
-  0x49, 0x02, 0xab, 0xcb, 0x47, 0x06, 0xb3, 0x18, 0x61, 0x78, 0xd2, 0xbd,
-  0x28, 0x70, 0xdc, 0xdd, 0x09, 0x23, 0x43, 0x7c, 0x11, 0x17, 0x6e, 0x10,
-  0x58, 0xed, 0xb4, 0xc9, 0xbe, 0xd2, 0x90, 0xc0, 0x7a, 0x81, 0xc9, 0xe9,
-  0x5c, 0xfd, 0x7e, 0xd1, 0x35, 0xd4, 0x9d, 0x0e, 0xcb, 0xec, 0x5c, 0x9f,
-  0xe5, 0x8d, 0x0f, 0x51, 0xdb, 0x36, 0xb2, 0xb1, 0x5a, 0xff, 0x56, 0xe7,
-  0xd3, 0x52, 0xaf, 0xd8, 0x92, 0xc7, 0xb5, 0xce, 0xf6, 0x3b, 0x93, 0xea,
-  0xcf, 0xaf, 0x5e, 0xfa, 0x6b, 0x93, 0x15, 0xdf, 0xe7, 0x93, 0xbc, 0xce,
-  0x19, 0xd1, 0x9a, 0x49, 0x16, 0x89, 0xc8, 0x99, 0xb2, 0xf8, 0xe7, 0xac,
-  0x6e, 0xc3, 0x70, 0x2b, 0xb1, 0x74, 0xc8, 0x1b, 0x04, 0xce, 0x4d, 0x3a,
-  0x32, 0x86, 0x55, 0x7b, 0x59, 0x60, 0xe9, 0xfb, 0xd2, 0x2e, 0x2c, 0xa9,
-  0xa5, 0xfe, 0x5f, 0xbf, 0xbf, 0x5f, 0xf6, 0xfc, 0x21, 0x0b, 0x64, 0x7d,
-  0xfe, 0x51, 0x6b, 0xb4, 0x2f, 0x0b, 0x6c, 0x93, 0x95, 0x87, 0x37, 0x14,
-  0x58, 0x9d, 0x9f, 0xbc, 0xe8, 0x87, 0x02, 0x07, 0x4a, 0x16, 0xcc, 0xcd,
-  0xb4, 0x1b, 0xfa, 0xe9, 0x4c, 0x51, 0xee, 0xad, 0x3a, 0xf2, 0x13, 0x19,
-  0x11, 0x58, 0xf9, 0xde, 0x7d, 0x5c, 0x39, 0x3f, 0x14, 0xb7, 0x08, 0x6c,
-  0x52, 0xff, 0x4f, 0xcf, 0x80, 0xc0, 0xaa, 0x0a, 0x6b, 0x5c, 0xf5, 0xa9,
-  0xe8, 0x1a, 0x65, 0x99, 0x69, 0x7a, 0x73, 0x03, 0x19, 0xc0, 0xaa, 0x23,
-  0x69, 0x68, 0x2c, 0xa1, 0xb5, 0xd0, 0xde, 0xd4, 0x0c, 0x11, 0xd8, 0xdb,
-  0x31, 0xb2, 0x6b, 0xa1, 0xef, 0x10, 0xd8, 0x3f, 0x3f, 0x56, 0xed, 0x15,
-  0x81, 0xb7, 0x34, 0x60, 0x68, 0xb1, 0xf2, 0xd1, 0xcb, 0xf7, 0x15, 0x81,
-  0x69, 0x01, 0x05, 0x04, 0x1e, 0x5b, 0x0b, 0xed, 0x77, 0xa7, 0x86, 0x25,
-  0x0b, 0xe6, 0x66, 0xe2, 0x24, 0x56, 0x6e, 0x2a, 0x99, 0x7e, 0xfe, 0xcd,
-  0x36, 0x38, 0xf0, 0xb4, 0x15, 0x40, 0xe1, 0xaa, 0xb9, 0xda, 0x7b, 0x6d,
-  0x55, 0x76, 0x6d, 0xf7, 0x2d, 0x02, 0xd7, 0xae, 0x6e, 0x04, 0x04, 0x6e,
-  0x4b, 0x72, 0x25, 0x69, 0x67, 0xdb, 0x49, 0xef, 0xa4, 0xa3, 0xb2, 0x7a,
-  0x74, 0xae, 0x45, 0x6a, 0x1d, 0xa4, 0xd9, 0xb0, 0x71, 0x35, 0x75, 0x75,
-  0x10, 0x21, 0x81, 0xfd, 0xa7, 0x18, 0x10, 0x81, 0x69, 0xf2, 0x51, 0xe5,
-  0x8a, 0x41, 0x87, 0xbc, 0x45, 0xe0, 0xca, 0x65, 0x35, 0x2a, 0xfc, 0x18,
-  0x02, 0xea, 0x69, 0x5b, 0xcc, 0xaa, 0xe6, 0xc6, 0x5d, 0x2c, 0x33, 0xa7,
-  0x14, 0x93, 0xa1, 0x3c, 0xba, 0x2a, 0xb0, 0x29, 0x80, 0x9d, 0xff, 0xfb,
-  0xb9, 0xcc, 0x0e, 0xa3, 0x0f, 0x08, 0x3c, 0x2c, 0x59, 0x30, 0x37, 0x93,
-  0x2f, 0x23, 0xd5, 0x65, 0x9a, 0x1e, 0x4b, 0xeb, 0x47, 0x91, 0x06, 0x56,
-  0xcc, 0x8d, 0x0a, 0xac, 0xab, 0x68, 0xb7, 0xb8, 0x57, 0xfe, 0xd4, 0xbd,
-  0x9b, 0x8d, 0xae, 0x08, 0x6c, 0x1c, 0x59, 0xe4, 0x41, 0x81, 0x5d, 0x25,
-  0x4b, 0xbc, 0x3e, 0x41, 0x6e, 0x2a, 0xf2, 0xc2, 0x74, 0xd9, 0x6b, 0x63,
-  0xca, 0xa1, 0xf1, 0x36, 0x74, 0x95, 0x4e, 0x47, 0xb2, 0x6b, 0x0a, 0x4f,
-  0xe0, 0x22, 0xd1, 0x9b, 0xbd, 0x0c, 0x51, 0x81, 0x6d, 0xf2, 0xd1, 0x8e,
-  0xdc, 0x0f, 0x7c, 0x8f, 0xc0, 0x4e, 0x80, 0x5d, 0xd5, 0x8b, 0x21, 0xa0,
-  0x9e, 0x5e, 0x37, 0xe1, 0x8a, 0xd0, 0x9c, 0x41, 0x12, 0x73, 0x5a, 0xac,
-  0xe4, 0xf9, 0x32, 0x2a, 0xf5, 0xad, 0xbb, 0x97, 0x04, 0x56, 0x05, 0x60,
-  0xa4, 0x0b, 0x08, 0x3c, 0x8c, 0x3e, 0x24, 0xb0, 0x2b, 0xd9, 0x14, 0x63,
-  0xe0, 0xe7, 0x30, 0xd3, 0x75, 0xe0, 0x87, 0x29, 0x8f, 0xe9, 0x51, 0xd6,
-  0xce, 0xba, 0x48, 0xd3, 0xe2, 0xee, 0x5f, 0xb9, 0xcc, 0xd3, 0xe3, 0xa5,
-  0x35, 0xb6, 0x75, 0x99, 0xe6, 0xc3, 0xef, 0xbb, 0x93, 0x4e, 0x5a, 0x78,
-  0x73, 0x6d, 0x65, 0x91, 0x16, 0x95, 0xff, 0xb7, 0x39, 0x15, 0x55, 0xbd,
-  0x93, 0x92, 0xae, 0xce, 0x55, 0xde, 0x8b, 0x22, 0x40, 0x55, 0xa4, 0x79,
-  0x39, 0xa9, 0xea, 0xd6, 0x25, 0x3d, 0x3d, 0x5e, 0x46, 0x2f, 0xe6, 0x70,
-  0x34, 0xe5, 0x31, 0xa5, 0x13, 0x78, 0x4d, 0x79, 0xcc, 0xaf, 0x5e, 0xd6,
-  0xd1, 0xfa, 0x55, 0x79, 0x7a, 0x2d, 0x5d, 0x19, 0xfd, 0xd5, 0xf8, 0xca,
-  0xfc, 0x86, 0x40, 0xe0, 0x51, 0xde, 0x2d, 0x30, 0x43, 0x7a, 0xfd, 0x89,
-  0x8f, 0x41, 0x8e, 0xee, 0xa7, 0x3f, 0x17, 0x2c, 0xd0, 0x11, 0x00, 0x9f,
-  0x0b, 0x7e, 0xaa, 0xbb, 0xf9, 0x50, 0x81, 0xd5, 0xac, 0xf1, 0xf4, 0x7c,
-  0x41, 0x60, 0x56, 0xe0, 0xa7, 0xba, 0x9b, 0x4f, 0x14, 0x38, 0xff, 0x5a,
-  0x92, 0x49, 0xa7, 0x49, 0x40, 0x60, 0x56, 0xe0, 0xa7, 0xba, 0x9b, 0x4f,
-  0x14, 0xd8, 0x3c, 0x91, 0x64, 0x86, 0xa8, 0x20, 0x30, 0x2b, 0xf0, 0x53,
-  0xdd, 0xcd, 0x27, 0x0a, 0x9c, 0x7b, 0xb3, 0xea, 0x93, 0x80, 0xc0, 0xac,
-  0xc0, 0x4f, 0x75, 0x37, 0xdd, 0xbb, 0x28, 0x92, 0x0f, 0x9b, 0x57, 0x2d,
-  0xc5, 0x6a, 0x3b, 0xd3, 0xdb, 0x5c, 0xba, 0xc3, 0x1b, 0x7f, 0x46, 0x3f,
-  0xf8, 0x30, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03,
-  0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0,
-  0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20,
-  0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18,
-  0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30,
-  0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00,
-  0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c,
-  0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03,
-  0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0,
-  0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20,
-  0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18,
-  0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30,
-  0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00,
-  0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c,
-  0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00,
-  0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30,
-  0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08,
-  0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06,
-  0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c,
-  0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00,
-  0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03,
-  0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0,
-  0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20,
-  0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18,
-  0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30,
-  0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00,
-  0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c,
-  0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02,
-  0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63, 0x20, 0x30, 0x00, 0x8c, 0x81,
-  0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0, 0x18, 0x08, 0x0c, 0x00, 0x63,
-  0x20, 0x30, 0x00, 0x8c, 0x81, 0xc0, 0x00, 0x30, 0x06, 0x02, 0x03, 0xc0,
-  0x98, 0xff, 0x03, 0x0d, 0xd5, 0x27, 0x71, 0xaa, 0xb8, 0x1f, 0x91, 0x00,
-  0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44, 0xae, 0x42, 0x60, 0x82
-};
-const uint32_t setup_png_len = 11783;
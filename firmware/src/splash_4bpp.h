@@ -0,0 +1,3049 @@
+// Auto-generated by scripts/bake-splash.sh from worker/renderer/splash.png.
+// Do not edit by hand — re-run the script if the splash changes.
+// Run-length-coded 4bpp framebuffer (scripts/pack_4bpp.py, src/rle4.h).
+#pragma once
+#include <stdint.h>
+
+const uint8_t splash_4bpp[] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x02, 0xcc,
+  0x8c, 0xb8, 0xee, 0xff, 0x02, 0xce, 0xac, 0x98, 0xff, 0xff, 0x90, 0xff,
+  0x02, 0xce, 0x9c, 0x98, 0xff, 0xff, 0xd2, 0xff, 0x02, 0x8d, 0x48, 0x34,
+  0x82, 0x00, 0x00, 0x70, 0xea, 0xff, 0x02, 0x8f, 0x68, 0x44, 0x82, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x8c, 0xff, 0x02, 0x8f, 0x58, 0x44, 0x82, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0xd2, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70,
+  0xea, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xff, 0xff, 0x8c, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xff, 0xff, 0xd2, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0xea, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0xff, 0xff, 0x8c, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0xd2, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0xea, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0xff, 0xff, 0x8c, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xba, 0xff, 0x06, 0xcd, 0x88, 0x46, 0x44, 0x87, 0xb8, 0xfe,
+  0xec, 0xff, 0x00, 0x8d, 0x84, 0x88, 0x00, 0x98, 0x85, 0xff, 0x00, 0x8f,
+  0x85, 0x88, 0x00, 0xf9, 0x85, 0xff, 0x00, 0x8b, 0x84, 0x88, 0x03, 0xf8,
+  0xff, 0xff, 0x0b, 0x84, 0x00, 0x00, 0x70, 0xb4, 0xff, 0x00, 0x8b, 0x84,
+  0x88, 0xaf, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00,
+  0x89, 0x84, 0x88, 0x00, 0xd8, 0x85, 0xff, 0x00, 0x8b, 0x85, 0x88, 0x00,
+  0xfd, 0x84, 0xff, 0x00, 0xef, 0x85, 0x88, 0x00, 0xfc, 0xbc, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0xb8, 0xff, 0x01, 0xcf, 0x39, 0x85, 0x00,
+  0x01, 0x50, 0xd9, 0xeb, 0xff, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x10, 0x85,
+  0xff, 0x00, 0x0c, 0x85, 0x00, 0x00, 0xf0, 0x85, 0xff, 0x00, 0x05, 0x84,
+  0x00, 0x03, 0xf2, 0xff, 0xff, 0x0b, 0x84, 0x00, 0x00, 0x70, 0xb4, 0xff,
+  0x00, 0x07, 0x83, 0x00, 0x00, 0x30, 0xaf, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xad, 0xff, 0x00, 0x04, 0x84, 0x00, 0x00, 0x80, 0x85, 0xff,
+  0x00, 0x04, 0x85, 0x00, 0x00, 0xfa, 0x84, 0xff, 0x00, 0xbf, 0x85, 0x00,
+  0x00, 0xfb, 0xbc, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xb7, 0xff,
+  0x01, 0xaf, 0x02, 0x88, 0x00, 0x00, 0xe6, 0xea, 0xff, 0x00, 0x0f, 0x85,
+  0x00, 0x85, 0xff, 0x00, 0x0a, 0x85, 0x00, 0x00, 0xe0, 0x85, 0xff, 0x00,
+  0x03, 0x84, 0x00, 0x03, 0xf4, 0xff, 0xff, 0x0b, 0x84, 0x00, 0x00, 0x70,
+  0xb4, 0xff, 0x00, 0x09, 0x83, 0x00, 0x00, 0x30, 0xaf, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00, 0x70,
+  0x85, 0xff, 0x00, 0x03, 0x85, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x00, 0x9f,
+  0x85, 0x00, 0x00, 0xfe, 0xbc, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0xb6, 0xff, 0x01, 0xcf, 0x04, 0x89, 0x00, 0x01, 0x10, 0xf9, 0xe9, 0xff,
+  0x00, 0x2f, 0x85, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x00, 0x07, 0x85, 0x00,
+  0x00, 0xb0, 0x85, 0xff, 0x00, 0x01, 0x84, 0x00, 0x03, 0xf7, 0xff, 0xff,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0xa7, 0xff, 0x05, 0xef, 0xcc, 0x88, 0x45,
+  0x02, 0xf7, 0x86, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x30, 0xa2, 0xff,
+  0x04, 0xcf, 0xac, 0x78, 0x44, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xad, 0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0x40, 0x85, 0xff,
+  0x86, 0x00, 0x00, 0xf4, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0xb0, 0xff,
+  0x04, 0xcf, 0xac, 0x78, 0x44, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xb5, 0xff, 0x01, 0xef, 0x07, 0x8b, 0x00, 0x00, 0x60, 0xe9,
+  0xff, 0x00, 0x4f, 0x85, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x04, 0x85,
+  0x00, 0x00, 0x80, 0x85, 0xff, 0x85, 0x00, 0x03, 0xfa, 0xff, 0xff, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0xa6, 0xff, 0x00, 0x24, 0x84, 0x00, 0x00, 0xf7,
+  0x86, 0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x50, 0xa0, 0xff, 0x01, 0x9f,
+  0x04, 0x84, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xad,
+  0xff, 0x00, 0x0c, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0xcf, 0x86,
+  0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0x4f, 0x84, 0x00, 0x00, 0x30, 0xae,
+  0xff, 0x01, 0x9f, 0x04, 0x84, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xb5, 0xff, 0x00, 0x3e, 0x8d, 0x00, 0x00, 0xf6, 0xe8, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x00, 0xf8, 0x84, 0xff, 0x00, 0x03, 0x85, 0x00,
+  0x00, 0x60, 0x84, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x03, 0xfc, 0xff, 0xff,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x86,
+  0xff, 0x00, 0x0b, 0x83, 0x00, 0x00, 0x70, 0xa0, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x20, 0x84, 0xff, 0x00, 0xaf, 0x86, 0x00, 0x00,
+  0xf0, 0x84, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x60, 0xae, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xb4,
+  0xff, 0x01, 0xcf, 0x01, 0x8d, 0x00, 0x00, 0x60, 0xe8, 0xff, 0x00, 0xaf,
+  0x85, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x86, 0x00, 0x00, 0x30, 0x84, 0xff,
+  0x00, 0xaf, 0x85, 0x00, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70,
+  0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x00, 0x0e, 0x83, 0x00,
+  0x00, 0x70, 0xa0, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00, 0x2f, 0x85, 0x00, 0x84, 0xff,
+  0x00, 0x7f, 0x86, 0x00, 0x00, 0xd0, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x80, 0xae, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0xb4, 0xff, 0x00, 0x1c, 0x8f, 0x00, 0x00, 0xfd,
+  0xe7, 0xff, 0x00, 0xcf, 0x85, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0xcf,
+  0x86, 0x00, 0x00, 0x20, 0x84, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x00, 0x20,
+  0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0xa6, 0xff, 0x85, 0x00,
+  0x00, 0xf7, 0x86, 0xff, 0x00, 0x0f, 0x83, 0x00, 0x00, 0x80, 0xa0, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0xad, 0xff, 0x00, 0x4f, 0x85, 0x00, 0x00, 0xfd, 0x83, 0xff, 0x00, 0x4f,
+  0x86, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x00, 0x0e, 0x84, 0x00, 0x00, 0xb0,
+  0xae, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0xb3, 0xff, 0x01, 0xdf, 0x01, 0x8f, 0x00, 0x00, 0xf5, 0xe8,
+  0xff, 0x85, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0xaf, 0x87, 0x00, 0x84,
+  0xff, 0x00, 0x5f, 0x84, 0x00, 0x00, 0x40, 0x82, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x00,
+  0x0f, 0x83, 0x00, 0x00, 0xb0, 0xa0, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x00, 0xfb, 0x83, 0xff, 0x00, 0x3f, 0x86, 0x00, 0x00, 0x70, 0x84,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xe0, 0xae, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xb4, 0xff, 0x00,
+  0x07, 0x8f, 0x00, 0x00, 0xe1, 0xe8, 0xff, 0x00, 0x02, 0x84, 0x00, 0x00,
+  0xf2, 0x83, 0xff, 0x00, 0x7f, 0x87, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x00,
+  0x3f, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x00, 0x0f, 0x83,
+  0x00, 0x00, 0xb0, 0xa0, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0xad, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x00,
+  0xf9, 0x83, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0x50, 0x84, 0xff, 0x00,
+  0x09, 0x84, 0x00, 0x00, 0xf0, 0xae, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xb4, 0xff, 0x00, 0xbf, 0x84,
+  0x00, 0x03, 0x20, 0xb8, 0xcc, 0x7b, 0x86, 0x00, 0x00, 0x90, 0xe8, 0xff,
+  0x00, 0x04, 0x84, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0x4f, 0x87, 0x00,
+  0x00, 0xf9, 0x83, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x00, 0xa0, 0x82, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7,
+  0x86, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x00, 0xb0, 0xa0, 0xff, 0x00, 0x7f,
+  0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0xad, 0xff,
+  0x00, 0xcf, 0x85, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0x0c, 0x86, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00, 0xf3, 0xae, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0xb5, 0xff, 0x00, 0x2e, 0x82, 0x00, 0x01, 0x30, 0xfc, 0x82, 0xff, 0x00,
+  0x4e, 0x85, 0x00, 0x00, 0x70, 0xe8, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00,
+  0xd0, 0x83, 0xff, 0x00, 0x3f, 0x87, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0xc0, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0xa6, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x00, 0x3f, 0x83,
+  0x00, 0x00, 0xe0, 0xa0, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0xae, 0xff, 0x85, 0x00, 0x00, 0xf5, 0x83,
+  0xff, 0x00, 0x0a, 0x86, 0x00, 0x00, 0x10, 0x84, 0xff, 0x00, 0x04, 0x84,
+  0x00, 0x00, 0xf6, 0xae, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0xb6, 0xff, 0x03, 0x06, 0x00, 0x00, 0xf8,
+  0x83, 0xff, 0x01, 0xef, 0x01, 0x84, 0x00, 0x00, 0x50, 0xe8, 0xff, 0x00,
+  0x0a, 0x84, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00,
+  0xf4, 0x83, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x04, 0xbf, 0x78, 0x44, 0x54,
+  0xc8, 0x8c, 0xff, 0x01, 0xbc, 0x78, 0x82, 0x44, 0x01, 0x87, 0xcb, 0x8a,
+  0xff, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x00,
+  0xf0, 0x87, 0xff, 0x06, 0xef, 0x8b, 0x68, 0x44, 0x44, 0x88, 0xda, 0x91,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x82, 0xff, 0x05, 0xdf, 0x89, 0x45, 0x44, 0xa7, 0xfe, 0x8c, 0xff,
+  0x06, 0xcf, 0x8a, 0x44, 0x44, 0x85, 0xb8, 0xfe, 0x91, 0xff, 0x00, 0x02,
+  0x84, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x07, 0x87, 0x00, 0x00, 0xfe,
+  0x83, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf8, 0x88, 0xff, 0x05, 0xac,
+  0x47, 0x44, 0x54, 0x88, 0xfb, 0x8d, 0xff, 0x07, 0xdf, 0x9c, 0x58, 0x44,
+  0x44, 0x54, 0x98, 0xfc, 0x89, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x05, 0xdf, 0x89, 0x45,
+  0x44, 0xb7, 0xfe, 0x8c, 0xff, 0x05, 0xcf, 0x7a, 0x44, 0x44, 0x85, 0xb8,
+  0x93, 0xff, 0x09, 0xcf, 0x8a, 0x64, 0xa8, 0xfd, 0xff, 0xff, 0xaf, 0x00,
+  0xc0, 0x85, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00, 0x30, 0xe8, 0xff, 0x00,
+  0x0c, 0x84, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x0c, 0x87, 0x00, 0x00,
+  0xf3, 0x83, 0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x04, 0x70, 0xff, 0xff, 0x7d, 0x02, 0x83, 0x00, 0x01,
+  0x81, 0xfe, 0x87, 0xff, 0x02, 0xdf, 0x6a, 0x03, 0x86, 0x00, 0x01, 0x60,
+  0xfb, 0x85, 0xff, 0x82, 0x88, 0x85, 0x00, 0x00, 0x84, 0x83, 0x88, 0x03,
+  0xfd, 0xff, 0xff, 0x4f, 0x83, 0x00, 0x00, 0xf0, 0x86, 0xff, 0x01, 0x9d,
+  0x05, 0x85, 0x00, 0x01, 0x52, 0xfa, 0x8c, 0xff, 0x03, 0xbf, 0x88, 0x88,
+  0x48, 0x85, 0x00, 0x83, 0x88, 0x00, 0x98, 0x82, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x04, 0x30, 0xff, 0xff, 0x9f, 0x03, 0x83, 0x00, 0x01, 0x60, 0xfd,
+  0x8a, 0xff, 0x01, 0x7d, 0x02, 0x84, 0x00, 0x01, 0x40, 0xe8, 0x90, 0xff,
+  0x00, 0x04, 0x84, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x04, 0x87, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x85, 0x00, 0x00, 0xfb, 0x86, 0xff, 0x01, 0xcf,
+  0x17, 0x85, 0x00, 0x01, 0x94, 0xfe, 0x89, 0xff, 0x02, 0xcf, 0x48, 0x01,
+  0x86, 0x00, 0x01, 0x92, 0xfe, 0x84, 0xff, 0x03, 0xbf, 0x88, 0x88, 0x48,
+  0x85, 0x00, 0x83, 0x88, 0x00, 0x98, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x04, 0x30, 0xff, 0xff, 0x9e, 0x03, 0x83, 0x00, 0x01, 0x60, 0xfd, 0x8a,
+  0xff, 0x01, 0x7c, 0x01, 0x84, 0x00, 0x01, 0x40, 0xe9, 0x87, 0xff, 0x00,
+  0xbf, 0x84, 0x88, 0x04, 0xfb, 0xff, 0xff, 0xbf, 0x03, 0x82, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x01, 0x3d, 0xfc, 0x85, 0xff, 0x00, 0x07, 0x84, 0x00,
+  0x00, 0x30, 0xe8, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x70, 0x83, 0xff,
+  0x00, 0x0a, 0x82, 0x00, 0x00, 0x30, 0x83, 0x00, 0x00, 0xf0, 0x83, 0xff,
+  0x00, 0x07, 0x84, 0x00, 0x00, 0xf4, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x03, 0x70, 0xff, 0x9f, 0x01, 0x85, 0x00, 0x00, 0xc3, 0x86, 0xff, 0x01,
+  0x7c, 0x02, 0x89, 0x00, 0x01, 0x20, 0xf9, 0x84, 0xff, 0x8d, 0x00, 0x03,
+  0xfc, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x00, 0xf0, 0x85, 0xff, 0x00, 0x7e,
+  0x88, 0x00, 0x01, 0x20, 0xe8, 0x8b, 0xff, 0x00, 0x7f, 0x8c, 0x00, 0x00,
+  0x40, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x03, 0x30, 0xff, 0xcf, 0x03,
+  0x85, 0x00, 0x00, 0x90, 0x89, 0xff, 0x00, 0x6d, 0x87, 0x00, 0x01, 0x10,
+  0xe8, 0x8f, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00,
+  0x02, 0x82, 0x00, 0x00, 0x40, 0x83, 0x00, 0x00, 0xf8, 0x82, 0xff, 0x00,
+  0xef, 0x85, 0x00, 0x86, 0xff, 0x01, 0xdf, 0x05, 0x87, 0x00, 0x01, 0x81,
+  0xfe, 0x86, 0xff, 0x01, 0xef, 0x5a, 0x8a, 0x00, 0x01, 0x60, 0xfe, 0x83,
+  0xff, 0x00, 0x7f, 0x8c, 0x00, 0x00, 0x50, 0x82, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x03, 0x30, 0xff, 0xbf, 0x02, 0x85, 0x00, 0x00, 0x90, 0x89, 0xff,
+  0x00, 0x5d, 0x87, 0x00, 0x01, 0x10, 0xe8, 0x86, 0xff, 0x00, 0x7f, 0x84,
+  0x00, 0x03, 0xf7, 0xff, 0xef, 0x06, 0x83, 0x00, 0x00, 0xfa, 0x8a, 0xff,
+  0x00, 0x07, 0x84, 0x00, 0x00, 0x50, 0xe8, 0xff, 0x00, 0x2f, 0x84, 0x00,
+  0x00, 0x50, 0x83, 0xff, 0x00, 0x07, 0x82, 0x00, 0x00, 0x70, 0x83, 0x00,
+  0x00, 0xc0, 0x83, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x02, 0x70, 0xef, 0x04, 0x86, 0x00, 0x01, 0x10,
+  0xfc, 0x84, 0xff, 0x00, 0x2f, 0x8c, 0x00, 0x01, 0x50, 0xfe, 0x83, 0xff,
+  0x8d, 0x00, 0x82, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff,
+  0x01, 0x9f, 0x01, 0x89, 0x00, 0x01, 0x10, 0xf9, 0x8a, 0xff, 0x00, 0x7f,
+  0x8c, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x02, 0x30,
+  0xff, 0x08, 0x87, 0x00, 0x00, 0xf6, 0x87, 0xff, 0x01, 0x9f, 0x01, 0x88,
+  0x00, 0x01, 0x10, 0xf9, 0x8e, 0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0xe0,
+  0x83, 0xff, 0x83, 0x00, 0x00, 0x71, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x00, 0xbf, 0x84, 0x00, 0x00, 0x10, 0x86, 0xff, 0x00, 0x09, 0x89, 0x00,
+  0x00, 0xa2, 0x86, 0xff, 0x00, 0x0a, 0x8c, 0x00, 0x00, 0xa1, 0x83, 0xff,
+  0x00, 0x7f, 0x8c, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x02, 0x30, 0xff, 0x07, 0x87, 0x00, 0x00, 0xf6, 0x87, 0xff, 0x00, 0x9f,
+  0x89, 0x00, 0x01, 0x20, 0xfa, 0x85, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x02,
+  0xf5, 0xff, 0x3f, 0x84, 0x00, 0x00, 0xfc, 0x8a, 0xff, 0x00, 0x02, 0x84,
+  0x00, 0x00, 0x70, 0xe8, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x04, 0x82, 0x00, 0x01, 0xa0, 0x03, 0x82, 0x00, 0x00, 0xb0,
+  0x83, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xfa, 0x82, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x01, 0x70, 0x3e, 0x88, 0x00, 0x00, 0xe2, 0x84, 0xff, 0x00,
+  0x5f, 0x8d, 0x00, 0x00, 0xe3, 0x83, 0xff, 0x8c, 0x00, 0x00, 0x20, 0x82,
+  0xff, 0x00, 0x7f, 0x83, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x00, 0x06, 0x8b,
+  0x00, 0x01, 0x40, 0xfd, 0x89, 0xff, 0x00, 0x7f, 0x8c, 0x00, 0x00, 0xa0,
+  0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x30, 0x6f, 0x88, 0x00, 0x00,
+  0xa0, 0x87, 0xff, 0x00, 0x09, 0x8a, 0x00, 0x00, 0x80, 0x8e, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00, 0x00,
+  0xa3, 0x83, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x00, 0x9f, 0x84, 0x00, 0x00,
+  0x30, 0x85, 0xff, 0x00, 0x6f, 0x8b, 0x00, 0x00, 0xf9, 0x85, 0xff, 0x00,
+  0x0d, 0x8d, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0x7f, 0x8c, 0x00, 0x00,
+  0xa0, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x30, 0x6f, 0x88, 0x00,
+  0x00, 0xa0, 0x87, 0xff, 0x00, 0x06, 0x8a, 0x00, 0x00, 0x90, 0x85, 0xff,
+  0x00, 0x7f, 0x84, 0x00, 0x02, 0xf3, 0xff, 0x06, 0x84, 0x00, 0x8a, 0xff,
+  0x00, 0x8f, 0x85, 0x00, 0x00, 0xc0, 0xe8, 0xff, 0x00, 0x7f, 0x84, 0x00,
+  0x00, 0x20, 0x83, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01, 0xd0, 0x06, 0x82,
+  0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x01, 0x84, 0x00, 0x00, 0xfc, 0x82,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x01, 0x50, 0x03, 0x88, 0x00, 0x00, 0x50,
+  0x84, 0xff, 0x00, 0xcf, 0x8d, 0x00, 0x00, 0x30, 0x83, 0xff, 0x8c, 0x00,
+  0x00, 0x30, 0x82, 0xff, 0x00, 0xaf, 0x83, 0x00, 0x00, 0xf3, 0x83, 0xff,
+  0x00, 0x6f, 0x8d, 0x00, 0x00, 0xe1, 0x89, 0xff, 0x00, 0x7f, 0x8c, 0x00,
+  0x00, 0xb0, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x30, 0x06, 0x88,
+  0x00, 0x01, 0x10, 0xfe, 0x85, 0xff, 0x00, 0x6f, 0x8c, 0x00, 0x00, 0xf6,
+  0x8d, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x00, 0x9f,
+  0x83, 0x00, 0x00, 0xc7, 0x83, 0x00, 0x00, 0xf2, 0x82, 0xff, 0x00, 0x7f,
+  0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x06, 0x8b, 0x00, 0x00, 0x70,
+  0x85, 0xff, 0x00, 0x4f, 0x8d, 0x00, 0x00, 0xc0, 0x82, 0xff, 0x00, 0x7f,
+  0x8c, 0x00, 0x00, 0xc0, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x30,
+  0x06, 0x88, 0x00, 0x01, 0x10, 0xfe, 0x85, 0xff, 0x00, 0x6f, 0x8c, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x01, 0xf2, 0x8f, 0x84,
+  0x00, 0x00, 0x20, 0x8a, 0xff, 0x00, 0x08, 0x85, 0x00, 0x00, 0xf0, 0xe8,
+  0xff, 0x00, 0x9f, 0x85, 0x00, 0x83, 0xff, 0x83, 0x00, 0x01, 0xf0, 0x08,
+  0x82, 0x00, 0x00, 0x50, 0x83, 0xff, 0x85, 0x00, 0x83, 0xff, 0x00, 0x0b,
+  0x90, 0x00, 0x00, 0xfd, 0x84, 0xff, 0x00, 0x01, 0x8d, 0x00, 0x00, 0xf7,
+  0x82, 0xff, 0x8c, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00,
+  0x00, 0xf6, 0x83, 0xff, 0x00, 0x06, 0x8d, 0x00, 0x00, 0xf7, 0x89, 0xff,
+  0x00, 0x7f, 0x8c, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0f, 0x90, 0x00,
+  0x00, 0xf7, 0x85, 0xff, 0x00, 0x06, 0x8c, 0x00, 0x00, 0x70, 0x8d, 0xff,
+  0x00, 0x1f, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x7f, 0x83, 0x00,
+  0x00, 0xf9, 0x83, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x4f, 0x84, 0x00,
+  0x00, 0x90, 0x84, 0xff, 0x00, 0x3e, 0x8d, 0x00, 0x00, 0xf8, 0x84, 0xff,
+  0x00, 0x9f, 0x8d, 0x00, 0x00, 0x20, 0x82, 0xff, 0x00, 0x7f, 0x8c, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x00, 0x0f, 0x90, 0x00, 0x00, 0xf8, 0x84, 0xff,
+  0x01, 0xef, 0x03, 0x8c, 0x00, 0x00, 0x80, 0x84, 0xff, 0x00, 0x7f, 0x84,
+  0x00, 0x01, 0xf0, 0x0e, 0x84, 0x00, 0x00, 0x40, 0x89, 0xff, 0x00, 0x5e,
+  0x86, 0x00, 0x00, 0xf7, 0xe8, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x03, 0xfd,
+  0xff, 0xff, 0xcf, 0x83, 0x00, 0x01, 0xf3, 0x0b, 0x82, 0x00, 0x00, 0x30,
+  0x82, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x00, 0x20, 0x83, 0xff, 0x00, 0x0b,
+  0x90, 0x00, 0x00, 0xf6, 0x84, 0xff, 0x00, 0x06, 0x8d, 0x00, 0x00, 0xe1,
+  0x82, 0xff, 0x8c, 0x00, 0x00, 0x80, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x00, 0xdf, 0x8d, 0x00, 0x00, 0x20, 0x8a, 0xff,
+  0x00, 0x7f, 0x8c, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x0f, 0x90, 0x00,
+  0x00, 0xf1, 0x84, 0xff, 0x00, 0x8f, 0x8e, 0x00, 0x00, 0xfb, 0x8c, 0xff,
+  0x00, 0x3f, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x3f, 0x83, 0x00,
+  0x01, 0xfb, 0x01, 0x82, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x3f, 0x84,
+  0x00, 0x00, 0xb0, 0x84, 0xff, 0x00, 0x07, 0x8d, 0x00, 0x00, 0xc0, 0x84,
+  0xff, 0x00, 0xef, 0x8e, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x7f, 0x8c, 0x00,
+  0x00, 0xf2, 0x82, 0xff, 0x00, 0x0f, 0x90, 0x00, 0x00, 0xf2, 0x84, 0xff,
+  0x00, 0x7f, 0x8e, 0x00, 0x00, 0xfc, 0x83, 0xff, 0x00, 0x7f, 0x84, 0x00,
+  0x01, 0xd0, 0x07, 0x84, 0x00, 0x00, 0x70, 0x88, 0xff, 0x01, 0xbf, 0x01,
+  0x85, 0x00, 0x00, 0x10, 0xea, 0xff, 0x85, 0x00, 0x03, 0xfb, 0xff, 0xff,
+  0xaf, 0x83, 0x00, 0x01, 0xf5, 0x0d, 0x83, 0x00, 0x82, 0xff, 0x00, 0xaf,
+  0x84, 0x00, 0x00, 0x40, 0x83, 0xff, 0x00, 0x0b, 0x90, 0x00, 0x00, 0xf3,
+  0x84, 0xff, 0x00, 0x0c, 0x8d, 0x00, 0x00, 0x80, 0x82, 0xff, 0x8c, 0x00,
+  0x00, 0xb0, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x00, 0x5f, 0x8d, 0x00, 0x00, 0xc0, 0x8a, 0xff, 0x00, 0x7f, 0x8c, 0x00,
+  0x00, 0xf3, 0x82, 0xff, 0x00, 0x0f, 0x90, 0x00, 0x00, 0xb0, 0x84, 0xff,
+  0x00, 0x1d, 0x86, 0x00, 0x00, 0x44, 0x86, 0x00, 0x00, 0xe2, 0x8c, 0xff,
+  0x00, 0x7f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x2f, 0x83, 0x00,
+  0x01, 0xff, 0x03, 0x82, 0x00, 0x00, 0xa0, 0x82, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0xcf, 0x86, 0x00, 0x01, 0x41, 0x03,
+  0x85, 0x00, 0x01, 0x30, 0xfe, 0x84, 0xff, 0x00, 0x04, 0x8d, 0x00, 0x03,
+  0xf1, 0xff, 0xff, 0x7f, 0x8c, 0x00, 0x00, 0xf4, 0x82, 0xff, 0x00, 0x0f,
+  0x90, 0x00, 0x00, 0xd0, 0x84, 0xff, 0x00, 0x0c, 0x86, 0x00, 0x00, 0x44,
+  0x86, 0x00, 0x00, 0xe3, 0x83, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x01, 0xa0,
+  0x01, 0x84, 0x00, 0x00, 0xa0, 0x88, 0xff, 0x00, 0x09, 0x86, 0x00, 0x00,
+  0xc0, 0xea, 0xff, 0x00, 0x01, 0x84, 0x00, 0x03, 0xf9, 0xff, 0xff, 0x7f,
+  0x83, 0x00, 0x01, 0xf7, 0x0f, 0x83, 0x00, 0x03, 0xfd, 0xff, 0xff, 0x7f,
+  0x84, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x0b, 0x87, 0x00, 0x02, 0x51,
+  0x77, 0x01, 0x85, 0x00, 0x00, 0xe0, 0x84, 0xff, 0x00, 0x1f, 0x82, 0x00,
+  0x04, 0x30, 0x76, 0x77, 0x47, 0x02, 0x85, 0x00, 0x00, 0x30, 0x82, 0xff,
+  0x8c, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x83, 0x00, 0x00, 0xf8, 0x82, 0xff,
+  0x00, 0x0c, 0x85, 0x00, 0x04, 0x60, 0xba, 0x8b, 0x36, 0x01, 0x82, 0x00,
+  0x00, 0xf7, 0x8a, 0xff, 0x00, 0x7f, 0x8c, 0x00, 0x00, 0xf5, 0x82, 0xff,
+  0x00, 0x0f, 0x87, 0x00, 0x02, 0x40, 0x77, 0x04, 0x85, 0x00, 0x00, 0x80,
+  0x84, 0xff, 0x00, 0x05, 0x84, 0x00, 0x04, 0x30, 0xfd, 0xff, 0xdf, 0x05,
+  0x84, 0x00, 0x00, 0x60, 0x8c, 0xff, 0x00, 0x9f, 0x84, 0x00, 0x00, 0x30,
+  0x82, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x02, 0x20, 0xff, 0x07, 0x82, 0x00,
+  0x00, 0x70, 0x82, 0xff, 0x00, 0x0e, 0x84, 0x00, 0x00, 0xf1, 0x83, 0xff,
+  0x00, 0x4f, 0x85, 0x00, 0x03, 0xe5, 0xff, 0xff, 0x3d, 0x85, 0x00, 0x00,
+  0xf8, 0x84, 0xff, 0x00, 0x09, 0x82, 0x00, 0x03, 0x42, 0x77, 0x77, 0x36,
+  0x86, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x7f, 0x8c, 0x00, 0x00, 0xf7, 0x82,
+  0xff, 0x00, 0x0f, 0x87, 0x00, 0x02, 0x40, 0x77, 0x04, 0x85, 0x00, 0x00,
+  0x90, 0x84, 0xff, 0x00, 0x04, 0x84, 0x00, 0x04, 0x50, 0xfd, 0xff, 0xdf,
+  0x05, 0x84, 0x00, 0x00, 0x80, 0x83, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x00,
+  0x40, 0x85, 0x00, 0x00, 0xc0, 0x87, 0xff, 0x00, 0x6e, 0x87, 0x00, 0x00,
+  0xfa, 0xea, 0xff, 0x00, 0x03, 0x84, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x4f,
+  0x83, 0x00, 0x01, 0xfb, 0x3f, 0x83, 0x00, 0x03, 0xfb, 0xff, 0xff, 0x5f,
+  0x84, 0x00, 0x00, 0xa0, 0x83, 0xff, 0x00, 0x0b, 0x86, 0x00, 0x03, 0x70,
+  0xfe, 0xff, 0x5f, 0x85, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x03, 0x8f, 0x00,
+  0x62, 0xda, 0x83, 0xff, 0x01, 0xbf, 0x03, 0x85, 0x00, 0x82, 0xff, 0x82,
+  0xbb, 0x85, 0x00, 0x00, 0xb5, 0x82, 0xbb, 0x00, 0xfb, 0x83, 0xff, 0x83,
+  0x00, 0x00, 0xfb, 0x82, 0xff, 0x00, 0x08, 0x84, 0x00, 0x01, 0x20, 0xfe,
+  0x82, 0xff, 0x04, 0xdf, 0x06, 0x00, 0x10, 0xfe, 0x8a, 0xff, 0x03, 0xdf,
+  0xbb, 0xbb, 0x5b, 0x85, 0x00, 0x83, 0xbb, 0x00, 0xfd, 0x82, 0xff, 0x00,
+  0x0f, 0x86, 0x00, 0x03, 0x30, 0xfd, 0xff, 0xbf, 0x85, 0x00, 0x00, 0x50,
+  0x83, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x00, 0xf5, 0x82, 0xff, 0x00, 0x7f,
+  0x84, 0x00, 0x01, 0x10, 0xfe, 0x8b, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x82,
+  0xff, 0x00, 0x0b, 0x82, 0x00, 0x02, 0x40, 0xff, 0x09, 0x82, 0x00, 0x00,
+  0x40, 0x82, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00,
+  0x08, 0x84, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00,
+  0xf2, 0x84, 0xff, 0x03, 0x0f, 0x00, 0x84, 0xfc, 0x83, 0xff, 0x00, 0x7e,
+  0x85, 0x00, 0x06, 0x70, 0xff, 0xff, 0xdf, 0xbb, 0xbb, 0x5b, 0x85, 0x00,
+  0x83, 0xbb, 0x00, 0xfd, 0x82, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x03, 0x40,
+  0xfd, 0xff, 0xaf, 0x85, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x8f, 0x85,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x6f, 0x84, 0x00, 0x00, 0x20, 0x83,
+  0xff, 0x00, 0x7f, 0x8b, 0x00, 0x00, 0xf0, 0x86, 0xff, 0x01, 0xef, 0x03,
+  0x86, 0x00, 0x00, 0xb0, 0xeb, 0xff, 0x00, 0x07, 0x84, 0x00, 0x03, 0xf5,
+  0xff, 0xff, 0x3f, 0x83, 0x00, 0x01, 0xfd, 0x5f, 0x83, 0x00, 0x03, 0xf8,
+  0xff, 0xff, 0x3f, 0x84, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x00, 0x0b, 0x86,
+  0x00, 0x00, 0xfc, 0x82, 0xff, 0x85, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x01,
+  0xdf, 0xd8, 0x86, 0xff, 0x00, 0x0e, 0x85, 0x00, 0x00, 0xfb, 0x84, 0xff,
+  0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00, 0xc0,
+  0x84, 0xff, 0x02, 0xef, 0x07, 0xb0, 0x8e, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x86, 0x00, 0x00, 0xf5, 0x82, 0xff, 0x00, 0x06,
+  0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x2f, 0x84, 0x00, 0x00, 0x30,
+  0x84, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00, 0xf8, 0x8c, 0xff, 0x85, 0x00,
+  0x82, 0xff, 0x00, 0x09, 0x82, 0x00, 0x02, 0x70, 0xff, 0x0b, 0x82, 0x00,
+  0x00, 0x30, 0x82, 0xff, 0x00, 0x09, 0x84, 0x00, 0x00, 0xf7, 0x83, 0xff,
+  0x00, 0x01, 0x84, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0x1f, 0x84, 0x00,
+  0x00, 0x90, 0x84, 0xff, 0x01, 0x9f, 0xfa, 0x86, 0xff, 0x00, 0x07, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x86, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00,
+  0x70, 0x83, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x00, 0x50, 0x84, 0xff, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0x7f, 0x8b, 0x00, 0x00,
+  0xf1, 0x86, 0xff, 0x00, 0x3e, 0x86, 0x00, 0x01, 0x10, 0xfc, 0xeb, 0xff,
+  0x00, 0x09, 0x84, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x01,
+  0xff, 0x7f, 0x83, 0x00, 0x03, 0xf6, 0xff, 0xff, 0x1f, 0x84, 0x00, 0x00,
+  0xf0, 0x83, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x00,
+  0x06, 0x84, 0x00, 0x00, 0xa0, 0x8d, 0xff, 0x00, 0x9f, 0x85, 0x00, 0x00,
+  0xf8, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xf0, 0x85, 0xff, 0x01, 0xef, 0xfa, 0x8e, 0xff, 0x00, 0x7f,
+  0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x00, 0x50, 0x83, 0xff,
+  0x00, 0x0c, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0c, 0x84, 0x00,
+  0x00, 0xd0, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xf2, 0x8c, 0xff,
+  0x00, 0x01, 0x84, 0x00, 0x03, 0xfb, 0xff, 0xff, 0x07, 0x82, 0x00, 0x02,
+  0xa0, 0xff, 0x0f, 0x83, 0x00, 0x82, 0xff, 0x00, 0x07, 0x84, 0x00, 0x00,
+  0xf9, 0x82, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x00, 0xfe, 0x83, 0xff, 0x00,
+  0x9f, 0x84, 0x00, 0x00, 0x40, 0x8d, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x00,
+  0x10, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x85,
+  0x00, 0x00, 0x80, 0x83, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0xe0, 0x84, 0xff, 0x00, 0x09, 0x84,
+  0x00, 0x00, 0xf4, 0x82, 0xff, 0x00, 0x7f, 0x88, 0x00, 0x03, 0x20, 0x44,
+  0x03, 0xf3, 0x86, 0xff, 0x00, 0x06, 0x86, 0x00, 0x00, 0xe4, 0xec, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x0c, 0x82, 0x00, 0x02,
+  0x30, 0xff, 0xbf, 0x83, 0x00, 0x03, 0xf3, 0xff, 0xff, 0x0f, 0x84, 0x00,
+  0x00, 0xf2, 0x83, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x00, 0xf8, 0x83, 0xff,
+  0x00, 0x07, 0x84, 0x00, 0x00, 0x70, 0x8d, 0xff, 0x00, 0xdf, 0x85, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x03,
+  0x84, 0x00, 0x00, 0xc0, 0x96, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff,
+  0x00, 0x0f, 0x85, 0x00, 0x00, 0xf2, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0x08, 0x84, 0x00, 0x00, 0xf2, 0x84, 0xff,
+  0x00, 0x2f, 0x84, 0x00, 0x00, 0xc0, 0x8c, 0xff, 0x00, 0x03, 0x84, 0x00,
+  0x03, 0xfb, 0xff, 0xff, 0x03, 0x82, 0x00, 0x02, 0xc0, 0xff, 0x1f, 0x83,
+  0x00, 0x03, 0xfd, 0xff, 0xff, 0x04, 0x84, 0x00, 0x00, 0xfb, 0x82, 0xff,
+  0x00, 0x5f, 0x84, 0x00, 0x00, 0x50, 0x85, 0xff, 0x85, 0x00, 0x00, 0xfe,
+  0x8c, 0xff, 0x00, 0x5f, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x0c,
+  0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00, 0xf4,
+  0x84, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x00, 0xe0, 0x82, 0xff, 0x00, 0x7f,
+  0x87, 0x00, 0x00, 0xa0, 0x89, 0xff, 0x00, 0xbf, 0x86, 0x00, 0x00, 0x80,
+  0xed, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x0a, 0x82,
+  0x00, 0x02, 0x60, 0xff, 0xcf, 0x83, 0x00, 0x03, 0xf1, 0xff, 0xff, 0x0b,
+  0x84, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x40,
+  0x84, 0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0x70, 0x8e, 0xff, 0x85, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x03,
+  0x84, 0x00, 0x01, 0x40, 0xfe, 0x95, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x85, 0x00, 0x00, 0xfd, 0x83, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x84,
+  0xff, 0x00, 0x7f, 0x84, 0x00, 0x00, 0x90, 0x8c, 0xff, 0x00, 0x07, 0x84,
+  0x00, 0x03, 0xf7, 0xff, 0xff, 0x02, 0x82, 0x00, 0x02, 0xf0, 0xff, 0x3f,
+  0x83, 0x00, 0x03, 0xfb, 0xff, 0xff, 0x03, 0x84, 0x00, 0x83, 0xff, 0x00,
+  0x2f, 0x84, 0x00, 0x00, 0xb0, 0x85, 0xff, 0x00, 0x04, 0x84, 0x00, 0x00,
+  0xfb, 0x8c, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x00, 0xfe, 0x83, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x02, 0x84, 0x00, 0x00,
+  0xf9, 0x84, 0xff, 0x00, 0x5f, 0x84, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x00,
+  0x7f, 0x86, 0x00, 0x01, 0x20, 0xfd, 0x89, 0xff, 0x00, 0x4f, 0x85, 0x00,
+  0x01, 0x20, 0xfc, 0xed, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x03, 0xe0, 0xff,
+  0xff, 0x07, 0x82, 0x00, 0x02, 0x80, 0xff, 0xff, 0x83, 0x00, 0x03, 0xf0,
+  0xff, 0xff, 0x0a, 0x84, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x8e,
+  0xff, 0x00, 0x02, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00,
+  0xf7, 0x8f, 0xff, 0x00, 0x06, 0x85, 0x00, 0x00, 0xa2, 0x95, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0xdf, 0x85,
+  0x00, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x00, 0x50, 0x8c,
+  0xff, 0x00, 0x09, 0x84, 0x00, 0x02, 0xf7, 0xff, 0xff, 0x83, 0x00, 0x02,
+  0xf2, 0xff, 0x7f, 0x83, 0x00, 0x02, 0xf7, 0xff, 0xff, 0x84, 0x00, 0x00,
+  0x10, 0x83, 0xff, 0x00, 0x0c, 0x84, 0x00, 0x00, 0xe0, 0x85, 0xff, 0x00,
+  0x07, 0x84, 0x00, 0x00, 0xf7, 0x8c, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x84,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00,
+  0xcf, 0x85, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x7f, 0x86, 0x00, 0x00, 0xe1, 0x8a, 0xff, 0x00,
+  0x0d, 0x85, 0x00, 0x00, 0xe5, 0xee, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x03,
+  0xb0, 0xff, 0xff, 0x04, 0x82, 0x00, 0x03, 0xb0, 0xff, 0xff, 0x02, 0x82,
+  0x00, 0x03, 0xb0, 0xff, 0xff, 0x07, 0x84, 0x00, 0x00, 0xfa, 0x83, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x8e, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x0a, 0x86, 0x00, 0x01, 0x72,
+  0xfc, 0x93, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82,
+  0xff, 0x00, 0x8f, 0x85, 0x00, 0x85, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x00,
+  0x30, 0x8c, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x02, 0xf4, 0xff, 0xbf, 0x83,
+  0x00, 0x02, 0xf5, 0xff, 0x9f, 0x83, 0x00, 0x02, 0xf5, 0xff, 0xef, 0x84,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x06, 0x84, 0x00, 0x00, 0xf1, 0x85,
+  0xff, 0x00, 0x08, 0x84, 0x00, 0x00, 0xf3, 0x8c, 0xff, 0x00, 0xbf, 0x85,
+  0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82,
+  0xff, 0x00, 0x6f, 0x85, 0x00, 0x85, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x00,
+  0x30, 0x82, 0xff, 0x00, 0x7f, 0x86, 0x00, 0x00, 0xf9, 0x8a, 0xff, 0x00,
+  0x08, 0x84, 0x00, 0x00, 0x50, 0xef, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x03,
+  0xa0, 0xff, 0xff, 0x03, 0x82, 0x00, 0x03, 0xe0, 0xff, 0xff, 0x04, 0x82,
+  0x00, 0x03, 0x90, 0xff, 0xff, 0x05, 0x84, 0x00, 0x00, 0xfd, 0x83, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x8b, 0xff, 0x82, 0xcc, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf7,
+  0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x0e, 0x87, 0x00,
+  0x01, 0x20, 0xb7, 0x92, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x82, 0xff, 0x00, 0x6f, 0x85, 0x00, 0x85, 0xff, 0x00, 0xbf, 0x85,
+  0x00, 0x8c, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x02, 0xf3, 0xff, 0x8f, 0x83,
+  0x00, 0x02, 0xf7, 0xff, 0xbf, 0x83, 0x00, 0x02, 0xf3, 0xff, 0xbf, 0x84,
+  0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf3, 0x85,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xf1, 0x89, 0xff, 0x03, 0xef, 0xcc,
+  0xcc, 0x9c, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x82, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x20, 0x85, 0xff,
+  0x00, 0xbf, 0x84, 0x00, 0x00, 0x10, 0x82, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x00, 0x10, 0x8b, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf2, 0xef, 0xff,
+  0x00, 0x9f, 0x84, 0x00, 0x02, 0x70, 0xff, 0xff, 0x83, 0x00, 0x03, 0xf0,
+  0xff, 0xff, 0x07, 0x82, 0x00, 0x03, 0x70, 0xff, 0xff, 0x03, 0x84, 0x00,
+  0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0x87, 0xff, 0x02, 0xbe, 0x58, 0x03, 0x89, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0x7f,
+  0x89, 0x00, 0x01, 0x61, 0xfc, 0x90, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x20, 0x86,
+  0xff, 0x85, 0x00, 0x8c, 0xff, 0x00, 0x1f, 0x84, 0x00, 0x02, 0xf1, 0xff,
+  0x6f, 0x83, 0x00, 0x02, 0xfb, 0xff, 0xff, 0x83, 0x00, 0x02, 0xf1, 0xff,
+  0x9f, 0x84, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0xf5, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xf0, 0x86, 0xff, 0x02,
+  0x9c, 0x47, 0x01, 0x89, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x30, 0x85,
+  0xff, 0x00, 0xbf, 0x85, 0x00, 0x82, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x00,
+  0xa0, 0x8b, 0xff, 0x00, 0x02, 0x84, 0x00, 0x00, 0xfc, 0xef, 0xff, 0x00,
+  0xbf, 0x84, 0x00, 0x02, 0x60, 0xff, 0xcf, 0x83, 0x00, 0x03, 0xf3, 0xff,
+  0xff, 0x0a, 0x82, 0x00, 0x03, 0x30, 0xff, 0xff, 0x01, 0x83, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x01, 0xef, 0x5a, 0x8c, 0x00,
+  0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x8f, 0xff, 0x00, 0xef,
+  0x8a, 0x00, 0x01, 0x20, 0xfa, 0x8f, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x3f, 0x92, 0x00, 0x00, 0xfd, 0x8b,
+  0xff, 0x00, 0x3f, 0x84, 0x00, 0x02, 0xf0, 0xff, 0x3f, 0x83, 0x00, 0x02,
+  0xfd, 0xff, 0xff, 0x83, 0x00, 0x02, 0xe0, 0xff, 0x7f, 0x84, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x00, 0x02, 0x91, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x01,
+  0xcf, 0x27, 0x8c, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x82, 0xff, 0x00, 0x2f, 0x92, 0x00, 0x82, 0xff, 0x00, 0x7f,
+  0x85, 0x00, 0x00, 0xf0, 0x8b, 0xff, 0x84, 0x00, 0x00, 0x30, 0xf1, 0xff,
+  0x84, 0x00, 0x02, 0x30, 0xff, 0xaf, 0x83, 0x00, 0x03, 0xf7, 0xff, 0xff,
+  0x0c, 0x82, 0x00, 0x02, 0x30, 0xff, 0xff, 0x84, 0x00, 0x00, 0x50, 0x84,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x2a, 0x8d, 0x00, 0x00, 0xf7, 0x84,
+  0xff, 0x85, 0x00, 0x00, 0xf7, 0x90, 0xff, 0x00, 0x0b, 0x8a, 0x00, 0x01,
+  0x20, 0xfa, 0x8e, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0x82, 0xff, 0x00, 0x2f, 0x92, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x00, 0x7f,
+  0x84, 0x00, 0x02, 0xc0, 0xff, 0x1f, 0x83, 0x00, 0x82, 0xff, 0x00, 0x03,
+  0x82, 0x00, 0x02, 0xb0, 0xff, 0x4f, 0x84, 0x00, 0x00, 0xf0, 0x83, 0xff,
+  0x92, 0x00, 0x00, 0xe0, 0x83, 0xff, 0x01, 0xdf, 0x06, 0x8d, 0x00, 0x84,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00,
+  0x0f, 0x92, 0x00, 0x03, 0xfe, 0xff, 0xff, 0x7f, 0x85, 0x00, 0x00, 0xf4,
+  0x8b, 0xff, 0x84, 0x00, 0x00, 0x60, 0xf1, 0xff, 0x84, 0x00, 0x02, 0x30,
+  0xff, 0x7f, 0x83, 0x00, 0x03, 0xf9, 0xff, 0xff, 0x0f, 0x83, 0x00, 0x01,
+  0xff, 0xbf, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0x3c, 0x8e, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7,
+  0x90, 0xff, 0x00, 0x9f, 0x8b, 0x00, 0x01, 0x40, 0xfd, 0x8d, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92,
+  0x00, 0x00, 0xfb, 0x8b, 0xff, 0x00, 0x8f, 0x84, 0x00, 0x02, 0xb0, 0xff,
+  0x0e, 0x82, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x06, 0x82, 0x00, 0x02,
+  0x80, 0xff, 0x3f, 0x84, 0x00, 0x00, 0xf1, 0x83, 0xff, 0x92, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x00, 0x08, 0x8e, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92, 0x00, 0x03,
+  0xfb, 0xff, 0xff, 0x7f, 0x85, 0x00, 0x00, 0xf8, 0x8b, 0xff, 0x84, 0x00,
+  0x00, 0x70, 0xf1, 0xff, 0x00, 0x03, 0x84, 0x00, 0x01, 0xff, 0x4f, 0x83,
+  0x00, 0x03, 0xfb, 0xff, 0xff, 0x1f, 0x83, 0x00, 0x01, 0xfc, 0xaf, 0x84,
+  0x00, 0x00, 0xb0, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x83, 0xff, 0x01, 0xcf, 0x01,
+  0x8e, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x91, 0xff,
+  0x00, 0x0a, 0x8b, 0x00, 0x00, 0xb1, 0x8d, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92, 0x00, 0x00, 0xfb,
+  0x8b, 0xff, 0x00, 0xbf, 0x84, 0x00, 0x02, 0x80, 0xff, 0x0b, 0x82, 0x00,
+  0x00, 0x50, 0x82, 0xff, 0x00, 0x08, 0x82, 0x00, 0x02, 0x70, 0xff, 0x0f,
+  0x84, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x00, 0xcf, 0x92, 0x00, 0x00, 0xb0,
+  0x82, 0xff, 0x00, 0x6f, 0x8f, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0c, 0x92, 0x00, 0x03, 0xfb,
+  0xff, 0xff, 0x7f, 0x85, 0x00, 0x00, 0xfd, 0x8b, 0xff, 0x84, 0x00, 0x00,
+  0x70, 0xf1, 0xff, 0x00, 0x06, 0x84, 0x00, 0x01, 0xfe, 0x3f, 0x83, 0x00,
+  0x82, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x01, 0xfa, 0x7f, 0x84, 0x00, 0x00,
+  0xd0, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x1c, 0x8f, 0x00, 0x00,
+  0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x91, 0xff, 0x01, 0xdf, 0x03,
+  0x8a, 0x00, 0x01, 0x10, 0xfc, 0x8c, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92, 0x00, 0x00, 0xfb, 0x8b,
+  0xff, 0x00, 0xef, 0x84, 0x00, 0x02, 0x70, 0xff, 0x08, 0x82, 0x00, 0x00,
+  0x80, 0x82, 0xff, 0x00, 0x0b, 0x82, 0x00, 0x02, 0x30, 0xff, 0x0e, 0x84,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0xbf, 0x92, 0x00, 0x00, 0xb0, 0x82,
+  0xff, 0x00, 0x06, 0x8f, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0b, 0x92, 0x00, 0x03, 0xfb, 0xff,
+  0xff, 0x7f, 0x85, 0x00, 0x8c, 0xff, 0x84, 0x77, 0x00, 0xb7, 0xf1, 0xff,
+  0x00, 0x08, 0x84, 0x00, 0x01, 0xfb, 0x0f, 0x82, 0x00, 0x00, 0x10, 0x82,
+  0xff, 0x00, 0x7f, 0x83, 0x00, 0x01, 0xf7, 0x5f, 0x84, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00, 0x03, 0x86, 0x00, 0x02, 0x20,
+  0x33, 0x33, 0x85, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7,
+  0x92, 0xff, 0x01, 0xbf, 0x03, 0x8a, 0x00, 0x00, 0xe1, 0x8c, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92,
+  0x00, 0x00, 0xfb, 0x8c, 0xff, 0x84, 0x00, 0x02, 0x50, 0xff, 0x06, 0x82,
+  0x00, 0x00, 0xb0, 0x82, 0xff, 0x00, 0x0e, 0x82, 0x00, 0x02, 0x20, 0xff,
+  0x0b, 0x84, 0x00, 0x00, 0xf9, 0x83, 0xff, 0x92, 0x00, 0x03, 0xc0, 0xff,
+  0xff, 0xaf, 0x87, 0x00, 0x02, 0x30, 0x33, 0x23, 0x85, 0x00, 0x84, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f,
+  0x92, 0x00, 0x03, 0xfc, 0xff, 0xff, 0x7f, 0x85, 0x00, 0xff, 0xff, 0x84,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x01, 0xfa, 0x0c, 0x82, 0x00, 0x00, 0x30,
+  0x82, 0xff, 0x00, 0x9f, 0x83, 0x00, 0x01, 0xf5, 0x3f, 0x84, 0x00, 0x00,
+  0xf3, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x01,
+  0x10, 0xe8, 0x82, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x85, 0x00, 0x00, 0xf7, 0x93, 0xff, 0x01, 0xbf, 0x05, 0x89, 0x00, 0x00,
+  0x70, 0x8c, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82,
+  0xff, 0x00, 0x0f, 0x92, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x00, 0x03, 0x83,
+  0x00, 0x02, 0x30, 0xff, 0x03, 0x82, 0x00, 0x00, 0xe0, 0x82, 0xff, 0x00,
+  0x0f, 0x83, 0x00, 0x01, 0xff, 0x09, 0x84, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x92, 0x00, 0x03, 0xf0, 0xff, 0xff, 0x1e, 0x85, 0x00, 0x04, 0x50, 0xfc,
+  0xff, 0xff, 0xbf, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x92, 0x00, 0x82, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0xff, 0xff, 0x84, 0xff, 0x00, 0x0e, 0x84, 0x00, 0x01,
+  0xf7, 0x0a, 0x82, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00,
+  0x01, 0xf3, 0x1f, 0x84, 0x00, 0x00, 0xf5, 0x84, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x00, 0x1f, 0x85, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x95, 0xff, 0x01,
+  0x5a, 0x01, 0x87, 0x00, 0x00, 0x10, 0x8c, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x2f, 0x84, 0x00, 0x00, 0x10,
+  0x8c, 0x77, 0x8d, 0xff, 0x00, 0x06, 0x83, 0x00, 0x02, 0x20, 0xff, 0x01,
+  0x82, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x3f, 0x83, 0x00, 0x01, 0xfb,
+  0x07, 0x84, 0x00, 0x84, 0xff, 0x85, 0x00, 0x00, 0x72, 0x8b, 0x77, 0x03,
+  0xf7, 0xff, 0xff, 0x07, 0x84, 0x00, 0x01, 0x20, 0xfe, 0x82, 0xff, 0x00,
+  0xbf, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x10, 0x8c, 0x77, 0x82,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0xff, 0xff, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x01, 0xf6, 0x07, 0x82, 0x00, 0x00, 0xa0, 0x83, 0xff, 0x83, 0x00,
+  0x01, 0xf0, 0x0f, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x00, 0x0a, 0x84, 0x00, 0x00, 0x50, 0x84, 0xff, 0x00, 0x03, 0x84,
+  0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x96, 0xff, 0x01,
+  0xcf, 0x16, 0x87, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x3f, 0x85, 0x00, 0x9a, 0xff,
+  0x00, 0x08, 0x84, 0x00, 0x00, 0xef, 0x83, 0x00, 0x00, 0xf3, 0x82, 0xff,
+  0x00, 0x6f, 0x83, 0x00, 0x01, 0xfa, 0x04, 0x83, 0x00, 0x00, 0x10, 0x84,
+  0xff, 0x85, 0x00, 0x00, 0xf3, 0x8e, 0xff, 0x00, 0x02, 0x84, 0x00, 0x00,
+  0xd0, 0x83, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x20, 0x8f, 0xff, 0x00, 0x7f, 0x85, 0x00, 0xff, 0xff, 0x84, 0xff, 0x00,
+  0x3f, 0x84, 0x00, 0x01, 0xf3, 0x04, 0x82, 0x00, 0x00, 0xc0, 0x83, 0xff,
+  0x83, 0x00, 0x01, 0xd0, 0x0b, 0x84, 0x00, 0x00, 0xfb, 0x84, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x05, 0x84, 0x00, 0x00, 0xe0, 0x84, 0xff, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf7, 0x98,
+  0xff, 0x00, 0x3b, 0x86, 0x00, 0x00, 0xf7, 0x8b, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0x5f, 0x85, 0x00, 0x00,
+  0xfd, 0x99, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0xbd, 0x83, 0x00, 0x00,
+  0xf6, 0x82, 0xff, 0x00, 0x8f, 0x83, 0x00, 0x01, 0xf7, 0x03, 0x83, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x04, 0x84, 0x00, 0x00, 0xf0, 0x8d, 0xff,
+  0x00, 0xcf, 0x85, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0xbf, 0x85, 0x00,
+  0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff,
+  0x00, 0x4f, 0x85, 0x00, 0x8f, 0xff, 0x00, 0x7f, 0x85, 0x00, 0xff, 0xff,
+  0x84, 0xff, 0x00, 0x6f, 0x84, 0x00, 0x01, 0xf3, 0x03, 0x82, 0x00, 0x00,
+  0xf0, 0x83, 0xff, 0x00, 0x03, 0x82, 0x00, 0x01, 0xb0, 0x0a, 0x84, 0x00,
+  0x00, 0xfd, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x03, 0x84, 0x00,
+  0x00, 0xf1, 0x84, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x85, 0x00, 0x00, 0xf7, 0x99, 0xff, 0x00, 0x09, 0x85, 0x00, 0x00, 0xf4,
+  0x8b, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff,
+  0x00, 0x9f, 0x85, 0x00, 0x00, 0xf9, 0x99, 0xff, 0x00, 0x0e, 0x84, 0x00,
+  0x00, 0x8b, 0x83, 0x00, 0x00, 0xf8, 0x82, 0xff, 0x00, 0xbf, 0x83, 0x00,
+  0x00, 0xf4, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x07, 0x84, 0x00,
+  0x00, 0xc0, 0x8d, 0xff, 0x00, 0xaf, 0x85, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x00, 0xbf, 0x85, 0x00, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x87, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x82, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x00, 0xfa, 0x8e, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0xff, 0xff, 0x84, 0xff, 0x00, 0x8f, 0x84, 0x00,
+  0x00, 0xf0, 0x83, 0x00, 0x00, 0xf2, 0x83, 0xff, 0x00, 0x06, 0x82, 0x00,
+  0x01, 0x80, 0x07, 0x84, 0x00, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00,
+  0x03, 0x84, 0x00, 0x00, 0xf4, 0x84, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00,
+  0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf4, 0x99, 0xff, 0x00, 0x5f, 0x85,
+  0x00, 0x00, 0xf3, 0x8b, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x00, 0xfc, 0x86,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0xdf, 0x85, 0x00, 0x00, 0xf4, 0x99,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x6a, 0x83, 0x00, 0x00, 0xfb, 0x82,
+  0xff, 0x00, 0xdf, 0x83, 0x00, 0x00, 0xe3, 0x84, 0x00, 0x00, 0x90, 0x84,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x60, 0x8d, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x00, 0xfe, 0x83, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x84, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x87, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x82, 0xff, 0x00, 0xbf, 0x85,
+  0x00, 0x00, 0xf6, 0x8e, 0xff, 0x00, 0x7f, 0x85, 0x00, 0xff, 0xff, 0x84,
+  0xff, 0x00, 0xbf, 0x84, 0x00, 0x00, 0xc0, 0x83, 0x00, 0x00, 0xf4, 0x83,
+  0xff, 0x00, 0x08, 0x82, 0x00, 0x01, 0x60, 0x05, 0x83, 0x00, 0x00, 0x30,
+  0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x85, 0x00, 0x00, 0xf4, 0x84, 0xff,
+  0x00, 0x03, 0x84, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf3,
+  0x99, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x00, 0xf3, 0x8b, 0xff, 0x00, 0x7f,
+  0x85, 0x00, 0x00, 0xfb, 0x86, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x01,
+  0x84, 0x00, 0x00, 0xd0, 0x99, 0xff, 0x00, 0x3f, 0x84, 0x00, 0x00, 0x37,
+  0x83, 0x00, 0x84, 0xff, 0x83, 0x00, 0x00, 0xb0, 0x84, 0x00, 0x00, 0xb0,
+  0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x10, 0xfe, 0x8c, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x00, 0xfe, 0x83, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x84,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x00, 0xfb, 0x86, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x85, 0x00, 0x00, 0xe1, 0x8e, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8d,
+  0xff, 0x03, 0x5c, 0x03, 0x40, 0xe8, 0xf2, 0xff, 0x00, 0xef, 0x84, 0x00,
+  0x00, 0x60, 0x83, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0x0b, 0x82, 0x00,
+  0x01, 0x30, 0x03, 0x83, 0x00, 0x00, 0x50, 0x85, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x85, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x01, 0xef, 0x01, 0x84, 0x00,
+  0x00, 0xf3, 0x84, 0xff, 0x85, 0x00, 0x00, 0xf2, 0x90, 0xff, 0x01, 0xef,
+  0xe7, 0x86, 0xff, 0x00, 0xbf, 0x85, 0x00, 0x00, 0xf5, 0x8b, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x00, 0xf9, 0x86, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x05, 0x84, 0x00, 0x00, 0x50, 0x87, 0xff, 0x00, 0xae, 0x90, 0xff, 0x00,
+  0x6f, 0x84, 0x00, 0x00, 0x16, 0x82, 0x00, 0x00, 0x10, 0x84, 0xff, 0x00,
+  0x03, 0x82, 0x00, 0x00, 0x60, 0x84, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x00,
+  0x4f, 0x85, 0x00, 0x00, 0xf7, 0x86, 0xff, 0x01, 0xef, 0xfa, 0x83, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x00, 0xfa, 0x86, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0x04, 0x84, 0x00, 0x00, 0x70, 0x87, 0xff,
+  0x00, 0xae, 0x85, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8c, 0xff, 0x00, 0x8f,
+  0x82, 0x00, 0x01, 0x20, 0xfb, 0xf2, 0xff, 0x84, 0x00, 0x00, 0x30, 0x83,
+  0x00, 0x00, 0xfa, 0x83, 0xff, 0x00, 0x0e, 0x82, 0x00, 0x01, 0x10, 0x01,
+  0x83, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70,
+  0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x85, 0x00,
+  0x00, 0xd0, 0x83, 0xff, 0x00, 0x4f, 0x85, 0x00, 0x00, 0xf3, 0x84, 0xff,
+  0x85, 0x00, 0x00, 0xb0, 0x90, 0xff, 0x02, 0x3e, 0x10, 0xfa, 0x85, 0xff,
+  0x00, 0x7f, 0x85, 0x00, 0x00, 0xf7, 0x8b, 0xff, 0x00, 0x9f, 0x85, 0x00,
+  0x00, 0xf4, 0x86, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0d, 0x85, 0x00,
+  0x00, 0xf9, 0x85, 0xff, 0x02, 0xaf, 0x02, 0xf8, 0x8f, 0xff, 0x00, 0x8f,
+  0x84, 0x00, 0x00, 0x01, 0x82, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x05,
+  0x82, 0x00, 0x00, 0x30, 0x84, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x00, 0xbf,
+  0x85, 0x00, 0x00, 0xa0, 0x86, 0xff, 0x01, 0x1a, 0xa0, 0x83, 0xff, 0x00,
+  0x7f, 0x85, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x00,
+  0xfb, 0x83, 0xff, 0x00, 0x8f, 0x85, 0x00, 0x00, 0xf4, 0x86, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x00, 0xfa, 0x85, 0xff, 0x02,
+  0xaf, 0x01, 0xfa, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8c, 0xff, 0x00,
+  0x06, 0x83, 0x00, 0x00, 0xb0, 0xf2, 0xff, 0x00, 0x03, 0x88, 0x00, 0x00,
+  0xfd, 0x83, 0xff, 0x00, 0x0f, 0x88, 0x00, 0x00, 0xb0, 0x85, 0xff, 0x00,
+  0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x03, 0x84, 0x00, 0x00, 0x50, 0x82, 0xff, 0x01,
+  0xef, 0x05, 0x85, 0x00, 0x00, 0xe0, 0x84, 0xff, 0x00, 0x04, 0x84, 0x00,
+  0x04, 0x30, 0xfc, 0xff, 0xbf, 0x94, 0x8c, 0xff, 0x03, 0x03, 0x00, 0x40,
+  0xfa, 0x84, 0xff, 0x00, 0x1c, 0x85, 0x00, 0x00, 0xfb, 0x8b, 0xff, 0x00,
+  0xcf, 0x85, 0x00, 0x04, 0x80, 0xff, 0xff, 0x8e, 0xf3, 0x82, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x83, 0xff, 0x00, 0x5f, 0x85, 0x00, 0x01, 0x60, 0xfe, 0x83, 0xff,
+  0x03, 0xbf, 0x04, 0x00, 0xc0, 0x8f, 0xff, 0x00, 0xbf, 0x88, 0x00, 0x00,
+  0x70, 0x84, 0xff, 0x00, 0x07, 0x88, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00,
+  0x03, 0x85, 0x00, 0x00, 0xe8, 0x84, 0xff, 0x03, 0x3a, 0x00, 0x10, 0xfd,
+  0x82, 0xff, 0x00, 0x8f, 0x85, 0x00, 0x00, 0xd1, 0x82, 0xff, 0x01, 0xaf,
+  0x01, 0x85, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00, 0xcf, 0x85, 0x00, 0x04,
+  0x80, 0xff, 0xff, 0x8e, 0xf3, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x3f, 0x85, 0x00, 0x01, 0x80, 0xfe, 0x83, 0xff, 0x03, 0xaf, 0x03, 0x00,
+  0xd1, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8b, 0xff, 0x00, 0xbf, 0x84,
+  0x00, 0x01, 0x20, 0xfe, 0xf1, 0xff, 0x00, 0x06, 0x88, 0x00, 0x84, 0xff,
+  0x00, 0x3f, 0x88, 0x00, 0x00, 0xd0, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff,
+  0x00, 0x05, 0x85, 0x00, 0x03, 0xe5, 0xff, 0xff, 0x2a, 0x86, 0x00, 0x00,
+  0x60, 0x84, 0xff, 0x00, 0x07, 0x85, 0x00, 0x03, 0x40, 0x45, 0x01, 0x20,
+  0x8b, 0xff, 0x00, 0x6f, 0x82, 0x00, 0x01, 0x20, 0xb7, 0x82, 0xff, 0x01,
+  0x9d, 0x01, 0x85, 0x00, 0x00, 0xfd, 0x8c, 0xff, 0x86, 0x00, 0x03, 0x42,
+  0x35, 0x00, 0x90, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0xbf, 0x86,
+  0x00, 0x09, 0x91, 0xec, 0xff, 0xff, 0x7c, 0x02, 0x00, 0x00, 0x30, 0xfe,
+  0x8e, 0xff, 0x00, 0xef, 0x88, 0x00, 0x00, 0x90, 0x84, 0xff, 0x00, 0x0b,
+  0x88, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x00, 0x09, 0x85, 0x00, 0x05, 0x10,
+  0xca, 0xff, 0xff, 0xcf, 0x27, 0x82, 0x00, 0x00, 0xf3, 0x82, 0xff, 0x00,
+  0xcf, 0x85, 0x00, 0x04, 0x10, 0xfa, 0xff, 0xdf, 0x06, 0x86, 0x00, 0x00,
+  0xc1, 0x84, 0xff, 0x86, 0x00, 0x03, 0x52, 0x35, 0x00, 0x90, 0x82, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x83, 0xff, 0x00, 0x9f, 0x86, 0x00, 0x08, 0xa1, 0xec, 0xff,
+  0xff, 0x7c, 0x02, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x8b, 0xff, 0x00, 0x2f, 0x85, 0x00, 0x00, 0xf8, 0xf1, 0xff, 0x00, 0x08,
+  0x87, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x5f, 0x88, 0x00, 0x00, 0xf0,
+  0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b,
+  0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0a, 0x86, 0x00, 0x01, 0x42,
+  0x03, 0x88, 0x00, 0x00, 0xd5, 0x83, 0xff, 0x00, 0x0b, 0x89, 0x00, 0x00,
+  0xf8, 0x8a, 0xff, 0x00, 0x06, 0x84, 0x00, 0x02, 0x10, 0x44, 0x14, 0x86,
+  0x00, 0x00, 0x60, 0x8d, 0xff, 0x00, 0x03, 0x88, 0x00, 0x04, 0x20, 0xfe,
+  0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x05, 0x87, 0x00, 0x01, 0x40, 0x01,
+  0x84, 0x00, 0x00, 0xf6, 0x8f, 0xff, 0x88, 0x00, 0x00, 0xb0, 0x84, 0xff,
+  0x00, 0x0d, 0x88, 0x00, 0x00, 0xf9, 0x85, 0xff, 0x00, 0x3f, 0x87, 0x00,
+  0x01, 0x10, 0x04, 0x84, 0x00, 0x00, 0x60, 0x83, 0xff, 0x87, 0x00, 0x01,
+  0x44, 0x01, 0x87, 0x00, 0x01, 0x20, 0xfa, 0x83, 0xff, 0x00, 0x03, 0x88,
+  0x00, 0x00, 0x20, 0x82, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x03, 0x87,
+  0x00, 0x01, 0x40, 0x01, 0x84, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00, 0x7f,
+  0x85, 0x00, 0x8b, 0xff, 0x00, 0x0e, 0x85, 0x00, 0x00, 0xf4, 0xf1, 0xff,
+  0x00, 0x0b, 0x87, 0x00, 0x00, 0x50, 0x84, 0xff, 0x00, 0x7f, 0x88, 0x00,
+  0x00, 0xf3, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x00, 0x0e, 0x91, 0x00,
+  0x00, 0xa0, 0x83, 0xff, 0x00, 0x1f, 0x89, 0x00, 0x00, 0xe1, 0x89, 0xff,
+  0x00, 0x9f, 0x8f, 0x00, 0x00, 0xe0, 0x8d, 0xff, 0x00, 0x09, 0x89, 0x00,
+  0x03, 0xf7, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x1e, 0x8e, 0x00, 0x00,
+  0x90, 0x8f, 0xff, 0x00, 0x03, 0x87, 0x00, 0x00, 0xf0, 0x84, 0xff, 0x00,
+  0x0f, 0x88, 0x00, 0x00, 0xfc, 0x85, 0xff, 0x00, 0xef, 0x8f, 0x00, 0x00,
+  0xfa, 0x82, 0xff, 0x00, 0x05, 0x91, 0x00, 0x00, 0xf2, 0x83, 0xff, 0x00,
+  0x09, 0x89, 0x00, 0x03, 0xf8, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0e,
+  0x8e, 0x00, 0x00, 0xa0, 0x83, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8b, 0xff,
+  0x00, 0x0b, 0x85, 0x00, 0x00, 0xf2, 0xf1, 0xff, 0x00, 0x0d, 0x87, 0x00,
+  0x00, 0x70, 0x84, 0xff, 0x00, 0xbf, 0x88, 0x00, 0x00, 0xf5, 0x85, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x82, 0xff, 0x00, 0x7f, 0x91, 0x00, 0x00, 0xf0, 0x83, 0xff,
+  0x00, 0x7f, 0x89, 0x00, 0x00, 0x70, 0x89, 0xff, 0x00, 0x09, 0x8f, 0x00,
+  0x00, 0xf7, 0x8d, 0xff, 0x00, 0x0e, 0x89, 0x00, 0x03, 0xe1, 0xff, 0xff,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0xcf, 0x8e, 0x00, 0x01, 0x10, 0xfc, 0x8e, 0xff,
+  0x00, 0x05, 0x87, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x00, 0x3f, 0x88, 0x00,
+  0x87, 0xff, 0x00, 0x0a, 0x8e, 0x00, 0x00, 0xe1, 0x82, 0xff, 0x00, 0x0d,
+  0x91, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x00, 0x0e, 0x89, 0x00, 0x03, 0xe1,
+  0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0xaf, 0x8e, 0x00, 0x01, 0x10, 0xfe,
+  0x82, 0xff, 0x00, 0x7f, 0x85, 0x00, 0x8b, 0xff, 0x00, 0x0a, 0x85, 0x00,
+  0x00, 0xf0, 0xf1, 0xff, 0x00, 0x0f, 0x87, 0x00, 0x00, 0xb0, 0x84, 0xff,
+  0x00, 0xdf, 0x88, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff,
+  0x00, 0xef, 0x8b, 0x00, 0x00, 0x0a, 0x84, 0x00, 0x00, 0xf4, 0x83, 0xff,
+  0x00, 0xef, 0x89, 0x00, 0x01, 0x10, 0xfe, 0x88, 0xff, 0x00, 0x0b, 0x8e,
+  0x00, 0x00, 0x50, 0x8e, 0xff, 0x00, 0x7f, 0x89, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x85, 0xff, 0x00, 0x09, 0x8e, 0x00, 0x00, 0xf8, 0x8e, 0xff,
+  0x00, 0x07, 0x87, 0x00, 0x00, 0xf4, 0x84, 0xff, 0x00, 0x5f, 0x87, 0x00,
+  0x00, 0x20, 0x87, 0xff, 0x00, 0x9f, 0x8e, 0x00, 0x00, 0x90, 0x82, 0xff,
+  0x00, 0x6f, 0x8a, 0x00, 0x01, 0x50, 0x06, 0x84, 0x00, 0x00, 0xfd, 0x83,
+  0xff, 0x00, 0x7f, 0x89, 0x00, 0x03, 0x70, 0xff, 0xff, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x85, 0xff,
+  0x00, 0x09, 0x8e, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x8b, 0xff, 0x00, 0x0d, 0x85, 0x00, 0x00, 0xf3, 0xf1, 0xff, 0x00, 0x3f,
+  0x87, 0x00, 0x00, 0xe0, 0x85, 0xff, 0x88, 0x00, 0x00, 0xfb, 0x85, 0xff,
+  0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00,
+  0x00, 0x70, 0x83, 0xff, 0x00, 0x0c, 0x89, 0x00, 0x01, 0x90, 0x8f, 0x84,
+  0x00, 0x00, 0xf9, 0x84, 0xff, 0x00, 0x0a, 0x89, 0x00, 0x00, 0xf5, 0x88,
+  0xff, 0x01, 0xef, 0x03, 0x8d, 0x00, 0x00, 0xf5, 0x8f, 0xff, 0x00, 0x02,
+  0x89, 0x00, 0x02, 0xfd, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff,
+  0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0xbf, 0x8d, 0x00,
+  0x00, 0xa0, 0x8f, 0xff, 0x00, 0x0b, 0x87, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x00, 0x7f, 0x87, 0x00, 0x00, 0x40, 0x88, 0xff, 0x00, 0x09, 0x8c, 0x00,
+  0x01, 0x10, 0xfb, 0x83, 0xff, 0x00, 0x02, 0x89, 0x00, 0x01, 0xe2, 0x0e,
+  0x83, 0x00, 0x00, 0x20, 0x85, 0xff, 0x00, 0x02, 0x88, 0x00, 0x03, 0x10,
+  0xfe, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x85, 0xff, 0x00, 0x9f, 0x8d, 0x00, 0x00, 0xb1, 0x83,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x8b, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x00,
+  0xf7, 0xf1, 0xff, 0x00, 0x5f, 0x87, 0x00, 0x00, 0xf0, 0x85, 0xff, 0x00,
+  0x03, 0x87, 0x00, 0x00, 0xfd, 0x85, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x83, 0xff, 0x00,
+  0x9f, 0x89, 0x00, 0x02, 0xf7, 0xff, 0x03, 0x83, 0x00, 0x00, 0xfe, 0x84,
+  0xff, 0x00, 0x5f, 0x89, 0x00, 0x00, 0xd0, 0x89, 0xff, 0x00, 0x7f, 0x8c,
+  0x00, 0x00, 0x90, 0x90, 0xff, 0x00, 0x0d, 0x89, 0x00, 0x02, 0xf5, 0xff,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x86, 0xff, 0x00, 0x0c, 0x8b, 0x00, 0x01, 0x40, 0xfe, 0x8f, 0xff,
+  0x00, 0x0d, 0x87, 0x00, 0x00, 0xfa, 0x84, 0xff, 0x00, 0xbf, 0x87, 0x00,
+  0x00, 0x70, 0x88, 0xff, 0x00, 0xcf, 0x8c, 0x00, 0x00, 0xe6, 0x84, 0xff,
+  0x00, 0x2e, 0x88, 0x00, 0x02, 0x20, 0xfe, 0xaf, 0x83, 0x00, 0x00, 0x80,
+  0x85, 0xff, 0x00, 0x0c, 0x89, 0x00, 0x02, 0xf7, 0xff, 0x0f, 0x84, 0x00,
+  0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x86, 0xff,
+  0x00, 0x0c, 0x8b, 0x00, 0x01, 0x60, 0xfe, 0x83, 0xff, 0x00, 0x7f, 0x85,
+  0x00, 0x8b, 0xff, 0x00, 0x8f, 0x85, 0x00, 0x00, 0xfd, 0xf1, 0xff, 0x00,
+  0x7f, 0x87, 0x00, 0x00, 0xf3, 0x85, 0xff, 0x00, 0x05, 0x87, 0x00, 0x86,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x00, 0x0b, 0x87, 0x00, 0x03, 0xa0, 0xff,
+  0xff, 0x5f, 0x82, 0x00, 0x00, 0x40, 0x86, 0xff, 0x00, 0x08, 0x88, 0x00,
+  0x00, 0xe7, 0x8a, 0xff, 0x00, 0x7e, 0x8a, 0x00, 0x01, 0x50, 0xfd, 0x90,
+  0xff, 0x01, 0xef, 0x02, 0x87, 0x00, 0x03, 0x30, 0xfb, 0xff, 0x0f, 0x84,
+  0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x86,
+  0xff, 0x01, 0xef, 0x07, 0x89, 0x00, 0x01, 0x30, 0xfb, 0x90, 0xff, 0x00,
+  0x0f, 0x87, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x00, 0xcf, 0x87, 0x00, 0x00,
+  0xa0, 0x89, 0xff, 0x00, 0x6e, 0x8a, 0x00, 0x00, 0xc5, 0x85, 0xff, 0x01,
+  0xef, 0x03, 0x87, 0x00, 0x03, 0xe5, 0xff, 0xff, 0x0b, 0x82, 0x00, 0x00,
+  0xd0, 0x85, 0xff, 0x01, 0xdf, 0x02, 0x87, 0x00, 0x03, 0x30, 0xfc, 0xff,
+  0x0f, 0x84, 0x00, 0x00, 0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x86, 0xff, 0x01, 0xef, 0x06, 0x89, 0x00, 0x01, 0x50, 0xfb, 0x84,
+  0xff, 0x00, 0x7f, 0x85, 0x00, 0x8c, 0xff, 0x00, 0x04, 0x83, 0x00, 0x00,
+  0xa0, 0xf2, 0xff, 0x00, 0xbf, 0x87, 0x00, 0x00, 0xf6, 0x85, 0xff, 0x00,
+  0x07, 0x86, 0x00, 0x00, 0x30, 0x86, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00,
+  0x70, 0x84, 0xff, 0x00, 0x0b, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x01,
+  0xdf, 0x05, 0x85, 0x00, 0x01, 0x50, 0xfe, 0x82, 0xff, 0x03, 0x2a, 0x00,
+  0x00, 0x90, 0x86, 0xff, 0x01, 0xbf, 0x03, 0x86, 0x00, 0x00, 0xd6, 0x8c,
+  0xff, 0x01, 0x7e, 0x02, 0x87, 0x00, 0x01, 0x40, 0xfd, 0x92, 0xff, 0x00,
+  0x7e, 0x86, 0x00, 0x04, 0x30, 0xf9, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x00,
+  0x30, 0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x87, 0xff, 0x01,
+  0xef, 0x06, 0x87, 0x00, 0x01, 0x50, 0xfd, 0x91, 0xff, 0x00, 0x3f, 0x87,
+  0x00, 0x86, 0xff, 0x87, 0x00, 0x00, 0xc0, 0x8a, 0xff, 0x00, 0x5d, 0x88,
+  0x00, 0x00, 0xd5, 0x87, 0xff, 0x01, 0x8f, 0x01, 0x85, 0x00, 0x00, 0xa1,
+  0x82, 0xff, 0x04, 0xcf, 0x05, 0x00, 0x00, 0xf2, 0x86, 0xff, 0x00, 0x7e,
+  0x86, 0x00, 0x04, 0x40, 0xfa, 0xff, 0xff, 0x0f, 0x84, 0x00, 0x00, 0x30,
+  0x84, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x00, 0x30, 0x87, 0xff, 0x01, 0xdf,
+  0x05, 0x87, 0x00, 0x01, 0x50, 0xfd, 0x85, 0xff, 0x00, 0x7f, 0x85, 0x00,
+  0x8c, 0xff, 0x00, 0x4e, 0x83, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xab, 0xff,
+  0x01, 0xdf, 0x26, 0x83, 0x00, 0x01, 0x82, 0xfd, 0x84, 0xff, 0x02, 0x7c,
+  0x13, 0xd0, 0x87, 0xff, 0x01, 0xbf, 0x15, 0x83, 0x00, 0x01, 0x52, 0xfa,
+  0x8e, 0xff, 0x02, 0xdf, 0x59, 0x01, 0x83, 0x00, 0x01, 0x20, 0xb6, 0x95,
+  0xff, 0x01, 0x8e, 0x04, 0x83, 0x00, 0x01, 0x83, 0xfd, 0x9f, 0xff, 0x01,
+  0x7b, 0x02, 0x83, 0x00, 0x01, 0x20, 0xa6, 0xb8, 0xff, 0x01, 0xaf, 0x26,
+  0x84, 0x00, 0x01, 0x73, 0xfb, 0x89, 0xff, 0x01, 0x9f, 0x04, 0x83, 0x00,
+  0x00, 0xc5, 0x84, 0xff, 0x03, 0xef, 0x59, 0x03, 0xf8, 0x87, 0xff, 0x01,
+  0x8e, 0x03, 0x83, 0x00, 0x01, 0x84, 0xfd, 0x9f, 0xff, 0x01, 0x6b, 0x02,
+  0x83, 0x00, 0x01, 0x20, 0xb6, 0x9c, 0xff, 0x03, 0x08, 0x00, 0x00, 0xc1,
+  0xff, 0xff, 0xae, 0xff, 0x03, 0xbe, 0x9b, 0xbb, 0xfd, 0x93, 0xff, 0x03,
+  0xbd, 0x9b, 0xbb, 0xfb, 0x93, 0xff, 0x03, 0xbd, 0x9b, 0xba, 0xeb, 0x99,
+  0xff, 0x03, 0xbb, 0x8b, 0xbb, 0xfc, 0xa3, 0xff, 0x03, 0xbe, 0xbb, 0xb9,
+  0xdb, 0xbc, 0xff, 0x04, 0xef, 0xbb, 0xaa, 0xbb, 0xfe, 0x8d, 0xff, 0x02,
+  0xbc, 0x9b, 0xbb, 0x94, 0xff, 0x03, 0xbb, 0x9b, 0xbb, 0xfd, 0xa3, 0xff,
+  0x03, 0xbe, 0xbb, 0xb9, 0xdb, 0x9f, 0xff, 0x01, 0xad, 0xeb, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xff, 0x01, 0x6b, 0xb6, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xdc, 0xff, 0x03, 0xbf, 0x33, 0x33, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x03, 0x7f, 0x33, 0x33,
+  0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x03, 0x6f, 0x33,
+  0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x03, 0x6f,
+  0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0x03,
+  0x6f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb,
+  0xff, 0x03, 0x6f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xdb, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xd1, 0xff, 0x00, 0xfe, 0x88, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf6,
+  0x88, 0xff, 0x00, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0xff,
+  0x01, 0x9c, 0xfd, 0xbf, 0xff, 0x02, 0x5f, 0x33, 0xf6, 0x87, 0xff, 0x03,
+  0x8f, 0x33, 0x33, 0xf7, 0x87, 0xff, 0x02, 0x9f, 0x33, 0xd5, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0x02, 0x7f, 0x33, 0x83, 0xbf, 0xff,
+  0x02, 0x37, 0x33, 0x53, 0x87, 0xff, 0x03, 0xdf, 0x33, 0x33, 0xfc, 0x87,
+  0xff, 0x02, 0x38, 0x33, 0x73, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82,
+  0xff, 0x03, 0x3c, 0x33, 0x33, 0xfe, 0xbe, 0xff, 0x82, 0x33, 0x00, 0xf8,
+  0x87, 0xff, 0x01, 0x9d, 0xd9, 0x87, 0xff, 0x00, 0x8f, 0x82, 0x33, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0x03, 0x3a, 0x33, 0x33, 0xfc,
+  0xbe, 0xff, 0x03, 0x35, 0x33, 0x33, 0xb3, 0x91, 0xff, 0x03, 0x38, 0x33,
+  0x33, 0x53, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0x03, 0x39,
+  0x33, 0x33, 0xfc, 0xbe, 0xff, 0x03, 0x3b, 0x33, 0x33, 0x63, 0x90, 0xff,
+  0x00, 0x5f, 0x82, 0x33, 0x00, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x82, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xbe, 0xff, 0x03, 0xbf, 0x33,
+  0x33, 0x73, 0x90, 0xff, 0x00, 0x36, 0x82, 0x33, 0x00, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x82, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xbf,
+  0xff, 0x02, 0x3b, 0x33, 0xd3, 0x8f, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00,
+  0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0x03, 0x39, 0x33,
+  0x33, 0xfc, 0xbf, 0xff, 0x02, 0xef, 0x78, 0xfd, 0x8f, 0xff, 0x00, 0xcf,
+  0x82, 0x33, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
+  0x03, 0x39, 0x33, 0x33, 0xfc, 0xc9, 0xff, 0x03, 0x9c, 0x79, 0x97, 0xc9,
+  0x84, 0xff, 0x03, 0xef, 0x33, 0x33, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x84, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xc7, 0xff, 0x01, 0xbf,
+  0x37, 0x83, 0x33, 0x01, 0x73, 0xfb, 0x83, 0xff, 0x02, 0x39, 0x33, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x02, 0x5b, 0x73, 0xfe, 0x87, 0xff,
+  0x03, 0x3b, 0x33, 0x33, 0xfc, 0x87, 0xff, 0x02, 0x5d, 0x73, 0xfd, 0xbb,
+  0xff, 0x01, 0xcf, 0x34, 0x85, 0x33, 0x01, 0x43, 0xfb, 0x82, 0xff, 0x01,
+  0xef, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0x03, 0xef, 0x33, 0x33,
+  0xd4, 0x87, 0xff, 0x02, 0x3f, 0x33, 0x53, 0x87, 0xff, 0x03, 0xdf, 0x34,
+  0x33, 0xf4, 0xbb, 0xff, 0x00, 0x36, 0x87, 0x33, 0x01, 0x53, 0xfd, 0xc1,
+  0xff, 0x03, 0xef, 0xcc, 0x99, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xff,
+  0x04, 0x9f, 0x33, 0x33, 0x43, 0xfd, 0x86, 0xff, 0x02, 0xdf, 0x67, 0xf7,
+  0x87, 0xff, 0x03, 0x4d, 0x33, 0x33, 0xc3, 0xb2, 0xff, 0x08, 0xad, 0x67,
+  0x34, 0x53, 0x86, 0xd9, 0xff, 0xff, 0x4d, 0x89, 0x33, 0x00, 0xb4, 0xc0,
+  0xff, 0x01, 0xae, 0x35, 0x82, 0x33, 0x01, 0x53, 0xfa, 0xb8, 0xff, 0x05,
+  0xad, 0x67, 0x34, 0x43, 0x66, 0xc9, 0xbd, 0xff, 0x06, 0xcf, 0x69, 0x34,
+  0x33, 0x33, 0x86, 0xfb, 0xbd, 0xff, 0x05, 0xad, 0x67, 0x34, 0x43, 0x66,
+  0xc9, 0xed, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x00, 0xd4, 0x90, 0xff, 0x04,
+  0xdf, 0x34, 0x33, 0x33, 0xd3, 0xb0, 0xff, 0x01, 0xef, 0x49, 0x85, 0x33,
+  0x02, 0xa5, 0xdf, 0x34, 0x8a, 0x33, 0x00, 0xfb, 0xbe, 0xff, 0x00, 0x8f,
+  0x85, 0x33, 0x01, 0x43, 0xf9, 0xb6, 0xff, 0x00, 0x4a, 0x85, 0x33, 0x01,
+  0x83, 0xfe, 0xba, 0xff, 0x01, 0x9f, 0x34, 0x85, 0x33, 0x00, 0xc7, 0xbb,
+  0xff, 0x00, 0x4a, 0x85, 0x33, 0x01, 0x83, 0xfe, 0xec, 0xff, 0x82, 0x33,
+  0x01, 0x43, 0xfd, 0x8f, 0xff, 0x00, 0x4d, 0x82, 0x33, 0x00, 0xf6, 0xb0,
+  0xff, 0x00, 0x38, 0x87, 0x33, 0x00, 0x43, 0x82, 0x33, 0x05, 0x43, 0xb8,
+  0xfe, 0xef, 0x8c, 0x34, 0x82, 0x33, 0x00, 0xb3, 0xbd, 0xff, 0x01, 0xbf,
+  0x34, 0x86, 0x33, 0x01, 0x53, 0xfd, 0xb4, 0xff, 0x00, 0x49, 0x87, 0x33,
+  0x01, 0x63, 0xfe, 0xb8, 0xff, 0x00, 0x8f, 0x88, 0x33, 0x00, 0xd6, 0xb9,
+  0xff, 0x00, 0x49, 0x87, 0x33, 0x01, 0x63, 0xfe, 0xeb, 0xff, 0x00, 0x3d,
+  0x82, 0x33, 0x00, 0xf4, 0x8e, 0xff, 0x04, 0xdf, 0x34, 0x33, 0x33, 0x53,
+  0xb0, 0xff, 0x00, 0x4b, 0x8b, 0x33, 0x01, 0x43, 0xfb, 0x83, 0xff, 0x05,
+  0xbf, 0x34, 0x33, 0x33, 0x43, 0xfe, 0xbc, 0xff, 0x00, 0x3b, 0x88, 0x33,
+  0x00, 0xd4, 0xb3, 0xff, 0x00, 0x4c, 0x89, 0x33, 0x00, 0x94, 0xb7, 0xff,
+  0x01, 0xcf, 0x34, 0x89, 0x33, 0x00, 0xf9, 0xb7, 0xff, 0x00, 0x4c, 0x89,
+  0x33, 0x00, 0x94, 0xeb, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00, 0x73, 0x8e,
+  0xff, 0x00, 0x6f, 0x82, 0x33, 0x00, 0xf5, 0xaf, 0xff, 0x00, 0x8f, 0x8c,
+  0x33, 0x00, 0xf6, 0x85, 0xff, 0x00, 0x7f, 0x82, 0x33, 0x00, 0xf6, 0xbb,
+  0xff, 0x00, 0xbf, 0x83, 0x33, 0x02, 0x86, 0xbb, 0x68, 0x83, 0x33, 0x00,
+  0xfb, 0xb1, 0xff, 0x00, 0x8f, 0x8b, 0x33, 0x00, 0xf5, 0xb6, 0xff, 0x00,
+  0x38, 0x8a, 0x33, 0x00, 0x53, 0xb6, 0xff, 0x00, 0x8f, 0x8b, 0x33, 0x00,
+  0xf5, 0xeb, 0xff, 0x00, 0x3d, 0x82, 0x33, 0x8e, 0xff, 0x03, 0x3f, 0x33,
+  0x33, 0x53, 0xb0, 0xff, 0x00, 0x38, 0x83, 0x33, 0x03, 0x53, 0x76, 0x67,
+  0x36, 0x83, 0x33, 0x00, 0x43, 0x87, 0xff, 0x03, 0x37, 0x33, 0x33, 0xc3,
+  0xbb, 0xff, 0x04, 0xbf, 0x34, 0x33, 0x33, 0xf9, 0x82, 0xff, 0x00, 0xaf,
+  0x82, 0x33, 0x00, 0xd4, 0xb1, 0xff, 0x00, 0x38, 0x83, 0x33, 0x03, 0x43,
+  0x66, 0x67, 0x36, 0x83, 0x33, 0x00, 0x53, 0xb5, 0xff, 0x00, 0x8f, 0x84,
+  0x33, 0x03, 0x76, 0x99, 0x68, 0x34, 0x83, 0x33, 0x00, 0xf5, 0xb5, 0xff,
+  0x00, 0x38, 0x83, 0x33, 0x03, 0x43, 0x66, 0x67, 0x36, 0x83, 0x33, 0x00,
+  0x53, 0xeb, 0xff, 0x03, 0xdf, 0x33, 0x33, 0x53, 0x85, 0xff, 0x03, 0xce,
+  0x9b, 0xca, 0xfc, 0x84, 0xff, 0x03, 0x4f, 0x33, 0x33, 0xf5, 0xaf, 0xff,
+  0x00, 0x8f, 0x83, 0x33, 0x01, 0xb6, 0xfe, 0x82, 0xff, 0x00, 0x7b, 0x83,
+  0x33, 0x00, 0xf6, 0x86, 0xff, 0x03, 0x7f, 0x33, 0x33, 0x53, 0xb7, 0xff,
+  0x07, 0xce, 0xcc, 0xfc, 0xff, 0xff, 0xbf, 0x34, 0xd5, 0x84, 0xff, 0x03,
+  0x7e, 0x33, 0x33, 0x53, 0xb0, 0xff, 0x00, 0x8f, 0x83, 0x33, 0x01, 0xb6,
+  0xfe, 0x82, 0xff, 0x00, 0x7b, 0x83, 0x33, 0x00, 0xf5, 0xb4, 0xff, 0x00,
+  0x38, 0x82, 0x33, 0x01, 0x63, 0xfb, 0x82, 0xff, 0x01, 0xdf, 0x39, 0x82,
+  0x33, 0x00, 0x43, 0xb4, 0xff, 0x00, 0x8f, 0x83, 0x33, 0x01, 0xb6, 0xfe,
+  0x82, 0xff, 0x00, 0x7b, 0x83, 0x33, 0x00, 0xf5, 0xeb, 0xff, 0x02, 0x4d,
+  0x33, 0xb3, 0x83, 0xff, 0x01, 0xcf, 0x36, 0x82, 0x33, 0x01, 0x43, 0xc8,
+  0x83, 0xff, 0x02, 0xbf, 0x33, 0x63, 0xb0, 0xff, 0x00, 0x39, 0x82, 0x33,
+  0x00, 0xc5, 0x85, 0xff, 0x00, 0x7e, 0x82, 0x33, 0x00, 0x93, 0x87, 0xff,
+  0x82, 0x33, 0x00, 0xfc, 0xb4, 0xff, 0x01, 0x9e, 0x36, 0x82, 0x33, 0x03,
+  0x84, 0xfc, 0xff, 0xcf, 0x86, 0xff, 0x03, 0x37, 0x33, 0x33, 0xfb, 0xaf,
+  0xff, 0x00, 0x3a, 0x82, 0x33, 0x00, 0xc5, 0x85, 0xff, 0x00, 0x7e, 0x82,
+  0x33, 0x00, 0x63, 0xb3, 0xff, 0x00, 0xaf, 0x82, 0x33, 0x01, 0x53, 0xfc,
+  0x85, 0xff, 0x00, 0x39, 0x82, 0x33, 0x00, 0xf5, 0xb3, 0xff, 0x00, 0x3a,
+  0x82, 0x33, 0x00, 0xb4, 0x85, 0xff, 0x00, 0x7e, 0x82, 0x33, 0x00, 0x63,
+  0xec, 0xff, 0x01, 0xab, 0xfe, 0x82, 0xff, 0x01, 0xaf, 0x34, 0x85, 0x33,
+  0x00, 0xb4, 0x83, 0xff, 0x01, 0x9d, 0xfb, 0xaf, 0xff, 0x00, 0xcf, 0x82,
+  0x33, 0x00, 0x73, 0x87, 0xff, 0x00, 0x3b, 0x82, 0x33, 0x00, 0xfb, 0x86,
+  0xff, 0x03, 0x39, 0x33, 0x33, 0xf8, 0xb3, 0xff, 0x00, 0x6c, 0x85, 0x33,
+  0x01, 0x43, 0xfb, 0x87, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xf4, 0xae, 0xff,
+  0x00, 0xdf, 0x82, 0x33, 0x00, 0x73, 0x87, 0xff, 0x00, 0x3b, 0x82, 0x33,
+  0x00, 0xf9, 0xb2, 0xff, 0x00, 0x3d, 0x82, 0x33, 0x00, 0xf8, 0x86, 0xff,
+  0x00, 0xdf, 0x82, 0x33, 0x00, 0x83, 0xb2, 0xff, 0x00, 0xdf, 0x82, 0x33,
+  0x00, 0x73, 0x87, 0xff, 0x00, 0x3b, 0x82, 0x33, 0x00, 0xf9, 0xef, 0xff,
+  0x01, 0xdf, 0x34, 0x87, 0x33, 0x00, 0xd6, 0xb4, 0xff, 0x00, 0x4f, 0x82,
+  0x33, 0x00, 0xfb, 0x87, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00, 0xe4, 0x86,
+  0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4, 0xb2, 0xff, 0x00, 0x8f, 0x87, 0x33,
+  0x01, 0x53, 0xfd, 0x86, 0xff, 0x03, 0xdf, 0x33, 0x33, 0xb3, 0xae, 0xff,
+  0x00, 0x4f, 0x82, 0x33, 0x00, 0xfb, 0x87, 0xff, 0x00, 0xdf, 0x82, 0x33,
+  0x00, 0xe3, 0xb2, 0xff, 0x03, 0x34, 0x33, 0x33, 0xb3, 0x88, 0xff, 0x00,
+  0x5f, 0x82, 0x33, 0x00, 0xfc, 0xb1, 0xff, 0x00, 0x4f, 0x82, 0x33, 0x00,
+  0xf8, 0x87, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00, 0xe3, 0xef, 0xff, 0x00,
+  0x3a, 0x88, 0x33, 0x01, 0x43, 0xfb, 0xb3, 0xff, 0x03, 0x3b, 0x33, 0x33,
+  0xb3, 0x89, 0xff, 0x03, 0x3d, 0x33, 0x33, 0x73, 0x86, 0xff, 0x03, 0x7f,
+  0x33, 0x33, 0xd3, 0xb1, 0xff, 0x01, 0xdf, 0x34, 0x88, 0x33, 0x00, 0xb3,
+  0x87, 0xff, 0x02, 0x37, 0x33, 0x73, 0xae, 0xff, 0x03, 0x3b, 0x33, 0x33,
+  0x93, 0x89, 0xff, 0x03, 0x3d, 0x33, 0x33, 0x73, 0xb1, 0xff, 0x00, 0xbf,
+  0x82, 0x33, 0x00, 0xfa, 0x89, 0xff, 0x82, 0x33, 0x00, 0xf6, 0xb1, 0xff,
+  0x03, 0x3b, 0x33, 0x33, 0x73, 0x89, 0xff, 0x03, 0x3d, 0x33, 0x33, 0x73,
+  0xee, 0xff, 0x00, 0x7f, 0x8a, 0x33, 0x00, 0x83, 0xb3, 0xff, 0x03, 0x34,
+  0x33, 0x33, 0xf7, 0x89, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x86, 0xff, 0x03,
+  0x9f, 0x33, 0x33, 0xc3, 0x82, 0xff, 0x00, 0x49, 0x82, 0x33, 0x01, 0x43,
+  0xfb, 0xa8, 0xff, 0x00, 0x4d, 0x83, 0x33, 0x02, 0x64, 0x79, 0x35, 0x83,
+  0x33, 0x00, 0xf9, 0x86, 0xff, 0x00, 0x3b, 0x82, 0x33, 0x01, 0x74, 0xfb,
+  0xab, 0xff, 0x03, 0x34, 0x33, 0x33, 0xf7, 0x89, 0xff, 0x00, 0xcf, 0x82,
+  0x33, 0x00, 0xfc, 0xb0, 0xff, 0x03, 0x4f, 0x33, 0x33, 0x73, 0x8a, 0xff,
+  0x03, 0x3d, 0x33, 0x33, 0xb3, 0xb1, 0xff, 0x03, 0x34, 0x33, 0x33, 0xf7,
+  0x89, 0xff, 0x00, 0xcf, 0x82, 0x33, 0x00, 0xfc, 0xed, 0xff, 0x00, 0x38,
+  0x83, 0x33, 0x03, 0x97, 0xcb, 0x9a, 0x37, 0x83, 0x33, 0x00, 0xfb, 0xb1,
+  0xff, 0x00, 0xbf, 0x82, 0x33, 0x8b, 0xff, 0x03, 0x36, 0x33, 0x33, 0xfa,
+  0x85, 0xff, 0x06, 0xcf, 0x33, 0x33, 0xb3, 0xff, 0xff, 0xaf, 0x84, 0x33,
+  0x00, 0xc3, 0xa7, 0xff, 0x05, 0xdf, 0x34, 0x33, 0x33, 0x63, 0xfb, 0x82,
+  0xff, 0x00, 0x9d, 0x82, 0x33, 0x00, 0x93, 0x86, 0xff, 0x00, 0x3f, 0x83,
+  0x33, 0x01, 0x43, 0xfa, 0xa9, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x00, 0xfe,
+  0x8a, 0xff, 0x03, 0x37, 0x33, 0x33, 0xf7, 0xb0, 0xff, 0x03, 0x3b, 0x33,
+  0x33, 0xe3, 0x8a, 0xff, 0x03, 0x9f, 0x33, 0x33, 0x73, 0xb0, 0xff, 0x00,
+  0xbf, 0x82, 0x33, 0x00, 0xfe, 0x8a, 0xff, 0x03, 0x37, 0x33, 0x33, 0xf7,
+  0xec, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x01, 0x43, 0xfb, 0x83, 0xff, 0x00,
+  0x39, 0x82, 0x33, 0x00, 0xd3, 0xb1, 0xff, 0x03, 0x7f, 0x33, 0x33, 0xa3,
+  0x8b, 0xff, 0x03, 0x3e, 0x33, 0x33, 0xf5, 0x85, 0xff, 0x06, 0xcf, 0x33,
+  0x33, 0x93, 0xff, 0xff, 0x6f, 0x84, 0x33, 0x00, 0x93, 0xa7, 0xff, 0x00,
+  0x4f, 0x82, 0x33, 0x00, 0xfb, 0x84, 0xff, 0x00, 0x6e, 0x82, 0x33, 0x00,
+  0xfb, 0x85, 0xff, 0x00, 0x6f, 0x84, 0x33, 0x00, 0x53, 0xa9, 0xff, 0x03,
+  0x7f, 0x33, 0x33, 0x93, 0x8b, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4, 0xb0,
+  0xff, 0x03, 0x37, 0x33, 0x33, 0xf9, 0x8b, 0xff, 0x82, 0x33, 0xb0, 0xff,
+  0x03, 0x7f, 0x33, 0x33, 0x93, 0x8b, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4,
+  0xec, 0xff, 0x00, 0x4e, 0x82, 0x33, 0x00, 0xf8, 0x85, 0xff, 0x03, 0x37,
+  0x33, 0x33, 0x43, 0xb1, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf3, 0x8b, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0xd3, 0x85, 0xff, 0x06, 0xcf, 0x33, 0x33, 0x93,
+  0xff, 0xff, 0x7f, 0x84, 0x33, 0x00, 0x93, 0xa7, 0xff, 0x03, 0x37, 0x33,
+  0x33, 0xf7, 0x86, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xe4, 0x85, 0xff, 0x00,
+  0x8f, 0x85, 0x33, 0x00, 0xd4, 0xa8, 0xff, 0x03, 0x4f, 0x33, 0x33, 0xe3,
+  0x8b, 0xff, 0x03, 0x7f, 0x33, 0x33, 0xb3, 0xb0, 0xff, 0x03, 0x34, 0x33,
+  0x33, 0xfe, 0x8b, 0xff, 0x03, 0x38, 0x33, 0x33, 0xfa, 0xaf, 0xff, 0x03,
+  0x4f, 0x33, 0x33, 0xf3, 0x8b, 0xff, 0x03, 0x7f, 0x33, 0x33, 0xb3, 0xec,
+  0xff, 0x03, 0x36, 0x33, 0x33, 0xb3, 0x86, 0xff, 0x00, 0x7f, 0x82, 0x33,
+  0x00, 0xf9, 0xaf, 0xff, 0x04, 0xef, 0x38, 0x33, 0x33, 0xf7, 0x8b, 0xff,
+  0x06, 0xbf, 0x33, 0x33, 0x43, 0x66, 0x98, 0xfc, 0x82, 0xff, 0x06, 0x9f,
+  0x33, 0x33, 0xb3, 0xff, 0xff, 0xdf, 0x84, 0x33, 0x00, 0xf3, 0xa6, 0xff,
+  0x03, 0xcf, 0x33, 0x33, 0x73, 0x87, 0xff, 0x03, 0xaf, 0x33, 0x33, 0x73,
+  0x85, 0xff, 0x03, 0xbf, 0x66, 0x66, 0x35, 0x82, 0x33, 0x00, 0x43, 0xa7,
+  0xff, 0x04, 0xef, 0x38, 0x33, 0x33, 0xf5, 0x8b, 0xff, 0x06, 0xbf, 0x33,
+  0x33, 0x43, 0x66, 0x99, 0xfc, 0xac, 0xff, 0x03, 0x8e, 0x33, 0x33, 0x63,
+  0x8c, 0xff, 0x00, 0x3d, 0x82, 0x33, 0x02, 0x64, 0x98, 0xfd, 0xab, 0xff,
+  0x04, 0xef, 0x38, 0x33, 0x33, 0xf7, 0x8b, 0xff, 0x06, 0xbf, 0x33, 0x33,
+  0x43, 0x66, 0x99, 0xfc, 0xe8, 0xff, 0x00, 0xef, 0x82, 0x33, 0x00, 0xfb,
+  0x87, 0xff, 0x03, 0x37, 0x33, 0x33, 0xf4, 0xae, 0xff, 0x01, 0xbf, 0x35,
+  0x82, 0x33, 0x00, 0xfb, 0x8b, 0xff, 0x00, 0xef, 0x85, 0x33, 0x06, 0xc7,
+  0xff, 0xff, 0x9f, 0x33, 0x33, 0xc3, 0x82, 0xff, 0x00, 0x9e, 0x83, 0x99,
+  0xa7, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf5, 0x88, 0xff, 0x03, 0x37, 0x33,
+  0x33, 0xfe, 0x88, 0xff, 0x00, 0x9c, 0x82, 0x33, 0x00, 0xf5, 0xa5, 0xff,
+  0x01, 0xbf, 0x35, 0x82, 0x33, 0x00, 0xf9, 0x8c, 0xff, 0x84, 0x33, 0x01,
+  0x43, 0xe8, 0xaa, 0xff, 0x00, 0x5b, 0x82, 0x33, 0x00, 0x93, 0x8c, 0xff,
+  0x00, 0x3f, 0x84, 0x33, 0x01, 0x53, 0xfb, 0xa9, 0xff, 0x01, 0xbf, 0x35,
+  0x82, 0x33, 0x00, 0xfa, 0x8c, 0xff, 0x84, 0x33, 0x01, 0x43, 0xe8, 0xe7,
+  0xff, 0x03, 0x7f, 0x33, 0x33, 0x73, 0x88, 0xff, 0x03, 0x6f, 0x33, 0x33,
+  0xa3, 0xad, 0xff, 0x01, 0xbf, 0x34, 0x83, 0x33, 0x00, 0xfd, 0x8c, 0xff,
+  0x86, 0x33, 0x05, 0xc6, 0xff, 0x4f, 0x33, 0x33, 0xe3, 0xaf, 0xff, 0x03,
+  0x3d, 0x33, 0x33, 0xfd, 0x88, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xf8, 0x89,
+  0xff, 0x03, 0x5d, 0x33, 0x33, 0xa3, 0xa4, 0xff, 0x01, 0xcf, 0x34, 0x83,
+  0x33, 0x00, 0xfb, 0x8c, 0xff, 0x00, 0x35, 0x85, 0x33, 0x00, 0xe6, 0xa8,
+  0xff, 0x00, 0x4c, 0x83, 0x33, 0x00, 0xb3, 0x8c, 0xff, 0x00, 0x6f, 0x85,
+  0x33, 0x01, 0x43, 0xfb, 0xa7, 0xff, 0x01, 0xcf, 0x36, 0x83, 0x33, 0x00,
+  0xfc, 0x8c, 0xff, 0x00, 0x35, 0x85, 0x33, 0x00, 0xe6, 0xe6, 0xff, 0x03,
+  0x4f, 0x33, 0x33, 0xf3, 0x88, 0xff, 0x03, 0xcf, 0x33, 0x33, 0x53, 0xad,
+  0xff, 0x00, 0x38, 0x84, 0x33, 0x8d, 0xff, 0x00, 0x36, 0x86, 0x33, 0x04,
+  0xfa, 0x3c, 0x33, 0x33, 0xf4, 0xaf, 0xff, 0x02, 0x38, 0x33, 0x73, 0x89,
+  0xff, 0x03, 0xbf, 0x33, 0x33, 0xf4, 0x8a, 0xff, 0x02, 0x35, 0x33, 0x43,
+  0xa4, 0xff, 0x00, 0x39, 0x84, 0x33, 0x00, 0xfd, 0x8c, 0xff, 0x00, 0x37,
+  0x85, 0x33, 0x01, 0x43, 0xfb, 0xa6, 0xff, 0x00, 0x9f, 0x84, 0x33, 0x00,
+  0xd3, 0x8c, 0xff, 0x00, 0x8f, 0x86, 0x33, 0x00, 0x83, 0xa7, 0xff, 0x00,
+  0x39, 0x84, 0x33, 0x8d, 0xff, 0x00, 0x37, 0x85, 0x33, 0x01, 0x43, 0xfb,
+  0xe5, 0xff, 0x03, 0x3a, 0x33, 0x33, 0xf8, 0x89, 0xff, 0x03, 0x37, 0x33,
+  0x33, 0xfe, 0xab, 0xff, 0x00, 0x5f, 0x84, 0x33, 0x00, 0x43, 0x8d, 0xff,
+  0x00, 0x37, 0x86, 0x33, 0x04, 0x83, 0x37, 0x33, 0x33, 0xf7, 0xaf, 0xff,
+  0x02, 0x34, 0x33, 0xc3, 0x8a, 0xff, 0x03, 0x33, 0x33, 0xb3, 0xcc, 0x89,
+  0xff, 0x03, 0x3d, 0x33, 0x33, 0xfb, 0xa2, 0xff, 0x00, 0x8f, 0x85, 0x33,
+  0x8d, 0xff, 0x00, 0x39, 0x86, 0x33, 0x00, 0x83, 0xa6, 0xff, 0x00, 0x38,
+  0x84, 0x33, 0x00, 0xf3, 0x8c, 0xff, 0x00, 0xaf, 0x87, 0x33, 0x00, 0xd5,
+  0xa5, 0xff, 0x00, 0x8f, 0x85, 0x33, 0x8d, 0xff, 0x00, 0x39, 0x86, 0x33,
+  0x00, 0x83, 0xe5, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfd, 0x89, 0xff, 0x03,
+  0x3b, 0x33, 0x33, 0xfa, 0xab, 0xff, 0x00, 0x36, 0x83, 0x33, 0x01, 0x53,
+  0x96, 0x8d, 0xff, 0x03, 0x6b, 0x66, 0x66, 0x36, 0x87, 0x33, 0x00, 0xfc,
+  0xae, 0xff, 0x03, 0x5b, 0x33, 0x33, 0xf3, 0x8a, 0xff, 0x00, 0x36, 0x82,
+  0x33, 0x01, 0x43, 0xc8, 0x87, 0xff, 0x03, 0xaf, 0x33, 0x33, 0xf7, 0xa2,
+  0xff, 0x00, 0x38, 0x83, 0x33, 0x01, 0x53, 0x86, 0x8d, 0xff, 0x03, 0x6c,
+  0x66, 0x66, 0x46, 0x84, 0x33, 0x00, 0xf7, 0xa4, 0xff, 0x00, 0x8f, 0x84,
+  0x33, 0x01, 0x75, 0xfb, 0x8c, 0xff, 0x00, 0xdf, 0x82, 0x66, 0x00, 0x34,
+  0x83, 0x33, 0x00, 0x53, 0xa5, 0xff, 0x00, 0x38, 0x84, 0x33, 0x00, 0x86,
+  0x8d, 0xff, 0x03, 0x6c, 0x66, 0x66, 0x46, 0x84, 0x33, 0x00, 0xf8, 0xdb,
+  0xff, 0x01, 0x8f, 0x34, 0x82, 0x33, 0x00, 0xd5, 0x82, 0xff, 0x02, 0x36,
+  0x33, 0x33, 0x8a, 0xff, 0x07, 0x3f, 0x33, 0x33, 0xf9, 0xff, 0xff, 0xbf,
+  0x34, 0x82, 0x33, 0x00, 0xa4, 0xa2, 0xff, 0x00, 0x8f, 0x83, 0x33, 0x00,
+  0xb7, 0x93, 0xff, 0x01, 0xbd, 0x38, 0x84, 0x33, 0x00, 0x63, 0xad, 0xff,
+  0x01, 0xef, 0x48, 0x82, 0x33, 0x00, 0xf6, 0x8a, 0xff, 0x00, 0x3a, 0x84,
+  0x33, 0x00, 0xc6, 0x86, 0xff, 0x03, 0xef, 0x33, 0x33, 0xf4, 0xa1, 0xff,
+  0x00, 0x8f, 0x83, 0x33, 0x00, 0xb7, 0x93, 0xff, 0x01, 0xdf, 0x38, 0x82,
+  0x33, 0x00, 0x93, 0xa4, 0xff, 0x00, 0x38, 0x82, 0x33, 0x01, 0x73, 0xfb,
+  0x93, 0xff, 0x00, 0x8d, 0x83, 0x33, 0x00, 0xf7, 0xa3, 0xff, 0x00, 0x8f,
+  0x83, 0x33, 0x01, 0xa6, 0xfd, 0x92, 0xff, 0x01, 0xdf, 0x38, 0x82, 0x33,
+  0x00, 0xa3, 0xdb, 0xff, 0x00, 0x37, 0x83, 0x33, 0x00, 0x43, 0x82, 0xff,
+  0x02, 0x36, 0x33, 0x63, 0x8a, 0xff, 0x06, 0x3f, 0x33, 0x33, 0xf7, 0xff,
+  0xff, 0x3e, 0x84, 0x33, 0x00, 0xfb, 0xa1, 0xff, 0x00, 0x3b, 0x82, 0x33,
+  0x00, 0xe5, 0x95, 0xff, 0x01, 0xdf, 0x35, 0x83, 0x33, 0x00, 0xc3, 0xad,
+  0xff, 0x00, 0x4d, 0x83, 0x33, 0x00, 0xf8, 0x8a, 0xff, 0x00, 0x3c, 0x85,
+  0x33, 0x00, 0xf8, 0x86, 0xff, 0x02, 0x33, 0x33, 0xf3, 0xa1, 0xff, 0x00,
+  0x3c, 0x82, 0x33, 0x00, 0xe5, 0x96, 0xff, 0x00, 0x38, 0x82, 0x33, 0x00,
+  0xfc, 0xa2, 0xff, 0x00, 0xcf, 0x82, 0x33, 0x01, 0x53, 0xfe, 0x95, 0xff,
+  0x00, 0x9f, 0x82, 0x33, 0x00, 0xa3, 0xa3, 0xff, 0x00, 0x3c, 0x82, 0x33,
+  0x00, 0xe5, 0x96, 0xff, 0x00, 0x39, 0x82, 0x33, 0x00, 0xfd, 0xda, 0xff,
+  0x00, 0x34, 0x84, 0x33, 0x05, 0xfc, 0xff, 0xff, 0x33, 0x33, 0x63, 0x8a,
+  0xff, 0x06, 0x6f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0x3a, 0x84, 0x33, 0x00,
+  0xf6, 0xa1, 0xff, 0x03, 0x34, 0x33, 0x33, 0x83, 0x97, 0xff, 0x00, 0x9f,
+  0x83, 0x33, 0x00, 0xf8, 0xac, 0xff, 0x01, 0xbf, 0x34, 0x83, 0x33, 0x00,
+  0xfb, 0x8a, 0xff, 0x00, 0x3f, 0x85, 0x33, 0x00, 0x63, 0x86, 0xff, 0x02,
+  0x36, 0x33, 0xf3, 0xa1, 0xff, 0x03, 0x34, 0x33, 0x33, 0x83, 0x97, 0xff,
+  0x00, 0xbf, 0x82, 0x33, 0x00, 0xf4, 0xa2, 0xff, 0x00, 0x4f, 0x82, 0x33,
+  0x00, 0xf8, 0x97, 0xff, 0x00, 0x3c, 0x82, 0x33, 0x00, 0xfe, 0xa2, 0xff,
+  0x03, 0x34, 0x33, 0x33, 0x73, 0x97, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x00,
+  0xf4, 0xda, 0xff, 0x00, 0x34, 0x84, 0x33, 0x05, 0xfc, 0xff, 0xff, 0x33,
+  0x33, 0x63, 0x8a, 0xff, 0x06, 0x5f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0x3b,
+  0x84, 0x33, 0x00, 0xf7, 0xa0, 0xff, 0x00, 0xaf, 0x82, 0x33, 0x00, 0xfa,
+  0x98, 0xff, 0x03, 0x3b, 0x33, 0x33, 0x43, 0xad, 0xff, 0x00, 0x3b, 0x82,
+  0x33, 0x01, 0x53, 0xb8, 0x8b, 0xff, 0x03, 0x9f, 0x99, 0x99, 0x57, 0x83,
+  0x33, 0x00, 0xf5, 0x85, 0xff, 0x02, 0x34, 0x33, 0xf3, 0xa0, 0xff, 0x00,
+  0xbf, 0x82, 0x33, 0x00, 0xfa, 0x98, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xb3,
+  0xa2, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xa3, 0x98, 0xff, 0x00, 0xdf, 0x82,
+  0x33, 0x00, 0xf8, 0xa1, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x00, 0xfa, 0x98,
+  0xff, 0x03, 0x3b, 0x33, 0x33, 0xb3, 0xda, 0xff, 0x00, 0x39, 0x83, 0x33,
+  0x00, 0x53, 0x82, 0xff, 0x02, 0x36, 0x33, 0x53, 0x8a, 0xff, 0x06, 0x3f,
+  0x33, 0x33, 0xf8, 0xff, 0xff, 0x3f, 0x84, 0x33, 0x00, 0xfc, 0xa0, 0xff,
+  0x03, 0x4f, 0x33, 0x33, 0x63, 0x99, 0xff, 0x03, 0x7f, 0x33, 0x33, 0x43,
+  0xac, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00, 0xb5, 0x91, 0xff, 0x04, 0xcf,
+  0x36, 0x33, 0x33, 0x83, 0x85, 0xff, 0x02, 0x33, 0x33, 0xf3, 0xa0, 0xff,
+  0x03, 0x4f, 0x33, 0x33, 0x63, 0x99, 0xff, 0x03, 0xaf, 0x33, 0x33, 0x53,
+  0xa2, 0xff, 0x03, 0x34, 0x33, 0x33, 0xf6, 0x99, 0xff, 0x03, 0x3b, 0x33,
+  0x33, 0xf4, 0xa1, 0xff, 0x03, 0x5f, 0x33, 0x33, 0x53, 0x99, 0xff, 0x03,
+  0xaf, 0x33, 0x33, 0x63, 0xda, 0xff, 0x00, 0xbf, 0x83, 0x66, 0x00, 0xf7,
+  0x82, 0xff, 0x02, 0x37, 0x33, 0x33, 0x8a, 0xff, 0x07, 0x3e, 0x33, 0x33,
+  0xf9, 0xff, 0xff, 0xef, 0x67, 0x82, 0x66, 0x00, 0xc7, 0xa1, 0xff, 0x03,
+  0x3c, 0x33, 0x33, 0xe3, 0x9a, 0xff, 0x82, 0x33, 0x00, 0xfd, 0xab, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0x73, 0x93, 0xff, 0x00, 0xaf, 0x82, 0x33, 0x00,
+  0xfc, 0x83, 0xff, 0x03, 0xbf, 0x33, 0x33, 0xf6, 0xa0, 0xff, 0x03, 0x3d,
+  0x33, 0x33, 0xe3, 0x9a, 0xff, 0x03, 0x34, 0x33, 0x33, 0xfc, 0xa0, 0xff,
+  0x00, 0xdf, 0x82, 0x33, 0x00, 0xfe, 0x99, 0xff, 0x03, 0x6f, 0x33, 0x33,
+  0xb3, 0xa1, 0xff, 0x03, 0x3d, 0x33, 0x33, 0xd3, 0x9a, 0xff, 0x03, 0x34,
+  0x33, 0x33, 0xfd, 0xe2, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfb, 0x89, 0xff,
+  0x03, 0x3b, 0x33, 0x33, 0xfc, 0xa9, 0xff, 0x03, 0x39, 0x33, 0x33, 0xf9,
+  0x9a, 0xff, 0x03, 0x39, 0x33, 0x33, 0xf8, 0xab, 0xff, 0x03, 0x3b, 0x33,
+  0x33, 0xfb, 0x94, 0xff, 0x03, 0x3d, 0x33, 0x33, 0xf5, 0x83, 0xff, 0x03,
+  0x4f, 0x33, 0x33, 0xfa, 0xa0, 0xff, 0x03, 0x3a, 0x33, 0x33, 0xf9, 0x9a,
+  0xff, 0x03, 0x3b, 0x33, 0x33, 0xf8, 0xa0, 0xff, 0x03, 0xaf, 0x33, 0x33,
+  0x93, 0x9a, 0xff, 0x03, 0xcf, 0x33, 0x33, 0x63, 0xa1, 0xff, 0x03, 0x3a,
+  0x33, 0x33, 0xf7, 0x9a, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xf9, 0xe2, 0xff,
+  0x03, 0x3b, 0x33, 0x33, 0xf7, 0x89, 0xff, 0x03, 0x36, 0x33, 0x33, 0xfe,
+  0xa9, 0xff, 0x03, 0x36, 0x33, 0x33, 0xfc, 0x9a, 0xff, 0x03, 0x3d, 0x33,
+  0x33, 0xf6, 0xab, 0xff, 0x02, 0x34, 0x33, 0x73, 0x95, 0xff, 0x03, 0xaf,
+  0x33, 0x33, 0xb3, 0x83, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfe, 0xa0, 0xff,
+  0x03, 0x37, 0x33, 0x33, 0xfc, 0x9a, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf6,
+  0xa0, 0xff, 0x03, 0x7f, 0x33, 0x33, 0xc3, 0x9b, 0xff, 0x02, 0x34, 0x33,
+  0x63, 0xa1, 0xff, 0x03, 0x37, 0x33, 0x33, 0xfc, 0x9a, 0xff, 0x03, 0x3f,
+  0x33, 0x33, 0xf6, 0xe2, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xe3, 0x88, 0xff,
+  0x03, 0xcf, 0x33, 0x33, 0x63, 0xaa, 0xff, 0x02, 0x36, 0x33, 0x33, 0x9b,
+  0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4, 0xaa, 0xff, 0x03, 0xcf, 0x33, 0x33,
+  0xf3, 0x96, 0xff, 0x02, 0x37, 0x33, 0x73, 0x82, 0xff, 0x03, 0x8f, 0x33,
+  0x33, 0x73, 0xa1, 0xff, 0x02, 0x36, 0x33, 0x33, 0x9b, 0xff, 0x03, 0x6f,
+  0x33, 0x33, 0xf5, 0xa0, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf3, 0x9b, 0xff,
+  0x02, 0x38, 0x33, 0x33, 0xa1, 0xff, 0x02, 0x36, 0x33, 0x33, 0x9b, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0xf6, 0xe2, 0xff, 0x03, 0x9f, 0x33, 0x33, 0x73,
+  0x88, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xb3, 0xaa, 0xff, 0x02, 0x33, 0x33,
+  0x43, 0x9b, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf3, 0xaa, 0xff, 0x03, 0x9f,
+  0x33, 0x33, 0xfa, 0x96, 0xff, 0x09, 0x3e, 0x33, 0x43, 0xff, 0xff, 0xdf,
+  0x35, 0x33, 0x33, 0xe3, 0xa1, 0xff, 0x02, 0x33, 0x33, 0x43, 0x9b, 0xff,
+  0x03, 0x8f, 0x33, 0x33, 0xf3, 0xa0, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4,
+  0x9b, 0xff, 0x02, 0x39, 0x33, 0x33, 0xa1, 0xff, 0x82, 0x33, 0x9b, 0xff,
+  0x03, 0x7f, 0x33, 0x33, 0xf3, 0xe2, 0xff, 0x00, 0xef, 0x82, 0x33, 0x00,
+  0xf9, 0x87, 0xff, 0x03, 0x37, 0x33, 0x33, 0xf4, 0xaa, 0xff, 0x02, 0x33,
+  0x33, 0x63, 0x9b, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf3, 0xaa, 0xff, 0x03,
+  0x7f, 0x33, 0x33, 0xfc, 0x96, 0xff, 0x05, 0x3f, 0x33, 0x33, 0xff, 0x8e,
+  0x34, 0x82, 0x33, 0x00, 0xfc, 0xa1, 0xff, 0x02, 0x33, 0x33, 0x63, 0x9b,
+  0xff, 0x03, 0x9f, 0x33, 0x33, 0xf3, 0xa0, 0xff, 0x03, 0x3f, 0x33, 0x33,
+  0xf6, 0x9b, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xa0, 0xff, 0x02, 0x33,
+  0x33, 0x63, 0x9b, 0xff, 0x03, 0x9f, 0x33, 0x33, 0xf3, 0xe3, 0xff, 0x03,
+  0x37, 0x33, 0x33, 0xa3, 0x86, 0xff, 0x00, 0x8f, 0x82, 0x33, 0x00, 0xfa,
+  0xaa, 0xff, 0x02, 0x34, 0x33, 0x63, 0x9b, 0xff, 0x07, 0x6f, 0x33, 0x33,
+  0xf3, 0xff, 0xaf, 0x44, 0xf8, 0xa6, 0xff, 0x02, 0x6f, 0x33, 0x33, 0x97,
+  0xff, 0x04, 0x6f, 0x33, 0x33, 0xfc, 0x39, 0x82, 0x33, 0x00, 0xb3, 0xa2,
+  0xff, 0x02, 0x33, 0x33, 0x43, 0x88, 0xff, 0x01, 0x49, 0x84, 0x82, 0xff,
+  0x02, 0xbf, 0x34, 0xd6, 0x82, 0xff, 0x02, 0x6d, 0x53, 0xfb, 0x84, 0xff,
+  0x03, 0x7f, 0x33, 0x33, 0xf3, 0xa0, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf4,
+  0x84, 0xff, 0x00, 0x39, 0x83, 0x33, 0x00, 0x93, 0x82, 0xff, 0x07, 0x4b,
+  0x43, 0xfd, 0xff, 0xff, 0xdf, 0x34, 0xb4, 0x85, 0xff, 0x02, 0x38, 0x33,
+  0x33, 0xa1, 0xff, 0x02, 0x33, 0x33, 0x53, 0x9b, 0xff, 0x03, 0x7f, 0x33,
+  0x33, 0xf3, 0xe3, 0xff, 0x00, 0x4f, 0x82, 0x33, 0x00, 0xf8, 0x85, 0xff,
+  0x03, 0x35, 0x33, 0x33, 0x73, 0xab, 0xff, 0x02, 0x36, 0x33, 0x43, 0x9b,
+  0xff, 0x07, 0x4f, 0x33, 0x33, 0xf5, 0xff, 0x3b, 0x33, 0x53, 0xa6, 0xff,
+  0x02, 0x3f, 0x33, 0x53, 0x97, 0xff, 0x04, 0x8f, 0x33, 0x33, 0xfc, 0x39,
+  0x82, 0x33, 0x00, 0xfb, 0xa2, 0xff, 0x02, 0x36, 0x33, 0x33, 0x87, 0xff,
+  0x08, 0xbf, 0x33, 0x33, 0xf7, 0xff, 0xff, 0x3e, 0x33, 0x43, 0x82, 0xff,
+  0x02, 0x34, 0x33, 0xe3, 0x84, 0xff, 0x03, 0x4f, 0x33, 0x33, 0xf5, 0xa0,
+  0xff, 0x03, 0x5f, 0x33, 0x33, 0xf3, 0x84, 0xff, 0x00, 0x34, 0x83, 0x33,
+  0x00, 0xc3, 0x82, 0xff, 0x08, 0x34, 0x33, 0xf4, 0xff, 0xff, 0x4f, 0x33,
+  0x33, 0xfe, 0x84, 0xff, 0x02, 0x36, 0x33, 0x33, 0xa1, 0xff, 0x02, 0x36,
+  0x33, 0x33, 0x9b, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xf3, 0xe3, 0xff, 0x00,
+  0xdf, 0x82, 0x33, 0x01, 0x43, 0xfb, 0x83, 0xff, 0x00, 0x49, 0x82, 0x33,
+  0x00, 0xf4, 0xab, 0xff, 0x03, 0x37, 0x33, 0x33, 0xfe, 0x9a, 0xff, 0x08,
+  0x3e, 0x33, 0x33, 0xf6, 0xff, 0x37, 0x33, 0x33, 0xf8, 0xa5, 0xff, 0x02,
+  0x3f, 0x33, 0x43, 0x97, 0xff, 0x07, 0x7f, 0x33, 0x33, 0xfc, 0x39, 0x33,
+  0x33, 0xe7, 0xa3, 0xff, 0x03, 0x36, 0x33, 0x33, 0xfc, 0x86, 0xff, 0x0e,
+  0x5f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x3a, 0x33, 0x33, 0xfd, 0xff, 0xbf,
+  0x33, 0x33, 0xb3, 0x84, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf6, 0xa0, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0xd3, 0x83, 0xff, 0x00, 0xcf, 0x84, 0x33, 0x0c,
+  0xf7, 0xff, 0xff, 0xbf, 0x33, 0x33, 0xc3, 0xff, 0xff, 0x3e, 0x33, 0x33,
+  0xf9, 0x84, 0xff, 0x82, 0x33, 0xa1, 0xff, 0x03, 0x36, 0x33, 0x33, 0xfc,
+  0x9a, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf6, 0xe4, 0xff, 0x00, 0x3b, 0x82,
+  0x33, 0x04, 0x43, 0x97, 0xcb, 0x9a, 0x36, 0x83, 0x33, 0x00, 0xfd, 0xab,
+  0xff, 0x03, 0x39, 0x33, 0x33, 0xfa, 0x9a, 0xff, 0x08, 0x3a, 0x33, 0x33,
+  0xf9, 0xff, 0x38, 0x33, 0x33, 0x93, 0xa5, 0xff, 0x03, 0x5f, 0x33, 0x33,
+  0xfe, 0x96, 0xff, 0x06, 0x5f, 0x33, 0x33, 0xfd, 0x39, 0x33, 0xd7, 0xa4,
+  0xff, 0x03, 0x39, 0x33, 0x33, 0xf9, 0x86, 0xff, 0x0e, 0x3f, 0x33, 0x33,
+  0xf4, 0xff, 0xff, 0x36, 0x33, 0x33, 0xff, 0xff, 0x8f, 0x33, 0x33, 0xc3,
+  0x84, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xf8, 0xa0, 0xff, 0x03, 0x9f, 0x33,
+  0x33, 0x93, 0x83, 0xff, 0x00, 0x7f, 0x84, 0x33, 0x0c, 0xfe, 0xff, 0xff,
+  0x7f, 0x33, 0x33, 0xd3, 0xff, 0xff, 0x3a, 0x33, 0x33, 0xfb, 0x83, 0xff,
+  0x03, 0xcf, 0x33, 0x33, 0x73, 0xa1, 0xff, 0x03, 0x38, 0x33, 0x33, 0xfa,
+  0x9a, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xf7, 0xe4, 0xff, 0x00, 0xaf, 0x8a,
+  0x33, 0x00, 0xb3, 0xac, 0xff, 0x03, 0x3e, 0x33, 0x33, 0xf4, 0x9a, 0xff,
+  0x08, 0x34, 0x33, 0x33, 0xfc, 0xff, 0x3e, 0x33, 0x33, 0x43, 0xa5, 0xff,
+  0x03, 0x6f, 0x33, 0x33, 0xfb, 0x96, 0xff, 0x04, 0x3f, 0x33, 0x33, 0xff,
+  0xcf, 0xa6, 0xff, 0x03, 0x3d, 0x33, 0x33, 0xf4, 0x86, 0xff, 0x0e, 0x3b,
+  0x33, 0x33, 0xf7, 0xff, 0xff, 0x33, 0x33, 0x53, 0xff, 0xff, 0x5f, 0x33,
+  0x33, 0xf3, 0x84, 0xff, 0x03, 0x35, 0x33, 0x33, 0xfc, 0xa0, 0xff, 0x04,
+  0xcf, 0x33, 0x33, 0x43, 0xfe, 0x82, 0xff, 0x00, 0x4f, 0x83, 0x33, 0x00,
+  0x73, 0x82, 0xff, 0x08, 0x4f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x37, 0x33,
+  0x33, 0x84, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xb3, 0xa1, 0xff, 0x03, 0x3c,
+  0x33, 0x33, 0xf4, 0x8c, 0xff, 0x00, 0xfd, 0x8c, 0xff, 0x03, 0x35, 0x33,
+  0x33, 0xfb, 0xe5, 0xff, 0x00, 0x3c, 0x88, 0x33, 0x01, 0x53, 0xfe, 0xac,
+  0xff, 0x03, 0x6f, 0x33, 0x33, 0x93, 0x99, 0xff, 0x09, 0x9f, 0x33, 0x33,
+  0x53, 0xff, 0xff, 0xdf, 0x33, 0x33, 0x43, 0xa5, 0xff, 0x03, 0xaf, 0x33,
+  0x33, 0xf7, 0x96, 0xff, 0x02, 0x3b, 0x33, 0x53, 0xa8, 0xff, 0x03, 0x3f,
+  0x33, 0x33, 0x73, 0x86, 0xff, 0x0e, 0x37, 0x33, 0x33, 0xfb, 0xff, 0xbf,
+  0x33, 0x33, 0x83, 0xff, 0xff, 0x3e, 0x33, 0x33, 0xf7, 0x83, 0xff, 0x03,
+  0x9f, 0x33, 0x33, 0x43, 0xa2, 0xff, 0x03, 0x34, 0x33, 0x33, 0xf7, 0x82,
+  0xff, 0x00, 0x3b, 0x83, 0x33, 0x00, 0xe3, 0x82, 0xff, 0x08, 0x3e, 0x33,
+  0x33, 0xf7, 0xff, 0xff, 0x34, 0x33, 0x53, 0x84, 0xff, 0x03, 0x39, 0x33,
+  0x33, 0xe3, 0xa1, 0xff, 0x03, 0x3f, 0x33, 0x33, 0x73, 0x8b, 0xff, 0x02,
+  0x4d, 0x33, 0xfb, 0x8a, 0xff, 0x00, 0x9f, 0x82, 0x33, 0xe7, 0xff, 0x00,
+  0x36, 0x87, 0x33, 0x00, 0xf7, 0xad, 0xff, 0x00, 0xbf, 0x82, 0x33, 0x00,
+  0xfb, 0x98, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xb3, 0x82, 0xff, 0x02, 0x3d,
+  0x33, 0x93, 0xa5, 0xff, 0x03, 0xef, 0x33, 0x33, 0xc3, 0x96, 0xff, 0x02,
+  0x34, 0x33, 0x93, 0xa8, 0xff, 0x00, 0x9f, 0x82, 0x33, 0x00, 0xfb, 0x85,
+  0xff, 0x0e, 0x34, 0x33, 0x33, 0xff, 0xff, 0x8f, 0x33, 0x33, 0xc3, 0xff,
+  0xff, 0x3b, 0x33, 0x33, 0xfa, 0x83, 0xff, 0x03, 0x3e, 0x33, 0x33, 0xa3,
+  0xa2, 0xff, 0x03, 0x3a, 0x33, 0x33, 0xb3, 0x82, 0xff, 0x00, 0x36, 0x83,
+  0x33, 0x00, 0xf9, 0x82, 0xff, 0x08, 0x3b, 0x33, 0x33, 0xfa, 0xff, 0xdf,
+  0x33, 0x33, 0x83, 0x83, 0xff, 0x00, 0xdf, 0x82, 0x33, 0x00, 0xf7, 0xa1,
+  0xff, 0x00, 0x9f, 0x82, 0x33, 0x00, 0xfb, 0x8a, 0xff, 0x02, 0x34, 0x33,
+  0xd3, 0x8a, 0xff, 0x03, 0x4e, 0x33, 0x33, 0x73, 0xe2, 0xff, 0x01, 0x99,
+  0xfc, 0x82, 0xff, 0x01, 0xcf, 0x37, 0x85, 0x33, 0x00, 0xe7, 0x83, 0xff,
+  0x01, 0x9b, 0xfa, 0xa9, 0xff, 0x03, 0x34, 0x33, 0x33, 0xa4, 0x97, 0xff,
+  0x04, 0xbf, 0x34, 0x33, 0x33, 0xf4, 0x82, 0xff, 0x02, 0xdf, 0x67, 0xf9,
+  0xa6, 0xff, 0x02, 0x36, 0x33, 0x43, 0x95, 0xff, 0x03, 0x8f, 0x33, 0x33,
+  0xe3, 0xa9, 0xff, 0x03, 0x34, 0x33, 0x33, 0xb4, 0x84, 0xff, 0x0f, 0xdf,
+  0x33, 0x33, 0x63, 0xff, 0xff, 0x4f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x37,
+  0x33, 0x33, 0xfe, 0x82, 0xff, 0x04, 0xdf, 0x34, 0x33, 0x33, 0xe3, 0xa2,
+  0xff, 0x00, 0x4f, 0x82, 0x33, 0x02, 0xfb, 0xff, 0xef, 0x84, 0x33, 0x83,
+  0xff, 0x08, 0x37, 0x33, 0x33, 0xfd, 0xff, 0xaf, 0x33, 0x33, 0xc3, 0x83,
+  0xff, 0x00, 0x4b, 0x82, 0x33, 0x00, 0xfe, 0xa2, 0xff, 0x82, 0x33, 0x00,
+  0xb4, 0x89, 0xff, 0x03, 0xdf, 0x33, 0x33, 0x93, 0x89, 0xff, 0x04, 0xdf,
+  0x34, 0x33, 0x33, 0xe3, 0xe1, 0xff, 0x02, 0x4d, 0x33, 0xb3, 0x83, 0xff,
+  0x01, 0xef, 0x68, 0x82, 0x33, 0x01, 0x64, 0xfa, 0x83, 0xff, 0x02, 0x9f,
+  0x33, 0x53, 0xa9, 0xff, 0x00, 0x3c, 0x82, 0x33, 0x00, 0xf7, 0x96, 0xff,
+  0x00, 0x3a, 0x82, 0x33, 0x00, 0xfc, 0xac, 0xff, 0x03, 0x3c, 0x33, 0x33,
+  0xf6, 0x94, 0xff, 0x03, 0x3a, 0x33, 0x33, 0xf7, 0xa9, 0xff, 0x00, 0x3b,
+  0x82, 0x33, 0x00, 0xf8, 0x83, 0xff, 0x0e, 0xaf, 0x33, 0x33, 0x93, 0xff,
+  0xff, 0x3e, 0x33, 0x33, 0xf7, 0xff, 0xff, 0x34, 0x33, 0x43, 0x83, 0xff,
+  0x00, 0x3a, 0x82, 0x33, 0x00, 0xfb, 0xa2, 0xff, 0x00, 0xcf, 0x82, 0x33,
+  0x02, 0xa3, 0xff, 0x9f, 0x83, 0x33, 0x00, 0x93, 0x83, 0xff, 0x08, 0x34,
+  0x33, 0x43, 0xff, 0xff, 0x7f, 0x33, 0x33, 0xf3, 0x82, 0xff, 0x00, 0x8f,
+  0x82, 0x33, 0x00, 0x93, 0xa3, 0xff, 0x00, 0x39, 0x82, 0x33, 0x00, 0xf8,
+  0x89, 0xff, 0x02, 0x33, 0x33, 0xc3, 0x89, 0xff, 0x00, 0x3a, 0x82, 0x33,
+  0x00, 0xf9, 0xe0, 0xff, 0x03, 0xdf, 0x34, 0x33, 0x43, 0x86, 0xff, 0x01,
+  0xcc, 0xfd, 0x85, 0xff, 0x03, 0x4f, 0x33, 0x33, 0xf5, 0xa8, 0xff, 0x00,
+  0x9f, 0x82, 0x33, 0x01, 0x43, 0xdb, 0x94, 0xff, 0x00, 0x4b, 0x82, 0x33,
+  0x00, 0x93, 0xad, 0xff, 0x04, 0x6f, 0x33, 0x33, 0x43, 0xfb, 0x92, 0xff,
+  0x00, 0x6e, 0x82, 0x33, 0x00, 0xfe, 0xa9, 0xff, 0x00, 0x7f, 0x82, 0x33,
+  0x01, 0x53, 0xec, 0x82, 0xff, 0x0e, 0x6f, 0x33, 0x33, 0xd3, 0xff, 0xff,
+  0x3b, 0x33, 0x33, 0xfa, 0xff, 0xcf, 0x33, 0x33, 0x83, 0x82, 0xff, 0x00,
+  0x7c, 0x82, 0x33, 0x00, 0x73, 0xa4, 0xff, 0x00, 0x37, 0x82, 0x33, 0x01,
+  0x94, 0x4e, 0x83, 0x33, 0x00, 0xf4, 0x82, 0xff, 0x0d, 0xdf, 0x33, 0x33,
+  0x73, 0xff, 0xff, 0x4f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0x9c, 0x34, 0x82,
+  0x33, 0x00, 0xf7, 0xa3, 0xff, 0x00, 0x7f, 0x82, 0x33, 0x01, 0x53, 0xec,
+  0x88, 0xff, 0x02, 0x3c, 0x33, 0xf8, 0x88, 0xff, 0x00, 0x7c, 0x82, 0x33,
+  0x00, 0x63, 0xe1, 0xff, 0x00, 0x4d, 0x82, 0x33, 0x8e, 0xff, 0x03, 0x3f,
+  0x33, 0x33, 0x53, 0xa9, 0xff, 0x00, 0x36, 0x83, 0x33, 0x01, 0x63, 0x98,
+  0x90, 0x99, 0x01, 0x68, 0x36, 0x83, 0x33, 0x00, 0xf6, 0xae, 0xff, 0x04,
+  0x34, 0x33, 0x33, 0x73, 0xca, 0x8f, 0xff, 0x05, 0xdf, 0x8c, 0x34, 0x33,
+  0x33, 0xb3, 0xab, 0xff, 0x00, 0x35, 0x83, 0x33, 0x14, 0x84, 0xfd, 0xff,
+  0x3f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x37, 0x33, 0x33, 0xfd, 0xff, 0x9f,
+  0x33, 0x33, 0xb3, 0xff, 0x8e, 0x35, 0x83, 0x33, 0x00, 0xf5, 0xa4, 0xff,
+  0x00, 0x6f, 0x88, 0x33, 0x00, 0xfb, 0x82, 0xff, 0x0b, 0xaf, 0x33, 0x33,
+  0xb3, 0xff, 0xff, 0x3d, 0x33, 0x33, 0xf9, 0xdf, 0x36, 0x83, 0x33, 0x00,
+  0x53, 0xa5, 0xff, 0x00, 0x35, 0x83, 0x33, 0x05, 0x84, 0xfd, 0xff, 0xff,
+  0xaf, 0xfa, 0x83, 0xff, 0x00, 0xec, 0x83, 0xff, 0x05, 0x9c, 0xfd, 0xff,
+  0xff, 0x8e, 0x35, 0x83, 0x33, 0x00, 0xf3, 0xe0, 0xff, 0x04, 0xdf, 0x34,
+  0x33, 0x33, 0x73, 0x8e, 0xff, 0x00, 0x7f, 0x82, 0x33, 0x00, 0xf5, 0xa8,
+  0xff, 0x00, 0x6f, 0x9b, 0x33, 0x00, 0x63, 0xaf, 0xff, 0x00, 0x3d, 0x98,
+  0x33, 0x00, 0xf9, 0xab, 0xff, 0x00, 0x5f, 0x84, 0x33, 0x12, 0xf9, 0xff,
+  0x3b, 0x33, 0x33, 0xf7, 0xff, 0xff, 0x34, 0x33, 0x43, 0xff, 0xff, 0x5f,
+  0x33, 0x33, 0xf3, 0xff, 0x39, 0x83, 0x33, 0x01, 0x53, 0xfe, 0xa5, 0xff,
+  0x00, 0x35, 0x86, 0x33, 0x00, 0x43, 0x83, 0xff, 0x0a, 0x7f, 0x33, 0x33,
+  0xe3, 0xff, 0xff, 0x39, 0x33, 0x33, 0xfc, 0x9f, 0x84, 0x33, 0x00, 0xf5,
+  0xa5, 0xff, 0x00, 0x5f, 0x84, 0x33, 0x04, 0xf9, 0xff, 0xdf, 0x34, 0x43,
+  0x87, 0xff, 0x05, 0x7f, 0x33, 0x93, 0xff, 0xff, 0x39, 0x83, 0x33, 0x01,
+  0x53, 0xfd, 0xe0, 0xff, 0x00, 0x4d, 0x82, 0x33, 0x00, 0xf5, 0x8f, 0xff,
+  0x03, 0x35, 0x33, 0x33, 0x53, 0xa9, 0xff, 0x00, 0x39, 0x9a, 0x33, 0x00,
+  0xf9, 0xaf, 0xff, 0x01, 0xdf, 0x34, 0x96, 0x33, 0x00, 0xa3, 0xad, 0xff,
+  0x00, 0x37, 0x83, 0x33, 0x12, 0xf9, 0xff, 0x38, 0x33, 0x33, 0xfb, 0xff,
+  0xcf, 0x33, 0x33, 0x73, 0xff, 0xff, 0x3f, 0x33, 0x33, 0xf7, 0xff, 0x39,
+  0x83, 0x33, 0x00, 0xf7, 0xa6, 0xff, 0x00, 0x7f, 0x86, 0x33, 0x00, 0xc3,
+  0x83, 0xff, 0x0a, 0x4f, 0x33, 0x33, 0xf4, 0xff, 0xff, 0x36, 0x33, 0x33,
+  0xff, 0x9f, 0x83, 0x33, 0x00, 0x63, 0xa7, 0xff, 0x00, 0x37, 0x83, 0x33,
+  0x05, 0xf9, 0xff, 0x7f, 0x33, 0x33, 0xf8, 0x86, 0xff, 0x05, 0x3c, 0x33,
+  0x33, 0xff, 0xff, 0x39, 0x83, 0x33, 0x00, 0xf5, 0xe1, 0xff, 0x03, 0x34,
+  0x33, 0x33, 0x53, 0x90, 0xff, 0x00, 0x5f, 0x82, 0x33, 0x00, 0xf5, 0xa8,
+  0xff, 0x01, 0xcf, 0x34, 0x98, 0x33, 0x00, 0xc4, 0xb1, 0xff, 0x00, 0x6f,
+  0x96, 0x33, 0x00, 0xfb, 0xad, 0xff, 0x01, 0xbf, 0x34, 0x82, 0x33, 0x12,
+  0xf9, 0xff, 0x34, 0x33, 0x33, 0xff, 0xff, 0x9f, 0x33, 0x33, 0xb3, 0xff,
+  0xff, 0x3b, 0x33, 0x33, 0xfa, 0xff, 0x39, 0x82, 0x33, 0x00, 0xa3, 0xa8,
+  0xff, 0x00, 0x4b, 0x85, 0x33, 0x00, 0xf6, 0x83, 0xff, 0x0a, 0x3d, 0x33,
+  0x33, 0xf7, 0xff, 0xff, 0x33, 0x33, 0x63, 0xff, 0x9f, 0x83, 0x33, 0x00,
+  0xf9, 0xa7, 0xff, 0x00, 0xbf, 0x83, 0x33, 0x05, 0xf9, 0xff, 0x6f, 0x33,
+  0x33, 0xf7, 0x86, 0xff, 0x05, 0x3b, 0x33, 0x33, 0xfe, 0xff, 0x39, 0x82,
+  0x33, 0x00, 0x93, 0xe1, 0xff, 0x00, 0xaf, 0x82, 0x33, 0x00, 0xf5, 0x91,
+  0xff, 0x03, 0x35, 0x33, 0x33, 0xc3, 0xa9, 0xff, 0x01, 0xbf, 0x36, 0x96,
+  0x33, 0x00, 0xb6, 0xb3, 0xff, 0x00, 0x6c, 0x94, 0x33, 0x00, 0xf9, 0xaf,
+  0xff, 0x19, 0x9f, 0x34, 0x33, 0x33, 0xf9, 0xef, 0x33, 0x33, 0x53, 0xff,
+  0xff, 0x5f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x37, 0x33, 0x33, 0xfe, 0xff,
+  0x39, 0x33, 0x33, 0x94, 0xaa, 0xff, 0x00, 0x4a, 0x84, 0x33, 0x00, 0xfc,
+  0x83, 0xff, 0x0a, 0x3a, 0x33, 0x33, 0xfb, 0xff, 0xcf, 0x33, 0x33, 0x93,
+  0xff, 0x9f, 0x82, 0x33, 0x00, 0xf7, 0xa9, 0xff, 0x00, 0x9f, 0x82, 0x33,
+  0x05, 0xf9, 0xff, 0x9f, 0x33, 0x33, 0xfb, 0x86, 0xff, 0x08, 0x3e, 0x33,
+  0x53, 0xff, 0xff, 0x39, 0x33, 0x33, 0x73, 0xe2, 0xff, 0x03, 0xaf, 0x33,
+  0x33, 0x53, 0x87, 0xff, 0x02, 0xcf, 0x35, 0xd7, 0x87, 0xff, 0x03, 0x5f,
+  0x33, 0x33, 0xc3, 0xaa, 0xff, 0x02, 0xdf, 0x79, 0x46, 0x91, 0x33, 0x02,
+  0x43, 0x76, 0xe9, 0xb5, 0xff, 0x01, 0xae, 0x66, 0x8f, 0x33, 0x02, 0x43,
+  0x76, 0xfb, 0xb1, 0xff, 0x17, 0xdf, 0x68, 0x33, 0xf9, 0xbf, 0x33, 0x33,
+  0x93, 0xff, 0xff, 0x3f, 0x33, 0x33, 0xf5, 0xff, 0xff, 0x34, 0x33, 0x53,
+  0xff, 0xff, 0x3b, 0x64, 0xb9, 0xac, 0xff, 0x00, 0x3b, 0x82, 0x33, 0x00,
+  0x73, 0x84, 0xff, 0x0d, 0x37, 0x33, 0x33, 0xfe, 0xff, 0x9f, 0x33, 0x33,
+  0xc3, 0xff, 0xbf, 0x33, 0x76, 0xfb, 0xab, 0xff, 0x07, 0xbf, 0x68, 0x33,
+  0xf9, 0xff, 0xff, 0x38, 0x93, 0x87, 0xff, 0x07, 0xcf, 0x33, 0xd5, 0xff,
+  0xff, 0x3b, 0x63, 0xb7, 0xe4, 0xff, 0x02, 0x33, 0x33, 0xf5, 0x87, 0xff,
+  0x02, 0x4e, 0x33, 0x43, 0x88, 0xff, 0x02, 0x35, 0x33, 0xf5, 0xff, 0xff,
+  0xc3, 0xff, 0x0e, 0x7f, 0x33, 0x33, 0xd3, 0xff, 0xff, 0x3b, 0x33, 0x33,
+  0xf9, 0xff, 0xdf, 0x33, 0x33, 0x83, 0xb1, 0xff, 0x00, 0x38, 0x82, 0x33,
+  0x00, 0x53, 0x82, 0x66, 0x0a, 0xf6, 0xff, 0x34, 0x33, 0x53, 0xff, 0xff,
+  0x6f, 0x33, 0x33, 0xf3, 0xbc, 0xff, 0x00, 0xfd, 0xef, 0xff, 0x01, 0x7e,
+  0x96, 0x88, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xfc, 0x87, 0xff, 0x01, 0x9f,
+  0x96, 0xff, 0xff, 0xc4, 0xff, 0x0e, 0x4f, 0x33, 0x33, 0xf3, 0xff, 0xff,
+  0x37, 0x33, 0x33, 0xfd, 0xff, 0xaf, 0x33, 0x33, 0xc3, 0xb1, 0xff, 0x00,
+  0x34, 0x86, 0x33, 0x0a, 0xf8, 0xcf, 0x33, 0x33, 0x83, 0xff, 0xff, 0x3f,
+  0x33, 0x33, 0xf6, 0xbb, 0xff, 0x02, 0x4d, 0x33, 0xfb, 0xf9, 0xff, 0x03,
+  0x39, 0x33, 0x33, 0xfc, 0xff, 0xff, 0xce, 0xff, 0x0e, 0x3c, 0x33, 0x33,
+  0xf7, 0xff, 0xff, 0x34, 0x33, 0x33, 0xff, 0xff, 0x6f, 0x33, 0x33, 0xf3,
+  0xb0, 0xff, 0x00, 0xbf, 0x86, 0x33, 0x0b, 0x43, 0xff, 0x9f, 0x33, 0x33,
+  0xb3, 0xff, 0xff, 0x3b, 0x33, 0x33, 0xf9, 0xbb, 0xff, 0x02, 0x34, 0x33,
+  0xd3, 0xf9, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xff, 0xff, 0xce, 0xff,
+  0x0e, 0x38, 0x33, 0x33, 0xfb, 0xff, 0xdf, 0x33, 0x33, 0x73, 0xff, 0xff,
+  0x3f, 0x33, 0x33, 0xf7, 0xb0, 0xff, 0x00, 0x7f, 0x86, 0x33, 0x0b, 0xc3,
+  0xff, 0x6f, 0x33, 0x33, 0xf3, 0xff, 0xff, 0x38, 0x33, 0x33, 0xfc, 0xba,
+  0xff, 0x03, 0xdf, 0x33, 0x33, 0x93, 0xf9, 0xff, 0x03, 0x39, 0x33, 0x33,
+  0xfc, 0xff, 0xff, 0xce, 0xff, 0x0e, 0x35, 0x33, 0x33, 0xff, 0xff, 0xaf,
+  0x33, 0x33, 0xb3, 0xff, 0xff, 0x3b, 0x33, 0x33, 0xfb, 0xb0, 0xff, 0x00,
+  0x3e, 0x86, 0x33, 0x0a, 0xf8, 0xff, 0x3f, 0x33, 0x33, 0xf5, 0xff, 0xff,
+  0x35, 0x33, 0x33, 0xbc, 0xff, 0x02, 0x33, 0x33, 0xb3, 0xf9, 0xff, 0x03,
+  0x39, 0x33, 0x33, 0xfc, 0xff, 0xff, 0xcd, 0xff, 0x0f, 0xef, 0x33, 0x33,
+  0x53, 0xff, 0xff, 0x7f, 0x33, 0x33, 0xe3, 0xff, 0xff, 0x37, 0x33, 0x33,
+  0xfe, 0xb0, 0xff, 0x00, 0x6e, 0x82, 0x66, 0x82, 0x33, 0x0b, 0x53, 0xff,
+  0xff, 0x3c, 0x33, 0x33, 0xf8, 0xff, 0xff, 0x33, 0x33, 0x63, 0xbc, 0xff,
+  0x02, 0x3b, 0x33, 0xf7, 0xf9, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xff,
+  0xff, 0xce, 0xff, 0x0d, 0x33, 0x33, 0x93, 0xff, 0xff, 0x3f, 0x33, 0x33,
+  0xf4, 0xff, 0xff, 0x38, 0x33, 0x53, 0xb5, 0xff, 0x0e, 0x34, 0x33, 0x33,
+  0xd3, 0xff, 0xff, 0x39, 0x33, 0x33, 0xfb, 0xff, 0xff, 0x34, 0x33, 0xa3,
+  0xb7, 0xff, 0x01, 0xcf, 0xfc, 0x82, 0xff, 0x01, 0xef, 0xb9, 0x83, 0xff,
+  0x01, 0xcd, 0xfd, 0xf4, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfc, 0xff, 0xff,
+  0xce, 0xff, 0x0d, 0x38, 0x33, 0xf4, 0xff, 0xff, 0x3b, 0x33, 0x33, 0xf8,
+  0xff, 0xff, 0x3e, 0x33, 0xb3, 0xb4, 0xff, 0x00, 0xef, 0x82, 0x33, 0x05,
+  0xf9, 0xff, 0xff, 0x36, 0x33, 0x33, 0x82, 0xff, 0x02, 0x3d, 0x33, 0xf4,
+  0xb6, 0xff, 0x02, 0xdf, 0x34, 0x43, 0x87, 0xff, 0x02, 0x7f, 0x33, 0xa3,
+  0xf4, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xfc, 0xff, 0xff, 0xce, 0xff, 0x0d,
+  0xbf, 0xa7, 0xfe, 0xff, 0xff, 0x38, 0x33, 0x33, 0xfb, 0xff, 0xff, 0xef,
+  0x77, 0xfb, 0xb4, 0xff, 0x03, 0xbf, 0x33, 0x33, 0x53, 0x82, 0xff, 0x02,
+  0x33, 0x33, 0x63, 0x82, 0xff, 0x01, 0xef, 0x99, 0xb7, 0xff, 0x03, 0x7f,
+  0x33, 0x33, 0xf9, 0x86, 0xff, 0x02, 0x3c, 0x33, 0x33, 0xf4, 0xff, 0x02,
+  0x3d, 0x33, 0x33, 0xff, 0xff, 0xd4, 0xff, 0x02, 0x35, 0x33, 0x33, 0xba,
+  0xff, 0x09, 0x8f, 0x33, 0x33, 0xd3, 0xff, 0xff, 0xbf, 0x33, 0x33, 0x93,
+  0xbc, 0xff, 0x03, 0x6f, 0x33, 0x33, 0xf7, 0x86, 0xff, 0x03, 0x3b, 0x33,
+  0x33, 0xfd, 0xf3, 0xff, 0x02, 0x9f, 0x33, 0xb3, 0xff, 0xff, 0xd3, 0xff,
+  0x03, 0xef, 0x33, 0x33, 0x63, 0xba, 0xff, 0x09, 0x5f, 0x33, 0x33, 0xfa,
+  0xff, 0xff, 0x8f, 0x33, 0x33, 0xc3, 0xbc, 0xff, 0x03, 0x9f, 0x33, 0x33,
+  0xfb, 0x86, 0xff, 0x02, 0x3e, 0x33, 0x43, 0xf5, 0xff, 0x00, 0xce, 0xff,
+  0xff, 0xd4, 0xff, 0x03, 0xbf, 0x33, 0x33, 0xa3, 0xba, 0xff, 0x02, 0x3f,
+  0x33, 0x63, 0x82, 0xff, 0x03, 0x5f, 0x33, 0x33, 0xf3, 0xbd, 0xff, 0x01,
+  0x37, 0x83, 0x87, 0xff, 0x02, 0xbf, 0x33, 0xd4, 0xff, 0xff, 0xff, 0xff,
+  0xcb, 0xff, 0x03, 0x7f, 0x33, 0x33, 0xd3, 0xba, 0xff, 0x02, 0x3c, 0x33,
+  0xe3, 0x82, 0xff, 0x03, 0x3f, 0x33, 0x33, 0xf6, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x96, 0xff, 0x03, 0x4f, 0x33, 0x33, 0xf3, 0xba, 0xff, 0x02,
+  0x39, 0x33, 0xfa, 0x82, 0xff, 0x03, 0x3b, 0x33, 0x33, 0xf9, 0xc2, 0xff,
+  0x02, 0x7f, 0x53, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0x03, 0x3d,
+  0x33, 0x33, 0xf7, 0xba, 0xff, 0x01, 0x36, 0x63, 0x83, 0xff, 0x03, 0x38,
+  0x33, 0x33, 0xfd, 0xc2, 0xff, 0x02, 0x35, 0x33, 0xe4, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0xff, 0x03, 0x39, 0x33, 0x33, 0xfb, 0xba, 0xff, 0x01, 0x34,
+  0xf3, 0x83, 0xff, 0x02, 0x36, 0x33, 0x33, 0xc2, 0xff, 0x03, 0xef, 0x33,
+  0x33, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff, 0x02, 0x3a, 0x33, 0x33,
+  0xba, 0xff, 0x02, 0xdf, 0x33, 0xfb, 0x83, 0xff, 0x02, 0x37, 0x33, 0x73,
+  0xc3, 0xff, 0x02, 0x33, 0x33, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xd0, 0xff,
+  0x02, 0x3e, 0x33, 0x83, 0xba, 0xff, 0x01, 0xaf, 0x73, 0x84, 0xff, 0x02,
+  0x3b, 0x33, 0xd3, 0xc3, 0xff, 0x02, 0x39, 0x33, 0xf5, 0xff, 0xff, 0xff,
+  0xff, 0xd0, 0xff, 0x02, 0xef, 0x67, 0xf9, 0xba, 0xff, 0x01, 0x7f, 0xf3,
+  0x84, 0xff, 0x02, 0xef, 0x99, 0xfe, 0xc3, 0xff, 0x01, 0xbf, 0xa9, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x01, 0x4f, 0xfb, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xff, 0x02, 0x6e,
+  0x21, 0xf9, 0x95, 0xff, 0x02, 0x3b, 0x30, 0xfc, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xad, 0xff, 0x01, 0xcf, 0xfc, 0x93, 0xff, 0x02, 0x05, 0x00,
+  0x80, 0x94, 0xff, 0x03, 0xdf, 0x01, 0x00, 0xd1, 0x95, 0xff, 0x01, 0xcf,
+  0xfd, 0xaa, 0xff, 0x01, 0xef, 0xec, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff,
+  0x03, 0x3f, 0x00, 0x41, 0xfc, 0x91, 0xff, 0x02, 0x00, 0x00, 0x30, 0x94,
+  0xff, 0x03, 0x8f, 0x00, 0x00, 0x80, 0x93, 0xff, 0x03, 0x9f, 0x03, 0x00,
+  0xf7, 0xaa, 0xff, 0x03, 0xbf, 0x00, 0x30, 0xf6, 0xff, 0xff, 0xf6, 0xff,
+  0x03, 0x9f, 0x88, 0x88, 0xfd, 0x8c, 0xff, 0x86, 0xcc, 0xd7, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02, 0x00, 0x00, 0x30, 0x94, 0xff,
+  0x03, 0x8f, 0x00, 0x00, 0x90, 0x93, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7,
+  0xaa, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf5, 0xff, 0x04,
+  0xbf, 0x02, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x85, 0x00, 0x00, 0x60, 0xd7,
+  0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02, 0x05, 0x00, 0x90,
+  0x94, 0xff, 0x03, 0xef, 0x00, 0x00, 0xe1, 0x93, 0xff, 0x03, 0x7f, 0x00,
+  0x00, 0xf7, 0xaa, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf4,
+  0xff, 0x01, 0xdf, 0x05, 0x82, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x85, 0x00,
+  0x00, 0x80, 0xd7, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x91, 0xff, 0x02,
+  0x7f, 0x33, 0xfa, 0x95, 0xff, 0x02, 0x5d, 0x53, 0xfd, 0x93, 0xff, 0x03,
+  0x7f, 0x00, 0x00, 0xf7, 0xaa, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xf4, 0xff, 0x00, 0x18, 0x83, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x85,
+  0x00, 0x00, 0xb0, 0xd7, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xc1, 0xff,
+  0x03, 0x7f, 0x00, 0x00, 0xf7, 0x9a, 0xff, 0x01, 0xdf, 0xf8, 0x8d, 0xff,
+  0x03, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf3, 0xff, 0x00, 0x2c, 0x84,
+  0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00, 0x50, 0x82, 0x77, 0x00,
+  0xd7, 0xd7, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0xc1, 0xff, 0x03, 0x7f,
+  0x00, 0x00, 0xf7, 0x99, 0xff, 0x02, 0xcf, 0x06, 0xd0, 0x8d, 0xff, 0x03,
+  0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf3, 0xff, 0x06, 0x0c, 0x00, 0x00,
+  0x13, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x88, 0xff,
+  0x02, 0xad, 0xa8, 0xfc, 0x83, 0xff, 0x03, 0xbe, 0x88, 0xc8, 0xfe, 0x8e,
+  0xff, 0x01, 0xae, 0xb8, 0x82, 0xff, 0x02, 0xbd, 0xa8, 0xfc, 0x91, 0xff,
+  0x02, 0xcd, 0x98, 0xec, 0x90, 0xff, 0x01, 0x9c, 0xd8, 0x85, 0xff, 0x06,
+  0xcf, 0x89, 0xec, 0x3f, 0x00, 0x00, 0xfb, 0x82, 0xff, 0x02, 0xce, 0x89,
+  0xdc, 0x92, 0xff, 0x02, 0xbc, 0x88, 0xda, 0x83, 0xff, 0x02, 0xcf, 0x8b,
+  0xca, 0x8d, 0xff, 0x02, 0xac, 0x88, 0xc9, 0x88, 0xff, 0x0b, 0xce, 0x89,
+  0xc8, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xcf, 0x89, 0xec, 0x83, 0xff,
+  0x03, 0xce, 0x8a, 0xb8, 0xdc, 0x86, 0xff, 0x0a, 0xcf, 0x98, 0xfe, 0xff,
+  0xef, 0xbc, 0x88, 0x48, 0x01, 0x00, 0x90, 0x82, 0xff, 0x02, 0xbc, 0xa8,
+  0xfc, 0x84, 0xff, 0x06, 0xdf, 0x8b, 0xcb, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xf3, 0xff, 0x06, 0x7f, 0x00, 0x90, 0x3f, 0x00, 0x00, 0xfb, 0x8c,
+  0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x0a, 0x0b, 0x00, 0xb0, 0x5e,
+  0x00, 0x00, 0x50, 0xfe, 0xff, 0xff, 0x4b, 0x82, 0x00, 0x14, 0x60, 0xfd,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00,
+  0x70, 0x9f, 0x01, 0x10, 0xff, 0xff, 0x4c, 0x82, 0x00, 0x00, 0xe5, 0x84,
+  0xff, 0x0b, 0x0f, 0x00, 0x00, 0xf8, 0xff, 0xff, 0x08, 0x00, 0x40, 0xff,
+  0xff, 0x4a, 0x82, 0x00, 0x00, 0xa1, 0x82, 0xff, 0x0e, 0x03, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0xc0, 0x7f, 0x00, 0x70,
+  0x84, 0xff, 0x1c, 0xaf, 0x02, 0x00, 0x10, 0x39, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0x8e, 0x01, 0x00, 0x00, 0xb1, 0xff, 0xef, 0x00, 0x00, 0x80, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf8, 0x07, 0x00, 0x70, 0x82, 0xff, 0x00, 0x29,
+  0x82, 0x00, 0x08, 0xb4, 0xff, 0xff, 0xaf, 0x03, 0x00, 0x00, 0x70, 0xfe,
+  0x85, 0xff, 0x05, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x2a, 0x82, 0x00, 0x01,
+  0x81, 0xfe, 0x85, 0xff, 0x10, 0x6e, 0x01, 0x00, 0x00, 0x61, 0xfe, 0x7f,
+  0x00, 0x00, 0xc7, 0x04, 0x00, 0x10, 0xf9, 0xff, 0xff, 0x38, 0x83, 0x00,
+  0x0b, 0xe6, 0xff, 0xff, 0x7f, 0x00, 0x30, 0xef, 0x03, 0x00, 0xfc, 0xef,
+  0x18, 0x84, 0x00, 0x03, 0x40, 0xff, 0xff, 0x4b, 0x82, 0x00, 0x00, 0xe5,
+  0x82, 0xff, 0x07, 0xef, 0x06, 0x00, 0x00, 0xa5, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xf4, 0xff, 0x05, 0x62, 0xfe, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x03, 0x0b, 0x00, 0x60, 0x03, 0x82,
+  0x00, 0x02, 0xf5, 0xff, 0x9f, 0x84, 0x00, 0x12, 0xb0, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x30, 0x0b, 0x00,
+  0x30, 0xff, 0x9f, 0x83, 0x00, 0x01, 0x20, 0xfb, 0x83, 0xff, 0x0a, 0x5f,
+  0x00, 0x00, 0xf5, 0xff, 0xff, 0x04, 0x00, 0x80, 0xff, 0x8f, 0x84, 0x00,
+  0x11, 0xe5, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0xb0, 0x06, 0x00, 0xb0, 0x84, 0xff, 0x00, 0x09, 0x85,
+  0x00, 0x03, 0xfb, 0xff, 0xef, 0x03, 0x83, 0x00, 0x10, 0xf7, 0xff, 0x04,
+  0x00, 0x50, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xfd, 0x07, 0x00, 0x70, 0xff,
+  0xff, 0x6f, 0x84, 0x00, 0x02, 0xfa, 0xff, 0x08, 0x83, 0x00, 0x00, 0xc2,
+  0x85, 0xff, 0x04, 0x00, 0x00, 0xf0, 0xff, 0x6f, 0x84, 0x00, 0x00, 0xf2,
+  0x84, 0xff, 0x01, 0xcf, 0x01, 0x83, 0x00, 0x04, 0xf1, 0x7f, 0x00, 0x00,
+  0x13, 0x82, 0x00, 0x03, 0xc0, 0xff, 0xff, 0x02, 0x83, 0x00, 0x0a, 0x20,
+  0xfe, 0xff, 0x7f, 0x00, 0x00, 0x3e, 0x00, 0x00, 0xff, 0x1e, 0x83, 0x00,
+  0x04, 0x20, 0x76, 0xd9, 0xff, 0x9f, 0x83, 0x00, 0x04, 0x20, 0xfb, 0xff,
+  0xff, 0x3e, 0x85, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf6, 0xff, 0x03, 0x3f,
+  0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x00,
+  0x0b, 0x85, 0x00, 0x02, 0xc0, 0xff, 0x1d, 0x84, 0x00, 0x18, 0xf2, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x30,
+  0x04, 0x00, 0x70, 0xff, 0x0b, 0x00, 0x00, 0x10, 0x00, 0x00, 0xe1, 0x83,
+  0xff, 0x0a, 0x9f, 0x00, 0x00, 0xf2, 0xff, 0xff, 0x02, 0x00, 0xd0, 0xff,
+  0x08, 0x84, 0x00, 0x11, 0x50, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x60, 0x00, 0x00, 0xd0, 0x83, 0xff,
+  0x01, 0xdf, 0x01, 0x85, 0x00, 0x18, 0xfb, 0xff, 0x3f, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0x90, 0xff, 0x09, 0x00, 0x20, 0xff, 0xff, 0x0c, 0x00, 0x20,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x06, 0x83, 0x00, 0x08, 0x20, 0xfe,
+  0x8f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x85, 0xff, 0x04, 0x00, 0x00,
+  0xf0, 0xff, 0x09, 0x84, 0x00, 0x00, 0xf6, 0x84, 0xff, 0x00, 0x1e, 0x84,
+  0x00, 0x01, 0xf7, 0x7f, 0x85, 0x00, 0x03, 0x40, 0xff, 0xff, 0x08, 0x84,
+  0x00, 0x1b, 0xf6, 0xff, 0x7f, 0x00, 0x00, 0x08, 0x00, 0x20, 0xff, 0x03,
+  0x00, 0x00, 0x02, 0x00, 0x10, 0xf9, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xe1, 0xff, 0xff, 0x05, 0x85, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0x84, 0xff, 0x27, 0x0b, 0x00, 0x00, 0x30, 0x9a, 0x00, 0x00, 0xa0,
+  0xff, 0x07, 0x00, 0x20, 0xdb, 0x8b, 0x01, 0xfc, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x10, 0x00, 0x00, 0x90,
+  0xef, 0x02, 0x00, 0xa0, 0xff, 0x09, 0x00, 0x60, 0x83, 0xff, 0x1c, 0xef,
+  0x00, 0x00, 0xe0, 0xff, 0xdf, 0x00, 0x00, 0xf2, 0xdf, 0x00, 0x00, 0x20,
+  0xaa, 0x04, 0x00, 0x00, 0xfc, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00,
+  0x00, 0xf3, 0xff, 0x0b, 0x83, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x2e, 0x5f,
+  0x00, 0x00, 0x80, 0xac, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x50,
+  0xfe, 0x2e, 0x00, 0x10, 0xfe, 0x0e, 0x00, 0x00, 0xfe, 0xff, 0x08, 0x00,
+  0x80, 0xff, 0x07, 0x00, 0x70, 0xff, 0xbf, 0x00, 0x00, 0x20, 0x98, 0x06,
+  0xc0, 0xff, 0x1d, 0x00, 0x00, 0xfc, 0x8f, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x0a, 0x00, 0x00, 0xf0, 0xff, 0x03, 0x00, 0x50, 0xdb, 0x6b, 0x00, 0xfe,
+  0x84, 0xff, 0x07, 0x05, 0x00, 0x00, 0x96, 0x58, 0x20, 0xff, 0x7f, 0x82,
+  0x00, 0x0e, 0xb6, 0x04, 0x00, 0x30, 0xff, 0xff, 0x1d, 0x95, 0xdb, 0x4b,
+  0x00, 0x00, 0xf0, 0xff, 0x7f, 0x83, 0x00, 0x1b, 0x40, 0x9f, 0x00, 0x00,
+  0xd1, 0xff, 0x09, 0x00, 0x90, 0xff, 0xef, 0x01, 0x00, 0xb0, 0xff, 0x09,
+  0x00, 0x60, 0xff, 0xbf, 0x00, 0x00, 0x40, 0xcb, 0x06, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x85,
+  0x00, 0x1c, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x70,
+  0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0xcf, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x82, 0x00, 0x0a, 0x75, 0xd7,
+  0x9f, 0x00, 0x00, 0xf5, 0xff, 0x5f, 0x00, 0x00, 0xfd, 0x83, 0xff, 0x1b,
+  0x04, 0x00, 0xa0, 0xff, 0x9f, 0x00, 0x00, 0xf8, 0x6f, 0x00, 0x00, 0xe1,
+  0xff, 0x4f, 0x00, 0x00, 0xf4, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00,
+  0x00, 0xf3, 0xff, 0x0b, 0x82, 0x00, 0x01, 0x76, 0xf9, 0x83, 0xff, 0x2e,
+  0x0e, 0x00, 0x00, 0xf8, 0xff, 0x1e, 0x00, 0x00, 0xfb, 0xff, 0x02, 0x00,
+  0xd0, 0xff, 0xbf, 0x00, 0x00, 0xf8, 0x3f, 0x00, 0x00, 0xfa, 0xff, 0x04,
+  0x00, 0xc0, 0xff, 0x07, 0x00, 0x70, 0xff, 0x4f, 0x00, 0x00, 0xe4, 0xff,
+  0xdf, 0xfa, 0xff, 0x08, 0x00, 0x70, 0xff, 0xff, 0x01, 0x00, 0xf1, 0x84,
+  0xff, 0x09, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xce,
+  0x84, 0xff, 0x0f, 0xdf, 0x00, 0x00, 0x80, 0xff, 0xff, 0xcb, 0xff, 0x7f,
+  0x00, 0x00, 0xc0, 0xff, 0x0e, 0x00, 0x00, 0x85, 0xff, 0x04, 0x02, 0x00,
+  0xd0, 0xff, 0x7f, 0x82, 0x00, 0x1c, 0x72, 0xb7, 0x6f, 0x00, 0x00, 0xf9,
+  0xff, 0x2f, 0x00, 0x10, 0xff, 0x9f, 0x00, 0x00, 0xf5, 0xff, 0x3f, 0x00,
+  0x00, 0xfd, 0x5f, 0x00, 0x00, 0xe1, 0xff, 0x8f, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x85, 0x00,
+  0x0e, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xfe, 0xff, 0x06, 0x00, 0x70, 0xff,
+  0x07, 0x00, 0x10, 0xfb, 0x83, 0xff, 0x17, 0x07, 0x00, 0x70, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x90, 0xff, 0xff, 0x4f, 0x00,
+  0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x1e, 0x08, 0x00,
+  0x70, 0xff, 0x5f, 0x00, 0x00, 0xfd, 0x2f, 0x00, 0x00, 0xf8, 0xff, 0xaf,
+  0x00, 0x00, 0xf0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0x00, 0xc0, 0x85, 0xff, 0x22, 0x0a, 0x00, 0x00, 0xfe,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0xcf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x00,
+  0x00, 0xf3, 0x8f, 0x00, 0x00, 0xf6, 0xff, 0x02, 0x00, 0xf1, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x0d, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x07, 0x03, 0x00,
+  0xd0, 0xff, 0xff, 0x07, 0x00, 0xb0, 0x84, 0xff, 0x07, 0x00, 0x00, 0xf0,
+  0xff, 0x02, 0x00, 0x30, 0xfd, 0x86, 0xff, 0x03, 0x8f, 0x00, 0x00, 0xf1,
+  0x83, 0xff, 0x07, 0x7f, 0x00, 0x00, 0xf6, 0xff, 0x0f, 0x00, 0x00, 0x85,
+  0xff, 0x24, 0x04, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0x30, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0xff, 0x5f, 0x00, 0x00, 0xfd, 0x4f, 0x00, 0x00,
+  0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x1f, 0x00, 0x00, 0xf8, 0xff, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0xff, 0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb,
+  0x8c, 0xff, 0x85, 0x00, 0x0f, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x0a, 0x00, 0x00, 0x20, 0xb6, 0x82, 0xff, 0x17,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00,
+  0xf3, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0xbf, 0x00, 0x00, 0xf7,
+  0x83, 0xff, 0x1e, 0x0d, 0x00, 0x30, 0xff, 0x2f, 0x00, 0x20, 0xff, 0x0e,
+  0x00, 0x00, 0xfb, 0xff, 0xff, 0x00, 0x00, 0xd0, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x00, 0xf8, 0x85, 0xff,
+  0x21, 0x07, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x7f, 0x00,
+  0x00, 0xf6, 0xff, 0xff, 0x03, 0x00, 0xf3, 0xdf, 0x00, 0x00, 0xf3, 0xdf,
+  0x00, 0x00, 0xf6, 0xff, 0x07, 0x00, 0x70, 0xff, 0x09, 0x00, 0x00, 0x84,
+  0xff, 0x07, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0xa0, 0x84, 0xff,
+  0x08, 0x00, 0x00, 0xf0, 0xff, 0x05, 0x00, 0x00, 0x30, 0xd7, 0x85, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x07, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x27, 0xcf, 0xac, 0x88, 0x04, 0x00,
+  0xb0, 0xff, 0x7f, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfa,
+  0xff, 0x3f, 0x00, 0x00, 0xfd, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0xbf, 0x00,
+  0x00, 0xf7, 0x0d, 0x00, 0x00, 0xfb, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00,
+  0x00, 0x50, 0x82, 0x77, 0x0b, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x4f, 0x83, 0x00, 0x12, 0x92, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0xf9,
+  0xff, 0xff, 0x0f, 0x86, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x0a, 0x2f, 0x00,
+  0x00, 0xff, 0x0d, 0x00, 0x60, 0xff, 0x0b, 0x00, 0x00, 0x82, 0xff, 0x10,
+  0x00, 0x00, 0xb0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0x00, 0xfe, 0x85, 0xff, 0x09, 0x05, 0x00, 0x30, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0x6f, 0x86, 0x00, 0x10, 0xf0, 0xff, 0x02,
+  0x00, 0xf0, 0x9f, 0x00, 0x00, 0xfc, 0xff, 0x07, 0x00, 0x70, 0xff, 0x07,
+  0x00, 0x00, 0x83, 0xff, 0x00, 0xef, 0x86, 0x00, 0x00, 0x70, 0x84, 0xff,
+  0x04, 0x00, 0x00, 0xf0, 0xff, 0x0e, 0x83, 0x00, 0x00, 0xb3, 0x84, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x0b, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xaf, 0x03, 0x83, 0x00, 0x11, 0xb0,
+  0xff, 0x7f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xe4, 0xff,
+  0x0c, 0x00, 0x00, 0xff, 0x0f, 0x86, 0x00, 0x09, 0xf6, 0x0b, 0x00, 0x00,
+  0xff, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xf6, 0xff, 0x03, 0x3f,
+  0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x0a,
+  0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x05, 0x83,
+  0x00, 0x11, 0xf5, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x0f, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x0f, 0x86, 0x00, 0x00, 0xf3,
+  0x83, 0xff, 0x0a, 0x7f, 0x00, 0x00, 0xfc, 0x0a, 0x00, 0xc0, 0xff, 0x0b,
+  0x00, 0x00, 0x82, 0xff, 0x0f, 0x00, 0x00, 0x90, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0x86, 0xff, 0x09,
+  0x03, 0x00, 0x60, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x3f, 0x86, 0x00,
+  0x10, 0xf0, 0xff, 0x08, 0x00, 0xb0, 0x5f, 0x00, 0x10, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x07, 0x00, 0x30, 0x83, 0xff, 0x00, 0xbf, 0x86, 0x00,
+  0x00, 0x70, 0x84, 0xff, 0x05, 0x00, 0x00, 0xf0, 0xff, 0xdf, 0x02, 0x83,
+  0x00, 0x00, 0xf7, 0x83, 0xff, 0x03, 0x1f, 0x00, 0x00, 0xf7, 0x83, 0xff,
+  0x0a, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x05,
+  0x84, 0x00, 0x11, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xdf,
+  0x00, 0x00, 0x20, 0x67, 0x01, 0x00, 0x70, 0xff, 0x0f, 0x86, 0x00, 0x09,
+  0xf3, 0x0b, 0x00, 0x00, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0xf6, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x8c, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0x84, 0xff, 0x0b, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0xbf, 0x05, 0x82, 0x00, 0x0d, 0x80, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x00,
+  0x0f, 0x86, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x0a, 0xcf, 0x00, 0x00, 0xf8,
+  0x06, 0x00, 0xf1, 0xff, 0x0c, 0x00, 0x00, 0x82, 0xff, 0x0f, 0x00, 0x00,
+  0xb0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0x0b,
+  0x00, 0x30, 0x86, 0xff, 0x09, 0x06, 0x00, 0x30, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xfb, 0x7f, 0x86, 0x00, 0x10, 0xf0, 0xff, 0x0d, 0x00, 0x80, 0x3f,
+  0x00, 0x60, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x07, 0x00, 0x20, 0x84,
+  0xff, 0x86, 0x00, 0x00, 0x70, 0x84, 0xff, 0x06, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x9f, 0x03, 0x82, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x03, 0x3f, 0x00,
+  0x00, 0xf7, 0x83, 0xff, 0x15, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x6f, 0x00, 0x00, 0x60, 0xba, 0x05, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0x82, 0xff, 0x00, 0x0c, 0x84, 0x00, 0x02, 0xe2, 0xff,
+  0x0f, 0x86, 0x00, 0x09, 0xf4, 0x0b, 0x00, 0x00, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xf6, 0xff, 0x06, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0xec, 0x89, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x07, 0x0b,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x82, 0xff, 0x11, 0xef, 0x5a,
+  0x00, 0x00, 0x20, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x89,
+  0xff, 0x1c, 0x01, 0x00, 0xf4, 0x03, 0x00, 0xf6, 0xff, 0x0f, 0x00, 0x00,
+  0xfc, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf,
+  0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0x86, 0xff, 0x0c, 0x07, 0x00,
+  0x30, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x8f, 0x00, 0x00, 0xf5, 0x85,
+  0xff, 0x0e, 0x2f, 0x00, 0x40, 0x0e, 0x00, 0xa0, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x08, 0x00, 0x00, 0x84, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x89,
+  0xff, 0x02, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x04, 0xdf, 0x39, 0x00, 0x00,
+  0x40, 0x83, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x15, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xfc,
+  0xff, 0x07, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x01,
+  0xdf, 0x01, 0x82, 0x00, 0x06, 0x60, 0xfe, 0xff, 0x3f, 0x00, 0x00, 0xfd,
+  0x84, 0xff, 0x08, 0x0f, 0x00, 0x00, 0xfc, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0xff, 0xf6, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x1b, 0x00,
+  0xf8, 0x88, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x07, 0x0b, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0f, 0x0a, 0x00, 0x00,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00,
+  0x00, 0x82, 0xff, 0x03, 0x4f, 0x00, 0x00, 0xf8, 0x89, 0xff, 0x1c, 0x05,
+  0x00, 0xe2, 0x00, 0x00, 0xfc, 0xff, 0x2f, 0x00, 0x00, 0xf9, 0xff, 0xaf,
+  0x00, 0x00, 0xf0, 0xff, 0x03, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xf3,
+  0xff, 0x0b, 0x00, 0x30, 0x86, 0xff, 0x0c, 0x09, 0x00, 0x10, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0xbf, 0x00, 0x00, 0xf2, 0x85, 0xff, 0x0f, 0x8f,
+  0x00, 0x10, 0x0a, 0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x0c,
+  0x00, 0x00, 0xfb, 0x83, 0xff, 0x02, 0x03, 0x00, 0xa0, 0x89, 0xff, 0x02,
+  0x00, 0x00, 0xf0, 0x84, 0xff, 0x02, 0x05, 0x00, 0x30, 0x83, 0xff, 0x03,
+  0x6f, 0x00, 0x00, 0xf2, 0x83, 0xff, 0x15, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0x0c, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0xb0,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x0b, 0x3f, 0x00, 0x40, 0x33,
+  0x84, 0xfd, 0xff, 0xff, 0x4f, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x0b, 0x0f,
+  0x00, 0x00, 0xfa, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0xfc, 0xff,
+  0xff, 0xf3, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xa0,
+  0x88, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x1c, 0x0b, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xcf, 0xf9, 0xff, 0xff, 0x0d, 0x00,
+  0x00, 0xff, 0x09, 0x00, 0x30, 0xff, 0x6f, 0x00, 0x00, 0xf0, 0xff, 0x0f,
+  0x00, 0x00, 0x82, 0xff, 0x07, 0x9f, 0x00, 0x00, 0xe1, 0xff, 0xff, 0xaf,
+  0xfd, 0x85, 0xff, 0x1c, 0x0a, 0x00, 0x80, 0x00, 0x00, 0xff, 0xff, 0x5f,
+  0x00, 0x00, 0xf4, 0xff, 0x5f, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x90,
+  0xff, 0x3e, 0x00, 0x00, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0x86, 0xff, 0x29,
+  0x0d, 0x00, 0x00, 0xfa, 0xff, 0x09, 0x00, 0x00, 0xfb, 0xef, 0x00, 0x00,
+  0x90, 0xff, 0xff, 0xdf, 0xfa, 0xff, 0xff, 0xdf, 0x00, 0x00, 0x04, 0x00,
+  0xf5, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x2f, 0x00, 0x00, 0xe4, 0xff,
+  0xdf, 0xfa, 0xff, 0x07, 0x00, 0x40, 0x82, 0xff, 0x00, 0xea, 0x85, 0xff,
+  0x0a, 0x00, 0x00, 0xf0, 0xff, 0xaf, 0xfb, 0xff, 0xff, 0x09, 0x00, 0x30,
+  0x83, 0xff, 0x1d, 0xcf, 0x00, 0x00, 0x80, 0xff, 0xff, 0xda, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xef, 0x03, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x02,
+  0x07, 0x00, 0xf7, 0x84, 0xff, 0x15, 0x9f, 0x00, 0x00, 0xf2, 0xff, 0xff,
+  0xaf, 0xfd, 0xff, 0x3f, 0x00, 0x00, 0xf5, 0xff, 0x3e, 0x00, 0x00, 0xf3,
+  0xff, 0x19, 0x10, 0xf9, 0xff, 0xff, 0xf2, 0xff, 0x07, 0x3f, 0x00, 0x00,
+  0xfb, 0xcf, 0x00, 0x00, 0x70, 0x88, 0xff, 0x02, 0x00, 0x00, 0x30, 0x82,
+  0x44, 0x1e, 0x64, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0x1c, 0x20, 0xc8, 0xcd, 0x05, 0x00, 0x10, 0xff, 0x0b, 0x00, 0x00,
+  0xba, 0x06, 0x00, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x83, 0xff, 0x06,
+  0x02, 0x00, 0x20, 0xcb, 0xac, 0x04, 0xf3, 0x85, 0xff, 0x1c, 0x0f, 0x00,
+  0x30, 0x00, 0x50, 0xff, 0xff, 0xef, 0x00, 0x00, 0x50, 0xbb, 0x05, 0x00,
+  0x00, 0xfb, 0xff, 0x05, 0x00, 0x30, 0xab, 0x03, 0x00, 0x00, 0xf3, 0xff,
+  0x0b, 0x00, 0x30, 0x86, 0xff, 0x10, 0x3f, 0x00, 0x00, 0x91, 0x7c, 0x01,
+  0x00, 0x00, 0xfb, 0xff, 0x09, 0x00, 0x00, 0xc8, 0xcd, 0x17, 0xb0, 0x82,
+  0xff, 0x00, 0x01, 0x82, 0x00, 0x15, 0xfa, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xaf, 0x00, 0x00, 0x20, 0x86, 0x05, 0xc0, 0xff, 0x1e, 0x00, 0x00,
+  0xb4, 0xcc, 0x2a, 0x50, 0x85, 0xff, 0x0a, 0x00, 0x00, 0xf0, 0xff, 0x09,
+  0x40, 0xca, 0xbd, 0x03, 0x00, 0x50, 0x84, 0xff, 0x1c, 0x03, 0x00, 0x00,
+  0x73, 0x38, 0x40, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0x0e, 0x00, 0x00, 0xc9, 0x3b, 0x00, 0x00, 0x50, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0x82, 0xff, 0x05, 0x03, 0x00, 0x71, 0x88, 0x88, 0xdb, 0x82,
+  0xff, 0x14, 0x02, 0x00, 0x30, 0xcb, 0xac, 0x04, 0xf4, 0xff, 0x9f, 0x00,
+  0x00, 0x50, 0x9c, 0x03, 0x00, 0x00, 0xf3, 0xdf, 0x00, 0x00, 0xd0, 0xff,
+  0xff, 0xf2, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0x80,
+  0x88, 0xff, 0x85, 0x00, 0x0b, 0x30, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xcf, 0x01, 0x84, 0x00, 0x02, 0x90, 0xff, 0x0e, 0x85,
+  0x00, 0x04, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x83, 0xff, 0x00, 0x0b, 0x84,
+  0x00, 0x00, 0x60, 0x85, 0xff, 0x00, 0x4f, 0x82, 0x00, 0x00, 0xa0, 0x82,
+  0xff, 0x00, 0x08, 0x84, 0x00, 0x03, 0x60, 0xff, 0xff, 0x08, 0x85, 0x00,
+  0x04, 0xf3, 0xff, 0x0b, 0x00, 0x30, 0x86, 0xff, 0x00, 0xbf, 0x86, 0x00,
+  0x02, 0xfb, 0xff, 0x3f, 0x84, 0x00, 0x04, 0x10, 0xfe, 0xff, 0xff, 0x06,
+  0x82, 0x00, 0x82, 0xff, 0x05, 0x07, 0x00, 0x70, 0xff, 0xff, 0x04, 0x83,
+  0x00, 0x02, 0x30, 0xfe, 0x9f, 0x85, 0x00, 0x00, 0xf8, 0x84, 0xff, 0x03,
+  0x00, 0x00, 0xf0, 0x9f, 0x85, 0x00, 0x00, 0xd0, 0x84, 0xff, 0x00, 0x0d,
+  0x84, 0x00, 0x0a, 0xf7, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0x2f, 0x86, 0x00, 0x04, 0xf9, 0x7f, 0x00, 0x00, 0xf7, 0x82, 0xff,
+  0x00, 0x05, 0x84, 0x00, 0x03, 0xc4, 0xff, 0xff, 0x0b, 0x84, 0x00, 0x03,
+  0x70, 0xff, 0xff, 0x01, 0x85, 0x00, 0x04, 0xf3, 0xaf, 0x00, 0x00, 0xa0,
+  0xff, 0xff, 0xf2, 0xff, 0x07, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x08, 0x00,
+  0xf2, 0x88, 0xff, 0x85, 0x00, 0x0b, 0x30, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0xef, 0x03, 0x84, 0x00, 0x02, 0xf5, 0xff, 0x7f,
+  0x82, 0x00, 0x07, 0x30, 0x06, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0x83,
+  0xff, 0x00, 0xaf, 0x84, 0x00, 0x00, 0x70, 0x85, 0xff, 0x00, 0x9f, 0x82,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x7f, 0x84, 0x00, 0x03, 0xf5, 0xff,
+  0xff, 0x1e, 0x82, 0x00, 0x07, 0x90, 0x02, 0x00, 0xf3, 0xff, 0x0b, 0x00,
+  0x30, 0x87, 0xff, 0x00, 0x05, 0x82, 0x00, 0x06, 0x71, 0x00, 0x00, 0xfb,
+  0xff, 0xef, 0x04, 0x83, 0x00, 0x07, 0x30, 0xfc, 0xff, 0xff, 0x0c, 0x00,
+  0x00, 0x40, 0x82, 0xff, 0x05, 0x07, 0x00, 0x70, 0xff, 0xff, 0x4e, 0x84,
+  0x00, 0x02, 0xfb, 0xff, 0x08, 0x84, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x03,
+  0x00, 0x00, 0xf0, 0xbf, 0x85, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x00, 0xcf,
+  0x84, 0x00, 0x0a, 0xf1, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xcf, 0x83, 0x00, 0x07, 0x94, 0x00, 0x00, 0xfe, 0x7f, 0x00, 0x00,
+  0xf7, 0x82, 0xff, 0x00, 0x0c, 0x84, 0x00, 0x03, 0x10, 0xfc, 0xff, 0xaf,
+  0x84, 0x00, 0x03, 0x70, 0xff, 0xff, 0x0c, 0x82, 0x00, 0x07, 0x90, 0x00,
+  0x00, 0xf3, 0xcf, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xf7, 0xff, 0x01, 0xcf,
+  0xa7, 0x89, 0xff, 0x85, 0x00, 0x0c, 0x30, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0x9f, 0x01, 0x82, 0x00, 0x0e, 0xa1, 0xff,
+  0xff, 0xef, 0x06, 0x00, 0x00, 0xf6, 0x0a, 0x00, 0xf0, 0xff, 0x0f, 0x00,
+  0x00, 0x84, 0xff, 0x00, 0x4e, 0x82, 0x00, 0x01, 0x50, 0xfd, 0x85, 0xff,
+  0x00, 0xef, 0x82, 0x00, 0x00, 0xf5, 0x83, 0xff, 0x00, 0x2c, 0x82, 0x00,
+  0x00, 0xa2, 0x82, 0xff, 0x0b, 0xcf, 0x02, 0x00, 0x00, 0xf9, 0x03, 0x00,
+  0xf3, 0xff, 0x0b, 0x00, 0x30, 0x87, 0xff, 0x0a, 0x9f, 0x00, 0x00, 0x20,
+  0xce, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x01, 0x10, 0xfb,
+  0x82, 0xff, 0x03, 0x1f, 0x00, 0x00, 0x90, 0x82, 0xff, 0x02, 0x07, 0x00,
+  0x70, 0x82, 0xff, 0x00, 0x18, 0x82, 0x00, 0x04, 0xd4, 0xff, 0xff, 0xdf,
+  0x03, 0x82, 0x00, 0x00, 0xe7, 0x85, 0xff, 0x04, 0x00, 0x00, 0xf0, 0xff,
+  0x7e, 0x83, 0x00, 0x00, 0xc3, 0x86, 0xff, 0x00, 0x5e, 0x82, 0x00, 0x17,
+  0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x1b, 0x00, 0x00, 0x50, 0xff, 0x08, 0x40, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0x82, 0xff, 0x01, 0xdf, 0x05, 0x84, 0x00, 0x03, 0xf2, 0xff, 0xff, 0x3d,
+  0x82, 0x00, 0x04, 0x50, 0xfe, 0xff, 0xff, 0xcf, 0x82, 0x00, 0x07, 0xf9,
+  0x03, 0x00, 0xf3, 0xff, 0x05, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xff, 0x95,
+  0xff, 0x03, 0xdf, 0x7a, 0x77, 0xda, 0x83, 0xff, 0x02, 0xcf, 0x89, 0xfb,
+  0x8d, 0xff, 0x02, 0xcf, 0x7a, 0xca, 0x88, 0xff, 0x03, 0x9f, 0x00, 0x00,
+  0xfb, 0x84, 0xff, 0x02, 0xbe, 0x78, 0xca, 0x84, 0xff, 0x02, 0xbe, 0x98,
+  0xfc, 0x90, 0xff, 0x02, 0xbf, 0xa8, 0xfd, 0x86, 0xff, 0x03, 0xef, 0x8b,
+  0xb8, 0xfe, 0x91, 0xff, 0x02, 0xac, 0x87, 0xeb, 0x84, 0xff, 0x02, 0x9b,
+  0xb7, 0xfd, 0x8b, 0xff, 0x03, 0xcf, 0x79, 0x77, 0xeb, 0x88, 0xff, 0x02,
+  0xbe, 0x79, 0xca, 0x8c, 0xff, 0x05, 0x9b, 0xb8, 0xff, 0xff, 0xef, 0xcb,
+  0x89, 0xff, 0x05, 0xbe, 0xbb, 0x7b, 0x00, 0x00, 0xb0, 0x82, 0xff, 0x02,
+  0xcf, 0x7a, 0xca, 0x84, 0xff, 0x02, 0xdf, 0x89, 0xfc, 0x84, 0xff, 0x01,
+  0xbf, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xff, 0x02, 0x2e, 0x00, 0x20,
+  0xff, 0xff, 0x82, 0xff, 0x02, 0x8b, 0x88, 0xf8, 0x82, 0xff, 0x02, 0x04,
+  0x00, 0xa0, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x03, 0xbf, 0x03, 0x00,
+  0x90, 0xff, 0xff, 0x82, 0xff, 0x02, 0x07, 0x00, 0xc0, 0x82, 0xff, 0x02,
+  0x03, 0x00, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0x04, 0x6b, 0x02,
+  0x00, 0x00, 0xf5, 0xff, 0xff, 0x82, 0xff, 0x08, 0x09, 0x00, 0x10, 0xb8,
+  0xbc, 0x38, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0x03,
+  0x07, 0x00, 0x00, 0x40, 0xff, 0xff, 0x83, 0xff, 0x00, 0x0f, 0x86, 0x00,
+  0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xce, 0xff, 0x03, 0x0a, 0x00, 0x00,
+  0xe7, 0xff, 0xff, 0x83, 0xff, 0x01, 0xcf, 0x01, 0x84, 0x00, 0x00, 0x91,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0x02, 0x0b, 0x42, 0xe8, 0xff, 0xff,
+  0x85, 0xff, 0x05, 0x9f, 0x15, 0x00, 0x00, 0x30, 0xb5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x02, 0xef, 0x16,
+  0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xff, 0x01, 0xce, 0xfe,
+  0x9f, 0xff, 0x00, 0xcd, 0x85, 0xff, 0x03, 0x5f, 0x00, 0x00, 0xf8, 0x94,
+  0xff, 0x01, 0xdf, 0xfc, 0xf5, 0xff, 0x01, 0xcf, 0xfd, 0xff, 0xff, 0xff,
+  0xff, 0xa1, 0xff, 0x03, 0x6f, 0x03, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x4f,
+  0x01, 0x00, 0x85, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xf3, 0x93, 0xff, 0x02,
+  0x24, 0x00, 0xf0, 0xf3, 0xff, 0x03, 0x6f, 0x03, 0x00, 0xf7, 0xff, 0xff,
+  0xb5, 0xff, 0x04, 0xdf, 0x27, 0x00, 0x10, 0xb6, 0x8d, 0xff, 0x02, 0xcc,
+  0xcc, 0xec, 0xd5, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02,
+  0x0f, 0x00, 0x00, 0x85, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xf3, 0x93, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0xf3, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x91,
+  0xff, 0x00, 0xef, 0x82, 0xcc, 0x06, 0xfd, 0xff, 0xff, 0xce, 0xcc, 0xcc,
+  0xdc, 0xff, 0xff, 0x98, 0xff, 0x00, 0x08, 0x83, 0x00, 0x00, 0xe6, 0x8c,
+  0xff, 0x02, 0x00, 0x00, 0xb0, 0xd1, 0xff, 0x07, 0xdf, 0xfd, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x85, 0xff,
+  0x03, 0x5f, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0xcf, 0x8f, 0xff, 0x02,
+  0x00, 0x00, 0xf0, 0x91, 0xff, 0x00, 0xfc, 0x84, 0xff, 0x00, 0xed, 0x9a,
+  0xff, 0x01, 0xdf, 0xfd, 0xb9, 0xff, 0x07, 0xef, 0xfd, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0x91, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x06, 0xf6, 0xff,
+  0xff, 0x09, 0x00, 0x00, 0x70, 0xff, 0xff, 0x97, 0xff, 0x00, 0x5f, 0x84,
+  0x00, 0x00, 0x40, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xcf, 0xff, 0x09,
+  0x6f, 0x04, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff,
+  0x02, 0x0f, 0x00, 0x00, 0x86, 0xff, 0x06, 0x37, 0xa3, 0xff, 0xff, 0x4f,
+  0x02, 0x00, 0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x8f, 0xff, 0x02, 0x24,
+  0x00, 0xf0, 0x82, 0xff, 0x02, 0x46, 0x00, 0xb0, 0x98, 0xff, 0x03, 0x6f,
+  0x04, 0x00, 0xf7, 0xb7, 0xff, 0x09, 0x9f, 0x14, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0x91, 0xff, 0x00, 0xbf, 0x82, 0x00, 0x06, 0xf3,
+  0xff, 0xff, 0x06, 0x00, 0x00, 0x50, 0xff, 0xff, 0x97, 0xff, 0x03, 0x07,
+  0x00, 0x00, 0x11, 0x82, 0x00, 0x00, 0xf9, 0x8b, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0x9d, 0xff, 0x01, 0x9f, 0xfe, 0xaf, 0xff, 0x09, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00,
+  0x00, 0x8a, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x8f, 0xff, 0x02, 0x00, 0x00,
+  0xf0, 0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x03, 0x00,
+  0xb0, 0x98, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0xb7, 0xff, 0x09, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0x91, 0xff, 0x00,
+  0x7f, 0x82, 0x00, 0x06, 0xf0, 0xff, 0xff, 0x03, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x97, 0xff, 0x07, 0x4e, 0x00, 0xd3, 0xff, 0x1d, 0x00, 0x00, 0xf2,
+  0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x9c, 0xff, 0x02, 0x9e, 0x02, 0xf9,
+  0xaf, 0xff, 0x09, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x8a, 0xff, 0x02, 0x0f, 0x00,
+  0x00, 0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x8f, 0xff, 0x02, 0x00, 0x00,
+  0xf0, 0x82, 0xff, 0x02, 0x03, 0x00, 0xb0, 0x98, 0xff, 0x03, 0x3f, 0x00,
+  0x00, 0xf7, 0xb7, 0xff, 0x09, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0x91, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x02, 0xc0, 0xff,
+  0xff, 0x82, 0x00, 0x00, 0x30, 0xff, 0xff, 0x98, 0xff, 0x06, 0x58, 0xff,
+  0xff, 0xaf, 0x00, 0x00, 0xf0, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x86,
+  0xff, 0x02, 0xcf, 0x8b, 0xca, 0x87, 0xff, 0x02, 0xbe, 0x98, 0xfc, 0x83,
+  0xff, 0x06, 0xcf, 0x8c, 0x88, 0x36, 0x00, 0x00, 0xf4, 0x87, 0xff, 0x02,
+  0x9c, 0xc8, 0xfe, 0x85, 0xff, 0x07, 0xdf, 0x8a, 0xfb, 0xff, 0xff, 0xcf,
+  0x8b, 0xca, 0x84, 0xff, 0x03, 0xef, 0x8c, 0x88, 0xeb, 0x83, 0xff, 0x03,
+  0xcf, 0x89, 0xa8, 0xfc, 0x85, 0xff, 0x0c, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0xcf, 0x88, 0xec, 0x84, 0xff, 0x02, 0xbc,
+  0xa8, 0xfc, 0x92, 0xff, 0x06, 0x0f, 0x00, 0x00, 0xff, 0xbe, 0xa8, 0xfc,
+  0x86, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x84, 0xff, 0x02, 0xcf, 0x8b, 0xca,
+  0x87, 0xff, 0x05, 0x00, 0x00, 0xf0, 0xdf, 0x8a, 0xeb, 0x8c, 0xff, 0x02,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x03, 0x00, 0xb0, 0x84, 0xff, 0x02,
+  0xce, 0x8a, 0xcb, 0x87, 0xff, 0x02, 0xad, 0xa8, 0xfc, 0x85, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x02, 0xac, 0xb8, 0xfc, 0x89, 0xff,
+  0x02, 0xbc, 0xa8, 0xfc, 0x86, 0xff, 0x02, 0xef, 0x8a, 0xdb, 0x84, 0xff,
+  0x03, 0xef, 0x9c, 0xc8, 0xfe, 0x86, 0xff, 0x02, 0xae, 0x98, 0xfc, 0x85,
+  0xff, 0x0c, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7,
+  0xcf, 0x88, 0xec, 0x84, 0xff, 0x02, 0xbc, 0xa8, 0xfc, 0x86, 0xff, 0x00,
+  0x7f, 0x82, 0x00, 0x02, 0x80, 0xff, 0xcf, 0x82, 0x00, 0x00, 0x30, 0x83,
+  0xff, 0x02, 0xce, 0x89, 0xec, 0x86, 0xff, 0x02, 0xef, 0x8a, 0xca, 0xff,
+  0xff, 0x8a, 0xff, 0x03, 0xcf, 0x00, 0x00, 0xf0, 0x8b, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x85, 0xff, 0x13, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfd, 0xff,
+  0xff, 0x0f, 0x00, 0x60, 0x8f, 0x01, 0x00, 0x30, 0xfc, 0xff, 0xff, 0xaf,
+  0x02, 0x84, 0x00, 0x00, 0xe0, 0x83, 0xff, 0x06, 0x0b, 0x00, 0xb0, 0x4c,
+  0x00, 0x00, 0x60, 0x82, 0xff, 0x0b, 0x00, 0x00, 0xfa, 0x07, 0x00, 0xf4,
+  0xff, 0xaf, 0x03, 0x00, 0x00, 0x70, 0x82, 0xff, 0x01, 0xdf, 0x05, 0x82,
+  0x00, 0x08, 0xc5, 0xff, 0xff, 0x8e, 0x01, 0x00, 0x00, 0x20, 0xfa, 0x83,
+  0xff, 0x00, 0x0f, 0x84, 0x00, 0x08, 0xfb, 0x3f, 0x00, 0x00, 0xab, 0x02,
+  0x00, 0x20, 0xfb, 0x82, 0xff, 0x00, 0x3a, 0x82, 0x00, 0x00, 0xf8, 0x84,
+  0xff, 0x1a, 0x2f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x60, 0xff, 0xcf,
+  0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x40, 0xfe, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x08, 0x30, 0xff, 0xff, 0xaf,
+  0x03, 0x00, 0x00, 0x70, 0xfe, 0x85, 0xff, 0x11, 0x00, 0x00, 0xe0, 0x07,
+  0x00, 0x00, 0xe3, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0x7f, 0x84, 0x00, 0x00, 0xb3, 0x84, 0x00, 0x12, 0xd0, 0xff, 0xff,
+  0x6e, 0x01, 0x00, 0x00, 0x70, 0xfe, 0xff, 0xff, 0x0b, 0x00, 0xb0, 0x5e,
+  0x00, 0x00, 0x50, 0xfe, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x03, 0xfb,
+  0xff, 0xef, 0x17, 0x82, 0x00, 0x00, 0xe7, 0x87, 0xff, 0x00, 0x29, 0x82,
+  0x00, 0x00, 0xd4, 0x82, 0xff, 0x06, 0x00, 0x00, 0xe4, 0x07, 0x00, 0x00,
+  0xc3, 0x82, 0xff, 0x0f, 0xef, 0x16, 0x00, 0x00, 0x20, 0xfb, 0xff, 0xff,
+  0x0f, 0x00, 0x90, 0x7e, 0x00, 0x00, 0x40, 0xfe, 0x83, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x08, 0xfa, 0x3f, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x10, 0xfa,
+  0x82, 0xff, 0x00, 0x4b, 0x82, 0x00, 0x00, 0xe7, 0x85, 0xff, 0x0a, 0x4f,
+  0x00, 0x40, 0x00, 0x50, 0xff, 0x9f, 0x00, 0x30, 0x00, 0x00, 0x82, 0xff,
+  0x18, 0x6e, 0x01, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xe9,
+  0x07, 0x00, 0x00, 0xe5, 0xff, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf0, 0x8b, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0x84, 0xff, 0x01, 0xef, 0x04, 0x83, 0x00, 0x06, 0x81,
+  0xff, 0xff, 0x0f, 0x00, 0x30, 0x06, 0x82, 0x00, 0x03, 0xf2, 0xff, 0xff,
+  0x05, 0x83, 0x00, 0x02, 0x50, 0x87, 0xfc, 0x83, 0xff, 0x03, 0x0b, 0x00,
+  0x40, 0x01, 0x82, 0x00, 0x0a, 0xe5, 0xff, 0xff, 0x00, 0x00, 0x97, 0x00,
+  0x00, 0xf7, 0xff, 0x08, 0x83, 0x00, 0x03, 0xc3, 0xff, 0xff, 0x1c, 0x84,
+  0x00, 0x02, 0xfa, 0xef, 0x03, 0x83, 0x00, 0x00, 0x30, 0x83, 0xff, 0x00,
+  0x0f, 0x84, 0x00, 0x04, 0xfe, 0x3f, 0x00, 0x00, 0x06, 0x82, 0x00, 0x03,
+  0xe1, 0xff, 0xff, 0x7f, 0x83, 0x00, 0x01, 0x30, 0xfc, 0x83, 0xff, 0x10,
+  0x6f, 0x00, 0x00, 0xf8, 0xff, 0x03, 0x00, 0x30, 0xff, 0xaf, 0x00, 0x00,
+  0xf7, 0x0f, 0x00, 0x00, 0x06, 0x82, 0x00, 0x06, 0xf4, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0x07, 0x83, 0x00, 0x03, 0x60, 0xff, 0xff, 0x08, 0x83, 0x00,
+  0x00, 0xc2, 0x85, 0xff, 0x02, 0x00, 0x00, 0x30, 0x82, 0x00, 0x0b, 0x30,
+  0xfe, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x7f, 0x84,
+  0x00, 0x00, 0xb6, 0x84, 0x00, 0x03, 0xf0, 0xff, 0xcf, 0x01, 0x83, 0x00,
+  0x06, 0xb2, 0xff, 0xff, 0x0b, 0x00, 0x60, 0x03, 0x82, 0x00, 0x00, 0xf6,
+  0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x02, 0xff, 0xff, 0x2c, 0x83, 0x00,
+  0x01, 0x10, 0xfa, 0x85, 0xff, 0x00, 0x5e, 0x83, 0x00, 0x06, 0x10, 0xf8,
+  0xff, 0xff, 0x00, 0x00, 0x32, 0x82, 0x00, 0x04, 0x10, 0xfc, 0xff, 0xff,
+  0x3c, 0x83, 0x00, 0x06, 0x70, 0xff, 0xff, 0x0f, 0x00, 0x50, 0x03, 0x82,
+  0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x04, 0xfb, 0x3f,
+  0x00, 0x00, 0x03, 0x82, 0x00, 0x03, 0xd0, 0xff, 0xff, 0x9f, 0x83, 0x00,
+  0x01, 0x20, 0xfc, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x50, 0x00, 0x20, 0xff,
+  0x6f, 0x00, 0x70, 0x00, 0x00, 0xff, 0xff, 0xcf, 0x02, 0x83, 0x00, 0x05,
+  0xf8, 0xff, 0xbf, 0x00, 0x00, 0x36, 0x82, 0x00, 0x0a, 0x50, 0xff, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03, 0x7f,
+  0x00, 0x00, 0xf4, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x00,
+  0x4f, 0x85, 0x00, 0x02, 0xfb, 0xff, 0x0f, 0x85, 0x00, 0x02, 0x90, 0xff,
+  0x8f, 0x82, 0x00, 0x03, 0x02, 0x00, 0x60, 0xfe, 0x84, 0xff, 0x00, 0x0b,
+  0x85, 0x00, 0x12, 0x90, 0xff, 0xff, 0x00, 0x00, 0x16, 0x00, 0x00, 0xfa,
+  0x8f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x40, 0xff, 0xef, 0x01, 0x83, 0x00,
+  0x02, 0x10, 0xfe, 0x7f, 0x84, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x0f,
+  0x84, 0x00, 0x01, 0xff, 0x3f, 0x85, 0x00, 0x09, 0x60, 0xff, 0xff, 0x07,
+  0x00, 0x00, 0x01, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x0d, 0x9f, 0x00, 0x00,
+  0xf7, 0xff, 0x02, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x0f, 0x85,
+  0x00, 0x06, 0xc0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x08,
+  0x70, 0xff, 0x8f, 0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x85, 0xff, 0x86,
+  0x00, 0x0a, 0xf5, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0x7f, 0x84, 0x00, 0x00, 0xb7, 0x84, 0x00, 0x02, 0xf3, 0xff, 0x1d, 0x84,
+  0x00, 0x03, 0x10, 0xfe, 0xff, 0x0b, 0x85, 0x00, 0x00, 0xe0, 0x83, 0xff,
+  0x00, 0x0f, 0x83, 0x00, 0x03, 0x10, 0xff, 0xef, 0x01, 0x84, 0x00, 0x00,
+  0xd0, 0x85, 0xff, 0x00, 0x05, 0x84, 0x00, 0x02, 0xb0, 0xff, 0xff, 0x86,
+  0x00, 0x0b, 0xf3, 0xff, 0xef, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0xf9,
+  0xff, 0x0f, 0x85, 0x00, 0x00, 0xc0, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x01, 0xff, 0x3f, 0x85, 0x00, 0x09, 0x40, 0xff, 0xff, 0x0a, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0xf2, 0x84, 0xff, 0x15, 0x3f, 0x00, 0x30, 0x03, 0x00,
+  0xfe, 0x3f, 0x00, 0x73, 0x00, 0x00, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x20,
+  0x00, 0x00, 0xb0, 0xff, 0xbf, 0x86, 0x00, 0x09, 0xfc, 0xff, 0x00, 0x00,
+  0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03, 0x2e, 0x00, 0x00,
+  0xfa, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x19, 0x08, 0x00,
+  0x00, 0xb6, 0x29, 0x00, 0x00, 0xf2, 0xff, 0x0f, 0x00, 0x00, 0x10, 0xa9,
+  0x02, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xf9, 0xdf, 0x01, 0x00, 0xf4,
+  0x84, 0xff, 0x09, 0x0b, 0x00, 0x00, 0x70, 0x9b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x84, 0x00, 0x17, 0xfc, 0x1d, 0x00, 0x00, 0xfc, 0x8f, 0x00, 0x00,
+  0xf9, 0x8f, 0x00, 0x00, 0xb2, 0xbd, 0x18, 0xb0, 0xff, 0x1f, 0x00, 0x00,
+  0xc8, 0xac, 0x05, 0xf3, 0x83, 0xff, 0x17, 0x7f, 0x17, 0x00, 0x00, 0x73,
+  0x97, 0xff, 0x3f, 0x00, 0x00, 0x10, 0xb8, 0x02, 0x00, 0x30, 0xff, 0xcf,
+  0x00, 0x00, 0xc0, 0xff, 0x06, 0x00, 0x90, 0x83, 0xff, 0x04, 0xcf, 0x00,
+  0x00, 0xf4, 0xef, 0x82, 0x00, 0x20, 0xfd, 0x5f, 0x00, 0x00, 0xfe, 0x0f,
+  0x00, 0x00, 0x30, 0xa9, 0x00, 0x00, 0x80, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0x7b, 0x07, 0x00, 0x00, 0x77, 0xd7, 0xff, 0x1d, 0x00, 0x00, 0xfc, 0x8f,
+  0x00, 0x00, 0xf7, 0x84, 0xff, 0x82, 0x00, 0x2c, 0xa4, 0x2a, 0x00, 0x00,
+  0xe1, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xbf, 0x77,
+  0x00, 0x00, 0x70, 0x77, 0xdd, 0x77, 0x01, 0x00, 0x50, 0x77, 0xfa, 0xff,
+  0x04, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0xf6, 0xff, 0x0b, 0x00, 0x00,
+  0x40, 0x9a, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0e, 0x7f, 0x17, 0x00, 0x00,
+  0x73, 0x97, 0xff, 0x5f, 0x00, 0x00, 0x80, 0x8b, 0x00, 0x00, 0x50, 0x84,
+  0xff, 0x09, 0xaf, 0x00, 0x00, 0x60, 0x9b, 0x02, 0x00, 0x20, 0xff, 0xff,
+  0x82, 0x00, 0x16, 0xa3, 0x4b, 0x00, 0x00, 0xc0, 0xff, 0x6f, 0x00, 0x00,
+  0xf5, 0xef, 0x02, 0x00, 0xe1, 0xff, 0x0f, 0x00, 0x00, 0x30, 0xa9, 0x00,
+  0x00, 0x80, 0x83, 0xff, 0x07, 0x7f, 0x37, 0x00, 0x00, 0x73, 0x77, 0xff,
+  0x3f, 0x82, 0x00, 0x0c, 0xb7, 0x03, 0x00, 0x30, 0xff, 0xef, 0x01, 0x00,
+  0xb0, 0xff, 0x09, 0x00, 0x70, 0x84, 0xff, 0x15, 0x2f, 0x00, 0x30, 0x07,
+  0x00, 0xfa, 0x0f, 0x00, 0x76, 0x00, 0x00, 0xfd, 0xff, 0x05, 0x00, 0x50,
+  0xff, 0x1c, 0x00, 0x20, 0xff, 0xbf, 0x82, 0x00, 0x0d, 0xa3, 0x09, 0x00,
+  0x00, 0xfa, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0x02, 0x05, 0x00, 0x30, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84,
+  0xff, 0x19, 0x02, 0x00, 0x70, 0xff, 0xef, 0x01, 0x00, 0x90, 0xff, 0x0f,
+  0x00, 0x00, 0xe2, 0xff, 0x08, 0x00, 0x30, 0xff, 0x0c, 0x00, 0x20, 0xff,
+  0xff, 0x07, 0x00, 0xc0, 0x84, 0xff, 0x09, 0x0b, 0x00, 0x00, 0xf9, 0xff,
+  0x0c, 0x00, 0x00, 0xfc, 0xff, 0x82, 0x00, 0x19, 0x60, 0x77, 0xff, 0x06,
+  0x00, 0x70, 0xff, 0xff, 0x01, 0x00, 0xf2, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0xfb, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xdf, 0xfe, 0x84, 0xff,
+  0x16, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0xff,
+  0x0a, 0x00, 0x20, 0xff, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0x1f, 0x00, 0x20,
+  0x84, 0xff, 0x03, 0x00, 0x00, 0xf3, 0xbf, 0x82, 0x00, 0x15, 0xfa, 0x3f,
+  0x00, 0x20, 0xff, 0x0f, 0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x07, 0x08,
+  0x00, 0x70, 0xff, 0xff, 0x01, 0x00, 0xf1, 0x84, 0xff, 0x15, 0x00, 0x00,
+  0x50, 0xff, 0xef, 0x00, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03,
+  0x00, 0xb0, 0xff, 0xff, 0xcf, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00,
+  0xd0, 0xff, 0x0b, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x90, 0x84, 0xff,
+  0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x0e, 0x00, 0x00, 0xfb, 0xff,
+  0x0c, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x23, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0x1e, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0x40, 0xff, 0xff, 0x02, 0x00,
+  0x50, 0xff, 0x1f, 0x00, 0x00, 0xfe, 0xff, 0x0a, 0x00, 0x80, 0xff, 0x0f,
+  0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x70, 0x84, 0xff, 0x16, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0x8f, 0x00, 0x00, 0xf7, 0xff, 0x3f, 0x00, 0x10, 0x84, 0xff, 0x26,
+  0x0f, 0x00, 0x30, 0x0b, 0x00, 0xf7, 0x0c, 0x00, 0x79, 0x00, 0x00, 0xfb,
+  0xef, 0x00, 0x00, 0xf1, 0xff, 0x9f, 0x00, 0x00, 0xf9, 0xbf, 0x00, 0x00,
+  0x50, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xfe, 0xff, 0x03, 0x9f, 0x00, 0x00, 0xc0, 0x8c, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x1a, 0xcf, 0x00, 0x00, 0xd0, 0xff,
+  0xff, 0x06, 0x00, 0x40, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0x09, 0x00, 0x40, 0xff, 0xff, 0x0b, 0x00, 0x80, 0x84, 0xff,
+  0x09, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xf9, 0xff, 0x82,
+  0x00, 0x0e, 0xfb, 0xff, 0xff, 0x02, 0x00, 0xd0, 0xff, 0xff, 0x07, 0x00,
+  0xe0, 0x7f, 0x00, 0x00, 0xa1, 0x83, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xd5,
+  0x87, 0xff, 0x17, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xfa, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x2f, 0x00, 0x00, 0xfd, 0xff, 0x5f,
+  0x00, 0x00, 0xfe, 0x83, 0xff, 0x1c, 0x03, 0x00, 0xf0, 0x7f, 0x00, 0x03,
+  0x00, 0xf7, 0x0f, 0x00, 0x50, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82,
+  0xff, 0x07, 0x03, 0x00, 0xd0, 0xff, 0xff, 0x07, 0x00, 0xb0, 0x84, 0xff,
+  0x15, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x05, 0x00, 0x70, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf1, 0xff,
+  0xff, 0x01, 0x00, 0x90, 0xff, 0x0b, 0x00, 0x20, 0xff, 0xff, 0x06, 0x00,
+  0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x09, 0x00,
+  0x10, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x23, 0x0d, 0x00,
+  0x00, 0xfd, 0xff, 0x6f, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x07, 0x00, 0x30, 0xff, 0x0a, 0x00, 0x50, 0xff, 0xff, 0x0f, 0x00,
+  0x30, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff,
+  0x17, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf6, 0xff,
+  0x0e, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00,
+  0xfb, 0x83, 0xff, 0x26, 0x0f, 0x00, 0x30, 0x0f, 0x00, 0xf3, 0x08, 0x00,
+  0x7d, 0x00, 0x00, 0xfb, 0x9f, 0x00, 0x00, 0xf6, 0xff, 0xdf, 0x00, 0x00,
+  0xf6, 0xbf, 0x00, 0x00, 0xe0, 0xff, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0x00,
+  0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xfe, 0xff, 0x03, 0x0c, 0x00,
+  0x00, 0xfa, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x1a, 0x8f,
+  0x00, 0x00, 0xf1, 0xff, 0xff, 0x0a, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0x84, 0xff, 0x18, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x4f, 0x00,
+  0x00, 0xf7, 0xff, 0x00, 0x00, 0x50, 0xff, 0xff, 0xef, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x07, 0x00, 0xb0, 0xcf, 0x82, 0x00, 0x04, 0x61, 0xfb, 0xff,
+  0xff, 0x4f, 0x82, 0x00, 0x01, 0x94, 0xfd, 0x85, 0xff, 0x17, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0x0d, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x1c, 0x07, 0x00, 0xe0, 0x4f, 0x00, 0x37, 0x00, 0xf4, 0x0e, 0x00, 0x80,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x07, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x07, 0x00, 0xa0, 0x84, 0xff, 0x15, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00, 0xb0,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x70, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff, 0xff, 0x7f, 0x00,
+  0x00, 0xf5, 0x83, 0xff, 0x23, 0x0b, 0x00, 0x10, 0xff, 0xff, 0xbf, 0x00,
+  0x00, 0xf3, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x20, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x0f, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x17, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xfa, 0x83, 0xff, 0x26, 0x0e,
+  0x00, 0x30, 0x3f, 0x00, 0xf1, 0x05, 0x00, 0x7f, 0x00, 0x00, 0xfb, 0x5f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x00, 0x00, 0xf3, 0xbf, 0x00, 0x00, 0xf0,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xfd, 0xff, 0x03, 0xcf, 0x01, 0x00, 0x90, 0x8d, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0x83, 0xff, 0x1a, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0x0d, 0x00, 0x00, 0xfc, 0xff, 0x02, 0x00, 0xb0, 0x84, 0xff, 0x0f,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00,
+  0xc0, 0xff, 0xff, 0xbf, 0x86, 0x00, 0x02, 0x80, 0xff, 0x06, 0x82, 0x00,
+  0x03, 0x20, 0xf9, 0xff, 0xcf, 0x83, 0x00, 0x01, 0x50, 0xfd, 0x84, 0xff,
+  0x0f, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x0b, 0x86, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x1f,
+  0x0a, 0x00, 0xb0, 0x2f, 0x00, 0x79, 0x00, 0xf2, 0x0b, 0x00, 0xb0, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xef, 0x86, 0x00, 0x00, 0x70,
+  0x84, 0xff, 0x15, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0x82, 0xff, 0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x07, 0x00, 0x40, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x03, 0x00, 0x70, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x13,
+  0x08, 0x00, 0x30, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x06, 0x86, 0x00, 0x08, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0f, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0x0e, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x0c, 0x0b, 0x00,
+  0x40, 0x7f, 0x00, 0xc0, 0x03, 0x40, 0x7f, 0x00, 0x00, 0xf7, 0x3f, 0x86,
+  0x00, 0x12, 0xf1, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xfd, 0xff, 0x03,
+  0x1c, 0x00, 0x00, 0xf9, 0x8d, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff,
+  0x1a, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x5f, 0x00, 0x00, 0x61,
+  0x28, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x0f, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x7f, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff, 0xbf, 0x86,
+  0x00, 0x02, 0x70, 0xff, 0x7f, 0x83, 0x00, 0x03, 0x40, 0xfe, 0xff, 0x1c,
+  0x83, 0x00, 0x00, 0x91, 0x84, 0xff, 0x0f, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0b, 0x86,
+  0x00, 0x00, 0xf7, 0x83, 0xff, 0x1f, 0x0d, 0x00, 0xa0, 0x0e, 0x00, 0x9b,
+  0x00, 0xf0, 0x09, 0x00, 0xf0, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0xbf, 0x86, 0x00, 0x00, 0x70, 0x84, 0xff, 0x15, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x0b, 0x00, 0x10, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00,
+  0xb0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x30,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03, 0x00, 0x70, 0xff, 0xff, 0x7f,
+  0x00, 0x00, 0xf1, 0x83, 0xff, 0x13, 0x07, 0x00, 0x30, 0xff, 0xff, 0xdf,
+  0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0x03, 0x86, 0x00, 0x08, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0x84, 0xff, 0x0f, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0b, 0x86, 0x00, 0x00,
+  0xf7, 0x83, 0xff, 0x0c, 0x0b, 0x00, 0x70, 0xaf, 0x00, 0x90, 0x00, 0x70,
+  0x7f, 0x00, 0x00, 0xf7, 0x3f, 0x86, 0x00, 0x12, 0xf0, 0xbf, 0x00, 0x00,
+  0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xfc, 0xff, 0x03, 0xcf, 0x01, 0x00, 0x90, 0x8e, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x14, 0x7f, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xef, 0x03, 0x84, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x0f, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0xcf, 0x86, 0x00, 0x03, 0x70, 0xff, 0xff, 0x5c, 0x83, 0x00,
+  0x03, 0xf6, 0xff, 0xef, 0x19, 0x82, 0x00, 0x01, 0x10, 0xfd, 0x83, 0xff,
+  0x0f, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x0c, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x1c,
+  0x1f, 0x00, 0x70, 0x0b, 0x00, 0xcf, 0x00, 0xb0, 0x07, 0x00, 0xf3, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00,
+  0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x86, 0x00, 0x00, 0x70, 0x84,
+  0xff, 0x15, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04,
+  0x00, 0x70, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x13, 0x09,
+  0x00, 0x30, 0xff, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x07, 0x86, 0x00, 0x08, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0f, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0x0f, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x0c, 0x0b, 0x00, 0x70,
+  0xef, 0x00, 0x10, 0x00, 0xb0, 0xbf, 0x00, 0x00, 0xf7, 0x4f, 0x86, 0x00,
+  0x12, 0xf0, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xfc, 0xff, 0x03, 0x1c,
+  0x00, 0x00, 0xf9, 0x84, 0xff, 0x00, 0xfc, 0x88, 0xff, 0x02, 0x00, 0x00,
+  0xb0, 0x83, 0xff, 0x14, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0a, 0x00,
+  0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x4f, 0x83, 0x00, 0x00, 0xc2, 0x85, 0xff, 0x0c, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02,
+  0x00, 0x00, 0xf0, 0x87, 0xff, 0x04, 0xae, 0x05, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x04, 0x8c, 0x01, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x11, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0x0f, 0x00, 0x00, 0x89, 0xff, 0x1c, 0x4f, 0x00, 0x50, 0x07, 0x20,
+  0xff, 0x00, 0x80, 0x03, 0x00, 0xf6, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00,
+  0x82, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x89, 0xff, 0x15, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00,
+  0xb0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x60,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x40, 0xff, 0xff, 0x7f,
+  0x00, 0x00, 0xf3, 0x83, 0xff, 0x15, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x09, 0x00, 0x00,
+  0xff, 0x08, 0x00, 0x60, 0x85, 0xff, 0x07, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0x84, 0xff, 0x12, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00,
+  0xfd, 0x88, 0xff, 0x0f, 0x07, 0x00, 0x70, 0xff, 0x02, 0x00, 0x00, 0xf0,
+  0xbf, 0x00, 0x00, 0xf5, 0x7f, 0x00, 0x00, 0xf7, 0x84, 0xff, 0x11, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xb0,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0xfb, 0xff, 0x03, 0xcf, 0x01, 0x00, 0x90,
+  0x84, 0xff, 0x02, 0x08, 0x10, 0xfb, 0x87, 0xff, 0x02, 0x00, 0x00, 0xb0,
+  0x83, 0xff, 0x18, 0xcf, 0x00, 0x00, 0xe0, 0xff, 0xff, 0x05, 0x00, 0x40,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07,
+  0x00, 0x34, 0x33, 0xc7, 0x86, 0xff, 0x0c, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x1f, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x02,
+  0x00, 0xa0, 0x88, 0xff, 0x03, 0xcf, 0x00, 0x00, 0xd0, 0x83, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xf5, 0x83, 0xff, 0x12, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x1f, 0x00,
+  0x00, 0xfb, 0x88, 0xff, 0x1c, 0x7f, 0x00, 0x30, 0x04, 0x40, 0xff, 0x02,
+  0x60, 0x03, 0x00, 0xf9, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff,
+  0x02, 0x03, 0x00, 0xa0, 0x89, 0xff, 0x15, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0x04, 0x00, 0x60, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x06, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00, 0xb0, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x02, 0x00, 0x90, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x09, 0x00, 0x20, 0xff, 0xff, 0x2f, 0x00, 0x00,
+  0xf8, 0x83, 0xff, 0x15, 0x0e, 0x00, 0x00, 0xfd, 0xff, 0x6f, 0x00, 0x00,
+  0xf4, 0xff, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x05, 0x00, 0x30, 0xff, 0x0b,
+  0x00, 0x30, 0x85, 0xff, 0x07, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0x84, 0xff, 0x12, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xfa, 0x88,
+  0xff, 0x0f, 0x07, 0x00, 0x70, 0xff, 0x06, 0x00, 0x00, 0xf2, 0xbf, 0x00,
+  0x00, 0xf3, 0x9f, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x14, 0xbf, 0x00, 0x00,
+  0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xb0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0xfc, 0xf8, 0xff, 0x00, 0x1f, 0x85, 0x00,
+  0x04, 0x70, 0xcf, 0x00, 0x00, 0xe1, 0x87, 0xff, 0x02, 0x00, 0x00, 0x90,
+  0x83, 0xcc, 0x15, 0xff, 0x01, 0x00, 0x80, 0xff, 0xef, 0x02, 0x00, 0x90,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xdf, 0x00,
+  0x00, 0x89, 0xff, 0x0c, 0x0b, 0x00, 0x10, 0xfc, 0xff, 0x08, 0x00, 0x00,
+  0xfe, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x06, 0x00, 0x40, 0x82,
+  0xff, 0x11, 0xea, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0x00, 0x00, 0xd0,
+  0xff, 0xd8, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf5, 0x83, 0xff, 0x16, 0x7f,
+  0x00, 0x00, 0xf5, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0x5f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xaf, 0xfe, 0x84, 0xff,
+  0x22, 0xbf, 0x00, 0x10, 0x02, 0x70, 0xff, 0x05, 0x30, 0x00, 0x00, 0xfd,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x07, 0x00, 0x40,
+  0x82, 0xff, 0x00, 0xea, 0x85, 0xff, 0x15, 0x00, 0x00, 0xb0, 0xff, 0xef,
+  0x00, 0x00, 0xa0, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xcf, 0x00, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xd0, 0x82, 0xff, 0x16, 0x04, 0x00, 0x70, 0xff,
+  0xff, 0xcf, 0x00, 0x00, 0xc0, 0xff, 0xbf, 0x00, 0x00, 0xe0, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x7f, 0x00,
+  0x00, 0xf5, 0xff, 0xff, 0x0d, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00,
+  0xfd, 0x83, 0xff, 0x23, 0x1f, 0x00, 0x00, 0xf7, 0xff, 0x2e, 0x00, 0x00,
+  0xf9, 0xff, 0x00, 0x00, 0x80, 0xff, 0xef, 0x01, 0x00, 0x80, 0xff, 0x0e,
+  0x00, 0x00, 0xfa, 0xff, 0xff, 0xad, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x16, 0x7f, 0x00, 0x00, 0xf5, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0x7f, 0x00,
+  0x00, 0xf3, 0xff, 0xff, 0xaf, 0xfe, 0x84, 0xff, 0x2a, 0x07, 0x00, 0x70,
+  0xff, 0x0a, 0x00, 0x00, 0xf6, 0xbf, 0x00, 0x00, 0xf3, 0xdf, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0xdf, 0xfa, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x01, 0x00, 0xa0, 0xff, 0x1e, 0x00, 0x00, 0xf7,
+  0xff, 0x19, 0x10, 0xf9, 0xf7, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x04, 0xb0,
+  0x7f, 0x00, 0x00, 0xb0, 0x87, 0xff, 0x86, 0x00, 0x19, 0xff, 0x0a, 0x00,
+  0x00, 0xc7, 0x3a, 0x00, 0x00, 0xe1, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0x9f, 0x00, 0x00, 0x86, 0x88, 0xa8, 0xfc, 0x85,
+  0xff, 0x0c, 0x0b, 0x00, 0x00, 0x91, 0x7c, 0x00, 0x00, 0x40, 0xff, 0xff,
+  0x00, 0x00, 0xf0, 0x82, 0xff, 0x17, 0x0e, 0x00, 0x00, 0xb4, 0xcc, 0x2a,
+  0x60, 0xff, 0xcf, 0x01, 0x82, 0xcc, 0x5c, 0x00, 0x00, 0xf0, 0x6f, 0x00,
+  0xa6, 0xcc, 0x1a, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x16, 0x7f, 0x00, 0x00,
+  0x70, 0x38, 0xfd, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0xef, 0x00, 0x00, 0x40, 0xdc, 0x9c, 0x02, 0xf6, 0x85, 0xff, 0x82, 0x00,
+  0x02, 0xa0, 0xff, 0x07, 0x82, 0x00, 0x1c, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x2f,
+  0x00, 0x00, 0x83, 0x66, 0xff, 0x1e, 0x00, 0x00, 0xb4, 0xcc, 0x2a, 0x50,
+  0x85, 0xff, 0x2f, 0x00, 0x00, 0x10, 0xc8, 0x3b, 0x00, 0x00, 0xf1, 0xff,
+  0x0f, 0x00, 0x00, 0xc6, 0x17, 0x00, 0x00, 0x70, 0xff, 0xff, 0x02, 0x00,
+  0x30, 0x68, 0xf5, 0xff, 0x07, 0x00, 0x10, 0x77, 0xe3, 0xff, 0x05, 0x00,
+  0x10, 0xc9, 0x19, 0x00, 0x00, 0xf5, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0x84, 0xff, 0x0d, 0x7f, 0x00, 0x00, 0x70, 0x37, 0xfd,
+  0x6f, 0x00, 0x00, 0x91, 0x9c, 0x01, 0x00, 0x30, 0x84, 0xff, 0x09, 0xbf,
+  0x00, 0x00, 0x70, 0xac, 0x03, 0x00, 0x10, 0xfe, 0xff, 0x82, 0x00, 0x16,
+  0xb7, 0x3a, 0x00, 0x00, 0xd0, 0xff, 0x8f, 0x00, 0x00, 0x80, 0xcc, 0x6c,
+  0x00, 0xfb, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84,
+  0xff, 0x16, 0xaf, 0x00, 0x00, 0x60, 0x28, 0xfd, 0x3f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xef, 0x01, 0x00, 0x30, 0xcb, 0xac, 0x02,
+  0xf4, 0x84, 0xff, 0x2a, 0x04, 0x00, 0xa0, 0xff, 0x0e, 0x00, 0x00, 0xf9,
+  0xbf, 0x00, 0x00, 0xf3, 0xff, 0x07, 0x00, 0x10, 0xc9, 0xbd, 0x06, 0xc1,
+  0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x03,
+  0x00, 0x30, 0x9c, 0x02, 0x00, 0x00, 0xf7, 0xdf, 0x00, 0x00, 0xe1, 0xf7,
+  0xff, 0x00, 0x0f, 0x85, 0x00, 0x04, 0xb0, 0xaf, 0x00, 0x00, 0xd0, 0x87,
+  0xff, 0x85, 0x00, 0x02, 0x30, 0xff, 0x3f, 0x85, 0x00, 0x0b, 0xfb, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xbf, 0x84, 0x00,
+  0x01, 0x20, 0xfa, 0x84, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x05, 0xd0, 0xff,
+  0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x00, 0x9f, 0x85, 0x00, 0x01, 0xf9,
+  0x2e, 0x85, 0x00, 0x01, 0xf9, 0x06, 0x84, 0x00, 0x00, 0x10, 0x84, 0xff,
+  0x00, 0xdf, 0x83, 0x00, 0x0b, 0xf5, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x84, 0x00, 0x00, 0x90, 0x85, 0xff, 0x19,
+  0x02, 0x00, 0x00, 0xd0, 0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x7f, 0x83, 0x00, 0x01, 0xfd, 0x9f, 0x85, 0x00, 0x00, 0xf8, 0x84,
+  0xff, 0x86, 0x00, 0x02, 0xf9, 0xff, 0x4f, 0x85, 0x00, 0x03, 0x70, 0xff,
+  0xff, 0x07, 0x82, 0x00, 0x02, 0xd0, 0xff, 0x0b, 0x82, 0x00, 0x02, 0x70,
+  0xff, 0x0e, 0x85, 0x00, 0x09, 0xfe, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0x84, 0xff, 0x00, 0xdf, 0x83, 0x00, 0x01, 0xf5, 0xef,
+  0x85, 0x00, 0x00, 0xe0, 0x85, 0xff, 0x00, 0x03, 0x84, 0x00, 0x02, 0xb0,
+  0xff, 0xff, 0x86, 0x00, 0x03, 0xf7, 0xff, 0xff, 0x01, 0x84, 0x00, 0x09,
+  0xe1, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff,
+  0x00, 0xef, 0x83, 0x00, 0x0b, 0xf5, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x09, 0x84, 0x00, 0x00, 0x70, 0x84, 0xff, 0x0d,
+  0x03, 0x00, 0xb0, 0xff, 0x4f, 0x33, 0x33, 0xfd, 0xdf, 0x00, 0x00, 0xf0,
+  0xff, 0x0e, 0x84, 0x00, 0x0c, 0x30, 0xfe, 0xbf, 0x00, 0x00, 0xf0, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x07, 0x85, 0x00, 0x04, 0xf7, 0xaf, 0x00,
+  0x00, 0xb0, 0xf7, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x04, 0xf0, 0xff, 0x02,
+  0x00, 0xf7, 0x87, 0xff, 0x85, 0x00, 0x03, 0x50, 0xff, 0xef, 0x03, 0x83,
+  0x00, 0x0d, 0x90, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00,
+  0x30, 0xff, 0xff, 0x03, 0x84, 0x00, 0x00, 0x60, 0x84, 0xff, 0x00, 0x0b,
+  0x85, 0x00, 0x05, 0xf9, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00,
+  0x08, 0x84, 0x00, 0x01, 0xfa, 0x4e, 0x84, 0x00, 0x02, 0x50, 0xff, 0x09,
+  0x84, 0x00, 0x00, 0xc0, 0x85, 0xff, 0x00, 0x06, 0x82, 0x00, 0x0b, 0xd0,
+  0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x84,
+  0x00, 0x00, 0xa0, 0x85, 0xff, 0x19, 0x05, 0x00, 0x00, 0xf0, 0xff, 0x0e,
+  0x00, 0x00, 0x70, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xef, 0x83, 0x00, 0x02, 0xf5,
+  0xff, 0x08, 0x84, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x02, 0x00, 0x00, 0x01,
+  0x82, 0x00, 0x03, 0x50, 0xff, 0xff, 0xbf, 0x83, 0x00, 0x05, 0x09, 0x00,
+  0x70, 0xff, 0xff, 0x0e, 0x82, 0x00, 0x02, 0x50, 0xff, 0x5f, 0x82, 0x00,
+  0x03, 0x10, 0xfe, 0xbf, 0x01, 0x83, 0x00, 0x0a, 0xc2, 0xff, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x85, 0xff, 0x00, 0x06, 0x82,
+  0x00, 0x02, 0xd0, 0xff, 0x1b, 0x84, 0x00, 0x00, 0xfc, 0x85, 0xff, 0x00,
+  0x3e, 0x84, 0x00, 0x02, 0xf9, 0xff, 0xff, 0x85, 0x00, 0x00, 0x30, 0x82,
+  0xff, 0x00, 0x3d, 0x84, 0x00, 0x09, 0xc3, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0x85, 0xff, 0x00, 0x07, 0x82, 0x00, 0x0b, 0xb0,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x8f, 0x84,
+  0x00, 0x00, 0x70, 0x84, 0xff, 0x02, 0x03, 0x00, 0xb0, 0x85, 0xff, 0x05,
+  0x00, 0x00, 0xf0, 0xff, 0xcf, 0x02, 0x83, 0x00, 0x0c, 0x40, 0xfe, 0xbf,
+  0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0e, 0x82, 0x00,
+  0x07, 0x90, 0x00, 0x00, 0xf7, 0xcf, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x02,
+  0xff, 0xaf, 0xc7, 0x88, 0xff, 0x85, 0x00, 0x03, 0x70, 0xff, 0xff, 0x8f,
+  0x82, 0x00, 0x0e, 0x40, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x7e, 0x85, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x06, 0x0b, 0x00, 0x30, 0x0b, 0x00, 0x00, 0xa1, 0x82, 0xff, 0x02, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x01, 0xdf, 0x03, 0x82, 0x00, 0x03, 0xe7, 0xff,
+  0xff, 0x3b, 0x82, 0x00, 0x04, 0x10, 0xf9, 0xff, 0xdf, 0x05, 0x82, 0x00,
+  0x01, 0x50, 0xfd, 0x85, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x08, 0xc3, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0x82, 0xff, 0x00, 0x2c, 0x82,
+  0x00, 0x01, 0x70, 0xfe, 0x85, 0xff, 0x1a, 0x08, 0x00, 0x00, 0xf3, 0xff,
+  0x1f, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3d, 0x82, 0x00,
+  0x03, 0xf7, 0xff, 0xdf, 0x03, 0x82, 0x00, 0x00, 0xe7, 0x85, 0xff, 0x06,
+  0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x16, 0x09, 0x00,
+  0x00, 0xc2, 0x0f, 0x00, 0x70, 0xff, 0xff, 0xdf, 0x03, 0x00, 0x00, 0x70,
+  0xff, 0xef, 0x06, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x6e, 0x82, 0x00, 0x0b,
+  0x60, 0xfe, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0x85, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x03, 0xc3, 0xff, 0xef, 0x06, 0x82,
+  0x00, 0x00, 0xe5, 0x87, 0xff, 0x00, 0x08, 0x82, 0x00, 0x00, 0xc4, 0x82,
+  0xff, 0x06, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0xe5, 0x83, 0xff, 0x00,
+  0x08, 0x82, 0x00, 0x0a, 0xb2, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0x85, 0xff, 0x00, 0x8f, 0x82, 0x00, 0x08, 0xc3, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x00, 0x3d, 0x82,
+  0x00, 0x01, 0x60, 0xfe, 0x84, 0xff, 0x02, 0x02, 0x00, 0xb0, 0x85, 0xff,
+  0x05, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x7f, 0x82, 0x00, 0x18, 0x30, 0xfb,
+  0xff, 0xbf, 0x00, 0x00, 0xf0, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xbf,
+  0x01, 0x00, 0x00, 0xfb, 0x03, 0x00, 0xf7, 0xff, 0x04, 0x00, 0xf6, 0xff,
+  0xff, 0x95, 0xff, 0x03, 0xdf, 0x7b, 0xb8, 0xfd, 0x8e, 0xff, 0x05, 0xbb,
+  0xbb, 0x09, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x05, 0x0b, 0x00, 0x30, 0xff,
+  0x8b, 0xb8, 0x8c, 0xff, 0x02, 0x9b, 0xb7, 0xfd, 0x83, 0xff, 0x03, 0xbe,
+  0x77, 0xa7, 0xfd, 0x83, 0xff, 0x02, 0x9c, 0x77, 0xb8, 0x88, 0xff, 0x02,
+  0xbd, 0x77, 0xd9, 0x8c, 0xff, 0x02, 0xbf, 0x79, 0xdb, 0xa2, 0xff, 0x02,
+  0x9b, 0x77, 0xfb, 0x83, 0xff, 0x02, 0x9b, 0xb7, 0xfd, 0x89, 0xff, 0x02,
+  0xaf, 0x77, 0xeb, 0x83, 0xff, 0x02, 0xdf, 0x7b, 0xda, 0x86, 0xff, 0x02,
+  0xbf, 0x79, 0xb7, 0x82, 0xff, 0x03, 0xdf, 0x7b, 0xa7, 0xfd, 0x82, 0xff,
+  0x02, 0xcf, 0x7a, 0xb9, 0x92, 0xff, 0x02, 0xbd, 0x77, 0xda, 0x83, 0xff,
+  0x02, 0xac, 0x97, 0xeb, 0x89, 0xff, 0x02, 0xbd, 0x77, 0xdb, 0x83, 0xff,
+  0x05, 0x00, 0x00, 0xb0, 0xcf, 0x7a, 0xda, 0x85, 0xff, 0x02, 0xbd, 0x97,
+  0xfb, 0x91, 0xff, 0x02, 0xbd, 0x78, 0xc9, 0x8c, 0xff, 0x02, 0xbf, 0x7a,
+  0xca, 0x95, 0xff, 0x02, 0xdf, 0x7b, 0xb9, 0x8d, 0xff, 0x02, 0xbe, 0x98,
+  0xfd, 0x84, 0xff, 0x01, 0xaf, 0xb7, 0xff, 0xff, 0xa5, 0xff, 0x09, 0xdf,
+  0x88, 0x88, 0xfd, 0xff, 0xff, 0x9f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x02,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0xc3, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0xff, 0xff, 0x87, 0xff, 0x09, 0xef, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x6f, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0xc3, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff,
+  0x08, 0x00, 0x00, 0x60, 0xca, 0x8c, 0x05, 0x00, 0x00, 0xfa, 0x83, 0xff,
+  0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xc3, 0xff, 0x02, 0x00, 0x00, 0xb0,
+  0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0x00, 0x07, 0x85, 0x00, 0x00, 0x50,
+  0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xc3, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x88, 0xff, 0x00, 0x6f, 0x85, 0x00,
+  0x00, 0xf6, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xc3, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0xff, 0xff, 0xff, 0xff, 0x89, 0xff, 0x05, 0x7d,
+  0x03, 0x00, 0x00, 0x32, 0xe9, 0x85, 0xff, 0x02, 0x0b, 0x30, 0x73, 0xff,
+  0xff, 0xc3, 0xff, 0x02, 0x00, 0x32, 0xd3, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xff, 0x02, 0xef, 0x16, 0x92, 0xff,
+  0xff, 0xa8, 0xff, 0x02, 0x3b, 0x50, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x87,
+  0xff, 0x01, 0xce, 0xfe, 0x9f, 0xff, 0x00, 0xcd, 0x85, 0xff, 0x03, 0x5f,
+  0x00, 0x00, 0xf8, 0x94, 0xff, 0x01, 0xdf, 0xfc, 0xd7, 0xff, 0x00, 0xdc,
+  0xb6, 0xff, 0x03, 0xcf, 0x01, 0x00, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x85,
+  0xff, 0x03, 0x6f, 0x03, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x4f, 0x01, 0x00,
+  0x85, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xf3, 0x93, 0xff, 0x02, 0x24, 0x00,
+  0xf0, 0xd5, 0xff, 0x02, 0x39, 0x00, 0x70, 0xb6, 0xff, 0x03, 0x7f, 0x00,
+  0x00, 0xa0, 0xff, 0xff, 0x99, 0xff, 0x04, 0xbf, 0x48, 0x01, 0x10, 0xb6,
+  0x8d, 0xff, 0x02, 0xcc, 0xcc, 0xec, 0xd5, 0xff, 0x03, 0x3f, 0x00, 0x00,
+  0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x85, 0xff, 0x03, 0x0f, 0x00,
+  0x00, 0xf3, 0x93, 0xff, 0x02, 0x00, 0x00, 0xf0, 0xd5, 0xff, 0x02, 0x07,
+  0x00, 0x70, 0x9b, 0xff, 0x00, 0xcf, 0x82, 0xcc, 0x96, 0xff, 0x03, 0x7f,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x98, 0xff, 0x01, 0xef, 0x07, 0x83, 0x00,
+  0x00, 0xe4, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xd1, 0xff, 0x07, 0xdf,
+  0xfd, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00,
+  0x00, 0x85, 0xff, 0x03, 0x5f, 0x00, 0x00, 0xf9, 0x82, 0xff, 0x00, 0xcf,
+  0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x91, 0xff, 0x00, 0xfc, 0x84, 0xff,
+  0x00, 0xed, 0x9a, 0xff, 0x01, 0xdf, 0xfd, 0x9f, 0xff, 0x02, 0x07, 0x00,
+  0x70, 0x93, 0xff, 0x01, 0xef, 0xfd, 0x85, 0xff, 0x00, 0x0f, 0x82, 0x00,
+  0x02, 0x10, 0x54, 0xfa, 0x93, 0xff, 0x03, 0xdf, 0x00, 0x00, 0xe1, 0xa7,
+  0xff, 0x01, 0xdf, 0xfe, 0xee, 0xff, 0x00, 0x2c, 0x84, 0x00, 0x00, 0x30,
+  0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0xcf, 0xff, 0x09, 0x6f, 0x04, 0x00,
+  0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00,
+  0x00, 0x86, 0xff, 0x06, 0x37, 0xa3, 0xff, 0xff, 0x4f, 0x02, 0x00, 0x8f,
+  0xff, 0x02, 0x00, 0x00, 0xf0, 0x8f, 0xff, 0x02, 0x24, 0x00, 0xf0, 0x82,
+  0xff, 0x02, 0x46, 0x00, 0xb0, 0x98, 0xff, 0x03, 0x6f, 0x04, 0x00, 0xf7,
+  0x9f, 0xff, 0x02, 0x07, 0x00, 0x70, 0x91, 0xff, 0x03, 0x9f, 0x14, 0x00,
+  0xf7, 0x85, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x20, 0xfa, 0x93, 0xff,
+  0x02, 0x5d, 0x53, 0xfd, 0xa5, 0xff, 0x03, 0x4f, 0x03, 0x00, 0xfb, 0xee,
+  0xff, 0x03, 0x0e, 0x00, 0x00, 0x32, 0x82, 0x00, 0x00, 0xf9, 0x8b, 0xff,
+  0x02, 0x00, 0x00, 0xb0, 0x9d, 0xff, 0x01, 0x9f, 0xfe, 0xaf, 0xff, 0x09,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff,
+  0x02, 0x0f, 0x00, 0x00, 0x8a, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x8f, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x02, 0x03, 0x00, 0xb0, 0x98, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x9f,
+  0xff, 0x02, 0x07, 0x00, 0x70, 0x91, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7,
+  0x85, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x01, 0x30, 0xfe, 0xbb, 0xff, 0x03,
+  0x0f, 0x00, 0x00, 0xfb, 0xee, 0xff, 0x07, 0xcf, 0x00, 0xf8, 0xff, 0x4e,
+  0x00, 0x00, 0xf4, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x9c, 0xff, 0x02,
+  0x9e, 0x02, 0xf9, 0xaf, 0xff, 0x09, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0xfb, 0x9d, 0xff, 0x02, 0x0f, 0x00, 0x00, 0x8a, 0xff,
+  0x02, 0x0f, 0x00, 0x00, 0x8f, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x8f, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x03, 0x00, 0xb0, 0x98, 0xff,
+  0x03, 0x3f, 0x00, 0x00, 0xf7, 0x9f, 0xff, 0x02, 0x07, 0x00, 0x70, 0x91,
+  0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x04, 0x0f, 0x00, 0x00,
+  0x73, 0x34, 0x82, 0x00, 0x00, 0xe3, 0xbb, 0xff, 0x03, 0x0f, 0x00, 0x00,
+  0xfb, 0xef, 0xff, 0x06, 0xdb, 0xff, 0xff, 0xdf, 0x00, 0x00, 0xf3, 0x8b,
+  0xff, 0x02, 0x00, 0x00, 0xb0, 0x86, 0xff, 0x02, 0xcf, 0x8b, 0xca, 0x87,
+  0xff, 0x02, 0xbe, 0x98, 0xfc, 0x83, 0xff, 0x06, 0xcf, 0x8c, 0x88, 0x36,
+  0x00, 0x00, 0xf4, 0x87, 0xff, 0x02, 0x9c, 0xc8, 0xfe, 0x85, 0xff, 0x07,
+  0xdf, 0x8a, 0xfb, 0xff, 0xff, 0xcf, 0x8b, 0xca, 0x84, 0xff, 0x03, 0xef,
+  0x8c, 0x88, 0xeb, 0x83, 0xff, 0x03, 0xcf, 0x89, 0xa8, 0xfc, 0x85, 0xff,
+  0x0c, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xcf,
+  0x88, 0xec, 0x84, 0xff, 0x02, 0xbc, 0xa8, 0xfc, 0x92, 0xff, 0x06, 0x0f,
+  0x00, 0x00, 0xff, 0xbe, 0xa8, 0xfc, 0x86, 0xff, 0x02, 0x0f, 0x00, 0x00,
+  0x84, 0xff, 0x02, 0xcf, 0x8b, 0xca, 0x87, 0xff, 0x05, 0x00, 0x00, 0xf0,
+  0xdf, 0x8a, 0xeb, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02,
+  0x03, 0x00, 0xb0, 0x84, 0xff, 0x02, 0xce, 0x8a, 0xcb, 0x87, 0xff, 0x02,
+  0xad, 0xa8, 0xfc, 0x85, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0x84, 0xff,
+  0x02, 0xac, 0xb8, 0xfc, 0x88, 0xff, 0x03, 0xce, 0x88, 0xb8, 0xfe, 0x83,
+  0xff, 0x02, 0xdf, 0x8c, 0xca, 0x83, 0xff, 0x02, 0x07, 0x00, 0x70, 0x83,
+  0xff, 0x02, 0xcd, 0x98, 0xec, 0x85, 0xff, 0x08, 0xcd, 0x88, 0xc9, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x08, 0x0f, 0x00, 0x00, 0xf7,
+  0xff, 0x4e, 0x00, 0x00, 0x70, 0x83, 0xff, 0x02, 0xbc, 0xa8, 0xfc, 0x91,
+  0xff, 0x03, 0xef, 0x9c, 0x88, 0xfc, 0x83, 0xff, 0x02, 0xce, 0x89, 0xec,
+  0x88, 0xff, 0x03, 0xce, 0x88, 0xb8, 0xfe, 0x83, 0xff, 0x02, 0xdf, 0x8c,
+  0xc9, 0x83, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0x8e, 0xff, 0x02, 0xbf,
+  0xa8, 0xfc, 0xe0, 0xff, 0x03, 0xef, 0x00, 0x00, 0xf5, 0x8b, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0x85, 0xff, 0x13, 0x8f, 0x02, 0x00, 0x00, 0x40, 0xfd,
+  0xff, 0xff, 0x0f, 0x00, 0x60, 0x8f, 0x01, 0x00, 0x30, 0xfc, 0xff, 0xff,
+  0xaf, 0x02, 0x84, 0x00, 0x00, 0xe0, 0x83, 0xff, 0x06, 0x0b, 0x00, 0xb0,
+  0x4c, 0x00, 0x00, 0x60, 0x82, 0xff, 0x0b, 0x00, 0x00, 0xfa, 0x07, 0x00,
+  0xf4, 0xff, 0xaf, 0x03, 0x00, 0x00, 0x70, 0x82, 0xff, 0x01, 0xdf, 0x05,
+  0x82, 0x00, 0x08, 0xc5, 0xff, 0xff, 0x8e, 0x01, 0x00, 0x00, 0x20, 0xfa,
+  0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x08, 0xfb, 0x3f, 0x00, 0x00, 0xab,
+  0x02, 0x00, 0x20, 0xfb, 0x82, 0xff, 0x00, 0x3a, 0x82, 0x00, 0x00, 0xf8,
+  0x84, 0xff, 0x1a, 0x2f, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x00, 0x60, 0xff,
+  0xcf, 0x00, 0x00, 0xf4, 0x0f, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x40, 0xfe,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x08, 0x30, 0xff, 0xff,
+  0xaf, 0x03, 0x00, 0x00, 0x70, 0xfe, 0x85, 0xff, 0x11, 0x00, 0x00, 0xe0,
+  0x07, 0x00, 0x00, 0xe3, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0x7f, 0x84, 0x00, 0x00, 0xb3, 0x84, 0x00, 0x12, 0xd0, 0xff,
+  0xff, 0x6e, 0x01, 0x00, 0x00, 0x70, 0xfe, 0xff, 0xff, 0x0b, 0x00, 0xb0,
+  0x5e, 0x00, 0x00, 0x50, 0xfe, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x03,
+  0xfb, 0xff, 0xef, 0x17, 0x82, 0x00, 0x00, 0xe7, 0x86, 0xff, 0x00, 0x6d,
+  0x82, 0x00, 0x0e, 0x40, 0xfb, 0xff, 0xff, 0xcf, 0x04, 0x00, 0x00, 0x50,
+  0xfe, 0xff, 0xff, 0x07, 0x00, 0x70, 0x82, 0xff, 0x00, 0x6d, 0x82, 0x00,
+  0x00, 0xd3, 0x83, 0xff, 0x00, 0x4b, 0x82, 0x00, 0x01, 0x92, 0x3f, 0x84,
+  0x00, 0x00, 0xf8, 0x83, 0xff, 0x08, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x02, 0x00, 0x10, 0x82, 0xff, 0x00, 0x4b, 0x82, 0x00, 0x1d, 0xe5, 0xff,
+  0x6f, 0x00, 0x00, 0xf1, 0xff, 0xff, 0x0d, 0x00, 0x00, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xcf, 0x06, 0x00, 0x00, 0x10, 0xe8, 0xff, 0xff, 0x8e,
+  0x01, 0x00, 0x00, 0xb2, 0x86, 0xff, 0x00, 0x6d, 0x82, 0x00, 0x0b, 0x40,
+  0xfb, 0xff, 0xff, 0xcf, 0x06, 0x00, 0x00, 0x40, 0xfe, 0xff, 0x0b, 0x84,
+  0x00, 0x11, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0x3f, 0x00, 0x30, 0x8f, 0x01, 0x00, 0x10, 0xfb, 0xdf, 0xff, 0x03, 0x8f,
+  0x00, 0x00, 0xf9, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x01,
+  0xef, 0x04, 0x83, 0x00, 0x06, 0x81, 0xff, 0xff, 0x0f, 0x00, 0x30, 0x06,
+  0x82, 0x00, 0x03, 0xf2, 0xff, 0xff, 0x05, 0x83, 0x00, 0x02, 0x50, 0x87,
+  0xfc, 0x83, 0xff, 0x03, 0x0b, 0x00, 0x40, 0x01, 0x82, 0x00, 0x0a, 0xe5,
+  0xff, 0xff, 0x00, 0x00, 0x97, 0x00, 0x00, 0xf7, 0xff, 0x08, 0x83, 0x00,
+  0x03, 0xc3, 0xff, 0xff, 0x1c, 0x84, 0x00, 0x02, 0xfa, 0xef, 0x03, 0x83,
+  0x00, 0x00, 0x30, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x04, 0xfe, 0x3f,
+  0x00, 0x00, 0x06, 0x82, 0x00, 0x03, 0xe1, 0xff, 0xff, 0x7f, 0x83, 0x00,
+  0x01, 0x30, 0xfc, 0x83, 0xff, 0x10, 0x6f, 0x00, 0x00, 0xf8, 0xff, 0x03,
+  0x00, 0x30, 0xff, 0xaf, 0x00, 0x00, 0xf7, 0x0f, 0x00, 0x00, 0x06, 0x82,
+  0x00, 0x06, 0xf4, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x03,
+  0x60, 0xff, 0xff, 0x08, 0x83, 0x00, 0x00, 0xc2, 0x85, 0xff, 0x02, 0x00,
+  0x00, 0x30, 0x82, 0x00, 0x0b, 0x30, 0xfe, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0x7f, 0x84, 0x00, 0x00, 0xb6, 0x84, 0x00, 0x03,
+  0xf0, 0xff, 0xcf, 0x01, 0x83, 0x00, 0x06, 0xb2, 0xff, 0xff, 0x0b, 0x00,
+  0x60, 0x03, 0x82, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00,
+  0x02, 0xff, 0xff, 0x2c, 0x83, 0x00, 0x01, 0x10, 0xfa, 0x84, 0xff, 0x01,
+  0xcf, 0x01, 0x83, 0x00, 0x03, 0x90, 0xff, 0xff, 0x09, 0x83, 0x00, 0x09,
+  0xb1, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0xcf, 0x01, 0x82, 0x00,
+  0x04, 0x10, 0xf9, 0xff, 0xff, 0x9f, 0x84, 0x00, 0x00, 0x35, 0x84, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x0b, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x0a,
+  0x00, 0x00, 0xfb, 0xff, 0x9f, 0x83, 0x00, 0x11, 0x20, 0xfb, 0xcf, 0x00,
+  0x00, 0xd0, 0xff, 0xff, 0x09, 0x00, 0x50, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0xff, 0x1c, 0x83, 0x00, 0x03, 0x20, 0xff, 0xef, 0x03, 0x83, 0x00, 0x00,
+  0xf7, 0x84, 0xff, 0x01, 0xcf, 0x01, 0x83, 0x00, 0x03, 0x90, 0xff, 0xff,
+  0x1b, 0x83, 0x00, 0x02, 0xa1, 0xff, 0x0b, 0x83, 0x00, 0x0e, 0x20, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00,
+  0x06, 0x82, 0x00, 0x00, 0x90, 0xde, 0xff, 0x03, 0xdf, 0x19, 0x00, 0x20,
+  0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x00, 0x4f, 0x85, 0x00,
+  0x02, 0xfb, 0xff, 0x0f, 0x85, 0x00, 0x02, 0x90, 0xff, 0x8f, 0x82, 0x00,
+  0x03, 0x02, 0x00, 0x60, 0xfe, 0x84, 0xff, 0x00, 0x0b, 0x85, 0x00, 0x12,
+  0x90, 0xff, 0xff, 0x00, 0x00, 0x16, 0x00, 0x00, 0xfa, 0x8f, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x40, 0xff, 0xef, 0x01, 0x83, 0x00, 0x02, 0x10, 0xfe,
+  0x7f, 0x84, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01,
+  0xff, 0x3f, 0x85, 0x00, 0x09, 0x60, 0xff, 0xff, 0x07, 0x00, 0x00, 0x01,
+  0x00, 0x00, 0xf4, 0x83, 0xff, 0x0d, 0x9f, 0x00, 0x00, 0xf7, 0xff, 0x02,
+  0x00, 0x00, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x0f, 0x85, 0x00, 0x06, 0xc0,
+  0xff, 0x7f, 0x00, 0x00, 0xf7, 0x07, 0x83, 0x00, 0x08, 0x70, 0xff, 0x8f,
+  0x00, 0x00, 0x10, 0x00, 0x00, 0x20, 0x85, 0xff, 0x86, 0x00, 0x0a, 0xf5,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0x7f, 0x84, 0x00,
+  0x00, 0xb7, 0x84, 0x00, 0x02, 0xf3, 0xff, 0x1d, 0x84, 0x00, 0x03, 0x10,
+  0xfe, 0xff, 0x0b, 0x85, 0x00, 0x00, 0xe0, 0x83, 0xff, 0x00, 0x0f, 0x83,
+  0x00, 0x03, 0x10, 0xff, 0xef, 0x01, 0x84, 0x00, 0x00, 0xd0, 0x84, 0xff,
+  0x00, 0x1e, 0x84, 0x00, 0x02, 0xe0, 0xff, 0xbf, 0x82, 0x00, 0x13, 0x01,
+  0x00, 0x10, 0xfe, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x1d, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x0a, 0x84, 0x00, 0x00, 0x3b, 0x84,
+  0x00, 0x00, 0xfd, 0x83, 0xff, 0x21, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0xf7, 0xff, 0x0a, 0x00, 0x00, 0x01, 0x00, 0x00, 0xe1,
+  0xff, 0x01, 0x00, 0x90, 0xff, 0xff, 0x05, 0x00, 0xa0, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0xdf, 0x01, 0x83, 0x00, 0x08, 0x80, 0xff, 0x3f, 0x00, 0x00,
+  0x20, 0x00, 0x00, 0x90, 0x84, 0xff, 0x00, 0x2f, 0x84, 0x00, 0x02, 0xd0,
+  0xff, 0xcf, 0x82, 0x00, 0x04, 0x01, 0x00, 0x00, 0xfd, 0x0b, 0x83, 0x00,
+  0x0b, 0x40, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0x3f, 0x85, 0x00, 0x00, 0x10, 0xdd, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x00,
+  0xe4, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x19, 0x08, 0x00,
+  0x00, 0xb6, 0x29, 0x00, 0x00, 0xf2, 0xff, 0x0f, 0x00, 0x00, 0x10, 0xa9,
+  0x02, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xf9, 0xdf, 0x01, 0x00, 0xf4,
+  0x84, 0xff, 0x09, 0x0b, 0x00, 0x00, 0x70, 0x9b, 0x00, 0x00, 0x30, 0xff,
+  0xff, 0x84, 0x00, 0x17, 0xfc, 0x1d, 0x00, 0x00, 0xfc, 0x8f, 0x00, 0x00,
+  0xf9, 0x8f, 0x00, 0x00, 0xb2, 0xbd, 0x18, 0xb0, 0xff, 0x1f, 0x00, 0x00,
+  0xc8, 0xac, 0x05, 0xf3, 0x83, 0xff, 0x17, 0x7f, 0x17, 0x00, 0x00, 0x73,
+  0x97, 0xff, 0x3f, 0x00, 0x00, 0x10, 0xb8, 0x02, 0x00, 0x30, 0xff, 0xcf,
+  0x00, 0x00, 0xc0, 0xff, 0x06, 0x00, 0x90, 0x83, 0xff, 0x04, 0xcf, 0x00,
+  0x00, 0xf4, 0xef, 0x82, 0x00, 0x20, 0xfd, 0x5f, 0x00, 0x00, 0xfe, 0x0f,
+  0x00, 0x00, 0x30, 0xa9, 0x00, 0x00, 0x80, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0x7b, 0x07, 0x00, 0x00, 0x77, 0xd7, 0xff, 0x1d, 0x00, 0x00, 0xfc, 0x8f,
+  0x00, 0x00, 0xf7, 0x84, 0xff, 0x82, 0x00, 0x2c, 0xa4, 0x2a, 0x00, 0x00,
+  0xe1, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xbf, 0x77,
+  0x00, 0x00, 0x70, 0x77, 0xdd, 0x77, 0x01, 0x00, 0x50, 0x77, 0xfa, 0xff,
+  0x04, 0x00, 0x00, 0xb8, 0x08, 0x00, 0x00, 0xf6, 0xff, 0x0b, 0x00, 0x00,
+  0x40, 0x9a, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x0e, 0x7f, 0x17, 0x00, 0x00,
+  0x73, 0x97, 0xff, 0x5f, 0x00, 0x00, 0x80, 0x8b, 0x00, 0x00, 0x50, 0x84,
+  0xff, 0x2a, 0x0a, 0x00, 0x00, 0xda, 0x9b, 0x03, 0xf8, 0xff, 0x3f, 0x00,
+  0x00, 0xf9, 0x9f, 0x00, 0x00, 0xf6, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff,
+  0x04, 0x00, 0x50, 0xff, 0x0c, 0x00, 0x40, 0xff, 0xef, 0x02, 0x00, 0x00,
+  0xa7, 0x27, 0x60, 0x9f, 0x37, 0x00, 0x00, 0x73, 0x77, 0x84, 0xff, 0x2f,
+  0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf4, 0xef, 0x01,
+  0x00, 0xb0, 0xff, 0x09, 0x00, 0x60, 0xff, 0x06, 0x00, 0x60, 0xff, 0xff,
+  0x02, 0x00, 0xf0, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x4f, 0x00, 0x00, 0x60,
+  0x7a, 0x04, 0xf3, 0xff, 0x07, 0x00, 0x50, 0xfe, 0x2e, 0x00, 0x10, 0xfe,
+  0x83, 0xff, 0x28, 0x0b, 0x00, 0x00, 0xda, 0x9b, 0x03, 0xf7, 0xff, 0x3f,
+  0x00, 0x00, 0xf9, 0xcf, 0x00, 0x00, 0xf5, 0x7d, 0x07, 0x00, 0x00, 0x75,
+  0xb7, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f,
+  0x00, 0x00, 0x20, 0xba, 0x04, 0x00, 0x00, 0xf9, 0xdc, 0xff, 0x03, 0x5f,
+  0x00, 0x00, 0x91, 0x8d, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x84, 0xff, 0x19,
+  0x02, 0x00, 0x70, 0xff, 0xef, 0x01, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00,
+  0xe2, 0xff, 0x08, 0x00, 0x30, 0xff, 0x0c, 0x00, 0x20, 0xff, 0xff, 0x07,
+  0x00, 0xc0, 0x84, 0xff, 0x09, 0x0b, 0x00, 0x00, 0xf9, 0xff, 0x0c, 0x00,
+  0x00, 0xfc, 0xff, 0x82, 0x00, 0x19, 0x60, 0x77, 0xff, 0x06, 0x00, 0x70,
+  0xff, 0xff, 0x01, 0x00, 0xf2, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0xfb,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xdf, 0xfe, 0x84, 0xff, 0x16, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xc0, 0xff, 0x0a, 0x00,
+  0x20, 0xff, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0x1f, 0x00, 0x20, 0x84, 0xff,
+  0x03, 0x00, 0x00, 0xf3, 0xbf, 0x82, 0x00, 0x15, 0xfa, 0x3f, 0x00, 0x20,
+  0xff, 0x0f, 0x00, 0x00, 0xf2, 0xff, 0x06, 0x00, 0x70, 0xff, 0x7f, 0x00,
+  0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x07, 0x08, 0x00, 0x70,
+  0xff, 0xff, 0x01, 0x00, 0xf1, 0x84, 0xff, 0x15, 0x00, 0x00, 0x50, 0xff,
+  0xef, 0x00, 0x00, 0x90, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00, 0xb0,
+  0xff, 0xff, 0xcf, 0x00, 0x00, 0xb0, 0xff, 0xbf, 0x00, 0x00, 0xd0, 0xff,
+  0x0b, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x90, 0x84, 0xff, 0x0e, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x0e, 0x00, 0x00, 0xfb, 0xff, 0x0c, 0x00,
+  0x00, 0xfb, 0x83, 0xff, 0x29, 0x07, 0x00, 0x40, 0xff, 0xff, 0xcf, 0xff,
+  0xff, 0x0a, 0x00, 0x50, 0xff, 0xff, 0x05, 0x00, 0xd0, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xcf, 0x00, 0x00, 0xf1, 0xff, 0x7f, 0x00, 0x00, 0xf9, 0x9f,
+  0x00, 0x00, 0xc0, 0xff, 0xff, 0xf9, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0x85,
+  0xff, 0x2f, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf3,
+  0x9f, 0x00, 0x00, 0xf5, 0xff, 0x3f, 0x00, 0x00, 0xfd, 0x0b, 0x00, 0x30,
+  0xff, 0xef, 0x00, 0x00, 0xf4, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0c, 0x00,
+  0x00, 0xf9, 0xff, 0xbf, 0xfd, 0xff, 0x01, 0x00, 0xe0, 0xff, 0xbf, 0x00,
+  0x00, 0xf8, 0x83, 0xff, 0x28, 0x0a, 0x00, 0x40, 0xff, 0xff, 0xbf, 0xff,
+  0xff, 0x0a, 0x00, 0x40, 0xff, 0xff, 0x05, 0x00, 0xc0, 0xff, 0x0f, 0x00,
+  0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0x3f, 0x00, 0x00, 0xe2, 0xff, 0x4f, 0x00, 0x00, 0xf4, 0xdc, 0xff,
+  0x00, 0x3f, 0x82, 0x00, 0x00, 0xa1, 0x8c, 0xff, 0x02, 0x00, 0x00, 0xb0,
+  0x83, 0xff, 0x1a, 0xcf, 0x00, 0x00, 0xd0, 0xff, 0xff, 0x06, 0x00, 0x40,
+  0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x09, 0x00,
+  0x40, 0xff, 0xff, 0x0b, 0x00, 0x80, 0x84, 0xff, 0x09, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0x2f, 0x00, 0x00, 0xf9, 0xff, 0x82, 0x00, 0x0e, 0xfb, 0xff,
+  0xff, 0x02, 0x00, 0xd0, 0xff, 0xff, 0x07, 0x00, 0xe0, 0x7f, 0x00, 0x00,
+  0xa1, 0x83, 0xff, 0x03, 0x0f, 0x00, 0x00, 0xd5, 0x87, 0xff, 0x17, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfa, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0x2f, 0x00, 0x00, 0xfd, 0xff, 0x5f, 0x00, 0x00, 0xfe, 0x83,
+  0xff, 0x1c, 0x03, 0x00, 0xf0, 0x7f, 0x00, 0x03, 0x00, 0xf7, 0x0f, 0x00,
+  0x50, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x07, 0x03, 0x00,
+  0xd0, 0xff, 0xff, 0x07, 0x00, 0xb0, 0x84, 0xff, 0x15, 0x00, 0x00, 0xf0,
+  0xff, 0xff, 0x05, 0x00, 0x70, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00,
+  0xb0, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf1, 0xff, 0xff, 0x01, 0x00, 0x90,
+  0xff, 0x0b, 0x00, 0x20, 0xff, 0xff, 0x06, 0x00, 0x70, 0x84, 0xff, 0x0e,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x09, 0x00, 0x10, 0xff, 0xff, 0x2f,
+  0x00, 0x00, 0xf7, 0x83, 0xff, 0x03, 0x0a, 0x00, 0x10, 0xf9, 0x83, 0xff,
+  0x19, 0x05, 0x00, 0xa0, 0xff, 0xff, 0x0a, 0x00, 0xb0, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xbf, 0x00, 0x00, 0xf7, 0x4f,
+  0x00, 0x00, 0xf5, 0x83, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff,
+  0x22, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x5f, 0x00, 0x00, 0xf3, 0x4f,
+  0x00, 0x00, 0xfb, 0xff, 0x7f, 0x00, 0x00, 0xfb, 0x0f, 0x00, 0x00, 0xfe,
+  0xaf, 0x00, 0x00, 0xf9, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x06, 0x00, 0x20,
+  0x83, 0xff, 0x08, 0xaf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x00, 0x00, 0xf3,
+  0x83, 0xff, 0x03, 0x0b, 0x00, 0x00, 0xf9, 0x83, 0xff, 0x20, 0x05, 0x00,
+  0x90, 0xff, 0xff, 0x0b, 0x00, 0x80, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff,
+  0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xaf, 0x00, 0x00, 0xf1, 0xdc, 0xff, 0x05, 0x8f, 0x77,
+  0x02, 0x00, 0x00, 0xf8, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff,
+  0x1a, 0x8f, 0x00, 0x00, 0xf1, 0xff, 0xff, 0x0a, 0x00, 0x30, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x18, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0x4f, 0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0x50, 0xff, 0xff, 0xef, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0xb0, 0xcf, 0x82, 0x00, 0x04, 0x61,
+  0xfb, 0xff, 0xff, 0x4f, 0x82, 0x00, 0x01, 0x94, 0xfd, 0x85, 0xff, 0x17,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0x0d, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xfb,
+  0x83, 0xff, 0x1c, 0x07, 0x00, 0xe0, 0x4f, 0x00, 0x37, 0x00, 0xf4, 0x0e,
+  0x00, 0x80, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x07, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0x07, 0x00, 0xa0, 0x84, 0xff, 0x15, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03,
+  0x00, 0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00,
+  0x70, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff,
+  0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x06, 0x00, 0x40, 0xff, 0xff,
+  0x7f, 0x00, 0x00, 0xf5, 0x83, 0xff, 0x04, 0x0d, 0x00, 0x00, 0x10, 0xa5,
+  0x82, 0xff, 0x19, 0x03, 0x00, 0xc0, 0xff, 0xff, 0x0b, 0x00, 0x70, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x3f, 0x00, 0x00, 0xf9, 0xff, 0xdf, 0x00, 0x00,
+  0xf4, 0x0f, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7,
+  0x85, 0xff, 0x22, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf3, 0x0f, 0x00, 0x00, 0xfe, 0xff, 0xbf, 0x00, 0x00, 0xf7, 0x5f, 0x00,
+  0x00, 0xfb, 0x6f, 0x00, 0x00, 0xfe, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x03,
+  0x00, 0x70, 0x83, 0xff, 0x08, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x00,
+  0x00, 0xf3, 0x83, 0xff, 0x04, 0x0e, 0x00, 0x00, 0x10, 0xa5, 0x82, 0xff,
+  0x20, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x0b, 0x00, 0x70, 0xff, 0x0f, 0x00,
+  0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0,
+  0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xcf, 0x00, 0x00, 0xf0, 0xde, 0xff,
+  0x03, 0x9f, 0x00, 0x00, 0xd1, 0x8b, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83,
+  0xff, 0x1a, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0x0d, 0x00, 0x00,
+  0xfc, 0xff, 0x02, 0x00, 0xb0, 0x84, 0xff, 0x0f, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xf6, 0xff, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xbf,
+  0x86, 0x00, 0x02, 0x80, 0xff, 0x06, 0x82, 0x00, 0x03, 0x20, 0xf9, 0xff,
+  0xcf, 0x83, 0x00, 0x01, 0x50, 0xfd, 0x84, 0xff, 0x0f, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0x0b, 0x86, 0x00, 0x00, 0xf8, 0x83, 0xff, 0x1f, 0x0a, 0x00, 0xb0, 0x2f,
+  0x00, 0x79, 0x00, 0xf2, 0x0b, 0x00, 0xb0, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0xef, 0x86, 0x00, 0x00, 0x70, 0x84, 0xff, 0x15, 0x00,
+  0x00, 0xf0, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16,
+  0x03, 0x00, 0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x07,
+  0x00, 0x40, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84,
+  0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03, 0x00, 0x70, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x00, 0x7f, 0x83, 0x00, 0x03,
+  0x81, 0xff, 0xff, 0x01, 0x85, 0x00, 0x06, 0x60, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0x3f, 0x86, 0x00, 0x04, 0xf3, 0x0e, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x03, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x0a, 0x0f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xf3, 0x0f, 0x86, 0x00, 0x10, 0xf6, 0xaf,
+  0x00, 0x00, 0xf7, 0x3f, 0x00, 0x20, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff,
+  0x01, 0x00, 0x80, 0x83, 0xff, 0x00, 0x6f, 0x86, 0x00, 0x00, 0xf0, 0x83,
+  0xff, 0x00, 0x8f, 0x83, 0x00, 0x03, 0x71, 0xfe, 0xff, 0x01, 0x85, 0x00,
+  0x19, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00,
+  0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x00, 0x00, 0xe0, 0xdf, 0xff, 0x02, 0x03, 0x00, 0x90, 0x8b, 0xff, 0x02,
+  0x00, 0x00, 0xb0, 0x83, 0xff, 0x1a, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0x5f, 0x00, 0x00, 0x61, 0x28, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x0f,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0xff, 0xbf, 0x86, 0x00, 0x02, 0x70, 0xff, 0x7f, 0x83, 0x00,
+  0x03, 0x40, 0xfe, 0xff, 0x1c, 0x83, 0x00, 0x00, 0x91, 0x84, 0xff, 0x0f,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0x0b, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x1f, 0x0d,
+  0x00, 0xa0, 0x0e, 0x00, 0x9b, 0x00, 0xf0, 0x09, 0x00, 0xf0, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0xbf, 0x86, 0x00, 0x00, 0x70, 0x84,
+  0xff, 0x15, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0b, 0x00, 0x10, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x07, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x03,
+  0x00, 0x70, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x00, 0x07,
+  0x83, 0x00, 0x01, 0xe3, 0xff, 0x86, 0x00, 0x06, 0x30, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x1f, 0x86, 0x00, 0x04, 0xf0, 0x0b, 0x00, 0x00, 0xfe, 0x83,
+  0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x0a, 0x0f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xf6, 0x0f, 0x86, 0x00, 0x10, 0xf3,
+  0xff, 0x00, 0x00, 0xf3, 0x0e, 0x00, 0x80, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x00, 0x3f, 0x86, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x00, 0x08, 0x83, 0x00, 0x01, 0xd2, 0xff, 0x86, 0x00, 0x19,
+  0x30, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff,
+  0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x00,
+  0x00, 0xb0, 0xdf, 0xff, 0x02, 0x04, 0x00, 0x70, 0x8b, 0xff, 0x02, 0x00,
+  0x00, 0xb0, 0x83, 0xff, 0x14, 0x7f, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xef, 0x03, 0x84, 0x00, 0x00, 0xfc, 0x84, 0xff, 0x0f, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0x7f, 0x00, 0x00, 0xf5, 0xff, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0xcf, 0x86, 0x00, 0x03, 0x70, 0xff, 0xff, 0x5c, 0x83, 0x00, 0x03, 0xf6,
+  0xff, 0xef, 0x19, 0x82, 0x00, 0x01, 0x10, 0xfd, 0x83, 0xff, 0x0f, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0x0c, 0x86, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x1c, 0x1f, 0x00,
+  0x70, 0x0b, 0x00, 0xcf, 0x00, 0xb0, 0x07, 0x00, 0xf3, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff,
+  0x0f, 0x00, 0x00, 0x82, 0xff, 0x86, 0x00, 0x00, 0x70, 0x84, 0xff, 0x15,
+  0x00, 0x00, 0xf0, 0xff, 0xff, 0x09, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff,
+  0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x07, 0x00, 0x30, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x70,
+  0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0x84, 0xff, 0x01, 0xdf, 0x05, 0x82,
+  0x00, 0x02, 0x50, 0xff, 0x01, 0x85, 0x00, 0x06, 0x40, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x3f, 0x86, 0x00, 0x04, 0xf3, 0x0d, 0x00, 0x00, 0xfb, 0x83,
+  0xff, 0x03, 0x7f, 0x00, 0x00, 0xf7, 0x85, 0xff, 0x0a, 0x0f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x0e, 0x00, 0x00, 0xf9, 0x0f, 0x86, 0x00, 0x10, 0xf4,
+  0xff, 0x05, 0x00, 0xf1, 0x0a, 0x00, 0xd0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0xff, 0x00, 0x00, 0x90, 0x83, 0xff, 0x00, 0x7f, 0x86, 0x00, 0x00, 0xf0,
+  0x84, 0xff, 0x01, 0xdf, 0x06, 0x82, 0x00, 0x02, 0x40, 0xff, 0x01, 0x85,
+  0x00, 0x19, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00,
+  0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff,
+  0xff, 0x00, 0x00, 0xd0, 0xdb, 0xff, 0x00, 0xfb, 0x82, 0xff, 0x05, 0x03,
+  0x00, 0x70, 0xff, 0xff, 0xfc, 0x88, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83,
+  0xff, 0x14, 0xbf, 0x00, 0x00, 0xf3, 0xff, 0xff, 0x0a, 0x00, 0x00, 0xff,
+  0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x4f, 0x83,
+  0x00, 0x00, 0xc2, 0x85, 0xff, 0x0c, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xf7, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x00, 0x00,
+  0xf0, 0x87, 0xff, 0x04, 0xae, 0x05, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x04,
+  0x8c, 0x01, 0x00, 0x00, 0xf7, 0x83, 0xff, 0x11, 0x3f, 0x00, 0x00, 0xf7,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0x0f,
+  0x00, 0x00, 0x89, 0xff, 0x1c, 0x4f, 0x00, 0x50, 0x07, 0x20, 0xff, 0x00,
+  0x80, 0x03, 0x00, 0xf6, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0x82, 0xff,
+  0x02, 0x00, 0x00, 0xf0, 0x89, 0xff, 0x15, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0x07, 0x00, 0x30, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0xff, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x16, 0x03, 0x00, 0xb0, 0xff,
+  0xff, 0x6f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x04, 0x00, 0x60, 0xff, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00,
+  0x00, 0xf7, 0xff, 0xff, 0x07, 0x00, 0x40, 0xff, 0xff, 0x7f, 0x00, 0x00,
+  0xf3, 0x86, 0xff, 0x00, 0x6b, 0x82, 0x00, 0x03, 0xff, 0x03, 0x00, 0xb0,
+  0x85, 0xff, 0x07, 0x07, 0x00, 0x70, 0xff, 0x5f, 0x00, 0x00, 0xf8, 0x84,
+  0xff, 0x03, 0x0f, 0x00, 0x00, 0xfb, 0x83, 0xff, 0x03, 0x7f, 0x00, 0x00,
+  0xf7, 0x85, 0xff, 0x0d, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x07, 0x00,
+  0x00, 0xfd, 0x3f, 0x00, 0x00, 0xfd, 0x85, 0xff, 0x0e, 0x0a, 0x00, 0xc0,
+  0x06, 0x00, 0xf2, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x03, 0x00, 0x70,
+  0x83, 0xff, 0x03, 0x8f, 0x00, 0x00, 0xf5, 0x8b, 0xff, 0x00, 0x6b, 0x82,
+  0x00, 0x03, 0xfc, 0x03, 0x00, 0xa0, 0x85, 0xff, 0x17, 0x0f, 0x00, 0x00,
+  0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x03, 0x00, 0xb0, 0xff,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xbf, 0x00, 0x00, 0xf0, 0xda, 0xff, 0x0b,
+  0x9f, 0x60, 0xfe, 0xff, 0xaf, 0x00, 0x00, 0x90, 0xff, 0x19, 0x10, 0xf9,
+  0x87, 0xff, 0x02, 0x00, 0x00, 0xb0, 0x83, 0xff, 0x18, 0xcf, 0x00, 0x00,
+  0xe0, 0xff, 0xff, 0x05, 0x00, 0x40, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x34, 0x33, 0xc7, 0x86, 0xff,
+  0x0c, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x1f, 0x00, 0x00, 0xf9, 0xff, 0x00,
+  0x00, 0xf0, 0x82, 0xff, 0x02, 0x02, 0x00, 0xa0, 0x88, 0xff, 0x03, 0xcf,
+  0x00, 0x00, 0xd0, 0x83, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf5, 0x83, 0xff,
+  0x12, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff,
+  0x0b, 0x00, 0x00, 0xff, 0x1f, 0x00, 0x00, 0xfb, 0x88, 0xff, 0x1c, 0x7f,
+  0x00, 0x30, 0x04, 0x40, 0xff, 0x02, 0x60, 0x03, 0x00, 0xf9, 0xff, 0x0f,
+  0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7,
+  0xff, 0x0f, 0x00, 0x00, 0x82, 0xff, 0x02, 0x03, 0x00, 0xa0, 0x89, 0xff,
+  0x15, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x04, 0x00, 0x60, 0xff, 0x0f, 0x00,
+  0x00, 0xff, 0xff, 0x06, 0x00, 0x70, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x82,
+  0xff, 0x16, 0x03, 0x00, 0xb0, 0xff, 0xff, 0x7f, 0x00, 0x00, 0xf3, 0xff,
+  0xff, 0x02, 0x00, 0x90, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0x84, 0xff, 0x0e, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x09, 0x00,
+  0x20, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xf8, 0x87, 0xff, 0x06, 0x0c, 0x00,
+  0x00, 0xfb, 0x07, 0x00, 0x70, 0x85, 0xff, 0x07, 0x07, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0xf5, 0x84, 0xff, 0x03, 0x2f, 0x00, 0x00, 0xf5, 0x83,
+  0xff, 0x03, 0x9f, 0x00, 0x00, 0xf5, 0x85, 0xff, 0x0d, 0x0f, 0x00, 0x00,
+  0xf7, 0xff, 0xdf, 0x01, 0x00, 0x30, 0xff, 0x4f, 0x00, 0x00, 0xf9, 0x85,
+  0xff, 0x0e, 0x0f, 0x00, 0x80, 0x03, 0x00, 0xf6, 0xff, 0xff, 0x00, 0x00,
+  0xf0, 0xff, 0x05, 0x00, 0x40, 0x83, 0xff, 0x03, 0xbf, 0x00, 0x00, 0xf3,
+  0x8c, 0xff, 0x06, 0x0e, 0x00, 0x00, 0xfa, 0x07, 0x00, 0x60, 0x85, 0xff,
+  0x1a, 0x1f, 0x00, 0x00, 0xfb, 0xff, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x03, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0x8f, 0x00, 0x00,
+  0xf1, 0xff, 0xef, 0xfc, 0xd7, 0xff, 0x0b, 0x09, 0x00, 0x72, 0xab, 0x06,
+  0x00, 0x00, 0xf1, 0xdf, 0x00, 0x00, 0xd0, 0x87, 0xff, 0x02, 0x00, 0x00,
+  0x90, 0x83, 0xcc, 0x15, 0xff, 0x01, 0x00, 0x80, 0xff, 0xef, 0x02, 0x00,
+  0x90, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xdf,
+  0x00, 0x00, 0x89, 0xff, 0x0c, 0x0b, 0x00, 0x10, 0xfc, 0xff, 0x08, 0x00,
+  0x00, 0xfe, 0xff, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x02, 0x06, 0x00, 0x40,
+  0x82, 0xff, 0x11, 0xea, 0xff, 0xff, 0x9c, 0xff, 0xff, 0xef, 0x00, 0x00,
+  0xd0, 0xff, 0xd8, 0xff, 0xff, 0x6f, 0x00, 0x00, 0xf5, 0x83, 0xff, 0x16,
+  0x7f, 0x00, 0x00, 0xf5, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b,
+  0x00, 0x00, 0xff, 0x5f, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xaf, 0xfe, 0x84,
+  0xff, 0x22, 0xbf, 0x00, 0x10, 0x02, 0x70, 0xff, 0x05, 0x30, 0x00, 0x00,
+  0xfd, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff, 0x7f,
+  0x00, 0x00, 0xf7, 0xff, 0x0f, 0x00, 0x00, 0xfd, 0xff, 0xff, 0x07, 0x00,
+  0x40, 0x82, 0xff, 0x00, 0xea, 0x85, 0xff, 0x15, 0x00, 0x00, 0xb0, 0xff,
+  0xef, 0x00, 0x00, 0xa0, 0xff, 0x0f, 0x00, 0x00, 0xfe, 0xcf, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x00, 0x00, 0xd0, 0x82, 0xff, 0x16, 0x04, 0x00, 0x70,
+  0xff, 0xff, 0xcf, 0x00, 0x00, 0xc0, 0xff, 0xbf, 0x00, 0x00, 0xe0, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84, 0xff, 0x0e, 0x7f,
+  0x00, 0x00, 0xf5, 0xff, 0xff, 0x0d, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00,
+  0x00, 0xfd, 0x83, 0xff, 0x29, 0xcf, 0xe8, 0xff, 0xff, 0x0f, 0x00, 0x00,
+  0xfb, 0x0a, 0x00, 0x10, 0xfe, 0xff, 0xff, 0xda, 0xff, 0xff, 0x07, 0x00,
+  0x70, 0xff, 0xbf, 0x00, 0x00, 0xc0, 0xff, 0xff, 0xbf, 0xfc, 0xff, 0x8f,
+  0x00, 0x00, 0xc1, 0xff, 0xef, 0xfa, 0xff, 0xbf, 0x00, 0x00, 0xf3, 0x85,
+  0xff, 0x2e, 0x0f, 0x00, 0x00, 0xf7, 0xff, 0x1a, 0x00, 0x00, 0xb0, 0xff,
+  0x9f, 0x00, 0x00, 0xf2, 0xff, 0xff, 0xaf, 0xfd, 0xff, 0xff, 0x5f, 0x00,
+  0x40, 0x00, 0x00, 0xfc, 0xff, 0xff, 0x00, 0x00, 0xf0, 0xff, 0x0a, 0x00,
+  0x00, 0xf9, 0xff, 0xaf, 0xfe, 0xef, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xdf,
+  0xfa, 0x84, 0xff, 0x2c, 0xef, 0xe9, 0xff, 0xff, 0x2f, 0x00, 0x00, 0xfb,
+  0x0a, 0x00, 0x10, 0xfd, 0xff, 0xff, 0xcb, 0xff, 0xff, 0x3f, 0x00, 0x00,
+  0xf9, 0xff, 0xff, 0x0c, 0x00, 0x00, 0xff, 0x9f, 0x00, 0x00, 0xb0, 0xff,
+  0x3f, 0x00, 0x00, 0xf5, 0xff, 0x2e, 0x00, 0x00, 0xf6, 0xff, 0x07, 0x20,
+  0xfc, 0xd6, 0xff, 0x00, 0x02, 0x85, 0x00, 0x04, 0xf9, 0xaf, 0x00, 0x00,
+  0xa0, 0x87, 0xff, 0x86, 0x00, 0x19, 0xff, 0x0a, 0x00, 0x00, 0xc7, 0x3a,
+  0x00, 0x00, 0xe1, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0x9f, 0x00, 0x00, 0x86, 0x88, 0xa8, 0xfc, 0x85, 0xff, 0x0c, 0x0b,
+  0x00, 0x00, 0x91, 0x7c, 0x00, 0x00, 0x40, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x17, 0x0e, 0x00, 0x00, 0xb4, 0xcc, 0x2a, 0x60, 0xff, 0xcf,
+  0x01, 0x82, 0xcc, 0x5c, 0x00, 0x00, 0xf0, 0x6f, 0x00, 0xa6, 0xcc, 0x1a,
+  0x00, 0x00, 0xf8, 0x83, 0xff, 0x16, 0x7f, 0x00, 0x00, 0x70, 0x38, 0xfd,
+  0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xef, 0x00, 0x00,
+  0x40, 0xdc, 0x9c, 0x02, 0xf6, 0x85, 0xff, 0x82, 0x00, 0x02, 0xa0, 0xff,
+  0x07, 0x82, 0x00, 0x1c, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x2f, 0x00, 0x00, 0x83,
+  0x66, 0xff, 0x1e, 0x00, 0x00, 0xb4, 0xcc, 0x2a, 0x50, 0x85, 0xff, 0x2f,
+  0x00, 0x00, 0x10, 0xc8, 0x3b, 0x00, 0x00, 0xf1, 0xff, 0x0f, 0x00, 0x00,
+  0xc6, 0x17, 0x00, 0x00, 0x70, 0xff, 0xff, 0x02, 0x00, 0x30, 0x68, 0xf5,
+  0xff, 0x07, 0x00, 0x10, 0x77, 0xe3, 0xff, 0x05, 0x00, 0x10, 0xc9, 0x19,
+  0x00, 0x00, 0xf5, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0x84, 0xff, 0x0d, 0x7f, 0x00, 0x00, 0x70, 0x37, 0xfd, 0x6f, 0x00, 0x00,
+  0x91, 0x9c, 0x01, 0x00, 0x30, 0x84, 0xff, 0x1e, 0x2e, 0x10, 0xc8, 0xcc,
+  0x05, 0x00, 0x00, 0xff, 0x3f, 0x00, 0x00, 0xa2, 0xcc, 0x4a, 0x30, 0xff,
+  0xff, 0x07, 0x00, 0x10, 0xd8, 0xff, 0x05, 0x00, 0x10, 0xca, 0xbc, 0x05,
+  0xe1, 0xff, 0xdf, 0x82, 0x00, 0x09, 0x85, 0x17, 0x70, 0xff, 0xdf, 0x00,
+  0x00, 0x50, 0x38, 0xfb, 0x83, 0xff, 0x04, 0x0f, 0x00, 0x00, 0x42, 0x02,
+  0x82, 0x00, 0x0c, 0xf5, 0xff, 0xff, 0x02, 0x00, 0x30, 0xcb, 0xac, 0x04,
+  0xf4, 0xff, 0xff, 0x9f, 0x82, 0x00, 0x00, 0x10, 0x82, 0xff, 0x12, 0x00,
+  0x00, 0xf0, 0xff, 0x2f, 0x00, 0x00, 0x40, 0x78, 0x02, 0xf5, 0xff, 0x08,
+  0x00, 0x00, 0xc8, 0xcc, 0x06, 0xb0, 0x84, 0xff, 0x2c, 0x3e, 0x10, 0xc7,
+  0xcd, 0x08, 0x00, 0x00, 0xfd, 0x3f, 0x00, 0x00, 0xa2, 0xcc, 0x4a, 0x20,
+  0xfe, 0xff, 0x5f, 0x00, 0x00, 0x81, 0x37, 0xff, 0x0f, 0x00, 0x00, 0xc6,
+  0x17, 0x00, 0x00, 0xb0, 0xff, 0x3f, 0x00, 0x00, 0x50, 0xab, 0x03, 0x00,
+  0x00, 0xfc, 0x8f, 0x00, 0x00, 0xf2, 0xd6, 0xff, 0x00, 0x3e, 0x84, 0x00,
+  0x05, 0x90, 0xff, 0xcf, 0x00, 0x00, 0xc0, 0x87, 0xff, 0x85, 0x00, 0x02,
+  0x30, 0xff, 0x3f, 0x85, 0x00, 0x0b, 0xfb, 0xff, 0x0f, 0x00, 0x00, 0xff,
+  0xff, 0x0b, 0x00, 0x30, 0xff, 0xbf, 0x84, 0x00, 0x01, 0x20, 0xfa, 0x84,
+  0xff, 0x00, 0x0b, 0x85, 0x00, 0x05, 0xd0, 0xff, 0xff, 0x00, 0x00, 0xf0,
+  0x82, 0xff, 0x00, 0x9f, 0x85, 0x00, 0x01, 0xf9, 0x2e, 0x85, 0x00, 0x01,
+  0xf9, 0x06, 0x84, 0x00, 0x00, 0x10, 0x84, 0xff, 0x00, 0xdf, 0x83, 0x00,
+  0x0b, 0xf5, 0x3f, 0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x84, 0x00, 0x00, 0x90, 0x85, 0xff, 0x19, 0x02, 0x00, 0x00, 0xd0,
+  0xff, 0x0b, 0x00, 0x00, 0x30, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x07, 0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0x7f, 0x83, 0x00,
+  0x01, 0xfd, 0x9f, 0x85, 0x00, 0x00, 0xf8, 0x84, 0xff, 0x86, 0x00, 0x02,
+  0xf9, 0xff, 0x4f, 0x85, 0x00, 0x03, 0x70, 0xff, 0xff, 0x07, 0x82, 0x00,
+  0x02, 0xd0, 0xff, 0x0b, 0x82, 0x00, 0x02, 0x70, 0xff, 0x0e, 0x85, 0x00,
+  0x09, 0xfe, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70, 0x84,
+  0xff, 0x00, 0xdf, 0x83, 0x00, 0x01, 0xf5, 0xef, 0x85, 0x00, 0x00, 0xe0,
+  0x83, 0xff, 0x01, 0xef, 0x03, 0x84, 0x00, 0x02, 0x70, 0xff, 0xdf, 0x85,
+  0x00, 0x07, 0xf6, 0xff, 0x0a, 0x00, 0x00, 0x70, 0xff, 0x0d, 0x84, 0x00,
+  0x03, 0x40, 0xff, 0xff, 0x09, 0x84, 0x00, 0x02, 0xfc, 0xff, 0x02, 0x82,
+  0x00, 0x00, 0xf4, 0x83, 0xff, 0x00, 0x0f, 0x85, 0x00, 0x00, 0x60, 0x82,
+  0xff, 0x00, 0x0b, 0x84, 0x00, 0x03, 0x70, 0xff, 0xff, 0xef, 0x82, 0x00,
+  0x00, 0x60, 0x82, 0xff, 0x04, 0x00, 0x00, 0xf0, 0xff, 0xcf, 0x84, 0x00,
+  0x02, 0x90, 0xff, 0x1f, 0x84, 0x00, 0x01, 0x10, 0xfe, 0x82, 0xff, 0x01,
+  0xef, 0x03, 0x84, 0x00, 0x02, 0x50, 0xff, 0xdf, 0x85, 0x00, 0x02, 0xf5,
+  0xff, 0xaf, 0x83, 0x00, 0x01, 0xf9, 0x1f, 0x85, 0x00, 0x02, 0xb0, 0xff,
+  0x3f, 0x85, 0x00, 0x05, 0x50, 0xff, 0x4f, 0x00, 0x00, 0xf0, 0xd7, 0xff,
+  0x00, 0x29, 0x82, 0x00, 0x06, 0x40, 0xfc, 0xff, 0xff, 0x04, 0x00, 0xf5,
+  0x87, 0xff, 0x85, 0x00, 0x03, 0x50, 0xff, 0xef, 0x03, 0x83, 0x00, 0x0d,
+  0x90, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0x03, 0x84, 0x00, 0x00, 0x60, 0x84, 0xff, 0x00, 0x0b, 0x85, 0x00,
+  0x05, 0xf9, 0xff, 0xff, 0x00, 0x00, 0xf0, 0x83, 0xff, 0x00, 0x08, 0x84,
+  0x00, 0x01, 0xfa, 0x4e, 0x84, 0x00, 0x02, 0x50, 0xff, 0x09, 0x84, 0x00,
+  0x00, 0xc0, 0x85, 0xff, 0x00, 0x06, 0x82, 0x00, 0x0b, 0xd0, 0x3f, 0x00,
+  0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0xff, 0xff, 0x7f, 0x84, 0x00, 0x00,
+  0xa0, 0x85, 0xff, 0x19, 0x05, 0x00, 0x00, 0xf0, 0xff, 0x0e, 0x00, 0x00,
+  0x70, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07, 0x00, 0x70, 0xff,
+  0x7f, 0x00, 0x00, 0xf7, 0xff, 0xef, 0x83, 0x00, 0x02, 0xf5, 0xff, 0x08,
+  0x84, 0x00, 0x00, 0xf9, 0x84, 0xff, 0x02, 0x00, 0x00, 0x01, 0x82, 0x00,
+  0x03, 0x50, 0xff, 0xff, 0xbf, 0x83, 0x00, 0x05, 0x09, 0x00, 0x70, 0xff,
+  0xff, 0x0e, 0x82, 0x00, 0x02, 0x50, 0xff, 0x5f, 0x82, 0x00, 0x03, 0x10,
+  0xfe, 0xbf, 0x01, 0x83, 0x00, 0x0a, 0xc2, 0xff, 0xff, 0x0b, 0x00, 0x30,
+  0xff, 0xff, 0x07, 0x00, 0x70, 0x85, 0xff, 0x00, 0x06, 0x82, 0x00, 0x02,
+  0xd0, 0xff, 0x1b, 0x84, 0x00, 0x00, 0xfc, 0x83, 0xff, 0x01, 0xef, 0x05,
+  0x84, 0x00, 0x03, 0xf5, 0xff, 0xff, 0x0a, 0x84, 0x00, 0x08, 0xf7, 0xff,
+  0x1f, 0x00, 0x00, 0x30, 0xff, 0xbf, 0x01, 0x83, 0x00, 0x03, 0x50, 0xfe,
+  0xff, 0x8f, 0x84, 0x00, 0x02, 0xf5, 0xff, 0x0b, 0x82, 0x00, 0x00, 0xa0,
+  0x83, 0xff, 0x00, 0x0f, 0x84, 0x00, 0x01, 0x40, 0xfd, 0x82, 0xff, 0x00,
+  0xaf, 0x84, 0x00, 0x00, 0x70, 0x82, 0xff, 0x03, 0x04, 0x00, 0x00, 0xa0,
+  0x82, 0xff, 0x05, 0x00, 0x00, 0xf0, 0xff, 0xff, 0x0a, 0x83, 0x00, 0x03,
+  0x30, 0xff, 0xdf, 0x03, 0x83, 0x00, 0x01, 0x30, 0xfc, 0x82, 0xff, 0x01,
+  0xef, 0x05, 0x84, 0x00, 0x03, 0xe2, 0xff, 0xff, 0x0a, 0x84, 0x00, 0x03,
+  0xe5, 0xff, 0xff, 0x03, 0x82, 0x00, 0x01, 0xf2, 0xaf, 0x82, 0x00, 0x05,
+  0x10, 0x08, 0x00, 0xb0, 0xff, 0x3f, 0x85, 0x00, 0x05, 0xe2, 0xff, 0x8f,
+  0x00, 0x00, 0xf0, 0xd8, 0xff, 0x03, 0xbd, 0x77, 0xb8, 0xfe, 0x82, 0xff,
+  0x01, 0xaf, 0xb7, 0x88, 0xff, 0x85, 0x00, 0x03, 0x70, 0xff, 0xff, 0x8f,
+  0x82, 0x00, 0x0e, 0x40, 0xfc, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff,
+  0x0b, 0x00, 0x30, 0xff, 0xff, 0x7e, 0x85, 0x00, 0x00, 0xfb, 0x83, 0xff,
+  0x06, 0x0b, 0x00, 0x30, 0x0b, 0x00, 0x00, 0xa1, 0x82, 0xff, 0x02, 0x00,
+  0x00, 0xf0, 0x83, 0xff, 0x01, 0xdf, 0x03, 0x82, 0x00, 0x03, 0xe7, 0xff,
+  0xff, 0x3b, 0x82, 0x00, 0x04, 0x10, 0xf9, 0xff, 0xdf, 0x05, 0x82, 0x00,
+  0x01, 0x50, 0xfd, 0x85, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x08, 0xc3, 0x3f,
+  0x00, 0x00, 0xfb, 0xff, 0x0b, 0x00, 0x00, 0x82, 0xff, 0x00, 0x2c, 0x82,
+  0x00, 0x01, 0x70, 0xfe, 0x85, 0xff, 0x1a, 0x08, 0x00, 0x00, 0xf3, 0xff,
+  0x1f, 0x00, 0x00, 0xa0, 0xff, 0xff, 0x0f, 0x00, 0x00, 0xff, 0xff, 0x07,
+  0x00, 0x70, 0xff, 0x7f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x3d, 0x82, 0x00,
+  0x03, 0xf7, 0xff, 0xdf, 0x03, 0x82, 0x00, 0x00, 0xe7, 0x85, 0xff, 0x06,
+  0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0xf7, 0x82, 0xff, 0x16, 0x09, 0x00,
+  0x00, 0xc2, 0x0f, 0x00, 0x70, 0xff, 0xff, 0xdf, 0x03, 0x00, 0x00, 0x70,
+  0xff, 0xef, 0x06, 0x00, 0x00, 0x50, 0xfe, 0xff, 0x6e, 0x82, 0x00, 0x0b,
+  0x60, 0xfe, 0xff, 0xff, 0x0b, 0x00, 0x30, 0xff, 0xff, 0x07, 0x00, 0x70,
+  0x85, 0xff, 0x00, 0x7f, 0x82, 0x00, 0x03, 0xc3, 0xff, 0xef, 0x06, 0x82,
+  0x00, 0x00, 0xe5, 0x85, 0xff, 0x01, 0xbf, 0x03, 0x82, 0x00, 0x00, 0x90,
+  0x82, 0xff, 0x01, 0xef, 0x04, 0x82, 0x00, 0x09, 0xd5, 0xff, 0xff, 0xcf,
+  0x02, 0x00, 0x00, 0xfe, 0xff, 0x6e, 0x82, 0x00, 0x01, 0x30, 0xfc, 0x82,
+  0xff, 0x00, 0x4b, 0x82, 0x00, 0x03, 0xb1, 0xff, 0xff, 0xaf, 0x82, 0x00,
+  0x00, 0xa1, 0x83, 0xff, 0x00, 0x0f, 0x82, 0x00, 0x02, 0x30, 0x75, 0xfb,
+  0x84, 0xff, 0x00, 0x3d, 0x82, 0x00, 0x01, 0x50, 0xfe, 0x82, 0xff, 0x03,
+  0x09, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x06, 0x00, 0x00, 0xf0, 0xff, 0xff,
+  0xcf, 0x05, 0x82, 0x00, 0x03, 0xf9, 0xff, 0xff, 0x8f, 0x82, 0x00, 0x01,
+  0x10, 0xfb, 0x84, 0xff, 0x01, 0xbf, 0x03, 0x82, 0x00, 0x00, 0x70, 0x82,
+  0xff, 0x01, 0xef, 0x04, 0x82, 0x00, 0x00, 0xd4, 0x82, 0xff, 0x00, 0x4e,
+  0x82, 0x00, 0x16, 0xe5, 0xff, 0x08, 0x00, 0x00, 0xe2, 0x0c, 0x00, 0xb0,
+  0xff, 0x3f, 0x00, 0x00, 0x66, 0x00, 0x00, 0x40, 0xfe, 0xff, 0xef, 0x02,
+  0x00, 0xf9, 0xf4, 0xff, 0x03, 0xdf, 0x7b, 0xb8, 0xfd, 0x8e, 0xff, 0x05,
+  0xbb, 0xbb, 0x09, 0x00, 0x00, 0xf4, 0x83, 0xff, 0x05, 0x0b, 0x00, 0x30,
+  0xff, 0x8b, 0xb8, 0x8c, 0xff, 0x02, 0x9b, 0xb7, 0xfd, 0x83, 0xff, 0x03,
+  0xbe, 0x77, 0xa7, 0xfd, 0x83, 0xff, 0x02, 0x9c, 0x77, 0xb8, 0x88, 0xff,
+  0x02, 0xbd, 0x77, 0xd9, 0x8c, 0xff, 0x02, 0xbf, 0x79, 0xdb, 0xa2, 0xff,
+  0x02, 0x9b, 0x77, 0xfb, 0x83, 0xff, 0x02, 0x9b, 0xb7, 0xfd, 0x89, 0xff,
+  0x02, 0xaf, 0x77, 0xeb, 0x83, 0xff, 0x02, 0xdf, 0x7b, 0xda, 0x86, 0xff,
+  0x02, 0xbf, 0x79, 0xb7, 0x82, 0xff, 0x03, 0xdf, 0x7b, 0xa7, 0xfd, 0x82,
+  0xff, 0x02, 0xcf, 0x7a, 0xb9, 0x92, 0xff, 0x02, 0xbd, 0x77, 0xda, 0x83,
+  0xff, 0x02, 0xac, 0x97, 0xeb, 0x87, 0xff, 0x03, 0xef, 0x7b, 0x77, 0xc9,
+  0x85, 0xff, 0x02, 0xac, 0xa7, 0xfc, 0x83, 0xff, 0x02, 0xbf, 0x78, 0xc8,
+  0x82, 0xff, 0x02, 0xdf, 0x7b, 0xb9, 0x85, 0xff, 0x02, 0xbd, 0x77, 0xdb,
+  0x83, 0xff, 0x02, 0xbe, 0x78, 0xc9, 0x91, 0xff, 0x02, 0xcf, 0x7a, 0xca,
+  0x91, 0xff, 0x03, 0xef, 0x8b, 0xa7, 0xfc, 0x83, 0xff, 0x03, 0xdf, 0x8b,
+  0xb8, 0xfe, 0x86, 0xff, 0x03, 0xef, 0x7b, 0x77, 0xc9, 0x85, 0xff, 0x02,
+  0xac, 0xa7, 0xfc, 0x84, 0xff, 0x07, 0xbc, 0x77, 0xea, 0xff, 0xff, 0xdf,
+  0x7a, 0xea, 0x84, 0xff, 0x06, 0x3f, 0x00, 0x00, 0xf7, 0xad, 0xa7, 0xfd,
+  0x82, 0xff, 0x01, 0x9e, 0xd7, 0xff, 0xff, 0x84, 0xff, 0x09, 0xdf, 0x88,
+  0x88, 0xfd, 0xff, 0xff, 0x9f, 0x00, 0x00, 0xf3, 0x83, 0xff, 0x02, 0x0b,
+  0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x03, 0x3f, 0x00, 0x00,
+  0xf7, 0xff, 0xff, 0x8c, 0xff, 0x09, 0xef, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x6f, 0x00, 0x00, 0xf6, 0x83, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff,
+  0xff, 0xff, 0xbd, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x8d,
+  0xff, 0x08, 0x00, 0x00, 0x60, 0xca, 0x8c, 0x05, 0x00, 0x00, 0xfa, 0x83,
+  0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x03,
+  0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x8d, 0xff, 0x00, 0x07, 0x85, 0x00,
+  0x00, 0x50, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff, 0xff, 0xff, 0xff,
+  0xbd, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff, 0x8d, 0xff, 0x00,
+  0x6f, 0x85, 0x00, 0x00, 0xf6, 0x84, 0xff, 0x02, 0x0b, 0x00, 0x30, 0xff,
+  0xff, 0xff, 0xff, 0xbd, 0xff, 0x03, 0x3f, 0x00, 0x00, 0xf7, 0xff, 0xff,
+  0x8e, 0xff, 0x05, 0x7d, 0x03, 0x00, 0x00, 0x32, 0xe9, 0x85, 0xff, 0x02,
+  0x0b, 0x30, 0x73, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xff, 0x03, 0x3f, 0x10,
+  0x33, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xff
+};
+const uint32_t splash_4bpp_len = 36480;
@@ -1,1764 +0,0 @@
-// Auto-generated by scripts/bake-splash.sh from worker/renderer/splash.png.
-// Do not edit by hand — re-run the script if the splash changes.
-#pragma once
-#include <stdint.h>
-
-const uint8_t splash_png[] = {
-  0x89, 0x50, 0x4e, 0x47, 0x0d, 0x0a, 0x1a, 0x0a, 0x00, 0x00, 0x00, 0x0d,
-  0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x02, 0x1c,
-  0x08, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x36, 0x98, 0xa7, 0x00, 0x00, 0x52,
-  0x0f, 0x49, 0x44, 0x41, 0x54, 0x78, 0x9c, 0xed, 0x9d, 0x3b, 0x72, 0xdb,
-  0x48, 0x13, 0xc7, 0x71, 0x03, 0xf2, 0x06, 0xe4, 0x0d, 0xc8, 0x2a, 0x1d,
-  0x00, 0x3c, 0x80, 0x5d, 0x54, 0x6a, 0x27, 0x54, 0xa4, 0x94, 0x2a, 0xfb,
-  0x00, 0xe0, 0x01, 0xfc, 0x15, 0x95, 0x2a, 0xa2, 0x12, 0x6f, 0x0a, 0x95,
-  0xf6, 0x00, 0xe0, 0x01, 0x54, 0x85, 0x54, 0x19, 0x22, 0xc5, 0xa8, 0xd2,
-  0x05, 0xf0, 0x2d, 0xe6, 0xd9, 0x3d, 0x0f, 0x10, 0x24, 0x01, 0x90, 0x63,
-  0xf7, 0x2f, 0xd8, 0xb5, 0x40, 0x60, 0xa6, 0xd1, 0xd3, 0xff, 0x79, 0x03,
-  0x88, 0x2a, 0x82, 0x20, 0x82, 0x25, 0xba, 0xb4, 0x01, 0x04, 0x41, 0x9c,
-  0x0e, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02,
-  0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22,
-  0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12,
-  0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10,
-  0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90,
-  0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82,
-  0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86,
-  0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13,
-  0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30,
-  0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98,
-  0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80,
-  0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0,
-  0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x98, 0x60, 0x05, 0x9c, 0xef,
-  0xf7, 0x9b, 0x4d, 0x76, 0x69, 0x2b, 0xfa, 0xa5, 0xdc, 0xef, 0x9f, 0x37,
-  0xbb, 0x4b, 0x5b, 0x71, 0xfd, 0x94, 0xfb, 0xfd, 0xe3, 0xdf, 0xea, 0xa7,
-  0xe0, 0x04, 0x5c, 0x6c, 0x36, 0x8b, 0xc5, 0x3c, 0xe2, 0x24, 0x97, 0xb6,
-  0xa6, 0x27, 0x36, 0x9b, 0xbb, 0xc5, 0x42, 0xdc, 0x63, 0x7c, 0x69, 0x63,
-  0xae, 0x98, 0xcd, 0xe6, 0xf6, 0x6f, 0xf7, 0x53, 0x70, 0x02, 0xce, 0x22,
-  0xc0, 0x9f, 0x2a, 0x60, 0x78, 0x8f, 0x7f, 0x69, 0x60, 0xb6, 0x82, 0xfc,
-  0x44, 0x02, 0xbe, 0x4a, 0x28, 0x30, 0xdb, 0x41, 0x7e, 0x22, 0x01, 0x5f,
-  0x25, 0x14, 0x98, 0xed, 0xb8, 0x02, 0x3f, 0x15, 0x7b, 0x36, 0xde, 0x59,
-  0x3c, 0x6c, 0x36, 0x2f, 0xe5, 0x05, 0xf2, 0x1f, 0x4c, 0xc0, 0xc5, 0x06,
-  0x80, 0x27, 0x1c, 0x36, 0xfe, 0x9f, 0x32, 0xf8, 0x13, 0x3f, 0x72, 0x21,
-  0x01, 0x67, 0xa6, 0x21, 0x7d, 0x32, 0x58, 0x60, 0xee, 0xa0, 0x7f, 0x0b,
-  0xf8, 0x0b, 0xf2, 0x3c, 0xfe, 0xa9, 0x84, 0xbf, 0xe4, 0x7d, 0x9a, 0x77,
-  0x88, 0x4b, 0x0b, 0x38, 0x7f, 0x9c, 0x43, 0x13, 0xa2, 0xdb, 0xc7, 0xa2,
-  0xc5, 0x55, 0x9d, 0x32, 0x98, 0x80, 0x73, 0x78, 0xa3, 0x63, 0xef, 0x2f,
-  0x11, 0x36, 0x68, 0x05, 0x7e, 0x98, 0xb1, 0x23, 0x97, 0x12, 0x70, 0x32,
-  0x64, 0xa8, 0x0c, 0x16, 0x98, 0x4b, 0x98, 0xd3, 0xd6, 0xfb, 0x4b, 0x94,
-  0xc2, 0x9f, 0x50, 0x11, 0x5c, 0x74, 0x21, 0xe0, 0xb2, 0x02, 0x7e, 0x9e,
-  0x46, 0x36, 0x77, 0x03, 0x37, 0xc3, 0xc3, 0x75, 0xa1, 0xbd, 0x2a, 0x4d,
-  0xb1, 0x07, 0x90, 0x03, 0x62, 0xf0, 0xc3, 0x92, 0x1d, 0xb9, 0x94, 0x80,
-  0x77, 0x7f, 0xa4, 0x80, 0x13, 0xaf, 0x37, 0x71, 0xd3, 0x82, 0x7e, 0xda,
-  0xc1, 0x5f, 0x2e, 0xd1, 0x6d, 0x54, 0x5c, 0x52, 0xc0, 0xf9, 0x22, 0x72,
-  0x32, 0x7e, 0x1c, 0xd4, 0x8c, 0xe1, 0x04, 0x3c, 0x83, 0x77, 0x09, 0x3b,
-  0x5e, 0x09, 0x76, 0x00, 0xaa, 0xd2, 0xc7, 0x56, 0x10, 0xf5, 0x2c, 0xe0,
-  0xb2, 0x5e, 0x5e, 0xbe, 0x5d, 0x4c, 0xad, 0xa4, 0x41, 0xbe, 0x5d, 0x85,
-  0x4a, 0xbe, 0x7f, 0xde, 0x3c, 0xd4, 0xcb, 0x20, 0xd6, 0x2f, 0x83, 0x05,
-  0x26, 0xaa, 0x3c, 0x97, 0x3e, 0x13, 0x8c, 0x9f, 0x60, 0x81, 0x8d, 0xfa,
-  0xb4, 0x4e, 0x70, 0x05, 0x7e, 0xb2, 0x28, 0x1f, 0xdc, 0xf2, 0xad, 0xb9,
-  0x1b, 0xd2, 0x90, 0xe1, 0x04, 0x8c, 0xfa, 0x64, 0x99, 0xef, 0x07, 0xa3,
-  0x23, 0x07, 0x7f, 0xe0, 0xdd, 0xb8, 0x3e, 0x05, 0xbc, 0x98, 0xfa, 0x93,
-  0x06, 0xf9, 0xae, 0x3a, 0xc8, 0x6a, 0x07, 0xeb, 0x6f, 0xeb, 0xd7, 0xc1,
-  0x02, 0x33, 0xf7, 0xe5, 0x64, 0x8c, 0x6b, 0xe6, 0xf0, 0xa2, 0xe5, 0x50,
-  0xd6, 0x5d, 0x8f, 0x9f, 0x4c, 0x4a, 0xdc, 0x41, 0x31, 0x18, 0x52, 0xc1,
-  0xc3, 0x09, 0x18, 0x35, 0xb4, 0x50, 0xa5, 0x86, 0x2f, 0xd6, 0xe0, 0x27,
-  0xa4, 0xd6, 0xdc, 0x3e, 0xd4, 0xb1, 0x80, 0x9b, 0x92, 0xce, 0xba, 0xcd,
-  0x15, 0x79, 0xa3, 0xd1, 0x90, 0x7e, 0x03, 0x13, 0xe6, 0x34, 0x05, 0xc7,
-  0x8d, 0x71, 0x0d, 0x32, 0x11, 0x8e, 0x6b, 0xd6, 0x76, 0x92, 0x9d, 0x72,
-  0x2d, 0x7e, 0xc2, 0xe4, 0xb0, 0x67, 0xe8, 0xa0, 0x6f, 0xaf, 0x00, 0x86,
-  0x13, 0x30, 0x0a, 0x09, 0xa8, 0x01, 0xe3, 0xe6, 0x63, 0xdf, 0x35, 0xfc,
-  0xd0, 0xa5, 0x04, 0x5c, 0x76, 0x9b, 0xeb, 0xb5, 0x04, 0xe6, 0xcc, 0x63,
-  0x87, 0x31, 0xae, 0x89, 0xe0, 0xec, 0x2a, 0x3c, 0xbe, 0xb5, 0x93, 0xec,
-  0x94, 0x6b, 0xf1, 0x13, 0xe2, 0x90, 0x7e, 0xb1, 0xbb, 0xfa, 0x65, 0x38,
-  0x01, 0xa3, 0x4e, 0xd9, 0xd2, 0x73, 0xdc, 0x68, 0x07, 0x60, 0xf1, 0xf1,
-  0x49, 0xe8, 0x8b, 0x09, 0x18, 0xfc, 0xd8, 0x45, 0xd0, 0x5e, 0x4b, 0x60,
-  0xa2, 0xf1, 0x4b, 0xe1, 0x39, 0x8e, 0xc7, 0x3c, 0xa5, 0xe7, 0x78, 0x2f,
-  0x5c, 0x8b, 0x9f, 0x20, 0xc5, 0x41, 0xfd, 0x76, 0x32, 0xca, 0x6a, 0xc7,
-  0x80, 0x1b, 0x39, 0x3c, 0xde, 0x36, 0x3b, 0x6b, 0xd0, 0x22, 0xb8, 0x8a,
-  0x24, 0x34, 0x7f, 0x05, 0x02, 0xee, 0x22, 0x68, 0xaf, 0x25, 0x30, 0x91,
-  0x1d, 0xe0, 0xc6, 0xcc, 0x31, 0x1e, 0x70, 0x07, 0x2a, 0x81, 0xbe, 0x27,
-  0xa1, 0xaf, 0xc5, 0x4f, 0x7e, 0xa3, 0x9c, 0x8c, 0x07, 0x9b, 0x9c, 0x1f,
-  0x50, 0xc0, 0xb0, 0xb7, 0x06, 0x9a, 0x59, 0xcb, 0x1b, 0x20, 0x8c, 0xe0,
-  0x68, 0x4b, 0x84, 0x10, 0x09, 0xb8, 0x53, 0x50, 0xf5, 0x09, 0x36, 0xd1,
-  0x98, 0x85, 0x02, 0x9a, 0x14, 0xb8, 0x8a, 0xd4, 0xfb, 0x24, 0xf4, 0xb5,
-  0xf8, 0x09, 0x93, 0x8d, 0x74, 0xbe, 0xb3, 0x6d, 0x96, 0xe7, 0x59, 0x32,
-  0x8a, 0x10, 0x83, 0x3d, 0x1b, 0x35, 0xa0, 0x80, 0x51, 0xaf, 0xcc, 0x73,
-  0xd8, 0xb8, 0x77, 0xd8, 0x57, 0x11, 0x7b, 0x09, 0x2e, 0x26, 0x60, 0x5d,
-  0x99, 0xfc, 0x49, 0x02, 0x46, 0x03, 0x98, 0xc4, 0x7d, 0xd8, 0xb0, 0x22,
-  0x19, 0xcc, 0xb8, 0xea, 0x7a, 0xfc, 0x64, 0x50, 0xca, 0xd6, 0x28, 0x96,
-  0x0b, 0xa2, 0x25, 0x8e, 0xe3, 0xc1, 0x76, 0x28, 0x0c, 0x28, 0x60, 0x54,
-  0x16, 0x7a, 0xb8, 0x65, 0x4d, 0xc8, 0x83, 0x7b, 0x87, 0x87, 0x85, 0xa7,
-  0xae, 0x40, 0xc0, 0x5d, 0x74, 0x8f, 0xae, 0x26, 0x30, 0x61, 0x56, 0xba,
-  0x99, 0xb5, 0xc6, 0x35, 0x60, 0xef, 0x1c, 0x8c, 0xd4, 0xde, 0xa7, 0x5b,
-  0xaf, 0xc6, 0x4f, 0x26, 0xeb, 0x3a, 0xcf, 0x11, 0x98, 0x0e, 0x29, 0x27,
-  0x6e, 0x57, 0xf6, 0xcc, 0x80, 0x02, 0x46, 0x41, 0xa1, 0x5b, 0x31, 0x33,
-  0x54, 0xc0, 0x04, 0x17, 0x12, 0xab, 0xeb, 0x98, 0x54, 0x59, 0x56, 0x2f,
-  0xf4, 0x2f, 0x6e, 0x37, 0x7b, 0x7f, 0xee, 0xfb, 0x17, 0x76, 0x0e, 0xdb,
-  0x76, 0xfe, 0xe2, 0xd9, 0xc0, 0xeb, 0x4a, 0x5a, 0x11, 0x9b, 0x96, 0x00,
-  0xca, 0x17, 0xbe, 0xa3, 0x7d, 0xb1, 0xd9, 0x3c, 0xb7, 0x9b, 0x80, 0x3c,
-  0x3e, 0x30, 0x8b, 0xc7, 0xfa, 0xe1, 0xd7, 0xc5, 0xc3, 0x73, 0x63, 0xfd,
-  0x91, 0x3f, 0x6f, 0x16, 0xcc, 0x15, 0x6d, 0xb7, 0xd6, 0xcf, 0x1c, 0x59,
-  0xb9, 0x46, 0x79, 0x3a, 0x35, 0x38, 0xae, 0x71, 0xcd, 0xe7, 0xe5, 0xcf,
-  0x0f, 0xd2, 0x84, 0xe6, 0xac, 0x8b, 0x3d, 0xbf, 0xa5, 0xfa, 0xdc, 0x47,
-  0x4f, 0xd1, 0x9d, 0xee, 0xa7, 0xe6, 0xfb, 0x6f, 0x6d, 0x24, 0xba, 0x66,
-  0xb3, 0xb8, 0x53, 0x05, 0x9c, 0x8e, 0xa2, 0x11, 0x8a, 0xa3, 0x95, 0xcb,
-  0x9a, 0xde, 0x19, 0x50, 0xc0, 0xa8, 0x5b, 0xb6, 0x73, 0x1e, 0x65, 0xe8,
-  0x4d, 0x03, 0x50, 0xf2, 0x62, 0x12, 0xda, 0x21, 0xe0, 0xe2, 0x41, 0xef,
-  0xbf, 0x18, 0x6f, 0x1c, 0xc5, 0x56, 0x3c, 0xdf, 0x59, 0xcd, 0xfc, 0x1d,
-  0x2e, 0x37, 0xbe, 0x31, 0x1f, 0x9e, 0xb0, 0x30, 0x37, 0xf2, 0xeb, 0x86,
-  0xc7, 0x4c, 0xfe, 0xf1, 0x16, 0x25, 0x3d, 0xbd, 0x7d, 0x6e, 0x72, 0x03,
-  0x7f, 0x4a, 0x00, 0xed, 0xc3, 0xb3, 0x9e, 0xe4, 0xb0, 0x43, 0x01, 0xee,
-  0x9a, 0xbf, 0xf3, 0xd5, 0x11, 0xd0, 0x13, 0xec, 0x16, 0x5a, 0x68, 0x18,
-  0xb6, 0xa7, 0x73, 0xe7, 0x51, 0x8e, 0xbb, 0xc6, 0xb5, 0x46, 0x13, 0xf9,
-  0x03, 0x9a, 0xa2, 0x5d, 0x3c, 0x7a, 0x4c, 0xd8, 0x6f, 0x16, 0xe6, 0x5c,
-  0xee, 0x14, 0x9f, 0x7b, 0x92, 0x9f, 0xca, 0x56, 0x7e, 0x6a, 0x61, 0x24,
-  0x78, 0x96, 0x43, 0xdc, 0x63, 0x66, 0xbe, 0x45, 0xa2, 0x88, 0x71, 0x3b,
-  0x90, 0x58, 0xd6, 0x0c, 0xc1, 0x90, 0x8f, 0x13, 0xc2, 0x1b, 0x54, 0x0d,
-  0x9c, 0x12, 0xa9, 0xa3, 0x85, 0x83, 0x2e, 0x91, 0xed, 0xb2, 0x25, 0xe0,
-  0x47, 0x1c, 0x08, 0x73, 0xa3, 0x75, 0xcd, 0x1f, 0x5c, 0x5b, 0xce, 0xeb,
-  0x78, 0x81, 0xf3, 0x0c, 0xee, 0x53, 0x38, 0xb9, 0x61, 0x0c, 0x9e, 0xb8,
-  0x71, 0xee, 0xa9, 0x9b, 0x36, 0x48, 0xa7, 0x69, 0x0a, 0x53, 0xde, 0x24,
-  0x3c, 0x56, 0x87, 0x42, 0x6e, 0x54, 0x40, 0xce, 0x29, 0x92, 0xe2, 0xce,
-  0x4a, 0xcf, 0x59, 0x9f, 0x35, 0x98, 0xa3, 0x8e, 0x2a, 0x9f, 0x29, 0x25,
-  0xab, 0xb6, 0xb6, 0x74, 0x5e, 0x20, 0x4c, 0xc0, 0x55, 0x99, 0xc7, 0x84,
-  0xf2, 0xd9, 0x3e, 0x8d, 0x03, 0x9f, 0x04, 0x68, 0xf2, 0x93, 0xec, 0xa0,
-  0x9a, 0x7e, 0xca, 0x8c, 0xb2, 0x76, 0xfb, 0xa9, 0x8d, 0x91, 0x20, 0x77,
-  0x16, 0xaa, 0xa5, 0x76, 0x6e, 0xea, 0x4a, 0xd4, 0x34, 0xf8, 0x4f, 0xec,
-  0x42, 0xa3, 0xde, 0x9a, 0xba, 0x41, 0x75, 0xdb, 0x7a, 0x1e, 0x4f, 0x49,
-  0x10, 0x76, 0x4a, 0x54, 0x6f, 0x39, 0x42, 0x07, 0x4b, 0x6b, 0x4b, 0xf9,
-  0x38, 0xf7, 0xe5, 0x69, 0x72, 0xab, 0x4b, 0xad, 0xe1, 0xac, 0xc8, 0x34,
-  0x14, 0x55, 0xae, 0x8f, 0x9e, 0x35, 0x41, 0xff, 0x96, 0xf6, 0xa6, 0xc0,
-  0x94, 0x37, 0x09, 0x8f, 0xc5, 0xff, 0xf5, 0x0f, 0xac, 0x13, 0x1d, 0x63,
-  0xcf, 0x9d, 0xd3, 0x92, 0xf1, 0xa1, 0xe9, 0x50, 0x34, 0xb0, 0x51, 0x0e,
-  0x91, 0x07, 0x26, 0xba, 0x78, 0xe4, 0x4f, 0xb0, 0x00, 0x26, 0x86, 0x09,
-  0xce, 0x9b, 0x9a, 0xa6, 0x0d, 0x39, 0x9a, 0xe6, 0xea, 0x73, 0x4f, 0xf0,
-  0x93, 0x5d, 0x97, 0xba, 0xfc, 0xd4, 0xca, 0x48, 0x90, 0x3b, 0x0b, 0x55,
-  0x50, 0x83, 0xfa, 0x1e, 0xa0, 0x44, 0x95, 0xc7, 0x9f, 0x38, 0x89, 0x85,
-  0x06, 0x4f, 0x4a, 0x05, 0xaa, 0x8a, 0x4f, 0xd5, 0xcf, 0x99, 0xeb, 0x02,
-  0xe9, 0x60, 0x2c, 0x60, 0xd7, 0x9e, 0xd4, 0x29, 0xac, 0x4d, 0x57, 0xf6,
-  0xef, 0x9a, 0xb9, 0x15, 0xb0, 0x0e, 0x64, 0xdf, 0xdd, 0x29, 0x60, 0xbb,
-  0xd1, 0x53, 0x2c, 0x3c, 0x1d, 0xb8, 0xa6, 0xc0, 0x94, 0x37, 0x09, 0x8f,
-  0xc5, 0xce, 0x4c, 0xac, 0x66, 0xe0, 0xd1, 0x97, 0xe6, 0x81, 0xa7, 0x97,
-  0x9d, 0xcf, 0x06, 0xaa, 0x83, 0xb1, 0xee, 0x20, 0xc9, 0x0b, 0xa0, 0x00,
-  0x70, 0x47, 0xd1, 0xeb, 0x0c, 0x5c, 0x89, 0x14, 0x0d, 0x0e, 0x00, 0xe7,
-  0xf6, 0xe4, 0xa7, 0x96, 0x46, 0x1a, 0x4f, 0x8f, 0xc2, 0xab, 0x3c, 0x8e,
-  0xdc, 0xa2, 0xd4, 0x06, 0x7b, 0x4c, 0x7a, 0x48, 0x01, 0xc3, 0x22, 0x51,
-  0x0b, 0xc1, 0x4a, 0x81, 0xc5, 0x5a, 0xfe, 0x4b, 0xd5, 0x5e, 0x63, 0x87,
-  0x47, 0x50, 0xc0, 0xad, 0x9c, 0x7b, 0xca, 0x61, 0xf7, 0xc5, 0x1e, 0x62,
-  0x43, 0xd4, 0xa0, 0xaf, 0xe1, 0x1c, 0x19, 0xa4, 0x76, 0x28, 0x37, 0xea,
-  0xd7, 0xbb, 0x98, 0xdf, 0x14, 0x98, 0x52, 0x40, 0x28, 0x7f, 0x67, 0x26,
-  0x66, 0xe2, 0x0d, 0x96, 0x1c, 0xd8, 0x5a, 0x0f, 0x4f, 0x95, 0xe1, 0xae,
-  0x44, 0x9a, 0x28, 0xff, 0xa9, 0x02, 0x83, 0xf6, 0xa3, 0x76, 0xa6, 0xc1,
-  0x84, 0x07, 0x94, 0xa3, 0x3d, 0xc0, 0x86, 0xe4, 0x8e, 0x7c, 0x7c, 0xe7,
-  0xc0, 0x63, 0x67, 0xfb, 0x09, 0x19, 0x09, 0x72, 0x9f, 0x62, 0x71, 0xce,
-  0x2a, 0x27, 0xb8, 0x97, 0x34, 0xc4, 0x43, 0x5a, 0x9c, 0x21, 0x05, 0x8c,
-  0x3a, 0x2f, 0xca, 0x00, 0x75, 0x40, 0x79, 0x69, 0x65, 0xfd, 0x06, 0xce,
-  0x47, 0x02, 0xf6, 0x00, 0xdb, 0xbe, 0x49, 0xe3, 0x99, 0xae, 0xbe, 0x98,
-  0xe7, 0x14, 0x95, 0xb1, 0xee, 0x96, 0xad, 0x1b, 0x2e, 0xf3, 0xf6, 0xa2,
-  0x9a, 0x02, 0xd3, 0x75, 0xe3, 0xad, 0x52, 0x6f, 0xac, 0x49, 0x9a, 0xbb,
-  0x73, 0x13, 0xc7, 0x99, 0xca, 0xc6, 0x1d, 0x28, 0x1f, 0x01, 0x94, 0x1f,
-  0x68, 0xb5, 0x9a, 0x9f, 0xcf, 0x41, 0xb3, 0xd5, 0xee, 0x4e, 0xac, 0x64,
-  0x6a, 0xda, 0xe0, 0xe0, 0x08, 0x3f, 0xa1, 0x9c, 0xdb, 0x1b, 0x09, 0x73,
-  0xc7, 0xc3, 0x7e, 0xf4, 0x64, 0xa5, 0x4a, 0xd8, 0x18, 0x57, 0x0f, 0xf7,
-  0xa0, 0xfa, 0x90, 0x02, 0x46, 0xda, 0x13, 0x22, 0x53, 0x35, 0x7c, 0x0c,
-  0xfa, 0x6d, 0x8e, 0xf3, 0x67, 0xce, 0x44, 0x3c, 0xc0, 0x91, 0x4f, 0xb3,
-  0xc8, 0x64, 0x05, 0xdd, 0x70, 0xca, 0xd6, 0xcc, 0x58, 0x15, 0x4e, 0x73,
-  0x5f, 0xd0, 0x53, 0x53, 0x37, 0x05, 0xa6, 0xaa, 0xb7, 0x1b, 0x13, 0x16,
-  0x96, 0xc3, 0x34, 0xb7, 0xcd, 0xe7, 0x36, 0xee, 0x3c, 0x71, 0xec, 0x76,
-  0xab, 0xc0, 0x68, 0x66, 0x62, 0x26, 0x12, 0xbb, 0x13, 0x3e, 0xb0, 0xbd,
-  0x10, 0x76, 0x29, 0xcb, 0xe6, 0x53, 0xb7, 0x07, 0x13, 0x54, 0xae, 0x6d,
-  0x4e, 0x88, 0x01, 0xb7, 0xd6, 0x1f, 0x61, 0x24, 0x3c, 0xb3, 0xf0, 0xbf,
-  0xf6, 0x40, 0x90, 0x19, 0xf3, 0x0f, 0x13, 0xc7, 0x39, 0x3d, 0x31, 0xe8,
-  0x4b, 0xed, 0xe0, 0x3d, 0x8a, 0xb2, 0x57, 0x1d, 0xd3, 0x15, 0xd0, 0x43,
-  0x65, 0xfc, 0x06, 0xeb, 0xbd, 0x36, 0x02, 0x86, 0x4f, 0xaf, 0x36, 0xf7,
-  0xa1, 0x65, 0xb4, 0x34, 0x9c, 0x61, 0x8d, 0x0b, 0x55, 0x09, 0x36, 0x8e,
-  0xaf, 0xbd, 0xa3, 0xa0, 0x86, 0x20, 0x52, 0x9d, 0xf3, 0x66, 0x9b, 0xb1,
-  0x5d, 0xf6, 0xee, 0xfa, 0xd1, 0x72, 0x89, 0x37, 0xf6, 0x4d, 0x9b, 0xe6,
-  0xa2, 0x5d, 0x1b, 0xab, 0xd4, 0x7c, 0x0c, 0xd0, 0xab, 0x6b, 0xdc, 0xe9,
-  0x75, 0xf3, 0x64, 0x19, 0x63, 0x13, 0xe6, 0xd0, 0x84, 0xe6, 0x3e, 0xf4,
-  0xf8, 0xa0, 0x9f, 0x54, 0x30, 0x34, 0xa6, 0x23, 0x28, 0xbc, 0x46, 0x5a,
-  0x7e, 0x02, 0x46, 0xc2, 0xdc, 0x53, 0xe4, 0x5e, 0xc7, 0x24, 0xb4, 0x39,
-  0xff, 0x30, 0x1a, 0xf0, 0x45, 0x61, 0x83, 0x0a, 0x18, 0xf6, 0xd6, 0x44,
-  0xef, 0x0b, 0xce, 0x72, 0x9a, 0x3e, 0x77, 0x8e, 0xb6, 0x6c, 0x01, 0x4f,
-  0x56, 0x49, 0x62, 0x74, 0x94, 0x4b, 0x3b, 0xd3, 0x51, 0xbc, 0x4e, 0x92,
-  0x24, 0x59, 0x1a, 0xd3, 0xd2, 0x22, 0x64, 0xad, 0x44, 0x35, 0x2a, 0x00,
-  0xe4, 0x01, 0xd9, 0x24, 0xe3, 0x70, 0x18, 0xad, 0xd3, 0x2c, 0xdb, 0xae,
-  0x63, 0x69, 0x89, 0xb7, 0x13, 0xd5, 0x10, 0x98, 0xce, 0xb1, 0x03, 0x67,
-  0x99, 0x24, 0xfe, 0x17, 0x1f, 0xa0, 0xfe, 0x5b, 0xcc, 0x0c, 0x2e, 0x50,
-  0xed, 0xd2, 0xb4, 0x61, 0xca, 0x35, 0x29, 0x25, 0xff, 0x9e, 0xe1, 0x02,
-  0xaa, 0x8c, 0xe6, 0x13, 0x34, 0x34, 0x68, 0x31, 0x60, 0xc5, 0xfc, 0x5f,
-  0xc0, 0xb6, 0x1a, 0xf5, 0x4f, 0x65, 0x96, 0xb3, 0x65, 0x5d, 0x24, 0x6b,
-  0x43, 0xeb, 0xa2, 0x6a, 0x6a, 0xf0, 0x93, 0xf2, 0x6d, 0x1b, 0x3f, 0xed,
-  0x7c, 0x46, 0x3a, 0xfc, 0xa4, 0x8d, 0x84, 0xb9, 0xe3, 0x85, 0x0e, 0x4b,
-  0x9c, 0xa5, 0x35, 0x7e, 0xf1, 0x2d, 0x34, 0xf5, 0xc1, 0xa0, 0x02, 0x76,
-  0xf4, 0xd6, 0x94, 0xb7, 0x33, 0xd4, 0x71, 0x63, 0xac, 0x5c, 0x3e, 0x31,
-  0x05, 0x3c, 0x4a, 0x4a, 0xf3, 0x5c, 0xdc, 0x67, 0xdc, 0x46, 0xd1, 0x6c,
-  0x9d, 0xea, 0x7a, 0x38, 0x43, 0x71, 0x25, 0x9f, 0x32, 0x66, 0xa0, 0xf2,
-  0xcd, 0x04, 0xea, 0x42, 0x33, 0x71, 0xd4, 0x6f, 0x9d, 0xa9, 0x3a, 0xa3,
-  0x58, 0xd7, 0xf1, 0x38, 0xf1, 0x36, 0x7a, 0x05, 0x4b, 0x15, 0xd9, 0x2b,
-  0xb3, 0xb2, 0xea, 0x0a, 0x09, 0x17, 0x65, 0x86, 0x02, 0xdd, 0xb3, 0xef,
-  0xd1, 0x5e, 0x9f, 0x3b, 0xf0, 0x70, 0x8c, 0x63, 0xbb, 0x9b, 0x3a, 0xb4,
-  0x04, 0xfa, 0x76, 0x3c, 0x0d, 0xa6, 0xa7, 0xf3, 0x90, 0x2f, 0x94, 0x64,
-  0xe0, 0x4d, 0xa2, 0xae, 0xec, 0x28, 0x1a, 0x2d, 0xb7, 0x5a, 0x09, 0x25,
-  0x7e, 0x14, 0x20, 0x39, 0xd9, 0x4f, 0xcb, 0xc2, 0xf2, 0x07, 0xa8, 0x49,
-  0xb7, 0xce, 0xc3, 0x70, 0x8c, 0xa5, 0x8d, 0xf4, 0x57, 0x1f, 0xa6, 0xff,
-  0xac, 0x71, 0xf5, 0x68, 0xd0, 0xf7, 0xfc, 0x0d, 0x2a, 0x60, 0xe8, 0x15,
-  0x11, 0x68, 0x7a, 0x12, 0x1a, 0x94, 0xb7, 0xa8, 0x08, 0xa1, 0xd2, 0x54,
-  0x69, 0x1b, 0x02, 0x56, 0xbd, 0x15, 0x14, 0x02, 0xd0, 0x85, 0xc5, 0xd6,
-  0x58, 0xcf, 0x29, 0xbd, 0xa7, 0xba, 0xcb, 0xbd, 0xcd, 0xdd, 0xe0, 0x31,
-  0x5e, 0x32, 0x3a, 0xf8, 0xc0, 0x43, 0xfb, 0x2d, 0x82, 0x40, 0x94, 0x68,
-  0x3c, 0xaf, 0xd5, 0x33, 0x75, 0x1e, 0x45, 0xf2, 0x69, 0x7a, 0x84, 0xd9,
-  0xb6, 0x44, 0x4f, 0x42, 0x03, 0x7f, 0xcf, 0x8d, 0xdf, 0x90, 0x8f, 0xec,
-  0x77, 0x97, 0x31, 0x1c, 0x5d, 0x2e, 0x9e, 0x88, 0xd9, 0x46, 0x79, 0x77,
-  0x31, 0x1d, 0xe5, 0x27, 0x99, 0xf3, 0xca, 0x75, 0x10, 0x1b, 0x09, 0x56,
-  0x2a, 0x60, 0x98, 0x1d, 0x5e, 0xc4, 0x32, 0x87, 0xb7, 0x96, 0x7e, 0x27,
-  0xc3, 0xbe, 0x68, 0x77, 0x50, 0x01, 0x3b, 0x7a, 0x6b, 0xf2, 0xcf, 0x7a,
-  0xfe, 0x46, 0x39, 0x4d, 0xf4, 0xf8, 0xa0, 0xc3, 0x55, 0x1a, 0x86, 0x80,
-  0x95, 0xb7, 0x50, 0x70, 0x37, 0xf7, 0x61, 0xd0, 0x2c, 0x28, 0x0c, 0x6d,
-  0x77, 0xb9, 0xfb, 0x40, 0x2d, 0x39, 0xfe, 0xa9, 0x3c, 0xd8, 0x89, 0x3a,
-  0x26, 0x30, 0x55, 0xb0, 0xb9, 0xdf, 0x60, 0x85, 0x8e, 0x82, 0xca, 0x0a,
-  0x7a, 0x6a, 0x6a, 0x65, 0xa1, 0x81, 0x2a, 0x33, 0x7a, 0xaf, 0x29, 0x5a,
-  0x26, 0xb0, 0x0c, 0x57, 0xe1, 0x0e, 0xdb, 0xbc, 0x11, 0x68, 0xed, 0xa1,
-  0xa7, 0x17, 0x8d, 0xfe, 0x80, 0x46, 0xc0, 0xf9, 0xb9, 0x63, 0xfc, 0xa4,
-  0x8a, 0x12, 0xc5, 0x88, 0xf2, 0x93, 0x7b, 0xcb, 0x8a, 0xc7, 0x48, 0x97,
-  0x80, 0x67, 0xcb, 0x65, 0x3c, 0x32, 0xf7, 0x48, 0x9a, 0x93, 0xa4, 0xcb,
-  0x3f, 0xf6, 0xb5, 0xb2, 0x86, 0x63, 0x79, 0x85, 0x0e, 0x26, 0xa1, 0x2b,
-  0x6b, 0x1a, 0x1a, 0xfa, 0xce, 0x99, 0x86, 0x6f, 0xd0, 0x72, 0x40, 0x7d,
-  0x85, 0xef, 0xd4, 0xf6, 0x49, 0x54, 0xa6, 0x80, 0x8f, 0xad, 0x76, 0x8f,
-  0x08, 0xcc, 0x99, 0xfb, 0xb8, 0x8a, 0x24, 0xef, 0x22, 0x25, 0x1c, 0xee,
-  0x37, 0xd8, 0x67, 0x4f, 0x2b, 0xc7, 0xf0, 0x2a, 0x25, 0x2d, 0x5e, 0x37,
-  0x2c, 0xad, 0xb3, 0x8d, 0x26, 0x0f, 0x6d, 0x22, 0x84, 0x9d, 0x9d, 0xc6,
-  0xc8, 0x46, 0x8d, 0xe6, 0x69, 0x7e, 0xd2, 0xd2, 0x72, 0x57, 0x74, 0x8e,
-  0xb7, 0x43, 0x70, 0x60, 0xe5, 0x21, 0x8d, 0xb4, 0x04, 0x3c, 0x72, 0xd7,
-  0xc9, 0xe6, 0x88, 0xae, 0xef, 0x57, 0x0c, 0x59, 0x0c, 0xfb, 0x69, 0x15,
-  0xab, 0x34, 0x54, 0xad, 0xb8, 0x86, 0x7e, 0xe7, 0x55, 0x30, 0xf4, 0x8d,
-  0xe7, 0x09, 0x25, 0x50, 0x0e, 0xde, 0x57, 0x6e, 0x1d, 0x30, 0xa3, 0x23,
-  0x01, 0x2f, 0x8e, 0xac, 0x78, 0xdb, 0x07, 0xe6, 0xa8, 0x70, 0x1f, 0x57,
-  0x81, 0x09, 0xfb, 0x70, 0xc8, 0x6a, 0x67, 0x63, 0xd9, 0x6c, 0x0a, 0xbf,
-  0x1e, 0x4c, 0x42, 0x5b, 0x33, 0x13, 0xf0, 0xae, 0x55, 0x12, 0xb0, 0x13,
-  0x8f, 0x06, 0x0f, 0x4e, 0xb9, 0x1f, 0xe3, 0x8f, 0x23, 0xfc, 0x54, 0xba,
-  0x8f, 0x2b, 0x3f, 0x41, 0x23, 0x91, 0x3b, 0xa0, 0xb2, 0xa5, 0x91, 0xa6,
-  0x80, 0x67, 0x9e, 0x7d, 0x75, 0x78, 0x82, 0x6b, 0x36, 0xfc, 0x77, 0x2a,
-  0x86, 0x15, 0xb0, 0x55, 0xd7, 0x29, 0x3f, 0xb1, 0x9a, 0x0b, 0x97, 0x14,
-  0x94, 0xa4, 0x0e, 0x4c, 0xdf, 0xf3, 0xc0, 0xc7, 0x3c, 0x27, 0x3c, 0xf3,
-  0x9c, 0x7a, 0x44, 0x12, 0x56, 0xe7, 0x69, 0xda, 0xf8, 0x08, 0x92, 0xc5,
-  0x69, 0xcf, 0xb9, 0xba, 0x8e, 0xa3, 0xfe, 0x04, 0x12, 0x09, 0x6c, 0x9a,
-  0x1b, 0x36, 0xd7, 0xdb, 0xa3, 0x5a, 0xf9, 0xd7, 0x0c, 0x59, 0x8a, 0x7f,
-  0x83, 0xc3, 0x41, 0xd4, 0xe2, 0xa1, 0x9a, 0xcc, 0xbb, 0x6d, 0xcb, 0xc4,
-  0xf1, 0xfa, 0xc2, 0x8e, 0xfd, 0x84, 0x8c, 0x44, 0x42, 0x73, 0x19, 0x69,
-  0x08, 0xd8, 0x37, 0x27, 0x89, 0xb7, 0x02, 0xac, 0x2e, 0xf0, 0x96, 0xfb,
-  0x61, 0x05, 0x6c, 0xf5, 0xd6, 0x96, 0xe8, 0xaf, 0x19, 0xfa, 0x0b, 0x2d,
-  0xc5, 0xa9, 0x24, 0xba, 0x10, 0xb0, 0x6b, 0xef, 0x42, 0x75, 0xb4, 0x80,
-  0xcd, 0x4d, 0xf9, 0xd3, 0x87, 0x23, 0xea, 0xdf, 0xee, 0x02, 0x73, 0xeb,
-  0x4d, 0xc9, 0x1e, 0xb1, 0x38, 0xb1, 0x7a, 0x3a, 0xea, 0x00, 0x53, 0xfd,
-  0x0e, 0xfd, 0x05, 0x57, 0x91, 0x94, 0x65, 0xb0, 0x2a, 0xc3, 0x93, 0x3c,
-  0x5b, 0xd7, 0xe9, 0x87, 0x8c, 0xe8, 0x47, 0xc0, 0x6b, 0x6f, 0x4a, 0x2e,
-  0x23, 0x0d, 0x01, 0xfb, 0x3a, 0x30, 0xc8, 0xf9, 0xc3, 0xbd, 0xc9, 0x0e,
-  0x30, 0xac, 0x80, 0x2d, 0x4d, 0xaa, 0xee, 0x1f, 0xab, 0xbb, 0x96, 0xc8,
-  0x5f, 0xb0, 0x67, 0x03, 0x56, 0x81, 0xa0, 0xcb, 0x8e, 0x16, 0x70, 0xbe,
-  0xaf, 0xf1, 0x75, 0x3a, 0x5b, 0x25, 0xa1, 0x28, 0x8d, 0xe5, 0x4b, 0xa6,
-  0xe1, 0xb6, 0x8f, 0x87, 0x0f, 0x11, 0x98, 0x3e, 0x51, 0x34, 0xe4, 0xc6,
-  0x12, 0x55, 0x51, 0x99, 0x54, 0xd6, 0xcc, 0x04, 0x4c, 0x53, 0xb9, 0xc8,
-  0xf9, 0x94, 0x8a, 0x65, 0xc2, 0xd8, 0xca, 0x98, 0x51, 0xb2, 0x22, 0x41,
-  0x7b, 0x21, 0x7a, 0xf1, 0x13, 0x34, 0x12, 0xef, 0x92, 0x73, 0x19, 0x89,
-  0x05, 0xec, 0xdd, 0x59, 0xe5, 0x4f, 0x74, 0x28, 0x86, 0x15, 0xb0, 0xd5,
-  0x5b, 0x93, 0x7f, 0xf0, 0x4d, 0x84, 0xb8, 0xb7, 0xe6, 0x1c, 0x6d, 0x9d,
-  0x28, 0xe0, 0xf2, 0x65, 0x73, 0xeb, 0xde, 0x07, 0x7b, 0xba, 0x80, 0xdd,
-  0x4b, 0x0d, 0xe3, 0xbb, 0x56, 0xed, 0xf0, 0x10, 0x81, 0xe9, 0xd9, 0x34,
-  0x65, 0x01, 0x06, 0x36, 0x2c, 0x7e, 0x55, 0x95, 0x90, 0xa1, 0x54, 0xd8,
-  0x6f, 0xb0, 0x04, 0x55, 0xb3, 0x04, 0x4d, 0xc0, 0xcd, 0x50, 0x53, 0x1d,
-  0x92, 0x3f, 0x3e, 0x58, 0x0f, 0xf5, 0x5b, 0x27, 0xf6, 0xe3, 0x27, 0x7f,
-  0x2d, 0x63, 0x3d, 0x3c, 0xca, 0xf0, 0x2e, 0x2a, 0xc0, 0x71, 0xf5, 0x65,
-  0xbe, 0xd3, 0x38, 0xac, 0x80, 0xa1, 0xab, 0xd6, 0xe6, 0x24, 0xb4, 0xf9,
-  0xc0, 0x0f, 0x28, 0xdc, 0xd8, 0x9d, 0x44, 0x4b, 0x01, 0xfb, 0x1f, 0x20,
-  0x3f, 0x4f, 0xc0, 0x8e, 0x26, 0x98, 0xd1, 0x66, 0x38, 0xdc, 0x4f, 0x60,
-  0x36, 0xd0, 0xf0, 0xa6, 0x1f, 0xb3, 0xa6, 0x8c, 0xf1, 0x35, 0xea, 0x2e,
-  0x4b, 0xc3, 0x6e, 0x35, 0xe0, 0xf6, 0xbc, 0x32, 0xc1, 0x04, 0xe6, 0xe9,
-  0x7d, 0xcf, 0x42, 0xd4, 0x97, 0x80, 0x8f, 0x33, 0x32, 0x71, 0x1d, 0xb4,
-  0xf1, 0xe4, 0x3f, 0x20, 0x03, 0x7f, 0xe0, 0xdb, 0xb8, 0x61, 0xa5, 0x58,
-  0x2e, 0x17, 0xa5, 0xe7, 0xb9, 0x71, 0x2e, 0xa8, 0xd6, 0x8f, 0x17, 0xb0,
-  0xf3, 0x2b, 0x90, 0xce, 0x53, 0xbd, 0x49, 0x78, 0xf0, 0xee, 0xcb, 0x3e,
-  0x2c, 0xe1, 0xc1, 0x03, 0xb3, 0x61, 0x0e, 0x18, 0xda, 0x92, 0xc3, 0x9a,
-  0x93, 0xff, 0x8c, 0xa6, 0xa1, 0xe1, 0xb4, 0xb2, 0xd3, 0xac, 0x06, 0xf4,
-  0x14, 0x8f, 0xe3, 0xe5, 0x21, 0x90, 0x5e, 0xfc, 0x74, 0x9c, 0x91, 0x28,
-  0x5f, 0xe7, 0x03, 0x48, 0x66, 0xa2, 0x03, 0x7e, 0x4e, 0x05, 0x59, 0x30,
-  0x6c, 0x76, 0xa0, 0xcd, 0xaa, 0x45, 0x0a, 0x1e, 0x5b, 0xe3, 0xd6, 0x80,
-  0xa2, 0x72, 0x8e, 0xb6, 0x8e, 0x17, 0xb0, 0xf9, 0x36, 0x1a, 0x93, 0x73,
-  0x04, 0xdc, 0xf0, 0x60, 0x9c, 0xef, 0x71, 0x7e, 0xc9, 0xe0, 0x81, 0xd9,
-  0x20, 0xe0, 0x2d, 0x3e, 0x4d, 0xcd, 0x53, 0x89, 0x1c, 0x54, 0x8f, 0x7a,
-  0x8b, 0x5b, 0x6b, 0x3d, 0x30, 0x3c, 0xd6, 0x04, 0xfb, 0x0d, 0x23, 0x98,
-  0x2b, 0xf0, 0x93, 0xf7, 0x4b, 0x5e, 0x5e, 0x03, 0x06, 0xfc, 0xd4, 0x2d,
-  0xb2, 0x60, 0xd8, 0xec, 0x8c, 0xde, 0xda, 0xd2, 0x70, 0x9b, 0x1a, 0x8d,
-  0xe5, 0x78, 0x92, 0x17, 0x44, 0xdf, 0x91, 0x02, 0x3e, 0xf8, 0x19, 0x9b,
-  0xb3, 0x04, 0x5c, 0xbf, 0x9a, 0xd0, 0xc3, 0xb8, 0x79, 0x33, 0xe5, 0x35,
-  0x09, 0x18, 0xba, 0x6e, 0x6b, 0x4e, 0x42, 0x1b, 0x73, 0x5a, 0x2e, 0xc3,
-  0x0e, 0x3c, 0xf0, 0x65, 0x99, 0xd0, 0xdc, 0xfc, 0xf6, 0x24, 0xe0, 0x23,
-  0x8d, 0xf4, 0xbc, 0x03, 0xb9, 0xc1, 0x80, 0xbf, 0x43, 0xc0, 0x70, 0xca,
-  0xb4, 0x04, 0x93, 0xd0, 0xe2, 0x67, 0xf8, 0xec, 0x1a, 0x7a, 0x22, 0x53,
-  0xa7, 0x70, 0x9c, 0x80, 0x0f, 0x7f, 0x86, 0xea, 0x3c, 0x01, 0x1b, 0x8f,
-  0xdc, 0x40, 0xc6, 0x8d, 0x93, 0x1a, 0xd7, 0x24, 0x60, 0xb8, 0x34, 0x94,
-  0x00, 0xc1, 0x6e, 0x0d, 0xcf, 0xc6, 0xd6, 0xa9, 0xc6, 0x09, 0xed, 0x4c,
-  0x38, 0xa8, 0xdf, 0x5e, 0x04, 0x7c, 0xa4, 0x91, 0xcd, 0xf9, 0x6a, 0xf3,
-  0x34, 0x83, 0x3e, 0xc2, 0xa0, 0x19, 0x58, 0xc0, 0x46, 0x6f, 0x4d, 0xfe,
-  0x53, 0xf6, 0xc6, 0xe0, 0x34, 0xf4, 0xca, 0xed, 0xc1, 0xe3, 0x04, 0x6c,
-  0xf5, 0x9f, 0x67, 0x71, 0x1c, 0xa3, 0xc7, 0xd7, 0xce, 0x14, 0xb0, 0xf5,
-  0x74, 0x93, 0xa6, 0xf1, 0xfb, 0x38, 0xd7, 0x24, 0x60, 0x38, 0xb0, 0x59,
-  0x59, 0x93, 0xd0, 0x5a, 0xb4, 0x53, 0xec, 0x65, 0xbd, 0x36, 0xda, 0xd2,
-  0x04, 0x5e, 0xa3, 0x59, 0xef, 0xb4, 0x1b, 0xd5, 0x45, 0xd2, 0xea, 0x2b,
-  0x89, 0x43, 0xf8, 0xc9, 0x7c, 0x07, 0xa9, 0x33, 0xdf, 0x2b, 0x62, 0x60,
-  0xe3, 0x60, 0x00, 0xa4, 0xe6, 0x24, 0x34, 0xde, 0x34, 0x00, 0x74, 0x11,
-  0x7b, 0x52, 0x38, 0x28, 0x60, 0x63, 0x35, 0x6f, 0x2b, 0x24, 0xd5, 0xcd,
-  0x46, 0x0e, 0x9d, 0xf5, 0xca, 0xdd, 0x91, 0x6e, 0x4a, 0xe2, 0xaa, 0x04,
-  0x8c, 0x5d, 0xad, 0xfe, 0x92, 0x15, 0x90, 0xba, 0x3b, 0x3c, 0xe8, 0x6f,
-  0x78, 0x37, 0xbf, 0x1b, 0x76, 0x6e, 0x89, 0xfa, 0x44, 0xa3, 0x95, 0xeb,
-  0x83, 0x1b, 0x97, 0xf4, 0x53, 0xab, 0x7c, 0xaf, 0x88, 0x81, 0x8d, 0xc3,
-  0x5d, 0x30, 0x63, 0x12, 0x1a, 0xf7, 0xd6, 0x40, 0x41, 0xc3, 0xb5, 0xc5,
-  0xa3, 0x04, 0x8c, 0x82, 0x45, 0x4f, 0x45, 0x74, 0x2c, 0xe0, 0xba, 0x59,
-  0x59, 0x39, 0xde, 0xbd, 0xe5, 0xd9, 0xb9, 0xc0, 0xe8, 0x2e, 0x30, 0x61,
-  0xdb, 0x35, 0x49, 0xbc, 0x34, 0x59, 0x0f, 0x06, 0x36, 0x53, 0xed, 0x34,
-  0xf5, 0x82, 0x1f, 0x30, 0x0d, 0x8d, 0x5e, 0x15, 0xe5, 0x34, 0x6b, 0x76,
-  0xc0, 0x04, 0x74, 0xe3, 0xfa, 0x29, 0xea, 0x61, 0x05, 0x7c, 0xd8, 0x4f,
-  0x24, 0x60, 0x0f, 0xa0, 0xad, 0x5a, 0xe3, 0xc7, 0xd6, 0xb8, 0x39, 0xda,
-  0x67, 0xc0, 0x81, 0x30, 0xfa, 0x8e, 0x11, 0xb0, 0xfb, 0x49, 0xf7, 0x3e,
-  0x04, 0x5c, 0x0f, 0xb7, 0xd7, 0x96, 0x86, 0x5b, 0x2e, 0xdd, 0x74, 0xb8,
-  0x0e, 0x7c, 0xac, 0xd1, 0x1c, 0x38, 0xb0, 0xb1, 0x26, 0xa1, 0x81, 0xbe,
-  0x53, 0xb8, 0x8a, 0x04, 0x76, 0x27, 0xc1, 0x0e, 0xc8, 0xa1, 0xe5, 0x50,
-  0xb8, 0xea, 0x35, 0xf2, 0x6c, 0xb0, 0x03, 0xa7, 0x77, 0xe7, 0x27, 0x68,
-  0x64, 0xd3, 0xd3, 0x95, 0x6d, 0xf2, 0xbd, 0x22, 0x86, 0x36, 0x0e, 0xf5,
-  0xd6, 0x54, 0x38, 0xa8, 0xf9, 0x1e, 0xe5, 0xe5, 0x02, 0x96, 0x28, 0x14,
-  0xc2, 0x31, 0x02, 0x46, 0xcf, 0xa8, 0x95, 0x4e, 0x23, 0xba, 0x13, 0xb0,
-  0x63, 0x38, 0xdc, 0x90, 0x46, 0x77, 0x81, 0x89, 0x6e, 0xf2, 0xb4, 0x2f,
-  0xc3, 0x43, 0xdf, 0x69, 0xc7, 0xab, 0x85, 0x4d, 0x30, 0x0d, 0xed, 0x1e,
-  0xd7, 0x78, 0xbe, 0x3b, 0xe9, 0xc2, 0xf3, 0x35, 0xc4, 0x01, 0x04, 0x7c,
-  0x84, 0x91, 0x07, 0xf3, 0xbd, 0x22, 0x86, 0x36, 0x0e, 0xf4, 0xd6, 0xe6,
-  0xd6, 0x24, 0x34, 0xec, 0xad, 0xc1, 0xd6, 0x13, 0x86, 0xe5, 0x31, 0x02,
-  0x86, 0x7a, 0x82, 0xdb, 0x59, 0xfb, 0x12, 0xb0, 0xb9, 0x30, 0xec, 0xdf,
-  0x00, 0xd0, 0x61, 0x60, 0xa2, 0x2c, 0x4f, 0xfb, 0x2c, 0x2d, 0x1c, 0xd8,
-  0x64, 0xe6, 0x24, 0x34, 0x7a, 0xc3, 0x8e, 0xdb, 0x41, 0xde, 0x77, 0x93,
-  0xd8, 0x78, 0xbe, 0x70, 0x37, 0x80, 0x80, 0x51, 0x4a, 0x67, 0xbe, 0x70,
-  0xe1, 0x8a, 0x18, 0xda, 0x38, 0xd4, 0x5b, 0x93, 0xff, 0xd0, 0x5b, 0x78,
-  0xf5, 0xa6, 0x01, 0xf7, 0x68, 0xeb, 0x38, 0x01, 0xc3, 0x39, 0x68, 0x28,
-  0xa6, 0x36, 0x02, 0x6e, 0x10, 0x5f, 0x13, 0x6d, 0x3f, 0x51, 0xd7, 0x1c,
-  0xf3, 0xc7, 0x04, 0x26, 0x7a, 0xa2, 0xed, 0x44, 0xab, 0x41, 0xf7, 0x32,
-  0x35, 0x27, 0xa1, 0x41, 0x0e, 0x73, 0xa8, 0x74, 0x50, 0x57, 0x20, 0xdf,
-  0x37, 0xef, 0x48, 0x42, 0xf7, 0x0d, 0x3a, 0x45, 0xfd, 0x0b, 0xf8, 0x08,
-  0x23, 0x0f, 0xe6, 0x7b, 0x45, 0x0c, 0x6d, 0x1c, 0x74, 0xa3, 0xea, 0x4e,
-  0xe9, 0xb0, 0x53, 0xfa, 0x5e, 0x03, 0x25, 0xc4, 0xbe, 0x04, 0x0e, 0x09,
-  0x18, 0x1e, 0x3a, 0x56, 0xc0, 0x27, 0x6e, 0x6d, 0x75, 0xbf, 0xcd, 0xc5,
-  0x06, 0x05, 0x88, 0x35, 0x56, 0x3e, 0x26, 0x30, 0xf1, 0xab, 0xeb, 0x4f,
-  0xeb, 0x43, 0x03, 0x87, 0x24, 0xea, 0xdf, 0x8e, 0x6c, 0x7d, 0xe3, 0x1a,
-  0x68, 0x41, 0xe3, 0xea, 0xd9, 0x79, 0x02, 0x3e, 0xcf, 0x4f, 0xed, 0x8d,
-  0x34, 0xf3, 0x6d, 0x3a, 0x31, 0xaf, 0x1f, 0x92, 0x69, 0xf5, 0x1d, 0xc8,
-  0x7e, 0x18, 0x5a, 0xc0, 0xb0, 0x0e, 0xb7, 0xbf, 0xa5, 0x02, 0xa6, 0xa1,
-  0x41, 0x4c, 0xa1, 0x07, 0x5c, 0x4e, 0x15, 0x30, 0x28, 0x5f, 0xb4, 0x92,
-  0xe1, 0x2b, 0xf7, 0xc3, 0xf3, 0x1c, 0xec, 0xd3, 0x84, 0x66, 0xc1, 0xe1,
-  0x37, 0x5b, 0xfa, 0xaf, 0x44, 0x01, 0x62, 0x75, 0x7c, 0x8f, 0x0a, 0x4c,
-  0xd4, 0xe8, 0x5b, 0x59, 0x96, 0x6d, 0x5e, 0x34, 0x00, 0x06, 0x36, 0x6b,
-  0xe9, 0x1c, 0x30, 0xe6, 0x50, 0x65, 0x01, 0xf7, 0xe1, 0xc0, 0xeb, 0xd1,
-  0xf8, 0xd2, 0x7e, 0x14, 0x0c, 0x74, 0x58, 0x7d, 0x82, 0x6c, 0x75, 0xdc,
-  0xea, 0xf8, 0x1e, 0xe5, 0xa7, 0xf6, 0x46, 0x9a, 0xf9, 0x36, 0x78, 0x4e,
-  0xee, 0x0a, 0x9d, 0x5e, 0x68, 0x1f, 0xc7, 0xe0, 0x02, 0x86, 0xbd, 0x35,
-  0xeb, 0x9d, 0xe1, 0x40, 0xdf, 0x63, 0x20, 0x32, 0xe4, 0xec, 0x63, 0x04,
-  0x8c, 0x96, 0x67, 0x75, 0xdb, 0x84, 0x5e, 0x83, 0x02, 0xcb, 0xdd, 0xfb,
-  0xba, 0x4a, 0x0f, 0xe5, 0x1c, 0x7e, 0x4e, 0x8f, 0xd1, 0xf6, 0xd5, 0x5c,
-  0x68, 0xe4, 0x6a, 0xbd, 0xef, 0xed, 0xa8, 0xc0, 0xc4, 0x6f, 0x85, 0x30,
-  0x2a, 0x83, 0x74, 0xda, 0xe6, 0x35, 0x4d, 0x60, 0x60, 0x33, 0x71, 0xe4,
-  0xab, 0xaa, 0x08, 0xe7, 0x4e, 0x68, 0x6b, 0x9b, 0x93, 0xe1, 0x92, 0xe7,
-  0x71, 0xe4, 0xf9, 0xe6, 0xa0, 0xe7, 0x3d, 0x2b, 0xd0, 0xf5, 0xe8, 0x89,
-  0xf9, 0xf3, 0xfc, 0xd4, 0xde, 0x48, 0xd3, 0x4e, 0xbf, 0xe3, 0x40, 0x8d,
-  0xf6, 0x77, 0xec, 0xc4, 0x72, 0x3f, 0xfd, 0x06, 0xfa, 0x7d, 0xae, 0x2d,
-  0x11, 0xc8, 0x35, 0xa7, 0x4e, 0x62, 0x45, 0xb7, 0xe2, 0x44, 0xf3, 0x33,
-  0x36, 0xa0, 0x0d, 0x45, 0x75, 0x34, 0xff, 0xd0, 0x70, 0xb6, 0x68, 0x98,
-  0x17, 0x62, 0x63, 0xec, 0x05, 0x6c, 0xe2, 0xf0, 0xd6, 0xcd, 0x86, 0x32,
-  0xc5, 0x5b, 0x73, 0xd9, 0x17, 0x04, 0xcb, 0x8d, 0xf3, 0x5b, 0x6b, 0x07,
-  0x03, 0xd3, 0x78, 0x27, 0x36, 0xfc, 0xc6, 0xee, 0x0b, 0xab, 0xab, 0x0e,
-  0x3f, 0xa8, 0xea, 0xda, 0x67, 0xe8, 0x9b, 0xa4, 0x72, 0x98, 0x65, 0x96,
-  0x2a, 0xec, 0x50, 0x3e, 0xd7, 0x4e, 0x1a, 0xab, 0x12, 0x46, 0x82, 0x54,
-  0x87, 0xf1, 0xb7, 0x0f, 0xe0, 0x08, 0xb5, 0x4b, 0x3f, 0xb5, 0x36, 0xd2,
-  0xbc, 0xe5, 0x56, 0x7e, 0x6b, 0xfc, 0xfc, 0x45, 0x7f, 0x0c, 0x2e, 0x60,
-  0xd7, 0xb7, 0x8a, 0xc0, 0xcf, 0x07, 0xf4, 0x7d, 0xc6, 0x32, 0x92, 0xf8,
-  0x1c, 0xb0, 0xf5, 0x70, 0x21, 0xf8, 0x78, 0x9f, 0x11, 0xa8, 0x8b, 0xdb,
-  0xfa, 0x81, 0x73, 0x7f, 0x5f, 0x5a, 0x6e, 0xea, 0x55, 0xef, 0xe1, 0x28,
-  0x8c, 0xaf, 0x05, 0x37, 0x0d, 0x48, 0x71, 0x56, 0xd3, 0x05, 0x7b, 0xdf,
-  0x80, 0xf7, 0xcb, 0xf3, 0x8d, 0xc7, 0x0d, 0xf9, 0x8d, 0x1f, 0xf7, 0xec,
-  0x4e, 0xd5, 0x23, 0xb7, 0xf3, 0x83, 0xa1, 0xe5, 0xfa, 0x5a, 0x91, 0x6f,
-  0x92, 0x0a, 0xbb, 0x58, 0x60, 0x3c, 0x96, 0x35, 0x7e, 0xde, 0xb3, 0xc3,
-  0x7b, 0x65, 0x82, 0x3c, 0x11, 0x0b, 0x92, 0xf7, 0x5f, 0xac, 0x87, 0x0b,
-  0xe1, 0x36, 0x72, 0xc3, 0x4f, 0xb7, 0x67, 0xf8, 0xc9, 0x36, 0xb2, 0x74,
-  0x1b, 0x59, 0xb5, 0x15, 0x30, 0x8a, 0xa5, 0xc1, 0x5f, 0x48, 0xc9, 0x18,
-  0x5c, 0xc0, 0x8e, 0xef, 0x70, 0x41, 0xd7, 0xbb, 0xbe, 0x37, 0x84, 0xae,
-  0x3f, 0x79, 0x23, 0x07, 0x93, 0x89, 0xeb, 0xd9, 0xc2, 0xdb, 0xc2, 0x99,
-  0xc6, 0xc1, 0x82, 0x41, 0x61, 0x37, 0x5e, 0x2c, 0xac, 0xd7, 0x4b, 0x34,
-  0x4e, 0x75, 0x3a, 0x77, 0x50, 0xcb, 0x5a, 0xdc, 0xe7, 0x1d, 0xcf, 0x71,
-  0x87, 0xd3, 0x90, 0x31, 0x07, 0x3e, 0x30, 0xea, 0xee, 0xf8, 0xc0, 0x6f,
-  0x2f, 0x39, 0x4c, 0x35, 0x3a, 0x26, 0xf6, 0xed, 0x8c, 0xd1, 0x48, 0x65,
-  0xed, 0xcb, 0xc9, 0x76, 0x1b, 0x7e, 0x9e, 0xda, 0xed, 0xa7, 0x66, 0x7f,
-  0xf8, 0x8e, 0x3b, 0xd2, 0x42, 0xb9, 0x83, 0x02, 0x6b, 0x25, 0x60, 0x5c,
-  0xef, 0x9d, 0xb8, 0x02, 0x70, 0x26, 0x83, 0x0b, 0xd8, 0x21, 0x12, 0x38,
-  0xf1, 0xe2, 0xe8, 0xad, 0x35, 0xbc, 0xff, 0xe4, 0x80, 0x80, 0x7d, 0xaf,
-  0xcc, 0x30, 0xd0, 0x83, 0x1f, 0xe7, 0xb7, 0x48, 0x3d, 0x33, 0x96, 0xcd,
-  0x1f, 0xc9, 0x34, 0xde, 0x73, 0xda, 0xf6, 0xf2, 0xe6, 0xd9, 0x37, 0xef,
-  0xac, 0x5c, 0xf3, 0x37, 0x54, 0x5b, 0x2c, 0x0f, 0x3b, 0x42, 0x1b, 0xfe,
-  0xec, 0x48, 0xd2, 0xe8, 0x97, 0x1f, 0x74, 0xb5, 0x74, 0x72, 0xf3, 0x17,
-  0xe1, 0x24, 0x7a, 0x61, 0xd1, 0xed, 0x27, 0xc7, 0x37, 0xe9, 0xda, 0xf8,
-  0xa9, 0xad, 0x91, 0x2d, 0x05, 0x8c, 0x63, 0xb9, 0xd5, 0xb4, 0x67, 0xe7,
-  0x0c, 0x2e, 0x60, 0x47, 0x6d, 0xee, 0xdd, 0x29, 0xc9, 0x69, 0x78, 0xcb,
-  0xd2, 0x71, 0x0f, 0x33, 0x78, 0x00, 0x1f, 0x63, 0x76, 0x9f, 0xef, 0x9c,
-  0x8b, 0x3a, 0xa8, 0xdf, 0x03, 0x5b, 0x41, 0xdc, 0xc1, 0x24, 0x2a, 0x0b,
-  0x78, 0xa8, 0x45, 0x60, 0x1e, 0x7c, 0xd8, 0xb5, 0xf9, 0xd1, 0x46, 0xa7,
-  0xac, 0xd0, 0xeb, 0xb5, 0x0e, 0xe8, 0xbb, 0x72, 0x3d, 0x64, 0xe4, 0xbe,
-  0xb3, 0x03, 0xdf, 0x64, 0x95, 0xe8, 0x5e, 0x4f, 0xa7, 0x7e, 0x6a, 0x6b,
-  0x64, 0x4b, 0x01, 0xe3, 0xe4, 0x86, 0xfb, 0xa8, 0x37, 0x64, 0xf8, 0x45,
-  0x6a, 0xdb, 0x6d, 0xe8, 0x4b, 0x46, 0xf6, 0xcf, 0x58, 0x08, 0x47, 0x09,
-  0xd8, 0x57, 0xe5, 0x8e, 0xe0, 0x83, 0xf8, 0xa0, 0xeb, 0xd3, 0x18, 0x2d,
-  0x98, 0xec, 0x50, 0x6d, 0x7e, 0xe8, 0x25, 0xa3, 0x4d, 0x95, 0x05, 0x3c,
-  0xd2, 0x26, 0x30, 0x0f, 0x56, 0x27, 0x87, 0xc6, 0x67, 0xb6, 0x31, 0xa8,
-  0x43, 0x78, 0x40, 0xdf, 0xad, 0x4c, 0x90, 0xbd, 0x00, 0xdf, 0x07, 0x9b,
-  0x57, 0xf0, 0x07, 0x30, 0x7b, 0x30, 0xa8, 0x9f, 0xdc, 0xdf, 0x46, 0xf2,
-  0x79, 0x0d, 0x07, 0xeb, 0x65, 0x5e, 0x8a, 0x35, 0xbc, 0x80, 0xed, 0xda,
-  0x1c, 0xe9, 0xc3, 0x76, 0x2a, 0x9e, 0xcb, 0x3d, 0xf2, 0x81, 0x7e, 0x5f,
-  0x39, 0x6d, 0xe1, 0x1f, 0x1a, 0x77, 0x15, 0xed, 0xd4, 0x62, 0xd9, 0xfc,
-  0x36, 0xb9, 0xc3, 0x2f, 0x09, 0x9e, 0x39, 0xaf, 0x2b, 0x4c, 0x27, 0xb4,
-  0x0a, 0xcc, 0xe6, 0xfa, 0xc4, 0xf3, 0x59, 0x10, 0x9f, 0x57, 0x19, 0xde,
-  0x6f, 0x3c, 0x70, 0x1c, 0x03, 0xbe, 0x46, 0x71, 0x4c, 0x74, 0x29, 0xba,
-  0xef, 0x7b, 0x56, 0x82, 0xda, 0xd3, 0xfb, 0x85, 0x18, 0x05, 0xaf, 0x54,
-  0x7d, 0xfe, 0xf0, 0x1d, 0x6f, 0x6f, 0x64, 0xbb, 0x49, 0x2c, 0xc7, 0x47,
-  0x15, 0x87, 0x66, 0x78, 0x01, 0x5b, 0xb5, 0x39, 0xee, 0x7a, 0xd8, 0xb2,
-  0xc0, 0x73, 0xb9, 0x47, 0xbe, 0x52, 0xc7, 0x59, 0x60, 0x09, 0xca, 0x07,
-  0xd5, 0x1f, 0xee, 0x21, 0x9a, 0x7b, 0x3a, 0x39, 0x69, 0x10, 0x4d, 0x8b,
-  0x4d, 0xc9, 0x85, 0xf3, 0x72, 0x26, 0x7c, 0x78, 0xa0, 0x5d, 0x60, 0x56,
-  0xb9, 0xdf, 0x98, 0x16, 0xdf, 0xdb, 0xb2, 0x3b, 0x3e, 0x48, 0xf3, 0x07,
-  0xf4, 0x7d, 0xd8, 0x84, 0x35, 0x30, 0xa1, 0x74, 0x29, 0xb2, 0x7e, 0xb0,
-  0x50, 0xd7, 0x9e, 0xdb, 0xc3, 0xc9, 0xa2, 0xb7, 0x12, 0x9b, 0xfe, 0xf0,
-  0x1d, 0x6f, 0x6f, 0x64, 0x3b, 0x01, 0xc3, 0x19, 0xd9, 0xd1, 0x69, 0x9b,
-  0xe0, 0xce, 0x65, 0x78, 0x01, 0x5b, 0xb5, 0x39, 0xf6, 0xb0, 0xad, 0x20,
-  0x7c, 0xf9, 0xb1, 0x2f, 0xb5, 0xb3, 0x9b, 0x26, 0xd1, 0x1e, 0xc9, 0x8c,
-  0x8c, 0xb6, 0xc4, 0x31, 0x4b, 0x2e, 0x3e, 0x41, 0x6c, 0x53, 0xfa, 0x24,
-  0xbc, 0x6a, 0x55, 0x98, 0xae, 0x48, 0x8e, 0x59, 0x23, 0xe0, 0x73, 0x8f,
-  0xdf, 0x6d, 0x7e, 0x63, 0xe2, 0x56, 0x3b, 0x0c, 0xac, 0xcb, 0xd0, 0xa8,
-  0xd9, 0xee, 0xc8, 0x38, 0xdb, 0xf4, 0xd2, 0xd3, 0x3d, 0x5e, 0xe1, 0x21,
-  0xb8, 0xa3, 0xef, 0xc2, 0x3f, 0x4a, 0xa2, 0xca, 0x0a, 0xbb, 0xaf, 0x70,
-  0xf9, 0x29, 0x3f, 0xd9, 0x4f, 0x3e, 0x23, 0x91, 0x9f, 0x5a, 0x6e, 0xe4,
-  0x00, 0x3b, 0x07, 0x86, 0xfc, 0xaa, 0x37, 0x60, 0x78, 0x01, 0x5b, 0xb5,
-  0x39, 0x5e, 0x6d, 0x39, 0xa0, 0xef, 0xe3, 0x5f, 0x2b, 0x5b, 0x18, 0x55,
-  0x82, 0xfa, 0x80, 0x4d, 0xca, 0xe3, 0xc2, 0x6c, 0x2b, 0xcd, 0x67, 0x02,
-  0x47, 0xeb, 0x06, 0x35, 0x96, 0x89, 0x1d, 0x5c, 0xa3, 0x65, 0xdb, 0xba,
-  0xd8, 0xd2, 0x5c, 0x6c, 0xbe, 0x9d, 0xf3, 0x88, 0xc0, 0x74, 0x87, 0x66,
-  0xbb, 0xaa, 0xc4, 0xd1, 0xf1, 0xc1, 0x3f, 0x5b, 0xe9, 0x7a, 0x66, 0xc5,
-  0x4c, 0x67, 0xb3, 0x97, 0x6e, 0xd8, 0x26, 0x6c, 0xf1, 0xb4, 0xf9, 0x44,
-  0x06, 0x7f, 0xce, 0x2f, 0x37, 0x07, 0xd8, 0x96, 0x9f, 0x96, 0xe9, 0x39,
-  0x7e, 0x72, 0x18, 0x69, 0xf9, 0xa9, 0xa5, 0x80, 0x4b, 0xa5, 0xe0, 0x0b,
-  0xbd, 0xd3, 0xee, 0x02, 0x02, 0x1e, 0x9e, 0x62, 0xad, 0x54, 0x36, 0x43,
-  0x5f, 0xfb, 0xce, 0x93, 0x78, 0xe2, 0xe8, 0x1e, 0x67, 0xfa, 0xf5, 0x1a,
-  0xb3, 0xd5, 0xc1, 0x8a, 0xb5, 0xd8, 0xc1, 0xb7, 0x71, 0xcc, 0xd6, 0x47,
-  0x6d, 0xa9, 0x2b, 0xb7, 0x2a, 0x02, 0x46, 0xb1, 0xf9, 0x25, 0xf2, 0x13,
-  0xc8, 0x60, 0x85, 0x32, 0x5b, 0x5f, 0xa2, 0x55, 0x48, 0xd7, 0xc0, 0x84,
-  0xd8, 0xf7, 0xae, 0xb7, 0xdd, 0x52, 0x6a, 0x72, 0x84, 0xda, 0xe7, 0x72,
-  0xb7, 0x8a, 0x1d, 0x53, 0x6e, 0xe5, 0x56, 0xd5, 0x30, 0xa3, 0x65, 0x17,
-  0x7e, 0x5a, 0x23, 0x3f, 0x9d, 0xb1, 0x0d, 0x72, 0xcb, 0xee, 0x63, 0xe0,
-  0xaf, 0x7a, 0x03, 0xfe, 0x06, 0x01, 0xd7, 0x01, 0x90, 0x65, 0xbb, 0x2c,
-  0x6b, 0x5f, 0xf0, 0x05, 0x3b, 0xbf, 0x7d, 0xb9, 0xd6, 0xe7, 0xa7, 0x59,
-  0x76, 0xd2, 0x6e, 0xba, 0x2c, 0xcb, 0xb6, 0x59, 0xd6, 0x5d, 0x04, 0x94,
-  0xd9, 0x91, 0x37, 0xdb, 0x3d, 0x65, 0x96, 0xa5, 0x07, 0xdd, 0x91, 0x33,
-  0x33, 0xdb, 0x27, 0xda, 0xf5, 0x6d, 0x75, 0xe5, 0xa7, 0x22, 0x3d, 0xad,
-  0xdc, 0xbb, 0xe1, 0x2f, 0x11, 0x30, 0x41, 0xfc, 0x99, 0x90, 0x80, 0x09,
-  0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18,
-  0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c,
-  0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0,
-  0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60,
-  0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02,
-  0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01,
-  0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11,
-  0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09,
-  0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88,
-  0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48,
-  0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0xb0, 0x87,
-  0xec, 0xfe, 0xfe, 0x8c, 0x6f, 0xd6, 0x11, 0xc4, 0x30, 0x90, 0x80, 0xdd,
-  0x64, 0x37, 0x37, 0x37, 0x37, 0xa4, 0x60, 0xe2, 0xda, 0x21, 0x01, 0xbb,
-  0x49, 0x6a, 0x01, 0xdf, 0x5f, 0xda, 0x0a, 0x82, 0x38, 0x00, 0x09, 0xd8,
-  0xcd, 0x3d, 0x09, 0x98, 0x08, 0x01, 0x12, 0xb0, 0x1b, 0x12, 0x30, 0x11,
-  0x04, 0x24, 0x60, 0x37, 0x24, 0x60, 0x22, 0x08, 0x48, 0xc0, 0x6e, 0x48,
-  0xc0, 0x44, 0x10, 0x90, 0x80, 0xdd, 0x90, 0x80, 0x89, 0x20, 0x20, 0x01,
-  0xbb, 0x21, 0x01, 0x13, 0x41, 0x40, 0x02, 0xae, 0x3e, 0x3e, 0x1d, 0x07,
-  0xbd, 0x02, 0xfe, 0x7c, 0x1f, 0xc0, 0x24, 0x82, 0x68, 0xc9, 0x45, 0x05,
-  0xbc, 0x7f, 0xba, 0xbc, 0x1a, 0x3e, 0xbf, 0xdf, 0xdc, 0xdc, 0xdb, 0x12,
-  0xfe, 0x55, 0x0b, 0xf8, 0x87, 0x7d, 0xfa, 0xd3, 0xcd, 0xcd, 0xf7, 0xcb,
-  0x1b, 0x4d, 0x10, 0x82, 0x4b, 0x0a, 0xf8, 0xe7, 0xcd, 0xcd, 0xcd, 0xaf,
-  0x0b, 0xe6, 0xcf, 0xf8, 0x51, 0x2b, 0xf5, 0xbb, 0x75, 0xf8, 0xbd, 0x3e,
-  0xfc, 0x66, 0x1d, 0xde, 0x78, 0x74, 0x4d, 0x10, 0x97, 0xe1, 0x82, 0x02,
-  0x7e, 0xab, 0xc5, 0x70, 0xf3, 0x71, 0x39, 0x03, 0x18, 0xcc, 0x88, 0x9b,
-  0x8d, 0x75, 0xfc, 0xfd, 0xc9, 0xd1, 0x3d, 0xd8, 0xf0, 0xb3, 0x07, 0x32,
-  0x8d, 0x20, 0x0e, 0x72, 0x41, 0x01, 0xff, 0xbe, 0x71, 0xb7, 0x72, 0xc3,
-  0xf2, 0x8d, 0x6b, 0xf2, 0xb5, 0xcd, 0xb9, 0x42, 0xbf, 0xdf, 0xfa, 0xb7,
-  0x8a, 0x20, 0xda, 0x71, 0x41, 0x01, 0x3f, 0x5d, 0x85, 0x80, 0x33, 0x2e,
-  0xca, 0x16, 0x13, 0xce, 0xf5, 0x68, 0xf9, 0x86, 0x9e, 0x71, 0x20, 0xae,
-  0x8a, 0xbf, 0x5e, 0xc0, 0xd5, 0xeb, 0x4d, 0xcb, 0x71, 0xed, 0xfd, 0xcd,
-  0x11, 0x8d, 0x35, 0x41, 0x0c, 0x02, 0x09, 0xb8, 0x7a, 0x8d, 0x6f, 0x6e,
-  0x6e, 0x0e, 0xcf, 0x2c, 0xbf, 0x93, 0x7e, 0x89, 0xeb, 0x83, 0x04, 0x5c,
-  0x55, 0x1f, 0xbf, 0x92, 0x16, 0x2b, 0x43, 0x6f, 0xa4, 0x5f, 0xe2, 0xfa,
-  0x20, 0x01, 0xbb, 0xf8, 0xdc, 0x3f, 0x3d, 0xfd, 0xfc, 0xf9, 0xf4, 0xb4,
-  0x07, 0x0b, 0xc4, 0x1f, 0xa4, 0x5f, 0xe2, 0xfa, 0x20, 0x01, 0xdb, 0xfc,
-  0xfb, 0xf3, 0x46, 0xf1, 0xf3, 0x5f, 0x75, 0xf8, 0xe9, 0xe6, 0x26, 0x26,
-  0xfd, 0x12, 0xd7, 0xc5, 0x20, 0x02, 0xce, 0xbe, 0xdf, 0xfc, 0xb4, 0xd7,
-  0x7b, 0x33, 0x8f, 0x80, 0xdf, 0xbf, 0xdf, 0xfc, 0xbc, 0xe0, 0x66, 0xa7,
-  0xb7, 0xaf, 0x37, 0x88, 0xaf, 0x4a, 0xc2, 0x1f, 0x6f, 0xae, 0x4d, 0x97,
-  0x04, 0x71, 0x41, 0x86, 0x10, 0x30, 0xeb, 0x7c, 0x2e, 0x2c, 0x4d, 0x7e,
-  0xc6, 0xce, 0x35, 0xd5, 0xf7, 0x45, 0xad, 0x9a, 0x01, 0xcc, 0x72, 0xf2,
-  0x79, 0x7f, 0x63, 0x71, 0x2d, 0x7b, 0x27, 0x3f, 0xde, 0xf6, 0x4f, 0x4f,
-  0xff, 0x52, 0x2d, 0x42, 0x00, 0x86, 0x10, 0x30, 0xef, 0x2b, 0xdb, 0x0a,
-  0x7e, 0xff, 0x71, 0x9f, 0x58, 0xd1, 0xc8, 0xf4, 0x3b, 0x58, 0xcf, 0xfa,
-  0xfd, 0x9f, 0x9f, 0xf7, 0x5f, 0x6f, 0x6e, 0xbe, 0xdf, 0x6f, 0xf8, 0xbe,
-  0xab, 0xf7, 0xaf, 0xb6, 0x7e, 0x6f, 0x6e, 0x16, 0x57, 0xb0, 0xf2, 0xfb,
-  0xf1, 0xcf, 0x77, 0x55, 0xa1, 0xfc, 0x73, 0x01, 0x0d, 0x0b, 0x4f, 0x2d,
-  0xee, 0xef, 0x9f, 0x2e, 0x3b, 0xea, 0x79, 0x7b, 0xba, 0xe7, 0x85, 0x74,
-  0xbf, 0xf9, 0xf7, 0xa2, 0x75, 0xd9, 0x75, 0x78, 0x64, 0x08, 0x01, 0xbf,
-  0xde, 0x78, 0x14, 0xec, 0x40, 0xe8, 0xb7, 0xc5, 0xb2, 0xce, 0xf9, 0x7c,
-  0x3c, 0x2d, 0x50, 0x43, 0xfb, 0xcf, 0xe7, 0x3b, 0x3a, 0x00, 0xb8, 0xf4,
-  0xd8, 0xf7, 0xf3, 0x7f, 0xb8, 0x46, 0x79, 0x1a, 0x38, 0xfb, 0x7f, 0x70,
-  0xc5, 0xb6, 0xb9, 0xd4, 0x06, 0xd8, 0x4f, 0x5c, 0x64, 0x37, 0x3f, 0x2f,
-  0x25, 0x9d, 0xab, 0xf1, 0xc8, 0x10, 0x02, 0x66, 0x7d, 0xe5, 0x76, 0x0a,
-  0x96, 0x0a, 0x1a, 0xe0, 0x49, 0xdc, 0xcf, 0x8d, 0xa3, 0xa9, 0x15, 0xff,
-  0xff, 0xf2, 0x2b, 0xfb, 0xa8, 0xbb, 0xac, 0xbf, 0xbe, 0xc8, 0x5f, 0x2e,
-  0xdb, 0x06, 0x67, 0x56, 0xc5, 0x32, 0x64, 0xb7, 0xde, 0x54, 0x0d, 0x2b,
-  0xa0, 0x4b, 0x04, 0xac, 0x51, 0x8d, 0x71, 0x43, 0x2e, 0x31, 0xbe, 0xb9,
-  0x1a, 0x8f, 0x0c, 0x34, 0x89, 0xf5, 0x2e, 0x15, 0x7c, 0xa8, 0xcb, 0x23,
-  0xf5, 0xfb, 0xad, 0xff, 0xbe, 0x91, 0xad, 0x09, 0xc5, 0x17, 0xd0, 0xde,
-  0xbe, 0x0a, 0x09, 0x2f, 0x2e, 0xf9, 0xd0, 0xc5, 0xab, 0xc3, 0xc8, 0x56,
-  0xfd, 0x99, 0x4e, 0x30, 0x67, 0xf5, 0x44, 0xfe, 0x03, 0x77, 0x02, 0xbc,
-  0x86, 0xdc, 0x5c, 0x8b, 0x21, 0x17, 0xf0, 0xc8, 0x60, 0xcb, 0x48, 0x52,
-  0xc1, 0x87, 0x36, 0x2c, 0xde, 0x0f, 0xa6, 0x5f, 0x47, 0xf3, 0xab, 0xaa,
-  0x52, 0x94, 0xfb, 0x67, 0x22, 0x8e, 0xf6, 0x6e, 0x92, 0x17, 0xa5, 0xdf,
-  0xfb, 0x5f, 0xaf, 0xaf, 0xbf, 0xee, 0x85, 0x2f, 0x87, 0xea, 0x14, 0x38,
-  0x5a, 0x3d, 0xce, 0xf7, 0x81, 0x47, 0xa0, 0x64, 0x88, 0x8b, 0x81, 0xd6,
-  0x81, 0xa5, 0x82, 0x0f, 0x9c, 0x76, 0x09, 0xfd, 0x7e, 0xbb, 0xff, 0x91,
-  0xdc, 0x83, 0xb9, 0x67, 0xab, 0x9b, 0x20, 0x14, 0x7c, 0xb9, 0x89, 0x8a,
-  0x8c, 0xf7, 0x02, 0x54, 0x05, 0xff, 0x9b, 0x3b, 0x73, 0x98, 0x36, 0x18,
-  0x78, 0xea, 0xcb, 0xfd, 0x3d, 0xf2, 0xd4, 0xb0, 0xf1, 0x0a, 0x0c, 0xb9,
-  0xff, 0xf1, 0xf4, 0xf4, 0xeb, 0xfe, 0xcb, 0xe5, 0x0d, 0xb9, 0xac, 0x47,
-  0x18, 0x43, 0x6d, 0xe4, 0xe0, 0x0a, 0x46, 0x8b, 0x46, 0x1f, 0x6f, 0xff,
-  0x3e, 0xfd, 0xf3, 0x86, 0x74, 0xf1, 0x65, 0x68, 0xfd, 0xde, 0xbf, 0x8a,
-  0xae, 0xf1, 0x67, 0x96, 0xa8, 0x63, 0xe6, 0xd9, 0x3f, 0x78, 0xe1, 0xf4,
-  0x6e, 0x95, 0xc1, 0xc7, 0xdb, 0x9b, 0xf4, 0xce, 0xeb, 0x97, 0x9b, 0x6f,
-  0x40, 0xae, 0x1f, 0xc3, 0x59, 0x64, 0x7b, 0xaa, 0xd2, 0x9e, 0x1a, 0x32,
-  0x5e, 0xb5, 0x21, 0x99, 0xcc, 0xf5, 0xfd, 0x49, 0x76, 0x46, 0xbe, 0x5e,
-  0xc4, 0x90, 0x0b, 0x7b, 0x84, 0x33, 0xd8, 0x4e, 0xac, 0xf7, 0x2f, 0xa8,
-  0xd7, 0xb7, 0x57, 0xf5, 0xd6, 0x62, 0xb3, 0x57, 0x47, 0x5f, 0xad, 0x1e,
-  0x6c, 0x2f, 0x3c, 0xc9, 0xc6, 0x17, 0xd5, 0x1e, 0x42, 0x16, 0xf6, 0xa0,
-  0x4a, 0x4c, 0xc2, 0x0d, 0xd9, 0x04, 0x7f, 0x3c, 0x49, 0xff, 0x7c, 0xe5,
-  0xee, 0x31, 0x32, 0xe7, 0x11, 0xd3, 0xff, 0xdc, 0xf8, 0x6f, 0xb7, 0xa7,
-  0x64, 0xc0, 0x0e, 0x37, 0xae, 0x70, 0x1b, 0xf2, 0x29, 0x4b, 0x72, 0xb8,
-  0xda, 0x55, 0x1a, 0xf2, 0x05, 0x39, 0xff, 0x02, 0x1e, 0x11, 0x0c, 0xb7,
-  0x95, 0xf2, 0xf3, 0xf5, 0xb7, 0xac, 0xb1, 0xcc, 0x39, 0x78, 0xbd, 0xd9,
-  0xe9, 0xfd, 0x69, 0x80, 0x91, 0x9d, 0x78, 0x2c, 0xe1, 0x26, 0x31, 0x7f,
-  0x78, 0x15, 0x35, 0xba, 0x69, 0x03, 0x0f, 0x93, 0xe1, 0xde, 0xfe, 0xf3,
-  0x76, 0xef, 0x71, 0x8f, 0xe2, 0x93, 0xbd, 0x87, 0x60, 0xd1, 0xb7, 0x21,
-  0xf2, 0x09, 0x2c, 0x6b, 0xb9, 0x3e, 0x8b, 0xdd, 0x75, 0x5d, 0xdf, 0x86,
-  0x58, 0x65, 0x20, 0xc7, 0x66, 0xf6, 0x2b, 0x55, 0xfa, 0x35, 0xe4, 0xc7,
-  0xa5, 0x3d, 0x22, 0xb9, 0xc4, 0x5e, 0x68, 0xc7, 0x6e, 0x89, 0x41, 0x17,
-  0x03, 0x44, 0xf6, 0x8e, 0xf6, 0x4b, 0x84, 0x83, 0x35, 0xe5, 0xcc, 0x0e,
-  0x0f, 0xb5, 0x3b, 0xcc, 0xb1, 0x58, 0x62, 0x2f, 0x1a, 0x71, 0x4b, 0xfb,
-  0xae, 0xed, 0x0e, 0x7a, 0x6a, 0xa8, 0x37, 0x22, 0xf9, 0x0d, 0xf9, 0x14,
-  0xaf, 0x54, 0x19, 0xa8, 0x7f, 0xf4, 0xd5, 0x53, 0x91, 0x0c, 0xee, 0x11,
-  0xc9, 0x05, 0x04, 0xfc, 0x8f, 0x15, 0x9f, 0xb5, 0x66, 0x86, 0xdb, 0x2a,
-  0xf1, 0xea, 0x0d, 0x06, 0x55, 0x0a, 0x66, 0xdb, 0xcc, 0x3b, 0xd7, 0xc3,
-  0x54, 0x32, 0xee, 0xcd, 0x60, 0x96, 0xb5, 0x89, 0xcb, 0xce, 0x8e, 0x79,
-  0x6d, 0x68, 0x54, 0x3c, 0x9e, 0xea, 0xd5, 0x90, 0xdf, 0xae, 0xdf, 0xc4,
-  0x00, 0x67, 0x98, 0xbe, 0xab, 0x30, 0xc4, 0x79, 0xd7, 0x83, 0x7a, 0x44,
-  0x31, 0xbc, 0x80, 0x7f, 0x3a, 0xc2, 0xb3, 0xe6, 0x7f, 0x03, 0xe5, 0xff,
-  0xc9, 0x17, 0x80, 0x3d, 0x2b, 0x5a, 0xe2, 0x0d, 0x3b, 0x46, 0x07, 0x09,
-  0x3d, 0x38, 0xf5, 0x24, 0x15, 0xf6, 0xb5, 0x8f, 0x4a, 0x47, 0x6f, 0x06,
-  0xfb, 0x72, 0xff, 0x94, 0x7c, 0x53, 0xee, 0x31, 0x55, 0x94, 0xc9, 0x9a,
-  0xef, 0x67, 0x7f, 0x1b, 0x0a, 0xbf, 0x36, 0x79, 0xea, 0x6d, 0xc0, 0x96,
-  0xaf, 0xd1, 0x10, 0xd1, 0xab, 0x1d, 0x64, 0x55, 0xed, 0x6a, 0x3c, 0xa2,
-  0x18, 0x5c, 0xc0, 0xbf, 0x64, 0x44, 0xc6, 0x3f, 0x9e, 0x5e, 0xdf, 0x7e,
-  0x3f, 0xfd, 0x50, 0x21, 0x3a, 0x50, 0x1b, 0xcc, 0x2b, 0xd1, 0xd8, 0x17,
-  0xf5, 0xf7, 0xae, 0xba, 0xfe, 0x0d, 0x18, 0xf8, 0xfb, 0x46, 0xd3, 0x7d,
-  0x59, 0xa9, 0xad, 0x68, 0x72, 0xae, 0xf5, 0x5d, 0xce, 0xd3, 0x18, 0x0a,
-  0xfe, 0xd4, 0x56, 0x2c, 0xfe, 0xe9, 0xdc, 0x0c, 0x86, 0xf0, 0x94, 0xaf,
-  0x4f, 0x98, 0x0c, 0xd6, 0xe0, 0x1c, 0x30, 0xe4, 0xa9, 0x49, 0x55, 0x43,
-  0x1a, 0x32, 0x9c, 0x47, 0x34, 0x43, 0x0b, 0x58, 0x36, 0x1c, 0x7a, 0x12,
-  0xef, 0x53, 0x2d, 0x06, 0x0c, 0xd3, 0x45, 0xfd, 0xe1, 0x52, 0xa8, 0x86,
-  0x3f, 0xb7, 0x6f, 0xcc, 0x6a, 0xbe, 0x01, 0x09, 0xc1, 0x09, 0xa6, 0xce,
-  0x67, 0x2c, 0x3e, 0x79, 0x15, 0x8f, 0x9e, 0x3b, 0xfe, 0xb8, 0x77, 0x36,
-  0x31, 0xd0, 0x8e, 0x7e, 0x56, 0x2f, 0x7e, 0x34, 0xdf, 0x23, 0xaf, 0x42,
-  0x7a, 0x9f, 0x48, 0x6b, 0x61, 0x08, 0x0f, 0xa0, 0x01, 0x56, 0x70, 0xae,
-  0xc6, 0x23, 0x9a, 0x81, 0x05, 0xfc, 0x21, 0x1a, 0x18, 0x34, 0x09, 0xf0,
-  0x29, 0x5a, 0xe1, 0x61, 0x56, 0xf3, 0x9a, 0x1b, 0x60, 0x29, 0x0c, 0x5c,
-  0x99, 0x40, 0x01, 0xff, 0x00, 0xc2, 0xe9, 0x5c, 0xc0, 0x7c, 0x7c, 0x61,
-  0x4e, 0xfa, 0xf2, 0x8a, 0xdf, 0x98, 0x5a, 0xfb, 0x05, 0xec, 0xb8, 0xf9,
-  0xda, 0x47, 0xe5, 0xc7, 0xcb, 0xca, 0x3f, 0x29, 0x93, 0xb8, 0xea, 0x95,
-  0x3e, 0x38, 0x64, 0xc8, 0xaf, 0xe6, 0x3a, 0xb9, 0x6b, 0x43, 0xfc, 0xb1,
-  0x33, 0x98, 0x47, 0x34, 0x03, 0x0b, 0x58, 0x34, 0x1b, 0x66, 0x6f, 0x39,
-  0xe9, 0x49, 0x0f, 0x36, 0x1f, 0xff, 0x3b, 0xd4, 0xcd, 0xe1, 0x6a, 0xf9,
-  0x7a, 0x7f, 0xbf, 0x79, 0x52, 0x0b, 0xd4, 0x4f, 0xc0, 0x6a, 0x39, 0xdb,
-  0xd8, 0x5c, 0x0d, 0x9c, 0xc6, 0x9b, 0xc7, 0xb8, 0xdf, 0x8e, 0xe3, 0xaf,
-  0xf7, 0xf7, 0xf7, 0xf7, 0x6a, 0x8c, 0xdc, 0x7d, 0xe5, 0x27, 0x3c, 0xd5,
-  0xf0, 0x12, 0xec, 0x4c, 0x7a, 0xea, 0xe9, 0xa9, 0xcf, 0x87, 0x94, 0x85,
-  0x21, 0x0d, 0xb3, 0x54, 0x72, 0x6d, 0xe7, 0xab, 0x7c, 0x2a, 0xb4, 0x57,
-  0x43, 0x1a, 0x62, 0x67, 0x20, 0x8f, 0x40, 0x86, 0x15, 0xf0, 0x87, 0x5b,
-  0xbf, 0x52, 0xc1, 0x07, 0x1f, 0x76, 0x38, 0x97, 0x7f, 0xe5, 0x33, 0xb5,
-  0x0d, 0xe3, 0xed, 0x0f, 0xd8, 0xb2, 0x89, 0xc7, 0xd5, 0xd0, 0x24, 0xd6,
-  0xc7, 0x93, 0xa4, 0x73, 0x73, 0xef, 0x7d, 0x92, 0x49, 0xbc, 0x6d, 0xd0,
-  0x9b, 0x18, 0x23, 0x77, 0xbc, 0x95, 0x41, 0x79, 0xaa, 0xa9, 0x52, 0x05,
-  0x8e, 0x5a, 0xfc, 0xaf, 0xa7, 0xe5, 0x93, 0x63, 0x0d, 0xb9, 0xf9, 0x6e,
-  0xaf, 0x9a, 0x77, 0x6b, 0x48, 0x53, 0x4b, 0x3f, 0x84, 0x47, 0x30, 0xc3,
-  0x0a, 0x98, 0xc7, 0xa1, 0x6b, 0xba, 0xc1, 0x39, 0x77, 0xd4, 0x31, 0x99,
-  0x5e, 0xa0, 0x69, 0xaa, 0xa7, 0x6f, 0x10, 0xf7, 0x6f, 0x6a, 0xf2, 0xb1,
-  0xf7, 0x02, 0x79, 0xf7, 0xda, 0xc6, 0x57, 0x3b, 0xdd, 0x5b, 0x49, 0xde,
-  0xbf, 0x75, 0xee, 0x3b, 0xf0, 0xb8, 0x4d, 0x53, 0x7f, 0xf0, 0x1b, 0xf6,
-  0x54, 0x0f, 0xfe, 0x69, 0x69, 0x08, 0xde, 0xf8, 0xd2, 0xc7, 0x92, 0x24,
-  0xd8, 0x5b, 0xd3, 0x34, 0x73, 0xd9, 0xbf, 0x47, 0x4c, 0x06, 0x15, 0x30,
-  0x5f, 0xc1, 0x71, 0x76, 0x3c, 0xdf, 0xfa, 0x68, 0x46, 0x30, 0x70, 0x7f,
-  0x44, 0xd3, 0x79, 0xe6, 0x4b, 0x75, 0xfe, 0x11, 0xc6, 0x7d, 0xe9, 0xd3,
-  0x38, 0x06, 0x1b, 0xcb, 0xb9, 0x7b, 0x68, 0xac, 0x73, 0xe6, 0xdb, 0x4a,
-  0xc2, 0xb7, 0x65, 0x75, 0xd7, 0x1f, 0x78, 0x02, 0x77, 0xdf, 0x54, 0xd5,
-  0xfd, 0xc0, 0x8e, 0xea, 0x5e, 0x38, 0x6d, 0x0d, 0xf9, 0x85, 0x0d, 0xb9,
-  0xd9, 0x74, 0xdd, 0x37, 0x82, 0x86, 0x34, 0xa5, 0x6d, 0x7a, 0xa4, 0xff,
-  0xe1, 0xf0, 0xa0, 0x02, 0xe6, 0x43, 0x39, 0x77, 0x3b, 0xe2, 0xef, 0x24,
-  0x76, 0x83, 0xfa, 0x30, 0xca, 0x41, 0x2d, 0x26, 0x37, 0x06, 0x1b, 0x5e,
-  0x2c, 0xfd, 0x2f, 0x0f, 0x7c, 0xf5, 0x57, 0xf0, 0x7c, 0x82, 0xf3, 0xdf,
-  0x37, 0xe7, 0xd0, 0x8a, 0xb7, 0xdc, 0x9d, 0xc9, 0x07, 0x3d, 0x6a, 0xd9,
-  0x74, 0xe2, 0x93, 0xe5, 0xa9, 0x6e, 0x85, 0xd3, 0xda, 0x90, 0xdf, 0xa6,
-  0x21, 0x1d, 0xbf, 0xef, 0xe0, 0x74, 0x8f, 0xf4, 0xbe, 0xbb, 0x61, 0x50,
-  0x01, 0xf3, 0xdb, 0x73, 0xfb, 0x96, 0xcf, 0x1d, 0xf5, 0xd7, 0x87, 0x06,
-  0xed, 0xea, 0xb7, 0xfb, 0xc6, 0xd9, 0xb2, 0xec, 0x9e, 0x61, 0x16, 0x45,
-  0xdf, 0x0b, 0xf4, 0x9f, 0x7c, 0x90, 0x15, 0x7b, 0x7e, 0x56, 0xf6, 0x7c,
-  0x05, 0x0f, 0x7f, 0x48, 0x7e, 0x77, 0x59, 0xc1, 0xa0, 0x47, 0x2d, 0x1b,
-  0x37, 0x80, 0xbf, 0x71, 0x4f, 0xe9, 0xe7, 0xfa, 0x6e, 0x7e, 0x76, 0x64,
-  0x83, 0x65, 0x48, 0xd2, 0x58, 0x3d, 0xbd, 0x5b, 0x86, 0x74, 0xba, 0xb0,
-  0x06, 0x0c, 0x89, 0x8f, 0xf5, 0x48, 0xdf, 0x9b, 0xb4, 0x7b, 0x14, 0xf0,
-  0xe7, 0x46, 0x6e, 0x2a, 0x92, 0xf5, 0xe1, 0x7d, 0x43, 0x0d, 0xc6, 0x9b,
-  0x18, 0xa1, 0x2c, 0x35, 0x5a, 0xfd, 0xda, 0xd5, 0x1e, 0x05, 0x59, 0x06,
-  0xf1, 0x8f, 0xd7, 0xb6, 0x45, 0xfb, 0xfe, 0x8a, 0x7a, 0x66, 0xfd, 0xee,
-  0xd5, 0xfb, 0xf8, 0xdf, 0x81, 0x97, 0x09, 0xc1, 0x46, 0xe6, 0xde, 0xac,
-  0x4b, 0xf8, 0x7b, 0x3f, 0xbb, 0xb1, 0xe4, 0xd7, 0xf1, 0x9e, 0xaa, 0xde,
-  0x7f, 0xc9, 0xa9, 0xf9, 0x0e, 0x17, 0x12, 0xce, 0x33, 0xa4, 0xc3, 0xaa,
-  0x44, 0x85, 0xc1, 0xfd, 0xef, 0xd6, 0x0d, 0xbb, 0x36, 0xa4, 0xe7, 0xd5,
-  0xad, 0x1e, 0x05, 0x0c, 0xba, 0xa2, 0x62, 0x91, 0xe3, 0xbe, 0x29, 0x42,
-  0xd9, 0x89, 0x7c, 0x7e, 0x0b, 0x4e, 0x04, 0x77, 0xd3, 0x31, 0x94, 0xfb,
-  0x47, 0xbe, 0x1d, 0xd7, 0x47, 0x7f, 0x07, 0x93, 0x12, 0xbd, 0x36, 0xc0,
-  0x7a, 0x03, 0xa5, 0xaf, 0x82, 0x7f, 0xbb, 0x81, 0x98, 0xf5, 0x7a, 0xec,
-  0xaf, 0x19, 0x8f, 0xe4, 0xed, 0x34, 0x4f, 0x7d, 0xfe, 0xea, 0xda, 0x4d,
-  0xa7, 0x1a, 0x22, 0x7b, 0xb1, 0x9d, 0x09, 0xe7, 0x5c, 0x43, 0xfa, 0xdd,
-  0x9f, 0xd4, 0xa3, 0x80, 0xe1, 0x4b, 0xa7, 0x78, 0xb1, 0x36, 0x36, 0x31,
-  0x40, 0xdd, 0xa8, 0xb5, 0xe9, 0xc2, 0x94, 0x4f, 0xd7, 0xfe, 0x91, 0x56,
-  0xa8, 0x41, 0x4d, 0xaf, 0x0f, 0x13, 0x82, 0x17, 0x74, 0x79, 0x2b, 0x2c,
-  0x24, 0x60, 0xf3, 0xa9, 0xe9, 0xfb, 0xce, 0x04, 0xec, 0x7f, 0xdc, 0xe6,
-  0x00, 0xe2, 0x59, 0xcc, 0xce, 0xe6, 0xd2, 0x4e, 0x36, 0xe4, 0xad, 0xe3,
-  0xc7, 0x82, 0x84, 0x21, 0xf6, 0x1b, 0x90, 0x0f, 0x21, 0x3d, 0xd2, 0x91,
-  0x1d, 0x6e, 0x7a, 0x14, 0x30, 0x18, 0x08, 0x08, 0x01, 0xc7, 0x4d, 0x8a,
-  0xfc, 0xae, 0x7f, 0x84, 0x2f, 0x71, 0xeb, 0x64, 0x8b, 0xeb, 0xef, 0xd3,
-  0x2b, 0x65, 0x61, 0xcb, 0x97, 0x3e, 0x97, 0xa8, 0xd5, 0xfd, 0x7e, 0xfb,
-  0xe5, 0xef, 0x2d, 0xb2, 0x95, 0xe7, 0x1f, 0xaa, 0x4b, 0x80, 0x27, 0xec,
-  0xbf, 0x76, 0x25, 0xe0, 0xa6, 0xe7, 0x7e, 0x0e, 0x90, 0x1d, 0xa8, 0x81,
-  0x06, 0x33, 0x44, 0x6c, 0xb5, 0xe9, 0xa8, 0xca, 0xbd, 0x1a, 0x8f, 0xb8,
-  0xe9, 0x51, 0xc0, 0x60, 0x46, 0x4e, 0xec, 0x4d, 0xb8, 0xb7, 0x23, 0x4f,
-  0x03, 0x9c, 0xfe, 0xa9, 0x37, 0x3b, 0x75, 0xd3, 0x25, 0xfb, 0x7a, 0x46,
-  0x63, 0x9e, 0xf4, 0x5e, 0x8d, 0x8a, 0x8d, 0x44, 0xdf, 0xb2, 0x56, 0x95,
-  0x84, 0x5c, 0x91, 0x44, 0xbd, 0xe8, 0x9b, 0xae, 0x04, 0x7c, 0x8e, 0xa7,
-  0x7e, 0x3b, 0x6a, 0x96, 0x8b, 0x18, 0xf2, 0xda, 0x65, 0x91, 0x7d, 0x87,
-  0x11, 0x7c, 0x24, 0xbf, 0xcf, 0xb8, 0x89, 0x96, 0xf4, 0x39, 0x0b, 0xfd,
-  0x7a, 0x2f, 0x90, 0xbd, 0x8f, 0x1f, 0x0d, 0x71, 0xc6, 0xc7, 0xbd, 0x62,
-  0x0e, 0xe4, 0x23, 0x11, 0x57, 0xfe, 0xe8, 0x44, 0xbf, 0x7c, 0x14, 0xe3,
-  0x7d, 0x88, 0xa4, 0x19, 0x51, 0x9b, 0xf4, 0x38, 0x92, 0xb9, 0x3f, 0xb2,
-  0x8b, 0xf6, 0xdb, 0x7a, 0xc5, 0x4f, 0xd6, 0x55, 0x9c, 0xbc, 0x9f, 0xd5,
-  0xfb, 0xfc, 0xd2, 0x5d, 0x95, 0x7b, 0x9e, 0x21, 0xf7, 0xdd, 0xb5, 0x7c,
-  0xc2, 0x90, 0x13, 0x8b, 0xff, 0x4b, 0xdf, 0xb1, 0x73, 0x89, 0x65, 0x24,
-  0xf7, 0xe2, 0xf6, 0x6b, 0x77, 0x85, 0xef, 0xc9, 0xf7, 0xd4, 0x09, 0xd2,
-  0xbe, 0x5f, 0xa8, 0x93, 0x1d, 0x1d, 0x6d, 0xbc, 0x8f, 0xa8, 0x9b, 0x3a,
-  0xfe, 0x0c, 0x53, 0x17, 0xb3, 0x36, 0xbf, 0xcf, 0xf2, 0x54, 0xd6, 0x9d,
-  0xa7, 0xce, 0x33, 0xe4, 0xad, 0xbb, 0x96, 0xcf, 0xb5, 0x0d, 0xbd, 0x3d,
-  0xaf, 0x67, 0xdd, 0x46, 0x1b, 0x06, 0x15, 0xf0, 0x6b, 0x83, 0x33, 0xee,
-  0xcf, 0xa9, 0x71, 0x0f, 0x70, 0x7f, 0x56, 0xe5, 0xf0, 0xde, 0x73, 0x3f,
-  0x88, 0xa9, 0xef, 0xb8, 0xa1, 0xfe, 0x6f, 0x5c, 0x13, 0x3e, 0x75, 0xe6,
-  0xbb, 0x1f, 0xe7, 0x55, 0xa3, 0x8d, 0x93, 0x1c, 0x43, 0x1a, 0xf2, 0xe5,
-  0x5a, 0x0c, 0xe9, 0xbd, 0x0f, 0x3d, 0xec, 0x5e, 0xe8, 0xd8, 0x1b, 0x69,
-  0x1d, 0xd6, 0x99, 0x36, 0x4d, 0xeb, 0xcf, 0x2d, 0xe8, 0xf7, 0x8d, 0x58,
-  0xec, 0xce, 0x8f, 0x7d, 0xae, 0xe9, 0x07, 0xac, 0x09, 0x0f, 0x3e, 0x24,
-  0xd3, 0x1e, 0xee, 0xa9, 0x93, 0x27, 0xec, 0x1a, 0x27, 0x39, 0x86, 0x34,
-  0xe4, 0x57, 0x67, 0x93, 0x02, 0x5d, 0x78, 0xe4, 0xcf, 0x11, 0x30, 0x6f,
-  0x2a, 0x1c, 0x6b, 0xec, 0x62, 0xa3, 0x63, 0x4f, 0x5b, 0x47, 0x59, 0xda,
-  0xa7, 0x6f, 0x65, 0x3e, 0x53, 0xff, 0x07, 0x78, 0x3a, 0xa5, 0xfb, 0xfb,
-  0xa1, 0xeb, 0x94, 0xf7, 0xef, 0xe7, 0x8c, 0xf0, 0x0d, 0xce, 0xf4, 0x54,
-  0x77, 0xba, 0x39, 0xd3, 0x90, 0xa7, 0x6e, 0x0d, 0xf1, 0x6d, 0x8f, 0x3b,
-  0x4c, 0xd2, 0x6b, 0xec, 0x5c, 0xea, 0x71, 0x42, 0x7b, 0x4c, 0xf0, 0xf3,
-  0xcc, 0x02, 0x6b, 0xe6, 0xcc, 0xd6, 0xbd, 0x5f, 0x01, 0x27, 0x27, 0x75,
-  0xd1, 0xc4, 0xce, 0x8d, 0x0f, 0xb5, 0xdb, 0xad, 0x9b, 0xd9, 0x83, 0x33,
-  0x3d, 0xd5, 0xb1, 0x6e, 0xce, 0x35, 0xa4, 0x0b, 0x9f, 0x5c, 0x8d, 0x47,
-  0x3c, 0x0c, 0xfc, 0x40, 0xbf, 0xd8, 0x9d, 0x65, 0x6e, 0x90, 0x14, 0x1b,
-  0x1d, 0xfb, 0xda, 0x75, 0x76, 0xe6, 0x88, 0x48, 0x0b, 0xf8, 0x9f, 0xaf,
-  0x8b, 0xff, 0x75, 0xbd, 0x20, 0x7c, 0xda, 0x1e, 0x8c, 0x7b, 0x1e, 0xa0,
-  0x6a, 0xa9, 0xae, 0xa3, 0xb5, 0xc6, 0x1b, 0xcf, 0x68, 0xe1, 0x69, 0xb1,
-  0x90, 0x0f, 0x2a, 0x64, 0x5f, 0xd5, 0x4b, 0x80, 0xdf, 0xef, 0x6f, 0xbe,
-  0xa3, 0x4e, 0x53, 0xd3, 0x32, 0xc3, 0x99, 0x86, 0x80, 0x45, 0x49, 0x51,
-  0xff, 0xbf, 0x7e, 0x55, 0x2f, 0x22, 0x79, 0xff, 0x6a, 0x3c, 0x0a, 0xf5,
-  0xeb, 0xbc, 0x8e, 0xaf, 0x69, 0xc8, 0xe9, 0xa3, 0x82, 0xee, 0x3c, 0xe2,
-  0x61, 0x60, 0x01, 0x7f, 0x8a, 0xdd, 0x1d, 0xe8, 0xb1, 0x15, 0xf9, 0xa0,
-  0x50, 0x6f, 0xaf, 0x25, 0xbb, 0x3f, 0x6f, 0x10, 0xcb, 0x1a, 0xb9, 0x6f,
-  0x72, 0x96, 0xb5, 0xeb, 0xf7, 0x4f, 0xdd, 0x9c, 0xb4, 0xca, 0xf8, 0x0b,
-  0x09, 0x38, 0xee, 0x6a, 0xec, 0xe1, 0x19, 0xf1, 0xbd, 0xde, 0xe0, 0x6d,
-  0xae, 0x62, 0x89, 0xf5, 0xab, 0x39, 0xa3, 0xf1, 0xf5, 0xb4, 0x9b, 0x71,
-  0xf0, 0xcd, 0x0c, 0x7c, 0xf0, 0xb2, 0x5d, 0xde, 0xb0, 0xb2, 0xdd, 0x75,
-  0x3e, 0x43, 0xba, 0xeb, 0x34, 0x9d, 0x99, 0xd2, 0xf7, 0x3f, 0x4c, 0xc0,
-  0xea, 0x85, 0x34, 0xfa, 0x6b, 0x03, 0xea, 0x5b, 0xab, 0xfd, 0x6d, 0x76,
-  0x3a, 0xef, 0x51, 0xc5, 0x0f, 0xd5, 0x8b, 0xe2, 0xd5, 0x69, 0xc7, 0xcf,
-  0x97, 0xdc, 0x9c, 0xb4, 0xe7, 0x20, 0x81, 0x02, 0xfe, 0xd1, 0xd9, 0xe4,
-  0xbd, 0x67, 0xbe, 0x1e, 0x84, 0x21, 0x9f, 0x00, 0x67, 0x2d, 0x1f, 0x5f,
-  0x35, 0x82, 0x75, 0xc7, 0x99, 0xfd, 0x4d, 0xcb, 0x10, 0xbd, 0x80, 0x0a,
-  0xb6, 0x82, 0x8b, 0x7a, 0x1e, 0xac, 0x3b, 0xa2, 0x3d, 0x04, 0xda, 0x90,
-  0xd3, 0x47, 0xae, 0x96, 0x21, 0x34, 0x0b, 0xad, 0x50, 0xdb, 0x06, 0x17,
-  0x3f, 0x9f, 0xfe, 0x7d, 0xfb, 0xe7, 0x49, 0x3f, 0xb6, 0xd7, 0xdf, 0x72,
-  0xf7, 0xd3, 0x59, 0x1d, 0x74, 0xbd, 0x24, 0xf9, 0xeb, 0xc6, 0x8a, 0x94,
-  0xf3, 0xf9, 0x76, 0x52, 0xe5, 0xf2, 0x9d, 0x7b, 0xec, 0xe9, 0xbf, 0x30,
-  0x4d, 0x3a, 0x74, 0x9c, 0x7b, 0xc5, 0x9c, 0x3f, 0x29, 0xc6, 0x67, 0x28,
-  0x40, 0x1b, 0xfd, 0xcb, 0x8c, 0xed, 0x0e, 0xd7, 0x81, 0x4d, 0x43, 0xc0,
-  0x93, 0x31, 0x1f, 0xf0, 0x08, 0xbb, 0x77, 0x63, 0x55, 0x4d, 0xca, 0xbd,
-  0x93, 0x1e, 0xdd, 0x79, 0x2f, 0xcc, 0xe3, 0x1e, 0xe9, 0xf3, 0x49, 0xf2,
-  0xe1, 0x5f, 0xec, 0x6e, 0x3d, 0x7c, 0xcd, 0xe9, 0xac, 0x17, 0xe8, 0x80,
-  0xd7, 0xd0, 0x27, 0x6e, 0xb3, 0x17, 0x0f, 0x42, 0xd4, 0x71, 0xfa, 0xd1,
-  0xc7, 0xee, 0xf4, 0x7b, 0xb3, 0x19, 0x6b, 0x85, 0x68, 0x12, 0x3f, 0x3b,
-  0x7e, 0x77, 0xda, 0xbb, 0xd3, 0x53, 0x20, 0x0c, 0xb9, 0x96, 0x79, 0x2f,
-  0xd9, 0xea, 0x1e, 0x7e, 0x3f, 0xaf, 0xb5, 0x82, 0x70, 0x09, 0xaa, 0x17,
-  0x71, 0x7e, 0xea, 0xa7, 0x3d, 0xa4, 0x1a, 0xbe, 0xea, 0x46, 0xf6, 0x87,
-  0xae, 0x54, 0xa0, 0x21, 0x9d, 0xcc, 0x0b, 0xbc, 0x1d, 0x8c, 0x9d, 0xa6,
-  0xfa, 0xb3, 0xd7, 0xc5, 0x15, 0xc6, 0x05, 0x3e, 0xad, 0xf2, 0x06, 0x76,
-  0x3a, 0x2b, 0x8e, 0x7c, 0x56, 0xeb, 0x48, 0xee, 0xcf, 0x68, 0x39, 0x9f,
-  0x40, 0xc8, 0xf2, 0x01, 0x40, 0xb7, 0x93, 0xe5, 0x27, 0x3d, 0x8c, 0x9f,
-  0xdd, 0x74, 0x35, 0xd8, 0x34, 0xe0, 0x65, 0x63, 0x2c, 0xf4, 0x81, 0xb7,
-  0xa5, 0x82, 0x46, 0xf6, 0xc3, 0x6c, 0xe6, 0x9e, 0x6e, 0x3a, 0xf4, 0xce,
-  0x17, 0xa4, 0x56, 0xfd, 0x78, 0x8b, 0x5c, 0x2e, 0x83, 0xb9, 0x2f, 0x0c,
-  0x6f, 0x3c, 0xa1, 0xa6, 0xfa, 0x4c, 0x9c, 0x1e, 0xd1, 0xd4, 0x5f, 0xc2,
-  0xf1, 0xd6, 0x14, 0xc2, 0x90, 0x3e, 0x1f, 0x84, 0xb9, 0xc4, 0xc7, 0xcd,
-  0x3e, 0xed, 0xb7, 0x5d, 0x0c, 0xf3, 0x91, 0x9f, 0x53, 0xaa, 0x64, 0x7c,
-  0x29, 0x53, 0x70, 0xb7, 0x5d, 0xe8, 0x8f, 0x13, 0x9a, 0x2d, 0xbe, 0x77,
-  0xb2, 0x8f, 0x1d, 0x7a, 0x22, 0xe4, 0x70, 0x9b, 0xf1, 0x55, 0x87, 0x21,
-  0xe8, 0x36, 0x9b, 0xef, 0x50, 0x11, 0x6b, 0x84, 0x1d, 0x2d, 0x25, 0xfc,
-  0x46, 0x7e, 0xd7, 0x11, 0x23, 0x6f, 0x1a, 0xe4, 0xfe, 0xae, 0x2b, 0x95,
-  0x4a, 0xff, 0xdd, 0x55, 0x4c, 0x39, 0x3d, 0xa2, 0x61, 0x95, 0x87, 0xa7,
-  0x11, 0x16, 0x6f, 0x41, 0xef, 0x35, 0xb8, 0x07, 0xfc, 0xbc, 0xe8, 0xd3,
-  0x93, 0x8a, 0xd2, 0x37, 0xf4, 0xde, 0xa9, 0x38, 0x51, 0x75, 0x65, 0xf6,
-  0xd4, 0xcf, 0x67, 0x42, 0x78, 0x7d, 0x7e, 0xc2, 0x37, 0x48, 0xc4, 0x93,
-  0xba, 0xaa, 0x59, 0x79, 0xff, 0xd1, 0xfc, 0x3e, 0x9e, 0x13, 0xb8, 0x3f,
-  0xd4, 0x47, 0xb3, 0xf9, 0xd5, 0x61, 0x0b, 0x63, 0x20, 0x3c, 0x05, 0xe3,
-  0x15, 0xee, 0x25, 0xe5, 0x5a, 0x66, 0xff, 0xfc, 0x81, 0x8d, 0x10, 0x1f,
-  0x65, 0xeb, 0x66, 0x43, 0x89, 0x5e, 0xaf, 0x60, 0x0a, 0xd6, 0x6f, 0x78,
-  0x50, 0x5b, 0xd6, 0xac, 0x21, 0xb0, 0x0a, 0x2e, 0xf9, 0x70, 0x75, 0x57,
-  0x86, 0xc4, 0xb6, 0x47, 0x34, 0xef, 0xa8, 0x56, 0x31, 0x7e, 0xfb, 0xda,
-  0xa9, 0x21, 0x6e, 0x86, 0xfb, 0xc0, 0xf7, 0x02, 0x35, 0x81, 0x1f, 0xbf,
-  0xee, 0xb9, 0x63, 0xbe, 0xdc, 0xff, 0xd6, 0xb1, 0xfb, 0xd4, 0xd7, 0x67,
-  0x42, 0xe4, 0x24, 0xe6, 0xcf, 0x23, 0x13, 0x97, 0x5f, 0x52, 0xec, 0xf3,
-  0x75, 0x1c, 0x62, 0x17, 0xe9, 0x11, 0x96, 0xfd, 0xd3, 0x63, 0xc5, 0x2e,
-  0xdf, 0x5d, 0x02, 0xde, 0xc6, 0x06, 0x1e, 0x2c, 0xb0, 0x3a, 0xae, 0xaa,
-  0x66, 0x93, 0x9e, 0xea, 0xec, 0xe1, 0x57, 0x59, 0x64, 0xff, 0x7c, 0xc2,
-  0x45, 0x60, 0x25, 0x95, 0xaf, 0x3a, 0x77, 0xb4, 0xd6, 0xaa, 0x3e, 0xce,
-  0xda, 0x59, 0x3d, 0xfb, 0x64, 0x7b, 0x04, 0x10, 0x7b, 0xc3, 0xe3, 0x9f,
-  0xae, 0x0d, 0x71, 0x32, 0x94, 0x80, 0xf9, 0x3b, 0x63, 0x8c, 0xb5, 0xd8,
-  0xb7, 0x37, 0xa3, 0xef, 0xc1, 0x4e, 0xea, 0x45, 0xc1, 0xb2, 0x14, 0x16,
-  0xff, 0xb6, 0x9f, 0xb3, 0xfd, 0xfc, 0xf7, 0xeb, 0x20, 0x65, 0x70, 0xdf,
-  0x54, 0xc5, 0xdb, 0x88, 0x6f, 0x25, 0x75, 0xd5, 0xd4, 0x99, 0xc8, 0xce,
-  0xd1, 0xf7, 0xbd, 0xcc, 0x00, 0x2c, 0xe9, 0x80, 0x8e, 0x2b, 0x17, 0x98,
-  0x78, 0x80, 0x7b, 0x2f, 0xbf, 0x39, 0xd9, 0x61, 0xad, 0x22, 0x0d, 0x59,
-  0x3c, 0x7d, 0xa8, 0x45, 0x60, 0xdd, 0x13, 0x02, 0xb9, 0x2d, 0x74, 0x07,
-  0xe1, 0x4d, 0x7d, 0x3a, 0xb2, 0xc3, 0x4d, 0x05, 0x3f, 0x2c, 0x8f, 0x00,
-  0xea, 0x19, 0x1d, 0xc7, 0xbc, 0xbb, 0xf6, 0x48, 0xcf, 0xdf, 0x3d, 0x1d,
-  0x48, 0xc0, 0xe2, 0x9d, 0x4f, 0x87, 0x56, 0xe6, 0x84, 0xa3, 0xfa, 0x50,
-  0x30, 0x18, 0x77, 0xdf, 0xff, 0xef, 0xe9, 0x30, 0xff, 0x03, 0xef, 0xa5,
-  0xec, 0xb9, 0x0c, 0x64, 0x6f, 0xf1, 0xe7, 0x3f, 0x87, 0x1b, 0xfa, 0xf7,
-  0xbd, 0x7c, 0xfb, 0x5d, 0x6f, 0xef, 0x79, 0xd0, 0xef, 0x01, 0xfb, 0xba,
-  0x61, 0xaa, 0x05, 0x45, 0x07, 0x3e, 0x94, 0xac, 0x9e, 0x0d, 0xfd, 0xf8,
-  0x9f, 0x7e, 0x63, 0xef, 0xb7, 0x2e, 0x8b, 0xce, 0x9e, 0x2a, 0xd1, 0x37,
-  0xfd, 0x5b, 0xff, 0xa9, 0x7a, 0xb1, 0xef, 0xf0, 0xcd, 0xa3, 0x1d, 0x1a,
-  0xf2, 0x69, 0x79, 0xa4, 0xfa, 0xfc, 0xe7, 0x1f, 0x99, 0xc1, 0xe7, 0x9b,
-  0x92, 0xf5, 0x5e, 0x7c, 0xd8, 0x05, 0x7a, 0xa4, 0xf3, 0xcf, 0xef, 0x18,
-  0x0c, 0x23, 0x60, 0xf9, 0xce, 0xb6, 0x43, 0xf5, 0xf3, 0x8f, 0xfe, 0x14,
-  0xec, 0x98, 0x39, 0x6b, 0xcb, 0x31, 0xbd, 0xdb, 0x93, 0x78, 0x77, 0xcd,
-  0xcb, 0x1f, 0xa0, 0xbf, 0x4e, 0x01, 0x88, 0x57, 0x96, 0x0b, 0x5c, 0xcb,
-  0x04, 0xdd, 0x66, 0xb5, 0x88, 0x04, 0xdf, 0xbc, 0xd2, 0x69, 0xaf, 0xe0,
-  0xf3, 0x9b, 0x79, 0xd3, 0x7a, 0x86, 0x1b, 0x0c, 0xc0, 0xd5, 0xbe, 0x67,
-  0x68, 0x48, 0xa7, 0x45, 0x66, 0x7a, 0x84, 0xc5, 0xb3, 0x3d, 0x6b, 0xf1,
-  0x53, 0xfe, 0x0c, 0x0d, 0xe9, 0xfb, 0x93, 0x9b, 0x83, 0x08, 0x58, 0xea,
-  0xf7, 0xa0, 0x5b, 0xa5, 0xa7, 0x7a, 0xed, 0x45, 0x5f, 0x8f, 0x54, 0x14,
-  0xef, 0x5f, 0x5a, 0xd8, 0x81, 0xe8, 0xf5, 0x65, 0xa5, 0x7a, 0x8a, 0x51,
-  0x6f, 0x5f, 0x61, 0x8d, 0x1d, 0xf8, 0xf8, 0x1a, 0x5f, 0x10, 0xfe, 0x81,
-  0xfc, 0x7a, 0xfc, 0x7b, 0xdf, 0x5a, 0x1b, 0xc2, 0xd1, 0x3d, 0x14, 0x50,
-  0x93, 0xa8, 0xcd, 0x8e, 0xda, 0x90, 0xae, 0xab, 0xdc, 0x4f, 0xfd, 0xc5,
-  0x05, 0x16, 0x0d, 0xec, 0x4f, 0xb3, 0xe3, 0xcc, 0x9d, 0xf3, 0x89, 0x0c,
-  0xe9, 0xb6, 0x22, 0x71, 0x31, 0x84, 0x80, 0x3f, 0xdb, 0xea, 0x17, 0x28,
-  0xb8, 0x0f, 0x3b, 0xde, 0x8e, 0x96, 0x49, 0x1d, 0x24, 0x83, 0x7c, 0x70,
-  0xfd, 0xc8, 0xfe, 0x41, 0x9f, 0xbb, 0x5e, 0x6a, 0x5e, 0xa5, 0xa7, 0x9e,
-  0xf0, 0x22, 0x12, 0x78, 0xa5, 0x8a, 0x1e, 0x0d, 0xcb, 0x70, 0x8d, 0x7b,
-  0xa8, 0x54, 0x32, 0x54, 0x64, 0x7a, 0x28, 0x03, 0x87, 0xc0, 0xea, 0x27,
-  0x65, 0x48, 0x0f, 0x55, 0xee, 0x2b, 0x7a, 0xf1, 0xf5, 0xfd, 0x8d, 0xa3,
-  0x3b, 0xc9, 0x7b, 0x2a, 0x1f, 0x3d, 0x1b, 0x62, 0x32, 0x84, 0x80, 0xc5,
-  0x92, 0x5e, 0xab, 0xda, 0x48, 0x2a, 0xb8, 0x1f, 0xd9, 0xbc, 0x1e, 0xdb,
-  0x8f, 0xbe, 0xef, 0xf5, 0x8d, 0x82, 0x90, 0xb7, 0xf6, 0xa6, 0xc5, 0xdd,
-  0x7f, 0x16, 0xd1, 0xe4, 0xf3, 0xe9, 0x8b, 0x0c, 0x57, 0x3e, 0xf1, 0x0c,
-  0xf7, 0x5e, 0xb1, 0xdc, 0xf5, 0xfe, 0x72, 0xb1, 0x7f, 0xa3, 0x1f, 0xa3,
-  0x3e, 0x7f, 0x03, 0x09, 0xeb, 0xa0, 0x00, 0x43, 0x60, 0xfd, 0xed, 0x66,
-  0x6e, 0x48, 0xdc, 0x79, 0x3f, 0x80, 0x1b, 0x22, 0xbe, 0x43, 0xaf, 0xfb,
-  0xc8, 0x66, 0x25, 0xca, 0xf6, 0xe9, 0x7d, 0xab, 0xfa, 0x36, 0xc4, 0x60,
-  0x38, 0x01, 0xdb, 0xfa, 0x7d, 0xfb, 0x7e, 0xf3, 0xd3, 0x1a, 0x22, 0x08,
-  0x05, 0xf7, 0xd5, 0xee, 0xbd, 0x3f, 0x25, 0xf7, 0xed, 0x1a, 0xe2, 0x2f,
-  0xf7, 0xc9, 0xd3, 0x20, 0x1f, 0x88, 0x94, 0x7c, 0xfc, 0x76, 0x7c, 0xcf,
-  0xc5, 0x61, 0xd5, 0x40, 0xdf, 0x8f, 0x7e, 0xaf, 0x17, 0xfa, 0x9e, 0xd0,
-  0x6b, 0x9d, 0xe0, 0x3e, 0x4a, 0xfd, 0xe0, 0xd1, 0xeb, 0xcd, 0x97, 0xfb,
-  0xa7, 0x1e, 0x2b, 0x3a, 0xb5, 0x0b, 0x0b, 0x4c, 0x2c, 0xbb, 0x86, 0xc0,
-  0xf5, 0x89, 0xbd, 0x7a, 0x27, 0x13, 0x1e, 0xe1, 0xc3, 0x0a, 0xbb, 0x75,
-  0x7d, 0x8b, 0xc5, 0x90, 0xf7, 0xf5, 0x26, 0x1e, 0xac, 0x98, 0x06, 0xe9,
-  0x42, 0xc7, 0x4e, 0xfd, 0xb2, 0x7d, 0x2a, 0xf6, 0x43, 0x7e, 0x4c, 0xc1,
-  0x7d, 0xec, 0x12, 0x24, 0x4e, 0x02, 0x4c, 0x3c, 0x03, 0x2d, 0x9b, 0xbb,
-  0x9f, 0x7a, 0x44, 0x7d, 0xd9, 0xe4, 0xbb, 0x78, 0x55, 0x29, 0xde, 0x3c,
-  0xd9, 0xef, 0xeb, 0x16, 0x5a, 0xd0, 0xf7, 0x34, 0x55, 0x33, 0x83, 0x4c,
-  0x62, 0x7d, 0x24, 0xf7, 0x8e, 0x0e, 0x56, 0xe6, 0x69, 0x6a, 0x3f, 0x9f,
-  0x5c, 0x67, 0x13, 0x17, 0x82, 0x7f, 0x12, 0x96, 0xfd, 0xd3, 0xbf, 0xfb,
-  0xa9, 0x77, 0x03, 0x00, 0xbf, 0xf0, 0x1a, 0x34, 0xfb, 0x67, 0xcf, 0x0b,
-  0x7d, 0x0d, 0x34, 0xee, 0x85, 0x1e, 0x80, 0x4b, 0xec, 0x85, 0x16, 0x74,
-  0xf7, 0xda, 0x13, 0xa2, 0x3f, 0xc0, 0xc4, 0x33, 0x7c, 0x00, 0xe8, 0xfe,
-  0xa6, 0xab, 0x07, 0x6e, 0x0f, 0x91, 0x19, 0xfa, 0xfd, 0xf2, 0x89, 0x26,
-  0xd3, 0x32, 0xdd, 0x2b, 0xb8, 0x08, 0x5f, 0x6f, 0x7a, 0xff, 0xfc, 0x51,
-  0x23, 0x24, 0x60, 0xa2, 0x11, 0xb0, 0x88, 0xf4, 0xae, 0x47, 0xa2, 0x7a,
-  0x11, 0xa9, 0x77, 0x8c, 0x6f, 0x66, 0xb3, 0x80, 0x69, 0x7a, 0x28, 0x79,
-  0x58, 0x9a, 0xf6, 0x42, 0x0f, 0x02, 0x09, 0x98, 0x68, 0x04, 0x4c, 0x3c,
-  0x83, 0xa9, 0xdf, 0xe3, 0x5f, 0x46, 0x7f, 0x2a, 0x1f, 0x86, 0x7e, 0x59,
-  0xbf, 0x19, 0x4c, 0xa6, 0xf5, 0xfe, 0xce, 0x9a, 0x03, 0xc4, 0x37, 0x3d,
-  0x3f, 0xf0, 0x7b, 0x00, 0x12, 0x30, 0xd1, 0x04, 0x5c, 0x44, 0x02, 0x53,
-  0xbf, 0xe7, 0xbd, 0xa4, 0xe8, 0x28, 0x03, 0xc4, 0xcc, 0x95, 0x58, 0x87,
-  0x65, 0x96, 0x5c, 0xd1, 0x10, 0x98, 0x4d, 0xec, 0xf5, 0xfc, 0x30, 0x6c,
-  0x23, 0x24, 0x60, 0xa2, 0x09, 0xf8, 0xdd, 0x75, 0x3e, 0x04, 0x65, 0xff,
-  0xfc, 0x75, 0x33, 0xf4, 0x52, 0x81, 0x78, 0x48, 0x01, 0x6f, 0xc3, 0x96,
-  0x8f, 0x3f, 0xf6, 0xfc, 0x11, 0x6d, 0x9b, 0xcf, 0xfd, 0x5e, 0xce, 0xb3,
-  0x7e, 0x3c, 0xa9, 0xf6, 0xf7, 0x7d, 0x3f, 0xfc, 0x60, 0x98, 0x04, 0x4c,
-  0x34, 0xf2, 0x4b, 0xbd, 0x6e, 0x10, 0xbe, 0xf1, 0x8a, 0x6d, 0x5a, 0x18,
-  0x72, 0xf2, 0x15, 0xbd, 0x51, 0x1c, 0xae, 0x1c, 0xd5, 0xfb, 0xc8, 0x7b,
-  0xfd, 0xf6, 0xab, 0x8b, 0x7a, 0x6f, 0xf0, 0x57, 0xe7, 0x5e, 0xe8, 0xc1,
-  0xab, 0x92, 0x0b, 0x0a, 0xb8, 0xcf, 0xcf, 0x99, 0x11, 0x9d, 0xf1, 0xfa,
-  0xe3, 0x37, 0xef, 0x2a, 0xff, 0x02, 0xed, 0x5e, 0xf5, 0x91, 0xfc, 0x18,
-  0x74, 0xe0, 0xf7, 0x0a, 0xba, 0xf2, 0xb8, 0xdb, 0xfc, 0xf1, 0x34, 0xfc,
-  0xa2, 0xe3, 0x0f, 0xd7, 0xcc, 0xd5, 0xdb, 0x45, 0x46, 0xe3, 0x17, 0x14,
-  0x30, 0x9b, 0xc0, 0xeb, 0xfb, 0x69, 0x2b, 0xa2, 0x33, 0x2e, 0x3a, 0x5d,
-  0xc4, 0x6a, 0x8f, 0x98, 0xf7, 0x50, 0x2f, 0xbd, 0x72, 0x24, 0xba, 0x00,
-  0xe6, 0x1c, 0x7c, 0xa6, 0xfb, 0xf8, 0x03, 0x72, 0x41, 0x01, 0xb3, 0x77,
-  0xa2, 0x5e, 0x72, 0x0d, 0x9c, 0x38, 0x86, 0x0f, 0xd4, 0xee, 0x0d, 0xcd,
-  0x77, 0x30, 0xd4, 0xbd, 0xf0, 0xca, 0x91, 0x1c, 0xfd, 0x99, 0xa1, 0xfb,
-  0x71, 0x73, 0xd3, 0xdf, 0xd7, 0x81, 0xbc, 0x5c, 0x52, 0xc0, 0xd5, 0x47,
-  0xc7, 0x2f, 0x45, 0x25, 0x7a, 0xc4, 0x7c, 0x87, 0xdd, 0xb0, 0xc0, 0xca,
-  0xe3, 0xd2, 0x2b, 0x47, 0xbc, 0x0f, 0x6d, 0x6f, 0x23, 0xcd, 0xe2, 0x9b,
-  0x2f, 0x83, 0xcf, 0x62, 0x5d, 0x54, 0xc0, 0x44, 0x40, 0xfc, 0xb8, 0x48,
-  0x0f, 0x51, 0xf0, 0x06, 0xde, 0x21, 0xf4, 0x79, 0xe9, 0x95, 0xa3, 0xab,
-  0x82, 0x04, 0x4c, 0xb4, 0x03, 0xec, 0x89, 0x1e, 0x9e, 0x27, 0xd0, 0xf8,
-  0x5f, 0x7e, 0x08, 0x0c, 0xf9, 0xfc, 0x79, 0xf3, 0xfd, 0x92, 0xbd, 0x79,
-  0x12, 0x30, 0xd1, 0x0a, 0xf8, 0x08, 0xfd, 0xf0, 0xdc, 0x83, 0x26, 0xf7,
-  0xd7, 0x25, 0xbb, 0x02, 0x16, 0xdf, 0xe1, 0x07, 0x24, 0x2e, 0x00, 0x09,
-  0x98, 0x68, 0xc5, 0xd3, 0x60, 0x9b, 0x27, 0x5d, 0x2c, 0xc0, 0x72, 0xc5,
-  0x70, 0xcf, 0x51, 0xb4, 0xe0, 0xe3, 0xa2, 0x33, 0x03, 0x24, 0x60, 0xa2,
-  0x2d, 0xbf, 0xf5, 0x9e, 0xe8, 0xe1, 0x79, 0x87, 0xdb, 0x8d, 0x13, 0xd7,
-  0x1a, 0xce, 0xa5, 0xf8, 0xbc, 0x68, 0xbd, 0x46, 0x02, 0x26, 0xda, 0xc2,
-  0xf6, 0x5e, 0x0d, 0xf2, 0x00, 0xbf, 0x83, 0xdf, 0x50, 0xb0, 0x59, 0xac,
-  0x56, 0x84, 0xaf, 0x80, 0xa7, 0x0b, 0xbf, 0x7e, 0x82, 0x04, 0x4c, 0xb4,
-  0xe3, 0xa3, 0xfb, 0x8f, 0xca, 0xb4, 0x26, 0x41, 0xfb, 0x7d, 0x3e, 0x9e,
-  0x86, 0x7d, 0xd7, 0x51, 0x33, 0xd9, 0xd3, 0x05, 0x3b, 0xd0, 0x24, 0x60,
-  0x22, 0x04, 0xbe, 0x5e, 0xf0, 0x79, 0xbd, 0x2b, 0x87, 0x04, 0x4c, 0x10,
-  0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90,
-  0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82,
-  0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86,
-  0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13,
-  0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30,
-  0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98,
-  0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80,
-  0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0,
-  0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04,
-  0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02,
-  0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22,
-  0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12,
-  0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10,
-  0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90,
-  0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82,
-  0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86,
-  0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13,
-  0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30,
-  0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98,
-  0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80,
-  0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0,
-  0xbd, 0x53, 0xde, 0x8d, 0xa7, 0x8f, 0x47, 0x5d, 0x91, 0xcd, 0xa3, 0x79,
-  0xde, 0x9b, 0x3d, 0xc4, 0x9f, 0x04, 0x09, 0xf8, 0x34, 0xf2, 0xf6, 0x02,
-  0xbb, 0x8d, 0xa2, 0x28, 0xda, 0x1e, 0x91, 0x76, 0x31, 0x8e, 0xa2, 0x68,
-  0x5c, 0x1c, 0x65, 0xcf, 0xfe, 0xb8, 0xd3, 0x8f, 0xa0, 0xdc, 0x97, 0x7d,
-  0x25, 0x4d, 0x9c, 0x0f, 0x09, 0xf8, 0x34, 0xe2, 0x28, 0x1a, 0x2f, 0xda,
-  0x89, 0xb8, 0xd6, 0x6f, 0x34, 0x3f, 0x22, 0xed, 0x6d, 0x74, 0x9c, 0xe4,
-  0x77, 0xf3, 0x28, 0x8a, 0x92, 0x23, 0x32, 0x38, 0x8a, 0xac, 0xb6, 0x7e,
-  0xdd, 0x57, 0xea, 0xc4, 0x99, 0xf4, 0x25, 0xe0, 0xc7, 0xcd, 0x66, 0xb3,
-  0x69, 0x6a, 0x15, 0xf6, 0x90, 0xf0, 0xfa, 0x8b, 0x71, 0xad, 0xb1, 0xac,
-  0xd5, 0xa9, 0x4c, 0x8e, 0xf1, 0x11, 0x69, 0x73, 0x01, 0xef, 0x5a, 0x9f,
-  0x9f, 0x44, 0x7d, 0x0b, 0xf8, 0x28, 0xf3, 0x89, 0x21, 0xe9, 0x47, 0xc0,
-  0xd9, 0x34, 0x3a, 0x14, 0xe0, 0x11, 0x24, 0xbc, 0x0a, 0xfe, 0x08, 0x01,
-  0xaf, 0x8e, 0x93, 0x63, 0x55, 0x95, 0xa3, 0xff, 0x2e, 0x98, 0xb4, 0xef,
-  0xb8, 0x92, 0x80, 0xff, 0x62, 0xfa, 0x10, 0x70, 0x71, 0x2b, 0x74, 0xd9,
-  0x5a, 0xc0, 0xc7, 0x8c, 0x10, 0xaf, 0x83, 0x23, 0x04, 0x5c, 0x25, 0x71,
-  0x9c, 0x1e, 0x95, 0x78, 0xb1, 0x8a, 0x57, 0x47, 0x8c, 0x69, 0x49, 0xc0,
-  0x7f, 0x31, 0x3d, 0x08, 0x78, 0x33, 0x8e, 0x8e, 0x15, 0x70, 0x4b, 0x25,
-  0x5c, 0x11, 0xc7, 0x08, 0xb8, 0x6f, 0xce, 0x13, 0x70, 0xb1, 0x69, 0xfe,
-  0x9d, 0x04, 0x7c, 0xd5, 0x74, 0x2e, 0xe0, 0x7c, 0xda, 0x4e, 0x97, 0xec,
-  0x84, 0x55, 0xc2, 0xe9, 0x6d, 0x0a, 0xb5, 0x37, 0xfe, 0x14, 0x01, 0xe7,
-  0x77, 0x51, 0xd4, 0xec, 0x7d, 0x12, 0xf0, 0x55, 0xd3, 0xbd, 0x80, 0xf9,
-  0x9c, 0xcd, 0xa4, 0x95, 0x80, 0x1d, 0x27, 0x14, 0xcf, 0x9b, 0x67, 0x3d,
-  0xa7, 0x55, 0xbe, 0x6c, 0x36, 0x9b, 0x83, 0xeb, 0x18, 0xe5, 0xf3, 0xe6,
-  0x45, 0x5c, 0xfd, 0xb2, 0x79, 0xde, 0xb7, 0xb2, 0xb3, 0xd8, 0x6f, 0x1e,
-  0xdb, 0x2c, 0x90, 0xe4, 0x8f, 0xc6, 0x5c, 0xdc, 0xfe, 0xb1, 0x36, 0x08,
-  0x09, 0xb8, 0xac, 0x8f, 0xb5, 0xac, 0x84, 0xf2, 0x97, 0xcd, 0xe6, 0xb9,
-  0x80, 0x7f, 0x3e, 0x37, 0x4e, 0xe1, 0xe5, 0xcf, 0x9b, 0xcd, 0xa3, 0xe3,
-  0x8c, 0x3a, 0xcf, 0x0d, 0xbf, 0x55, 0x29, 0xe0, 0xfc, 0x11, 0xb8, 0xaa,
-  0xdc, 0x3f, 0x6f, 0x36, 0x2f, 0x96, 0x55, 0xfb, 0xcd, 0x63, 0xc9, 0x7f,
-  0xae, 0x3d, 0xbb, 0x18, 0x83, 0xf1, 0x79, 0x6e, 0xfa, 0xae, 0x78, 0xd9,
-  0xbc, 0xe4, 0x24, 0xe0, 0xeb, 0xa6, 0xfb, 0x2e, 0x74, 0x12, 0x45, 0xa3,
-  0xdd, 0xe1, 0x16, 0xca, 0x14, 0x30, 0x8b, 0x93, 0xac, 0xe4, 0xc3, 0xe7,
-  0x5b, 0x1e, 0x87, 0xd9, 0x42, 0x34, 0xe5, 0x77, 0x45, 0x05, 0x1b, 0x1a,
-  0x76, 0x4c, 0xfe, 0x23, 0xa9, 0x76, 0xe3, 0x28, 0x9a, 0xd4, 0x7f, 0xe6,
-  0xe2, 0xfc, 0x5b, 0x28, 0xcc, 0x91, 0x1e, 0x64, 0xb3, 0xe9, 0xdd, 0x65,
-  0xfd, 0xaf, 0x54, 0x9c, 0x39, 0x16, 0x83, 0x53, 0x65, 0xae, 0x0a, 0x57,
-  0xf6, 0x8f, 0xbc, 0x7a, 0x30, 0x1a, 0xb7, 0x94, 0x75, 0x30, 0xc6, 0x8f,
-  0xe0, 0xfe, 0x4a, 0x31, 0x66, 0x18, 0xd7, 0x7f, 0x96, 0x60, 0x4c, 0x1f,
-  0xf3, 0x7f, 0xc2, 0x06, 0xf2, 0x51, 0xf4, 0x4f, 0x16, 0xfc, 0xd2, 0x74,
-  0xce, 0xff, 0x7c, 0xc0, 0x35, 0x89, 0xba, 0xbf, 0xea, 0x59, 0x9c, 0x3f,
-  0xde, 0xe0, 0x33, 0xca, 0x3b, 0x91, 0xe7, 0x5d, 0x29, 0x1d, 0xc3, 0x6f,
-  0x7e, 0xcc, 0xd5, 0xb8, 0x99, 0xcb, 0x5e, 0xd0, 0x5d, 0x29, 0x4b, 0x25,
-  0x9a, 0x57, 0xe5, 0x9c, 0xdd, 0x94, 0x32, 0x99, 0xb3, 0x84, 0xbe, 0x56,
-  0xbe, 0x2b, 0xef, 0xf8, 0xdf, 0x29, 0x09, 0xf8, 0x9a, 0xe9, 0x61, 0x0c,
-  0x3c, 0x5b, 0x97, 0x2d, 0xba, 0x98, 0x4e, 0x01, 0xaf, 0x65, 0xdc, 0xad,
-  0xea, 0x43, 0x3b, 0x3c, 0x4a, 0xf6, 0x08, 0x38, 0x56, 0x9a, 0xd3, 0xe7,
-  0x4f, 0x41, 0xc2, 0x2b, 0x95, 0x5e, 0xb5, 0x94, 0xe2, 0xda, 0xe8, 0x84,
-  0x79, 0xc0, 0x7a, 0x04, 0x9c, 0xad, 0x0d, 0x2b, 0xa1, 0x49, 0xe2, 0x87,
-  0x52, 0x69, 0x25, 0x7a, 0x90, 0x79, 0xf0, 0xec, 0x98, 0x48, 0x0a, 0x28,
-  0xe0, 0x3b, 0x7d, 0x6d, 0x8a, 0xcc, 0x98, 0xa2, 0x36, 0x56, 0xdd, 0x1f,
-  0x38, 0x7f, 0x0a, 0x4f, 0xc8, 0xb5, 0xfe, 0xc6, 0xc2, 0x31, 0x73, 0x79,
-  0x88, 0xa5, 0x34, 0x03, 0x17, 0xb2, 0x1b, 0x64, 0xe7, 0x70, 0x53, 0xab,
-  0xaa, 0xd4, 0x97, 0xcf, 0xd6, 0xc9, 0xae, 0x70, 0xf9, 0x0e, 0xdc, 0x16,
-  0x09, 0xf8, 0x8a, 0xe9, 0x6b, 0x1d, 0xf8, 0x34, 0x01, 0x6b, 0x72, 0xb1,
-  0x21, 0x49, 0xc6, 0x59, 0xe5, 0x17, 0xf0, 0x42, 0x1c, 0xe7, 0x29, 0x8c,
-  0x58, 0xe7, 0x7d, 0xac, 0x1b, 0xac, 0x9d, 0x0e, 0xff, 0x29, 0x57, 0x94,
-  0x58, 0x68, 0x15, 0xac, 0x2a, 0xbf, 0x80, 0x99, 0x7e, 0xc1, 0x18, 0x11,
-  0x9a, 0x24, 0xcd, 0xe7, 0x81, 0xce, 0x15, 0xb3, 0x83, 0xd9, 0xe5, 0xc2,
-  0x70, 0x6d, 0xf7, 0x1a, 0xdc, 0x50, 0x29, 0xcd, 0x98, 0x8c, 0x2c, 0x7d,
-  0xca, 0xfb, 0x83, 0xd5, 0x05, 0x5c, 0x69, 0x03, 0x02, 0xac, 0x13, 0x4e,
-  0x90, 0x51, 0xac, 0x3d, 0xdd, 0x9a, 0x57, 0xb2, 0x73, 0xb6, 0xc2, 0x22,
-  0x61, 0xf2, 0x48, 0xb7, 0xd8, 0x29, 0x30, 0x85, 0xfb, 0xee, 0x16, 0x25,
-  0x4a, 0x02, 0xbe, 0x56, 0xae, 0x4d, 0xc0, 0x71, 0xca, 0xa3, 0x36, 0x15,
-  0x31, 0x37, 0xcb, 0x8a, 0x6c, 0x3b, 0x61, 0xcd, 0x8a, 0x47, 0xc0, 0x63,
-  0x21, 0x9d, 0xb2, 0x96, 0xe7, 0x28, 0x15, 0x61, 0xaf, 0xe3, 0x9d, 0x77,
-  0x6a, 0xeb, 0xa0, 0x2c, 0x44, 0xfc, 0x16, 0x3c, 0x7e, 0xd3, 0x94, 0xb5,
-  0x96, 0x2c, 0x6d, 0x8f, 0x80, 0x23, 0x95, 0x13, 0x87, 0xb5, 0xe6, 0xd1,
-  0x36, 0x4f, 0x67, 0xca, 0x7c, 0x66, 0xd5, 0xaa, 0xac, 0xca, 0x19, 0x8f,
-  0x7d, 0x9d, 0x1d, 0x93, 0xcb, 0x16, 0xd8, 0xcd, 0x93, 0x9c, 0x6d, 0x77,
-  0xeb, 0x91, 0xaa, 0xa0, 0x46, 0xb9, 0x38, 0x31, 0x31, 0x7d, 0x23, 0xeb,
-  0x86, 0x55, 0x56, 0x64, 0xeb, 0xd1, 0x08, 0x76, 0xa1, 0xb9, 0xb8, 0xd6,
-  0xbb, 0xed, 0x4a, 0xd7, 0x6c, 0xd1, 0x68, 0x9d, 0xb1, 0xfb, 0x61, 0x7b,
-  0xbe, 0x8a, 0xc9, 0x6a, 0x97, 0x15, 0xfc, 0x00, 0xb3, 0x5f, 0x8b, 0x7c,
-  0xc9, 0x1d, 0x34, 0x29, 0x84, 0xa7, 0x76, 0xb2, 0x46, 0x18, 0x65, 0xc0,
-  0x77, 0xdc, 0xd6, 0x65, 0x96, 0xaf, 0x49, 0xc0, 0x57, 0xcd, 0x65, 0x05,
-  0x0c, 0x14, 0xc2, 0x23, 0x66, 0x25, 0x2f, 0x4d, 0xf4, 0xff, 0xeb, 0xc6,
-  0xac, 0xfe, 0x8f, 0x47, 0xc0, 0x7c, 0x32, 0xbb, 0xe0, 0xb1, 0xc7, 0x9a,
-  0x53, 0x26, 0x33, 0xdd, 0x6c, 0x2e, 0x45, 0x85, 0xc0, 0xcf, 0xd8, 0x8a,
-  0x86, 0x90, 0x6d, 0x94, 0x60, 0x3f, 0x2d, 0x9a, 0x04, 0x3c, 0x5a, 0x27,
-  0x7a, 0x0f, 0x86, 0x1e, 0xe0, 0x96, 0x6a, 0x92, 0x4e, 0xb6, 0xea, 0xfc,
-  0x82, 0xad, 0x48, 0x2a, 0x95, 0x89, 0xe7, 0xc0, 0x6e, 0x76, 0x60, 0xc9,
-  0xaa, 0x92, 0xb4, 0x82, 0xba, 0x9d, 0xf0, 0xae, 0x30, 0xf6, 0x8d, 0xfc,
-  0x3f, 0xbb, 0xf7, 0x12, 0x76, 0xb1, 0x0b, 0x65, 0x46, 0x95, 0xa9, 0x9a,
-  0xad, 0xae, 0x09, 0x4a, 0xa3, 0xbe, 0x11, 0x5d, 0x69, 0x35, 0x81, 0xf0,
-  0x5f, 0xf5, 0x95, 0x24, 0x19, 0xbf, 0xff, 0x9d, 0xfc, 0x79, 0x2c, 0x3d,
-  0xa3, 0xbb, 0x22, 0x85, 0xf0, 0xe1, 0x44, 0xd5, 0x43, 0x24, 0xe0, 0x6b,
-  0xe5, 0xca, 0x04, 0x5c, 0xca, 0x8e, 0xa6, 0xec, 0x19, 0x8e, 0x75, 0x1a,
-  0x5e, 0x01, 0x73, 0x85, 0x2d, 0x55, 0x8e, 0x09, 0xce, 0x5b, 0x09, 0x45,
-  0x0a, 0x7b, 0xaa, 0xe2, 0x3f, 0x95, 0x29, 0xf9, 0x04, 0x3c, 0x42, 0x63,
-  0xd3, 0x54, 0xd9, 0xa8, 0x2e, 0xc8, 0x75, 0x78, 0x8b, 0x7f, 0x6d, 0x65,
-  0x23, 0x56, 0x67, 0x33, 0x01, 0x76, 0x73, 0xdd, 0x69, 0xbb, 0xe6, 0xaa,
-  0x9e, 0x31, 0x0c, 0x56, 0xf7, 0xc7, 0xe4, 0x37, 0xb7, 0xa6, 0xb7, 0x59,
-  0x0e, 0x13, 0xfd, 0x77, 0x22, 0x73, 0x04, 0xb3, 0x5f, 0x02, 0xe5, 0x94,
-  0x04, 0x34, 0xa4, 0xba, 0x6c, 0xa4, 0x47, 0x6c, 0xdf, 0x8d, 0x75, 0x1d,
-  0x41, 0x02, 0xbe, 0x66, 0xae, 0x4c, 0xc0, 0xf5, 0xbf, 0x64, 0xc0, 0x73,
-  0xb9, 0x44, 0xd3, 0x3b, 0x91, 0x8c, 0x4f, 0xc0, 0x31, 0x48, 0x30, 0x57,
-  0x49, 0xe9, 0x2e, 0x69, 0x21, 0x4f, 0x9a, 0xf2, 0x1e, 0x74, 0x09, 0x84,
-  0x14, 0x89, 0x08, 0xf6, 0x09, 0x18, 0x6f, 0x11, 0x4b, 0x6c, 0x11, 0x68,
-  0xf1, 0xb0, 0x43, 0x73, 0x9d, 0x5d, 0x21, 0x7f, 0x91, 0x76, 0xef, 0x0c,
-  0x79, 0xe9, 0x3f, 0x13, 0xd9, 0x68, 0x1b, 0xbf, 0xf0, 0x1e, 0x7b, 0x34,
-  0x7f, 0xc0, 0x1a, 0x8e, 0x23, 0x3c, 0x26, 0x76, 0x38, 0xa6, 0xee, 0xb5,
-  0xd4, 0xeb, 0x48, 0x0b, 0x2c, 0xe0, 0x42, 0x5f, 0x9f, 0x56, 0xa0, 0xbd,
-  0xd5, 0x15, 0x93, 0xf0, 0x1d, 0xa8, 0x6c, 0x48, 0xc0, 0x57, 0xcd, 0x65,
-  0x05, 0x2c, 0x36, 0x72, 0x54, 0x4e, 0x01, 0xf3, 0x76, 0x81, 0x69, 0xf8,
-  0x11, 0x1d, 0x37, 0x04, 0xbc, 0x03, 0x09, 0x6a, 0x40, 0x80, 0xcf, 0xf8,
-  0xe9, 0x52, 0x51, 0x3a, 0x27, 0x3d, 0x12, 0xf7, 0x09, 0x18, 0x2f, 0xde,
-  0xac, 0x6c, 0x01, 0xaf, 0x8d, 0x6c, 0x75, 0x76, 0x3b, 0x59, 0xa1, 0x48,
-  0xbb, 0x79, 0x4f, 0x57, 0x25, 0x56, 0x1a, 0x57, 0x82, 0x41, 0xb0, 0x4c,
-  0x89, 0x6d, 0x8a, 0xe6, 0x1a, 0x86, 0xae, 0x8c, 0x8d, 0xd3, 0x5d, 0x02,
-  0x7e, 0x06, 0x93, 0xc8, 0x4a, 0xc0, 0x4b, 0x70, 0xfe, 0xa2, 0x14, 0xdd,
-  0x87, 0x91, 0xcb, 0x77, 0xc0, 0x47, 0x24, 0xe0, 0xab, 0xe6, 0xca, 0x26,
-  0xb1, 0xea, 0x7f, 0xe9, 0x78, 0x5c, 0xa9, 0x90, 0xba, 0xad, 0xfc, 0x02,
-  0x2e, 0x40, 0x82, 0x1a, 0x10, 0x72, 0x09, 0x97, 0x52, 0x2a, 0x14, 0x65,
-  0x09, 0x78, 0xe7, 0x15, 0xb0, 0x11, 0xb7, 0xa0, 0xe9, 0x93, 0x17, 0xc4,
-  0xb6, 0x80, 0xb7, 0xfc, 0xa7, 0x95, 0xec, 0xe7, 0x22, 0x01, 0xeb, 0x14,
-  0x8d, 0x69, 0x77, 0x97, 0x80, 0xab, 0x62, 0xe6, 0xfa, 0x79, 0x7c, 0x58,
-  0xc0, 0x68, 0x0e, 0x39, 0x43, 0xe7, 0x54, 0x55, 0xc1, 0xe7, 0xbd, 0x1f,
-  0xee, 0x54, 0x42, 0x96, 0xef, 0x48, 0xc0, 0xa1, 0x70, 0xd5, 0x02, 0xae,
-  0x32, 0x25, 0xe1, 0xad, 0x5f, 0xc0, 0x30, 0x41, 0xcd, 0x52, 0x27, 0x9d,
-  0xf3, 0x04, 0xd6, 0x42, 0x51, 0xb9, 0x29, 0x60, 0x7f, 0x0b, 0x6c, 0xc4,
-  0xed, 0x3a, 0x72, 0x77, 0xa1, 0xb1, 0x80, 0x0b, 0x9e, 0xdd, 0x1c, 0xad,
-  0xe0, 0x48, 0x01, 0x83, 0xe5, 0xa2, 0x16, 0x02, 0xae, 0xaa, 0x9d, 0xaa,
-  0x21, 0xb4, 0xaf, 0x0e, 0xb7, 0xc0, 0xcc, 0xd0, 0xd1, 0x3a, 0xe5, 0xfe,
-  0x33, 0x05, 0x5c, 0xe5, 0x23, 0x9d, 0x6d, 0xbd, 0x9e, 0x65, 0xfb, 0x8e,
-  0x04, 0x1c, 0x0a, 0x03, 0x08, 0x38, 0x77, 0x6e, 0x58, 0x6c, 0x25, 0xe0,
-  0xaa, 0x2a, 0x53, 0xae, 0xe1, 0xe9, 0x41, 0x01, 0x37, 0x54, 0x19, 0x13,
-  0x16, 0x94, 0x73, 0x34, 0xd5, 0x93, 0x23, 0x2b, 0xda, 0x09, 0xd8, 0x31,
-  0x06, 0x66, 0xcd, 0xed, 0x0a, 0x9f, 0x36, 0x63, 0x93, 0xcd, 0x91, 0x1c,
-  0x68, 0x4a, 0xbb, 0xb7, 0xd0, 0x5a, 0xb9, 0x45, 0xcc, 0x69, 0x2f, 0x3a,
-  0xb1, 0x10, 0x1a, 0xd6, 0x35, 0xd2, 0x61, 0x01, 0xab, 0x3b, 0x54, 0xd3,
-  0x63, 0x78, 0xbf, 0xb4, 0x5e, 0xcf, 0x5e, 0xeb, 0x29, 0x39, 0x34, 0xd0,
-  0xd6, 0x3e, 0x22, 0x01, 0x5f, 0x35, 0xbd, 0x0b, 0x38, 0xfb, 0x2f, 0x56,
-  0x5c, 0xcf, 0xbb, 0xb4, 0x14, 0x30, 0x98, 0x2a, 0x3e, 0x20, 0x60, 0xb5,
-  0xcd, 0xca, 0x66, 0xc5, 0x36, 0x24, 0x45, 0x68, 0x9b, 0xd2, 0x4e, 0x25,
-  0x3d, 0xf2, 0xcf, 0x42, 0x1b, 0x71, 0xcb, 0x86, 0xb5, 0x63, 0x74, 0x7f,
-  0x59, 0x64, 0xee, 0xc2, 0xe0, 0x4a, 0x1d, 0xa7, 0x6a, 0xc0, 0xab, 0xb6,
-  0x2a, 0xbb, 0x1a, 0x52, 0xe7, 0x73, 0x86, 0x86, 0xd2, 0xf9, 0x50, 0x42,
-  0xbf, 0xd3, 0x63, 0x6d, 0xe4, 0x69, 0x39, 0x46, 0x4f, 0x8d, 0x7b, 0x04,
-  0x3c, 0x8f, 0xa2, 0xd1, 0x32, 0x8e, 0x97, 0xdb, 0x02, 0xf8, 0x0e, 0x3d,
-  0xb2, 0x1c, 0x29, 0xe3, 0x80, 0x23, 0xc2, 0x7b, 0xef, 0xc2, 0x9f, 0x4f,
-  0xef, 0x02, 0x1e, 0x7b, 0xc2, 0xb4, 0x85, 0x80, 0x73, 0xfe, 0x2a, 0xb8,
-  0x42, 0xfc, 0xb2, 0x93, 0x91, 0x74, 0xe7, 0x14, 0x30, 0x57, 0x17, 0x6f,
-  0xed, 0x53, 0x3c, 0x6d, 0xcb, 0x74, 0xba, 0x55, 0x8a, 0x62, 0x7a, 0xa8,
-  0x57, 0x7f, 0xf9, 0x50, 0x51, 0xad, 0x3d, 0xef, 0xe4, 0x06, 0x42, 0x9f,
-  0x80, 0x0b, 0x15, 0xd6, 0x3b, 0x69, 0x3e, 0x9f, 0x67, 0xe2, 0xb1, 0x5f,
-  0xa4, 0xe0, 0xb4, 0xa5, 0x6a, 0x99, 0xd5, 0xfd, 0xb0, 0x8a, 0x63, 0xa1,
-  0xd6, 0x81, 0x13, 0x65, 0x46, 0x55, 0x3d, 0xa3, 0x5e, 0x8a, 0xba, 0xad,
-  0x34, 0xd3, 0xb7, 0xa6, 0x6d, 0xe1, 0x35, 0xc1, 0x46, 0xdd, 0xa8, 0x25,
-  0xe0, 0x4c, 0x0a, 0x9e, 0xdf, 0x8e, 0x25, 0xe0, 0xc4, 0xd8, 0x38, 0x02,
-  0x77, 0xab, 0x09, 0xdf, 0x31, 0x87, 0xdc, 0x56, 0xd0, 0x23, 0xbb, 0xb1,
-  0xdc, 0xb7, 0x45, 0x5c, 0x0f, 0x7d, 0x0b, 0x98, 0x07, 0x9b, 0xe3, 0x59,
-  0x37, 0x76, 0x7c, 0xbe, 0xe0, 0xac, 0x5d, 0x02, 0xce, 0xc7, 0xd1, 0x74,
-  0xb3, 0x2f, 0xf6, 0x4c, 0x65, 0x13, 0x79, 0xc6, 0xf3, 0x8b, 0xd8, 0x20,
-  0x5c, 0x99, 0x4d, 0x15, 0xd3, 0xc7, 0xf4, 0x25, 0xcf, 0x9f, 0x17, 0xe6,
-  0x2b, 0xa8, 0x6a, 0x95, 0xcd, 0x95, 0xa2, 0xb8, 0xe8, 0x6e, 0x5f, 0x5e,
-  0x6e, 0x55, 0x2d, 0xc2, 0xdb, 0xb8, 0x17, 0x31, 0x77, 0xeb, 0x13, 0x30,
-  0xbf, 0xab, 0xf1, 0xe3, 0xfe, 0x61, 0xac, 0xae, 0xe4, 0x52, 0xae, 0xed,
-  0x7c, 0x18, 0xcb, 0x0a, 0x69, 0x22, 0xfa, 0xa7, 0x5c, 0xd0, 0x4a, 0x3b,
-  0xbc, 0x2b, 0x31, 0xbd, 0xdb, 0xdc, 0xf2, 0x27, 0x0a, 0xd8, 0x69, 0x8b,
-  0x97, 0x7c, 0xff, 0x3c, 0x65, 0x5a, 0xc1, 0xbe, 0xe1, 0x69, 0x2f, 0x9e,
-  0xf7, 0xc5, 0xcb, 0x3c, 0xc2, 0xfd, 0x74, 0xde, 0xa7, 0x9e, 0x3f, 0x6c,
-  0xe6, 0xac, 0x02, 0xb0, 0x04, 0xcc, 0x27, 0xb8, 0x1f, 0x73, 0x7e, 0xa1,
-  0x31, 0x03, 0x28, 0xae, 0x1f, 0x3f, 0xd4, 0x2f, 0x3d, 0x7a, 0x29, 0x80,
-  0xef, 0xe6, 0xdc, 0x77, 0xac, 0x4e, 0xe1, 0xb7, 0x75, 0xbb, 0x7f, 0x54,
-  0x1e, 0xe1, 0xb5, 0x57, 0x78, 0x0f, 0x7e, 0xfe, 0xe1, 0xf4, 0xde, 0x02,
-  0xb3, 0x62, 0x77, 0xf4, 0x6c, 0x23, 0x48, 0xec, 0x10, 0x70, 0x8e, 0xf6,
-  0x1d, 0xef, 0xe0, 0xa2, 0x8a, 0x5b, 0xc0, 0x68, 0x5a, 0x17, 0xbf, 0xa4,
-  0x47, 0x2e, 0x48, 0x89, 0x26, 0x72, 0x6b, 0x9d, 0x89, 0x8e, 0xf8, 0x05,
-  0x6c, 0xcc, 0x1c, 0x67, 0xea, 0x4e, 0x05, 0xa2, 0x03, 0x20, 0xd6, 0x96,
-  0xc4, 0x92, 0x91, 0xd6, 0xce, 0x52, 0x9f, 0x39, 0x2f, 0x8d, 0x27, 0x23,
-  0xa0, 0x8b, 0xc4, 0x6d, 0xe1, 0x27, 0x27, 0x80, 0x74, 0x0a, 0xe0, 0x89,
-  0xc4, 0x35, 0xb6, 0x98, 0xa1, 0x2b, 0x6b, 0xe7, 0x21, 0x01, 0xaf, 0xc0,
-  0x6f, 0x8b, 0xdc, 0xba, 0x31, 0xb5, 0x3b, 0x0c, 0x79, 0x24, 0x85, 0x1e,
-  0x24, 0xae, 0x85, 0xde, 0x05, 0xbc, 0x15, 0x8f, 0x22, 0x58, 0x19, 0x1b,
-  0xf1, 0x61, 0x09, 0xb8, 0x84, 0xca, 0x58, 0xa9, 0x1f, 0xea, 0xb3, 0xd7,
-  0x91, 0x4b, 0xc0, 0x55, 0xaa, 0xe3, 0x7a, 0x84, 0xdb, 0xfc, 0x1d, 0x52,
-  0x14, 0x9a, 0x3b, 0x16, 0x8d, 0xb2, 0x8c, 0xd7, 0xdd, 0xac, 0x49, 0xc0,
-  0x2a, 0xf4, 0x27, 0x7a, 0xf3, 0x54, 0x09, 0x64, 0x19, 0xf3, 0x51, 0x22,
-  0xef, 0x76, 0xa0, 0x65, 0xd7, 0xc4, 0x3c, 0x95, 0xf9, 0x06, 0x18, 0x0c,
-  0x3b, 0xa7, 0xe2, 0xb6, 0x32, 0x58, 0x63, 0xa1, 0xce, 0x2b, 0x98, 0x46,
-  0x9e, 0xb8, 0x04, 0x9c, 0xcb, 0x5f, 0x97, 0xec, 0xce, 0x4b, 0x43, 0xc0,
-  0x70, 0x16, 0x3a, 0x1a, 0xe7, 0x4e, 0xdf, 0xa9, 0x73, 0x76, 0x23, 0xee,
-  0x08, 0x9e, 0x26, 0x0d, 0x83, 0xaf, 0x8c, 0xfe, 0x5f, 0x2b, 0x9b, 0x27,
-  0xfe, 0x89, 0x9a, 0x26, 0x01, 0x57, 0xd5, 0x4e, 0xaa, 0x6a, 0xc2, 0x53,
-  0x28, 0x79, 0xcb, 0xb6, 0xe6, 0x8d, 0x41, 0x65, 0xcf, 0xf6, 0x28, 0x81,
-  0x98, 0x6f, 0x94, 0x2a, 0xa1, 0x58, 0x99, 0x51, 0xa2, 0x8d, 0x9a, 0xa5,
-  0xe8, 0x80, 0x78, 0x90, 0xd9, 0x2f, 0x60, 0x51, 0x15, 0xcc, 0xca, 0x3c,
-  0xd2, 0x43, 0x78, 0xa9, 0xc3, 0x89, 0x1a, 0xd2, 0x4f, 0xa0, 0xe6, 0xa0,
-  0x76, 0xb6, 0xe2, 0x96, 0x96, 0xdc, 0xc0, 0x42, 0x56, 0x52, 0x89, 0x73,
-  0x0c, 0x5c, 0x26, 0x52, 0x45, 0xb1, 0x21, 0x9c, 0x72, 0x35, 0xd2, 0x62,
-  0x73, 0xcc, 0xee, 0x65, 0x13, 0x79, 0xc3, 0x5b, 0x5e, 0x91, 0x18, 0xb3,
-  0xd0, 0xb0, 0x0d, 0x9e, 0x62, 0x53, 0x56, 0xc2, 0x14, 0xa1, 0x60, 0xed,
-  0x91, 0x15, 0x5e, 0x9c, 0x23, 0xae, 0x82, 0xeb, 0x7e, 0x2f, 0x74, 0x91,
-  0x26, 0x49, 0x02, 0x66, 0xa4, 0xf2, 0xdd, 0xf6, 0xc0, 0x6b, 0x6c, 0xf2,
-  0x34, 0x49, 0x5d, 0xad, 0xc4, 0x0e, 0x08, 0x8e, 0x51, 0x66, 0x5b, 0x74,
-  0x66, 0x99, 0x6d, 0x77, 0xad, 0x9a, 0x97, 0x6c, 0x9b, 0x5a, 0x03, 0xc1,
-  0x32, 0xdb, 0x6e, 0xb3, 0x76, 0xaf, 0x91, 0xcc, 0xd3, 0x04, 0x9d, 0x9a,
-  0xed, 0x92, 0xac, 0x61, 0x60, 0x99, 0xef, 0x92, 0x24, 0x71, 0x25, 0x5d,
-  0x66, 0x3b, 0xf7, 0x9d, 0xaa, 0x74, 0x85, 0xab, 0xca, 0xcc, 0x79, 0x56,
-  0x99, 0x65, 0x59, 0xc6, 0x7b, 0x22, 0xd2, 0x2d, 0xa6, 0xef, 0x8a, 0xdd,
-  0x16, 0x5d, 0x9a, 0xb9, 0xab, 0x62, 0xe2, 0x92, 0x5c, 0xb7, 0x80, 0x3b,
-  0xa3, 0x9c, 0x7a, 0x7a, 0xf2, 0x7f, 0x21, 0x59, 0x3d, 0x7b, 0x25, 0xfe,
-  0xad, 0x9e, 0xd4, 0x22, 0x02, 0xe5, 0xef, 0x10, 0x30, 0x9f, 0x8e, 0xa5,
-  0x35, 0x10, 0x46, 0x02, 0xc6, 0xb2, 0x73, 0x1a, 0xd7, 0x06, 0xce, 0x5f,
-  0x20, 0xe0, 0xec, 0x6e, 0x6a, 0x8c, 0x80, 0xff, 0x6e, 0xf8, 0x82, 0xf9,
-  0xe6, 0x65, 0xff, 0xc2, 0xdf, 0x9c, 0x35, 0x6a, 0x71, 0x0d, 0x71, 0xad,
-  0xfc, 0x05, 0x02, 0x16, 0x53, 0xce, 0x34, 0xff, 0x22, 0xc1, 0xcb, 0x71,
-  0x23, 0x6a, 0x80, 0x43, 0xe6, 0x2f, 0x10, 0x30, 0xdf, 0x2f, 0x99, 0xb4,
-  0x9b, 0x63, 0xfa, 0x1b, 0xc8, 0xe1, 0x1a, 0xef, 0x84, 0x06, 0x16, 0x41,
-  0xf3, 0x17, 0x08, 0x38, 0x8b, 0x66, 0xcb, 0x2d, 0xc9, 0x17, 0xb2, 0x5b,
-  0x31, 0x0d, 0x8f, 0xe2, 0xd5, 0x95, 0xbc, 0x9b, 0x9e, 0x38, 0x95, 0xbf,
-  0x40, 0xc0, 0x04, 0xf1, 0xe7, 0x42, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01,
-  0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11,
-  0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09,
-  0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88,
-  0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48,
-  0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41,
-  0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43,
-  0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09,
-  0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18,
-  0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0xf8, 0xd2, 0x94, 0x77, 0xe3, 0xe9,
-  0xe3, 0xa5, 0x8d, 0x20, 0x42, 0x85, 0x04, 0x7c, 0x14, 0xe5, 0xfe, 0xfc,
-  0x37, 0xc4, 0x17, 0x7b, 0xf4, 0xe7, 0x6d, 0xfd, 0x8a, 0xf5, 0xed, 0x19,
-  0x09, 0xfc, 0xf1, 0xec, 0x1b, 0x3e, 0xbf, 0xfa, 0xd7, 0x43, 0x02, 0x6e,
-  0xcf, 0x7a, 0x6e, 0x7c, 0x63, 0xf8, 0x04, 0x16, 0x63, 0xf4, 0x49, 0x72,
-  0xf9, 0x51, 0xee, 0x79, 0xfb, 0x04, 0xa6, 0x66, 0x02, 0x7f, 0x34, 0xcc,
-  0xe7, 0x49, 0x8b, 0x13, 0xff, 0x56, 0xfa, 0x88, 0x85, 0xe2, 0xa1, 0x0e,
-  0xb2, 0xf1, 0x5d, 0x63, 0xac, 0xef, 0x6b, 0xc2, 0xfa, 0xe0, 0x49, 0x6c,
-  0x7e, 0x24, 0xfc, 0x04, 0x98, 0x5c, 0xed, 0x23, 0xf1, 0x19, 0x09, 0xfc,
-  0xd1, 0x30, 0x9f, 0xb7, 0x14, 0x70, 0xc9, 0x62, 0x4a, 0xb4, 0xd7, 0xe8,
-  0x8f, 0x3f, 0x98, 0x1e, 0x62, 0x61, 0xa3, 0x3e, 0x9c, 0x75, 0xd7, 0x20,
-  0xd0, 0xa8, 0x03, 0x35, 0x0c, 0x44, 0x21, 0xa2, 0xa0, 0x1f, 0x01, 0xaf,
-  0xd0, 0xa7, 0x8b, 0x0f, 0xf6, 0x8e, 0xdb, 0x0b, 0x18, 0x26, 0x55, 0x9c,
-  0x5a, 0x55, 0x16, 0x17, 0x52, 0x40, 0x09, 0x7d, 0xde, 0x52, 0xc0, 0x19,
-  0x8f, 0xba, 0x35, 0xfb, 0x63, 0xc7, 0xff, 0xf8, 0xe3, 0x1b, 0xef, 0xee,
-  0x05, 0x7c, 0x0b, 0x3e, 0x7d, 0xb7, 0x68, 0xc8, 0x38, 0x0c, 0x01, 0xaf,
-  0x17, 0x3a, 0x0a, 0xfa, 0x11, 0x70, 0x95, 0xc4, 0x71, 0xca, 0xfe, 0xd1,
-  0xaa, 0x77, 0xdc, 0x4e, 0xc0, 0x30, 0x29, 0x76, 0x0b, 0xa7, 0x98, 0x0d,
-  0xef, 0x7d, 0x48, 0x76, 0xf5, 0x38, 0x03, 0xfa, 0xfc, 0x38, 0x01, 0xf3,
-  0xde, 0xcc, 0x3a, 0xfa, 0x3b, 0x3e, 0x0a, 0xdd, 0xb9, 0x80, 0xf9, 0xd7,
-  0x78, 0x27, 0xe2, 0x0b, 0x96, 0xfe, 0x6f, 0x57, 0x76, 0x20, 0xe0, 0xc7,
-  0x01, 0x7a, 0xe0, 0x30, 0x80, 0x7a, 0x12, 0x70, 0xab, 0xdf, 0x8e, 0x3b,
-  0x09, 0x9d, 0x75, 0xb2, 0xd9, 0xc7, 0x88, 0xa7, 0x4b, 0x12, 0xd3, 0xe7,
-  0x2d, 0x6d, 0x10, 0x1f, 0x82, 0x8e, 0xf4, 0x85, 0xc7, 0x8c, 0x4d, 0x02,
-  0xa5, 0x73, 0x01, 0x97, 0xcb, 0x28, 0x8a, 0x8b, 0xaa, 0x2a, 0x98, 0x84,
-  0xa7, 0xfe, 0x8c, 0xcf, 0x54, 0x43, 0xf9, 0x38, 0x6d, 0xa8, 0x1e, 0x3a,
-  0x83, 0x04, 0x7c, 0xc2, 0x85, 0x67, 0x72, 0xae, 0x80, 0xd9, 0x17, 0xcb,
-  0x23, 0x12, 0xf0, 0xa9, 0x6c, 0x79, 0xb7, 0x25, 0x6d, 0x0e, 0x35, 0xa7,
-  0x80, 0xf7, 0x2f, 0x9b, 0x67, 0x6b, 0x14, 0x58, 0xbe, 0x6c, 0x1e, 0xc1,
-  0xc1, 0x7c, 0xbf, 0xd9, 0x6c, 0xee, 0xea, 0xc9, 0xc9, 0x68, 0x69, 0xa5,
-  0x9a, 0x3f, 0x6e, 0xcc, 0x99, 0xb1, 0xe2, 0x79, 0x23, 0xb2, 0xc9, 0x5f,
-  0x36, 0xcf, 0xf0, 0x73, 0xf4, 0x65, 0x9d, 0xd2, 0x4b, 0x09, 0x2f, 0xc6,
-  0x27, 0x78, 0x04, 0x9c, 0x6f, 0x50, 0x26, 0x66, 0xb2, 0x8d, 0x08, 0xa7,
-  0x94, 0xae, 0x1b, 0x35, 0x1d, 0xe6, 0x4c, 0x58, 0x9c, 0x54, 0x3c, 0x43,
-  0xcb, 0x7d, 0xd9, 0x20, 0xb3, 0x25, 0xe5, 0xfe, 0x79, 0xf3, 0x62, 0xa5,
-  0x5b, 0x3c, 0x37, 0xde, 0x3b, 0xc3, 0x79, 0xa1, 0x32, 0xd5, 0x2e, 0xb8,
-  0xe7, 0xcd, 0x0b, 0x1c, 0x42, 0x97, 0x7b, 0xbb, 0x74, 0xea, 0x93, 0x1e,
-  0x8d, 0x2b, 0x5d, 0x02, 0x76, 0xf8, 0xdc, 0xca, 0xaf, 0xbe, 0x6e, 0x24,
-  0xd6, 0xe4, 0x72, 0xf1, 0x6f, 0x25, 0x60, 0x5f, 0xe6, 0xed, 0x8b, 0xee,
-  0x3a, 0xe9, 0x6f, 0x42, 0x33, 0x3f, 0x5a, 0xc0, 0x9b, 0xa9, 0x18, 0x39,
-  0x17, 0xfa, 0x94, 0x75, 0xb5, 0xa9, 0x17, 0x5e, 0xa2, 0xb9, 0xf0, 0xf3,
-  0xf3, 0x14, 0x0c, 0xb1, 0x23, 0x55, 0x20, 0x6c, 0xf8, 0x93, 0xe5, 0x0b,
-  0x76, 0xf4, 0x4e, 0x5f, 0x9e, 0x56, 0x0f, 0x52, 0xe8, 0xe9, 0x9c, 0x5f,
-  0xf3, 0x20, 0x2e, 0x29, 0xe4, 0x60, 0xfd, 0x96, 0x25, 0x5d, 0xf2, 0x7c,
-  0xa2, 0x68, 0xfa, 0x6c, 0x18, 0x19, 0x49, 0x53, 0xb9, 0x12, 0x52, 0x66,
-  0xc1, 0x54, 0x9a, 0x2e, 0x93, 0xdd, 0xc0, 0x3b, 0x99, 0xc9, 0x9b, 0x4b,
-  0x22, 0x31, 0xab, 0x92, 0x8b, 0x0a, 0x87, 0x3b, 0x85, 0xe7, 0xb5, 0x60,
-  0xe6, 0x8b, 0x70, 0x4d, 0x74, 0x56, 0x31, 0x4a, 0xf8, 0x01, 0x47, 0x1d,
-  0xbf, 0xef, 0x07, 0xf6, 0xbf, 0x79, 0xa9, 0x0f, 0x79, 0x92, 0xca, 0xc0,
-  0x2d, 0x30, 0xb7, 0x96, 0x77, 0x63, 0x94, 0x2e, 0xf7, 0x5c, 0xc9, 0x9d,
-  0x71, 0x5b, 0x1a, 0x19, 0xa9, 0x7b, 0xaf, 0xaa, 0xf2, 0x01, 0x5f, 0x08,
-  0x78, 0x74, 0x14, 0xdc, 0x52, 0xda, 0x28, 0x05, 0x22, 0x33, 0x96, 0x9e,
-  0xab, 0xff, 0xbd, 0x13, 0x27, 0x2d, 0xdc, 0xf9, 0xa6, 0x52, 0xc0, 0x19,
-  0xcb, 0x60, 0x9c, 0xca, 0xd2, 0x5e, 0x38, 0x2d, 0x59, 0xd6, 0xd9, 0x8a,
-  0x71, 0x6f, 0x3d, 0x87, 0x15, 0xeb, 0x00, 0x94, 0x99, 0x0b, 0x6b, 0x32,
-  0x98, 0x39, 0xbf, 0x69, 0x75, 0xa3, 0xb0, 0xfa, 0x08, 0x80, 0xfe, 0x04,
-  0x9c, 0x45, 0xd1, 0x51, 0x02, 0x2e, 0x17, 0xaa, 0xe0, 0xc6, 0x1b, 0x75,
-  0x4a, 0x7c, 0x27, 0x8e, 0xf1, 0xce, 0xb8, 0x9e, 0x21, 0x1b, 0xad, 0x92,
-  0xad, 0xae, 0x3c, 0x59, 0x66, 0x4b, 0x11, 0x61, 0xa0, 0x48, 0x92, 0x9d,
-  0x2c, 0x0e, 0x3d, 0x37, 0xce, 0x0b, 0x31, 0x1f, 0xab, 0x03, 0x75, 0xa0,
-  0x94, 0x73, 0x53, 0x40, 0x15, 0x0e, 0xa6, 0x52, 0x04, 0x93, 0xb4, 0x67,
-  0xcc, 0x83, 0xe7, 0xc1, 0x48, 0x96, 0xc3, 0x66, 0x50, 0xb6, 0xb2, 0x01,
-  0x89, 0x65, 0x7f, 0x24, 0x11, 0x29, 0xca, 0x34, 0xd8, 0x1c, 0x9f, 0xad,
-  0x3a, 0x36, 0x8d, 0xaa, 0xed, 0x9d, 0xa2, 0x36, 0x82, 0xe7, 0x25, 0xf3,
-  0xd4, 0xb1, 0xe7, 0x49, 0x0a, 0x0a, 0xd8, 0xb8, 0x6d, 0xae, 0x24, 0x76,
-  0xc2, 0x5a, 0x26, 0xb8, 0x36, 0x32, 0x02, 0x17, 0xea, 0x9a, 0x53, 0x09,
-  0x49, 0x14, 0x9c, 0x2e, 0x14, 0x50, 0x70, 0x33, 0x99, 0xe4, 0x98, 0x9b,
-  0x9f, 0x6b, 0x07, 0x3f, 0xa8, 0x93, 0x56, 0xf2, 0xe0, 0xc2, 0x99, 0xaf,
-  0xac, 0x34, 0xd5, 0xa5, 0xbc, 0x82, 0xd8, 0x79, 0x5c, 0x53, 0x9f, 0xbb,
-  0x12, 0xa1, 0x52, 0x97, 0x40, 0x22, 0x6d, 0x87, 0xc6, 0x6f, 0xec, 0x9b,
-  0x5e, 0x55, 0x24, 0x60, 0x07, 0xcc, 0x11, 0x76, 0x27, 0x57, 0x65, 0x1c,
-  0x19, 0x02, 0xd6, 0xfa, 0x95, 0x3f, 0x44, 0x88, 0x7a, 0xc0, 0xbb, 0x65,
-  0xff, 0x1a, 0xb1, 0x06, 0x0e, 0xad, 0x51, 0x65, 0xf6, 0xb9, 0xbc, 0x01,
-  0x67, 0xf1, 0x9a, 0xca, 0x2b, 0x27, 0x23, 0x19, 0x2d, 0x25, 0xd0, 0xef,
-  0xa4, 0xac, 0x60, 0xd0, 0x83, 0xa1, 0x35, 0x38, 0xa8, 0xe7, 0x45, 0x04,
-  0x6b, 0x75, 0x93, 0x20, 0x59, 0x81, 0xaa, 0x36, 0xa6, 0xf2, 0xda, 0x44,
-  0xdc, 0x15, 0xb6, 0x33, 0xaf, 0x5c, 0xaa, 0x4b, 0x2a, 0x6c, 0x2f, 0x9a,
-  0x48, 0xc0, 0x09, 0xe8, 0xd8, 0xab, 0xdc, 0x49, 0x01, 0xc7, 0xd4, 0xf5,
-  0x48, 0x01, 0x6e, 0x9b, 0xd7, 0x41, 0x86, 0xe7, 0x4a, 0x47, 0x46, 0x13,
-  0xc3, 0x5f, 0x52, 0x48, 0x02, 0xb8, 0xec, 0xe0, 0x2a, 0x38, 0xb6, 0x49,
-  0xa5, 0xe4, 0x9e, 0x60, 0x25, 0xa7, 0x8b, 0x07, 0x7b, 0xe2, 0xb0, 0xcf,
-  0x79, 0x57, 0xca, 0xe7, 0x9a, 0xfa, 0xdc, 0x38, 0x56, 0x95, 0x6d, 0xac,
-  0x04, 0x2c, 0x8c, 0x9f, 0x29, 0x0b, 0x8d, 0x9b, 0xce, 0x49, 0xc0, 0x36,
-  0xbc, 0xc4, 0x52, 0xef, 0xef, 0xba, 0xb8, 0x39, 0x3c, 0x62, 0xd7, 0xd9,
-  0x6e, 0xa6, 0x0a, 0x46, 0x84, 0xcf, 0x2e, 0x9d, 0x49, 0x9f, 0xca, 0xe2,
-  0x67, 0x33, 0x64, 0x70, 0x8d, 0x4a, 0x94, 0x48, 0x92, 0xed, 0x46, 0x2a,
-  0x66, 0x60, 0x01, 0xb1, 0xc0, 0x1d, 0xe5, 0x22, 0x9b, 0x9d, 0xf8, 0xff,
-  0x2c, 0x2b, 0xb2, 0xed, 0x84, 0x59, 0xc1, 0x8a, 0x78, 0x9b, 0xe7, 0xe9,
-  0x0a, 0xce, 0x7b, 0x24, 0x09, 0x9b, 0x8a, 0x8b, 0x93, 0x64, 0xa7, 0x82,
-  0x69, 0xb2, 0xcd, 0x98, 0x3d, 0xb1, 0xec, 0x18, 0xd7, 0xc9, 0xae, 0x23,
-  0x24, 0x7c, 0xd9, 0x61, 0x2e, 0x55, 0xbc, 0xaf, 0x84, 0x3a, 0xf8, 0x81,
-  0x78, 0x97, 0x32, 0x3b, 0xeb, 0x46, 0x5a, 0x04, 0x4c, 0x96, 0x70, 0xdd,
-  0x25, 0x49, 0x52, 0x54, 0x86, 0xbd, 0x30, 0x9c, 0x44, 0x24, 0xa7, 0xdc,
-  0x29, 0x4c, 0x83, 0x32, 0xd8, 0x5d, 0x49, 0x15, 0xe2, 0x16, 0x56, 0x49,
-  0x92, 0xca, 0x5a, 0x72, 0xb4, 0xcd, 0xb6, 0x2c, 0xfb, 0xb5, 0xf6, 0xdc,
-  0x32, 0xdd, 0x19, 0x25, 0x82, 0xef, 0x7d, 0x85, 0x2e, 0xbc, 0x05, 0x06,
-  0xa5, 0xbe, 0x82, 0x8b, 0xd3, 0x6c, 0xa9, 0xf4, 0xc1, 0x1c, 0xb4, 0xaa,
-  0xaa, 0x72, 0x86, 0xac, 0x46, 0x9e, 0x90, 0xf9, 0xc6, 0x22, 0xdf, 0x44,
-  0xf9, 0x7c, 0x94, 0x64, 0xb1, 0x2c, 0x57, 0xa6, 0xc6, 0x51, 0x06, 0x6a,
-  0x49, 0xc9, 0x34, 0x12, 0xaa, 0x4d, 0x59, 0xea, 0xeb, 0x44, 0xf8, 0x9e,
-  0x57, 0x31, 0xab, 0xaa, 0xca, 0x27, 0xc2, 0x42, 0xb9, 0xe0, 0x24, 0x6e,
-  0x3a, 0x25, 0x01, 0xdb, 0xdc, 0x46, 0x51, 0xe3, 0x1c, 0xa0, 0x29, 0xe0,
-  0xa9, 0xf4, 0x5b, 0x39, 0x91, 0x62, 0xe0, 0xd5, 0x66, 0x29, 0xa2, 0x38,
-  0x16, 0xba, 0x98, 0xd5, 0x67, 0x27, 0x11, 0xaa, 0xb5, 0x45, 0x89, 0xec,
-  0xd4, 0xd0, 0x3b, 0xd7, 0x02, 0x5e, 0xd7, 0x81, 0xb0, 0x56, 0xa5, 0x22,
-  0xca, 0x10, 0x14, 0x93, 0x6e, 0x34, 0xd8, 0x9f, 0x78, 0xcf, 0x83, 0x35,
-  0x89, 0x55, 0xab, 0x2a, 0x8d, 0x40, 0x47, 0x0d, 0x25, 0x2b, 0x11, 0xf3,
-  0x27, 0x19, 0x9f, 0x49, 0x11, 0x63, 0xb9, 0x99, 0xba, 0x27, 0x78, 0xa9,
-  0xb6, 0x44, 0xdb, 0x00, 0x74, 0x5b, 0x27, 0x3c, 0x36, 0xfd, 0x56, 0x37,
-  0xbc, 0xe5, 0x08, 0xf9, 0xa9, 0xf2, 0x25, 0x05, 0x27, 0xb1, 0x72, 0xe5,
-  0xf5, 0x4c, 0xd6, 0x2c, 0x99, 0x4a, 0x30, 0x8e, 0x8c, 0x75, 0x3f, 0x70,
-  0xef, 0xa5, 0xba, 0x50, 0x27, 0x21, 0x98, 0x7b, 0x0a, 0x8e, 0xb5, 0x96,
-  0x33, 0x99, 0x38, 0x53, 0x5d, 0x29, 0xf5, 0xbe, 0x75, 0x7a, 0x42, 0x62,
-  0x4d, 0x62, 0xd5, 0x3e, 0x57, 0x23, 0x32, 0xed, 0x9a, 0xd8, 0xe1, 0x1a,
-  0x36, 0xe8, 0x4f, 0x98, 0x95, 0x3b, 0xd9, 0xeb, 0x61, 0xc6, 0xd7, 0xdd,
-  0x08, 0xae, 0xf9, 0x9d, 0x75, 0xd3, 0x09, 0x09, 0xd8, 0x62, 0x27, 0x1d,
-  0xef, 0xcd, 0x18, 0xc7, 0x41, 0x2e, 0x03, 0x4a, 0x14, 0xe8, 0x52, 0xcd,
-  0xd7, 0xc8, 0x68, 0x8b, 0x45, 0xa2, 0x2c, 0x30, 0x32, 0x5c, 0x6b, 0xab,
-  0x33, 0x64, 0xcc, 0xa8, 0x30, 0x12, 0x59, 0x4c, 0x55, 0xea, 0x09, 0x4f,
-  0x94, 0xfd, 0x6f, 0xfc, 0x8c, 0xcd, 0xb9, 0xb5, 0xb7, 0x1d, 0x59, 0x02,
-  0x4e, 0xe1, 0xf0, 0x5e, 0x27, 0x2b, 0x5b, 0x58, 0x78, 0x19, 0xcb, 0x2c,
-  0x1e, 0xa9, 0xb1, 0xef, 0x0a, 0xde, 0x93, 0x8a, 0x13, 0xa7, 0xea, 0xe6,
-  0xd8, 0x5e, 0xa0, 0x17, 0x7d, 0xd2, 0x0a, 0xc5, 0x5e, 0xe5, 0x4b, 0x0a,
-  0x0a, 0x78, 0xad, 0x42, 0xb9, 0x92, 0x6a, 0xcb, 0x54, 0xa5, 0x68, 0x09,
-  0x09, 0xdc, 0xfb, 0x4e, 0x5f, 0x38, 0xc3, 0xa7, 0x15, 0xbe, 0x82, 0xcb,
-  0x94, 0x45, 0xb1, 0x90, 0xed, 0x4a, 0xdd, 0x40, 0xec, 0xf4, 0x84, 0xc4,
-  0x12, 0xf0, 0x5a, 0x55, 0x21, 0xd2, 0x35, 0x3a, 0x71, 0xc3, 0x35, 0x71,
-  0xc5, 0xfe, 0x53, 0xab, 0xbc, 0x90, 0xbf, 0xef, 0x64, 0x1a, 0xdc, 0xd8,
-  0xb5, 0x2c, 0xc0, 0x12, 0xde, 0x34, 0x09, 0x18, 0xc1, 0xf5, 0xe8, 0xef,
-  0x40, 0x5b, 0x02, 0xde, 0xea, 0x08, 0x49, 0x51, 0x11, 0x57, 0x40, 0x9e,
-  0x5a, 0xa6, 0xa6, 0x97, 0x81, 0x80, 0x97, 0xa8, 0x48, 0x78, 0xd0, 0xa8,
-  0xd2, 0x57, 0xa5, 0xce, 0x0d, 0x8c, 0xc6, 0x77, 0x2f, 0x95, 0xbe, 0x2a,
-  0x8a, 0x16, 0x8f, 0x86, 0x86, 0x9d, 0xeb, 0xc0, 0x52, 0xc0, 0x85, 0x95,
-  0xac, 0x44, 0x54, 0x13, 0xcb, 0xff, 0x7a, 0xf5, 0x71, 0x1d, 0xd4, 0x65,
-  0x04, 0xdb, 0x1d, 0x74, 0x07, 0x4e, 0xd5, 0x19, 0x09, 0x03, 0x47, 0x1a,
-  0xbf, 0xc4, 0x47, 0x09, 0x18, 0xdc, 0x8d, 0x74, 0x93, 0xdf, 0xa7, 0xf0,
-  0x6c, 0xa5, 0x4d, 0x71, 0x9a, 0xde, 0xe0, 0x94, 0xe9, 0x82, 0xcb, 0x90,
-  0x41, 0x7a, 0x8a, 0x0c, 0x77, 0x78, 0x22, 0xd1, 0x15, 0x76, 0x58, 0x0d,
-  0x9d, 0x67, 0xad, 0x03, 0xcb, 0xf3, 0xbd, 0xae, 0x29, 0x79, 0xf6, 0x71,
-  0xdd, 0x2c, 0xaf, 0xfe, 0xeb, 0x76, 0xab, 0x32, 0x59, 0xe1, 0xcc, 0x63,
-  0x38, 0xc1, 0xaa, 0xf2, 0x22, 0x01, 0x43, 0xf8, 0x5c, 0x67, 0xe3, 0x3e,
-  0x0b, 0x43, 0xc0, 0x2a, 0x1a, 0x81, 0x77, 0x2d, 0x01, 0x73, 0xc1, 0xe4,
-  0xb2, 0xe9, 0x03, 0x95, 0x2f, 0x10, 0xb0, 0x5a, 0xb9, 0x51, 0x27, 0x5b,
-  0x93, 0x16, 0xb5, 0x94, 0xd6, 0xf2, 0xdf, 0xfc, 0x61, 0xdc, 0x5c, 0xfd,
-  0x86, 0x9b, 0xe1, 0x46, 0x01, 0x3b, 0x92, 0x15, 0xa4, 0xfc, 0xd4, 0x29,
-  0xef, 0xc8, 0x4d, 0xc5, 0x62, 0x4d, 0x6b, 0x01, 0x97, 0x46, 0xc2, 0x20,
-  0x9e, 0xf4, 0x49, 0xbb, 0xb3, 0x04, 0x2c, 0xe7, 0x18, 0xdb, 0x09, 0xd8,
-  0xbc, 0x50, 0x8f, 0x8d, 0xb6, 0x91, 0xa7, 0xe0, 0x32, 0x78, 0x68, 0x1d,
-  0x61, 0x4e, 0x17, 0xb0, 0xdf, 0x35, 0x7c, 0x25, 0x82, 0x5d, 0x5d, 0x4f,
-  0x79, 0x2f, 0x55, 0x3a, 0x78, 0x22, 0xac, 0xee, 0x75, 0x93, 0x80, 0x9b,
-  0x69, 0xa1, 0xdf, 0x93, 0x04, 0xcc, 0xeb, 0xd2, 0xf1, 0x1d, 0x5f, 0x30,
-  0x9e, 0x80, 0xd4, 0x4c, 0x01, 0xc7, 0x38, 0x88, 0x4d, 0xa5, 0x29, 0xe1,
-  0x30, 0xd8, 0x2a, 0x64, 0x3e, 0x51, 0x05, 0xec, 0x19, 0x07, 0x1e, 0x16,
-  0xb0, 0xd1, 0xb1, 0x4c, 0xeb, 0x60, 0xcb, 0x6a, 0x9d, 0x71, 0xb1, 0x55,
-  0xad, 0x05, 0xec, 0x4f, 0xd8, 0x3c, 0x69, 0x72, 0x94, 0x80, 0x27, 0x91,
-  0xa5, 0xc3, 0xd3, 0x04, 0xac, 0x7d, 0x0f, 0x0a, 0x4e, 0x75, 0x48, 0x74,
-  0xd9, 0x4a, 0x4f, 0x19, 0x1a, 0x3a, 0x43, 0xc0, 0x7e, 0xd7, 0x64, 0xfc,
-  0xcf, 0xba, 0xee, 0xdc, 0x45, 0x6a, 0x36, 0xde, 0x16, 0x70, 0x44, 0x02,
-  0x3e, 0x40, 0x1b, 0xfd, 0x9e, 0x26, 0xe0, 0x12, 0x94, 0x05, 0x1a, 0x60,
-  0x9b, 0x02, 0x5e, 0xe1, 0x20, 0xd6, 0xed, 0x2b, 0x28, 0xf5, 0x7c, 0x25,
-  0xff, 0x64, 0xe3, 0xa3, 0x72, 0x27, 0x25, 0x3c, 0x06, 0x6d, 0x70, 0xa3,
-  0x80, 0x9d, 0xc9, 0x72, 0xea, 0xb4, 0xd8, 0x1a, 0x0e, 0x3b, 0x29, 0x4b,
-  0xa4, 0x79, 0x76, 0xe4, 0xf8, 0xbb, 0xd0, 0xce, 0x84, 0xf5, 0x49, 0x1d,
-  0xb4, 0xc0, 0xad, 0x05, 0xbc, 0xb4, 0x2f, 0x14, 0xec, 0xa2, 0x36, 0x2d,
-  0x30, 0x5c, 0xa5, 0x33, 0x4b, 0xf7, 0x94, 0x2e, 0xb4, 0xcb, 0x35, 0x42,
-  0xc0, 0x75, 0xad, 0x39, 0x61, 0xf9, 0x8b, 0x03, 0x72, 0x78, 0x04, 0x32,
-  0x27, 0x01, 0x37, 0x61, 0xeb, 0xd7, 0x35, 0x97, 0xa5, 0x0b, 0x99, 0x01,
-  0x14, 0xc8, 0xba, 0x9f, 0x23, 0xa7, 0x80, 0x41, 0x61, 0xcc, 0x50, 0xa2,
-  0xe0, 0x0c, 0x3c, 0xaf, 0x08, 0x73, 0xb3, 0x6c, 0x28, 0xd3, 0x55, 0x04,
-  0x7f, 0xc9, 0xb7, 0x13, 0x53, 0x2f, 0x8d, 0x02, 0xf6, 0x24, 0x2b, 0xed,
-  0x5c, 0x25, 0x6c, 0x7a, 0xa8, 0xee, 0x5b, 0xc7, 0xb2, 0x9a, 0x68, 0x29,
-  0xe0, 0x91, 0x37, 0x61, 0x7d, 0xd2, 0x09, 0x63, 0x60, 0x30, 0x4f, 0xc5,
-  0x1c, 0xb9, 0x6e, 0x2b, 0x60, 0xb0, 0xa8, 0x6f, 0x08, 0x98, 0x5d, 0x3f,
-  0xd7, 0xff, 0x1c, 0xa1, 0xb2, 0xdd, 0x09, 0x43, 0xb6, 0x11, 0xde, 0x25,
-  0x72, 0x86, 0x80, 0x99, 0x6b, 0x5c, 0x0f, 0x39, 0xca, 0xcb, 0x66, 0x48,
-  0xa6, 0x2b, 0x97, 0x24, 0x49, 0xc0, 0x0d, 0x58, 0xfa, 0xdd, 0x44, 0xd1,
-  0xd8, 0xde, 0x4b, 0x6f, 0x08, 0x98, 0x37, 0x66, 0x6c, 0x1a, 0x77, 0x15,
-  0xc1, 0xc9, 0xcc, 0xaa, 0x32, 0x83, 0x6c, 0x19, 0xc7, 0x71, 0x62, 0xd4,
-  0x09, 0x40, 0xc0, 0x2a, 0x7b, 0x18, 0xc4, 0xac, 0x50, 0x5d, 0x73, 0x6a,
-  0x60, 0xf6, 0x9b, 0x11, 0x47, 0xf8, 0x19, 0xb4, 0x66, 0x01, 0x4f, 0xf0,
-  0x4d, 0x00, 0x58, 0x93, 0xbb, 0x64, 0xf7, 0x31, 0x13, 0x9b, 0x7e, 0xf4,
-  0xf6, 0x05, 0x79, 0x82, 0x5f, 0xc0, 0xb1, 0xcf, 0x5e, 0x70, 0x92, 0x94,
-  0xa0, 0x3e, 0xb4, 0x76, 0x25, 0x05, 0x05, 0x0c, 0xc4, 0x37, 0x8d, 0xc0,
-  0x2c, 0xf4, 0x41, 0x01, 0x33, 0x21, 0x4e, 0xf5, 0x85, 0x7a, 0xb4, 0x5f,
-  0x6a, 0x07, 0x3a, 0x66, 0xa1, 0x57, 0x11, 0x68, 0xe7, 0xf1, 0x6b, 0x47,
-  0x4e, 0x15, 0xb0, 0xd7, 0x35, 0xf2, 0x32, 0x3e, 0xde, 0x9e, 0x19, 0x8b,
-  0x17, 0x68, 0x45, 0xb3, 0xa5, 0x80, 0x43, 0x78, 0x75, 0x51, 0xf7, 0x02,
-  0x46, 0x5b, 0x76, 0xc4, 0x92, 0x9c, 0xdc, 0x78, 0x08, 0x33, 0xae, 0x79,
-  0xdc, 0x0b, 0x84, 0x16, 0xb6, 0x6a, 0x07, 0xc8, 0xce, 0x29, 0xe0, 0x02,
-  0xc4, 0x25, 0x82, 0x9d, 0xc1, 0x36, 0xed, 0x6d, 0x55, 0x4d, 0x00, 0x83,
-  0x98, 0x15, 0xaa, 0xd8, 0xf9, 0xf1, 0xcc, 0x6c, 0xc9, 0xf9, 0x8b, 0xe4,
-  0x54, 0xfc, 0x6d, 0x0a, 0x7d, 0x22, 0x10, 0x30, 0x9c, 0x73, 0xb5, 0x05,
-  0xbc, 0xb2, 0x92, 0x85, 0x06, 0x8d, 0xa7, 0x2c, 0x12, 0x56, 0x62, 0x57,
-  0x6e, 0x51, 0xb5, 0x11, 0x70, 0xa1, 0xb3, 0x75, 0x26, 0xac, 0x02, 0x8d,
-  0x5b, 0xae, 0xf6, 0x20, 0x94, 0xb2, 0x32, 0x32, 0x93, 0x82, 0xdd, 0x5f,
-  0xbd, 0x48, 0xae, 0x16, 0x52, 0x1a, 0x04, 0x0c, 0xee, 0xbd, 0x88, 0xf0,
-  0xbd, 0x83, 0x16, 0x50, 0x8d, 0xab, 0x8d, 0x82, 0xdb, 0xaa, 0x2d, 0x50,
-  0x5b, 0xb9, 0x68, 0xcd, 0x65, 0x57, 0xa4, 0xfa, 0x46, 0x0e, 0xe5, 0xeb,
-  0x10, 0x70, 0x02, 0xea, 0x02, 0xe4, 0x1a, 0x99, 0x8e, 0xd8, 0x59, 0x62,
-  0xce, 0x7d, 0x66, 0x20, 0x73, 0x87, 0x80, 0x27, 0xc2, 0x40, 0x6e, 0x72,
-  0x7d, 0x64, 0x37, 0xc6, 0xd3, 0x21, 0xd7, 0x49, 0xf7, 0x02, 0x46, 0xfa,
-  0xfd, 0xcf, 0x6d, 0x09, 0x70, 0x9f, 0xef, 0xb4, 0x91, 0x74, 0xfb, 0xc3,
-  0xfe, 0x99, 0xad, 0xf3, 0x4d, 0x4a, 0xa7, 0x80, 0x59, 0x5d, 0x7a, 0xb7,
-  0xd9, 0x58, 0x4f, 0x0d, 0xf1, 0x12, 0x19, 0x3f, 0xee, 0xf9, 0xde, 0xe4,
-  0x65, 0x65, 0x08, 0x98, 0x07, 0xd0, 0xe2, 0x25, 0xdf, 0x3f, 0x4f, 0xd9,
-  0xc3, 0x0e, 0xf9, 0x38, 0x9a, 0x6e, 0xf6, 0xf9, 0xfe, 0x56, 0x64, 0x7f,
-  0x17, 0x45, 0x77, 0xcf, 0x79, 0xfe, 0x2c, 0x23, 0x4e, 0xc2, 0xad, 0x7f,
-  0xd8, 0xcc, 0x0b, 0x97, 0x80, 0x45, 0xb2, 0xfb, 0x62, 0xff, 0x38, 0x95,
-  0xcf, 0x50, 0xe0, 0xfb, 0x4b, 0xd5, 0xf8, 0x6f, 0x54, 0x55, 0x07, 0x04,
-  0xcc, 0xba, 0x09, 0xf3, 0xcd, 0xdd, 0x5a, 0x6e, 0x8a, 0x10, 0xf6, 0xde,
-  0x5a, 0xe9, 0x8e, 0x37, 0xf9, 0x0b, 0xf7, 0x93, 0x3a, 0x74, 0xb7, 0x17,
-  0x0f, 0x1b, 0xa0, 0xa4, 0x56, 0x32, 0x83, 0xf1, 0xc3, 0x43, 0xbd, 0x71,
-  0x7a, 0x25, 0xdc, 0xf4, 0x38, 0x96, 0x22, 0x39, 0x24, 0xe0, 0xe8, 0xe1,
-  0xa1, 0xbe, 0xf7, 0x35, 0xba, 0x10, 0x36, 0x67, 0x99, 0xa7, 0xe0, 0xa2,
-  0x87, 0x17, 0x7e, 0x68, 0x54, 0xa8, 0x7a, 0xb5, 0xf6, 0xf8, 0x1d, 0xdc,
-  0x6f, 0xe9, 0xcc, 0x97, 0x87, 0xc2, 0xdd, 0x66, 0x5a, 0xb8, 0x04, 0xcc,
-  0x5d, 0x33, 0xe7, 0xae, 0x81, 0xbb, 0xf1, 0x96, 0x52, 0x82, 0x51, 0x64,
-  0x74, 0x2e, 0x12, 0x61, 0x7c, 0xf1, 0x72, 0xc7, 0x6b, 0x79, 0x87, 0x80,
-  0xf9, 0x4e, 0xaf, 0xbd, 0x78, 0x2e, 0x23, 0x11, 0xb2, 0xb7, 0x1b, 0x9e,
-  0x6b, 0xa3, 0x7f, 0x01, 0xf3, 0xe2, 0xb0, 0x06, 0x2d, 0xe8, 0xac, 0xd8,
-  0xdc, 0xf5, 0x8a, 0x8b, 0x58, 0x95, 0x04, 0x9c, 0x82, 0x84, 0x4f, 0x0d,
-  0x99, 0x73, 0x93, 0xb8, 0xb1, 0xab, 0xd0, 0x06, 0x78, 0x56, 0xb8, 0xe5,
-  0x14, 0xff, 0x7d, 0x07, 0xff, 0x84, 0xd3, 0xdb, 0x85, 0x3c, 0xb8, 0x72,
-  0x09, 0x18, 0x4f, 0xce, 0xa0, 0xea, 0x7a, 0xa6, 0x2c, 0x41, 0x2f, 0x8a,
-  0xb0, 0x23, 0x47, 0xc7, 0xaf, 0x4a, 0xac, 0x30, 0xec, 0x85, 0xef, 0xac,
-  0xc4, 0x37, 0xca, 0xb2, 0xc4, 0x93, 0x34, 0x56, 0x52, 0x19, 0xf8, 0x85,
-  0xd7, 0x38, 0x82, 0x51, 0xd9, 0x2c, 0x60, 0x78, 0xef, 0xf6, 0x85, 0x0a,
-  0x4f, 0xc1, 0x61, 0x83, 0xaa, 0x09, 0x38, 0xe2, 0xdc, 0x00, 0xaa, 0x51,
-  0x79, 0xdd, 0xba, 0x04, 0x8c, 0x5d, 0x63, 0x4e, 0x57, 0xd4, 0xf9, 0xd7,
-  0x63, 0x2c, 0xf6, 0x48, 0xba, 0xbc, 0x04, 0x19, 0x3f, 0x2f, 0x9d, 0x02,
-  0xc6, 0xd3, 0x6c, 0xaa, 0x21, 0xbf, 0xfa, 0x77, 0xc6, 0xf4, 0x2d, 0x60,
-  0x11, 0xca, 0xf6, 0xa4, 0x00, 0x3a, 0x6b, 0x85, 0x67, 0x98, 0x47, 0x3b,
-  0x7d, 0x4a, 0x85, 0x82, 0x0c, 0x05, 0x0b, 0x68, 0xf2, 0xf8, 0xfc, 0x89,
-  0xfc, 0xc1, 0xb8, 0x9c, 0xb1, 0xd5, 0x85, 0x38, 0x4a, 0xd9, 0x6b, 0x07,
-  0x60, 0xee, 0x3b, 0x50, 0xc4, 0x78, 0xff, 0x98, 0x5a, 0xc1, 0x2c, 0x5c,
-  0x02, 0x86, 0xe5, 0x3e, 0x42, 0x03, 0x33, 0x3d, 0x3d, 0x56, 0xc2, 0x50,
-  0xf3, 0x44, 0x0e, 0xfb, 0x51, 0xc5, 0xd9, 0xca, 0xb0, 0x17, 0xd6, 0x0c,
-  0x91, 0xda, 0xc8, 0xaf, 0xfa, 0x99, 0x99, 0x3a, 0xcf, 0x9d, 0x94, 0x9c,
-  0x6d, 0xaf, 0x75, 0x93, 0x69, 0x21, 0xf1, 0x69, 0xc0, 0x06, 0x01, 0xc3,
-  0x7b, 0x87, 0x17, 0x1a, 0x1b, 0xec, 0x3c, 0x05, 0x27, 0x11, 0xad, 0x75,
-  0x01, 0x8a, 0x2e, 0xce, 0x1b, 0x05, 0xac, 0x9d, 0x9a, 0xb9, 0x04, 0x8c,
-  0x5c, 0xe3, 0x12, 0x30, 0x8e, 0xb1, 0xfa, 0x1f, 0xf9, 0x4c, 0x67, 0xbe,
-  0x74, 0x0b, 0x58, 0x79, 0x8c, 0x85, 0x42, 0x62, 0xcf, 0x8e, 0x5c, 0x29,
-  0x7d, 0x6d, 0xa5, 0x84, 0xa4, 0xe6, 0x94, 0x53, 0x65, 0x16, 0x32, 0x2f,
-  0x06, 0x59, 0x30, 0xcb, 0x1c, 0x9c, 0x52, 0xa1, 0x20, 0x2b, 0x13, 0x58,
-  0x99, 0x9a, 0x93, 0xd8, 0x19, 0xfb, 0x71, 0x92, 0x1a, 0x97, 0x73, 0x64,
-  0x04, 0x8d, 0x12, 0xd6, 0x7e, 0x64, 0x32, 0xa0, 0x26, 0x2c, 0xe8, 0x8a,
-  0x95, 0x0a, 0x79, 0xa3, 0xcc, 0x12, 0x15, 0x74, 0x2e, 0x01, 0xab, 0xd8,
-  0x10, 0xc9, 0x2a, 0xb6, 0x3a, 0x7a, 0x79, 0xe8, 0xfb, 0x46, 0x7e, 0x20,
-  0x7e, 0x0b, 0xb9, 0x75, 0x1f, 0xda, 0x1b, 0x25, 0xd6, 0x18, 0x38, 0xe1,
-  0x8b, 0xd6, 0x2a, 0x7a, 0x79, 0xf5, 0x33, 0xcb, 0x2b, 0x77, 0x52, 0xa5,
-  0x7c, 0x3f, 0x54, 0x09, 0xfe, 0x18, 0xad, 0xc1, 0xf3, 0xc0, 0x1e, 0x01,
-  0x83, 0x7b, 0x07, 0x17, 0xae, 0xac, 0x6e, 0xa5, 0xb3, 0xe0, 0xd2, 0xa5,
-  0xce, 0x14, 0x9d, 0x35, 0xcb, 0x3c, 0x9e, 0xb0, 0x12, 0x94, 0x3e, 0x37,
-  0xe7, 0xe5, 0x94, 0x6b, 0xd6, 0xd0, 0x14, 0x73, 0x73, 0x0f, 0xba, 0x44,
-  0xd6, 0x09, 0x31, 0x5a, 0xdd, 0x82, 0x99, 0xf3, 0x1a, 0x6a, 0xc4, 0xeb,
-  0x8c, 0x44, 0x74, 0x6c, 0xf0, 0xc4, 0xf9, 0x35, 0x32, 0x84, 0x80, 0xdb,
-  0x53, 0x64, 0xc9, 0x36, 0x3b, 0x54, 0xe9, 0x65, 0x59, 0x26, 0x1e, 0x3a,
-  0xd2, 0x0f, 0x2b, 0xaa, 0xcd, 0x96, 0xdb, 0x6d, 0x43, 0xa7, 0x27, 0xdb,
-  0x25, 0x20, 0xf5, 0x32, 0x4b, 0x92, 0x24, 0xd5, 0x7f, 0xe7, 0xbb, 0x24,
-  0x71, 0x5d, 0x5d, 0x64, 0x49, 0xb2, 0x6b, 0x32, 0x0a, 0x27, 0x7b, 0x16,
-  0xd9, 0x2e, 0x49, 0x32, 0xf8, 0x97, 0x2f, 0xe1, 0x34, 0x49, 0x32, 0x1d,
-  0xbd, 0x45, 0x06, 0x6f, 0xc4, 0x4e, 0xaa, 0xbe, 0x05, 0x7d, 0x42, 0x9e,
-  0x26, 0xbb, 0x96, 0x5d, 0x43, 0xc7, 0x85, 0xce, 0x51, 0x61, 0x7d, 0x9e,
-  0x36, 0x55, 0xd4, 0xae, 0x79, 0x6a, 0x58, 0x55, 0x64, 0x6d, 0x33, 0x2e,
-  0xb2, 0x6d, 0xb2, 0x6b, 0x7a, 0x57, 0x46, 0x96, 0x26, 0xe9, 0x71, 0xef,
-  0xd2, 0x38, 0x98, 0x79, 0x99, 0x6d, 0x71, 0x31, 0xa7, 0xc9, 0xd5, 0x77,
-  0xa0, 0xaf, 0x4d, 0xc0, 0xcd, 0x14, 0xf5, 0xec, 0x95, 0x70, 0xb1, 0xb1,
-  0x34, 0x90, 0xe1, 0x3f, 0x89, 0x8b, 0x12, 0x59, 0x6d, 0x21, 0xd1, 0x17,
-  0x21, 0x09, 0xb8, 0x04, 0x7d, 0x2d, 0xd6, 0x9f, 0xd3, 0x1d, 0x1c, 0x12,
-  0xf0, 0x35, 0x41, 0x02, 0x1e, 0x8e, 0x90, 0x04, 0xcc, 0x37, 0xe1, 0xdc,
-  0x3d, 0xef, 0xf7, 0x9b, 0x5b, 0x30, 0xac, 0xac, 0x48, 0xc0, 0x57, 0x06,
-  0x09, 0x78, 0x38, 0x82, 0x12, 0xb0, 0xb1, 0xa3, 0x16, 0xec, 0xb7, 0x20,
-  0x01, 0x5f, 0x13, 0x24, 0xe0, 0xe1, 0x08, 0x4a, 0xc0, 0xe8, 0xa9, 0xb4,
-  0x11, 0x9c, 0x21, 0x24, 0x01, 0x5f, 0x13, 0x24, 0xe0, 0xe1, 0x08, 0x4b,
-  0xc0, 0x55, 0xc1, 0x5f, 0x98, 0x14, 0xcd, 0xe2, 0x9d, 0xb9, 0x73, 0x31,
-  0x8e, 0xc3, 0xd9, 0x81, 0xfe, 0x87, 0x53, 0x97, 0x4f, 0x7c, 0xf5, 0x2b,
-  0xa8, 0x7f, 0x06, 0x81, 0x09, 0x98, 0x20, 0x08, 0x08, 0x09, 0x98, 0x20,
-  0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21,
-  0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04,
-  0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c,
-  0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26,
-  0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60,
-  0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30,
-  0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01,
-  0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80,
-  0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0xe0, 0x4b, 0x53,
-  0xde, 0x8d, 0xa7, 0x8f, 0x97, 0x36, 0xe2, 0xcf, 0x23, 0x9b, 0x47, 0xb7,
-  0xc7, 0x7d, 0xbe, 0x30, 0x4c, 0x48, 0xc0, 0x47, 0x51, 0xee, 0x9d, 0x5f,
-  0xd7, 0x3c, 0x8a, 0x62, 0x8f, 0xfe, 0x64, 0x9f, 0x79, 0xda, 0x9e, 0x91,
-  0x40, 0x08, 0xec, 0x87, 0x7e, 0xcd, 0x7b, 0x3e, 0x16, 0x5f, 0x34, 0xff,
-  0xd3, 0x21, 0x01, 0xb7, 0x67, 0x3d, 0x3f, 0xff, 0x8b, 0x21, 0x8b, 0x31,
-  0xfa, 0xea, 0xb8, 0xfc, 0x0e, 0xc9, 0xbc, 0x7d, 0x02, 0x53, 0x33, 0x81,
-  0x6b, 0x67, 0x37, 0xb7, 0x3e, 0xe0, 0xdd, 0x3f, 0x89, 0xf1, 0xf5, 0xbb,
-  0x3f, 0x96, 0x3e, 0x62, 0x21, 0xdb, 0xd4, 0x61, 0x3a, 0xbe, 0x6b, 0x8c,
-  0xf5, 0x7d, 0x4d, 0x58, 0x35, 0x64, 0xdc, 0xc1, 0x27, 0x7f, 0xc0, 0x47,
-  0xe3, 0xe1, 0x91, 0xf6, 0x9f, 0x75, 0xb2, 0x13, 0xb8, 0x76, 0x92, 0xe8,
-  0x2c, 0x01, 0xef, 0x39, 0xa7, 0x64, 0xfa, 0x37, 0x7c, 0x9f, 0xa9, 0xfb,
-  0x58, 0x28, 0x1f, 0xd4, 0xf7, 0xc7, 0x16, 0x0d, 0x02, 0x0d, 0xc8, 0xc1,
-  0x85, 0xe8, 0xff, 0xf5, 0x23, 0xe0, 0x55, 0x7d, 0x64, 0x27, 0xff, 0x3a,
-  0x18, 0xa8, 0xed, 0x05, 0x0c, 0x93, 0x2a, 0x4e, 0xad, 0x2a, 0x8b, 0xf3,
-  0xfb, 0xbe, 0x47, 0x0a, 0xb8, 0x34, 0x72, 0x94, 0xc1, 0x34, 0x5e, 0xdc,
-  0x3e, 0xb7, 0xcf, 0xb4, 0xa8, 0x3f, 0x45, 0x3b, 0xe9, 0xbe, 0x81, 0x38,
-  0xd9, 0x91, 0x7d, 0xd1, 0xb9, 0x80, 0xf3, 0x29, 0xf8, 0x82, 0x60, 0x43,
-  0xcf, 0x30, 0x10, 0x01, 0xaf, 0x17, 0x3a, 0xfa, 0xfa, 0x11, 0x70, 0x95,
-  0xc4, 0x31, 0xef, 0xea, 0xb5, 0xea, 0x1d, 0xb7, 0x13, 0x30, 0x4c, 0x8a,
-  0xdd, 0xc2, 0x29, 0x66, 0xc3, 0x7b, 0x3f, 0x83, 0x23, 0x04, 0xbc, 0xab,
-  0xbb, 0x6e, 0xc6, 0xa9, 0xf0, 0x83, 0xb2, 0xd3, 0xf6, 0x12, 0x2e, 0x56,
-  0xf1, 0xaa, 0xe3, 0x81, 0xf7, 0xa2, 0x83, 0x21, 0x54, 0xe7, 0x74, 0x2e,
-  0xe0, 0x72, 0xc4, 0xbf, 0x1e, 0xc8, 0xfe, 0xa7, 0x5b, 0x16, 0x3b, 0xe3,
-  0xf3, 0xd5, 0xf0, 0x38, 0x40, 0x6d, 0x18, 0x47, 0xbd, 0x0b, 0xb8, 0xd5,
-  0x6f, 0xc7, 0x9d, 0x84, 0xce, 0x3a, 0xd9, 0xec, 0xb8, 0xbd, 0xf2, 0x9a,
-  0x38, 0x42, 0xc0, 0xae, 0x53, 0xf1, 0x37, 0xa1, 0xe7, 0x17, 0x6c, 0x01,
-  0xaf, 0xb2, 0xcd, 0xe9, 0xbe, 0x0b, 0x9d, 0x8f, 0x46, 0xf5, 0x9c, 0x6a,
-  0xb9, 0xac, 0x6f, 0x77, 0xe9, 0xcf, 0xf8, 0x4c, 0x6f, 0x94, 0x8f, 0xd3,
-  0x86, 0xea, 0xa1, 0x33, 0x48, 0xc0, 0x27, 0x5c, 0x88, 0xe9, 0x42, 0xc0,
-  0x71, 0xb2, 0x8c, 0x2f, 0xae, 0xe0, 0xbf, 0x44, 0xc0, 0x55, 0xc6, 0x7b,
-  0x2e, 0x45, 0xf3, 0xe4, 0x8c, 0xd3, 0x1b, 0xfb, 0x97, 0xcd, 0xb3, 0x35,
-  0x0a, 0x2c, 0x5f, 0x36, 0x8f, 0xe0, 0x60, 0xbe, 0xdf, 0x6c, 0x36, 0x77,
-  0x73, 0x77, 0xf5, 0x90, 0x3f, 0x6e, 0xcc, 0x99, 0xb1, 0xe2, 0x79, 0x23,
-  0xb2, 0xc9, 0x5f, 0x36, 0xcf, 0x70, 0x69, 0xb0, 0xac, 0x53, 0x7a, 0x29,
-  0xe1, 0xc5, 0xf8, 0x04, 0x8f, 0x80, 0xf3, 0x0d, 0xca, 0xc4, 0x4c, 0xb6,
-  0x11, 0xa1, 0xac, 0xd2, 0x75, 0xa3, 0xa6, 0x36, 0x9d, 0x09, 0x8b, 0x93,
-  0x8a, 0x67, 0x68, 0xb9, 0x2f, 0x1b, 0x64, 0xb6, 0xa4, 0xdc, 0x3f, 0x6f,
-  0x5e, 0xac, 0x74, 0x8b, 0xe7, 0xc6, 0x7b, 0x67, 0x38, 0x2f, 0x74, 0x38,
-  0xb2, 0x2a, 0xf6, 0xe0, 0xf6, 0xb0, 0x2a, 0x8b, 0xfd, 0xe6, 0x11, 0x17,
-  0x51, 0xb1, 0xdf, 0x6c, 0x1e, 0x73, 0xc7, 0xa9, 0xe0, 0x56, 0x12, 0xd5,
-  0x24, 0xe8, 0x9f, 0x73, 0x97, 0x0f, 0xdd, 0x94, 0xfb, 0xc7, 0xcd, 0x66,
-  0x8f, 0xfe, 0x74, 0x4d, 0xa0, 0xba, 0xee, 0x03, 0x84, 0x5e, 0x3b, 0x01,
-  0x1f, 0x13, 0x0d, 0x1d, 0xd0, 0xdf, 0x84, 0x66, 0x59, 0xdf, 0xee, 0xca,
-  0x9f, 0xb1, 0xed, 0x8d, 0x8d, 0x18, 0x3e, 0x2f, 0x0a, 0x7d, 0xca, 0xba,
-  0xda, 0x8c, 0x59, 0xc5, 0x2b, 0x9c, 0xf2, 0x0c, 0x87, 0xd8, 0x91, 0xf2,
-  0x75, 0xc6, 0x52, 0xcb, 0x17, 0xec, 0xe8, 0x9d, 0xbe, 0x3c, 0xad, 0x1e,
-  0xa4, 0xd0, 0xd3, 0x39, 0xbf, 0xe6, 0x41, 0x5c, 0x52, 0xdc, 0x8a, 0x44,
-  0xf8, 0x7a, 0x7f, 0xc9, 0xf3, 0xc1, 0xe3, 0x2c, 0x90, 0x55, 0x26, 0x95,
-  0x90, 0x32, 0x0b, 0xa6, 0xd2, 0x74, 0x99, 0xec, 0x06, 0xde, 0xc9, 0x4c,
-  0xde, 0x5c, 0xc2, 0xef, 0xe1, 0x3f, 0xd1, 0x8b, 0x0a, 0x87, 0x2b, 0x8b,
-  0xe7, 0xc5, 0xe7, 0xf8, 0x44, 0xd0, 0x26, 0x3a, 0xab, 0x18, 0x25, 0xfc,
-  0x80, 0x23, 0x8d, 0xdf, 0xf7, 0x03, 0x6c, 0x8d, 0x94, 0x5a, 0x1d, 0x49,
-  0x65, 0xe0, 0x16, 0x98, 0x5b, 0xcb, 0xbb, 0x31, 0x4a, 0x97, 0x7b, 0xae,
-  0xe4, 0xce, 0xb8, 0x2d, 0x8d, 0x8c, 0xd4, 0xbd, 0xd7, 0x93, 0x93, 0xf8,
-  0x42, 0x45, 0x71, 0x27, 0x4e, 0x5b, 0xc8, 0x8a, 0x72, 0x11, 0xc1, 0xd4,
-  0xa0, 0x2a, 0xe5, 0xb9, 0x73, 0x35, 0x3c, 0xcd, 0xc4, 0xc9, 0xd3, 0xc7,
-  0x2a, 0xd6, 0x39, 0x82, 0x75, 0x71, 0xa0, 0x5a, 0xe6, 0xd6, 0x31, 0xbe,
-  0x8e, 0x65, 0xb2, 0xd6, 0x3f, 0xb0, 0x76, 0x63, 0x84, 0xaa, 0xb0, 0x5c,
-  0x64, 0x3a, 0xde, 0x94, 0xb0, 0xa4, 0xa7, 0x86, 0x16, 0xed, 0xfb, 0x10,
-  0x07, 0x58, 0x39, 0x41, 0x47, 0xca, 0xbf, 0x2a, 0x58, 0x3d, 0xc6, 0xac,
-  0xe4, 0x78, 0xda, 0xe3, 0xe1, 0xda, 0xe9, 0xfe, 0x04, 0xbc, 0x8d, 0x8e,
-  0x1b, 0x03, 0x97, 0x0b, 0xe5, 0xa0, 0xf1, 0x46, 0x9d, 0x12, 0x4b, 0xaf,
-  0x4e, 0xd9, 0xa1, 0x5b, 0x75, 0xce, 0x68, 0x95, 0x6c, 0x75, 0x4d, 0xc7,
-  0x1c, 0xba, 0x14, 0x11, 0x26, 0x22, 0x87, 0x15, 0xfc, 0x4e, 0x16, 0xff,
-  0x46, 0x5d, 0xc9, 0xeb, 0x82, 0x7c, 0xac, 0x0e, 0xd4, 0xcb, 0x85, 0xe5,
-  0x1c, 0x44, 0x3d, 0x36, 0x92, 0x53, 0x8a, 0xb2, 0x92, 0xf6, 0x88, 0x4d,
-  0x02, 0x7a, 0xca, 0x7d, 0x0e, 0xea, 0xdd, 0xb5, 0x0c, 0xc2, 0x58, 0xa6,
-  0x97, 0x0a, 0x3b, 0x22, 0x98, 0xc6, 0xa2, 0x3e, 0xd7, 0x56, 0x5d, 0x2d,
-  0x78, 0x60, 0xef, 0x14, 0x55, 0xe8, 0x3c, 0x2f, 0x99, 0xa7, 0xba, 0x51,
-  0x8f, 0x80, 0xd7, 0x38, 0xee, 0xd0, 0x6d, 0xf3, 0x00, 0x66, 0x27, 0xac,
-  0x65, 0x82, 0x6b, 0x23, 0x23, 0x70, 0xa1, 0xae, 0x39, 0xc7, 0x68, 0x79,
-  0x15, 0x3a, 0x92, 0x15, 0xf7, 0x4e, 0x9f, 0x98, 0x01, 0xab, 0xf0, 0xb9,
-  0x63, 0x11, 0x19, 0xfa, 0xe4, 0x68, 0x05, 0x04, 0x9c, 0x19, 0x76, 0xf0,
-  0xcb, 0x53, 0xfd, 0x9b, 0xbe, 0xae, 0xbe, 0x0d, 0x56, 0x3d, 0xf2, 0x0a,
-  0x8a, 0xfd, 0xb0, 0x82, 0x02, 0x06, 0x06, 0xce, 0x2a, 0x54, 0xd2, 0x0f,
-  0x8d, 0xf7, 0x91, 0x69, 0x63, 0x53, 0x24, 0xe0, 0x99, 0x57, 0xc0, 0xaa,
-  0x64, 0x87, 0x18, 0xdd, 0x09, 0xf7, 0xf4, 0x94, 0x6e, 0xf1, 0x38, 0x16,
-  0x0e, 0xf3, 0x65, 0x6c, 0x94, 0x53, 0xa5, 0xf5, 0x2b, 0x7f, 0x88, 0x10,
-  0x3b, 0x59, 0x29, 0x44, 0x23, 0x56, 0x13, 0xdf, 0xc1, 0x86, 0x20, 0xb3,
-  0xcf, 0xe5, 0x0d, 0x38, 0x2b, 0x84, 0x54, 0x5e, 0x39, 0x61, 0x53, 0x6b,
-  0xb5, 0x6e, 0x4a, 0x50, 0x5c, 0xf5, 0x6a, 0x43, 0x62, 0x5e, 0x5d, 0x55,
-  0x56, 0x10, 0x83, 0x00, 0x93, 0xb1, 0x9e, 0x18, 0xc9, 0x0a, 0x54, 0xb5,
-  0x31, 0x95, 0xd7, 0x26, 0xe2, 0xae, 0xb0, 0x9d, 0x79, 0xe5, 0x52, 0x5d,
-  0x52, 0x61, 0x7b, 0xa7, 0x96, 0xdf, 0x14, 0xab, 0xaa, 0x59, 0xc0, 0x09,
-  0x70, 0x4c, 0x5d, 0x8f, 0x14, 0xe0, 0xb6, 0x79, 0x1d, 0x64, 0x78, 0xae,
-  0x74, 0x64, 0x34, 0x31, 0xfc, 0x25, 0xa4, 0xc2, 0x81, 0x3f, 0x8c, 0x74,
-  0x82, 0xa3, 0x89, 0xca, 0x41, 0x0b, 0x98, 0xe7, 0xce, 0x7f, 0xe2, 0x45,
-  0x9c, 0x82, 0x44, 0xb3, 0xd8, 0x99, 0x81, 0x72, 0x09, 0xfc, 0x77, 0x0a,
-  0xdc, 0x53, 0x67, 0xc2, 0x92, 0x64, 0xe5, 0xc6, 0x56, 0xe5, 0x52, 0xe0,
-  0x14, 0x78, 0xcb, 0x75, 0x9d, 0xca, 0xf5, 0xcb, 0x42, 0x08, 0xc9, 0x0c,
-  0x74, 0xed, 0x46, 0x85, 0xec, 0x33, 0x49, 0x63, 0x0b, 0xe8, 0xa7, 0xa5,
-  0x5f, 0xc0, 0xda, 0xb7, 0xfe, 0xc8, 0xef, 0x96, 0x7e, 0x04, 0x2c, 0x42,
-  0x68, 0x79, 0xc4, 0x3a, 0x30, 0x8f, 0xd8, 0x75, 0xb6, 0x63, 0xae, 0x9d,
-  0xaa, 0x53, 0xa2, 0xc9, 0x2e, 0x9d, 0xc9, 0x72, 0x93, 0x5e, 0x2f, 0x26,
-  0x58, 0x30, 0xd2, 0xbd, 0x49, 0xb6, 0x63, 0x65, 0x3a, 0xaf, 0x50, 0x04,
-  0xe6, 0xbc, 0x14, 0x47, 0xb9, 0xee, 0x17, 0xb0, 0xff, 0xcf, 0xb2, 0x22,
-  0xdb, 0x4e, 0x98, 0x15, 0xac, 0x94, 0xb7, 0x79, 0x9e, 0xae, 0xe0, 0xb8,
-  0x3d, 0x49, 0x58, 0xf9, 0xc5, 0x49, 0xb2, 0x53, 0x45, 0x34, 0xd9, 0x66,
-  0xcc, 0x9e, 0x58, 0x16, 0x72, 0x9d, 0xec, 0x1a, 0x87, 0x83, 0xec, 0x30,
-  0x97, 0x2a, 0x1c, 0x59, 0x5c, 0x95, 0xd2, 0xa8, 0x78, 0x97, 0x8e, 0x64,
-  0x40, 0x89, 0xf8, 0xce, 0x12, 0xee, 0xb4, 0x24, 0x49, 0x8a, 0xca, 0xb0,
-  0x17, 0x8e, 0x0a, 0x85, 0x67, 0x53, 0xee, 0x14, 0xa6, 0x10, 0x15, 0x4c,
-  0x8e, 0xa4, 0x0a, 0x71, 0x0b, 0xab, 0x24, 0x49, 0x65, 0x2d, 0x39, 0xda,
-  0x66, 0x5b, 0x96, 0xfd, 0x5a, 0x7b, 0x6e, 0x99, 0xee, 0x8c, 0x12, 0xc1,
-  0xf7, 0xbe, 0x42, 0x17, 0xde, 0x6a, 0x7b, 0x98, 0x94, 0x46, 0x69, 0x91,
-  0xed, 0x62, 0xde, 0xf1, 0x9d, 0x0b, 0x57, 0xec, 0x64, 0x0e, 0x5a, 0xc0,
-  0x2c, 0xf7, 0x55, 0x3d, 0xcf, 0x29, 0xab, 0x51, 0xa6, 0x9a, 0x51, 0x92,
-  0x26, 0xb3, 0x68, 0x5d, 0xed, 0x92, 0x58, 0xe4, 0x68, 0xdd, 0x30, 0x9c,
-  0x85, 0x58, 0x8a, 0x5a, 0x63, 0x94, 0xe9, 0x4c, 0xd6, 0x32, 0x33, 0xae,
-  0x43, 0xe8, 0x14, 0xde, 0x30, 0xac, 0xd3, 0x64, 0xc9, 0x8a, 0x8c, 0x59,
-  0xb3, 0x2a, 0xab, 0x72, 0x86, 0xf7, 0x5a, 0x66, 0xe0, 0x3e, 0x12, 0x78,
-  0x1f, 0xcc, 0xd8, 0xdb, 0xaa, 0x10, 0x4e, 0x5d, 0x25, 0x49, 0xd6, 0x20,
-  0xe0, 0x59, 0x9a, 0x2d, 0xad, 0xba, 0xa1, 0x4f, 0xfa, 0x11, 0x30, 0x2b,
-  0xee, 0x71, 0xe3, 0x3d, 0x98, 0x02, 0x9e, 0xca, 0x72, 0x2a, 0x55, 0x6d,
-  0xca, 0x3d, 0x52, 0x8a, 0x28, 0x8e, 0x85, 0x2e, 0x58, 0xab, 0x9e, 0x44,
-  0xa2, 0xfd, 0x12, 0x64, 0xca, 0x69, 0x79, 0x24, 0x7f, 0x12, 0xea, 0x5d,
-  0xd7, 0xe1, 0xb0, 0x56, 0x51, 0x30, 0xe1, 0xd5, 0x03, 0xe8, 0xd7, 0xe9,
-  0xd6, 0x9e, 0xfd, 0x89, 0x97, 0xea, 0xad, 0x49, 0xac, 0x5a, 0x55, 0xa9,
-  0xac, 0x63, 0xac, 0x64, 0x25, 0x23, 0x6e, 0x70, 0x16, 0x45, 0x23, 0xde,
-  0x20, 0xc4, 0xc2, 0xf2, 0x48, 0xde, 0x82, 0xba, 0x54, 0x5b, 0xa2, 0x6d,
-  0x00, 0xba, 0x9d, 0x18, 0xd5, 0x79, 0x24, 0x44, 0x20, 0xd6, 0xeb, 0x76,
-  0x0e, 0x01, 0xfb, 0x27, 0xb1, 0x72, 0xe5, 0xf5, 0x4c, 0xd6, 0x2c, 0x99,
-  0x4a, 0x30, 0x36, 0xe3, 0x0e, 0xdc, 0x7b, 0xa9, 0x2e, 0xd4, 0x49, 0x70,
-  0x92, 0x48, 0xcd, 0x26, 0xb2, 0xf2, 0x48, 0x65, 0x72, 0x3c, 0x08, 0x0a,
-  0x60, 0x15, 0xbb, 0x74, 0xa2, 0x2e, 0x92, 0x22, 0xe7, 0xe5, 0xb8, 0xc3,
-  0x37, 0x60, 0xdc, 0x30, 0x2c, 0x81, 0x58, 0xf7, 0x93, 0xc5, 0x11, 0xd1,
-  0x3e, 0xce, 0xa5, 0xa1, 0x4b, 0xe0, 0x81, 0x5c, 0xcb, 0x89, 0xcd, 0xae,
-  0x8e, 0x51, 0x4f, 0x41, 0x8f, 0xb5, 0x53, 0x7d, 0x1f, 0x19, 0xfe, 0x7b,
-  0x85, 0x02, 0x2a, 0x03, 0xf1, 0x56, 0x59, 0x02, 0xae, 0xa3, 0xb5, 0x3a,
-  0xb0, 0xfe, 0xd2, 0x2d, 0xfd, 0x08, 0x58, 0x74, 0x27, 0xc6, 0x0d, 0x7b,
-  0x51, 0x8d, 0x38, 0x00, 0xa3, 0x98, 0x35, 0x2a, 0x03, 0xe5, 0x6b, 0x59,
-  0x6e, 0xcc, 0x33, 0x86, 0xf7, 0xd5, 0x19, 0x72, 0xa6, 0x43, 0xc5, 0xb5,
-  0xc8, 0x62, 0xaa, 0x52, 0x4f, 0x78, 0xa2, 0xec, 0x7f, 0xe3, 0x67, 0x6c,
-  0xce, 0xad, 0xbd, 0xf2, 0x6f, 0x09, 0x38, 0x85, 0xc5, 0xa7, 0x93, 0x95,
-  0x2d, 0x2c, 0xbc, 0x8c, 0x65, 0x56, 0x2f, 0x88, 0x8b, 0xb1, 0xef, 0x0a,
-  0xde, 0x93, 0x8a, 0x55, 0xa7, 0xea, 0xe6, 0xd8, 0x5e, 0x73, 0x48, 0x58,
-  0xa9, 0x2c, 0x93, 0xa3, 0x04, 0xbc, 0x56, 0x12, 0x52, 0x9d, 0xce, 0x4c,
-  0x55, 0x8a, 0xeb, 0xc8, 0x50, 0x0f, 0xb8, 0xf7, 0x9d, 0xbe, 0x70, 0x86,
-  0x4f, 0x63, 0x81, 0x3e, 0xd6, 0x8f, 0x53, 0xc9, 0x2e, 0xac, 0xf8, 0x25,
-  0x73, 0xde, 0x69, 0x26, 0xfe, 0xb5, 0x8c, 0xf0, 0x44, 0xe7, 0x21, 0x01,
-  0xaf, 0x44, 0x31, 0x2f, 0xd5, 0x2d, 0x49, 0xf7, 0x8c, 0x84, 0x5f, 0x53,
-  0xb3, 0x56, 0x5b, 0x47, 0x68, 0x28, 0x97, 0xea, 0x40, 0xd1, 0xff, 0x52,
-  0x26, 0x45, 0xc6, 0x7d, 0xec, 0x2a, 0x18, 0x6b, 0x2d, 0x04, 0x9c, 0x68,
-  0x97, 0x98, 0x91, 0xd4, 0x13, 0xfd, 0x08, 0x78, 0x9b, 0x24, 0x7c, 0x90,
-  0xe1, 0x7f, 0xca, 0xc6, 0x10, 0xf0, 0x56, 0x47, 0x88, 0xf2, 0xb1, 0x72,
-  0x92, 0x94, 0xa7, 0x96, 0xa9, 0x59, 0xd2, 0x40, 0xc0, 0x4b, 0x14, 0xd7,
-  0x3c, 0x3a, 0x4a, 0x1d, 0xd0, 0xa2, 0xc4, 0x73, 0x51, 0xc5, 0xdc, 0xbd,
-  0x54, 0xfa, 0xaa, 0x28, 0x5a, 0x3c, 0x1a, 0x1a, 0x76, 0xae, 0x03, 0xcb,
-  0xe2, 0x2b, 0xac, 0x64, 0x25, 0xa2, 0x9a, 0x58, 0xfe, 0xd7, 0xab, 0x8f,
-  0xeb, 0x3a, 0xa7, 0x44, 0x41, 0x80, 0xee, 0xc0, 0xa9, 0x3a, 0x23, 0x61,
-  0x50, 0x11, 0x1a, 0xbf, 0xc4, 0x47, 0x09, 0x18, 0xdc, 0x8d, 0x74, 0x93,
-  0xdf, 0xa7, 0xf0, 0x6c, 0x55, 0xa9, 0xca, 0x3e, 0xa8, 0x3a, 0xa9, 0x10,
-  0x8e, 0x94, 0xfb, 0x1c, 0xd9, 0x45, 0x79, 0x05, 0x54, 0xaa, 0xd2, 0xd5,
-  0x4d, 0x7c, 0x11, 0x81, 0x39, 0x79, 0x50, 0x3b, 0xb5, 0x6d, 0x81, 0x55,
-  0x35, 0xa8, 0x32, 0x59, 0x89, 0x94, 0xd6, 0xf2, 0x17, 0xe9, 0x01, 0x63,
-  0x2d, 0x0c, 0xe4, 0x10, 0xa1, 0xad, 0x82, 0xbc, 0x43, 0x63, 0xdc, 0x47,
-  0x06, 0xb3, 0x68, 0x2d, 0xe0, 0x1c, 0x7a, 0xbf, 0x6f, 0xfa, 0xcb, 0x87,
-  0x55, 0xda, 0x63, 0xef, 0x6e, 0x36, 0xa3, 0xec, 0x54, 0x34, 0x02, 0xe7,
-  0x58, 0x02, 0xe6, 0xc1, 0x92, 0xcb, 0xa6, 0x0f, 0x94, 0x3c, 0x10, 0xb0,
-  0x5a, 0xb9, 0x51, 0x27, 0x5b, 0x33, 0x35, 0xb5, 0x94, 0xd6, 0xf2, 0xdf,
-  0xfc, 0x61, 0xdc, 0x5c, 0xfd, 0x86, 0x9b, 0xe1, 0x46, 0x01, 0x3b, 0x92,
-  0x15, 0x88, 0xd6, 0x67, 0xfa, 0x5f, 0xc0, 0x26, 0x75, 0xdf, 0x3a, 0x93,
-  0x97, 0xb6, 0x13, 0x70, 0x69, 0x24, 0x0c, 0x62, 0x5a, 0x9f, 0xb4, 0x3b,
-  0x4b, 0xc0, 0xb2, 0xeb, 0xdb, 0x4e, 0xc0, 0xe6, 0x85, 0x70, 0x9e, 0x40,
-  0x1a, 0xc9, 0xd7, 0x0e, 0xc6, 0xd8, 0xf2, 0xb5, 0x29, 0x60, 0x4d, 0x0c,
-  0x3a, 0xe6, 0x30, 0xad, 0xb6, 0x02, 0x46, 0x99, 0xc8, 0x59, 0xfe, 0xb9,
-  0x6c, 0x6f, 0xa5, 0x07, 0xc6, 0xb8, 0x60, 0xd6, 0xc6, 0xa5, 0x3a, 0x9f,
-  0xad, 0xba, 0x0f, 0xb6, 0x4e, 0x66, 0xdc, 0x47, 0x7c, 0x84, 0x80, 0x41,
-  0xfd, 0xd2, 0x3f, 0x3d, 0x56, 0x14, 0xd6, 0x98, 0x0a, 0x67, 0x1c, 0x1d,
-  0x2f, 0x60, 0x31, 0xb6, 0xbe, 0xe3, 0x0b, 0xc6, 0x13, 0x90, 0x9a, 0x29,
-  0xe0, 0x18, 0x07, 0xb1, 0xa9, 0x34, 0x25, 0x1c, 0x06, 0x5b, 0xe7, 0xcb,
-  0x27, 0xaa, 0x00, 0x3d, 0xe3, 0xc0, 0xc3, 0x02, 0xd6, 0xa1, 0xc7, 0xaa,
-  0x9a, 0xb4, 0x0e, 0xd0, 0xac, 0xd6, 0x19, 0x17, 0x5b, 0xd5, 0x5a, 0xc0,
-  0xfe, 0x84, 0xcd, 0x93, 0x26, 0x47, 0x09, 0x78, 0x12, 0x59, 0x3a, 0x3c,
-  0x4d, 0xc0, 0xd0, 0xf7, 0xda, 0x91, 0xf3, 0xd2, 0xd2, 0x56, 0x0c, 0xd2,
-  0x9d, 0x18, 0xbf, 0x89, 0xdb, 0x2c, 0x8d, 0xa4, 0x1a, 0x04, 0xcc, 0xca,
-  0x7d, 0xed, 0xca, 0x44, 0xcc, 0x3a, 0xa8, 0x9e, 0x8e, 0xf2, 0x40, 0x14,
-  0xa1, 0x38, 0x33, 0x2a, 0x11, 0x18, 0xfe, 0x4a, 0xc1, 0xd1, 0xb4, 0x70,
-  0x66, 0x01, 0x92, 0x6a, 0x21, 0xe0, 0x81, 0x96, 0x82, 0x7b, 0x14, 0xf0,
-  0x32, 0xb2, 0x4b, 0x03, 0x64, 0x1c, 0x9d, 0x20, 0xe0, 0x12, 0xf8, 0x7f,
-  0x04, 0x97, 0x47, 0x4d, 0x01, 0xaf, 0x70, 0x10, 0xeb, 0xf6, 0x35, 0xd2,
-  0xf1, 0x90, 0xaf, 0xe4, 0x9f, 0x6c, 0xfa, 0xb2, 0xdc, 0xc9, 0x00, 0x83,
-  0xdd, 0x86, 0x46, 0x01, 0x3b, 0x93, 0xe5, 0xd4, 0x69, 0xb1, 0x35, 0x1c,
-  0x76, 0x52, 0x96, 0x48, 0xf3, 0x94, 0x51, 0x2d, 0xba, 0xd0, 0xce, 0x84,
-  0xf5, 0x49, 0x1d, 0xb4, 0xc0, 0xad, 0x05, 0xbc, 0xb4, 0x2f, 0xd4, 0x14,
-  0xab, 0x91, 0xb0, 0xf3, 0xd6, 0x52, 0xe9, 0xb2, 0xa9, 0x05, 0x2e, 0xcc,
-  0x48, 0x3f, 0x20, 0x60, 0xde, 0x62, 0xef, 0x2c, 0xf7, 0x2c, 0x45, 0xdd,
-  0x3e, 0xe6, 0x0d, 0x71, 0x51, 0x99, 0x02, 0xde, 0xe1, 0x1c, 0x00, 0xe8,
-  0x3e, 0xd6, 0xf2, 0x3e, 0x16, 0xd6, 0x7d, 0x1c, 0x2f, 0xe0, 0x81, 0x5e,
-  0x61, 0xd0, 0xc7, 0x56, 0x4a, 0xf1, 0x7f, 0x7d, 0x47, 0xae, 0x0d, 0x6f,
-  0x46, 0xd9, 0x01, 0x05, 0xf2, 0x85, 0x09, 0xa7, 0x80, 0xd5, 0x58, 0x35,
-  0x8a, 0x66, 0x68, 0x7b, 0x03, 0x38, 0x43, 0x65, 0x0b, 0x0b, 0xc8, 0x2a,
-  0x2c, 0x46, 0x99, 0xae, 0x50, 0x31, 0xe6, 0xdb, 0x89, 0xa9, 0x97, 0x46,
-  0x01, 0x7b, 0x92, 0x95, 0x76, 0xae, 0x12, 0xd6, 0x9d, 0xab, 0xdb, 0x84,
-  0x58, 0x56, 0x13, 0xea, 0x8a, 0x66, 0x01, 0x8f, 0xbc, 0x09, 0xeb, 0x93,
-  0x4e, 0x18, 0x03, 0x83, 0x79, 0x2a, 0xe6, 0xc8, 0x75, 0x5b, 0x01, 0x83,
-  0xb9, 0x66, 0x5b, 0xc0, 0xb5, 0x47, 0x44, 0xec, 0xbb, 0x76, 0x5e, 0xab,
-  0x74, 0x99, 0xb3, 0xd1, 0xac, 0xc8, 0x91, 0x02, 0x4e, 0xa4, 0x32, 0x62,
-  0x5b, 0x21, 0x2c, 0x6a, 0xf2, 0xb5, 0x9a, 0xb1, 0x92, 0x1e, 0x30, 0xc6,
-  0xc0, 0xac, 0x99, 0xf5, 0xef, 0x0f, 0x94, 0xf7, 0x91, 0xeb, 0x19, 0x4b,
-  0xa7, 0xb5, 0x8d, 0x02, 0xd6, 0x3f, 0x0e, 0x40, 0xf7, 0xf9, 0xec, 0xc4,
-  0x16, 0x8b, 0x54, 0xd6, 0x7d, 0xbb, 0xb1, 0x6b, 0x45, 0xc9, 0x28, 0x3b,
-  0xde, 0x98, 0xb1, 0x0b, 0x57, 0x91, 0xb1, 0x12, 0x60, 0x04, 0xd9, 0x32,
-  0x8e, 0xe3, 0xc4, 0xd8, 0x6e, 0x0a, 0x04, 0x3c, 0x8e, 0xcc, 0xd5, 0x15,
-  0x39, 0x75, 0xea, 0x9a, 0x13, 0x07, 0xb3, 0xdf, 0x8c, 0xd8, 0x28, 0xe0,
-  0x66, 0x01, 0x4f, 0xac, 0x68, 0x95, 0xb0, 0x26, 0x77, 0xc9, 0xee, 0x63,
-  0x26, 0x76, 0x3a, 0xa9, 0xdd, 0x25, 0x2d, 0x04, 0xec, 0x08, 0x1f, 0xe8,
-  0x37, 0xf6, 0x2f, 0x29, 0x41, 0x7d, 0x68, 0xed, 0x4a, 0x0a, 0x4a, 0x0a,
-  0x88, 0x6f, 0x1a, 0x81, 0x59, 0xe8, 0x83, 0x02, 0x66, 0xad, 0xfd, 0x54,
-  0x5f, 0x68, 0x4f, 0x4e, 0xca, 0xe5, 0x25, 0x5b, 0x83, 0xf8, 0x4e, 0x91,
-  0x78, 0x66, 0xc6, 0x91, 0x9d, 0x75, 0x06, 0x14, 0x30, 0xdf, 0x92, 0x11,
-  0xcb, 0x5b, 0x37, 0x62, 0xaa, 0x56, 0xde, 0x76, 0xae, 0x76, 0x93, 0x49,
-  0x0f, 0xb0, 0x68, 0xd2, 0x5b, 0x06, 0xd4, 0x7a, 0x93, 0x0f, 0x3e, 0x99,
-  0x95, 0xea, 0xa9, 0x14, 0x0d, 0x28, 0xed, 0x46, 0x01, 0xeb, 0x09, 0xd9,
-  0xb2, 0xff, 0x5d, 0xd1, 0x9d, 0x0b, 0xb8, 0x2e, 0x83, 0xe9, 0xc3, 0xcb,
-  0x33, 0xdf, 0x54, 0x36, 0x91, 0x33, 0x4f, 0x56, 0x87, 0x82, 0x1d, 0x7d,
-  0xdc, 0xab, 0xf7, 0x2d, 0x4c, 0x64, 0x5c, 0x94, 0x32, 0xb4, 0x1c, 0x02,
-  0x2e, 0x7c, 0x55, 0x1b, 0x3b, 0x63, 0x9c, 0xab, 0x91, 0x4c, 0x69, 0x04,
-  0xf1, 0x1a, 0x14, 0xe3, 0x33, 0xab, 0x26, 0x72, 0xbe, 0x62, 0x50, 0x4a,
-  0xeb, 0x36, 0x85, 0x3e, 0xd1, 0x5c, 0xd8, 0x10, 0x7f, 0xdb, 0x02, 0x5e,
-  0x59, 0xc9, 0x42, 0x83, 0xc6, 0x53, 0x39, 0x41, 0xaa, 0x5b, 0x8c, 0x83,
-  0x02, 0x2e, 0x74, 0xb6, 0xce, 0x84, 0x55, 0xc5, 0xc7, 0x2d, 0x4f, 0xc1,
-  0x9c, 0x49, 0x1e, 0xb9, 0x92, 0x82, 0xdd, 0x5f, 0xbd, 0x48, 0xae, 0x86,
-  0x9f, 0x0d, 0x02, 0x06, 0xf7, 0xae, 0x3b, 0xbb, 0x19, 0x4c, 0x9a, 0xa5,
-  0xb9, 0x29, 0xa1, 0x61, 0x7c, 0x0d, 0x85, 0x1f, 0x4a, 0x0b, 0x94, 0x6e,
-  0xa6, 0x72, 0xaf, 0xaa, 0x8c, 0xfd, 0x6f, 0xab, 0x8a, 0xad, 0x7c, 0xae,
-  0x3c, 0xf2, 0x52, 0x37, 0xf5, 0x3c, 0x56, 0x46, 0x80, 0xfa, 0x44, 0x64,
-  0xc2, 0xcb, 0x62, 0xa9, 0x33, 0x90, 0x8e, 0x56, 0xed, 0x08, 0x77, 0xa4,
-  0xd4, 0x27, 0xbb, 0x29, 0x54, 0x43, 0x96, 0xe2, 0xe9, 0xd4, 0x29, 0xbc,
-  0x8f, 0x02, 0x18, 0x0b, 0x27, 0x75, 0xd4, 0x44, 0xb3, 0xde, 0xfe, 0xc2,
-  0x7e, 0xbd, 0x55, 0x01, 0xbc, 0xe6, 0xfb, 0x6c, 0xa7, 0x7d, 0x4b, 0xb8,
-  0x73, 0x01, 0xf3, 0xe5, 0x23, 0xc9, 0x4e, 0x7a, 0xd0, 0x6a, 0x4d, 0xd0,
-  0x69, 0x23, 0x79, 0xda, 0xc3, 0xfe, 0x99, 0x2d, 0x81, 0x4e, 0x4a, 0xa7,
-  0x80, 0x99, 0xbb, 0xee, 0x36, 0x1b, 0xeb, 0xa9, 0x21, 0x1e, 0x1b, 0xe3,
-  0xc7, 0x3d, 0xdf, 0x9b, 0xbc, 0xac, 0x0c, 0x01, 0xf3, 0x72, 0x5b, 0xbc,
-  0xe4, 0xfb, 0xe7, 0x29, 0x7b, 0xd8, 0x21, 0x1f, 0x47, 0xd3, 0xcd, 0x3e,
-  0xdf, 0xdf, 0x8a, 0xec, 0xef, 0xa2, 0xe8, 0xee, 0x39, 0xcf, 0x9f, 0x8d,
-  0x49, 0x4b, 0xd1, 0x6b, 0x7b, 0xd8, 0xcc, 0x0b, 0x97, 0x80, 0x45, 0xb2,
-  0xfb, 0x62, 0xff, 0x38, 0x95, 0xcf, 0x50, 0xe0, 0xfb, 0x4b, 0xd5, 0xb0,
-  0x6b, 0x54, 0x55, 0x07, 0x04, 0xcc, 0x5c, 0x37, 0xdf, 0xdc, 0xad, 0xe5,
-  0x6e, 0x16, 0x61, 0xef, 0xad, 0x95, 0xee, 0x78, 0x93, 0xbf, 0x70, 0x3f,
-  0xa9, 0x43, 0x77, 0x7b, 0xf1, 0xb0, 0x01, 0x4a, 0x6a, 0x25, 0x33, 0x18,
-  0x3f, 0x3c, 0xd4, 0x53, 0x4c, 0x2b, 0xe1, 0x26, 0xb6, 0xd1, 0x95, 0x89,
-  0xf3, 0x90, 0x80, 0xa3, 0x87, 0x87, 0xfa, 0xde, 0xd7, 0xe8, 0x42, 0xd0,
-  0x83, 0x2e, 0xa7, 0xd1, 0x18, 0x3a, 0x92, 0x7b, 0x69, 0x5a, 0xfb, 0x72,
-  0xc1, 0xb5, 0xc8, 0xf3, 0xdf, 0xc8, 0xed, 0x68, 0xe3, 0xe7, 0x7d, 0xfe,
-  0x72, 0xcb, 0x35, 0x5e, 0xf0, 0x0e, 0xeb, 0xed, 0xe6, 0x61, 0xcc, 0x72,
-  0x2e, 0xc4, 0x9f, 0x73, 0x73, 0xe1, 0x7b, 0xba, 0x90, 0x3b, 0x1d, 0x57,
-  0x3a, 0xca, 0xe6, 0x2f, 0x2c, 0x13, 0x51, 0xcf, 0xc9, 0xdd, 0xd1, 0x13,
-  0x70, 0x99, 0x0e, 0xc8, 0xc5, 0xe6, 0x81, 0x3b, 0x92, 0x57, 0xf0, 0xb5,
-  0xc5, 0x77, 0xf8, 0x19, 0xad, 0x79, 0x34, 0x7e, 0xd8, 0x17, 0x7b, 0xbe,
-  0x07, 0xbd, 0xc0, 0xf7, 0x31, 0xd5, 0x5d, 0xc3, 0xf1, 0xe6, 0x61, 0x6e,
-  0xf9, 0x5c, 0xef, 0xc4, 0xba, 0x7d, 0xe1, 0x01, 0x1c, 0xc9, 0x5d, 0x74,
-  0x68, 0x1f, 0x6c, 0x0f, 0x74, 0x2e, 0x60, 0x38, 0xcf, 0x64, 0x6c, 0x8d,
-  0xc2, 0x19, 0x43, 0x62, 0x73, 0x8a, 0x03, 0xef, 0x8e, 0x52, 0x41, 0x06,
-  0x67, 0x67, 0xd1, 0xdb, 0x19, 0x8c, 0x69, 0x5b, 0xdc, 0xd8, 0x55, 0x78,
-  0xd3, 0x7c, 0x6d, 0x56, 0x39, 0xc5, 0x7f, 0xdf, 0xc1, 0x3f, 0xe1, 0x14,
-  0x6b, 0x21, 0x0f, 0xae, 0x5c, 0x02, 0xc6, 0x73, 0x22, 0xa8, 0x4f, 0x37,
-  0x53, 0x96, 0x64, 0xfa, 0x1e, 0x9b, 0x05, 0xac, 0x12, 0x2b, 0x0c, 0x7b,
-  0x61, 0x87, 0x15, 0xdf, 0x28, 0xcb, 0x72, 0x89, 0x0e, 0x59, 0x49, 0x65,
-  0xe0, 0x97, 0x72, 0x04, 0xce, 0x1c, 0x95, 0xcd, 0x02, 0x86, 0xf7, 0x6e,
-  0x5f, 0x28, 0x8a, 0x1b, 0x3c, 0x04, 0x12, 0x01, 0x11, 0x0a, 0xd6, 0x7a,
-  0xbf, 0x73, 0xa2, 0xf4, 0xca, 0x59, 0x98, 0xc5, 0x92, 0x83, 0xea, 0x7f,
-  0xe1, 0xbb, 0xe1, 0xb5, 0xa3, 0xbc, 0xe1, 0x0c, 0x97, 0x3a, 0x83, 0xfd,
-  0xbb, 0x32, 0x26, 0x30, 0x77, 0xc6, 0x5c, 0xb8, 0xde, 0x4a, 0x89, 0xef,
-  0x63, 0x65, 0xde, 0x07, 0xab, 0x43, 0x53, 0x90, 0x0c, 0x9e, 0xe3, 0xb2,
-  0xf7, 0x42, 0xaf, 0x54, 0xb9, 0xf8, 0xa5, 0xd2, 0x09, 0x3d, 0xa4, 0xbf,
-  0x93, 0xa5, 0xb0, 0xe4, 0xaa, 0x5d, 0x3a, 0xa7, 0x0d, 0xac, 0xdb, 0x05,
-  0xca, 0x1f, 0xed, 0xf4, 0x29, 0x15, 0x0a, 0x32, 0xe4, 0x25, 0xd0, 0xe4,
-  0xf1, 0x9d, 0xac, 0xb0, 0x9c, 0xcc, 0x19, 0xa6, 0xad, 0x0e, 0x9e, 0x51,
-  0x2a, 0x9f, 0x2d, 0x55, 0xb9, 0xef, 0x40, 0x68, 0xa1, 0xe9, 0x6d, 0xbd,
-  0x70, 0x58, 0xb8, 0x04, 0x0c, 0x15, 0x3c, 0x42, 0xbd, 0x0c, 0x3d, 0x3d,
-  0x26, 0x22, 0x2b, 0xc1, 0x46, 0x39, 0x04, 0xac, 0x44, 0xb2, 0x32, 0xec,
-  0x85, 0x35, 0x43, 0xa4, 0x36, 0xf1, 0x2b, 0xb7, 0x66, 0xea, 0x3c, 0x77,
-  0x52, 0x72, 0xb6, 0xbd, 0x0e, 0xd7, 0x4c, 0x47, 0xde, 0x4c, 0x6f, 0xb7,
-  0x70, 0x0b, 0x18, 0xde, 0x3b, 0xbc, 0x10, 0x3a, 0xa8, 0x54, 0x53, 0xf9,
-  0xca, 0x9c, 0x14, 0x58, 0xae, 0x76, 0x83, 0xf2, 0x9e, 0x31, 0x48, 0xa4,
-  0xde, 0x8f, 0x8c, 0xd6, 0x6e, 0x74, 0x7f, 0x20, 0x42, 0x3d, 0x36, 0x90,
-  0x7e, 0xb4, 0x54, 0x5d, 0x77, 0x2b, 0x13, 0x55, 0x8f, 0xa5, 0xe0, 0x32,
-  0xf3, 0x54, 0x36, 0x0c, 0x03, 0x31, 0x14, 0xe7, 0xce, 0xfb, 0x98, 0x95,
-  0xc6, 0x75, 0xc2, 0x58, 0x79, 0xe5, 0x54, 0x8b, 0x79, 0xc2, 0x6e, 0xc0,
-  0x12, 0x30, 0x4b, 0x81, 0xfd, 0x34, 0xb2, 0x22, 0xbf, 0x5b, 0x7a, 0xa9,
-  0x20, 0x8a, 0x2c, 0x49, 0xb6, 0x99, 0xaa, 0xdd, 0xd2, 0xc4, 0x31, 0xcf,
-  0x03, 0x6f, 0x57, 0x84, 0x8d, 0x8c, 0x59, 0x21, 0x7c, 0x97, 0x80, 0xcb,
-  0x04, 0x56, 0xe2, 0xe6, 0x24, 0x76, 0xc6, 0x7e, 0x9c, 0x58, 0x45, 0xc8,
-  0x8d, 0x8a, 0x65, 0x79, 0xf3, 0x2d, 0x3c, 0xd2, 0xe1, 0x13, 0xbe, 0x37,
-  0x48, 0x2d, 0x85, 0x98, 0x6f, 0x52, 0x4a, 0x54, 0x59, 0xbb, 0x04, 0x5c,
-  0xe5, 0x33, 0x94, 0xac, 0x62, 0xab, 0x22, 0x46, 0x04, 0x70, 0x8a, 0x8d,
-  0x72, 0x08, 0x58, 0x9a, 0xc8, 0x23, 0x52, 0x05, 0x5a, 0x62, 0x8d, 0x81,
-  0x13, 0xbe, 0x68, 0x2d, 0x23, 0x57, 0x54, 0x3f, 0xb3, 0xbc, 0x72, 0x27,
-  0x55, 0xae, 0x41, 0x14, 0xca, 0x3f, 0x46, 0x6b, 0xf0, 0x3c, 0xb0, 0x47,
-  0xc0, 0xe0, 0xde, 0xc1, 0x85, 0x2b, 0x7c, 0xa3, 0xca, 0x91, 0xaa, 0x9e,
-  0x51, 0xb5, 0xa3, 0x70, 0xa5, 0x70, 0x11, 0xcc, 0x5d, 0x4b, 0x47, 0xec,
-  0xfd, 0x8f, 0x26, 0xbc, 0x30, 0x85, 0x6a, 0x26, 0x96, 0x80, 0x47, 0xf1,
-  0x0a, 0x85, 0x91, 0x72, 0x8f, 0x32, 0x87, 0xb7, 0xe6, 0x23, 0x78, 0x99,
-  0x28, 0xa2, 0x15, 0x36, 0x50, 0xc6, 0xd9, 0x04, 0x85, 0xa5, 0xbe, 0x0f,
-  0xe9, 0x03, 0x75, 0x1f, 0xb2, 0xde, 0x90, 0x07, 0x56, 0x72, 0x7f, 0x7e,
-  0x34, 0x2b, 0xf3, 0x08, 0x0a, 0x78, 0xcd, 0xef, 0x8f, 0x3f, 0xc5, 0xc3,
-  0x9e, 0x97, 0xe8, 0xfb, 0xa1, 0x86, 0xa1, 0x66, 0xbb, 0xdb, 0x51, 0x64,
-  0xc9, 0x36, 0x3b, 0xb4, 0x80, 0x96, 0x65, 0x99, 0x78, 0xe8, 0x48, 0x6f,
-  0x18, 0x57, 0x9b, 0x2d, 0xb7, 0xdb, 0x86, 0x05, 0xf4, 0x6c, 0x97, 0x80,
-  0xd4, 0xcb, 0x2c, 0x49, 0x92, 0x54, 0xff, 0x9d, 0xef, 0xea, 0x6a, 0xc7,
-  0x69, 0x54, 0xb2, 0x6b, 0x32, 0x0a, 0x27, 0x7b, 0x16, 0xd9, 0x2e, 0x01,
-  0x61, 0xda, 0x90, 0x70, 0x9a, 0x24, 0xba, 0x86, 0xac, 0x4d, 0x4c, 0xcd,
-  0x13, 0x61, 0x52, 0xf5, 0x2d, 0xe8, 0x13, 0xf2, 0x34, 0xd9, 0xb5, 0xdc,
-  0x66, 0xe0, 0xb8, 0xd0, 0xde, 0x61, 0xc4, 0x1c, 0xb9, 0x43, 0xfd, 0x96,
-  0x3c, 0x4d, 0x52, 0xf8, 0xac, 0xc9, 0x56, 0x3f, 0xbc, 0x5d, 0x64, 0x46,
-  0xee, 0x75, 0x1e, 0xfa, 0x36, 0xcb, 0x6c, 0x6b, 0xa4, 0xe5, 0xc5, 0xc8,
-  0xa4, 0x81, 0x3a, 0x51, 0x78, 0x6a, 0x51, 0xc7, 0x89, 0x75, 0x23, 0x87,
-  0xef, 0xa3, 0xca, 0x6b, 0x7f, 0xf0, 0x0b, 0x8b, 0x54, 0xfe, 0x8b, 0x23,
-  0x66, 0xa1, 0xeb, 0xc3, 0xf2, 0x66, 0xca, 0x5d, 0xd2, 0xfb, 0x6a, 0xf0,
-  0x75, 0x09, 0xb8, 0x99, 0xa2, 0x9e, 0xbd, 0x12, 0x1e, 0x51, 0xbb, 0x18,
-  0x38, 0x19, 0xfe, 0x93, 0x20, 0x86, 0xc6, 0x7a, 0x01, 0xd1, 0x30, 0x84,
-  0x24, 0xe0, 0x12, 0xb8, 0x48, 0x3f, 0x00, 0xca, 0x20, 0x01, 0x13, 0x17,
-  0x86, 0x04, 0x7c, 0x18, 0xd6, 0x6f, 0xbe, 0x7b, 0xde, 0xef, 0x37, 0xb7,
-  0x60, 0x58, 0x59, 0x91, 0x80, 0x89, 0xcb, 0x43, 0x02, 0x3e, 0x8c, 0xb1,
-  0x91, 0x15, 0x4c, 0x6d, 0x93, 0x80, 0x89, 0x0b, 0x43, 0x02, 0x6e, 0x01,
-  0x7c, 0x18, 0x6c, 0x04, 0xf7, 0xb9, 0x91, 0x80, 0x89, 0x0b, 0x43, 0x02,
-  0x6e, 0x43, 0x91, 0x88, 0x57, 0x0f, 0xc5, 0x3b, 0x73, 0xe7, 0x62, 0x1c,
-  0x0f, 0xef, 0x3d, 0x82, 0x90, 0xc4, 0xd1, 0x24, 0x8e, 0x87, 0x7f, 0xed,
-  0x7b, 0x60, 0x02, 0x26, 0x08, 0x02, 0x42, 0x02, 0x26, 0x88, 0x80, 0x21,
-  0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04,
-  0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c,
-  0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26,
-  0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60,
-  0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30,
-  0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01,
-  0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80,
-  0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08,
-  0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04,
-  0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44,
-  0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24,
-  0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20,
-  0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21,
-  0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04,
-  0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c,
-  0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26,
-  0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60,
-  0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30,
-  0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01,
-  0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80,
-  0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08,
-  0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04,
-  0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44,
-  0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24,
-  0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20,
-  0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21,
-  0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04,
-  0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c,
-  0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26,
-  0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60,
-  0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30,
-  0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01,
-  0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80,
-  0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08,
-  0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04,
-  0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44,
-  0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24,
-  0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20,
-  0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21,
-  0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04,
-  0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c,
-  0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0x43, 0x02, 0x26,
-  0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80, 0x09, 0x22, 0x60,
-  0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08, 0x18, 0x12, 0x30,
-  0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04, 0x4c, 0x10, 0x01,
-  0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44, 0xc0, 0x90, 0x80,
-  0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24, 0x60, 0x82, 0x08,
-  0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20, 0x02, 0x86, 0x04,
-  0x4c, 0x10, 0x01, 0x43, 0x02, 0x26, 0x88, 0x80, 0x21, 0x01, 0x13, 0x44,
-  0xc0, 0x90, 0x80, 0x09, 0x22, 0x60, 0x48, 0xc0, 0x04, 0x11, 0x30, 0x24,
-  0x60, 0x82, 0x08, 0x18, 0x12, 0x30, 0x41, 0x04, 0x0c, 0x09, 0x98, 0x20,
-  0x02, 0x86, 0x04, 0x4c, 0x10, 0x01, 0xf3, 0x7f, 0x68, 0xb3, 0xb9, 0x68,
-  0xcf, 0x4a, 0x01, 0x14, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4e, 0x44,
-  0xae, 0x42, 0x60, 0x82
-};
-const uint32_t splash_png_len = 21064;
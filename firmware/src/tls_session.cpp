@@ -0,0 +1,293 @@
+#include "tls_session.h"
+
+#include <Arduino.h>
+#include <esp_attr.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/version.h>
+
+// mbedtls 3.x hides struct members behind MBEDTLS_PRIVATE(); 2.x has no such
+// macro and the members are plain.
+#ifndef MBEDTLS_PRIVATE
+#define MBEDTLS_PRIVATE(member) member
+#endif
+
+// A saved session is the master secret + parameters + the ticket (~200 B at
+// Cloudflare) + the peer certificate when mbedtls keeps it (the default), so
+// ~1.5 KB in practice. A session that doesn't fit is simply not cached.
+#define TLS_SESSION_MAX         2048
+#define TLS_CONNECT_TIMEOUT_MS  10000
+
+// ─── RTC session cache — survives deep sleep ────────────────────────────────
+// One slot, keyed by a hash of the host it was negotiated with (every request
+// goes to the same worker, so one is all we need). Lost on power-on reset, which
+// just means one full handshake.
+RTC_DATA_ATTR static uint32_t tls_host_hash   = 0;
+RTC_DATA_ATTR static uint16_t tls_session_len = 0;   // 0 = nothing cached
+RTC_DATA_ATTR static uint8_t  tls_session_buf[TLS_SESSION_MAX];
+
+static uint32_t hostHash(const char *host) {
+    uint32_t h = 5381u;
+    for (const char *p = host; *p; p++) h = ((h << 5) + h) ^ (uint8_t)*p;
+    return h;
+}
+
+void tlsSessionClear() {
+    tls_session_len = 0;
+    tls_host_hash   = 0;
+}
+
+static bool sessionCachedFor(const char *host) {
+    return tls_session_len > 0 && tls_host_hash == hostHash(host);
+}
+
+// ─── transport: the inherited WiFiClient is the raw TCP socket ──────────────
+
+int ResumableTlsClient::bioSend(void *ctx, const unsigned char *buf, size_t len) {
+    ResumableTlsClient *self = (ResumableTlsClient *)ctx;
+    size_t n = self->WiFiClient::write(buf, len);
+    if (n == 0) return self->WiFiClient::connected() ? MBEDTLS_ERR_SSL_WANT_WRITE
+                                                     : MBEDTLS_ERR_NET_SEND_FAILED;
+    return (int)n;
+}
+
+int ResumableTlsClient::bioRecv(void *ctx, unsigned char *buf, size_t len) {
+    ResumableTlsClient *self = (ResumableTlsClient *)ctx;
+    int avail = self->WiFiClient::available();
+    if (avail <= 0) {
+        // 0 tells mbedtls the peer hung up; WANT_READ that nothing's here yet.
+        return self->WiFiClient::connected() ? MBEDTLS_ERR_SSL_WANT_READ : 0;
+    }
+    int n = self->WiFiClient::read(buf, len < (size_t)avail ? len : (size_t)avail);
+    return n > 0 ? n : MBEDTLS_ERR_SSL_WANT_READ;
+}
+
+// ─── handshake ──────────────────────────────────────────────────────────────
+
+void ResumableTlsClient::freeTls() {
+    if (!_tlsLive) return;
+    mbedtls_ssl_free(&_ssl);
+    mbedtls_ssl_config_free(&_conf);
+    mbedtls_ctr_drbg_free(&_drbg);
+    mbedtls_entropy_free(&_entropy);
+    _tlsLive = false;
+    _tlsUp   = false;
+}
+
+// Runs the handshake over the already-connected socket, offering the cached
+// session if asked. Steps the state machine by hand so it can tell a resumed
+// handshake (ServerHello → ChangeCipherSpec) from a full one (which always
+// passes through ClientKeyExchange). Caches the resulting session on success.
+bool ResumableTlsClient::handshake(const char *host, bool offerSession, int32_t timeoutMs) {
+    freeTls();
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+    mbedtls_ctr_drbg_init(&_drbg);
+    mbedtls_entropy_init(&_entropy);
+    _tlsLive    = true;
+    _peerClosed = false;
+    _resumed    = false;
+
+    unsigned long t0 = millis();
+    static const char pers[] = "wx-tls";
+    int rc = mbedtls_ctr_drbg_seed(&_drbg, mbedtls_entropy_func, &_entropy,
+                                   (const unsigned char *)pers, sizeof(pers) - 1);
+    if (rc == 0) {
+        rc = mbedtls_ssl_config_defaults(&_conf, MBEDTLS_SSL_IS_CLIENT,
+                                         MBEDTLS_SSL_TRANSPORT_STREAM,
+                                         MBEDTLS_SSL_PRESET_DEFAULT);
+    }
+    if (rc != 0) {
+        Serial.printf("TLS: setup failed: -0x%04X\n", -rc);
+        freeTls();
+        return false;
+    }
+    mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_NONE);
+    mbedtls_ssl_conf_rng(&_conf, mbedtls_ctr_drbg_random, &_drbg);
+#if MBEDTLS_VERSION_MAJOR >= 3
+    // Resumption is implemented for the TLS 1.2 handshake only.
+    mbedtls_ssl_conf_max_tls_version(&_conf, MBEDTLS_SSL_VERSION_TLS1_2);
+#endif
+#if defined(MBEDTLS_SSL_SESSION_TICKETS)
+    mbedtls_ssl_conf_session_tickets(&_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    rc = mbedtls_ssl_setup(&_ssl, &_conf);
+    if (rc == 0) rc = mbedtls_ssl_set_hostname(&_ssl, host);
+    if (rc != 0) {
+        Serial.printf("TLS: setup failed: -0x%04X\n", -rc);
+        freeTls();
+        return false;
+    }
+    mbedtls_ssl_set_bio(&_ssl, this, bioSend, bioRecv, nullptr);
+
+    if (offerSession) {
+        mbedtls_ssl_session cached;
+        mbedtls_ssl_session_init(&cached);
+        if (mbedtls_ssl_session_load(&cached, tls_session_buf, tls_session_len) != 0
+            || mbedtls_ssl_set_session(&_ssl, &cached) != 0) {
+            // E.g. saved by a firmware built with a different mbedtls config.
+            Serial.println("TLS: cached session unusable — full handshake");
+            tlsSessionClear();
+            offerSession = false;
+        }
+        mbedtls_ssl_session_free(&cached);
+    }
+
+    bool fullHandshake = false;
+    while (_ssl.MBEDTLS_PRIVATE(state) != MBEDTLS_SSL_HANDSHAKE_OVER) {
+        if (_ssl.MBEDTLS_PRIVATE(state) == MBEDTLS_SSL_CLIENT_KEY_EXCHANGE) fullHandshake = true;
+        rc = mbedtls_ssl_handshake_step(&_ssl);
+        if (rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE) {
+            if ((int32_t)(millis() - t0) >= timeoutMs) {
+                Serial.println("TLS: handshake timed out");
+                freeTls();
+                return false;
+            }
+            delay(1);
+            continue;
+        }
+        if (rc != 0) {
+            Serial.printf("TLS: handshake failed: -0x%04X\n", -rc);
+            freeTls();
+            return false;
+        }
+    }
+    _tlsUp       = true;
+    _resumed     = offerSession && !fullHandshake;
+    _handshakeMs = millis() - t0;
+    Serial.printf("TLS: %s handshake with %s in %lu ms%s\n",
+                  _resumed ? "resumed" : "full", host, _handshakeMs,
+                  (offerSession && !_resumed) ? " (cached session declined)" : "");
+
+    // Cache the session for the next wake — refreshed every connect, since the
+    // server may have issued a new ticket even on a resumed handshake.
+    mbedtls_ssl_session sess;
+    mbedtls_ssl_session_init(&sess);
+    size_t len = 0;
+    if (mbedtls_ssl_get_session(&_ssl, &sess) == 0
+        && mbedtls_ssl_session_save(&sess, tls_session_buf, sizeof(tls_session_buf), &len) == 0) {
+        tls_session_len = (uint16_t)len;
+        tls_host_hash   = hostHash(host);
+    } else {
+        Serial.println("TLS: session not cacheable (too large?)");
+        tlsSessionClear();
+    }
+    mbedtls_ssl_session_free(&sess);
+    return true;
+}
+
+// ─── WiFiClient interface ───────────────────────────────────────────────────
+
+ResumableTlsClient::~ResumableTlsClient() {
+    stop();
+}
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port) {
+    return connect(ip.toString().c_str(), port, TLS_CONNECT_TIMEOUT_MS);
+}
+
+int ResumableTlsClient::connect(IPAddress ip, uint16_t port, int32_t timeoutMs) {
+    return connect(ip.toString().c_str(), port, timeoutMs);
+}
+
+int ResumableTlsClient::connect(const char *host, uint16_t port) {
+    return connect(host, port, TLS_CONNECT_TIMEOUT_MS);
+}
+
+int ResumableTlsClient::connect(const char *host, uint16_t port, int32_t timeoutMs) {
+    stop();
+    if (!WiFiClient::connect(host, port, timeoutMs)) return 0;
+
+    bool offer = sessionCachedFor(host);
+    if (handshake(host, offer, timeoutMs)) return 1;
+
+    if (offer) {
+        // Some servers abort rather than fall back when they dislike a session.
+        Serial.println("TLS: retrying without the cached session");
+        tlsSessionClear();
+        WiFiClient::stop();
+        if (WiFiClient::connect(host, port, timeoutMs) && handshake(host, false, timeoutMs)) {
+            return 1;
+        }
+    }
+    stop();
+    return 0;
+}
+
+size_t ResumableTlsClient::write(uint8_t b) {
+    return write(&b, 1);
+}
+
+size_t ResumableTlsClient::write(const uint8_t *buf, size_t size) {
+    if (!_tlsUp) return 0;
+    size_t done = 0;
+    unsigned long t0 = millis();
+    while (done < size) {
+        int rc = mbedtls_ssl_write(&_ssl, buf + done, size - done);
+        if (rc > 0) {
+            done += rc;
+        } else if ((rc == MBEDTLS_ERR_SSL_WANT_READ || rc == MBEDTLS_ERR_SSL_WANT_WRITE)
+                   && millis() - t0 < TLS_CONNECT_TIMEOUT_MS) {
+            delay(1);
+        } else {
+            break;
+        }
+    }
+    return done;
+}
+
+int ResumableTlsClient::available() {
+    if (!_tlsUp) return 0;
+    int pending = (_peeked >= 0) ? 1 : 0;
+    if (!_peerClosed) {
+        // A zero-length read pulls in and decrypts the next record, if any.
+        int rc = mbedtls_ssl_read(&_ssl, nullptr, 0);
+        if (rc == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY) _peerClosed = true;
+    }
+    return pending + (int)mbedtls_ssl_get_bytes_avail(&_ssl);
+}
+
+int ResumableTlsClient::read() {
+    uint8_t b;
+    return read(&b, 1) == 1 ? b : -1;
+}
+
+int ResumableTlsClient::read(uint8_t *buf, size_t size) {
+    if (!_tlsUp || size == 0) return -1;
+    size_t off = 0;
+    if (_peeked >= 0) {
+        buf[off++] = (uint8_t)_peeked;
+        _peeked = -1;
+        if (off == size) return (int)off;
+    }
+    int rc = mbedtls_ssl_read(&_ssl, buf + off, size - off);
+    if (rc > 0) return (int)off + rc;
+    if (rc == MBEDTLS_ERR_SSL_PEER_CLOSE_NOTIFY || rc == 0) _peerClosed = true;
+    return off > 0 ? (int)off : -1;
+}
+
+int ResumableTlsClient::peek() {
+    if (_peeked < 0) {
+        uint8_t b;
+        if (available() > 0 && read(&b, 1) == 1) _peeked = b;
+    }
+    return _peeked;
+}
+
+void ResumableTlsClient::flush() {
+    // Nothing buffered on the write side. (WiFiClient::flush() would discard
+    // unread socket bytes — i.e. TLS records — so it must not be inherited.)
+}
+
+void ResumableTlsClient::stop() {
+    if (_tlsUp && !_peerClosed) mbedtls_ssl_close_notify(&_ssl);
+    freeTls();
+    WiFiClient::stop();
+    _peeked = -1;
+}
+
+uint8_t ResumableTlsClient::connected() {
+    if (!_tlsUp) return 0;
+    if (available() > 0) return 1;
+    return !_peerClosed && WiFiClient::connected();
+}
@@ -0,0 +1,74 @@
+// HTTPS transport that resumes its TLS session across deep sleep.
+//
+// WiFiClientSecure runs a full handshake (ECDHE key exchange + certificate) on
+// every connect, and every wake starts from nothing — hundreds of ms of CPU with
+// the radio up, before the first byte of weather. ResumableTlsClient is a
+// drop-in WiFiClient for HTTPClient / HTTPUpdate that keeps the negotiated
+// session (session ID or ticket) in RTC memory and offers it on the next
+// connect, so a server that still recognizes it completes an abbreviated
+// handshake: no certificate, no key exchange.
+//
+// Fallback is automatic: a server that declines the session just answers with a
+// full handshake (and that new session is cached instead). If a handshake with
+// a cached session fails outright, the session is dropped and the connect is
+// retried once from scratch.
+//
+// Like the setInsecure() clients it replaces, it does not verify the server
+// certificate.
+//
+// docs/tls-resumption.md has the procedure for measuring resumed against full
+// handshakes on a device.
+
+#pragma once
+
+#include <WiFiClient.h>
+
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ssl.h>
+
+class ResumableTlsClient : public WiFiClient {
+public:
+    ResumableTlsClient() = default;
+    ~ResumableTlsClient();
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(IPAddress ip, uint16_t port, int32_t timeoutMs) override;
+    int connect(const char *host, uint16_t port) override;
+    int connect(const char *host, uint16_t port, int32_t timeoutMs) override;
+
+    size_t  write(uint8_t b) override;
+    size_t  write(const uint8_t *buf, size_t size) override;
+    int     available() override;
+    int     read() override;
+    int     read(uint8_t *buf, size_t size) override;
+    int     peek() override;
+    void    flush() override;
+    void    stop() override;
+    uint8_t connected() override;
+
+    // Whether the last connect resumed a cached session, and what its handshake
+    // cost — logged per connect; handy for comparing wakes.
+    bool          resumed() const     { return _resumed; }
+    unsigned long handshakeMs() const { return _handshakeMs; }
+
+private:
+    bool handshake(const char *host, bool offerSession, int32_t timeoutMs);
+    void freeTls();
+    static int bioSend(void *ctx, const unsigned char *buf, size_t len);
+    static int bioRecv(void *ctx, unsigned char *buf, size_t len);
+
+    mbedtls_ssl_context      _ssl;
+    mbedtls_ssl_config       _conf;
+    mbedtls_entropy_context  _entropy;
+    mbedtls_ctr_drbg_context _drbg;
+    bool          _tlsLive     = false;  // mbedtls contexts initialized
+    bool          _tlsUp       = false;  // handshake complete, not yet stopped
+    bool          _peerClosed  = false;  // close_notify received
+    bool          _resumed     = false;
+    unsigned long _handshakeMs = 0;
+    int           _peeked      = -1;
+};
+
+// Forgets the cached session, so the next connect does a full handshake.
+void tlsSessionClear();
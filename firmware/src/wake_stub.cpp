@@ -0,0 +1,69 @@
+#include "wake_stub.h"
+
+#include <esp_attr.h>
+#include <esp_sleep.h>
+#include <esp_rom_sys.h>
+#include <driver/rtc_io.h>
+#include <soc/rtc.h>
+#include <soc/rtc_cntl_reg.h>
+#include <soc/rtc_io_reg.h>
+
+#include "config.h"
+
+// Sampling period while timing the press.
+#define STUB_POLL_MS  10
+
+// Shared with the stub, so it all lives in RTC memory. stub_rtcio < 0 = unarmed.
+RTC_DATA_ATTR static int8_t   stub_rtcio    = -1;
+RTC_DATA_ATTR static uint8_t  stub_verdict  = holdclass::PENDING;
+RTC_DATA_ATTR static uint32_t stub_rejected = 0;
+
+void wakeStubArm(gpio_num_t button) {
+    stub_rtcio = (int8_t)rtc_io_number_get(button);
+}
+
+holdclass::Verdict wakeStubVerdict() {
+    return (holdclass::Verdict)stub_verdict;
+}
+
+uint32_t wakeStubTakeRejectedTaps() {
+    uint32_t n = stub_rejected;
+    stub_rejected = 0;
+    return n;
+}
+
+// Replaces the IDF's default (weak) stub. Everything it calls must be in ROM or
+// RTC IRAM: register access, esp_rom_delay_us, and the inlined classifier.
+extern "C" void RTC_IRAM_ATTR esp_wake_deep_sleep(void) {
+    esp_default_wake_deep_sleep();
+
+    stub_verdict = holdclass::PENDING;
+    uint32_t cause = REG_GET_FIELD(RTC_CNTL_SLP_WAKEUP_CAUSE_REG, RTC_CNTL_WAKEUP_CAUSE);
+    if (stub_rtcio < 0 || !(cause & RTC_EXT0_TRIG_EN)) return;  // not ours: full boot
+
+    holdclass::State st = {};
+    holdclass::Verdict v;
+    do {
+        esp_rom_delay_us(STUB_POLL_MS * 1000);
+        bool pressed = !((REG_READ(RTC_GPIO_IN_REG) >> (RTC_GPIO_IN_NEXT_S + stub_rtcio)) & 1);
+        v = holdclass::step(st, pressed, STUB_POLL_MS, BUTTON_HOLD_MS, BUTTON_DEBOUNCE_MS);
+    } while (v == holdclass::PENDING);
+
+    stub_verdict = v;
+    if (v == holdclass::HOLD) return;  // deliberate: boot into the menu
+
+    // Accidental tap: back to sleep with the wake sources as they were (the RTC
+    // timer target is absolute, so the next weather wake keeps its schedule).
+    // This is esp_wake_stub_sleep() from ESP-IDF 5.x, which the Arduino core's
+    // IDF 4.4 doesn't have: clear the wakeup/reject interrupts this wake latched
+    // (as rtc_sleep_start() does before every sleep), re-arm this stub, set
+    // SLEEP_EN. ext0 keeps no status of its own to clear; the button is up, so
+    // its level trigger isn't pending either.
+    stub_rejected++;
+    REG_WRITE(RTC_CNTL_INT_CLR_REG, RTC_CNTL_SLP_REJECT_INT_CLR | RTC_CNTL_SLP_WAKEUP_INT_CLR);
+    REG_WRITE(RTC_ENTRY_ADDR_REG, (uint32_t)(uintptr_t)&esp_wake_deep_sleep);
+    SET_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_SLEEP_EN);
+    while (true) {
+        // The sleep takes a few cycles to engage.
+    }
+}
@@ -0,0 +1,28 @@
+// Deep-sleep wake stub: rejects accidental button taps without a full boot.
+//
+// When the button (ext0) wakes the chip, the stub runs from RTC memory straight
+// out of the ROM bootloader — before the second-stage bootloader, flash, the
+// Arduino core or Serial — and times the press itself (hold_classifier.h). A
+// tap puts the chip straight back to sleep with the same wake sources, so the
+// timer keeps its original schedule; only a confirmed long press, or any other
+// wake cause, continues into the firmware. A bumped device costs a few ms of
+// CPU on the ROM clock instead of a ~1 s boot.
+
+#pragma once
+
+#include <stdint.h>
+#include <driver/gpio.h>
+
+#include "hold_classifier.h"
+
+// Arms the stub for the next deep sleep to watch `button` (an RTC-capable GPIO,
+// already configured as the ext0 source). Call right before sleeping.
+void wakeStubArm(gpio_num_t button);
+
+// The stub's verdict for this wake: HOLD for a long press it confirmed, or
+// PENDING when it didn't classify the wake (timer wake, or not armed — e.g. the
+// first sleep after flashing), in which case setup() classifies it itself.
+holdclass::Verdict wakeStubVerdict();
+
+// Taps the stub rejected since the last full boot; resets the count.
+uint32_t wakeStubTakeRejectedTaps();
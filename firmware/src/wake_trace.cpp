@@ -0,0 +1,86 @@
+#include "wake_trace.h"
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Wakes kept for reporting. At the default cadence that's over an hour of
+// history to cover a run of failed fetches; older records are overwritten.
+#define TRACE_RING_SIZE  8
+
+struct WakeRecord {
+    uint32_t boot;
+    uint16_t ms[TP_COUNT];   // saturates at 65535
+    uint8_t  flags;
+};
+
+// ─── RTC memory — survives deep sleep ────────────────────────────────────────
+RTC_DATA_ATTR static WakeRecord trace_ring[TRACE_RING_SIZE];
+RTC_DATA_ATTR static uint8_t    trace_head   = 0;   // next slot to write
+RTC_DATA_ATTR static uint8_t    trace_unsent = 0;   // newest records not yet reported
+
+static WakeRecord cur;
+
+void traceBegin(uint32_t bootCount) {
+    memset(&cur, 0, sizeof(cur));
+    cur.boot = bootCount;
+    // esp_timer starts at app start; the ROM + bootloader stages before it are
+    // a roughly fixed ~100 ms not counted here.
+    traceAdd(TP_BOOT, (uint32_t)(esp_timer_get_time() / 1000));
+}
+
+void traceAdd(TracePhase phase, uint32_t ms) {
+    uint32_t v = cur.ms[phase] + ms;
+    cur.ms[phase] = v > 0xFFFF ? 0xFFFF : (uint16_t)v;
+}
+
+void traceFlag(uint8_t flags) {
+    cur.flags |= flags;
+}
+
+uint8_t traceFlags() {
+    return cur.flags;
+}
+
+uint32_t tracePhaseMs(TracePhase phase) {
+    return cur.ms[phase];
+}
+
+void traceCommit() {
+    uint32_t awake = (uint32_t)(esp_timer_get_time() / 1000);
+    cur.ms[TP_AWAKE] = awake > 0xFFFF ? 0xFFFF : (uint16_t)awake;
+    trace_ring[trace_head] = cur;
+    trace_head = (trace_head + 1) % TRACE_RING_SIZE;
+    if (trace_unsent < TRACE_RING_SIZE) trace_unsent++;
+
+    Serial.printf("Trace #%u: boot %u nvs %u assoc %u dhcp %u ntp %u tls %u ttfb %u "
+                  "dl %u (decode %u) epd %u ota %u | awake %u ms, flags 0x%02X\n",
+                  (unsigned)cur.boot, cur.ms[TP_BOOT], cur.ms[TP_NVS], cur.ms[TP_ASSOC],
+                  cur.ms[TP_DHCP], cur.ms[TP_NTP], cur.ms[TP_TLS], cur.ms[TP_TTFB],
+                  cur.ms[TP_DOWNLOAD], cur.ms[TP_DECODE], cur.ms[TP_EPD], cur.ms[TP_OTA],
+                  cur.ms[TP_AWAKE], cur.flags);
+}
+
+size_t traceHeader(char *buf, size_t bufSize, const char *deviceId) {
+    if (trace_unsent == 0 || bufSize == 0) return 0;
+    size_t len = snprintf(buf, bufSize, "%s ", deviceId);
+    for (int i = trace_unsent; i > 0 && len < bufSize; i--) {
+        const WakeRecord &r = trace_ring[(trace_head + TRACE_RING_SIZE - i) % TRACE_RING_SIZE];
+        len += snprintf(buf + len, bufSize - len, "%s%u:%u:", i == trace_unsent ? "" : ";",
+                        (unsigned)r.boot, r.flags);
+        for (int p = 0; p < TP_COUNT && len < bufSize; p++) {
+            len += snprintf(buf + len, bufSize - len, p ? ",%u" : "%u", r.ms[p]);
+        }
+    }
+    if (len >= bufSize) return 0;  // truncated: send nothing rather than garbage
+    return len;
+}
+
+void traceMarkSent() {
+    trace_unsent = 0;
+}
+
+TraceScope::TraceScope(TracePhase p) : phase(p), t0(millis()) {}
+
+TraceScope::~TraceScope() {
+    traceAdd(phase, millis() - t0);
+}
@@ -0,0 +1,72 @@
+// Per-wake phase profiler.
+//
+// Each wake accumulates how long it spent in each phase (ms) plus a few flags
+// about the path it took, and commits the record to a small ring in RTC memory
+// at sleep entry. The records not yet reported ride along on the next weather
+// request as an X-Wake-Trace header, which the worker logs — so where wake time
+// (and so battery) goes is visible across the fleet without a serial cable.
+//
+// Header format (one line, ';'-separated records, oldest first):
+//   X-Wake-Trace: <device-id> <boot>:<flags>:<ms>,<ms>,...;<boot>:...
+// with the ms values in TracePhase order. The worker's WAKE_TRACE_PHASES must
+// list the same names in the same order.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum TracePhase : uint8_t {
+    TP_BOOT = 0,   // reset → setup() (bootloader + app init)
+    TP_NVS,        // config load from NVS
+    TP_ASSOC,      // WiFi association
+    TP_DHCP,       // association → IP (≈0 on the cached-lease fast path)
+    TP_NTP,        // background NTP round-trip, when one ran and finished
+    TP_TLS,        // TLS handshake (part of TTFB)
+    TP_TTFB,       // GET issued → response headers (TCP + TLS + server)
+    TP_DOWNLOAD,   // body transfer, with the streaming hash + decode
+    TP_DECODE,     // of which: CPU in the PNG decoder (rest is network wait)
+    TP_EPD,        // display bring-up + panel refreshes
+    TP_OTA,        // firmware update attempt
+    TP_AWAKE,      // total: reset → sleep entry
+    TP_COUNT
+};
+
+enum : uint8_t {
+    TF_WIFI_FAST    = 1 << 0,  // cached AP + lease reconnect
+    TF_TLS_RESUMED  = 1 << 1,  // abbreviated TLS handshake
+    TF_NOT_MODIFIED = 1 << 2,  // 304 — no body
+    TF_FETCH_FAILED = 1 << 3,
+    TF_DISPLAY      = 1 << 4,  // the panel was refreshed
+};
+
+// Starts this wake's record. Call first thing in setup().
+void traceBegin(uint32_t bootCount);
+
+// Adds `ms` to a phase (phases can be entered more than once per wake).
+void traceAdd(TracePhase phase, uint32_t ms);
+
+void traceFlag(uint8_t flags);
+uint8_t traceFlags();
+
+// This wake's time so far in a phase (TP_AWAKE is set by traceCommit()).
+uint32_t tracePhaseMs(TracePhase phase);
+
+// Closes this wake's record (TP_AWAKE = now) into the RTC ring and logs it.
+// Call at sleep entry.
+void traceCommit();
+
+// Writes the X-Wake-Trace value for the committed records not yet reported into
+// buf. Returns its length, or 0 when there's nothing to send.
+size_t traceHeader(char *buf, size_t bufSize, const char *deviceId);
+
+// The server got the header: drop the records it carried.
+void traceMarkSent();
+
+// Times the enclosing scope into a phase.
+struct TraceScope {
+    TracePhase    phase;
+    unsigned long t0;
+    explicit TraceScope(TracePhase p);
+    ~TraceScope();
+};
@@ -0,0 +1,160 @@
+// Host benchmark: PNG row → 4bpp framebuffer conversion, per frame.
+//
+// Times the two paths png_draw_callback() has had over the same decoded rows:
+//   per-pixel  PNGdec's getLineAsRGB565() then, for every pixel, RGB565 → luma
+//              and epd_draw_pixel() (the path before scanline.h; still the
+//              fallback for formats without a kernel)
+//   kernels    the scanline.h kernel for the row's format
+// Decoding itself is the same for both on the device and isn't timed.
+//
+// Usage: bench_scanline [--iterations N] file.png ...
+// (`make bench` runs it on the baked splash/menu/setup PNGs)
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "png_host.h"
+#include "scanline.h"
+
+static const int EPD_WIDTH  = 960;
+static const int EPD_HEIGHT = 540;
+
+// ── the per-pixel path, as the device ran it ────────────────────────────────
+
+// LilyGo-EPD47's epd_draw_pixel().
+static void epd_draw_pixel(int x, int y, uint8_t color, uint8_t *framebuffer) {
+    if (x < 0 || x >= EPD_WIDTH) return;
+    if (y < 0 || y >= EPD_HEIGHT) return;
+    uint8_t *buf_ptr = &framebuffer[y * EPD_WIDTH / 2 + x / 2];
+    if (x % 2) {
+        *buf_ptr = (*buf_ptr & 0x0F) | (color & 0xF0);
+    } else {
+        *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
+    }
+}
+
+static inline uint16_t rgb565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+// PNGdec's getLineAsRGB565() for the 8-bit formats, alpha blended onto white.
+static void lineAsRgb565(const HostPng &png, const uint8_t *s, uint16_t *out) {
+    for (int x = 0; x < png.width; x++) {
+        uint8_t r, g, b, a = 255;
+        switch (png.colorType) {
+            case 0: r = g = b = s[x]; break;
+            case 2: r = s[3 * x]; g = s[3 * x + 1]; b = s[3 * x + 2]; break;
+            case 3: {
+                const uint8_t *p = png.palette + 3 * s[x];
+                r = p[0]; g = p[1]; b = p[2];
+                a = png.palette[768 + s[x]];
+                break;
+            }
+            case 4: r = g = b = s[2 * x]; a = s[2 * x + 1]; break;
+            default: r = s[4 * x]; g = s[4 * x + 1]; b = s[4 * x + 2]; a = s[4 * x + 3]; break;
+        }
+        if (a != 255) {
+            r = scanline::overWhite(r, a);
+            g = scanline::overWhite(g, a);
+            b = scanline::overWhite(b, a);
+        }
+        out[x] = rgb565(r, g, b);
+    }
+}
+
+static void perPixelFrame(const HostPng &png, uint8_t *fb) {
+    static uint16_t line[EPD_WIDTH + 16];
+    const int w = png.width < EPD_WIDTH ? png.width : EPD_WIDTH;
+    for (int y = 0; y < png.height && y < EPD_HEIGHT; y++) {
+        lineAsRgb565(png, png.row(y), line);
+        for (int x = 0; x < w; x++) {
+            uint16_t rgb = line[x];
+            uint8_t r = ((rgb >> 11) & 0x1F) << 3;
+            uint8_t g = ((rgb >> 5)  & 0x3F) << 2;
+            uint8_t b = ( rgb        & 0x1F) << 3;
+            epd_draw_pixel(x, y, scanline::luma(r, g, b), fb);
+        }
+    }
+}
+
+// ── the kernels, dispatched as png_draw_callback() does ─────────────────────
+
+static bool kernelFrame(const HostPng &png, uint8_t *fb) {
+    static uint8_t lut[256];
+    const int w = png.width < EPD_WIDTH ? png.width : EPD_WIDTH;
+    if (png.colorType == 3) {
+        scanline::buildPaletteLut(lut, png.palette, png.hasAlpha ? png.palette + 768 : nullptr);
+    }
+    for (int y = 0; y < png.height && y < EPD_HEIGHT; y++) {
+        const uint8_t *src = png.row(y);
+        uint8_t *dst = fb + y * (EPD_WIDTH / 2);
+        switch (png.colorType * 100 + png.bitDepth) {
+            case 8:   scanline::blitRow<scanline::Gray8>(dst, src, w); break;
+            case 4:   scanline::blitRow<scanline::Gray4>(dst, src, w); break;
+            case 408: scanline::blitRow<scanline::GrayAlpha8>(dst, src, w); break;
+            case 208: scanline::blitRow<scanline::Rgb8>(dst, src, w); break;
+            case 608: scanline::blitRow<scanline::Rgba8>(dst, src, w); break;
+            case 308: scanline::blitRow<scanline::Indexed<8>>(dst, src, w, lut); break;
+            case 304: scanline::blitRow<scanline::Indexed<4>>(dst, src, w, lut); break;
+            case 302: scanline::blitRow<scanline::Indexed<2>>(dst, src, w, lut); break;
+            case 301: scanline::blitRow<scanline::Indexed<1>>(dst, src, w, lut); break;
+            default:  return false;
+        }
+    }
+    return true;
+}
+
+template <typename F>
+static double msPerFrame(int iterations, F frame) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) frame();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count() / iterations;
+}
+
+int main(int argc, char **argv) {
+    int iterations = 200;
+    std::vector<const char *> files;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc) iterations = atoi(argv[++i]);
+        else files.push_back(argv[i]);
+    }
+    if (files.empty()) {
+        fprintf(stderr, "usage: bench_scanline [--iterations N] file.png ...\n");
+        return 2;
+    }
+
+    static uint8_t fbOld[EPD_WIDTH * EPD_HEIGHT / 2], fbNew[EPD_WIDTH * EPD_HEIGHT / 2];
+    printf("%-28s %10s %10s %8s %10s\n", "image", "per-pixel", "kernels", "speedup", "levels≠");
+    int status = 0;
+    for (const char *path : files) {
+        HostPng png;
+        if (!loadPng(path, png)) { status = 1; continue; }
+        const char *name = strrchr(path, '/') ? strrchr(path, '/') + 1 : path;
+        if (png.bitDepth != 8 && !(png.colorType == 3 || (png.colorType == 0 && png.bitDepth == 4))) {
+            printf("%-28s (no kernel for color type %d, %d-bit)\n", name, png.colorType, png.bitDepth);
+            continue;
+        }
+        memset(fbOld, 0xFF, sizeof(fbOld));
+        memset(fbNew, 0xFF, sizeof(fbNew));
+        bool oldPath = png.bitDepth == 8;  // the RGB565 helper above covers 8-bit only
+        double msOld = oldPath ? msPerFrame(iterations, [&] { perPixelFrame(png, fbOld); }) : 0;
+        double msNew = msPerFrame(iterations, [&] { kernelFrame(png, fbNew); });
+
+        // Pixels whose level differs: the RGB565 round trip truncated gray.
+        int differ = 0;
+        for (size_t i = 0; oldPath && i < sizeof(fbOld); i++) {
+            differ += (fbOld[i] & 0x0F) != (fbNew[i] & 0x0F);
+            differ += (fbOld[i] & 0xF0) != (fbNew[i] & 0xF0);
+        }
+        if (oldPath) {
+            printf("%-28s %7.3f ms %7.3f ms %7.1fx %10d\n", name, msOld, msNew, msOld / msNew, differ);
+        } else {
+            printf("%-28s %10s %7.3f ms\n", name, "-", msNew);
+        }
+    }
+    return status;
+}
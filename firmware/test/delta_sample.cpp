@@ -0,0 +1,99 @@
+// Stand-in firmware for the delta round trip in `make check`: built twice, as
+// two consecutive releases. Release 2 adds a function ahead of most of the code
+// and bumps the version string — the linker then shifts everything after it
+// and every call/address into the shifted code changes, which is what
+// make_delta.py's COPY/ADD ops are for. The code is the firmware's own
+// platform-free headers, so the bytes look like real compiled firmware.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "delta_patch.h"
+#include "hold_classifier.h"
+#include "ota_image.h"
+#include "scanline.h"
+
+#ifndef SAMPLE_VERSION
+#define SAMPLE_VERSION 1
+#endif
+
+static const char *const VERSION = SAMPLE_VERSION >= 2 ? "sample 1.1.0" : "sample 1.0.0";
+
+#if SAMPLE_VERSION >= 2
+// The release's new feature: a checksum over the framebuffer.
+__attribute__((noinline)) static uint32_t frameChecksum(const uint8_t *fb, size_t n) {
+    uint32_t a = 1, b = 0;
+    for (size_t i = 0; i < n; i++) {
+        a = (a + fb[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return b << 16 | a;
+}
+#endif
+
+static uint8_t fb[960 * 540 / 2];
+static uint8_t row[960 * 4];
+static uint8_t lut[256], palette[1024];
+
+template <typename Src>
+__attribute__((noinline)) static void fill(const uint8_t *lutOrNull) {
+    for (int y = 0; y < 540; y++) scanline::blitRow<Src>(fb + y * 480, row, 960, lutOrNull);
+}
+
+struct MemIo {
+    const uint8_t *patch;
+    uint32_t len, pos;
+};
+
+__attribute__((noinline)) static bool applyEmpty(const uint8_t *patch, uint32_t len) {
+    MemIo m = {patch, len, 0};
+    delta::Io io = {
+        &m,
+        [](void *c, uint8_t *b, uint32_t n) {
+            MemIo &m = *(MemIo *)c;
+            if (n > m.len - m.pos) return false;
+            memcpy(b, m.patch + m.pos, n);
+            m.pos += n;
+            return true;
+        },
+        [](void *, uint32_t off, uint8_t *b, uint32_t n) { memset(b, (int)off, n); return true; },
+        [](void *, const uint8_t *, uint32_t) { return true; },
+    };
+    delta::Header h;
+    return delta::readHeader(io, h) && delta::apply(io, h);
+}
+
+int main(int argc, char **argv) {
+    srand((unsigned)argc);
+    for (size_t i = 0; i < sizeof(row); i++) row[i] = (uint8_t)rand();
+    for (size_t i = 0; i < sizeof(palette); i++) palette[i] = (uint8_t)rand();
+    scanline::buildPaletteLut(lut, palette, palette + 768);
+
+    fill<scanline::Gray8>(nullptr);
+    fill<scanline::GrayAlpha8>(nullptr);
+    fill<scanline::Rgb8>(nullptr);
+    fill<scanline::Rgba8>(nullptr);
+    fill<scanline::Gray4>(nullptr);
+    fill<scanline::Indexed<8>>(lut);
+    fill<scanline::Indexed<4>>(lut);
+    fill<scanline::Indexed<2>>(lut);
+    fill<scanline::Indexed<1>>(lut);
+
+    holdclass::State st = {};
+    int verdict = holdclass::PENDING;
+    for (uint32_t t = 10; verdict == holdclass::PENDING; t += 10) {
+        verdict = holdclass::step(st, (rand() & 3) != 0, 10, 1500, 30);
+    }
+
+    otaimg::Header oh;
+    bool headerOk = otaimg::parseHeader(row, oh);
+    bool patchOk  = applyEmpty(row, argc > 1 ? (uint32_t)atoi(argv[1]) : 0);
+
+    printf("%s: fb[0]=%u verdict=%d header=%d patch=%d\n", VERSION, fb[0], verdict, headerOk,
+           patchOk);
+#if SAMPLE_VERSION >= 2
+    printf("checksum %08x\n", (unsigned)frameChecksum(fb, sizeof(fb)));
+#endif
+    return 0;
+}
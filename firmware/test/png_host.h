@@ -0,0 +1,114 @@
+// Minimal PNG reader for the host tests: inflates and unfilters a non-interlaced
+// PNG into its raw scanlines — the rows PNGdec hands png_draw_callback() on the
+// device, before any pixel conversion. zlib does the inflating.
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <zlib.h>
+
+struct HostPng {
+    int width = 0, height = 0;
+    int bitDepth = 0, colorType = 0;
+    int rowBytes = 0;
+    std::vector<uint8_t> rows;      // height × rowBytes, unfiltered
+    uint8_t palette[1024] = {};     // RGB triplets, then alpha at +768 (PNGdec layout)
+    bool hasAlpha = false;          // tRNS present
+
+    const uint8_t *row(int y) const { return rows.data() + (size_t)y * rowBytes; }
+};
+
+static inline std::vector<uint8_t> readFile(const char *path) {
+    std::vector<uint8_t> data;
+    FILE *f = fopen(path, "rb");
+    if (!f) return data;
+    uint8_t buf[65536];
+    size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) data.insert(data.end(), buf, buf + n);
+    fclose(f);
+    return data;
+}
+
+static inline uint32_t be32(const uint8_t *p) {
+    return (uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3];
+}
+
+// False (with a message on stderr) if the file isn't a PNG this can read.
+static inline bool loadPng(const char *path, HostPng &png) {
+    std::vector<uint8_t> file = readFile(path);
+    if (file.size() < 8 || memcmp(file.data(), "\x89PNG\r\n\x1a\n", 8) != 0) {
+        fprintf(stderr, "%s: not a PNG\n", path);
+        return false;
+    }
+    std::vector<uint8_t> idat;
+    memset(png.palette + 768, 0xFF, 256);
+    for (size_t pos = 8; pos + 12 <= file.size();) {
+        uint32_t len = be32(&file[pos]);
+        const uint8_t *type = &file[pos + 4], *data = &file[pos + 8];
+        if (pos + 12 + len > file.size()) break;
+        if (!memcmp(type, "IHDR", 4)) {
+            png.width     = (int)be32(data);
+            png.height    = (int)be32(data + 4);
+            png.bitDepth  = data[8];
+            png.colorType = data[9];
+            if (data[12] != 0) {
+                fprintf(stderr, "%s: interlaced PNGs aren't supported\n", path);
+                return false;
+            }
+        } else if (!memcmp(type, "PLTE", 4)) {
+            memcpy(png.palette, data, len < 768 ? len : 768);
+        } else if (!memcmp(type, "tRNS", 4) && png.colorType == 3) {
+            memcpy(png.palette + 768, data, len < 256 ? len : 256);
+            png.hasAlpha = true;
+        } else if (!memcmp(type, "IDAT", 4)) {
+            idat.insert(idat.end(), data, data + len);
+        }
+        pos += 12 + len;
+    }
+
+    static const int channels[] = {1, 0, 3, 1, 2, 0, 4};
+    if (png.width <= 0 || png.height <= 0 || png.colorType > 6 || !channels[png.colorType]) {
+        fprintf(stderr, "%s: unsupported header\n", path);
+        return false;
+    }
+    const int bitsPerPixel = channels[png.colorType] * png.bitDepth;
+    const int bpp = bitsPerPixel >= 8 ? bitsPerPixel / 8 : 1;  // filter stride
+    png.rowBytes = (png.width * bitsPerPixel + 7) / 8;
+
+    std::vector<uint8_t> raw((size_t)(png.rowBytes + 1) * png.height);
+    uLongf rawLen = raw.size();
+    if (uncompress(raw.data(), &rawLen, idat.data(), idat.size()) != Z_OK || rawLen != raw.size()) {
+        fprintf(stderr, "%s: bad image data\n", path);
+        return false;
+    }
+
+    png.rows.assign((size_t)png.rowBytes * png.height, 0);
+    for (int y = 0; y < png.height; y++) {
+        const uint8_t *in = &raw[(size_t)y * (png.rowBytes + 1)];
+        uint8_t *out = &png.rows[(size_t)y * png.rowBytes];
+        const uint8_t *up = y ? out - png.rowBytes : nullptr;
+        for (int i = 0; i < png.rowBytes; i++) {
+            int a = i >= bpp ? out[i - bpp] : 0;
+            int b = up ? up[i] : 0;
+            int c = (up && i >= bpp) ? up[i - bpp] : 0;
+            int pred = 0;
+            switch (in[0]) {
+                case 1: pred = a; break;
+                case 2: pred = b; break;
+                case 3: pred = (a + b) / 2; break;
+                case 4: {
+                    int p = a + b - c, pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+                    pred = (pa <= pb && pa <= pc) ? a : (pb <= pc ? b : c);
+                    break;
+                }
+            }
+            out[i] = (uint8_t)(in[1 + i] + pred);
+        }
+    }
+    return true;
+}
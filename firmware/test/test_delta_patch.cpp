@@ -0,0 +1,143 @@
+// Host test: delta_patch.h against patches from scripts/make_delta.py.
+//
+// Applies <patch> to <old.bin> the way the device does (patch pulled in order,
+// source read at random, target appended) and checks the result is <new.bin>
+// byte for byte, then that cut-short and tampered patches are rejected.
+//
+// Usage: test_delta_patch <old.bin> <new.bin> <patch>
+// (`make check` runs it on two builds of delta_sample.cpp; `make delta-check
+// OLD=… NEW=…` on any pair, e.g. two PlatformIO firmware.bin builds)
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "delta_patch.h"
+#include "png_host.h"  // readFile()
+#include "test.h"
+
+struct Run {
+    const std::vector<uint8_t> *source;
+    const uint8_t *patch;
+    uint32_t patchLen, patchPos = 0;
+    uint32_t targetLimit;  // the header's target size
+    std::vector<uint8_t> target;
+    bool sourceInBounds = true;
+};
+
+static bool readPatch(void *ctx, uint8_t *buf, uint32_t n) {
+    Run &r = *(Run *)ctx;
+    if (n > r.patchLen - r.patchPos) return false;  // the stream ended early
+    memcpy(buf, r.patch + r.patchPos, n);
+    r.patchPos += n;
+    return true;
+}
+
+static bool readSource(void *ctx, uint32_t off, uint8_t *buf, uint32_t n) {
+    Run &r = *(Run *)ctx;
+    if (off > r.source->size() || n > r.source->size() - off) {
+        r.sourceInBounds = false;
+        return false;
+    }
+    memcpy(buf, r.source->data() + off, n);
+    return true;
+}
+
+static bool writeTarget(void *ctx, const uint8_t *buf, uint32_t n) {
+    Run &r = *(Run *)ctx;
+    if (n > r.targetLimit - r.target.size()) return false;  // past the inactive slot's image
+    r.target.insert(r.target.end(), buf, buf + n);
+    return true;
+}
+
+// readHeader() + apply() over the first `len` bytes of `patch`.
+static bool applyPatch(const std::vector<uint8_t> &source, const uint8_t *patch, uint32_t len,
+                       Run &r) {
+    r.source   = &source;
+    r.patch    = patch;
+    r.patchLen = len;
+    delta::Io io = {&r, readPatch, readSource, writeTarget};
+    delta::Header h;
+    if (!delta::readHeader(io, h)) return false;
+    r.targetLimit = h.targetSize;
+    return delta::apply(io, h);
+}
+
+static void testRoundTrip(const std::vector<uint8_t> &oldBin, const std::vector<uint8_t> &newBin,
+                          const std::vector<uint8_t> &patch) {
+    Run r;
+    CHECK(applyPatch(oldBin, patch.data(), (uint32_t)patch.size(), r));
+    CHECK(r.sourceInBounds);
+    CHECK_EQ(r.patchPos, patch.size());  // END is the last byte
+    CHECK_EQ(r.target.size(), newBin.size());
+    CHECK(r.target == newBin);
+
+    CHECK_EQ(delta::le32(&patch[4]), oldBin.size());
+    CHECK_EQ(delta::le32(&patch[8]), newBin.size());
+    printf("%u → %u bytes, patch %u bytes (%.1f%%)\n", (unsigned)oldBin.size(),
+           (unsigned)newBin.size(), (unsigned)patch.size(), 100.0 * patch.size() / newBin.size());
+}
+
+static void testTruncated(const std::vector<uint8_t> &oldBin, const std::vector<uint8_t> &patch) {
+    // A download that stops early, anywhere: inside the header, right after it,
+    // mid-op, and one byte short (END missing).
+    const uint32_t size = (uint32_t)patch.size();
+    std::vector<uint32_t> cuts = {0, delta::HEADER_SIZE - 1, delta::HEADER_SIZE, size - 1};
+    for (uint32_t i = 1; i < 64; i++) cuts.push_back((uint32_t)((uint64_t)size * i / 64));
+    for (uint32_t cut : cuts) {
+        if (cut >= size) continue;
+        Run r;
+        bool ok = applyPatch(oldBin, patch.data(), cut, r);
+        CHECK(!ok);
+        if (ok) fprintf(stderr, "  accepted a patch cut at %u of %u bytes\n", cut, size);
+        CHECK(r.sourceInBounds);
+    }
+}
+
+static void testTampered(const std::vector<uint8_t> &oldBin, const std::vector<uint8_t> &patch) {
+    // Wrong magic.
+    std::vector<uint8_t> bad = patch;
+    bad[0] ^= 0xFF;
+    Run r1;
+    CHECK(!applyPatch(oldBin, bad.data(), (uint32_t)bad.size(), r1));
+
+    // A target size one short: the last op overruns it.
+    bad = patch;
+    uint32_t target = delta::le32(&bad[8]) - 1;
+    memcpy(&bad[8], &target, 4);  // little-endian host
+    Run r2;
+    CHECK(!applyPatch(oldBin, bad.data(), (uint32_t)bad.size(), r2));
+
+    // A source size one short: some COPY/ADD (the image's tail, at least) now
+    // reads past it and must be refused before the source is touched.
+    bad = patch;
+    uint32_t source = delta::le32(&bad[4]) - 1;
+    memcpy(&bad[4], &source, 4);
+    std::vector<uint8_t> shortOld(oldBin.begin(), oldBin.end() - 1);
+    Run r3;
+    applyPatch(shortOld, bad.data(), (uint32_t)bad.size(), r3);
+    CHECK(r3.sourceInBounds);
+
+    // An unknown op right after the header.
+    bad.assign(patch.begin(), patch.begin() + delta::HEADER_SIZE);
+    bad.push_back(0x7F);
+    Run r4;
+    CHECK(!applyPatch(oldBin, bad.data(), (uint32_t)bad.size(), r4));
+}
+
+int main(int argc, char **argv) {
+    if (argc != 4) {
+        fprintf(stderr, "usage: test_delta_patch <old.bin> <new.bin> <patch>\n");
+        return 2;
+    }
+    std::vector<uint8_t> oldBin = readFile(argv[1]), newBin = readFile(argv[2]),
+                         patch = readFile(argv[3]);
+    if (oldBin.empty() || newBin.empty() || patch.size() <= delta::HEADER_SIZE) {
+        fprintf(stderr, "test_delta_patch: can't read the images or the patch\n");
+        return 2;
+    }
+    testRoundTrip(oldBin, newBin, patch);
+    testTruncated(oldBin, patch);
+    testTampered(oldBin, patch);
+    return testSummary("delta_patch");
+}
@@ -0,0 +1,117 @@
+// Host test: hold_classifier.h — long hold vs accidental tap on a button wake.
+//
+// Drives holdclass::step() the way the wake stub does (a sample every
+// STUB_POLL_MS, from the wake) with scripted button traces.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "hold_classifier.h"
+#include "test.h"
+
+// The wake stub's parameters (wake_stub.cpp, config.h).
+static const uint32_t POLL_MS     = 10;
+static const uint32_t HOLD_MS     = 1500;
+static const uint32_t DEBOUNCE_MS = 30;
+
+struct Outcome {
+    holdclass::Verdict verdict;
+    uint32_t atMs;  // time of the deciding sample
+};
+
+// Samples `pressed(t)` at t = POLL_MS, 2·POLL_MS, … until a verdict (or a
+// generous cap, which only a classifier that never decides would reach).
+template <typename Trace>
+static Outcome run(Trace pressed) {
+    holdclass::State st = {};
+    for (uint32_t t = POLL_MS; t <= 10 * HOLD_MS; t += POLL_MS) {
+        holdclass::Verdict v = holdclass::step(st, pressed(t), POLL_MS, HOLD_MS, DEBOUNCE_MS);
+        if (v != holdclass::PENDING) return {v, t};
+    }
+    return {holdclass::PENDING, 10 * HOLD_MS};
+}
+
+static void testTap() {
+    // Pressed for 100 ms: TAP once it has stayed released for the debounce window.
+    Outcome o = run([](uint32_t t) { return t <= 100; });
+    CHECK_EQ(o.verdict, holdclass::TAP);
+    CHECK_EQ(o.atMs, 100 + DEBOUNCE_MS);
+
+    // Already released at the first sample (a glitch woke us): TAP after debounce.
+    o = run([](uint32_t) { return false; });
+    CHECK_EQ(o.verdict, holdclass::TAP);
+    CHECK_EQ(o.atMs, DEBOUNCE_MS);
+}
+
+static void testLongHold() {
+    Outcome o = run([](uint32_t) { return true; });
+    CHECK_EQ(o.verdict, holdclass::HOLD);
+    CHECK_EQ(o.atMs, HOLD_MS);
+}
+
+static void testBounceWithinDebounce() {
+    // Contact bounce mid-hold, shorter than the debounce window: still a HOLD,
+    // decided on time.
+    Outcome o = run([](uint32_t t) { return !(t > 500 && t <= 500 + DEBOUNCE_MS - POLL_MS); });
+    CHECK_EQ(o.verdict, holdclass::HOLD);
+    CHECK_EQ(o.atMs, HOLD_MS);
+
+    // Several bounces, each just under the window.
+    o = run([](uint32_t t) { return (t / 100) % 3 != 0 || t % 100 >= DEBOUNCE_MS - POLL_MS; });
+    CHECK_EQ(o.verdict, holdclass::HOLD);
+
+    // A release that lasts the whole window is a release: TAP.
+    o = run([](uint32_t t) { return !(t > 500 && t <= 500 + DEBOUNCE_MS); });
+    CHECK_EQ(o.verdict, holdclass::TAP);
+    CHECK_EQ(o.atMs, 500 + DEBOUNCE_MS);
+}
+
+static void testReleaseAtHoldMs() {
+    // Last pressed sample one poll before HOLD_MS, released at HOLD_MS itself:
+    // the press didn't last HOLD_MS — no HOLD, and a TAP once debounced.
+    Outcome o = run([](uint32_t t) { return t < HOLD_MS; });
+    CHECK_EQ(o.verdict, holdclass::TAP);
+    CHECK_EQ(o.atMs, HOLD_MS + DEBOUNCE_MS - POLL_MS);
+
+    // Still pressed at the HOLD_MS sample, released right after: HOLD.
+    o = run([](uint32_t t) { return t <= HOLD_MS; });
+    CHECK_EQ(o.verdict, holdclass::HOLD);
+    CHECK_EQ(o.atMs, HOLD_MS);
+
+    // Released at HOLD_MS but bouncing back within the window: HOLD on the
+    // first pressed sample after it.
+    o = run([](uint32_t t) { return t != HOLD_MS; });
+    CHECK_EQ(o.verdict, holdclass::HOLD);
+    CHECK_EQ(o.atMs, HOLD_MS + POLL_MS);
+}
+
+static void testTimeout() {
+    // A chattering contact (alternating every sample) never stays released
+    // long enough for a TAP, and must still be decided, not sampled forever.
+    Outcome o = run([](uint32_t t) { return (t / POLL_MS) % 2 == 0; });
+    CHECK(o.verdict != holdclass::PENDING);
+    CHECK(o.atMs <= HOLD_MS + POLL_MS);
+
+    // Any trace at all is decided within HOLD_MS + DEBOUNCE_MS: the stub holds
+    // the CPU in a busy-wait until then, so this bounds the wake.
+    srand(1);
+    for (int i = 0; i < 20000; i++) {
+        uint32_t flipEvery = 1 + rand() % 8;  // in samples
+        uint32_t seed = (uint32_t)rand();
+        o = run([&](uint32_t t) {
+            uint32_t n = t / POLL_MS / flipEvery;
+            return ((seed >> (n % 32)) & 1) != 0;
+        });
+        CHECK(o.verdict != holdclass::PENDING);
+        CHECK(o.atMs <= HOLD_MS + DEBOUNCE_MS);
+    }
+}
+
+int main() {
+    testTap();
+    testLongHold();
+    testBounceWithinDebounce();
+    testReleaseAtHoldMs();
+    testTimeout();
+    return testSummary("hold_classifier");
+}
@@ -0,0 +1,193 @@
+// Host test: ota_image.h + tinfl against .wfz images from scripts/pack_ota.py.
+//
+// Reads <image.wfz> the way otaDownloadBlocks() does — header, then per block
+// the prefix, the stored bytes, one tinfl_decompress() into a non-wrapping
+// output buffer, with the ROM's tinfl (miniz/) — and checks the result is
+// <firmware.bin> byte for byte. Then that a download cut short stops cleanly at
+// a block boundary with everything before it intact, and that damaged headers
+// and prefixes are refused.
+//
+// Usage: test_ota_image <firmware.bin> <image.wfz>
+// (`make check` runs it on a sample image; `make wfz-check BIN=…` on any image,
+// e.g. a PlatformIO firmware.bin)
+
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include "ota_image.h"
+#include "png_host.h"  // readFile()
+#include "test.h"
+#include "tinfl.h"
+
+enum Outcome { DECODED, STALLED, CORRUPT };
+
+struct Decode {
+    Outcome outcome = CORRUPT;
+    std::vector<uint8_t> image;  // every block inflated before it stopped
+    uint32_t rawBlocks = 0, deflatedBlocks = 0;
+};
+
+// The stream: the .wfz, or the first part of it a cut connection delivered.
+struct Stream {
+    const uint8_t *data;
+    size_t len, pos = 0;
+
+    bool readFull(uint8_t *buf, size_t n) {
+        if (n > len - pos) return false;
+        memcpy(buf, data + pos, n);
+        pos += n;
+        return true;
+    }
+};
+
+static Decode decode(const uint8_t *wfz, size_t len) {
+    Decode d;
+    Stream s = {wfz, len};
+    uint8_t raw[otaimg::HEADER_SIZE];
+    otaimg::Header h;
+    if (!s.readFull(raw, sizeof(raw))) {
+        d.outcome = STALLED;
+        return d;
+    }
+    if (!otaimg::parseHeader(raw, h)) return d;
+
+    static tinfl_decompressor inflater;
+    static uint8_t zbuf[otaimg::MAX_BLOCK + otaimg::BLOCK_SLACK], obuf[otaimg::MAX_BLOCK];
+    for (uint32_t index = 0; index < h.blockCount; index++) {
+        uint32_t len = otaimg::blockLength(h, index);
+        uint8_t  prefix[4];
+        uint32_t stored;
+        bool     isRaw;
+        if (!s.readFull(prefix, 4)) {
+            d.outcome = STALLED;
+            return d;
+        }
+        if (!otaimg::parseBlockPrefix(h, index, otaimg::le32(prefix), stored, isRaw)) return d;
+        if (!s.readFull(isRaw ? obuf : zbuf, stored)) {
+            d.outcome = STALLED;
+            return d;
+        }
+        if (!isRaw) {
+            tinfl_init(&inflater);
+            size_t inLen = stored, outLen = len;
+            tinfl_status st = tinfl_decompress(&inflater, zbuf, &inLen, obuf, obuf, &outLen,
+                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+            if (st != TINFL_STATUS_DONE || outLen != len) return d;
+            d.deflatedBlocks++;
+        } else {
+            d.rawBlocks++;
+        }
+        d.image.insert(d.image.end(), obuf, obuf + len);
+    }
+    d.outcome = s.pos == s.len ? DECODED : CORRUPT;  // nothing after the last block
+    return d;
+}
+
+static bool isPrefixOf(const std::vector<uint8_t> &part, const std::vector<uint8_t> &whole) {
+    return part.size() <= whole.size() && memcmp(part.data(), whole.data(), part.size()) == 0;
+}
+
+static void testDecode(const std::vector<uint8_t> &bin, const std::vector<uint8_t> &wfz) {
+    Decode d = decode(wfz.data(), wfz.size());
+    CHECK_EQ(d.outcome, DECODED);
+    CHECK_EQ(d.image.size(), bin.size());
+    CHECK(d.image == bin);
+
+    otaimg::Header h;
+    CHECK(otaimg::parseHeader(wfz.data(), h));
+    CHECK_EQ(h.imageSize, bin.size());
+    printf("%u → %u bytes in %u blocks (%u deflated, %u stored)\n", (unsigned)bin.size(),
+           (unsigned)wfz.size(), (unsigned)h.blockCount, (unsigned)d.deflatedBlocks,
+           (unsigned)d.rawBlocks);
+}
+
+static void testTruncated(const std::vector<uint8_t> &bin, const std::vector<uint8_t> &wfz) {
+    // A connection that drops anywhere — in the header, in a prefix, mid-block,
+    // one byte short — is a stall: whole blocks only, all of them right.
+    const size_t size = wfz.size();
+    std::vector<size_t> cuts = {0, otaimg::HEADER_SIZE - 1, otaimg::HEADER_SIZE,
+                                otaimg::HEADER_SIZE + 2, size - 1};
+    for (size_t i = 1; i < 64; i++) cuts.push_back(size * i / 64);
+    for (size_t cut : cuts) {
+        if (cut >= size) continue;
+        Decode d = decode(wfz.data(), cut);
+        CHECK_EQ(d.outcome, STALLED);
+        CHECK(isPrefixOf(d.image, bin));
+        otaimg::Header h;
+        if (otaimg::parseHeader(wfz.data(), h)) CHECK_EQ(d.image.size() % h.blockSize, 0);
+    }
+}
+
+static void testDamaged(const std::vector<uint8_t> &wfz) {
+    otaimg::Header h;
+    if (!otaimg::parseHeader(wfz.data(), h)) return;
+
+    // Header: wrong magic; a block size that isn't whole sectors; a block count
+    // that doesn't match the image size.
+    std::vector<uint8_t> bad = wfz;
+    bad[0] = 'X';
+    CHECK_EQ(decode(bad.data(), bad.size()).outcome, CORRUPT);
+    bad = wfz;
+    uint32_t v = h.blockSize + 1;
+    memcpy(&bad[8], &v, 4);  // little-endian host
+    CHECK_EQ(decode(bad.data(), bad.size()).outcome, CORRUPT);
+    bad = wfz;
+    v = h.blockCount + 1;
+    memcpy(&bad[12], &v, 4);
+    CHECK_EQ(decode(bad.data(), bad.size()).outcome, CORRUPT);
+
+    // First block's prefix: stored length 0, and one too short / long. Too short
+    // cuts the deflate stream (tinfl can't finish it); too long shifts every
+    // later prefix. Neither may pass as a good image.
+    const size_t p0 = otaimg::HEADER_SIZE;
+    const uint32_t prefix = otaimg::le32(&wfz[p0]);
+    for (uint32_t tampered : {prefix & otaimg::BLOCK_RAW, prefix - 1, prefix + 1}) {
+        bad = wfz;
+        memcpy(&bad[p0], &tampered, 4);
+        CHECK(decode(bad.data(), bad.size()).outcome != DECODED);
+    }
+
+    // Stored blocks must be exactly their inflated length; deflated ones can't
+    // claim more than that + BLOCK_SLACK.
+    uint32_t stored;
+    bool isRaw;
+    uint32_t len0 = otaimg::blockLength(h, 0);
+    CHECK(otaimg::parseBlockPrefix(h, 0, otaimg::BLOCK_RAW | len0, stored, isRaw) && isRaw);
+    CHECK(!otaimg::parseBlockPrefix(h, 0, otaimg::BLOCK_RAW | (len0 - 1), stored, isRaw));
+    CHECK(otaimg::parseBlockPrefix(h, 0, len0 + otaimg::BLOCK_SLACK - 1, stored, isRaw) && !isRaw);
+    CHECK(!otaimg::parseBlockPrefix(h, 0, len0 + otaimg::BLOCK_SLACK, stored, isRaw));
+
+    // A deflated block handed a smaller output buffer than it inflates to.
+    size_t pos = otaimg::HEADER_SIZE;
+    for (uint32_t i = 0; i < h.blockCount; i++) {
+        uint32_t p = otaimg::le32(&wfz[pos]);
+        if (!(p & otaimg::BLOCK_RAW)) {
+            static tinfl_decompressor inflater;
+            static uint8_t out[otaimg::MAX_BLOCK];
+            tinfl_init(&inflater);
+            size_t inLen = p, outLen = otaimg::blockLength(h, i) - 1;
+            tinfl_status st = tinfl_decompress(&inflater, &wfz[pos + 4], &inLen, out, out, &outLen,
+                                               TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+            CHECK_EQ(st, TINFL_STATUS_HAS_MORE_OUTPUT);
+            break;
+        }
+        pos += 4 + (p & ~otaimg::BLOCK_RAW);
+    }
+}
+
+int main(int argc, char **argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: test_ota_image <firmware.bin> <image.wfz>\n");
+        return 2;
+    }
+    std::vector<uint8_t> bin = readFile(argv[1]), wfz = readFile(argv[2]);
+    if (bin.empty() || wfz.size() <= otaimg::HEADER_SIZE) {
+        fprintf(stderr, "test_ota_image: can't read the image or the .wfz\n");
+        return 2;
+    }
+    testDecode(bin, wfz);
+    testTruncated(bin, wfz);
+    testDamaged(wfz);
+    return testSummary("ota_image");
+}
@@ -1,5 +1,5 @@
 import { createProvider } from './providers/index.js';
-import { renderWeatherPng } from './render.jsx';
+import { renderWeatherPngs } from './render.jsx';
 import { adminPageHtml } from './admin.js';
 
 /**
@@ -10,7 +10,16 @@ import { adminPageHtml } from './admin.js';
  *
  * Endpoints:
  *   GET /weather.png          — first location's PNG (backward compat)
- *   GET /weather/{zip}.png    — PNG for a specific zip code
+ *   GET /weather/{zip}.png    — PNG for a specific zip code (ETag / If-None-Match
+ *                               aware: an unchanged frame is a bodiless 304;
+ *                               `Accept: image/png;depth=4` selects the 4bpp frame;
+ *                               X-Wake-Trace / X-Battery headers are logged, see
+ *                               logWakeTrace / logBattery; X-Next-Update says when
+ *                               the frame can next change, see nextUpdateHint)
+ *   GET /weather/{zip}.bundle — the next hours' 4bpp frames in one container,
+ *                               for the device to show offline (serveFrameBundle)
+ *   POST /telemetry/battery   — a device's batched battery-voltage log
+ *   GET /telemetry/battery/{device}.json — the stored discharge samples
  *   GET /admin                — location management page
  *   POST /admin               — add/remove locations, update settings
  *   GET /                     — info page
@@ -22,6 +31,26 @@ const KV_TTL = 3600;             // 1 hour
 const MAX_LOCATIONS = 5;
 const MIN_POLL_MINUTES = 3;
 const DEFAULT_POLL_MINUTES = 5;
+// Volatility: an EWMA (percent) of how often a location's poll finds changed
+// data. Each poll moves it VOLATILITY_WEIGHT of the way to 100 (changed) or 0.
+const VOLATILITY_WEIGHT = 0.2;
+const DEFAULT_VOLATILITY = 50;
+// Offline frame bundle: the current hour's frame and FRAME_BUNDLE_HOURS more,
+// re-rendered at most this often per location. Keep FRAME_BUNDLE_HOURS + 1
+// within the firmware's BUNDLE_MAX_FRAMES (firmware/src/frame_bundle.h).
+const FRAME_BUNDLE_HOURS = 8;
+const FRAME_BUNDLE_TTL = 3600;
+
+// Phase names of the firmware's X-Wake-Trace records, in its TracePhase order
+// (firmware/src/wake_trace.h). Keep the two in step.
+const WAKE_TRACE_PHASES = [
+  'boot', 'nvs', 'assoc', 'dhcp', 'ntp', 'tls', 'ttfb',
+  'download', 'decode', 'epd', 'ota', 'awake',
+];
+const WAKE_TRACE_FLAGS = ['wifi_fast', 'tls_resumed', 'not_modified', 'fetch_failed', 'display'];
+// Battery samples kept per device (~1 a wake at most: over a year at the
+// firmware's cadence).
+const BATTERY_LOG_MAX_SAMPLES = 20000;
 
 // ─── request handler ─────────────────────────────────────────────────────────
 
@@ -35,7 +64,7 @@ export default {
       if (locations.length === 0) {
         return new Response('No locations configured', { status: 404 });
       }
-      return serveWeatherPng(env, locations[0]);
+      return serveWeatherPng(request, env, locations[0]);
     }
 
     // GET /weather/{zip}.png
@@ -47,7 +76,19 @@ export default {
       if (!loc) {
         return new Response(`Unknown zip code: ${zip}`, { status: 404 });
       }
-      return serveWeatherPng(env, loc);
+      return serveWeatherPng(request, env, loc);
+    }
+
+    // GET /weather/{zip}.bundle
+    const zipBundleMatch = url.pathname.match(/^\/weather\/(\d+)\.bundle$/);
+    if (zipBundleMatch) {
+      const zip = zipBundleMatch[1];
+      const locations = await getLocations(env);
+      const loc = locations.find((l) => l.zip === zip);
+      if (!loc) {
+        return new Response(`Unknown zip code: ${zip}`, { status: 404 });
+      }
+      return serveFrameBundle(env, loc);
     }
 
     // GET /weather/{zip}.json — debug: returns the transformed weather data
@@ -98,7 +139,8 @@ export default {
       return jsonResponse(slim);
     }
 
-    // GET /firmware/{version}.bin — serve a firmware binary from KV.
+    // GET /firmware/{version}.bin — serve a firmware binary from KV, whole or
+    // one Range slice (the device downloads it a slice per wake).
     // (Stored in KV for now; migrate to R2 once it's enabled on the account —
     // see ROADMAP.md. The device-facing URL is identical either way.)
     const firmwareBinMatch = url.pathname.match(/^\/firmware\/(\d+)\.bin$/);
@@ -108,7 +150,47 @@ export default {
       if (!bin) {
         return new Response('Not Found', { status: 404 });
       }
-      return binaryResponse(bin);
+      return firmwareResponse(request, env, version, bin);
+    }
+
+    // GET /firmware/{version}.wfz — the same image compressed in independently
+    // deflated blocks (format in firmware/src/ota_image.h), if ota-publish.sh
+    // packed one; Range works as for the .bin. 404 sends the device to the .bin.
+    const firmwareWfzMatch = url.pathname.match(/^\/firmware\/(\d+)\.wfz$/);
+    if (firmwareWfzMatch && request.method === 'GET') {
+      const version = firmwareWfzMatch[1];
+      const wfz = await env.WEATHER_KV.get(`firmware:wfz:${version}`, 'arrayBuffer');
+      if (!wfz) {
+        return new Response('Not Found', { status: 404 });
+      }
+      return firmwareResponse(request, env, version, wfz);
+    }
+
+    // GET /firmware/patch/{from}/{to} — a delta patch that rebuilds {to} from
+    // the running {from} image (format in firmware/src/delta_patch.h), if
+    // ota-publish.sh made one for that pair. 404 sends the device to the full
+    // image.
+    const firmwarePatchMatch = url.pathname.match(/^\/firmware\/patch\/(\d+)\/(\d+)$/);
+    if (firmwarePatchMatch && request.method === 'GET') {
+      const [, from, to] = firmwarePatchMatch;
+      const patch = await env.WEATHER_KV.get(`firmware:patch:${from}:${to}`, 'arrayBuffer');
+      if (!patch) {
+        return new Response('Not Found', { status: 404 });
+      }
+      return binaryResponse(patch);
+    }
+
+    // POST /telemetry/battery — the firmware's battery log, a batch of
+    // bit-packed blocks (layout in firmware/src/battery_log.h).
+    if (url.pathname === '/telemetry/battery' && request.method === 'POST') {
+      return handleBatteryLogPost(request, env);
+    }
+
+    // GET /telemetry/battery/{device}.json — every stored sample, oldest first.
+    const batteryLogMatch = url.pathname.match(/^\/telemetry\/battery\/([0-9a-f]{12})\.json$/);
+    if (batteryLogMatch && request.method === 'GET') {
+      const samples = await env.WEATHER_KV.get(`battery_log:${batteryLogMatch[1]}`, 'json');
+      return jsonResponse(samples || []);
     }
 
     // Root info page
@@ -171,20 +253,25 @@ export default {
         if (prevHash === newHash) {
           // Data unchanged — just refresh the timestamp.
           console.log(`[${loc.zip}] unchanged, refreshing timestamp`);
-          await env.WEATHER_KV.put(`render_updated:${loc.zip}`, weatherData.updated, {
-            expirationTtl: KV_TTL,
-          });
+          await Promise.all([
+            env.WEATHER_KV.put(`render_updated:${loc.zip}`, weatherData.updated, {
+              expirationTtl: KV_TTL,
+            }),
+            recordVolatility(env, loc.zip, false),
+          ]);
           continue;
         }
 
         console.log(`[${loc.zip}] changed, rendering PNG...`);
-        const png = await renderWeatherPng(weatherData, { location: loc.zip });
+        const { png, png4 } = await renderWeatherPngs(weatherData, { location: loc.zip });
         await Promise.all([
           env.WEATHER_KV.put(`render_png:${loc.zip}`, png, { expirationTtl: KV_TTL }),
+          env.WEATHER_KV.put(`render_png4:${loc.zip}`, png4, { expirationTtl: KV_TTL }),
           env.WEATHER_KV.put(`render_updated:${loc.zip}`, weatherData.updated, { expirationTtl: KV_TTL }),
           env.WEATHER_KV.put(`render_hash:${loc.zip}`, newHash, { expirationTtl: KV_TTL }),
+          recordVolatility(env, loc.zip, true),
         ]);
-        console.log(`[${loc.zip}] PNG updated (${png.length} bytes)`);
+        console.log(`[${loc.zip}] PNG updated (${png.length} bytes, 4bpp ${png4.length} bytes)`);
       } catch (error) {
         console.error(`[${loc.zip}] failed:`, error.message);
       }
@@ -213,6 +300,13 @@ async function getPollInterval(env) {
   return stored ? parseInt(stored) : DEFAULT_POLL_MINUTES;
 }
 
+async function recordVolatility(env, zip, changed) {
+  const prev = parseFloat(await env.WEATHER_KV.get(`render_vol:${zip}`));
+  const vol = (isNaN(prev) ? DEFAULT_VOLATILITY : prev) * (1 - VOLATILITY_WEIGHT)
+            + (changed ? 100 : 0) * VOLATILITY_WEIGHT;
+  await env.WEATHER_KV.put(`render_vol:${zip}`, vol.toFixed(1), { expirationTtl: KV_TTL });
+}
+
 // ─── admin POST handler ──────────────────────────────────────────────────────
 
 async function handleAdminPost(request, env) {
@@ -266,8 +360,10 @@ async function handleAdminPost(request, env) {
     // otherwise keep serving the old PNG until the weather itself moved.
     await Promise.all([
       env.WEATHER_KV.delete(`render_png:${zip}`),
+      env.WEATHER_KV.delete(`render_png4:${zip}`),
       env.WEATHER_KV.delete(`render_updated:${zip}`),
       env.WEATHER_KV.delete(`render_hash:${zip}`),
+      env.WEATHER_KV.delete(`render_bundle:${zip}`),
     ]);
     return jsonResponse({ ok: true, locations });
   }
@@ -283,8 +379,10 @@ async function handleAdminPost(request, env) {
     // Clean up cached data for this location.
     await Promise.all([
       env.WEATHER_KV.delete(`render_png:${zip}`),
+      env.WEATHER_KV.delete(`render_png4:${zip}`),
       env.WEATHER_KV.delete(`render_updated:${zip}`),
       env.WEATHER_KV.delete(`render_hash:${zip}`),
+      env.WEATHER_KV.delete(`render_bundle:${zip}`),
     ]);
     return jsonResponse({ ok: true, locations });
   }
@@ -301,38 +399,198 @@ async function handleAdminPost(request, env) {
   return jsonResponse({ error: `Unknown action: ${action}` }, 400);
 }
 
+// ─── battery telemetry ───────────────────────────────────────────────────────
+
+async function handleBatteryLogPost(request, env) {
+  const device = (request.headers.get('X-Device-Id') || '').toLowerCase();
+  if (!/^[0-9a-f]{12}$/.test(device)) {
+    return jsonResponse({ error: 'X-Device-Id required' }, 400);
+  }
+  let samples;
+  try {
+    samples = decodeBatteryLog(new Uint8Array(await request.arrayBuffer()));
+  } catch (error) {
+    return jsonResponse({ error: `Bad battery log: ${error.message}` }, 400);
+  }
+  const key = `battery_log:${device}`;
+  const stored = (await env.WEATHER_KV.get(key, 'json')) || [];
+  const merged = stored.concat(samples).slice(-BATTERY_LOG_MAX_SAMPLES);
+  await env.WEATHER_KV.put(key, JSON.stringify(merged));
+  console.log(JSON.stringify({ batteryLog: { device, received: samples.length, stored: merged.length } }));
+  return jsonResponse({ ok: true, received: samples.length });
+}
+
+/**
+ * Decodes the firmware's battery log blocks into samples
+ * `{ t, mv, rssi, wifi, epd }` (t in epoch seconds; rssi null without WiFi).
+ * Mirrors the encoder in firmware/src/battery_log.cpp.
+ */
+function decodeBatteryLog(bytes) {
+  const view = new DataView(bytes.buffer, bytes.byteOffset, bytes.byteLength);
+  const samples = [];
+  let off = 0;
+  while (off + 12 <= bytes.length) {
+    const epoch = view.getUint32(off, true);
+    const mv0 = view.getUint16(off + 4, true);
+    const nbits = view.getUint16(off + 6, true);
+    const version = bytes[off + 8];
+    const count = bytes[off + 9];
+    const streamLen = Math.ceil(nbits / 8);
+    if (version !== 1 || off + 12 + streamLen > bytes.length) {
+      throw new Error(`block at ${off}`);
+    }
+    const stream = bytes.subarray(off + 12, off + 12 + streamLen);
+    let pos = 0;
+    const bits = (n) => {
+      let v = 0;
+      for (let i = 0; i < n; i++, pos++) {
+        if (pos >= nbits) throw new Error(`block at ${off}: stream overrun`);
+        if (stream[pos >> 3] & (1 << (pos & 7))) v |= 1 << i;
+      }
+      return v;
+    };
+    let t = epoch;
+    let mv = mv0;
+    for (let i = 0; i < count; i++) {
+      const flags = bits(2);
+      const rssiCode = bits(5);
+      let dt = bits(6);
+      if (dt === 63) dt = bits(16);
+      const zz = bits(6);
+      if (zz === 63) mv = bits(16);
+      else mv += (zz >>> 1) ^ -(zz & 1);
+      t += dt * 60;
+      samples.push({
+        t,
+        mv,
+        rssi: rssiCode === 31 ? null : -30 - 2 * rssiCode,
+        wifi: Boolean(flags & 2),
+        epd: Boolean(flags & 1),
+      });
+    }
+    off += 12 + streamLen;
+  }
+  return samples;
+}
+
 // ─── weather fetch + serve ───────────────────────────────────────────────────
 
-async function serveWeatherPng(env, loc) {
+async function serveWeatherPng(request, env, loc) {
+  logWakeTrace(request, loc);
+  logBattery(request, loc);
+  // Frame format: devices that advertise 4bpp support get the pre-quantized
+  // frame; anything else (older firmware, browsers) gets the 8bpp PNG.
+  const gray4 = acceptsGray4(request);
   try {
-    const [cachedPng, cachedUpdated, fwLatest] = await Promise.all([
-      env.WEATHER_KV.get(`render_png:${loc.zip}`, 'arrayBuffer'),
+    const [cachedPng, cachedUpdated, fwLatest, nextUpdate] = await Promise.all([
+      env.WEATHER_KV.get(`${gray4 ? 'render_png4' : 'render_png'}:${loc.zip}`, 'arrayBuffer'),
       env.WEATHER_KV.get(`render_updated:${loc.zip}`, 'text'),
       // Latest available firmware — advertised on every weather response so the
       // device discovers OTA updates for free (it self-updates when this exceeds
       // its own FIRMWARE_VERSION).
       env.WEATHER_KV.get('firmware:latest', 'text'),
+      nextUpdateHint(env, loc),
     ]);
 
     const firmwareLatest = parseInt(fwLatest, 10) || 0;
 
     if (cachedPng) {
-      return pngResponse(cachedPng, cachedUpdated || '', firmwareLatest);
+      return pngResponse(request, cachedPng, cachedUpdated || '', firmwareLatest, nextUpdate);
     }
 
     // Cache miss — render on demand.
     const weatherData = await fetchWeatherForLocation(env, loc);
-    const png = await renderWeatherPng(weatherData, { location: loc.zip });
+    const { png, png4 } = await renderWeatherPngs(weatherData, { location: loc.zip });
     await Promise.all([
       env.WEATHER_KV.put(`render_png:${loc.zip}`, png, { expirationTtl: KV_TTL }),
+      env.WEATHER_KV.put(`render_png4:${loc.zip}`, png4, { expirationTtl: KV_TTL }),
       env.WEATHER_KV.put(`render_updated:${loc.zip}`, weatherData.updated, { expirationTtl: KV_TTL }),
     ]);
-    return pngResponse(png, weatherData.updated, firmwareLatest);
+    return pngResponse(request, gray4 ? png4 : png, weatherData.updated, firmwareLatest, nextUpdate);
   } catch (error) {
     return new Response(`Render failed: ${error.message}`, { status: 500 });
   }
 }
 
+/**
+ * The offline frame bundle for a location: one 4bpp frame per hour ahead, each
+ * rendered from the forecast as the display should look during that hour, in
+ * the container firmware/src/frame_bundle.h reads. Rendered on request and
+ * cached for FRAME_BUNDLE_TTL — devices only ask about once an hour.
+ */
+async function serveFrameBundle(env, loc) {
+  try {
+    const cached = await env.WEATHER_KV.get(`render_bundle:${loc.zip}`, 'arrayBuffer');
+    if (cached) return binaryResponse(cached);
+
+    const provider = weatherProvider(env, `${loc.lat},${loc.lon}`);
+    const raw = await provider.fetchRaw();
+    const updated = provider.transform(raw).updated;
+    const frames = [];
+    for (const { from, until, data } of provider.forecastAhead(raw, FRAME_BUNDLE_HOURS)) {
+      if (!loc.showDewPoint) delete data.dew_point;
+      const { png4 } = await renderWeatherPngs(data, { location: loc.zip });
+      frames.push({ from, until, png: png4 });
+    }
+    if (frames.length === 0) {
+      return new Response('No hourly forecast for this location', { status: 404 });
+    }
+
+    const bundle = packFrameBundle(frames, updated);
+    await env.WEATHER_KV.put(`render_bundle:${loc.zip}`, bundle, { expirationTtl: FRAME_BUNDLE_TTL });
+    return binaryResponse(bundle);
+  } catch (error) {
+    return new Response(`Render failed: ${error.message}`, { status: 500 });
+  }
+}
+
+// "WFB1", count, generated, updated[20], then {from, until, offset, length}
+// per frame and the frame bodies; little-endian, offsets from the start.
+function packFrameBundle(frames, updated) {
+  const tableEnd = 32 + frames.length * 16;
+  const total = frames.reduce((n, f) => n + f.png.byteLength, tableEnd);
+  const out = new Uint8Array(total);
+  const view = new DataView(out.buffer);
+  out.set(new TextEncoder().encode('WFB1'), 0);
+  view.setUint32(4, frames.length, true);
+  view.setUint32(8, Math.floor(Date.now() / 1000), true);
+  out.set(new TextEncoder().encode(updated || '').subarray(0, 20), 12);
+  let offset = tableEnd;
+  frames.forEach((f, i) => {
+    const e = 32 + i * 16;
+    view.setUint32(e, f.from, true);
+    view.setUint32(e + 4, f.until, true);
+    view.setUint32(e + 8, offset, true);
+    view.setUint32(e + 12, f.png.byteLength, true);
+    out.set(f.png, offset);
+    offset += f.png.byteLength;
+  });
+  return out.buffer;
+}
+
+/**
+ * The X-Next-Update value: `<s>;every=<s>;vol=<percent>` — seconds until the
+ * next scheduled poll (the earliest the frame can change), the poll period, and
+ * how often polls have been finding changed data for this location. The
+ * firmware schedules its next wake from it (just after a likely re-render, and
+ * further out when the weather is settled).
+ */
+async function nextUpdateHint(env, loc) {
+  const [lastPoll, pollMinutes, vol] = await Promise.all([
+    env.WEATHER_KV.get('last_poll_time'),
+    getPollInterval(env),
+    env.WEATHER_KV.get(`render_vol:${loc.zip}`),
+  ]);
+  const every = pollMinutes * 60;
+  const now = Math.floor(Date.now() / 1000);
+  // The cron fires each minute and polls once `every` has passed since the last.
+  let next = Math.ceil(((parseInt(lastPoll, 10) || now) + every) / 60) * 60;
+  while (next <= now) next += 60;
+  const parsedVol = parseFloat(vol);
+  const volatility = Math.round(isNaN(parsedVol) ? DEFAULT_VOLATILITY : parsedVol);
+  return `${next - now};every=${every};vol=${volatility}`;
+}
+
 // Fetch weather for a location entry and shape it per the location's config.
 // `showDewPoint` gates the dew-point display: the provider always emits
 // `dew_point`, and stripping it here (a) makes the layout render the plain
@@ -345,6 +603,10 @@ async function fetchWeatherForLocation(env, loc) {
 }
 
 async function fetchWeatherData(env, location) {
+  return await weatherProvider(env, location).fetch();
+}
+
+function weatherProvider(env, location) {
   const providerName = env.WEATHER_PROVIDER || 'openweathermap';
   const apiKey = env.WEATHER_API_KEY;
 
@@ -352,12 +614,68 @@ async function fetchWeatherData(env, location) {
     throw new Error('WEATHER_API_KEY environment variable not set');
   }
 
-  const provider = createProvider(providerName, apiKey, location);
-  return await provider.fetch();
+  return createProvider(providerName, apiKey, location);
 }
 
 // ─── helpers ─────────────────────────────────────────────────────────────────
 
+/**
+ * Logs the per-wake phase timings a device sends with its weather request
+ * (`X-Wake-Trace: <device-id> <boot>:<flags>:<ms>,...;...`) as one JSON line,
+ * for `wrangler tail` / Logpush. Malformed records are skipped.
+ */
+function logWakeTrace(request, loc) {
+  const header = request.headers.get('X-Wake-Trace');
+  if (!header) return;
+  const [device, body = ''] = header.trim().split(/\s+/, 2);
+  const records = [];
+  for (const rec of body.split(';')) {
+    const [boot, flags, ms] = rec.split(':');
+    const values = (ms || '').split(',').map((v) => parseInt(v, 10));
+    if (values.length !== WAKE_TRACE_PHASES.length || values.some(isNaN)) continue;
+    const flagBits = parseInt(flags, 10) || 0;
+    records.push({
+      boot: parseInt(boot, 10),
+      flags: WAKE_TRACE_FLAGS.filter((_, i) => flagBits & (1 << i)),
+      ms: Object.fromEntries(WAKE_TRACE_PHASES.map((p, i) => [p, values[i]])),
+    });
+  }
+  if (records.length === 0) return;
+  console.log(JSON.stringify({ wakeTrace: { zip: loc.zip, device, records } }));
+}
+
+/**
+ * Logs a device's battery voltage and energy-model estimate
+ * (`X-Battery: <device-id> mv=3912 uah=210 cycle=905 mah=812 h=1040 [trend]`)
+ * as one JSON line — the raw material for calibrating the BAT threshold and
+ * the model's current figures against real discharge curves.
+ */
+function logBattery(request, loc) {
+  const header = request.headers.get('X-Battery');
+  if (!header) return;
+  const [device, ...fields] = header.trim().split(/\s+/);
+  const battery = { zip: loc.zip, device, trend: false };
+  for (const field of fields) {
+    if (field === 'trend') { battery.trend = true; continue; }
+    const [key, value] = field.split('=');
+    const n = parseInt(value, 10);
+    if (key && !isNaN(n)) battery[key] = n;
+  }
+  console.log(JSON.stringify({ battery }));
+}
+
+/**
+ * True if the request's Accept header lists `image/png;depth=4` — the firmware's
+ * way of saying it can take the pre-quantized 4bpp frame.
+ */
+function acceptsGray4(request) {
+  const accept = request.headers.get('Accept') || '';
+  return accept.split(',').some((entry) => {
+    const [type, ...params] = entry.split(';').map((p) => p.trim().toLowerCase());
+    return type === 'image/png' && params.includes('depth=4');
+  });
+}
+
 /** djb2 string hash — fast, deterministic, good enough for change detection. */
 function simpleHash(str) {
   let h = 5381;
@@ -377,26 +695,121 @@ function jsonResponse(data, status = 200) {
   });
 }
 
-function pngResponse(pngBytes, updated, firmwareLatest = 0) {
-  return new Response(pngBytes, {
-    headers: {
-      'Content-Type': 'image/png',
-      'X-Updated': updated,
-      // Latest available firmware version. The device compares it to its own
-      // FIRMWARE_VERSION and self-updates if newer — free OTA discovery.
-      'X-Firmware-Latest': String(firmwareLatest),
-      'Cache-Control': 'public, max-age=300',
-      'Access-Control-Allow-Origin': '*',
-    },
-  });
+/**
+ * djb2 over raw bytes — the same hash the firmware folds over the PNG as it
+ * downloads, so the ETag and the device's change-detection hash agree.
+ */
+function hashBytes(bytes) {
+  let h = 5381;
+  for (let i = 0; i < bytes.length; i++) {
+    h = ((h << 5) + h) ^ bytes[i];
+  }
+  return (h >>> 0).toString(16).padStart(8, '0');
 }
 
-function binaryResponse(body) {
+// Serves a weather PNG with a content-hash ETag. A device that already shows
+// this frame sends it back as If-None-Match and gets a bodiless 304 — the
+// common case, since most wakes land between re-renders. X-Updated and
+// X-Firmware-Latest ride on the 304 too: staleness and OTA discovery still
+// need them when the image itself hasn't changed.
+function pngResponse(request, pngBytes, updated, firmwareLatest = 0, nextUpdate = '') {
+  const etag = `"${hashBytes(new Uint8Array(pngBytes))}"`;
+  const headers = {
+    'Content-Type': 'image/png',
+    'ETag': etag,
+    'X-Updated': updated,
+    // Latest available firmware version. The device compares it to its own
+    // FIRMWARE_VERSION and self-updates if newer — free OTA discovery.
+    'X-Firmware-Latest': String(firmwareLatest),
+    'Cache-Control': 'public, max-age=300',
+    // The body depends on the negotiated frame format.
+    'Vary': 'Accept',
+    'Access-Control-Allow-Origin': '*',
+  };
+  if (nextUpdate) headers['X-Next-Update'] = nextUpdate;
+  const ifNoneMatch = request.headers.get('If-None-Match');
+  if (ifNoneMatch && ifNoneMatch.split(',').some((t) => t.trim() === etag)) {
+    return new Response(null, { status: 304, headers });
+  }
+  return new Response(pngBytes, { headers });
+}
+
+function binaryResponse(body, extraHeaders = {}, status = 200) {
   return new Response(body, {
+    status,
     headers: {
       'Content-Type': 'application/octet-stream',
       'Cache-Control': 'public, max-age=3600',
       'Access-Control-Allow-Origin': '*',
+      ...extraHeaders,
     },
   });
 }
+
+/**
+ * A firmware image (.bin, or its .wfz packing in `body`): whole, or the single
+ * byte range asked for (`Range: bytes=a-b` → 206 + Content-Range). Every reply
+ * carries the SHA-256 of the whole uncompressed image as X-Firmware-Sha256; the
+ * device checks the assembled image against it, and a change mid-download
+ * tells it to start over.
+ */
+async function firmwareResponse(request, env, version, body) {
+  const total = body.byteLength;
+  const headers = {
+    'Accept-Ranges': 'bytes',
+    'X-Firmware-Sha256': await firmwareSha256(env, version),
+  };
+  const range = parseByteRange(request.headers.get('Range'), total);
+  if (range === null) {
+    return binaryResponse(body, headers);
+  }
+  if (range === false) {
+    return new Response('Range Not Satisfiable', {
+      status: 416,
+      headers: { 'Content-Range': `bytes */${total}` },
+    });
+  }
+  const [start, end] = range;
+  return binaryResponse(body.slice(start, end + 1), {
+    ...headers,
+    'Content-Range': `bytes ${start}-${end}/${total}`,
+  }, 206);
+}
+
+/**
+ * Parses a single-range `Range` header against a body of `total` bytes:
+ * [start, end] (inclusive), null to serve the whole body (no header, or one we
+ * don't handle, such as several ranges), or false if it's unsatisfiable.
+ */
+function parseByteRange(header, total) {
+  const m = header && header.match(/^bytes=(\d*)-(\d*)$/);
+  if (!m || (m[1] === '' && m[2] === '')) return null;
+  let start, end;
+  if (m[1] === '') {
+    // Suffix range: the last N bytes.
+    start = Math.max(0, total - parseInt(m[2], 10));
+    end = total - 1;
+  } else {
+    start = parseInt(m[1], 10);
+    end = m[2] === '' ? total - 1 : Math.min(parseInt(m[2], 10), total - 1);
+  }
+  if (start >= total || start > end) return false;
+  return [start, end];
+}
+
+/**
+ * Hex SHA-256 of firmware `version`. ota-publish.sh stores it as
+ * `firmware:sha256:{version}`; for releases published before that, it's
+ * computed here once from `firmware:bin:{version}` and stored.
+ */
+async function firmwareSha256(env, version) {
+  const key = `firmware:sha256:${version}`;
+  const cached = await env.WEATHER_KV.get(key, 'text');
+  if (cached) return cached;
+  const bin = await env.WEATHER_KV.get(`firmware:bin:${version}`, 'arrayBuffer');
+  if (!bin) return '';
+  const digest = await crypto.subtle.digest('SHA-256', bin);
+  const hex = [...new Uint8Array(digest)].map((b) => b.toString(16).padStart(2, '0')).join('');
+  await env.WEATHER_KV.put(key, hex);
+  return hex;
+}
@@ -43,6 +43,20 @@ export class WeatherProvider {
     throw new Error("transform() must be implemented by subclass");
   }
 
+  /**
+   * Data for the hourly frames from the current hour on, from a fetchRaw()
+   * response: the hour in progress, then up to `hours` more, as entries of
+   * { from, until, data } (epoch seconds, and transformed
+   * data as the display should look for that hour). Providers without an
+   * hourly forecast return none.
+   * @param {Object} rawData - Raw API response
+   * @param {number} hours
+   * @returns {Array<{from: number, until: number, data: Object}>}
+   */
+  forecastAhead(rawData, hours) {
+    return [];
+  }
+
   /**
    * Convenience method: fetch and transform in one call
    * @returns {Promise<Object>} Transformed weather data
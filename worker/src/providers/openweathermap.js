@@ -35,7 +35,40 @@ export class OpenWeatherMapProvider extends WeatherProvider {
     return await response.json();
   }
 
-  transform(data) {
+  /**
+   * The next `hours` hourly frames' worth of data: hour k is the forecast for
+   * hourly[k] presented as if it were current — its conditions as `current`,
+   * the chart starting at it, that day's high/low/sun/moon, and `updated` at
+   * the hour's start so the chart's "now" moves with it. The nowcast override
+   * is left out: it's about the present, not the forecast.
+   */
+  forecastAhead(data, hours) {
+    const frames = [];
+    const localDay = (dt) => new Date((dt + data.timezone_offset) * 1000).toISOString().slice(0, 10);
+    // hourly[0] is the hour in progress: its frame keeps the observed current
+    // conditions, so a device that goes offline right after fetching the
+    // bundle still has a frame for now.
+    for (let k = 0; k <= hours && k + 24 <= data.hourly.length; k++) {
+      const hour = data.hourly[k];
+      const day = data.daily.findIndex((d) => localDay(d.dt) === localDay(hour.dt));
+      if (day < 0) break;
+      const ahead = {
+        ...data,
+        current: k === 0 ? data.current : { ...hour, rain: undefined, snow: undefined },
+        hourly: data.hourly.slice(k),
+        minutely: undefined,
+        daily: data.daily.slice(day),
+      };
+      frames.push({
+        from: hour.dt,
+        until: hour.dt + 3600,
+        data: this.transform(ahead, new Date(hour.dt * 1000)),
+      });
+    }
+    return frames;
+  }
+
+  transform(data, at = new Date()) {
     const current = data.current;
     const hourly = data.hourly;  // 48 hours
     const daily = data.daily[0]; // Today
@@ -192,7 +225,7 @@ export class OpenWeatherMapProvider extends WeatherProvider {
           second: '2-digit',
           hour12: false
         });
-        const parts = formatter.formatToParts(new Date());
+        const parts = formatter.formatToParts(at);
         const get = (type) => parts.find(p => p.type === type)?.value || '00';
         return `${get('year')}-${get('month')}-${get('day')}T${get('hour')}:${get('minute')}:${get('second')}`;
       })()
@@ -132,10 +132,16 @@ async function zlibCompress(data) {
  * Composites on white before luma conversion so semi-transparent edges
  * look correct on the e-paper's white background.
  * Luma: ITU-R BT.601 — Y = (77R + 150G + 29B) >> 8
+ *
+ * bitDepth 8 is the classic frame. bitDepth 4 is pre-quantized to the panel's
+ * 16 levels (luma >> 4 — the same truncation the firmware's epd_draw_pixel
+ * applies), packed two pixels per byte, so rows map onto the device's 4bpp
+ * framebuffer with just a nibble swap and the payload roughly halves.
  */
-async function rgbaToGrayscalePng(width, height, pixels) {
-  // Build raw scanlines: filter byte (0 = None) + width gray bytes per row.
-  const rowLen = width + 1;
+async function rgbaToGrayscalePng(width, height, pixels, bitDepth = 8) {
+  // Build raw scanlines: filter byte (0 = None) + packed gray samples per row.
+  const rowBytes = bitDepth === 4 ? Math.ceil(width / 2) : width;
+  const rowLen = rowBytes + 1;
   const raw = new Uint8Array(height * rowLen);
 
   for (let y = 0; y < height; y++) {
@@ -146,7 +152,13 @@ async function rgbaToGrayscalePng(width, height, pixels) {
       const r = Math.round(pixels[i]     * a + 255 * (1 - a));
       const g = Math.round(pixels[i + 1] * a + 255 * (1 - a));
       const b = Math.round(pixels[i + 2] * a + 255 * (1 - a));
-      raw[y * rowLen + x + 1] = (77 * r + 150 * g + 29 * b) >> 8;
+      const luma = (77 * r + 150 * g + 29 * b) >> 8;
+      if (bitDepth === 4) {
+        // PNG packs the leftmost pixel in the high nibble.
+        raw[y * rowLen + 1 + (x >> 1)] |= (x & 1) ? (luma >> 4) : (luma & 0xf0);
+      } else {
+        raw[y * rowLen + x + 1] = luma;
+      }
     }
   }
 
@@ -157,7 +169,7 @@ async function rgbaToGrayscalePng(width, height, pixels) {
   const ihdrView = new DataView(ihdr.buffer);
   ihdrView.setUint32(0, width);
   ihdrView.setUint32(4, height);
-  ihdr[8] = 8;  // bit depth
+  ihdr[8] = bitDepth;  // bit depth
   ihdr[9] = 0;  // color type: grayscale
   ihdr[10] = 0; // compression: deflate
   ihdr[11] = 0; // filter: adaptive
@@ -182,13 +194,15 @@ async function rgbaToGrayscalePng(width, height, pixels) {
 // ─── public API ──────────────────────────────────────────────────────────────
 
 /**
- * Render a weather frame to a grayscale PNG (Uint8Array).
+ * Render a weather frame to grayscale PNGs, once per frame format the
+ * devices may negotiate (layout + rasterization run only once).
  *
  * @param {object} data - Normalized WeatherData (same shape as /weather.json).
  * @param {object} [options] - { location } — the zip, used by the message status.
- * @returns {Promise<Uint8Array>} 960×540 8bpp grayscale PNG bytes.
+ * @returns {Promise<{png: Uint8Array, png4: Uint8Array}>} 960×540 grayscale
+ *   PNG bytes: `png` at 8bpp (default format), `png4` pre-quantized at 4bpp.
  */
-export async function renderWeatherPng(data, options = {}) {
+export async function renderWeatherPngs(data, options = {}) {
   await ensureWasm();
 
   const context = { location: options.location, messages: messagesCsv };
@@ -208,6 +222,10 @@ export async function renderWeatherPng(data, options = {}) {
   const rendered = resvg.render();
   const pixels = rendered.pixels; // Uint8Array, RGBA, row-major
 
-  // RGBA → grayscale PNG
-  return rgbaToGrayscalePng(rendered.width, rendered.height, pixels);
+  // RGBA → grayscale PNGs
+  const [png, png4] = await Promise.all([
+    rgbaToGrayscalePng(rendered.width, rendered.height, pixels, 8),
+    rgbaToGrayscalePng(rendered.width, rendered.height, pixels, 4),
+  ]);
+  return { png, png4 };
 }